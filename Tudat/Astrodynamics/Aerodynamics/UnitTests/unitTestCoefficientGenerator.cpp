@@ -392,6 +392,66 @@ BOOST_AUTO_TEST_CASE( testApolloCapsule )
                        toleranceAerodynamicCoefficients5 );
 }
 
+//! Test whether coefficients generated concurrently are identical to those generated in a single thread.
+BOOST_AUTO_TEST_CASE( testParallelCoefficientGeneration )
+{
+    // Create test capsule, with finely discretized parts.
+    boost::shared_ptr< geometric_shapes::Capsule > capsule
+            = boost::make_shared< geometric_shapes::Capsule >(
+                4.694, 1.956, 2.662, -1.0 * 33.0 * PI / 180.0, 0.196 );
+    std::vector< int > numberOfLines( 4, 61 );
+    std::vector< int > numberOfPoints( 4, 61 );
+    std::vector< bool > invertOrders( 4, false );
+
+    std::vector< std::vector< int > > selectedMethods( 2, std::vector< int >( 4 ) );
+    selectedMethods[ 0 ][ 0 ] = 1;
+    selectedMethods[ 0 ][ 1 ] = 5;
+    selectedMethods[ 0 ][ 2 ] = 5;
+    selectedMethods[ 0 ][ 3 ] = 1;
+    selectedMethods[ 1 ][ 0 ] = 6;
+    selectedMethods[ 1 ][ 1 ] = 3;
+    selectedMethods[ 1 ][ 2 ] = 3;
+    selectedMethods[ 1 ][ 3 ] = 3;
+
+    std::vector< std::vector< double > > independentVariableDataPoints( 3 );
+    independentVariableDataPoints[ 0 ] = getDefaultHypersonicLocalInclinationMachPoints( "Full" );
+    for ( int i = 0; i < 21; i++ )
+    {
+        independentVariableDataPoints[ 1 ].push_back( static_cast< double >( i - 20 ) * 2.0 * PI / 180.0 );
+    }
+    for ( int i = 0; i < 5; i++ )
+    {
+        independentVariableDataPoints[ 2 ].push_back( static_cast< double >( i ) * 1.0 * PI / 180.0 );
+    }
+
+    // Generate coefficients using different numbers of threads.
+    std::vector< unsigned int > numbersOfThreads = { 1, 2, 4 };
+    std::vector< boost::multi_array< Vector6d, 3 > > coefficientTables;
+    for ( unsigned int i = 0; i < numbersOfThreads.size( ); i++ )
+    {
+        boost::shared_ptr< HypersonicLocalInclinationAnalysis > coefficientInterface =
+                boost::make_shared< HypersonicLocalInclinationAnalysis >(
+                    independentVariableDataPoints, capsule, numberOfLines, numberOfPoints,
+                    invertOrders, selectedMethods, PI * pow( capsule->getMiddleRadius( ), 2.0 ),
+                    3.9116, Eigen::Vector3d( -0.6624, 0.0, -0.1369 ), numbersOfThreads.at( i ) );
+        coefficientTables.push_back( coefficientInterface->getAerodynamicCoefficientsTables( ) );
+    }
+
+    // Check that coefficients are identical.
+    for ( unsigned int i = 1; i < coefficientTables.size( ); i++ )
+    {
+        BOOST_CHECK_EQUAL( coefficientTables.at( i ).num_elements( ), coefficientTables.at( 0 ).num_elements( ) );
+        for ( unsigned int j = 0; j < coefficientTables.at( 0 ).num_elements( ); j++ )
+        {
+            for ( int k = 0; k < 6; k++ )
+            {
+                BOOST_CHECK_EQUAL( coefficientTables.at( i ).data( )[ j ]( k ),
+                                   coefficientTables.at( 0 ).data( )[ j ]( k ) );
+            }
+        }
+    }
+}
+
 BOOST_AUTO_TEST_SUITE_END( )
 
 } // namespace unit_tests
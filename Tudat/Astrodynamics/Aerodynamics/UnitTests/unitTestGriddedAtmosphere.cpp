@@ -0,0 +1,279 @@
+/*    Copyright (c) 2010-2017, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ */
+
+#define BOOST_TEST_MAIN
+
+#include <cmath>
+
+#include <boost/bind.hpp>
+#include <boost/make_shared.hpp>
+#include <boost/test/unit_test.hpp>
+
+#include "Tudat/Astrodynamics/Aerodynamics/exponentialAtmosphere.h"
+#include "Tudat/Astrodynamics/Aerodynamics/griddedAtmosphere.h"
+#include "Tudat/Mathematics/BasicMathematics/mathematicalConstants.h"
+
+namespace tudat
+{
+namespace unit_tests
+{
+
+using namespace tudat::aerodynamics;
+using mathematical_constants::PI;
+
+//! Atmosphere model with analytical dependency on altitude, latitude, local solar time and time, used for testing.
+class AnalyticalTestAtmosphere : public AtmosphereModel
+{
+public:
+
+    AnalyticalTestAtmosphere( const double referenceEpoch ): referenceEpoch_( referenceEpoch ){ }
+
+    double getDensity( const double altitude, const double longitude,
+                       const double latitude, const double time )
+    {
+        return std::exp( -altitude / 7.0E3 + 0.3 * std::sin( latitude ) +
+                         0.5 * std::cos( computeMeanLocalSolarTime( longitude, time ) * PI / 12.0 ) +
+                         0.2 * ( time - referenceEpoch_ ) / 86400.0 );
+    }
+
+    double getPressure( const double altitude, const double longitude,
+                        const double latitude, const double time )
+    {
+        return getDensity( altitude, longitude, latitude, time ) * 287.0 *
+                getTemperature( altitude, longitude, latitude, time );
+    }
+
+    double getTemperature( const double altitude, const double longitude,
+                           const double latitude, const double time )
+    {
+        return 1000.0 + 1.0E-3 * altitude + 200.0 * std::cos(
+                    computeMeanLocalSolarTime( longitude, time ) * PI / 12.0 ) + 10.0 * latitude;
+    }
+
+    double getSpeedOfSound( const double altitude, const double longitude,
+                            const double latitude, const double time )
+    {
+        return std::sqrt( 1.4 * 287.0 * getTemperature( altitude, longitude, latitude, time ) );
+    }
+
+private:
+
+    double referenceEpoch_;
+};
+
+//! Function to create an analytical test atmosphere (for each thread generating the grid).
+boost::shared_ptr< AtmosphereModel > createAnalyticalTestAtmosphere( const double referenceEpoch )
+{
+    return boost::make_shared< AnalyticalTestAtmosphere >( referenceEpoch );
+}
+
+//! Function to create an exponential atmosphere (for each thread generating the grid).
+boost::shared_ptr< AtmosphereModel > createExponentialTestAtmosphere( const double densityAtZeroAltitude )
+{
+    return boost::make_shared< ExponentialAtmosphere >( 7.2E3, 246.0, densityAtZeroAltitude, 287.0 );
+}
+
+BOOST_AUTO_TEST_SUITE( test_gridded_atmosphere )
+
+//! Test whether the gridded atmosphere reproduces the sampled model at the grid nodes, and approximates it to within
+//! the expected interpolation error in between.
+BOOST_AUTO_TEST_CASE( testGriddedAtmosphereAccuracy )
+{
+    const double referenceEpoch = 1.0E8;
+    boost::shared_ptr< AtmosphereModel > sampledAtmosphere =
+            boost::make_shared< AnalyticalTestAtmosphere >( referenceEpoch );
+
+    // Create grid with 1 km altitude, 5 degree latitude and 1 hour local solar time resolution, in parallel.
+    GriddedAtmosphere griddedAtmosphere(
+                boost::bind( &createAnalyticalTestAtmosphere, referenceEpoch ), 100.0E3, 300.0E3, 201, 37, 24,
+                referenceEpoch );
+
+    BOOST_CHECK_EQUAL( griddedAtmosphere.getMinimumAltitude( ), 100.0E3 );
+    BOOST_CHECK_CLOSE_FRACTION( griddedAtmosphere.getMaximumAltitude( ), 300.0E3, 1.0E-15 );
+    BOOST_CHECK_EQUAL( griddedAtmosphere.getNumberOfGridPoints( ), 201 * 37 * 24 );
+
+    // Check that grid is independent of number of threads.
+    GriddedAtmosphere serialGriddedAtmosphere(
+                boost::bind( &createAnalyticalTestAtmosphere, referenceEpoch ),
+                100.0E3, 300.0E3, 201, 37, 24, referenceEpoch, TUDAT_NAN, 1, true, 1 );
+
+    // Compare with model sampled at reference epoch at grid nodes (evaluated at various longitudes and times with the
+    // same local solar time, which should not influence the result).
+    for( unsigned int i = 0; i < 24; i++ )
+    {
+        for( unsigned int j = 0; j < 37; j += 4 )
+        {
+            for( unsigned int k = 0; k < 201; k += 20 )
+            {
+                const double altitude = 100.0E3 + k * 1.0E3;
+                const double latitude = -PI / 2.0 + j * PI / 36.0;
+                const double time = referenceEpoch + ( i % 3 ) * 1000.0;
+                const double longitude = ( static_cast< double >( i ) -
+                                           computeMeanLocalSolarTime( 0.0, time ) ) * PI / 12.0;
+                const double referenceLongitude = ( static_cast< double >( i ) -
+                                                    computeMeanLocalSolarTime( 0.0, referenceEpoch ) ) * PI / 12.0;
+
+                BOOST_CHECK_CLOSE_FRACTION(
+                            griddedAtmosphere.getDensity( altitude, longitude, latitude, time ),
+                            sampledAtmosphere->getDensity( altitude, referenceLongitude, latitude, referenceEpoch ),
+                            1.0E-10 );
+                BOOST_CHECK_CLOSE_FRACTION(
+                            griddedAtmosphere.getTemperature( altitude, longitude, latitude, time ),
+                            sampledAtmosphere->getTemperature( altitude, referenceLongitude, latitude, referenceEpoch ),
+                            1.0E-10 );
+                BOOST_CHECK_EQUAL( griddedAtmosphere.getDensity( altitude, longitude, latitude, time ),
+                                   serialGriddedAtmosphere.getDensity( altitude, longitude, latitude, time ) );
+                BOOST_CHECK_EQUAL( griddedAtmosphere.getSpeedOfSound( altitude, longitude, latitude, time ),
+                                   serialGriddedAtmosphere.getSpeedOfSound( altitude, longitude, latitude, time ) );
+            }
+        }
+    }
+
+    // Compare with sampled model in between grid nodes, to within second-order interpolation error bound.
+    const double maximumLogarithmicDensityError =
+            ( 0.3 * std::pow( PI / 36.0, 2 ) + 0.5 * std::pow( PI / 12.0, 2 ) ) / 8.0;
+    const double maximumTemperatureError = 200.0 * std::pow( PI / 12.0, 2 ) / 8.0;
+    const unsigned int numberOfTestPoints = 100000;
+    std::vector< double > altitudes, longitudes, latitudes;
+    for( unsigned int i = 0; i < numberOfTestPoints; i++ )
+    {
+        altitudes.push_back( 100.0E3 + 200.0E3 * std::fmod( 0.6180339887 * i, 1.0 ) );
+        longitudes.push_back( -PI + 2.0 * PI * std::fmod( 0.7548776662 * i, 1.0 ) );
+        latitudes.push_back( -PI / 2.0 + PI * std::fmod( 0.5698402910 * i, 1.0 ) );
+    }
+
+    for( unsigned int i = 0; i < numberOfTestPoints; i++ )
+    {
+        const double sampledDensity = sampledAtmosphere->getDensity(
+                    altitudes.at( i ), longitudes.at( i ), latitudes.at( i ), referenceEpoch );
+        const double griddedDensity = griddedAtmosphere.getDensity(
+                    altitudes.at( i ), longitudes.at( i ), latitudes.at( i ), referenceEpoch );
+        BOOST_CHECK_SMALL( std::log( griddedDensity / sampledDensity ), maximumLogarithmicDensityError );
+
+        // Logarithm of temperature varies by less than 4.0E-2 per (radian of local solar time)^2 over grid.
+        BOOST_CHECK_SMALL( std::log( griddedAtmosphere.getPressure(
+                                         altitudes.at( i ), longitudes.at( i ), latitudes.at( i ), referenceEpoch ) /
+                                     sampledAtmosphere->getPressure(
+                                         altitudes.at( i ), longitudes.at( i ), latitudes.at( i ), referenceEpoch ) ),
+                           maximumLogarithmicDensityError + 0.3 * std::pow( PI / 12.0, 2 ) / 8.0 );
+        BOOST_CHECK_SMALL( griddedAtmosphere.getTemperature(
+                               altitudes.at( i ), longitudes.at( i ), latitudes.at( i ), referenceEpoch ) -
+                           sampledAtmosphere->getTemperature(
+                               altitudes.at( i ), longitudes.at( i ), latitudes.at( i ), referenceEpoch ),
+                           maximumTemperatureError );
+    }
+
+    // Check periodicity in local solar time, and limitation of altitude and latitude to grid.
+    BOOST_CHECK_CLOSE_FRACTION( griddedAtmosphere.getDensity( 150.0E3, 0.0, 0.1, referenceEpoch ),
+                                griddedAtmosphere.getDensity( 150.0E3, 2.0 * PI, 0.1, referenceEpoch ), 1.0E-12 );
+    BOOST_CHECK_CLOSE_FRACTION( griddedAtmosphere.getDensity( 150.0E3, 0.0, 0.1, referenceEpoch ),
+                                griddedAtmosphere.getDensity( 150.0E3, 0.0, 0.1, referenceEpoch + 86400.0 ), 1.0E-12 );
+    BOOST_CHECK_EQUAL( griddedAtmosphere.getDensity( 50.0E3, 0.0, 0.1, referenceEpoch ),
+                       griddedAtmosphere.getDensity( 100.0E3, 0.0, 0.1, referenceEpoch ) );
+    BOOST_CHECK_EQUAL( griddedAtmosphere.getDensity( 400.0E3, 0.0, 0.1, referenceEpoch ),
+                       griddedAtmosphere.getDensity( 300.0E3, 0.0, 0.1, referenceEpoch ) );
+    BOOST_CHECK_CLOSE_FRACTION( griddedAtmosphere.getDensity( 150.0E3, 0.0, PI, referenceEpoch ),
+                                griddedAtmosphere.getDensity( 150.0E3, 0.0, PI / 2.0, referenceEpoch ), 1.0E-12 );
+}
+
+//! Test gridded atmosphere with epoch dependency, and with linear interpolation of density.
+BOOST_AUTO_TEST_CASE( testGriddedAtmosphereWithEpochs )
+{
+    const double referenceEpoch = 1.0E8;
+    boost::shared_ptr< AtmosphereModel > sampledAtmosphere =
+            boost::make_shared< AnalyticalTestAtmosphere >( referenceEpoch );
+
+    // Create grid covering 10 days, with nodes every day.
+    GriddedAtmosphere griddedAtmosphere(
+                boost::bind( &createAnalyticalTestAtmosphere, referenceEpoch ), 100.0E3, 300.0E3, 21, 37, 24,
+                referenceEpoch, referenceEpoch + 10.0 * 86400.0, 11 );
+    BOOST_CHECK_EQUAL( griddedAtmosphere.getNumberOfEpochs( ), 11 );
+    BOOST_CHECK_EQUAL( griddedAtmosphere.getNumberOfGridPoints( ), 11 * 21 * 37 * 24 );
+
+    // Density depends exponentially on time, so that logarithmic interpolation in time is exact at constant local solar
+    // time; at other times, the error is limited by the interpolation in local solar time.
+    const double maximumLogarithmicDensityError = 0.5 * std::pow( PI / 12.0, 2 ) / 8.0;
+    for( unsigned int i = 0; i < 1000; i++ )
+    {
+        const double time = referenceEpoch + 10.0 * 86400.0 * std::fmod( 0.6180339887 * i, 1.0 );
+        const double altitude = 100.0E3 + 200.0E3 * std::fmod( 0.7548776662 * i, 1.0 );
+        const double latitude = -PI / 2.0 + PI * std::fmod( 0.5698402910 * i, 1.0 );
+
+        // Choose longitude such that local solar time is at a grid node.
+        const double longitude = ( static_cast< double >( i % 24 ) -
+                                   computeMeanLocalSolarTime( 0.0, time ) ) * PI / 12.0;
+        const double latitudeGridError = 0.3 * std::pow( PI / 36.0, 2 ) / 8.0;
+        BOOST_CHECK_SMALL( std::log( griddedAtmosphere.getDensity( altitude, longitude, latitude, time ) /
+                                     sampledAtmosphere->getDensity( altitude, longitude, latitude, time ) ),
+                           latitudeGridError );
+
+        BOOST_CHECK_SMALL( std::log( griddedAtmosphere.getDensity( altitude, longitude + 0.1, latitude, time ) /
+                                     sampledAtmosphere->getDensity( altitude, longitude + 0.1, latitude, time ) ),
+                           latitudeGridError + maximumLogarithmicDensityError );
+    }
+
+    // Check that epochs outside grid are limited to grid.
+    BOOST_CHECK_EQUAL( griddedAtmosphere.getDensity( 150.0E3, 0.0, 0.1, referenceEpoch - 86400.0 ),
+                       griddedAtmosphere.getDensity( 150.0E3, 0.0, 0.1, referenceEpoch ) );
+    BOOST_CHECK_EQUAL( griddedAtmosphere.getDensity( 150.0E3, 0.0, 0.1, referenceEpoch + 11.0 * 86400.0 ),
+                       griddedAtmosphere.getDensity( 150.0E3, 0.0, 0.1, referenceEpoch + 10.0 * 86400.0 ) );
+
+    // Check linear interpolation of density, which is exact for exponential atmosphere only at altitude nodes.
+    boost::shared_ptr< AtmosphereModel > exponentialAtmosphere = createExponentialTestAtmosphere( 1.225 );
+    GriddedAtmosphere linearGriddedAtmosphere(
+                boost::bind( &createExponentialTestAtmosphere, 1.225 ), 0.0, 100.0E3, 101, 2, 1,
+                referenceEpoch, TUDAT_NAN, 1, false );
+    GriddedAtmosphere logarithmicGriddedAtmosphere(
+                boost::bind( &createExponentialTestAtmosphere, 1.225 ), 0.0, 100.0E3, 101, 2, 1, referenceEpoch );
+    const double maximumLinearInterpolationError = 1.2 * std::pow( 1.0E3 / 7.2E3, 2 ) / 8.0;
+    for( double altitude = 0.0; altitude <= 100.0E3; altitude += 1234.5 )
+    {
+        const double exactDensity = exponentialAtmosphere->getDensity( altitude, 0.0, 0.0, 0.0 );
+        BOOST_CHECK_CLOSE_FRACTION( logarithmicGriddedAtmosphere.getDensity( altitude, 0.3, 0.2, 1.0E3 ),
+                                    exactDensity, 1.0E-12 );
+        BOOST_CHECK_CLOSE_FRACTION( linearGriddedAtmosphere.getDensity( altitude, 0.3, 0.2, 1.0E3 ),
+                                    exactDensity, maximumLinearInterpolationError );
+        BOOST_CHECK_CLOSE_FRACTION( linearGriddedAtmosphere.getPressure( altitude, 0.3, 0.2, 1.0E3 ),
+                                    exponentialAtmosphere->getPressure( altitude, 0.0, 0.0, 0.0 ),
+                                    maximumLinearInterpolationError );
+    }
+}
+
+//! Test whether invalid grid settings are rejected.
+BOOST_AUTO_TEST_CASE( testGriddedAtmosphereErrors )
+{
+    boost::function< boost::shared_ptr< AtmosphereModel >( ) > atmosphereCreationFunction =
+            boost::bind( &createExponentialTestAtmosphere, 1.225 );
+
+    BOOST_CHECK_THROW( boost::make_shared< GriddedAtmosphere >(
+                           atmosphereCreationFunction, 0.0, 100.0E3, 1, 2, 1, 0.0 ), std::runtime_error );
+    BOOST_CHECK_THROW( boost::make_shared< GriddedAtmosphere >(
+                           atmosphereCreationFunction, 100.0E3, 0.0, 11, 2, 1, 0.0 ), std::runtime_error );
+    BOOST_CHECK_THROW( boost::make_shared< GriddedAtmosphere >(
+                           atmosphereCreationFunction, 0.0, 100.0E3, 11, 1, 1, 0.0 ), std::runtime_error );
+    BOOST_CHECK_THROW( boost::make_shared< GriddedAtmosphere >(
+                           atmosphereCreationFunction, 0.0, 100.0E3, 11, 2, 0, 0.0 ), std::runtime_error );
+    BOOST_CHECK_THROW( boost::make_shared< GriddedAtmosphere >(
+                           atmosphereCreationFunction, 0.0, 100.0E3, 11, 2, 1, 0.0, TUDAT_NAN, 2 ),
+                       std::runtime_error );
+
+    // Check that logarithm of non-positive density is not interpolated.
+    atmosphereCreationFunction = boost::bind( &createExponentialTestAtmosphere, 0.0 );
+    BOOST_CHECK_THROW( boost::make_shared< GriddedAtmosphere >(
+                           atmosphereCreationFunction, 0.0, 100.0E3, 11, 2, 1, 0.0 ), std::runtime_error );
+    GriddedAtmosphere zeroDensityGriddedAtmosphere(
+                atmosphereCreationFunction, 0.0, 100.0E3, 11, 2, 1, 0.0, TUDAT_NAN, 1, false );
+    BOOST_CHECK_EQUAL( zeroDensityGriddedAtmosphere.getDensity( 5.0E3, 0.0, 0.0, 0.0 ), 0.0 );
+}
+
+BOOST_AUTO_TEST_SUITE_END( )
+
+} // namespace unit_tests
+} // namespace tudat
@@ -17,15 +17,20 @@
 #define BOOST_TEST_MAIN
 
 #include <algorithm>
+#include <chrono>
+#include <iostream>
 #include <vector>
 #include <utility>
 
 #include <boost/assign/list_of.hpp>
 #include <boost/bind.hpp>
+#include <boost/make_shared.hpp>
 #include <boost/test/unit_test.hpp>
 
+#include "Tudat/Astrodynamics/Aerodynamics/griddedAtmosphere.h"
 #include "Tudat/Astrodynamics/Aerodynamics/nrlmsise00Atmosphere.h"
 #include "Tudat/Astrodynamics/Aerodynamics/tabulatedAtmosphere.h"
+#include "Tudat/Astrodynamics/BasicAstrodynamics/physicalConstants.h"
 #include "Tudat/InputOutput/basicInputOutput.h"
 
 #include "Tudat/Astrodynamics/Aerodynamics/nrlmsise00InputFunctions.h"
@@ -1122,6 +1127,258 @@ BOOST_AUTO_TEST_CASE( test_nrlmise_InputFunction_with_adjustment )
     BOOST_CHECK_CLOSE_FRACTION(verificationData[5]*1000 , computedDensity , 1E-11);
 }
 
+//! Function to create points (e.g. of a number of satellites) at which atmosphere properties are to be computed.
+void getNrlmsise00TestPoints( const unsigned int numberOfPoints, std::vector< double >& altitudes,
+                              std::vector< double >& longitudes, std::vector< double >& latitudes )
+{
+    for( unsigned int i = 0; i < numberOfPoints; i++ )
+    {
+        altitudes.push_back( 300.0E3 + 200.0 * i );
+        longitudes.push_back( -PI + 2.0 * PI * std::fmod( 0.618034 * i, 1.0 ) );
+        latitudes.push_back( 0.5 * PI * std::sin( 0.1 * i ) );
+    }
+}
+
+//! Test computation of properties at multiple points, and use of cache of model evaluations.
+BOOST_AUTO_TEST_CASE( test_nrlmise_MultiplePointsAndCache )
+{
+    double julianDate = tudat::basic_astrodynamics::convertCalendarDateToJulianDay< double >( 2030, 6, 21, 8, 3, 20.0 );
+    double time = tudat::basic_astrodynamics::convertJulianDayToSecondsSinceEpoch(
+                    julianDate , tudat::basic_astrodynamics::JULIAN_DAY_ON_J2000) ;
+
+    std::string cppPath( __FILE__ );
+    std::string folder = cppPath.substr( 0, cppPath.find_last_of("/\\")+1);
+    tudat::input_output::solar_activity::SolarActivityDataMap solarActivityData =
+            tudat::input_output::solar_activity::readSolarActivityData( folder + "swAtmosTestNoAdjust.txt" ) ;
+
+    // Create atmosphere models with local solar time computed from longitude.
+    boost::function< tudat::aerodynamics::NRLMSISE00Input (double,double,double,double) > inputFunction =
+            boost::bind(&tudat::aerodynamics::nrlmsiseInputFunction,_1,_2,_3,_4, solarActivityData , false , 0.0 );
+    NRLMSISE00Atmosphere singlePointModel( inputFunction );
+    NRLMSISE00Atmosphere multiplePointModel( inputFunction );
+
+    // Define points (e.g. of a number of satellites) at which properties are to be computed.
+    const unsigned int numberOfPoints = 1000;
+    std::vector< double > altitudes, longitudes, latitudes;
+    getNrlmsise00TestPoints( numberOfPoints, altitudes, longitudes, latitudes );
+
+    // Compare properties computed for single points and for all points at once.
+    std::vector< double > singlePointDensities;
+    for( unsigned int i = 0; i < numberOfPoints; i++ )
+    {
+        singlePointDensities.push_back(
+                    singlePointModel.getDensity( altitudes.at( i ), longitudes.at( i ), latitudes.at( i ), time ) );
+    }
+
+    std::vector< tudat::aerodynamics::NRLMSISE00Properties > properties;
+    multiplePointModel.computePropertiesAtPoints( time, altitudes, longitudes, latitudes, properties );
+
+    BOOST_CHECK_EQUAL( properties.size( ), numberOfPoints );
+    for( unsigned int i = 0; i < numberOfPoints; i++ )
+    {
+        BOOST_CHECK_CLOSE_FRACTION( properties.at( i ).density, singlePointDensities.at( i ), 1.0E-12 );
+        BOOST_CHECK_CLOSE_FRACTION(
+                    properties.at( i ).temperature,
+                    singlePointModel.getTemperature( altitudes.at( i ), longitudes.at( i ), latitudes.at( i ), time ),
+                    1.0E-12 );
+        BOOST_CHECK_CLOSE_FRACTION(
+                    properties.at( i ).numberDensities.at( 1 ),
+                    singlePointModel.getNumberDensities(
+                        altitudes.at( i ), longitudes.at( i ), latitudes.at( i ), time ).at( 1 ), 1.0E-12 );
+    }
+
+    // Check that properties are identical when using cache without rounding, and that cache is limited in size.
+    NRLMSISE00Atmosphere cachedModel( inputFunction );
+    cachedModel.setCacheSettings( 100 );
+    for( unsigned int j = 0; j < 3; j++ )
+    {
+        for( unsigned int i = 0; i < 50; i++ )
+        {
+            BOOST_CHECK_EQUAL( cachedModel.getDensity( altitudes.at( i ), longitudes.at( i ), latitudes.at( i ), time ),
+                               singlePointDensities.at( i ) );
+        }
+    }
+    BOOST_CHECK_EQUAL( cachedModel.getNumberOfCacheEntries( ), 50 );
+
+    for( unsigned int i = 0; i < numberOfPoints; i++ )
+    {
+        cachedModel.getDensity( altitudes.at( i ), longitudes.at( i ), latitudes.at( i ), time );
+    }
+    BOOST_CHECK_EQUAL( cachedModel.getNumberOfCacheEntries( ), 100 );
+
+    // Evaluate points alternately (as for a number of bodies at each integrator stage), which are all in the cache.
+    cachedModel.setCacheSettings( numberOfPoints );
+    for( unsigned int i = 0; i < numberOfPoints; i++ )
+    {
+        cachedModel.getDensity( altitudes.at( i ), longitudes.at( i ), latitudes.at( i ), time );
+    }
+    for( unsigned int i = 0; i < numberOfPoints; i++ )
+    {
+        BOOST_CHECK_EQUAL( cachedModel.getDensity( altitudes.at( i ), longitudes.at( i ), latitudes.at( i ), time ),
+                           singlePointDensities.at( i ) );
+    }
+
+    // Check that properties with rounded independent variables are those at rounded point, independent of order of
+    // evaluation.
+    const double altitudeResolution = 100.0;
+    const double angleResolution = 1.0E-4;
+    const double timeResolution = 10.0;
+    cachedModel.setCacheSettings( 10, altitudeResolution, angleResolution, timeResolution );
+    for( unsigned int i = 0; i < 20; i++ )
+    {
+        double roundedAltitude = std::round( altitudes.at( i ) / altitudeResolution ) * altitudeResolution;
+        double roundedLongitude = std::round( longitudes.at( i ) / angleResolution ) * angleResolution;
+        double roundedLatitude = std::round( latitudes.at( i ) / angleResolution ) * angleResolution;
+        double roundedTime = std::round( time / timeResolution ) * timeResolution;
+        double expectedDensity = singlePointModel.getDensity(
+                    roundedAltitude, roundedLongitude, roundedLatitude, roundedTime );
+
+        BOOST_CHECK_EQUAL( cachedModel.getDensity(
+                               roundedAltitude + 0.3 * altitudeResolution, roundedLongitude - 0.3 * angleResolution,
+                               roundedLatitude + 0.3 * angleResolution, roundedTime - 0.3 * timeResolution ),
+                           expectedDensity );
+        BOOST_CHECK_EQUAL( cachedModel.getDensity(
+                               roundedAltitude - 0.3 * altitudeResolution, roundedLongitude + 0.3 * angleResolution,
+                               roundedLatitude - 0.3 * angleResolution, roundedTime + 0.3 * timeResolution ),
+                           expectedDensity );
+        BOOST_CHECK_EQUAL( cachedModel.getDensity( altitudes.at( i ), longitudes.at( i ), latitudes.at( i ), time ),
+                           expectedDensity );
+    }
+
+    // Check multiple-point computation with cache, and inconsistent input.
+    cachedModel.setCacheSettings( 2 * numberOfPoints );
+    std::vector< tudat::aerodynamics::NRLMSISE00Properties > cachedProperties;
+    for( unsigned int j = 0; j < 2; j++ )
+    {
+        cachedModel.computePropertiesAtPoints( time, altitudes, longitudes, latitudes, cachedProperties );
+        for( unsigned int i = 0; i < numberOfPoints; i++ )
+        {
+            BOOST_CHECK_EQUAL( cachedProperties.at( i ).density, properties.at( i ).density );
+        }
+    }
+    BOOST_CHECK_EQUAL( cachedModel.getNumberOfCacheEntries( ), numberOfPoints );
+
+    altitudes.pop_back( );
+    BOOST_CHECK_THROW( cachedModel.computePropertiesAtPoints( time, altitudes, longitudes, latitudes, properties ),
+                       std::runtime_error );
+}
+
+#if COMPILE_UNIT_TEST_BENCHMARKS
+//! Compare computation times of properties at multiple points with single-point computations, without and with cache.
+BOOST_AUTO_TEST_CASE( benchmark_nrlmise_MultiplePointsAndCache )
+{
+    double julianDate = tudat::basic_astrodynamics::convertCalendarDateToJulianDay< double >( 2030, 6, 21, 8, 3, 20.0 );
+    double time = tudat::basic_astrodynamics::convertJulianDayToSecondsSinceEpoch(
+                    julianDate , tudat::basic_astrodynamics::JULIAN_DAY_ON_J2000) ;
+
+    std::string cppPath( __FILE__ );
+    std::string folder = cppPath.substr( 0, cppPath.find_last_of("/\\")+1);
+    tudat::input_output::solar_activity::SolarActivityDataMap solarActivityData =
+            tudat::input_output::solar_activity::readSolarActivityData( folder + "swAtmosTestNoAdjust.txt" ) ;
+
+    boost::function< tudat::aerodynamics::NRLMSISE00Input (double,double,double,double) > inputFunction =
+            boost::bind(&tudat::aerodynamics::nrlmsiseInputFunction,_1,_2,_3,_4, solarActivityData , false , 0.0 );
+    NRLMSISE00Atmosphere singlePointModel( inputFunction );
+    NRLMSISE00Atmosphere multiplePointModel( inputFunction );
+    NRLMSISE00Atmosphere cachedModel( inputFunction );
+
+    const unsigned int numberOfPoints = 1000;
+    std::vector< double > altitudes, longitudes, latitudes;
+    getNrlmsise00TestPoints( numberOfPoints, altitudes, longitudes, latitudes );
+
+    std::chrono::steady_clock::time_point startTime = std::chrono::steady_clock::now( );
+    for( unsigned int i = 0; i < numberOfPoints; i++ )
+    {
+        singlePointModel.getDensity( altitudes.at( i ), longitudes.at( i ), latitudes.at( i ), time );
+    }
+    double singlePointComputationTime = std::chrono::duration< double >(
+                std::chrono::steady_clock::now( ) - startTime ).count( );
+
+    startTime = std::chrono::steady_clock::now( );
+    std::vector< tudat::aerodynamics::NRLMSISE00Properties > properties;
+    multiplePointModel.computePropertiesAtPoints( time, altitudes, longitudes, latitudes, properties );
+    double multiplePointComputationTime = std::chrono::duration< double >(
+                std::chrono::steady_clock::now( ) - startTime ).count( );
+
+    // Evaluate with cache that is too small to contain all points (cache misses only)
+    cachedModel.setCacheSettings( 100 );
+    startTime = std::chrono::steady_clock::now( );
+    for( unsigned int j = 0; j < 3; j++ )
+    {
+        for( unsigned int i = 0; i < numberOfPoints; i++ )
+        {
+            cachedModel.getDensity( altitudes.at( i ), longitudes.at( i ), latitudes.at( i ), time );
+        }
+    }
+    double cacheMissComputationTime = std::chrono::duration< double >(
+                std::chrono::steady_clock::now( ) - startTime ).count( ) / 3.0;
+
+    // Evaluate with cache containing all points (cache hits only)
+    cachedModel.setCacheSettings( numberOfPoints );
+    for( unsigned int i = 0; i < numberOfPoints; i++ )
+    {
+        cachedModel.getDensity( altitudes.at( i ), longitudes.at( i ), latitudes.at( i ), time );
+    }
+    startTime = std::chrono::steady_clock::now( );
+    for( unsigned int i = 0; i < numberOfPoints; i++ )
+    {
+        cachedModel.getDensity( altitudes.at( i ), longitudes.at( i ), latitudes.at( i ), time );
+    }
+    double cacheHitComputationTime = std::chrono::duration< double >(
+                std::chrono::steady_clock::now( ) - startTime ).count( );
+
+    std::cout << "NRLMSISE00 evaluation of " << numberOfPoints << " points: single points "
+              << 1.0E3 * singlePointComputationTime << " ms, multiple points " << 1.0E3 * multiplePointComputationTime
+              << " ms, single points with cache (misses) " << 1.0E3 * cacheMissComputationTime
+              << " ms, single points with cache (hits) " << 1.0E3 * cacheHitComputationTime << " ms" << std::endl;
+}
+#endif
+
+//! Function to create an NRLMSISE00 atmosphere model, using solar activity data (for each thread generating a grid).
+boost::shared_ptr< tudat::aerodynamics::AtmosphereModel > createNrlmsise00TestAtmosphere(
+        const tudat::input_output::solar_activity::SolarActivityDataMap& solarActivityData )
+{
+    return boost::make_shared< NRLMSISE00Atmosphere >(
+                boost::bind( &tudat::aerodynamics::nrlmsiseInputFunction, _1, _2, _3, _4, solarActivityData,
+                             false, TUDAT_NAN ) );
+}
+
+//! Test whether grid of NRLMSISE00 atmosphere generated in parallel is identical to grid generated serially
+//  The NRLMSISE00 implementation uses static variables, so that concurrent evaluations by different model objects (as
+//  done when generating the grid in parallel) may not interfere.
+BOOST_AUTO_TEST_CASE( testNRLMSISE00AtmosphereParallelGridGeneration )
+{
+    // Retrieve solar activity data for 21-06-2030 and 22-06-2030.
+    std::string cppPath( __FILE__ );
+    std::string folder = cppPath.substr( 0, cppPath.find_last_of("/\\")+1);
+    tudat::input_output::solar_activity::SolarActivityDataMap solarActivityData =
+            tudat::input_output::solar_activity::readSolarActivityData( folder + "swAtmosTestNoAdjust.txt" );
+
+    double startEpoch = tudat::basic_astrodynamics::convertJulianDayToSecondsSinceEpoch(
+                tudat::basic_astrodynamics::convertCalendarDateToJulianDay< double >( 2030, 6, 21, 0, 0, 0.0 ),
+                tudat::basic_astrodynamics::JULIAN_DAY_ON_J2000 );
+    double endEpoch = startEpoch + 1.5 * tudat::physical_constants::JULIAN_DAY;
+
+    // Generate grid with a single thread, and with multiple threads.
+    tudat::aerodynamics::GriddedAtmosphere serialGriddedAtmosphere(
+                boost::bind( &createNrlmsise00TestAtmosphere, boost::cref( solarActivityData ) ),
+                100.0E3, 1000.0E3, 46, 19, 8, startEpoch, endEpoch, 4, true, 1 );
+    tudat::aerodynamics::GriddedAtmosphere parallelGriddedAtmosphere(
+                boost::bind( &createNrlmsise00TestAtmosphere, boost::cref( solarActivityData ) ),
+                100.0E3, 1000.0E3, 46, 19, 8, startEpoch, endEpoch, 4, true, 8 );
+
+    BOOST_CHECK_EQUAL( serialGriddedAtmosphere.getGridValues( ).size( ),
+                       parallelGriddedAtmosphere.getGridValues( ).size( ) );
+    BOOST_CHECK( serialGriddedAtmosphere.getGridValues( ) == parallelGriddedAtmosphere.getGridValues( ) );
+
+    // Check grid against model that is sampled.
+    boost::shared_ptr< tudat::aerodynamics::AtmosphereModel > atmosphereModel =
+            createNrlmsise00TestAtmosphere( solarActivityData );
+    double longitude = -tudat::aerodynamics::computeMeanLocalSolarTime( 0.0, startEpoch ) * PI / 12.0;
+    BOOST_CHECK_CLOSE_FRACTION( parallelGriddedAtmosphere.getDensity( 400.0E3, longitude, 0.0, startEpoch ),
+                                atmosphereModel->getDensity( 400.0E3, longitude, 0.0, startEpoch ), 1.0E-12 );
+}
+
 BOOST_AUTO_TEST_SUITE_END( )
 
 } // namespace unit_tests
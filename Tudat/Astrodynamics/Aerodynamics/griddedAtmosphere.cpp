@@ -0,0 +1,283 @@
+/*    Copyright (c) 2010-2017, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ */
+
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+#include <string>
+
+#include <boost/bind.hpp>
+
+#include "Tudat/Basics/parallelComputation.h"
+#include "Tudat/Astrodynamics/BasicAstrodynamics/physicalConstants.h"
+#include "Tudat/Mathematics/BasicMathematics/mathematicalConstants.h"
+#include "Tudat/Astrodynamics/Aerodynamics/griddedAtmosphere.h"
+
+namespace tudat
+{
+namespace aerodynamics
+{
+
+//! Number of atmospheric properties stored in the grid.
+static const unsigned int numberOfGriddedAtmosphericProperties = 4;
+
+//! Function to interpolate linearly between two values.
+inline double interpolateLinearlyInGrid( const double lowerValue, const double upperValue, const double fraction )
+{
+    return lowerValue + fraction * ( upperValue - lowerValue );
+}
+
+//! Function to interpolate trilinearly (in altitude, latitude and local solar time) in a single cell of the grid.
+/*!
+ *  Function to interpolate trilinearly (in altitude, latitude and local solar time) in a single cell of the grid.
+ *  \param cellValues Pointer to the grid value at the lower altitude, latitude and local solar time of the cell.
+ *  \param latitudeStride Distance in memory between grid values at subsequent latitude nodes.
+ *  \param localSolarTimeStride Distance in memory between grid values at subsequent local solar time nodes.
+ *  \param altitudeFraction Scaled distance of evaluation point from lower altitude of cell (between 0 and 1).
+ *  \param latitudeFraction Scaled distance of evaluation point from lower latitude of cell (between 0 and 1).
+ *  \param localSolarTimeFraction Scaled distance of evaluation point from lower local solar time of cell (between 0
+ *  and 1).
+ *  \return Interpolated value.
+ */
+inline double interpolateInGridCell( const double* cellValues,
+                                     const unsigned int latitudeStride,
+                                     const unsigned int localSolarTimeStride,
+                                     const double altitudeFraction,
+                                     const double latitudeFraction,
+                                     const double localSolarTimeFraction )
+{
+    const double* upperCellValues = cellValues + localSolarTimeStride;
+    return interpolateLinearlyInGrid(
+                interpolateLinearlyInGrid(
+                    interpolateLinearlyInGrid( cellValues[ 0 ], cellValues[ 1 ], altitudeFraction ),
+                    interpolateLinearlyInGrid( cellValues[ latitudeStride ], cellValues[ latitudeStride + 1 ],
+                                               altitudeFraction ), latitudeFraction ),
+                interpolateLinearlyInGrid(
+                    interpolateLinearlyInGrid( upperCellValues[ 0 ], upperCellValues[ 1 ], altitudeFraction ),
+                    interpolateLinearlyInGrid( upperCellValues[ latitudeStride ],
+                                               upperCellValues[ latitudeStride + 1 ], altitudeFraction ),
+                    latitudeFraction ),
+                localSolarTimeFraction );
+}
+
+//! Function to compute the scaled coordinate of a value in an equidistant grid.
+/*!
+ *  Function to compute the scaled coordinate of a value in an equidistant grid (i.e. the distance from the first node
+ *  in units of the grid step), limited to the range of the grid.
+ *  \param value Value for which the scaled coordinate is to be computed.
+ *  \param firstNodeValue Value at first node of grid.
+ *  \param inverseGridStep Inverse of step between subsequent grid nodes.
+ *  \param numberOfIntervals Number of intervals in grid.
+ *  \param index Index of the lower node of the grid interval in which the value is located (returned by reference).
+ *  \param fraction Scaled distance of the value from the lower node of the interval, between 0 and 1 (returned by
+ *  reference).
+ */
+inline void computeGridIntervalAndFraction( const double value,
+                                            const double firstNodeValue,
+                                            const double inverseGridStep,
+                                            const unsigned int numberOfIntervals,
+                                            unsigned int& index,
+                                            double& fraction )
+{
+    const double scaledValue = std::min( static_cast< double >( numberOfIntervals ),
+                                         std::max( 0.0, ( value - firstNodeValue ) * inverseGridStep ) );
+    index = std::min( static_cast< unsigned int >( scaledValue ), numberOfIntervals - 1 );
+    fraction = scaledValue - static_cast< double >( index );
+}
+
+//! Function to compute the mean local solar time.
+double computeMeanLocalSolarTime( const double longitude, const double time )
+{
+    // Add universal time of day (J2000 is at noon) and longitude (15 degrees per hour).
+    const double localSolarTime = ( time + 0.5 * physical_constants::JULIAN_DAY ) / 3600.0 +
+            longitude * 12.0 / mathematical_constants::PI;
+    return localSolarTime - 24.0 * std::floor( localSolarTime / 24.0 );
+}
+
+//! Constructor, generates the grid of atmospheric properties.
+GriddedAtmosphere::GriddedAtmosphere(
+        const boost::function< boost::shared_ptr< AtmosphereModel >( ) > atmosphereModelCreationFunction,
+        const double minimumAltitude,
+        const double maximumAltitude,
+        const unsigned int numberOfAltitudes,
+        const unsigned int numberOfLatitudes,
+        const unsigned int numberOfLocalSolarTimes,
+        const double startEpoch,
+        const double endEpoch,
+        const unsigned int numberOfEpochs,
+        const bool interpolateLogarithms,
+        const unsigned int numberOfThreads ):
+    minimumAltitude_( minimumAltitude ), startEpoch_( startEpoch ), numberOfAltitudes_( numberOfAltitudes ),
+    numberOfLatitudes_( numberOfLatitudes ), numberOfLocalSolarTimes_( numberOfLocalSolarTimes ),
+    numberOfEpochs_( numberOfEpochs ), interpolateLogarithms_( interpolateLogarithms )
+{
+    // Check input consistency.
+    if( numberOfAltitudes < 2 || !( maximumAltitude > minimumAltitude ) )
+    {
+        throw std::runtime_error( "Error when creating gridded atmosphere, at least 2 altitudes, with increasing "
+                                  "value, are required." );
+    }
+
+    if( numberOfLatitudes < 2 || numberOfLocalSolarTimes < 1 || numberOfEpochs < 1 )
+    {
+        throw std::runtime_error( "Error when creating gridded atmosphere, at least 2 latitudes, 1 local solar time "
+                                  "and 1 epoch are required." );
+    }
+
+    if( numberOfEpochs > 1 && !( endEpoch > startEpoch ) )
+    {
+        throw std::runtime_error( "Error when creating gridded atmosphere, end epoch must be after start epoch." );
+    }
+
+    // Set grid steps.
+    altitudeStep_ = ( maximumAltitude - minimumAltitude ) / static_cast< double >( numberOfAltitudes_ - 1 );
+    latitudeStep_ = mathematical_constants::PI / static_cast< double >( numberOfLatitudes_ - 1 );
+    localSolarTimeStep_ = 24.0 / static_cast< double >( numberOfLocalSolarTimes_ );
+    epochStep_ = ( numberOfEpochs_ > 1 ) ?
+                ( endEpoch - startEpoch ) / static_cast< double >( numberOfEpochs_ - 1 ) : 0.0;
+    inverseAltitudeStep_ = 1.0 / altitudeStep_;
+    inverseLatitudeStep_ = 1.0 / latitudeStep_;
+    inverseLocalSolarTimeStep_ = 1.0 / localSolarTimeStep_;
+    inverseEpochStep_ = ( numberOfEpochs_ > 1 ) ? 1.0 / epochStep_ : 0.0;
+
+    numberOfGridPoints_ = numberOfEpochs_ * numberOfLocalSolarTimes_ * numberOfLatitudes_ * numberOfAltitudes_;
+    propertyStride_ = numberOfEpochs_ * ( numberOfLocalSolarTimes_ + 1 ) * numberOfLatitudes_ * numberOfAltitudes_;
+    gridValues_.resize( numberOfGriddedAtmosphericProperties * propertyStride_ );
+
+    // Create atmosphere model for each thread.
+    const unsigned int numberOfAltitudeProfiles = numberOfEpochs_ * numberOfLocalSolarTimes_ * numberOfLatitudes_;
+    std::vector< boost::shared_ptr< AtmosphereModel > > atmosphereModels;
+    for( unsigned int i = 0; i < utilities::getNumberOfThreadsForParallelLoop(
+             numberOfAltitudeProfiles, numberOfThreads ); i++ )
+    {
+        atmosphereModels.push_back( atmosphereModelCreationFunction( ) );
+    }
+
+    // Sample atmosphere model, computing one altitude profile per task.
+    utilities::executeParallelLoopWithThreadIndex(
+                numberOfAltitudeProfiles, atmosphereModels.size( ),
+                boost::bind( &GriddedAtmosphere::sampleAltitudeProfile, this, _1, _2,
+                             boost::cref( atmosphereModels ) ) );
+
+    // Copy values at first local solar time node to additional node at 24 hours.
+    const unsigned int localSolarTimeStride = numberOfLatitudes_ * numberOfAltitudes_;
+    for( unsigned int i = 0; i < numberOfGriddedAtmosphericProperties * numberOfEpochs_; i++ )
+    {
+        std::vector< double >::iterator firstNodeIterator =
+                gridValues_.begin( ) + i * ( numberOfLocalSolarTimes_ + 1 ) * localSolarTimeStride;
+        std::copy( firstNodeIterator, firstNodeIterator + localSolarTimeStride,
+                   firstNodeIterator + numberOfLocalSolarTimes_ * localSolarTimeStride );
+    }
+}
+
+//! Function to sample the atmosphere model that is gridded along a single altitude profile of the grid.
+void GriddedAtmosphere::sampleAltitudeProfile(
+        const unsigned int profileIndex,
+        const unsigned int threadIndex,
+        const std::vector< boost::shared_ptr< AtmosphereModel > >& atmosphereModels )
+{
+    const unsigned int latitudeIndex = profileIndex % numberOfLatitudes_;
+    const unsigned int localSolarTimeIndex = ( profileIndex / numberOfLatitudes_ ) % numberOfLocalSolarTimes_;
+    const unsigned int epochIndex = profileIndex / ( numberOfLatitudes_ * numberOfLocalSolarTimes_ );
+
+    // Compute longitude at which the local solar time of the current node is reached, in range [-pi, pi).
+    const double epoch = startEpoch_ + static_cast< double >( epochIndex ) * epochStep_;
+    const double latitude =
+            -0.5 * mathematical_constants::PI + static_cast< double >( latitudeIndex ) * latitudeStep_;
+    double longitude = ( static_cast< double >( localSolarTimeIndex ) * localSolarTimeStep_ -
+                         computeMeanLocalSolarTime( 0.0, epoch ) ) * mathematical_constants::PI / 12.0;
+    longitude -= 2.0 * mathematical_constants::PI *
+            std::floor( ( longitude + mathematical_constants::PI ) / ( 2.0 * mathematical_constants::PI ) );
+
+    const boost::shared_ptr< AtmosphereModel > atmosphereModel = atmosphereModels.at( threadIndex );
+    const unsigned int firstGridIndex =
+            ( ( epochIndex * ( numberOfLocalSolarTimes_ + 1 ) + localSolarTimeIndex ) * numberOfLatitudes_ +
+              latitudeIndex ) * numberOfAltitudes_;
+    for( unsigned int i = 0; i < numberOfAltitudes_; i++ )
+    {
+        const double altitude = minimumAltitude_ + static_cast< double >( i ) * altitudeStep_;
+        double density = atmosphereModel->getDensity( altitude, longitude, latitude, epoch );
+        double pressure = atmosphereModel->getPressure( altitude, longitude, latitude, epoch );
+        if( interpolateLogarithms_ )
+        {
+            if( !( density > 0.0 ) || !( pressure > 0.0 ) )
+            {
+                throw std::runtime_error( "Error when creating gridded atmosphere, density and pressure must be "
+                                          "positive to interpolate their logarithms; found density " +
+                                          std::to_string( density ) + " and pressure " +
+                                          std::to_string( pressure ) + " at altitude " +
+                                          std::to_string( altitude ) + "." );
+            }
+            density = std::log( density );
+            pressure = std::log( pressure );
+        }
+
+        gridValues_[ density_index * propertyStride_ + firstGridIndex + i ] = density;
+        gridValues_[ pressure_index * propertyStride_ + firstGridIndex + i ] = pressure;
+        gridValues_[ temperature_index * propertyStride_ + firstGridIndex + i ] =
+                atmosphereModel->getTemperature( altitude, longitude, latitude, epoch );
+        gridValues_[ speed_of_sound_index * propertyStride_ + firstGridIndex + i ] =
+                atmosphereModel->getSpeedOfSound( altitude, longitude, latitude, epoch );
+    }
+}
+
+//! Function to interpolate an atmospheric property from the grid.
+double GriddedAtmosphere::interpolateProperty( const GriddedAtmosphericProperties propertyIndex,
+                                               const double altitude, const double longitude,
+                                               const double latitude, const double time ) const
+{
+    // Find grid cell in which atmospheric property is to be interpolated.
+    unsigned int altitudeIndex, latitudeIndex, localSolarTimeIndex;
+    double altitudeFraction, latitudeFraction, localSolarTimeFraction;
+    computeGridIntervalAndFraction( altitude, minimumAltitude_, inverseAltitudeStep_, numberOfAltitudes_ - 1,
+                                    altitudeIndex, altitudeFraction );
+    computeGridIntervalAndFraction( latitude, -0.5 * mathematical_constants::PI, inverseLatitudeStep_,
+                                    numberOfLatitudes_ - 1, latitudeIndex, latitudeFraction );
+    computeGridIntervalAndFraction( computeMeanLocalSolarTime( longitude, time ), 0.0, inverseLocalSolarTimeStep_,
+                                    numberOfLocalSolarTimes_, localSolarTimeIndex, localSolarTimeFraction );
+
+    const unsigned int latitudeStride = numberOfAltitudes_;
+    const unsigned int localSolarTimeStride = numberOfLatitudes_ * numberOfAltitudes_;
+    const double* cellValues = gridValues_.data( ) + propertyIndex * propertyStride_ +
+            localSolarTimeIndex * localSolarTimeStride + latitudeIndex * latitudeStride + altitudeIndex;
+
+    // Interpolate in space and, if required, in time.
+    double interpolatedValue;
+    if( numberOfEpochs_ > 1 )
+    {
+        unsigned int epochIndex;
+        double epochFraction;
+        computeGridIntervalAndFraction( time, startEpoch_, inverseEpochStep_, numberOfEpochs_ - 1,
+                                        epochIndex, epochFraction );
+
+        const unsigned int epochStride = ( numberOfLocalSolarTimes_ + 1 ) * localSolarTimeStride;
+        cellValues += epochIndex * epochStride;
+        interpolatedValue = interpolateLinearlyInGrid(
+                    interpolateInGridCell( cellValues, latitudeStride, localSolarTimeStride,
+                                           altitudeFraction, latitudeFraction, localSolarTimeFraction ),
+                    interpolateInGridCell( cellValues + epochStride, latitudeStride, localSolarTimeStride,
+                                           altitudeFraction, latitudeFraction, localSolarTimeFraction ),
+                    epochFraction );
+    }
+    else
+    {
+        interpolatedValue = interpolateInGridCell( cellValues, latitudeStride, localSolarTimeStride,
+                                                   altitudeFraction, latitudeFraction, localSolarTimeFraction );
+    }
+
+    if( interpolateLogarithms_ && ( propertyIndex == density_index || propertyIndex == pressure_index ) )
+    {
+        interpolatedValue = std::exp( interpolatedValue );
+    }
+    return interpolatedValue;
+}
+
+} // namespace aerodynamics
+} // namespace tudat
@@ -0,0 +1,342 @@
+/*    Copyright (c) 2010-2017, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ */
+
+#ifndef TUDAT_GRIDDED_ATMOSPHERE_H
+#define TUDAT_GRIDDED_ATMOSPHERE_H
+
+#include <vector>
+
+#include <boost/function.hpp>
+#include <boost/shared_ptr.hpp>
+
+#include "Tudat/Basics/utilityMacros.h"
+
+#include "Tudat/Astrodynamics/Aerodynamics/atmosphereModel.h"
+
+namespace tudat
+{
+namespace aerodynamics
+{
+
+//! Function to compute the mean local solar time.
+/*!
+ *  Function to compute the mean local solar time, from the universal time of day and the longitude, as is done for the
+ *  input of the NRLMSISE-00 model (see nrlmsiseInputFunction).
+ *  \param longitude Longitude [rad].
+ *  \param time Time [s since J2000].
+ *  \return Mean local solar time, in the range [0, 24) [hours].
+ */
+double computeMeanLocalSolarTime( const double longitude, const double time );
+
+//! Gridded atmosphere class.
+/*!
+ *  Atmosphere model in which the density, pressure, temperature and speed of sound are interpolated (multi-linearly)
+ *  from a grid of precomputed values. The grid is generated (in parallel) by sampling another atmosphere model (e.g.
+ *  NRLMSISE-00) on an equidistant grid in altitude, latitude, mean local solar time and, optionally, epoch. Since the
+ *  grid nodes are equidistant, the grid cell in which the atmospheric properties are to be evaluated is found without
+ *  a search, and the interpolation itself contains no (data-dependent) branches. Values of the independent variables
+ *  outside of the grid are moved to the nearest boundary of the grid. The grid is stored contiguously, with the
+ *  altitude as the most rapidly varying index. The density and pressure are (by default) interpolated logarithmically,
+ *  which considerably reduces the interpolation error for a given altitude spacing, at the expense of an exponential
+ *  function evaluation.
+ *  NOTE: the dependency of the original model on longitude, at constant local solar time, is not represented by the
+ *  grid. If no epoch grid is used, the original model is sampled at a single epoch, so that only its diurnal variation
+ *  (through the local solar time) is retained. Contrary to the model that is sampled, evaluating the gridded model does
+ *  not modify its state, so that it may be used by multiple threads concurrently (once it has been created).
+ */
+class GriddedAtmosphere : public AtmosphereModel
+{
+public:
+
+    //! Constructor, generates the grid of atmospheric properties.
+    /*!
+     *  Constructor, generates the grid of atmospheric properties by sampling another atmosphere model. Since atmosphere
+     *  models are in general not thread-safe, a function creating the atmosphere model is provided, which is called
+     *  once for each thread that is used. The model instances created by this function must not share any state that
+     *  is modified during their evaluation. The NRLMSISE00Atmosphere model satisfies this requirement only by
+     *  serializing the evaluation of the (static variables of the) underlying NRLMSISE-00 implementation, so that the
+     *  generation of a grid of this model is correct for any number of threads, but is only partially parallelized.
+     *  \param atmosphereModelCreationFunction Function creating the atmosphere model that is to be sampled.
+     *  \param minimumAltitude Lowest altitude of the grid [m].
+     *  \param maximumAltitude Highest altitude of the grid [m].
+     *  \param numberOfAltitudes Number of altitude nodes of the grid (at least 2).
+     *  \param numberOfLatitudes Number of latitude nodes of the grid, equidistant from -90 to 90 degrees (at least 2).
+     *  \param numberOfLocalSolarTimes Number of local solar time nodes of the grid, equidistant over 24 hours, starting
+     *  at 0 hours (at least 1).
+     *  \param startEpoch First epoch at which the model is sampled (only epoch if numberOfEpochs is 1) [s since J2000].
+     *  \param endEpoch Last epoch at which the model is sampled (unused if numberOfEpochs is 1) [s since J2000].
+     *  \param numberOfEpochs Number of epoch nodes of the grid.
+     *  \param interpolateLogarithms Boolean denoting whether the logarithm of density and pressure is interpolated
+     *  (instead of the density and pressure themselves).
+     *  \param numberOfThreads Number of threads used to generate the grid (if 0, the number of concurrent threads
+     *  supported by the hardware is used).
+     */
+    GriddedAtmosphere(
+            const boost::function< boost::shared_ptr< AtmosphereModel >( ) > atmosphereModelCreationFunction,
+            const double minimumAltitude,
+            const double maximumAltitude,
+            const unsigned int numberOfAltitudes,
+            const unsigned int numberOfLatitudes,
+            const unsigned int numberOfLocalSolarTimes,
+            const double startEpoch,
+            const double endEpoch = TUDAT_NAN,
+            const unsigned int numberOfEpochs = 1,
+            const bool interpolateLogarithms = true,
+            const unsigned int numberOfThreads = 0 );
+
+    //! Get local density.
+    /*!
+     *  Returns the local density of the atmosphere in kg per meter^3, interpolated from the grid.
+     *  \param altitude Altitude at which density is to be computed.
+     *  \param longitude Longitude at which density is to be computed.
+     *  \param latitude Latitude at which density is to be computed.
+     *  \param time Time at which density is to be computed.
+     *  \return Atmospheric density at specified conditions.
+     */
+    double getDensity( const double altitude, const double longitude,
+                       const double latitude, const double time )
+    {
+        return interpolateProperty( density_index, altitude, longitude, latitude, time );
+    }
+
+    //! Get local pressure.
+    /*!
+     *  Returns the local pressure of the atmosphere in Newton per meter^2, interpolated from the grid.
+     *  \param altitude Altitude at which pressure is to be computed.
+     *  \param longitude Longitude at which pressure is to be computed.
+     *  \param latitude Latitude at which pressure is to be computed.
+     *  \param time Time at which pressure is to be computed.
+     *  \return Atmospheric pressure at specified conditions.
+     */
+    double getPressure( const double altitude, const double longitude,
+                        const double latitude, const double time )
+    {
+        return interpolateProperty( pressure_index, altitude, longitude, latitude, time );
+    }
+
+    //! Get local temperature.
+    /*!
+     *  Returns the local temperature of the atmosphere in Kelvin, interpolated from the grid.
+     *  \param altitude Altitude at which temperature is to be computed.
+     *  \param longitude Longitude at which temperature is to be computed.
+     *  \param latitude Latitude at which temperature is to be computed.
+     *  \param time Time at which temperature is to be computed.
+     *  \return Atmospheric temperature at specified conditions.
+     */
+    double getTemperature( const double altitude, const double longitude,
+                           const double latitude, const double time )
+    {
+        return interpolateProperty( temperature_index, altitude, longitude, latitude, time );
+    }
+
+    //! Get local speed of sound in the atmosphere.
+    /*!
+     *  Returns the speed of sound in the atmosphere in m/s, interpolated from the grid.
+     *  \param altitude Altitude at which speed of sound is to be computed.
+     *  \param longitude Longitude at which speed of sound is to be computed.
+     *  \param latitude Latitude at which speed of sound is to be computed.
+     *  \param time Time at which speed of sound is to be computed.
+     *  \return Atmospheric speed of sound at specified conditions.
+     */
+    double getSpeedOfSound( const double altitude, const double longitude,
+                            const double latitude, const double time )
+    {
+        return interpolateProperty( speed_of_sound_index, altitude, longitude, latitude, time );
+    }
+
+    //! Function to retrieve the lowest altitude of the grid.
+    /*!
+     *  Function to retrieve the lowest altitude of the grid.
+     *  \return Lowest altitude of the grid [m].
+     */
+    double getMinimumAltitude( ) const
+    {
+        return minimumAltitude_;
+    }
+
+    //! Function to retrieve the highest altitude of the grid.
+    /*!
+     *  Function to retrieve the highest altitude of the grid.
+     *  \return Highest altitude of the grid [m].
+     */
+    double getMaximumAltitude( ) const
+    {
+        return minimumAltitude_ + altitudeStep_ * static_cast< double >( numberOfAltitudes_ - 1 );
+    }
+
+    //! Function to retrieve the number of altitude nodes of the grid.
+    /*!
+     *  Function to retrieve the number of altitude nodes of the grid.
+     *  \return Number of altitude nodes of the grid.
+     */
+    unsigned int getNumberOfAltitudes( ) const
+    {
+        return numberOfAltitudes_;
+    }
+
+    //! Function to retrieve the number of latitude nodes of the grid.
+    /*!
+     *  Function to retrieve the number of latitude nodes of the grid.
+     *  \return Number of latitude nodes of the grid.
+     */
+    unsigned int getNumberOfLatitudes( ) const
+    {
+        return numberOfLatitudes_;
+    }
+
+    //! Function to retrieve the number of (distinct) local solar time nodes of the grid.
+    /*!
+     *  Function to retrieve the number of (distinct) local solar time nodes of the grid.
+     *  \return Number of local solar time nodes of the grid.
+     */
+    unsigned int getNumberOfLocalSolarTimes( ) const
+    {
+        return numberOfLocalSolarTimes_;
+    }
+
+    //! Function to retrieve the number of epoch nodes of the grid.
+    /*!
+     *  Function to retrieve the number of epoch nodes of the grid.
+     *  \return Number of epoch nodes of the grid.
+     */
+    unsigned int getNumberOfEpochs( ) const
+    {
+        return numberOfEpochs_;
+    }
+
+    //! Function to retrieve the total number of grid points.
+    /*!
+     *  Function to retrieve the total number of grid points (at which the original model has been evaluated).
+     *  \return Total number of grid points.
+     */
+    unsigned int getNumberOfGridPoints( ) const
+    {
+        return numberOfGridPoints_;
+    }
+
+    //! Function to retrieve the grid of atmospheric properties.
+    /*!
+     *  Function to retrieve the grid of atmospheric properties (see gridValues_ for its layout).
+     *  \return Grid of atmospheric properties.
+     */
+    const std::vector< double >& getGridValues( ) const
+    {
+        return gridValues_;
+    }
+
+private:
+
+    //! Indices of atmospheric properties in grid.
+    enum GriddedAtmosphericProperties
+    {
+        density_index = 0,
+        pressure_index = 1,
+        temperature_index = 2,
+        speed_of_sound_index = 3
+    };
+
+    //! Function to interpolate an atmospheric property from the grid.
+    /*!
+     *  Function to interpolate an atmospheric property from the grid.
+     *  \param propertyIndex Index of atmospheric property that is to be interpolated.
+     *  \param altitude Altitude at which property is to be computed.
+     *  \param longitude Longitude at which property is to be computed.
+     *  \param latitude Latitude at which property is to be computed.
+     *  \param time Time at which property is to be computed.
+     *  \return Interpolated atmospheric property.
+     */
+    double interpolateProperty( const GriddedAtmosphericProperties propertyIndex,
+                                const double altitude, const double longitude,
+                                const double latitude, const double time ) const;
+
+    //! Function to sample the atmosphere model that is gridded along a single altitude profile of the grid.
+    /*!
+     *  Function to sample the atmosphere model that is gridded along a single altitude profile (i.e. at all altitude
+     *  nodes at a single latitude, local solar time and epoch node) of the grid, and store the result in the grid.
+     *  \param profileIndex Index of altitude profile, given by ( epoch * L + localSolarTime ) * N + latitude, with L
+     *  and N the numbers of (distinct) local solar time and latitude nodes.
+     *  \param threadIndex Index of thread on which the profile is sampled.
+     *  \param atmosphereModels Atmosphere models that are sampled, one for each thread.
+     */
+    void sampleAltitudeProfile( const unsigned int profileIndex,
+                                const unsigned int threadIndex,
+                                const std::vector< boost::shared_ptr< AtmosphereModel > >& atmosphereModels );
+
+    //! Lowest altitude of the grid.
+    double minimumAltitude_;
+
+    //! Altitude step of the grid.
+    double altitudeStep_;
+
+    //! Latitude step of the grid.
+    double latitudeStep_;
+
+    //! Local solar time step of the grid [hours].
+    double localSolarTimeStep_;
+
+    //! First epoch of the grid.
+    double startEpoch_;
+
+    //! Epoch step of the grid (0 if only a single epoch is used).
+    double epochStep_;
+
+    //! Inverse of altitude step of the grid.
+    double inverseAltitudeStep_;
+
+    //! Inverse of latitude step of the grid.
+    double inverseLatitudeStep_;
+
+    //! Inverse of local solar time step of the grid.
+    double inverseLocalSolarTimeStep_;
+
+    //! Inverse of epoch step of the grid (0 if only a single epoch is used).
+    double inverseEpochStep_;
+
+    //! Number of altitude nodes of the grid.
+    unsigned int numberOfAltitudes_;
+
+    //! Number of latitude nodes of the grid.
+    unsigned int numberOfLatitudes_;
+
+    //! Number of distinct local solar time nodes of the grid.
+    /*!
+     *  Number of distinct local solar time nodes of the grid. The grid stores one additional local solar time node (at
+     *  24 hours), identical to the first one, so that no wrapping of indices is needed during interpolation.
+     */
+    unsigned int numberOfLocalSolarTimes_;
+
+    //! Number of epoch nodes of the grid.
+    unsigned int numberOfEpochs_;
+
+    //! Total number of grid points at which the original model has been evaluated.
+    unsigned int numberOfGridPoints_;
+
+    //! Number of values stored in the grid per atmospheric property.
+    unsigned int propertyStride_;
+
+    //! Boolean denoting whether the logarithm of density and pressure is stored in (and interpolated from) the grid.
+    bool interpolateLogarithms_;
+
+    //! Grid of atmospheric properties.
+    /*!
+     *  Grid of atmospheric properties, with the index of a grid point given by:
+     *  ( ( ( property * E + epoch ) * ( L + 1 ) + localSolarTime ) * N + latitude ) * A + altitude,
+     *  with E, L, N and A the numbers of epoch, (distinct) local solar time, latitude and altitude nodes.
+     */
+    std::vector< double > gridValues_;
+};
+
+//! Typedef for shared-pointer to GriddedAtmosphere object.
+typedef boost::shared_ptr< GriddedAtmosphere > GriddedAtmospherePointer;
+
+} // namespace aerodynamics
+} // namespace tudat
+
+#endif // TUDAT_GRIDDED_ATMOSPHERE_H
@@ -25,6 +25,7 @@
 
 #include <Eigen/Geometry>
 
+#include "Tudat/Basics/parallelComputation.h"
 #include "Tudat/Mathematics/BasicMathematics/mathematicalConstants.h"
 
 #include "Tudat/Astrodynamics/Aerodynamics/aerodynamics.h"
@@ -126,14 +127,15 @@ HypersonicLocalInclinationAnalysis::HypersonicLocalInclinationAnalysis(
         const std::vector< std::vector< int > >& selectedMethods,
         const double referenceArea,
         const double referenceLength,
-        const Eigen::Vector3d& momentReferencePoint )
+        const Eigen::Vector3d& momentReferencePoint,
+        const unsigned int numberOfThreads )
     : AerodynamicCoefficientGenerator< 3, 6 >(
           dataPointsOfIndependentVariables, referenceLength, referenceArea, referenceLength,
           momentReferencePoint,
           boost::assign::list_of( mach_number_dependent )( angle_of_attack_dependent )
           ( angle_of_sideslip_dependent ), 1, 0 ),
-      stagnationPressureCoefficient( 2.0 ),
       ratioOfSpecificHeats( 1.4 ),
+      numberOfThreads_( numberOfThreads ),
       selectedMethods_( selectedMethods )
 {
     // Set geometry if it is a single surface.
@@ -204,20 +206,46 @@ HypersonicLocalInclinationAnalysis::HypersonicLocalInclinationAnalysis(
         }
     }
 
-    // Allocate memory for panel inclinations and pressureCoefficient_.
-    inclination_.resize( vehicleParts_.size( ) );
-    pressureCoefficient_.resize( vehicleParts_.size( ) );
-    for ( unsigned int i = 0 ; i < vehicleParts_.size( ); i++ )
+    // Store panel properties of all parts contiguously, with panels ordered by line index first, and point index
+    // second.
+    panelAreas_.resize( vehicleParts_.size( ) );
+    panelSurfaceNormals_.resize( vehicleParts_.size( ) );
+    panelForceAndMomentDirections_.resize( vehicleParts_.size( ) );
+    for ( unsigned int k = 0 ; k < vehicleParts_.size( ); k++ )
     {
-        inclination_[ i ].resize( vehicleParts_[ i ]->getNumberOfLines( ) );
-        pressureCoefficient_[ i ].resize( vehicleParts_[ i ]->getNumberOfLines( ) );
-        for ( int j = 0 ; j < vehicleParts_[ i ]->getNumberOfLines( ) ; j++ )
+        int numberOfPanelLines = vehicleParts_[ k ]->getNumberOfLines( ) - 1;
+        int numberOfPanelPoints = vehicleParts_[ k ]->getNumberOfPoints( ) - 1;
+        int numberOfPanels = ( numberOfPanelLines > 0 && numberOfPanelPoints > 0 ) ?
+                    numberOfPanelLines * numberOfPanelPoints : 0;
+
+        panelAreas_[ k ].resize( numberOfPanels );
+        panelSurfaceNormals_[ k ].resize( 3, numberOfPanels );
+        panelForceAndMomentDirections_[ k ].resize( 6, numberOfPanels );
+        for ( int i = 0 ; i < numberOfPanelLines ; i++ )
         {
-            inclination_[ i ][ j ].resize( vehicleParts_[ i ]->getNumberOfPoints( ) );
-            pressureCoefficient_[ i ][ j ].resize( vehicleParts_[ i ]->getNumberOfPoints( ) );
+            for ( int j = 0 ; j < numberOfPanelPoints ; j++ )
+            {
+                int panelIndex = i * numberOfPanelPoints + j;
+                panelAreas_[ k ]( panelIndex ) = vehicleParts_[ k ]->getPanelArea( i, j );
+                panelSurfaceNormals_[ k ].col( panelIndex ) = vehicleParts_[ k ]->getPanelSurfaceNormal( i, j );
+
+                panelForceAndMomentDirections_[ k ].block( 0, panelIndex, 3, 1 ) =
+                        panelSurfaceNormals_[ k ].col( panelIndex );
+                panelForceAndMomentDirections_[ k ].block( 3, panelIndex, 3, 1 ) =
+                        ( vehicleParts_[ k ]->getPanelCentroid( i, j ) - momentReferencePoint_ ).cross(
+                            Eigen::Vector3d( panelSurfaceNormals_[ k ].col( panelIndex ) ) );
+            }
         }
     }
 
+    // Precompute panel inclinations at all combinations of angle of attack and sideslip.
+    const unsigned int numberOfAnglesOfAttack = dataPointsOfIndependentVariables_[ 1 ].size( );
+    const unsigned int numberOfAnglesOfSideslip = dataPointsOfIndependentVariables_[ 2 ].size( );
+    panelInclinations_.resize( numberOfAnglesOfAttack * numberOfAnglesOfSideslip );
+    utilities::executeParallelLoop(
+                panelInclinations_.size( ), numberOfThreads_,
+                boost::bind( &HypersonicLocalInclinationAnalysis::computePanelInclinationsForAttitude, this, _1 ) );
+
     boost::array< int, 3 > numberOfPointsPerIndependentVariables;
     for( int i = 0; i < 3; i++ )
     {
@@ -240,7 +268,8 @@ Vector6d HypersonicLocalInclinationAnalysis::getAerodynamicCoefficientsDataPoint
 {
     if( isCoefficientGenerated_( independentVariables ) == 0 )
     {
-        determineVehicleCoefficients( independentVariables );
+        std::vector< Eigen::VectorXd > pressureCoefficients;
+        determineVehicleCoefficients( independentVariables, pressureCoefficients );
     }
 
     // Return requested coefficients.
@@ -251,33 +280,53 @@ Vector6d HypersonicLocalInclinationAnalysis::getAerodynamicCoefficientsDataPoint
 //! Generate aerodynamic database.
 void HypersonicLocalInclinationAnalysis::generateCoefficients( )
 {
-    // Allocate variable to pass to coefficient determination for independent
-    // variable indices.
-    boost::array< int, 3 > independentVariableIndices;
+    const unsigned int numberOfDataPoints = dataPointsOfIndependentVariables_[ 0 ].size( ) *
+            dataPointsOfIndependentVariables_[ 1 ].size( ) * dataPointsOfIndependentVariables_[ 2 ].size( );
+
+    // Allocate pressure coefficient scratch space for each thread.
+    std::vector< std::vector< Eigen::VectorXd > > pressureCoefficientsPerThread(
+                utilities::getNumberOfThreadsForParallelLoop( numberOfDataPoints, numberOfThreads_ ) );
+
+    // Iterate over all combinations of independent variables. Each data point is written to a separate entry of
+    // aerodynamicCoefficients_, so that the result does not depend on the number of threads.
+    utilities::executeParallelLoopWithThreadIndex(
+                numberOfDataPoints, numberOfThreads_,
+                boost::bind( &HypersonicLocalInclinationAnalysis::computeCoefficientsAtDataPoint, this, _1, _2,
+                             boost::ref( pressureCoefficientsPerThread ) ) );
+}
 
-    // Iterate over all combinations of independent variables.
-    for ( unsigned int i = 0 ; i < dataPointsOfIndependentVariables_[ 0 ].size( ) ; i++ )
-    {
-        independentVariableIndices[ 0 ] = i;
-        for ( unsigned  int j = 0 ; j < dataPointsOfIndependentVariables_[
-              1 ].size( ) ; j++ )
-        {
-            independentVariableIndices[ 1 ] = j;
-            for ( unsigned  int k = 0 ; k < dataPointsOfIndependentVariables_[
-                  2 ].size( ) ; k++ )
-            {
-                independentVariableIndices[ 2 ] = k;
+//! Compute panel inclinations at a single combination of angle of attack and sideslip.
+void HypersonicLocalInclinationAnalysis::computePanelInclinationsForAttitude( const unsigned int attitudeIndex )
+{
+    const unsigned int numberOfAnglesOfSideslip = dataPointsOfIndependentVariables_[ 2 ].size( );
+    panelInclinations_[ attitudeIndex ] = determineInclinations(
+                dataPointsOfIndependentVariables_[ 1 ][ attitudeIndex / numberOfAnglesOfSideslip ],
+                dataPointsOfIndependentVariables_[ 2 ][ attitudeIndex % numberOfAnglesOfSideslip ] );
+}
 
-                determineVehicleCoefficients( independentVariableIndices );
-            }
-        }
-    }
+//! Compute aerodynamic coefficients at a single data point of the database.
+void HypersonicLocalInclinationAnalysis::computeCoefficientsAtDataPoint(
+        const unsigned int dataPointIndex, const unsigned int threadIndex,
+        std::vector< std::vector< Eigen::VectorXd > >& pressureCoefficientsPerThread )
+{
+    const unsigned int numberOfAnglesOfAttack = dataPointsOfIndependentVariables_[ 1 ].size( );
+    const unsigned int numberOfAnglesOfSideslip = dataPointsOfIndependentVariables_[ 2 ].size( );
+
+    boost::array< int, 3 > independentVariableIndices;
+    independentVariableIndices[ 0 ] = dataPointIndex / ( numberOfAnglesOfAttack * numberOfAnglesOfSideslip );
+    independentVariableIndices[ 1 ] = ( dataPointIndex / numberOfAnglesOfSideslip ) % numberOfAnglesOfAttack;
+    independentVariableIndices[ 2 ] = dataPointIndex % numberOfAnglesOfSideslip;
+
+    determineVehicleCoefficients( independentVariableIndices, pressureCoefficientsPerThread[ threadIndex ] );
 }
 
 //! Generate aerodynamic coefficients at a single set of independent variables.
 void HypersonicLocalInclinationAnalysis::determineVehicleCoefficients(
-        const boost::array< int, 3 > independentVariableIndices )
+        const boost::array< int, 3 > independentVariableIndices,
+        std::vector< Eigen::VectorXd >& pressureCoefficients )
 {
+    pressureCoefficients.resize( vehicleParts_.size( ) );
+
     // Declare coefficients vector and initialize to zeros.
     Vector6d coefficients = Vector6d::Zero( );
 
@@ -285,7 +334,7 @@ void HypersonicLocalInclinationAnalysis::determineVehicleCoefficients(
     // to aerodynamicCoefficients_.
     for ( unsigned int i = 0 ; i < vehicleParts_.size( ) ; i++ )
     {
-        coefficients += determinePartCoefficients( i, independentVariableIndices );
+        coefficients += determinePartCoefficients( i, independentVariableIndices, pressureCoefficients[ i ] );
     }
 
     aerodynamicCoefficients_( independentVariableIndices ) = coefficients;
@@ -294,128 +343,63 @@ void HypersonicLocalInclinationAnalysis::determineVehicleCoefficients(
 
 //! Determine aerodynamic coefficients of a single vehicle part.
 Vector6d HypersonicLocalInclinationAnalysis::determinePartCoefficients(
-        const int partNumber, const boost::array< int, 3 > independentVariableIndices )
+        const int partNumber, const boost::array< int, 3 > independentVariableIndices,
+        Eigen::VectorXd& pressureCoefficients ) const
 {
-    // Declare and determine angles of attack and sideslip for analysis.
-    double angleOfAttack =  dataPointsOfIndependentVariables_[ 1 ]
-            [ independentVariableIndices[ 1 ] ];
-
-    double angleOfSideslip =  dataPointsOfIndependentVariables_[ 2 ]
-            [ independentVariableIndices[ 2 ] ];
-
-    // Declare partCoefficient vector.
-    Vector6d partCoefficients = Vector6d::Zero( );
-
-    // Check whether the inclinations of the vehicle part have already been computed.
-    if ( previouslyComputedInclinations_.count( std::pair< double, double >(
-                                                    angleOfAttack, angleOfSideslip ) ) == 0 )
-    {
-        // Determine panel inclinations for part.
-        determineInclinations( angleOfAttack, angleOfSideslip );
-
-        // Add panel inclinations to container
-        previouslyComputedInclinations_[ std::pair< double, double >(
-                    angleOfAttack, angleOfSideslip ) ] = inclination_;
-    }
-
-    else
-    {
-        // Fetch inclinations from container
-        inclination_ = previouslyComputedInclinations_[ std::pair< double, double >(
-                    angleOfAttack, angleOfSideslip ) ];
-    }
-
-    // Set pressureCoefficient_ array for given independent variables.
-    determinePressureCoefficients( partNumber, independentVariableIndices );
-
-    // Calculate force coefficients from pressure coefficients.
-    partCoefficients.segment( 0, 3 ) = calculateForceCoefficients( partNumber );
+    // Set pressure coefficients for given independent variables.
+    determinePressureCoefficients( partNumber, independentVariableIndices, pressureCoefficients );
 
-    // Calculate moment coefficients from pressure coefficients.
-    partCoefficients.segment( 3, 3 ) = calculateMomentCoefficients( partNumber );
-
-    return partCoefficients;
+    // Calculate force and moment coefficients from pressure coefficients.
+    return calculateForceAndMomentCoefficients( partNumber, pressureCoefficients );
 }
 
 //! Determine the pressure coefficients on a single vehicle part.
 void HypersonicLocalInclinationAnalysis::determinePressureCoefficients(
-        const int partNumber, const boost::array< int, 3 > independentVariableIndices )
+        const int partNumber, const boost::array< int, 3 > independentVariableIndices,
+        Eigen::VectorXd& pressureCoefficients ) const
 {
     // Retrieve Mach number.
     double machNumber = dataPointsOfIndependentVariables_[ 0 ]
             [ independentVariableIndices[ 0 ] ];
 
-    // Determine stagnation point pressure coefficients. Value is computed once
-    // here to prevent its calculation in inner loop.
-    stagnationPressureCoefficient = computeStagnationPressure(
-                machNumber, ratioOfSpecificHeats );
+    // Retrieve precomputed panel inclinations at angle of attack and sideslip.
+    const Eigen::VectorXd& inclinations = panelInclinations_[
+            independentVariableIndices[ 1 ] * dataPointsOfIndependentVariables_[ 2 ].size( ) +
+            independentVariableIndices[ 2 ] ][ partNumber ];
 
-    updateCompressionPressures( machNumber, partNumber );
-    updateExpansionPressures( machNumber, partNumber );
+    // Initialize pressure coefficients, so that no values of previous data points are retained.
+    pressureCoefficients.setZero( inclinations.rows( ) );
+    updateCompressionPressures( machNumber, partNumber, inclinations, pressureCoefficients );
+    updateExpansionPressures( machNumber, partNumber, inclinations, pressureCoefficients );
 }
 
-//! Determine force coefficients from pressure coefficients.
-Eigen::Vector3d HypersonicLocalInclinationAnalysis::calculateForceCoefficients(
-        const int partNumber )
+//! Determine force and moment coefficients from pressure coefficients.
+Vector6d HypersonicLocalInclinationAnalysis::calculateForceAndMomentCoefficients(
+        const int partNumber, const Eigen::VectorXd& pressureCoefficients ) const
 {
-    // Declare force coefficient vector and intialize to zeros.
-    Eigen::Vector3d forceCoefficients = Eigen::Vector3d::Zero( );
-
-    // Loop over all panels and add pressures, scaled by panel area, to force
-    // coefficients.
-    for ( int i = 0 ; i < vehicleParts_[ partNumber ]->getNumberOfLines( ) - 1 ; i++ )
-    {
-        for ( int j = 0 ; j < vehicleParts_[ partNumber ]->getNumberOfPoints( ) - 1 ; j++)
-        {
-            forceCoefficients -=
-                    pressureCoefficient_[ partNumber ][ i ][ j ] *
-                    vehicleParts_[ partNumber ]->getPanelArea( i, j ) *
-                    vehicleParts_[ partNumber ]->getPanelSurfaceNormal( i, j );
-        }
-    }
-
-    // Normalize result by reference area.
-    forceCoefficients /= referenceArea_;
-
-    return forceCoefficients;
-}
-
-//! Determine moment coefficients from pressure coefficients.
-Eigen::Vector3d HypersonicLocalInclinationAnalysis::calculateMomentCoefficients(
-        const int partNumber )
-{
-    // Declare moment coefficient vector and intialize to zeros.
-    Eigen::Vector3d momentCoefficients = Eigen::Vector3d::Zero( );
-
-    // Declare moment arm for panel moment determination.
-    Eigen::Vector3d referenceDistance ;
+    // Declare force and moment coefficient vector and intialize to zeros.
+    Vector6d partCoefficients = Vector6d::Zero( );
 
-    // Loop over all panels and add moments due pressures.
-    for ( int i = 0 ; i < vehicleParts_[ partNumber ]->getNumberOfLines( ) - 1 ; i++ )
+    // Loop over all panels and add pressures, scaled by panel area, to force and moment coefficients (panels are
+    // added in order, so that the result does not depend on the vectorization of the loop).
+    const Eigen::Matrix< double, 6, Eigen::Dynamic >& forceAndMomentDirections =
+            panelForceAndMomentDirections_[ partNumber ];
+    for ( int i = 0 ; i < pressureCoefficients.rows( ) ; i++ )
     {
-        for ( int j = 0 ; j < vehicleParts_[ partNumber ]->getNumberOfPoints( ) - 1 ; j++ )
-        {
-            // Determine moment arm for given panel centroid.
-            referenceDistance = ( vehicleParts_[ partNumber ]->
-                                  getPanelCentroid( i, j ) -  momentReferencePoint_ );
-
-            momentCoefficients -=
-                    pressureCoefficient_[ partNumber ][ i ][ j ] *
-                    vehicleParts_[ partNumber ]->getPanelArea( i, j ) *
-                    ( referenceDistance.cross( vehicleParts_[ partNumber ]->
-                                               getPanelSurfaceNormal( i, j ) ) );
-        }
+        partCoefficients -= ( pressureCoefficients( i ) * panelAreas_[ partNumber ]( i ) ) *
+                forceAndMomentDirections.col( i );
     }
 
-    // Scale result by reference length and area.
-    momentCoefficients /= ( referenceLength_ * referenceArea_ );
+    // Normalize result by reference area (forces) and by reference length and area (moments).
+    partCoefficients.segment( 0, 3 ) /= referenceArea_;
+    partCoefficients.segment( 3, 3 ) /= ( referenceLength_ * referenceArea_ );
 
-    return momentCoefficients;
+    return partCoefficients;
 }
 
-//! Determines the inclination angle of panels on a single part.
-void HypersonicLocalInclinationAnalysis::determineInclinations( const double angleOfAttack,
-                                                                const double angleOfSideslip )
+//! Determines the inclination angle of panels on all parts.
+std::vector< Eigen::VectorXd > HypersonicLocalInclinationAnalysis::determineInclinations(
+        const double angleOfAttack, const double angleOfSideslip ) const
 {
     // Declare free-stream velocity vector.
     Eigen::Vector3d freestreamVelocityDirection;
@@ -428,34 +412,36 @@ void HypersonicLocalInclinationAnalysis::determineInclinations( const double ang
     freestreamVelocityDirection( 1 ) = freestreamVelocityDirectionY;
     freestreamVelocityDirection( 2 ) = freestreamVelocityDirectionZ;
 
-    // Declare cosine of inclination angle.
-    double cosineOfInclination;
-
-    // Loop over all panels of given vehicle part and set inclination angles.
+    // Loop over all panels of all vehicle parts and set inclination angles.
+    std::vector< Eigen::VectorXd > inclinations( vehicleParts_.size( ) );
     for( unsigned int k = 0; k < vehicleParts_.size( ); k++ )
     {
-        for ( int i = 0 ; i < vehicleParts_[ k ]->getNumberOfLines( ) - 1 ; i++ )
+        inclinations[ k ].resize( panelSurfaceNormals_[ k ].cols( ) );
+        for ( int i = 0 ; i < panelSurfaceNormals_[ k ].cols( ) ; i++ )
         {
-            for ( int j = 0 ; j < vehicleParts_[ k ]->getNumberOfPoints( ) - 1 ; j++ )
-            {
+            // Determine cosine of inclination angle from inner product between
+            // surface normal and free-stream direction.
+            double cosineOfInclination = panelSurfaceNormals_[ k ].col( i ).dot( freestreamVelocityDirection );
 
-                // Determine cosine of inclination angle from inner product between
-                // surface normal and free-stream direction.
-                cosineOfInclination = vehicleParts_[ k ]->
-                        getPanelSurfaceNormal( i, j ).
-                        dot( freestreamVelocityDirection );
-
-                // Set inclination angle.
-                inclination_[ k ][ i ][ j ] = PI / 2.0 - acos( cosineOfInclination );
-            }
+            // Set inclination angle.
+            inclinations[ k ]( i ) = PI / 2.0 - acos( cosineOfInclination );
         }
     }
+
+    return inclinations;
 }
 
 //! Determine compression pressure coefficients on all parts.
 void HypersonicLocalInclinationAnalysis::updateCompressionPressures( const double machNumber,
-                                                                     const int partNumber )
+                                                                     const int partNumber,
+                                                                     const Eigen::VectorXd& inclinations,
+                                                                     Eigen::VectorXd& pressureCoefficients ) const
 {
+    // Determine stagnation point pressure coefficient. Value is computed once
+    // here to prevent its calculation in inner loop.
+    double stagnationPressureCoefficient = computeStagnationPressure(
+                machNumber, ratioOfSpecificHeats );
+
     int method = selectedMethods_[ 0 ][ partNumber ];
 
     boost::function< double( double ) > pressureFunction;
@@ -522,23 +508,21 @@ void HypersonicLocalInclinationAnalysis::updateCompressionPressures( const doubl
         break;
     }
 
-    for ( int i = 0 ; i < vehicleParts_[ partNumber ]->getNumberOfLines( ) - 1; i++ )
+    for ( int i = 0 ; i < inclinations.rows( ) ; i++ )
     {
-        for ( int j = 0 ; j < vehicleParts_[ partNumber ]->getNumberOfPoints( ) - 1 ; j++ )
+        if ( inclinations( i ) > 0 )
         {
-            if ( inclination_[ partNumber ][ i ][ j ] > 0 )
-            {
-                // If panel inclination is positive, calculate pressure coefficient.
-                pressureCoefficient_[ partNumber ][ i ][ j ] =
-                        pressureFunction( inclination_[ partNumber ][ i ][ j ] );
-            }
+            // If panel inclination is positive, calculate pressure coefficient.
+            pressureCoefficients( i ) = pressureFunction( inclinations( i ) );
         }
     }
 }
 
 //! Determines expansion pressure coefficients on all parts.
 void HypersonicLocalInclinationAnalysis::updateExpansionPressures( const double machNumber,
-                                                                   const int partNumber )
+                                                                   const int partNumber,
+                                                                   const Eigen::VectorXd& inclinations,
+                                                                   Eigen::VectorXd& pressureCoefficients ) const
 {
     // Get analysis method of part to analyze.
     int method = selectedMethods_[ 1 ][ partNumber ];
@@ -564,18 +548,13 @@ void HypersonicLocalInclinationAnalysis::updateExpansionPressures( const double
 
         }
 
-        // Iterate over all panels on part.
-        for ( int i = 0 ; i < vehicleParts_[ partNumber ]->getNumberOfLines( ) - 1 ; i++ )
+        // Iterate over all panels on part (pressure is independent of inclination).
+        const double expansionPressureCoefficient = pressureFunction( );
+        for ( int i = 0 ; i < inclinations.rows( ) ; i++ )
         {
-            for ( int j = 0 ; j < vehicleParts_[ partNumber ]->getNumberOfPoints( ) - 1 ; j++ )
+            if ( inclinations( i ) <= 0 )
             {
-                if ( inclination_[ partNumber ][ i ][ j ] <= 0 )
-                {
-                    // If panel inclination is negative, calculate pressure using
-                    // Van Dyke unified method.
-                    pressureCoefficient_[ partNumber ][ i ][ j ] =
-                            pressureFunction( );
-                }
+                pressureCoefficients( i ) = expansionPressureCoefficient;
             }
         }
     }
@@ -614,17 +593,12 @@ void HypersonicLocalInclinationAnalysis::updateExpansionPressures( const double
         }
 
         // Iterate over all panels on part.
-        for ( int i = 0 ; i < vehicleParts_[ partNumber ]->getNumberOfLines( ) - 1 ; i++ )
+        for ( int i = 0 ; i < inclinations.rows( ) ; i++ )
         {
-            for ( int j = 0 ; j < vehicleParts_[ partNumber ]->getNumberOfPoints( ) - 1 ; j++ )
+            if ( inclinations( i ) <= 0 )
             {
-                if ( inclination_[ partNumber ][ i ][ j ] <= 0 )
-                {
-                    // If panel inclination is negative, calculate pressure using
-                    // Van Dyke unified method.
-                    pressureCoefficient_[ partNumber ][ i ][ j ] =
-                            pressureFunction( inclination_[ partNumber ][ i ][ j ] );
-                }
+                // If panel inclination is negative, calculate expansion pressure coefficient.
+                pressureCoefficients( i ) = pressureFunction( inclinations( i ) );
             }
         }
     }
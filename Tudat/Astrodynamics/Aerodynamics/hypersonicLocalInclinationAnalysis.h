@@ -18,7 +18,6 @@
 #ifndef TUDAT_HYPERSONIC_LOCAL_INCLINATION_ANALYSIS_H
 #define TUDAT_HYPERSONIC_LOCAL_INCLINATION_ANALYSIS_H
 
-#include <map>
 #include <string>
 #include <vector>
 
@@ -67,6 +66,9 @@ std::vector< double > getDefaultHypersonicLocalInclinationAngleOfSideslipPoints(
  * panel inclination determination process, a geometry with outward surface-normals is assumed.
  * The resulting coefficients are expressed in the same reference frame as that of the input
  * geometry.
+ * The coefficients at the different data points of the independent variables are generated concurrently, using the
+ * panel inclinations at each of the combinations of angle of attack and sideslip, which are precomputed before the
+ * coefficients are generated. The resulting coefficients are independent of the number of threads that is used.
  */
 class HypersonicLocalInclinationAnalysis: public AerodynamicCoefficientGenerator< 3, 6 >
 {
@@ -99,6 +101,8 @@ public:
      *  and moments.
      *  \param referenceLength Reference length used to non-dimensionalize aerodynamic moments.
      *  \param momentReferencePoint Reference point wrt which aerodynamic moments are calculated.
+     *  \param numberOfThreads Number of threads used to generate the coefficients (default 1; if 0, the number of
+     *  concurrent threads supported by the hardware is used).
      */
     HypersonicLocalInclinationAnalysis(
             const std::vector< std::vector< double > >& dataPointsOfIndependentVariables,
@@ -109,7 +113,8 @@ public:
             const std::vector< std::vector< int > >& selectedMethods,
             const double referenceArea,
             const double referenceLength,
-            const Eigen::Vector3d& momentReferencePoint );
+            const Eigen::Vector3d& momentReferencePoint,
+            const unsigned int numberOfThreads = 1 );
 
     //! Default destructor.
     /*!
@@ -129,15 +134,17 @@ public:
     Eigen::Vector6d getAerodynamicCoefficientsDataPoint(
             const boost::array< int, 3 > independentVariables );
 
-    //! Determine inclination angles of panels on a given part.
+    //! Determine inclination angles of panels on all parts.
     /*!
      * Determines panel inclinations for all panels on all parts for given attitude.
      * Outward pointing surface-normals are assumed!
      * \param angleOfAttack Angle of attack at which to determine inclination angles.
      * \param angleOfSideslip Angle of sideslip at which to determine inclination angles.
+     * \return Panel inclinations, with one vector per part, in which the panels are ordered by line index first, and
+     * point index second.
      */
-    void determineInclinations( const double angleOfAttack,
-                                const double angleOfSideslip );
+    std::vector< Eigen::VectorXd > determineInclinations( const double angleOfAttack,
+                                                          const double angleOfSideslip ) const;
 
     //! Get the number of vehicle parts.
     /*!
@@ -179,29 +186,53 @@ private:
     /*!
      * Generates aerodynamic database. Settings of geometry,
      * reference quantities, database point settings and analysis methods
-     *  should have been set previously.
+     *  should have been set previously. The data points are distributed over numberOfThreads_ threads.
      */
     void generateCoefficients( );
 
+    //! Compute panel inclinations at a single combination of angle of attack and sideslip.
+    /*!
+     * Computes the panel inclinations of all parts at a single combination of angle of attack and sideslip, and sets
+     * the corresponding entry of panelInclinations_.
+     * \param attitudeIndex Index of the combination of angle of attack and sideslip (see panelInclinations_).
+     */
+    void computePanelInclinationsForAttitude( const unsigned int attitudeIndex );
+
+    //! Compute aerodynamic coefficients at a single data point of the database.
+    /*!
+     * Computes aerodynamic coefficients at a single data point of the database, as used by generateCoefficients.
+     * \param dataPointIndex Index of the data point, with the Mach number index varying slowest and the angle of
+     * sideslip index varying fastest.
+     * \param threadIndex Index of the thread on which the function is called.
+     * \param pressureCoefficientsPerThread Panel pressure coefficients on each part, one entry per thread (scratch space).
+     */
+    void computeCoefficientsAtDataPoint(
+            const unsigned int dataPointIndex, const unsigned int threadIndex,
+            std::vector< std::vector< Eigen::VectorXd > >& pressureCoefficientsPerThread );
+
     //! Generate aerodynamic coefficients at a single set of independent variables.
     /*!
      * Generates aerodynamic coefficients at a single set of independent variables.
      * Determines values and sets corresponding entry in vehicleCoefficients_ array.
      * \param independentVariableIndices Array of indices from lists of Mach number,
      *          angle of attack and angle of sideslip points at which to perform analysis.
+     * \param pressureCoefficients Panel pressure coefficients on each part (scratch space, resized as needed).
      */
-    void determineVehicleCoefficients( const boost::array< int, 3 > independentVariableIndices );
+    void determineVehicleCoefficients( const boost::array< int, 3 > independentVariableIndices,
+                                       std::vector< Eigen::VectorXd >& pressureCoefficients );
 
     //! Determine aerodynamic coefficients for a single LaWGS part.
     /*!
      * Determines aerodynamic coefficients for a single LaWGS part,
-     * calls determinepressureCoefficient_ function for given vehicle part.
+     * calls determinePressureCoefficients function for given vehicle part.
      * \param partNumber Index from vehicleParts_ array for which to determine coefficients.
      * \param independentVariableIndices Array of indices of independent variables.
+     * \param pressureCoefficients Panel pressure coefficients of the part (scratch space).
      * \return Force and moment coefficients for requested vehicle part.
      */
     Eigen::Vector6d determinePartCoefficients(
-            const int partNumber, const boost::array< int, 3 > independentVariableIndices );
+            const int partNumber, const boost::array< int, 3 > independentVariableIndices,
+            Eigen::VectorXd& pressureCoefficients ) const;
 
     //! Determine pressure coefficients on a given part.
     /*!
@@ -209,46 +240,49 @@ private:
      * Calls the updateExpansionPressures and updateCompressionPressures for given vehicle part.
      * \param partNumber Index from vehicleParts_ array for which to determine coefficients.
      * \param independentVariableIndices Array of indices of independent variables.
+     * \param pressureCoefficients Panel pressure coefficients of the part (returned by reference).
      */
     void determinePressureCoefficients( const int partNumber,
-                                        const boost::array< int, 3 > independentVariableIndices );
+                                        const boost::array< int, 3 > independentVariableIndices,
+                                        Eigen::VectorXd& pressureCoefficients ) const;
 
-    //! Determine force coefficients of a part.
+    //! Determine force and moment coefficients of a part.
     /*!
-     * Sums the pressure coefficients of given part and determines force coefficients from it by
-     * non-dimensionalization with reference area.
+     * Sums the contributions of the pressure coefficients on all panels of given part to the force and moment
+     * coefficients. Moment arms are taken from panel centroid to momentReferencePoint. Non-dimensionalization is
+     * performed by the reference area (forces), and by the product of referenceLength and referenceArea (moments).
      * \param partNumber Index from vehicleParts_ array for which determine coefficients.
-     * \return Force coefficients for requested vehicle part.
-     */
-    Eigen::Vector3d calculateForceCoefficients( const int partNumber );
-
-    //! Determine moment coefficients of a part.
-    /*!
-     * Determines the moment coefficients of a given part by summing the contributions of all
-     * panels on the part. Moment arms are taken from panel centroid to momentReferencePoint. Non-
-     * dimensionalization is performed by product of referenceLength and referenceArea.
-     * \param partNumber Index from vehicleParts_ array for which to determine coefficients.
-     * \return Moment coefficients for requested vehicle part.
+     * \param pressureCoefficients Panel pressure coefficients of the part.
+     * \return Force and moment coefficients for requested vehicle part.
      */
-    Eigen::Vector3d calculateMomentCoefficients( const int partNumber );
+    Eigen::Vector6d calculateForceAndMomentCoefficients(
+            const int partNumber, const Eigen::VectorXd& pressureCoefficients ) const;
 
     //! Determine the compression pressure coefficients of a given part.
     /*!
-     * Sets the values of pressureCoefficient_ on given part and at given Mach number for which
+     * Sets the values of pressure coefficients on given part and at given Mach number for which
      * inclination > 0.
      * \param machNumber Mach number at which to perform analysis.
      * \param partNumber of part from vehicleParts_ which is to be analyzed.
+     * \param inclinations Panel inclinations of the part.
+     * \param pressureCoefficients Panel pressure coefficients of the part (modified by this function).
      */
-    void updateCompressionPressures( const double machNumber, const int partNumber );
+    void updateCompressionPressures( const double machNumber, const int partNumber,
+                                     const Eigen::VectorXd& inclinations,
+                                     Eigen::VectorXd& pressureCoefficients ) const;
 
     //! Determine the expansion pressure coefficients of a given part.
     /*!
-     * Determine the values of pressureCoefficient_ on given part and at given Mach number for
+     * Determine the values of pressure coefficients on given part and at given Mach number for
      * which inclination <= 0.
      * \param machNumber Mach number at which to perform analysis.
      * \param partNumber of part from vehicleParts_ which is to be analyzed.
+     * \param inclinations Panel inclinations of the part.
+     * \param pressureCoefficients Panel pressure coefficients of the part (modified by this function).
      */
-    void updateExpansionPressures( const double machNumber, const int partNumber );
+    void updateExpansionPressures( const double machNumber, const int partNumber,
+                                   const Eigen::VectorXd& inclinations,
+                                   Eigen::VectorXd& pressureCoefficients ) const;
 
     //! Array of vehicle parts.
     /*!
@@ -263,40 +297,43 @@ private:
      */
     boost::multi_array< bool, 3 > isCoefficientGenerated_;
 
-    //! Three-dimensional array of panel inclination angles.
+    //! Panel areas of each part.
     /*!
-     * Three-dimensional array of panel inclination angles at current values of
-     * independent variables. Indices indicate part-line-point.
+     * Panel areas of each part, with the panels ordered by line index first, and point index second.
      */
-    std::vector< std::vector< std::vector< double > > > inclination_;
+    std::vector< Eigen::VectorXd > panelAreas_;
 
-    //! Map of angle of attack and -sideslip pair and associated panel inclinations.
+    //! Panel surface normals of each part.
     /*!
-     * Map of angle of attack and -sideslip pair and associated panel inclinations.
+     * Panel surface normals of each part, with the panels ordered by line index first, and point index second.
      */
-    std::map< std::pair< double, double >, std::vector< std::vector< std::vector< double > > > >
-            previouslyComputedInclinations_;
+    std::vector< Eigen::Matrix3Xd > panelSurfaceNormals_;
 
-    //! Three-dimensional array of panel pressure coefficients.
+    //! Force and moment directions of the panels of each part.
     /*!
-     * Three-dimensional array of panel pressure coefficients at current values
-     * of independent variables. Indices indicate part-line-point.
+     * Force and moment directions of the panels of each part, with one column per panel (ordered as in panelAreas_).
+     * The first three entries of each column are the panel surface normal, the last three entries the cross product of
+     * the moment arm (from momentReferencePoint to panel centroid) and the surface normal.
      */
-    std::vector< std::vector< std::vector< double > > > pressureCoefficient_;
+    std::vector< Eigen::Matrix< double, 6, Eigen::Dynamic > > panelForceAndMomentDirections_;
 
-    //! Stagnation pressure coefficient.
+    //! Panel inclinations at each of the combinations of angle of attack and sideslip.
     /*!
-     * Stagnation pressure coefficient for flow which has passed through a
-     * normal shock wave at current Mach number.
+     * Panel inclinations at each of the combinations of angle of attack and sideslip, computed before generating the
+     * coefficients, and not modified afterwards. The inclinations at the i-th angle of attack and j-th angle of
+     * sideslip are stored at index i * (number of angles of sideslip) + j, with one vector per part.
      */
-    double stagnationPressureCoefficient;
+    std::vector< std::vector< Eigen::VectorXd > > panelInclinations_;
 
     //! Ratio of specific heats.
     /*!
      * Ratio of specific heat at constant pressure to specific heat at constant pressure.
      */
     double ratioOfSpecificHeats;
-\
+
+    //! Number of threads used to generate the coefficients.
+    unsigned int numberOfThreads_;
+
     //! Array of selected methods.
     /*!
      * Array of selected methods, first index represents compression/expansion,
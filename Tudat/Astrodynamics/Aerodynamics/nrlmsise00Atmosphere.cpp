@@ -8,6 +8,9 @@
  *    http://tudat.tudelft.nl/LICENSE.
  */
 
+#include <cmath>
+#include <mutex>
+
 #include "Tudat/Astrodynamics/Aerodynamics/nrlmsise00Atmosphere.h"
 #include "Tudat/Mathematics/BasicMathematics/mathematicalConstants.h"
 
@@ -18,6 +21,14 @@ namespace tudat
 namespace aerodynamics
 {
 
+//! Mutex serializing the evaluation of the NRLMSISE00 model.
+/*!
+ *  Mutex serializing the evaluation of the NRLMSISE00 model, since its implementation stores intermediate results in
+ *  (file-)static variables, which are shared by all NRLMSISE00Atmosphere objects.
+ */
+static std::mutex nrlmsise00EvaluationMutex;
+
+//! Compute the local atmospheric properties.
 void NRLMSISE00Atmosphere::computeProperties(
         const double altitude, const double longitude,
         const double latitude, const double time )
@@ -32,90 +43,266 @@ void NRLMSISE00Atmosphere::computeProperties(
     }
     hashKey_ = hashKey;
 
-    // Retrieve input data.
-    inputData_ = nrlmsise00InputFunction_(
-                altitude, longitude, latitude, time );
-    std::copy( inputData_.apVector.begin( ), inputData_.apVector.end( ), aph_.a );
-    std::copy( inputData_.switches.begin( ), inputData_.switches.end( ), flags_.switches);
+    if( maximumNumberOfCacheEntries_ == 0 )
+    {
+        // Retrieve input data.
+        inputData_ = nrlmsise00InputFunction_(
+                    altitude, longitude, latitude, time );
+
+        // Call NRLMSISE00
+        evaluateModel( altitude, longitude, latitude, inputData_, output_ );
+    }
+    else
+    {
+        // Retrieve model evaluation at rounded independent variables from cache, or evaluate model and add to cache.
+        CacheKey cacheKey = getCacheKey( altitude, longitude, latitude, time );
+        const CacheEntry* cacheEntry = findCacheEntry( cacheKey );
+        if( cacheEntry != NULL )
+        {
+            inputData_ = cacheEntry->second.first;
+            output_ = cacheEntry->second.second;
+        }
+        else
+        {
+            inputData_ = nrlmsise00InputFunction_(
+                        cacheKey[ 0 ], cacheKey[ 1 ], cacheKey[ 2 ], cacheKey[ 3 ] );
+            evaluateModel( cacheKey[ 0 ], cacheKey[ 1 ], cacheKey[ 2 ], inputData_, output_ );
+            addCacheEntry( cacheKey, inputData_, output_ );
+        }
+    }
+
+    computePropertiesFromModelOutput( output_, currentProperties_ );
+}
+
+//! Compute the atmospheric properties at a number of points at the same epoch.
+void NRLMSISE00Atmosphere::computePropertiesAtPoints(
+        const double time,
+        const std::vector< double >& altitudes,
+        const std::vector< double >& longitudes,
+        const std::vector< double >& latitudes,
+        std::vector< NRLMSISE00Properties >& properties,
+        const bool isLocalSolarTimeFixed )
+{
+    if( altitudes.size( ) != longitudes.size( ) || altitudes.size( ) != latitudes.size( ) )
+    {
+        throw std::runtime_error( "Error when computing NRLMSISE00 properties at points, number of altitudes, "
+                                  "longitudes and latitudes is not equal" );
+    }
+
+    properties.resize( altitudes.size( ) );
+    if( altitudes.size( ) == 0 )
+    {
+        return;
+    }
+
+    // Determine independent variables at which model is evaluated (rounded to cache resolutions if cache is used).
+    const bool useCache = ( maximumNumberOfCacheEntries_ > 0 );
+    std::vector< CacheKey > modelPoints( altitudes.size( ) );
+    for( unsigned int i = 0; i < altitudes.size( ); i++ )
+    {
+        if( useCache )
+        {
+            modelPoints[ i ] = getCacheKey( altitudes[ i ], longitudes[ i ], latitudes[ i ], time );
+        }
+        else
+        {
+            CacheKey modelPoint = { { altitudes[ i ], longitudes[ i ], latitudes[ i ], time } };
+            modelPoints[ i ] = modelPoint;
+        }
+    }
+
+    // Retrieve input data (solar and geomagnetic activity) once for all points.
+    NRLMSISE00Input pointInputData = nrlmsise00InputFunction_(
+                modelPoints[ 0 ][ 0 ], modelPoints[ 0 ][ 1 ], modelPoints[ 0 ][ 2 ], modelPoints[ 0 ][ 3 ] );
+    const double firstLongitude = modelPoints[ 0 ][ 1 ];
+    const double firstLocalSolarTime = pointInputData.localSolarTime;
+
+    nrlmsise_output pointOutput;
+    for( unsigned int i = 0; i < altitudes.size( ); i++ )
+    {
+        const CacheEntry* cacheEntry = useCache ? findCacheEntry( modelPoints[ i ] ) : NULL;
+        if( cacheEntry != NULL )
+        {
+            computePropertiesFromModelOutput( cacheEntry->second.second, properties[ i ] );
+        }
+        else
+        {
+            if( !isLocalSolarTimeFixed )
+            {
+                pointInputData.localSolarTime = firstLocalSolarTime +
+                        ( modelPoints[ i ][ 1 ] - firstLongitude ) / ( mathematical_constants::PI / 12.0 );
+            }
+            evaluateModel( modelPoints[ i ][ 0 ], modelPoints[ i ][ 1 ], modelPoints[ i ][ 2 ], pointInputData,
+                           pointOutput );
+            computePropertiesFromModelOutput( pointOutput, properties[ i ] );
+
+            if( useCache )
+            {
+                addCacheEntry( modelPoints[ i ], pointInputData, pointOutput );
+            }
+        }
+    }
+}
+
+//! Function to set the settings of the cache of model evaluations.
+void NRLMSISE00Atmosphere::setCacheSettings( const unsigned int maximumNumberOfCacheEntries,
+                                             const double altitudeResolution,
+                                             const double angleResolution,
+                                             const double timeResolution )
+{
+    if( altitudeResolution < 0.0 || angleResolution < 0.0 || timeResolution < 0.0 )
+    {
+        throw std::runtime_error( "Error when setting NRLMSISE00 cache settings, resolutions must be non-negative" );
+    }
+
+    maximumNumberOfCacheEntries_ = maximumNumberOfCacheEntries;
+    altitudeResolution_ = altitudeResolution;
+    angleResolution_ = angleResolution;
+    timeResolution_ = timeResolution;
+    resetHashKey( );
+}
+
+//! Evaluate the NRLMSISE00 model.
+void NRLMSISE00Atmosphere::evaluateModel(
+        const double altitude, const double longitude, const double latitude,
+        const NRLMSISE00Input& inputData, nrlmsise_output& output )
+{
+    std::copy( inputData.apVector.begin( ), inputData.apVector.end( ), aph_.a );
+    std::copy( inputData.switches.begin( ), inputData.switches.end( ), flags_.switches);
 
     input_.g_lat  = latitude * 180.0 / mathematical_constants::PI; // rad to deg
     input_.g_long = longitude * 180.0 / mathematical_constants::PI; // rad to deg
     input_.alt    = altitude * 1.0E-3; // m to km
-    input_.year   = inputData_.year;
-    input_.doy    = inputData_.dayOfTheYear;
-    input_.sec    = inputData_.secondOfTheDay;
-    input_.lst    = inputData_.localSolarTime;
-    input_.f107   = inputData_.f107;
-    input_.f107A  = inputData_.f107a;
-    input_.ap     = inputData_.apDaily;
+    input_.year   = inputData.year;
+    input_.doy    = inputData.dayOfTheYear;
+    input_.sec    = inputData.secondOfTheDay;
+    input_.lst    = inputData.localSolarTime;
+    input_.f107   = inputData.f107;
+    input_.f107A  = inputData.f107a;
+    input_.ap     = inputData.apDaily;
     input_.ap_a   = &aph_;
 
-    // Call NRLMSISE00
-    gtd7(&input_, &flags_, &output_);
+    // Call NRLMSISE00 (one thread at a time)
+    std::lock_guard< std::mutex > evaluationLock( nrlmsise00EvaluationMutex );
+    gtd7(&input_, &flags_, &output);
+}
 
+//! Compute the atmospheric properties from the output of the NRLMSISE00 model.
+void NRLMSISE00Atmosphere::computePropertiesFromModelOutput(
+        const nrlmsise_output& output, NRLMSISE00Properties& properties )
+{
     // Retrieve density and temperature
-    density_ = output_.d[ 5 ] * 1000.0; // GM/CM3 to kg/M3
-    temperature_ = output_.t[1];
+    properties.density = output.d[ 5 ] * 1000.0; // GM/CM3 to kg/M3
+    properties.temperature = output.t[1];
 
     // Get number densities
-    numberDensities_.resize(8);
-    numberDensities_[0] = output_.d[0] * 1.0E6 ; // HE NUMBER DENSITY    (M-3)
-    numberDensities_[1] = output_.d[1] * 1.0E6 ; // O NUMBER DENSITY     (M-3)
-    numberDensities_[2] = output_.d[2] * 1.0E6 ; // N2 NUMBER DENSITY    (M-3)
-    numberDensities_[3] = output_.d[3] * 1.0E6 ; // O2 NUMBER DENSITY    (M-3)
-    numberDensities_[4] = output_.d[4] * 1.0E6 ; // AR NUMBER DENSITY    (M-3)
-    numberDensities_[5] = output_.d[6] * 1.0E6 ; // H NUMBER DENSITY     (M-3)
-    numberDensities_[6] = output_.d[7] * 1.0E6 ; // N NUMBER DENSITY     (M-3)
-    numberDensities_[7] = output_.d[8] * 1.0E6 ; // Anomalous oxygen NUMBER DENSITY  (M-3)
+    std::vector< double >& numberDensities = properties.numberDensities;
+    numberDensities.resize(8);
+    numberDensities[0] = output.d[0] * 1.0E6 ; // HE NUMBER DENSITY    (M-3)
+    numberDensities[1] = output.d[1] * 1.0E6 ; // O NUMBER DENSITY     (M-3)
+    numberDensities[2] = output.d[2] * 1.0E6 ; // N2 NUMBER DENSITY    (M-3)
+    numberDensities[3] = output.d[3] * 1.0E6 ; // O2 NUMBER DENSITY    (M-3)
+    numberDensities[4] = output.d[4] * 1.0E6 ; // AR NUMBER DENSITY    (M-3)
+    numberDensities[5] = output.d[6] * 1.0E6 ; // H NUMBER DENSITY     (M-3)
+    numberDensities[6] = output.d[7] * 1.0E6 ; // N NUMBER DENSITY     (M-3)
+    numberDensities[7] = output.d[8] * 1.0E6 ; // Anomalous oxygen NUMBER DENSITY  (M-3)
 
     // Get average number density
     double sumOfNumberDensity = 0.0 ;
-    for( unsigned int i = 0 ; i < numberDensities_.size( ) ; i++)
+    for( unsigned int i = 0 ; i < numberDensities.size( ) ; i++)
     {
-        sumOfNumberDensity += numberDensities_[ i ];
+        sumOfNumberDensity += numberDensities[ i ];
     }
-    averageNumberDensity_ = sumOfNumberDensity / double( numberDensities_.size( ) );
+    properties.averageNumberDensity = sumOfNumberDensity / double( numberDensities.size( ) );
 
     // Mean molar mass (Thermodynamics an Engineering Approach, Michael A. Boles)
-    meanMolarMass_ = numberDensities_[0] * gasComponentProperties_.molarMassHelium;
-    meanMolarMass_ += numberDensities_[1] * gasComponentProperties_.molarMassAtomicOxygen;
-    meanMolarMass_ += numberDensities_[2] * gasComponentProperties_.molarMassNitrogen;
-    meanMolarMass_ += numberDensities_[3] * gasComponentProperties_.molarMassOxygen;
-    meanMolarMass_ += numberDensities_[4] * gasComponentProperties_.molarMassArgon;
-    meanMolarMass_ += numberDensities_[5] * gasComponentProperties_.molarMassAtomicHydrogen;
-    meanMolarMass_ += numberDensities_[6] * gasComponentProperties_.molarMassAtomicNitrogen;
-    meanMolarMass_ += numberDensities_[7] * gasComponentProperties_.molarMassOxygen;
-    meanMolarMass_ = meanMolarMass_ / sumOfNumberDensity ;
+    double meanMolarMass = numberDensities[0] * gasComponentProperties_.molarMassHelium;
+    meanMolarMass += numberDensities[1] * gasComponentProperties_.molarMassAtomicOxygen;
+    meanMolarMass += numberDensities[2] * gasComponentProperties_.molarMassNitrogen;
+    meanMolarMass += numberDensities[3] * gasComponentProperties_.molarMassOxygen;
+    meanMolarMass += numberDensities[4] * gasComponentProperties_.molarMassArgon;
+    meanMolarMass += numberDensities[5] * gasComponentProperties_.molarMassAtomicHydrogen;
+    meanMolarMass += numberDensities[6] * gasComponentProperties_.molarMassAtomicNitrogen;
+    meanMolarMass += numberDensities[7] * gasComponentProperties_.molarMassOxygen;
+    properties.meanMolarMass = meanMolarMass / sumOfNumberDensity ;
 
     // Speed of sound
-    speedOfSound_ = aerodynamics::computeSpeedOfSound(
-                temperature_, specificHeatRatio_, molarGasConstant_ / meanMolarMass_ );
+    properties.speedOfSound = aerodynamics::computeSpeedOfSound(
+                properties.temperature, specificHeatRatio_, molarGasConstant_ / properties.meanMolarMass );
 
     // Collision diameter
-    weightedAverageCollisionDiameter_ = numberDensities_[0]* gasComponentProperties_.diameterHelium ;
-    weightedAverageCollisionDiameter_ += numberDensities_[1]* gasComponentProperties_.diameterAtomicOxygen ;
-    weightedAverageCollisionDiameter_ += numberDensities_[2]* gasComponentProperties_.diameterNitrogen ;
-    weightedAverageCollisionDiameter_ += numberDensities_[3]* gasComponentProperties_.diameterOxygen ;
-    weightedAverageCollisionDiameter_ += numberDensities_[4]* gasComponentProperties_.diameterArgon ;
-    weightedAverageCollisionDiameter_ += numberDensities_[5]* gasComponentProperties_.diameterAtomicHydrogen ;
-    weightedAverageCollisionDiameter_ += numberDensities_[6]* gasComponentProperties_.diameterAtomicNitrogen ;
-    weightedAverageCollisionDiameter_ += numberDensities_[7]* gasComponentProperties_.diameterAtomicOxygen ;
-    weightedAverageCollisionDiameter_ = weightedAverageCollisionDiameter_ / sumOfNumberDensity;
+    double weightedAverageCollisionDiameter = numberDensities[0]* gasComponentProperties_.diameterHelium ;
+    weightedAverageCollisionDiameter += numberDensities[1]* gasComponentProperties_.diameterAtomicOxygen ;
+    weightedAverageCollisionDiameter += numberDensities[2]* gasComponentProperties_.diameterNitrogen ;
+    weightedAverageCollisionDiameter += numberDensities[3]* gasComponentProperties_.diameterOxygen ;
+    weightedAverageCollisionDiameter += numberDensities[4]* gasComponentProperties_.diameterArgon ;
+    weightedAverageCollisionDiameter += numberDensities[5]* gasComponentProperties_.diameterAtomicHydrogen ;
+    weightedAverageCollisionDiameter += numberDensities[6]* gasComponentProperties_.diameterAtomicNitrogen ;
+    weightedAverageCollisionDiameter += numberDensities[7]* gasComponentProperties_.diameterAtomicOxygen ;
+    properties.weightedAverageCollisionDiameter = weightedAverageCollisionDiameter / sumOfNumberDensity;
 
     // Mean free path.
-    meanFreePath_ = aerodynamics::computeMeanFreePath( weightedAverageCollisionDiameter_, averageNumberDensity_ );
+    properties.meanFreePath = aerodynamics::computeMeanFreePath(
+                properties.weightedAverageCollisionDiameter, properties.averageNumberDensity );
 
     // Calculate pressure using ideal gas law (Thermodynamics an Engineering Approach, Michael A. Boles)
     if( useIdealGasLaw_ )
     {
-        pressure_ = density_ * molarGasConstant_ * temperature_ / meanMolarMass_ ;
+        properties.pressure = properties.density * molarGasConstant_ * properties.temperature /
+                properties.meanMolarMass ;
     }
     else
     {
-        pressure_ = TUDAT_NAN;
+        properties.pressure = TUDAT_NAN;
     }
 }
 
+//! Function to compute the key of the cache of model evaluations.
+NRLMSISE00Atmosphere::CacheKey NRLMSISE00Atmosphere::getCacheKey(
+        const double altitude, const double longitude, const double latitude, const double time )
+{
+    CacheKey cacheKey = { { altitude, longitude, latitude, time } };
+    const double resolutions[ 4 ] = { altitudeResolution_, angleResolution_, angleResolution_, timeResolution_ };
+    for( unsigned int i = 0; i < 4; i++ )
+    {
+        if( resolutions[ i ] > 0.0 )
+        {
+            cacheKey[ i ] = std::round( cacheKey[ i ] / resolutions[ i ] ) * resolutions[ i ];
+        }
+    }
+    return cacheKey;
+}
+
+//! Function to retrieve a model evaluation from the cache.
+const NRLMSISE00Atmosphere::CacheEntry* NRLMSISE00Atmosphere::findCacheEntry( const CacheKey& key )
+{
+    std::unordered_map< CacheKey, std::list< CacheEntry >::iterator, CacheKeyHash >::iterator entryIterator =
+            cacheEntryIterators_.find( key );
+    if( entryIterator == cacheEntryIterators_.end( ) )
+    {
+        return NULL;
+    }
+
+    // Move entry to front of list (most recently used).
+    cacheEntries_.splice( cacheEntries_.begin( ), cacheEntries_, entryIterator->second );
+    return &( *entryIterator->second );
+}
+
+//! Function to add a model evaluation to the cache.
+void NRLMSISE00Atmosphere::addCacheEntry(
+        const CacheKey& key, const NRLMSISE00Input& inputData, const nrlmsise_output& output )
+{
+    // Remove least recently used entry if cache is full.
+    if( cacheEntries_.size( ) >= maximumNumberOfCacheEntries_ )
+    {
+        cacheEntryIterators_.erase( cacheEntries_.back( ).first );
+        cacheEntries_.pop_back( );
+    }
+
+    cacheEntries_.push_front( std::make_pair( key, std::make_pair( inputData, output ) ) );
+    cacheEntryIterators_[ key ] = cacheEntries_.begin( );
+}
+
 //! Overloaded ostream to print class information.
 std::ostream& operator << ( std::ostream& stream,
                                  NRLMSISE00Input& nrlmsiseInput ){
@@ -12,10 +12,13 @@
 #define TUDAT_NRLMSISE00_ATMOSPHERE_H
 
 #include <vector>
+#include <list>
 #include <utility>
 #include <cmath>
 #include <algorithm>
+#include <unordered_map>
 
+#include <boost/array.hpp>
 #include <boost/function.hpp>
 #include <boost/functional/hash.hpp>
 
@@ -171,6 +174,44 @@ struct NRLMSISE00Input
     std::vector< int > switches;
 };
 
+//! Atmospheric properties computed by the NRLMSISE-00 atmosphere model at a single point.
+struct NRLMSISE00Properties
+{
+    //! Default constructor.
+    NRLMSISE00Properties( ):
+        density( TUDAT_NAN ), temperature( TUDAT_NAN ), pressure( TUDAT_NAN ), speedOfSound( TUDAT_NAN ),
+        meanFreePath( TUDAT_NAN ), numberDensities( 8, TUDAT_NAN ), averageNumberDensity( TUDAT_NAN ),
+        weightedAverageCollisionDiameter( TUDAT_NAN ), meanMolarMass( TUDAT_NAN )
+    { }
+
+    //! Density (kg/m3)
+    double density;
+
+    //! Temperature (K)
+    double temperature;
+
+    //! Pressure (Implemented with ideal gass law only!)
+    double pressure;
+
+    //! Speed of sound (m/s)
+    double speedOfSound;
+
+    //! Mean free path (m)
+    double meanFreePath;
+
+    //! Number densities of gas components (M-3), see NRLMSISE00Atmosphere::getNumberDensities
+    std::vector< double > numberDensities;
+
+    //! Average number density (M-3)
+    double averageNumberDensity;
+
+    //! Weighted average of the collision diameter using the number density as weights in (M)
+    double weightedAverageCollisionDiameter;
+
+    //! Mean molar mass (kg/mole)
+    double meanMolarMass;
+};
+
 //! NRLMSISE-00 atmosphere model class.
 /*!
  *  NRLMSISE-00 atmosphere model class. This class uses the NRLMSISE00 atmosphere model to calculate atmospheric
@@ -178,6 +219,11 @@ struct NRLMSISE00Input
  *  exosphere.
  *  Currently the ideal gas law is used to compute the speed of sound.
  *  The specific heat ratio is assumed to be constant and equal to 1.4.
+ *  Model evaluations are reused if the properties at the same point are requested repeatedly. Optionally, the results
+ *  of a number of previous model evaluations are kept in a least-recently-used cache (see setCacheSettings), and
+ *  properties at a number of points at the same epoch can be computed in one call (see computePropertiesAtPoints).
+ *  Since the NRLMSISE00 implementation uses static variables, its evaluation is serialized over all objects of this
+ *  class, so that different objects may be used by different threads concurrently (a single object may not).
  */
 class NRLMSISE00Atmosphere : public AtmosphereModel
 {
@@ -199,7 +245,8 @@ class NRLMSISE00Atmosphere : public AtmosphereModel
      */
     NRLMSISE00Atmosphere( const NRLMSISE00InputFunction nrlmsise00InputFunction,
                          const bool useIdealGasLaw = true )
-        :nrlmsise00InputFunction_(nrlmsise00InputFunction)
+        :nrlmsise00InputFunction_(nrlmsise00InputFunction), maximumNumberOfCacheEntries_( 0 ),
+          altitudeResolution_( 0.0 ), angleResolution_( 0.0 ), timeResolution_( 0.0 )
     {
         resetHashKey( );
         molarGasConstant_ = tudat::physical_constants::MOLAR_GAS_CONSTANT;
@@ -222,7 +269,8 @@ class NRLMSISE00Atmosphere : public AtmosphereModel
                          const double specificHeatRatio,
                          const GasComponentProperties gasProperties,
                          const bool useIdealGasLaw = true)
-        : nrlmsise00InputFunction_(nrlmsise00InputFunction)
+        : nrlmsise00InputFunction_(nrlmsise00InputFunction), maximumNumberOfCacheEntries_( 0 ),
+          altitudeResolution_( 0.0 ), angleResolution_( 0.0 ), timeResolution_( 0.0 )
     {
         resetHashKey( );
         molarGasConstant_ = tudat::physical_constants::MOLAR_GAS_CONSTANT;
@@ -255,7 +303,7 @@ class NRLMSISE00Atmosphere : public AtmosphereModel
                        const double latitude, const double time )
     {
         computeProperties( altitude, longitude, latitude, time );
-        return density_;
+        return currentProperties_.density;
     }
 
     //! Get local pressure.
@@ -279,7 +327,7 @@ class NRLMSISE00Atmosphere : public AtmosphereModel
         {
             throw std::runtime_error( "Error, non-ideal gas-law pressure-computation not yet implemented in NRLMSISE00Atmosphere." );
         }
-        return pressure_;
+        return currentProperties_.pressure;
     }
 
     //! Get local temperature.
@@ -295,7 +343,7 @@ class NRLMSISE00Atmosphere : public AtmosphereModel
                            const double latitude, const double time )
     {
         computeProperties( altitude, longitude, latitude, time );
-        return temperature_;
+        return currentProperties_.temperature;
     }
 
     //! Get local speed of sound.
@@ -311,7 +359,7 @@ class NRLMSISE00Atmosphere : public AtmosphereModel
                           const double latitude, const double time )
     {
         computeProperties(altitude, longitude, latitude, time );
-        return speedOfSound_;
+        return currentProperties_.speedOfSound;
     }
 
     //! Get local mean free path.
@@ -327,7 +375,7 @@ class NRLMSISE00Atmosphere : public AtmosphereModel
                           const double latitude, const double time )
     {
         computeProperties(altitude, longitude, latitude, time );
-        return meanFreePath_;
+        return currentProperties_.meanFreePath;
     }
 
     //! Get local mean molar mass.
@@ -343,7 +391,7 @@ class NRLMSISE00Atmosphere : public AtmosphereModel
                           const double latitude, const double time )
     {
         computeProperties(altitude, longitude, latitude, time );
-        return meanMolarMass_;
+        return currentProperties_.meanMolarMass;
     }
 
     //! get local number density of the gas components.
@@ -359,7 +407,7 @@ class NRLMSISE00Atmosphere : public AtmosphereModel
                                            const double latitude, const double time )
     {
         computeProperties( altitude, longitude, latitude, time );
-        return numberDensities_;
+        return currentProperties_.numberDensities;
     }
 
     //! Get local average number density.
@@ -375,7 +423,7 @@ class NRLMSISE00Atmosphere : public AtmosphereModel
                           const double latitude, const double time )
     {
         computeProperties(altitude, longitude, latitude, time );
-        return averageNumberDensity_;
+        return currentProperties_.averageNumberDensity;
     }
 
     //! Get local weighted average collision diameter.
@@ -391,7 +439,7 @@ class NRLMSISE00Atmosphere : public AtmosphereModel
                           const double latitude, const double time )
     {
         computeProperties(altitude, longitude, latitude, time );
-        return weightedAverageCollisionDiameter_;
+        return currentProperties_.weightedAverageCollisionDiameter;
     }
 
     //! Get the full model output
@@ -409,15 +457,68 @@ class NRLMSISE00Atmosphere : public AtmosphereModel
         const double altitude, const double longitude,
         const double latitude, const double time );
 
+    //! Compute the atmospheric properties at a number of points at the same epoch.
+    /*!
+     * Computes the atmospheric properties at a number of points at the same epoch (e.g. of a number of bodies at the
+     * current stage of a numerical integrator). The input function is evaluated only once (at the first point), and
+     * the solar and geomagnetic activity input that it provides is used for all points. The local solar time at the
+     * other points is obtained by shifting that at the first point by the difference in longitude (1 hour per 15 deg),
+     * unless it is fixed (as for an input function that overrides the local solar time). The cache (see
+     * setCacheSettings) is used and updated for all points. This function does not modify the properties returned by
+     * the single-point functions of this class.
+     * \param time Time at which properties are to be computed (seconds since J2000).
+     * \param altitudes Altitudes at which properties are to be computed [m].
+     * \param longitudes Longitudes at which properties are to be computed [rad].
+     * \param latitudes Latitudes at which properties are to be computed [rad].
+     * \param properties Atmospheric properties at each of the points (returned by reference).
+     * \param isLocalSolarTimeFixed Boolean denoting whether the local solar time provided by the input function at the
+     * first point is to be used for all points.
+     */
+    void computePropertiesAtPoints( const double time,
+                                    const std::vector< double >& altitudes,
+                                    const std::vector< double >& longitudes,
+                                    const std::vector< double >& latitudes,
+                                    std::vector< NRLMSISE00Properties >& properties,
+                                    const bool isLocalSolarTimeFixed = false );
+
+    //! Function to set the settings of the cache of model evaluations.
+    /*!
+     * Function to set the settings of the least-recently-used cache of model evaluations, and clear the cache. When
+     * the cache is used, the model is evaluated at altitude, longitude, latitude and time rounded to the nearest
+     * multiple of the given resolutions (if non-zero), so that all points that are rounded to the same values share a
+     * single cache entry, and results do not depend on the order in which points are evaluated.
+     * \param maximumNumberOfCacheEntries Maximum number of model evaluations that are kept in the cache (if 0, no
+     * cache is used).
+     * \param altitudeResolution Resolution to which altitudes are rounded when using the cache [m].
+     * \param angleResolution Resolution to which longitudes and latitudes are rounded when using the cache [rad].
+     * \param timeResolution Resolution to which times are rounded when using the cache [s].
+     */
+    void setCacheSettings( const unsigned int maximumNumberOfCacheEntries,
+                           const double altitudeResolution = 0.0,
+                           const double angleResolution = 0.0,
+                           const double timeResolution = 0.0 );
+
+    //! Function to retrieve the number of model evaluations currently in the cache.
+    /*!
+     * Function to retrieve the number of model evaluations currently in the cache.
+     * \return Number of model evaluations currently in the cache.
+     */
+    unsigned int getNumberOfCacheEntries( )
+    {
+        return cacheEntries_.size( );
+    }
+
     //! Reset the hash key
     /*!
-     * Resets the hash key, this allows re-computation even if the
+     * Resets the hash key and clears the cache of model evaluations, this allows re-computation even if the
      * independent parameters haven't changed. Such as in the case of
      * changes to the model.
      */
     void resetHashKey( )
     {
         hashKey_ = 0;
+        cacheEntries_.clear( );
+        cacheEntryIterators_.clear( );
     }
 
     //! Function to get  Input data to NRLMSISE00 atmosphere model
@@ -441,42 +542,18 @@ class NRLMSISE00Atmosphere : public AtmosphereModel
     //! Current key hash
     size_t hashKey_;
 
-    //!  Current local density (kg/m3)
-    double density_;
-
-    //! Current local temperature (K)
-    double temperature_;
-
-    //! Current local pressure (Implemented with ideal gass law only!)
-    double pressure_;
-
-    //! Current speed of sound (m/s)
-    double speedOfSound_;
-
-    //! Current mean free path (m)
-    double meanFreePath_;
-
     /*!
-     *  Current number densities of gas components
-     *      numberDensities_[0] - HE NUMBER DENSITY     (M-3)
-     *      numberDensities_[1] - O NUMBER DENSITY      (M-3)
-     *      numberDensities_[2] - N2 NUMBER DENSITY     (M-3)
-     *      numberDensities_[3] - O2 NUMBER DENSITY     (M-3)
-     *      numberDensities_[4] - AR NUMBER DENSITY     (M-3)
-     *      numberDensities_[5] - H NUMBER DENSITY      (M-3)
-     *      numberDensities_[6] - N NUMBER DENSITY      (M-3)
-     *      numberDensities_[7] - Anomalous oxygen NUMBER DENSITY   (M-3)
+     *  Current local atmospheric properties, with number densities of gas components
+     *      numberDensities[0] - HE NUMBER DENSITY     (M-3)
+     *      numberDensities[1] - O NUMBER DENSITY      (M-3)
+     *      numberDensities[2] - N2 NUMBER DENSITY     (M-3)
+     *      numberDensities[3] - O2 NUMBER DENSITY     (M-3)
+     *      numberDensities[4] - AR NUMBER DENSITY     (M-3)
+     *      numberDensities[5] - H NUMBER DENSITY      (M-3)
+     *      numberDensities[6] - N NUMBER DENSITY      (M-3)
+     *      numberDensities[7] - Anomalous oxygen NUMBER DENSITY   (M-3)
      */
-    std::vector< double > numberDensities_;
-
-    //! Current average number density (M-3)
-    double averageNumberDensity_;
-
-    //! Current weighted average of the collision diameter using the number density as weights in (M)
-    double weightedAverageCollisionDiameter_;
-
-    //! mean molar mass (kg/mole)
-    double meanMolarMass_;
+    NRLMSISE00Properties currentProperties_;
 
     //! Data structure that contains the colision diameter
     GasComponentProperties gasComponentProperties_;
@@ -589,8 +666,98 @@ class NRLMSISE00Atmosphere : public AtmosphereModel
     void computeProperties( const double altitude, const double longitude,
                             const double latitude, const double time );
 
+    //! Evaluate the NRLMSISE00 model.
+    /*!
+     * Evaluates the NRLMSISE00 model (GTD7 function) for given input data.
+     * \param altitude Altitude at which output is to be computed [m].
+     * \param longitude Longitude at which output is to be computed [rad].
+     * \param latitude Latitude at which output is to be computed [rad].
+     * \param inputData Input data to NRLMSISE00 atmosphere model.
+     * \param output Output of NRLMSISE00 atmosphere model (returned by reference).
+     */
+    void evaluateModel( const double altitude, const double longitude, const double latitude,
+                        const NRLMSISE00Input& inputData, nrlmsise_output& output );
+
+    //! Compute the atmospheric properties from the output of the NRLMSISE00 model.
+    /*!
+     * Computes the atmospheric properties (density, temperature, number densities, mean molar mass, speed of sound,
+     * collision diameter, mean free path and pressure) from the output of the NRLMSISE00 model.
+     * \param output Output of NRLMSISE00 atmosphere model.
+     * \param properties Atmospheric properties (returned by reference).
+     */
+    void computePropertiesFromModelOutput( const nrlmsise_output& output, NRLMSISE00Properties& properties );
+
+    //! Key of cache of model evaluations: altitude, longitude, latitude and time (rounded to cache resolutions).
+    typedef boost::array< double, 4 > CacheKey;
+
+    //! Hash function of keys of cache of model evaluations.
+    struct CacheKeyHash
+    {
+        //! Function to compute hash of cache key.
+        /*!
+         * Function to compute hash of cache key.
+         * \param key Key of cache of model evaluations.
+         * \return Hash of key.
+         */
+        size_t operator( )( const CacheKey& key ) const
+        {
+            return boost::hash_range( key.begin( ), key.end( ) );
+        }
+    };
+
+    //! Entry of cache of model evaluations: key, input data to and output of NRLMSISE00 atmosphere model.
+    typedef std::pair< CacheKey, std::pair< NRLMSISE00Input, nrlmsise_output > > CacheEntry;
+
+    //! Function to compute the key of the cache of model evaluations.
+    /*!
+     * Function to compute the key of the cache of model evaluations, by rounding the independent variables to the
+     * cache resolutions.
+     * \param altitude Altitude [m].
+     * \param longitude Longitude [rad].
+     * \param latitude Latitude [rad].
+     * \param time Time (seconds since J2000).
+     * \return Key of cache of model evaluations
+     */
+    CacheKey getCacheKey( const double altitude, const double longitude,
+                          const double latitude, const double time );
+
+    //! Function to retrieve a model evaluation from the cache.
+    /*!
+     * Function to retrieve a model evaluation from the cache, and mark it as most recently used.
+     * \param key Key of cache of model evaluations.
+     * \return Cache entry, or NULL if the key is not in the cache.
+     */
+    const CacheEntry* findCacheEntry( const CacheKey& key );
+
+    //! Function to add a model evaluation to the cache.
+    /*!
+     * Function to add a model evaluation to the cache, removing the least recently used entry if the cache is full.
+     * \param key Key of cache of model evaluations.
+     * \param inputData Input data to NRLMSISE00 atmosphere model.
+     * \param output Output of NRLMSISE00 atmosphere model.
+     */
+    void addCacheEntry( const CacheKey& key, const NRLMSISE00Input& inputData, const nrlmsise_output& output );
+
     //! Input data to NRLMSISE00 atmosphere model
     NRLMSISE00Input inputData_;
+
+    //! Maximum number of model evaluations that are kept in the cache (if 0, no cache is used).
+    unsigned int maximumNumberOfCacheEntries_;
+
+    //! Resolution to which altitudes are rounded when using the cache [m].
+    double altitudeResolution_;
+
+    //! Resolution to which longitudes and latitudes are rounded when using the cache [rad].
+    double angleResolution_;
+
+    //! Resolution to which times are rounded when using the cache [s].
+    double timeResolution_;
+
+    //! Cached model evaluations, ordered from most to least recently used.
+    std::list< CacheEntry > cacheEntries_;
+
+    //! Iterators to cached model evaluations in cacheEntries_, by key.
+    std::unordered_map< CacheKey, std::list< CacheEntry >::iterator, CacheKeyHash > cacheEntryIterators_;
 };
 
 }  // namespace aerodynamics
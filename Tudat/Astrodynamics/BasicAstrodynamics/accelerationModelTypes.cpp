@@ -59,6 +59,9 @@ std::string getAccelerationModelName( const AvailableAcceleration accelerationTy
     case direct_tidal_dissipation_acceleration:
         accelerationName  = "direct tidal dissipation ";
         break;
+    case automatic_differentiation_acceleration:
+        accelerationName  = "automatic differentiation ";
+        break;
     default:
         std::string errorMessage = "Error, acceleration type " +
                 std::to_string( accelerationType ) +
@@ -138,6 +141,10 @@ AvailableAcceleration getAccelerationModelType(
     {
         accelerationType = direct_tidal_dissipation_acceleration;
     }
+    else if( boost::dynamic_pointer_cast< AutomaticDifferentiationAcceleration >( accelerationModel ) != NULL )
+    {
+        accelerationType = automatic_differentiation_acceleration;
+    }
     else
     {
         throw std::runtime_error(
@@ -25,6 +25,7 @@
 #include "Tudat/Astrodynamics/Propulsion/massRateFromThrust.h"
 #include "Tudat/Astrodynamics/Relativity/relativisticAccelerationCorrection.h"
 #include "Tudat/Astrodynamics/BasicAstrodynamics/empiricalAcceleration.h"
+#include "Tudat/Astrodynamics/BasicAstrodynamics/automaticDifferentiationAcceleration.h"
 #include "Tudat/Astrodynamics/Propulsion/massRateFromThrust.h"
 
 namespace tudat
@@ -56,7 +57,8 @@ enum AvailableAcceleration
     thrust_acceleration,
     relativistic_correction_acceleration,
     empirical_acceleration,
-    direct_tidal_dissipation_acceleration
+    direct_tidal_dissipation_acceleration,
+    automatic_differentiation_acceleration
 };
 
 //! Function to get a string representing a 'named identification' of an acceleration type
@@ -0,0 +1,364 @@
+/*    Copyright (c) 2010-2017, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ */
+
+#ifndef TUDAT_AUTOMATICDIFFERENTIATIONACCELERATION_H
+#define TUDAT_AUTOMATICDIFFERENTIATIONACCELERATION_H
+
+#include <string>
+#include <vector>
+
+#include <boost/function.hpp>
+#include <boost/lambda/lambda.hpp>
+#include <boost/make_shared.hpp>
+
+#include <Eigen/Core>
+
+#include "Tudat/Astrodynamics/BasicAstrodynamics/accelerationModel.h"
+#include "Tudat/Mathematics/BasicMathematics/dualNumber.h"
+#include "Tudat/Basics/basicTypedefs.h"
+
+namespace tudat
+{
+
+namespace basic_astrodynamics
+{
+
+//! Base class for accelerations of which the partials are computed by forward-mode automatic differentiation.
+/*!
+ *  Base class for accelerations of which the partials are computed by forward-mode automatic differentiation. The
+ *  acceleration is a function of time, of the state of the accelerated body w.r.t. the accelerating body, and of a list
+ *  of scalar parameters. The updateMembers function computes only the acceleration, while the
+ *  updateAccelerationAndPartials function computes the acceleration, and its partials w.r.t. the relative state and
+ *  the parameters, in a single evaluation (using dual numbers). The derived class implements the actual evaluations.
+ */
+class AutomaticDifferentiationAcceleration: public AccelerationModel< Eigen::Vector3d >
+{
+public:
+
+    //! Constructor
+    /*!
+     *  Constructor
+     *  \param bodyStateFunction Function returning the state of the body undergoing the acceleration.
+     *  \param centralBodyStateFunction Function returning the state of the body exerting the acceleration.
+     *  \param parameterFunctions List of functions returning the current values of the scalar parameters on which
+     *  the acceleration depends.
+     */
+    AutomaticDifferentiationAcceleration(
+            const boost::function< Eigen::Vector6d( ) > bodyStateFunction,
+            const boost::function< Eigen::Vector6d( ) > centralBodyStateFunction,
+            const std::vector< boost::function< double( ) > >& parameterFunctions =
+            std::vector< boost::function< double( ) > >( ) ):
+        bodyStateFunction_( bodyStateFunction ), centralBodyStateFunction_( centralBodyStateFunction ),
+        parameterFunctions_( parameterFunctions ),
+        currentParameters_( Eigen::VectorXd::Zero( parameterFunctions.size( ) ) ),
+        currentPartials_( Eigen::MatrixXd::Zero( 3, 6 + parameterFunctions.size( ) ) ),
+        currentPartialsTime_( TUDAT_NAN ){ }
+
+    //! Destructor
+    virtual ~AutomaticDifferentiationAcceleration( ){ }
+
+    //! Function to retrieve the current acceleration
+    /*!
+     *  Function to retrieve the current acceleration, as set by last call to updateMembers or
+     *  updateAccelerationAndPartials function.
+     *  \return Current acceleration.
+     */
+    Eigen::Vector3d getAcceleration( )
+    {
+        return currentAcceleration_;
+    }
+
+    //! Function to update the acceleration to the current time
+    /*!
+     *  Function to update the acceleration to the current time. Partials are not computed by this function.
+     *  \param currentTime Time at which acceleration is to be computed.
+     */
+    void updateMembers( const double currentTime = TUDAT_NAN )
+    {
+        if( !( this->currentTime_ == currentTime ) )
+        {
+            updateRelativeStateAndParameters( );
+            currentAcceleration_ = computeAcceleration( currentTime );
+
+            this->currentTime_ = currentTime;
+        }
+    }
+
+    //! Function to update the acceleration and its partials to the current time
+    /*!
+     *  Function to update the acceleration, and its partials w.r.t. the relative state and the parameters, to the
+     *  current time, in a single evaluation of the acceleration with dual numbers.
+     *  \param currentTime Time at which acceleration and partials are to be computed.
+     */
+    void updateAccelerationAndPartials( const double currentTime = TUDAT_NAN )
+    {
+        if( !( currentPartialsTime_ == currentTime ) )
+        {
+            updateRelativeStateAndParameters( );
+            computeAccelerationAndPartials( currentTime );
+
+            this->currentTime_ = currentTime;
+            currentPartialsTime_ = currentTime;
+        }
+    }
+
+    //! Function to reset the current time of the acceleration model.
+    /*!
+     *  Function to reset the current time of the acceleration model (for both acceleration and partials).
+     *  \param currentTime Current time (default NaN).
+     */
+    void resetTime( const double currentTime = TUDAT_NAN )
+    {
+        this->currentTime_ = currentTime;
+        currentPartialsTime_ = currentTime;
+    }
+
+    //! Function to retrieve the current partials of the acceleration
+    /*!
+     *  Function to retrieve the current partials of the acceleration, as set by last call to
+     *  updateAccelerationAndPartials function. The first six columns contain the partials w.r.t. the state of the
+     *  accelerated body w.r.t. the accelerating body, the remaining columns the partials w.r.t. the parameters.
+     *  \return Current partials of the acceleration.
+     */
+    const Eigen::MatrixXd& getCurrentPartials( )
+    {
+        return currentPartials_;
+    }
+
+    //! Function to retrieve the number of scalar parameters on which the acceleration depends.
+    /*!
+     *  Function to retrieve the number of scalar parameters on which the acceleration depends.
+     *  \return Number of scalar parameters on which the acceleration depends.
+     */
+    int getNumberOfParameters( )
+    {
+        return static_cast< int >( parameterFunctions_.size( ) );
+    }
+
+    //! Function to retrieve the function returning the state of the body undergoing the acceleration.
+    /*!
+     *  Function to retrieve the function returning the state of the body undergoing the acceleration.
+     *  \return Function returning the state of the body undergoing the acceleration.
+     */
+    boost::function< Eigen::Vector6d( ) > getBodyStateFunction( )
+    {
+        return bodyStateFunction_;
+    }
+
+    //! Function to retrieve the function returning the state of the body exerting the acceleration.
+    /*!
+     *  Function to retrieve the function returning the state of the body exerting the acceleration.
+     *  \return Function returning the state of the body exerting the acceleration.
+     */
+    boost::function< Eigen::Vector6d( ) > getCentralBodyStateFunction( )
+    {
+        return centralBodyStateFunction_;
+    }
+
+protected:
+
+    //! Function to compute the acceleration from the current relative state and parameters.
+    /*!
+     *  Function to compute the acceleration from the current relative state and parameters.
+     *  \param currentTime Time at which acceleration is to be computed.
+     *  \return Acceleration at current time.
+     */
+    virtual Eigen::Vector3d computeAcceleration( const double currentTime ) = 0;
+
+    //! Function to compute the acceleration and its partials from the current relative state and parameters.
+    /*!
+     *  Function to compute the acceleration and its partials from the current relative state and parameters, and set
+     *  the results in the currentAcceleration_ and currentPartials_ members.
+     *  \param currentTime Time at which acceleration and partials are to be computed.
+     */
+    virtual void computeAccelerationAndPartials( const double currentTime ) = 0;
+
+    //! Function to retrieve the current relative state and parameter values from the environment.
+    void updateRelativeStateAndParameters( )
+    {
+        currentRelativeState_ = bodyStateFunction_( ) - centralBodyStateFunction_( );
+        for( unsigned int i = 0; i < parameterFunctions_.size( ); i++ )
+        {
+            currentParameters_( i ) = parameterFunctions_.at( i )( );
+        }
+    }
+
+    //! Function returning the state of the body undergoing the acceleration.
+    boost::function< Eigen::Vector6d( ) > bodyStateFunction_;
+
+    //! Function returning the state of the body exerting the acceleration.
+    boost::function< Eigen::Vector6d( ) > centralBodyStateFunction_;
+
+    //! List of functions returning the current values of the scalar parameters.
+    std::vector< boost::function< double( ) > > parameterFunctions_;
+
+    //! Current state of the body undergoing the acceleration, w.r.t. the body exerting the acceleration.
+    Eigen::Vector6d currentRelativeState_;
+
+    //! Current values of the scalar parameters.
+    Eigen::VectorXd currentParameters_;
+
+    //! Current acceleration.
+    Eigen::Vector3d currentAcceleration_;
+
+    //! Current partials of the acceleration w.r.t. the relative state (first six columns) and parameters.
+    Eigen::MatrixXd currentPartials_;
+
+    //! Time at which the partials were last computed.
+    double currentPartialsTime_;
+
+};
+
+//! Class for accelerations defined by a functor, of which the partials are computed by automatic differentiation.
+/*!
+ *  Class for accelerations defined by a functor, of which the partials are computed by forward-mode automatic
+ *  differentiation. The functor must define a member function template with signature
+ *  template< typename ScalarType > Eigen::Matrix< ScalarType, 3, 1 > operator( )(
+ *      const double time, const Eigen::Matrix< ScalarType, 6, 1 >& relativeState,
+ *      const Eigen::Matrix< ScalarType, NumberOfParameters, 1 >& parameters ) const
+ *  which is evaluated with ScalarType = double to compute only the acceleration, and with dual numbers to compute the
+ *  acceleration and its partials in a single evaluation.
+ *  \tparam AccelerationFunctor Type of functor defining the acceleration.
+ *  \tparam NumberOfParameters Number of scalar parameters on which the acceleration depends.
+ */
+template< typename AccelerationFunctor, int NumberOfParameters >
+class AutomaticDifferentiationAccelerationFromFunctor: public AutomaticDifferentiationAcceleration
+{
+public:
+
+    //! Typedef for dual number used to compute partials w.r.t. relative state and parameters.
+    typedef basic_mathematics::DualNumber< double, 6 + NumberOfParameters > PartialDualNumber;
+
+    //! Constructor
+    /*!
+     *  Constructor
+     *  \param accelerationFunctor Functor defining the acceleration.
+     *  \param bodyStateFunction Function returning the state of the body undergoing the acceleration.
+     *  \param centralBodyStateFunction Function returning the state of the body exerting the acceleration.
+     *  \param parameterFunctions List of functions returning the current values of the scalar parameters on which
+     *  the acceleration depends (size must be equal to NumberOfParameters).
+     */
+    AutomaticDifferentiationAccelerationFromFunctor(
+            const AccelerationFunctor& accelerationFunctor,
+            const boost::function< Eigen::Vector6d( ) > bodyStateFunction,
+            const boost::function< Eigen::Vector6d( ) > centralBodyStateFunction,
+            const std::vector< boost::function< double( ) > >& parameterFunctions =
+            std::vector< boost::function< double( ) > >( ) ):
+        AutomaticDifferentiationAcceleration( bodyStateFunction, centralBodyStateFunction, parameterFunctions ),
+        accelerationFunctor_( accelerationFunctor )
+    {
+        if( static_cast< int >( parameterFunctions.size( ) ) != NumberOfParameters )
+        {
+            throw std::runtime_error( "Error when creating automatic differentiation acceleration, expected " +
+                                      std::to_string( NumberOfParameters ) + " parameter functions, but received " +
+                                      std::to_string( parameterFunctions.size( ) ) );
+        }
+    }
+
+    //! Destructor
+    ~AutomaticDifferentiationAccelerationFromFunctor( ){ }
+
+    //! Function to retrieve the functor defining the acceleration.
+    /*!
+     *  Function to retrieve the functor defining the acceleration.
+     *  \return Functor defining the acceleration.
+     */
+    const AccelerationFunctor& getAccelerationFunctor( )
+    {
+        return accelerationFunctor_;
+    }
+
+protected:
+
+    //! Function to compute the acceleration from the current relative state and parameters.
+    /*!
+     *  Function to compute the acceleration from the current relative state and parameters, evaluating the functor
+     *  with double precision scalars.
+     *  \param currentTime Time at which acceleration is to be computed.
+     *  \return Acceleration at current time.
+     */
+    Eigen::Vector3d computeAcceleration( const double currentTime )
+    {
+        return accelerationFunctor_( currentTime, currentRelativeState_,
+                                     Eigen::Matrix< double, NumberOfParameters, 1 >( currentParameters_ ) );
+    }
+
+    //! Function to compute the acceleration and its partials from the current relative state and parameters.
+    /*!
+     *  Function to compute the acceleration and its partials from the current relative state and parameters,
+     *  evaluating the functor once with dual numbers, seeded by the relative state and the parameters.
+     *  \param currentTime Time at which acceleration and partials are to be computed.
+     */
+    void computeAccelerationAndPartials( const double currentTime )
+    {
+        for( int i = 0; i < 6; i++ )
+        {
+            dualRelativeState_( i ) = PartialDualNumber::createIndependentVariable( currentRelativeState_( i ), i );
+        }
+        for( int i = 0; i < NumberOfParameters; i++ )
+        {
+            dualParameters_( i ) = PartialDualNumber::createIndependentVariable( currentParameters_( i ), 6 + i );
+        }
+
+        Eigen::Matrix< PartialDualNumber, 3, 1 > dualAcceleration =
+                accelerationFunctor_( currentTime, dualRelativeState_, dualParameters_ );
+        for( int i = 0; i < 3; i++ )
+        {
+            currentAcceleration_( i ) = dualAcceleration( i ).getValue( );
+            currentPartials_.row( i ) = dualAcceleration( i ).getDerivatives( ).transpose( );
+        }
+    }
+
+    //! Functor defining the acceleration.
+    AccelerationFunctor accelerationFunctor_;
+
+    //! Relative state, as dual numbers seeded for automatic differentiation (set by computeAccelerationAndPartials).
+    Eigen::Matrix< PartialDualNumber, 6, 1 > dualRelativeState_;
+
+    //! Parameters, as dual numbers seeded for automatic differentiation (set by computeAccelerationAndPartials).
+    Eigen::Matrix< PartialDualNumber, NumberOfParameters, 1 > dualParameters_;
+
+public:
+
+    EIGEN_MAKE_ALIGNED_OPERATOR_NEW
+
+};
+
+//! Function to create an acceleration defined by a functor, of which the partials are computed by automatic
+//! differentiation.
+/*!
+ *  Function to create an acceleration defined by a functor, of which the partials are computed by automatic
+ *  differentiation (see AutomaticDifferentiationAccelerationFromFunctor for requirements on the functor).
+ *  \param accelerationFunctor Functor defining the acceleration.
+ *  \param bodyStateFunction Function returning the state of the body undergoing the acceleration.
+ *  \param centralBodyStateFunction Function returning the state of the body exerting the acceleration.
+ *  \param parameterFunctions List of functions returning the current values of the scalar parameters on which the
+ *  acceleration depends (size must be equal to NumberOfParameters).
+ *  \return Acceleration model computing its partials by automatic differentiation.
+ */
+template< int NumberOfParameters, typename AccelerationFunctor >
+boost::shared_ptr< AutomaticDifferentiationAcceleration > createAutomaticDifferentiationAcceleration(
+        const AccelerationFunctor& accelerationFunctor,
+        const boost::function< Eigen::Vector6d( ) > bodyStateFunction,
+        const boost::function< Eigen::Vector6d( ) > centralBodyStateFunction =
+        boost::lambda::constant( Eigen::Vector6d::Zero( ) ),
+        const std::vector< boost::function< double( ) > >& parameterFunctions =
+        std::vector< boost::function< double( ) > >( ) )
+{
+    return boost::make_shared< AutomaticDifferentiationAccelerationFromFunctor<
+            AccelerationFunctor, NumberOfParameters > >(
+                accelerationFunctor, bodyStateFunction, centralBodyStateFunction, parameterFunctions );
+}
+
+} // namespace basic_astrodynamics
+
+} // namespace tudat
+
+#endif // TUDAT_AUTOMATICDIFFERENTIATIONACCELERATION_H
@@ -11,7 +11,13 @@
 
 #define BOOST_TEST_MAIN
 
+#include <chrono>
+#include <ctime>
+#include <fstream>
+#include <iostream>
 #include <limits>
+#include <vector>
+#include <boost/filesystem.hpp>
 #include <boost/test/unit_test.hpp>
 #include <boost/make_shared.hpp>
 
@@ -230,6 +236,130 @@ BOOST_AUTO_TEST_CASE( testLeapSecondIdentification )
 
 
 
+//! Tests whether EOP data loaded from a binary cache file is identical to that read from the text file, whether the cache
+//! file is regenerated if it is inconsistent with the EOP file and settings.
+BOOST_AUTO_TEST_CASE( testEopReaderBinaryCache )
+{
+    const std::string textFileName =
+            tudat::input_output::getEarthOrientationDataFilesPath( ) + "eopc04_08_IAU2000.62-now.txt";
+    const std::string cacheFileName = ( boost::filesystem::temp_directory_path( ) /
+                                        boost::filesystem::unique_path( "eopCache%%%%%%%%.bin" ) ).string( );
+
+    // Read text file, and create binary cache file.
+    EOPReader textEopReader( textFileName, "C04", basic_astrodynamics::iau_2006, cacheFileName );
+
+    BOOST_CHECK( isBinaryEopCacheFile( cacheFileName ) );
+    BOOST_CHECK( !isBinaryEopCacheFile( textFileName ) );
+    std::time_t cacheWriteTime = boost::filesystem::last_write_time( cacheFileName );
+
+    // Load data from binary cache file
+    EOPReader cachedEopReader( textFileName, "C04", basic_astrodynamics::iau_2006, cacheFileName );
+
+    // Check first entry of file, and compare all text and cached data.
+    double arcSecondToRadian = 4.848136811095359935899141E-6;
+    BOOST_CHECK_EQUAL( textEopReader.getUt1MinusUtcMapRaw( ).begin( )->first, 37665.0 );
+    BOOST_CHECK_EQUAL( textEopReader.getUt1MinusUtcMapRaw( ).begin( )->second, 0.0326338 );
+    BOOST_CHECK_CLOSE_FRACTION( textEopReader.getCipInItrsMapRaw( ).begin( )->second.x( ),
+                                -0.012700 * arcSecondToRadian, 1.0E-15 );
+    BOOST_CHECK_EQUAL( textEopReader.getUt1MinusUtcMapRaw( ).size( ), 20363 );
+
+    BOOST_CHECK( textEopReader.getUt1MinusUtcMapRaw( ) == cachedEopReader.getUt1MinusUtcMapRaw( ) );
+    BOOST_CHECK( textEopReader.getLengthOfDayMapRaw( ) == cachedEopReader.getLengthOfDayMapRaw( ) );
+    BOOST_CHECK( textEopReader.getCipInItrsMapRaw( ) == cachedEopReader.getCipInItrsMapRaw( ) );
+    BOOST_CHECK( textEopReader.getCipInGcrsCorrectionMapRaw( ) == cachedEopReader.getCipInGcrsCorrectionMapRaw( ) );
+
+    // Check that cache file is not rewritten when it is used.
+    BOOST_CHECK_EQUAL( boost::filesystem::last_write_time( cacheFileName ), cacheWriteTime );
+
+    // Check that cache file is regenerated (and not used) for different nutation theory, different EOP file, or
+    // if it is truncated.
+    for( unsigned int test = 0; test < 3; test++ )
+    {
+        std::string eopFileName = textFileName;
+        basic_astrodynamics::IAUConventions nutationTheory = basic_astrodynamics::iau_2006;
+        std::vector< std::string > modifiedFileLines;
+        if( test == 0 )
+        {
+            nutationTheory = basic_astrodynamics::iau_2000_a;
+        }
+        else if( test == 1 )
+        {
+            // Create EOP file with modified first data line (the header of the C04 file is 14 lines long).
+            eopFileName = ( boost::filesystem::temp_directory_path( ) /
+                            boost::filesystem::unique_path( "eopFile%%%%%%%%.txt" ) ).string( );
+            std::ifstream textFile( textFileName.c_str( ) );
+            std::string line;
+            while( std::getline( textFile, line ) )
+            {
+                modifiedFileLines.push_back( line );
+            }
+            std::string& firstDataLine = modifiedFileLines.at( 14 );
+            firstDataLine.replace( firstDataLine.find( "0.0326338" ), 9, "0.0326339" );
+
+            std::ofstream modifiedFile( eopFileName.c_str( ) );
+            for( unsigned int i = 0; i < modifiedFileLines.size( ); i++ )
+            {
+                modifiedFile << modifiedFileLines.at( i ) << std::endl;
+            }
+        }
+        else
+        {
+            boost::filesystem::resize_file( cacheFileName, boost::filesystem::file_size( cacheFileName ) - 8 );
+        }
+
+        boost::filesystem::last_write_time( cacheFileName, cacheWriteTime - 10 );
+        EOPReader regeneratedEopReader( eopFileName, "C04", nutationTheory, cacheFileName );
+        BOOST_CHECK( boost::filesystem::last_write_time( cacheFileName ) != cacheWriteTime - 10 );
+
+        BOOST_CHECK( textEopReader.getLengthOfDayMapRaw( ) == regeneratedEopReader.getLengthOfDayMapRaw( ) );
+        if( test == 1 )
+        {
+            BOOST_CHECK_EQUAL( regeneratedEopReader.getUt1MinusUtcMapRaw( ).begin( )->second, 0.0326339 );
+        }
+        else
+        {
+            BOOST_CHECK( textEopReader.getUt1MinusUtcMapRaw( ) == regeneratedEopReader.getUt1MinusUtcMapRaw( ) );
+        }
+
+        // Check that regenerated cache file is used for the same settings.
+        cacheWriteTime = boost::filesystem::last_write_time( cacheFileName );
+        EOPReader recachedEopReader( eopFileName, "C04", nutationTheory, cacheFileName );
+        BOOST_CHECK_EQUAL( boost::filesystem::last_write_time( cacheFileName ), cacheWriteTime );
+        BOOST_CHECK( regeneratedEopReader.getUt1MinusUtcMapRaw( ) == recachedEopReader.getUt1MinusUtcMapRaw( ) );
+
+        if( test == 1 )
+        {
+            boost::filesystem::remove( eopFileName );
+        }
+    }
+
+    boost::filesystem::remove( cacheFileName );
+}
+
+#if COMPILE_UNIT_TEST_BENCHMARKS
+//! Compare loading times of EOP data from text file (creating the binary cache file) and from binary cache file.
+BOOST_AUTO_TEST_CASE( benchmarkEopReaderBinaryCache )
+{
+    const std::string textFileName =
+            tudat::input_output::getEarthOrientationDataFilesPath( ) + "eopc04_08_IAU2000.62-now.txt";
+    const std::string cacheFileName = ( boost::filesystem::temp_directory_path( ) /
+                                        boost::filesystem::unique_path( "eopCache%%%%%%%%.bin" ) ).string( );
+
+    std::chrono::steady_clock::time_point startTime = std::chrono::steady_clock::now( );
+    EOPReader textEopReader( textFileName, "C04", basic_astrodynamics::iau_2006, cacheFileName );
+    double textLoadTime = std::chrono::duration< double >( std::chrono::steady_clock::now( ) - startTime ).count( );
+
+    startTime = std::chrono::steady_clock::now( );
+    EOPReader cachedEopReader( textFileName, "C04", basic_astrodynamics::iau_2006, cacheFileName );
+    double cacheLoadTime = std::chrono::duration< double >( std::chrono::steady_clock::now( ) - startTime ).count( );
+
+    std::cout << "Loading EOP data: text file " << 1.0E3 * textLoadTime << " ms, binary cache "
+              << 1.0E3 * cacheLoadTime << " ms (speedup " << textLoadTime / cacheLoadTime << ")" << std::endl;
+
+    boost::filesystem::remove( cacheFileName );
+}
+#endif
+
 BOOST_AUTO_TEST_SUITE_END( )
 
 } // namespace unit_tests
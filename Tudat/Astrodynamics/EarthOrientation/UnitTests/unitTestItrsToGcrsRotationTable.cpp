@@ -0,0 +1,132 @@
+/*    Copyright (c) 2010-2017, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ *
+ */
+
+#define BOOST_TEST_MAIN
+
+#include <boost/bind.hpp>
+#include <boost/filesystem.hpp>
+#include <boost/make_shared.hpp>
+#include <boost/test/unit_test.hpp>
+
+#include "Tudat/Astrodynamics/EarthOrientation/itrsToGcrsRotationTable.h"
+
+namespace tudat
+{
+namespace unit_tests
+{
+
+using namespace tudat::earth_orientation;
+
+BOOST_AUTO_TEST_SUITE( test_itrs_to_gcrs_rotation_table )
+
+//! Test whether rotation from ITRS to GCRS evaluated from table is consistent with direct computation.
+BOOST_AUTO_TEST_CASE( testItrsToGcrsRotationTableAccuracy )
+{
+    boost::shared_ptr< EOPReader > eopReader = boost::make_shared< EOPReader >( );
+    boost::shared_ptr< EarthOrientationAnglesCalculator > earthOrientationCalculator =
+            createStandardEarthOrientationCalculator( eopReader );
+
+    // Create table of 5 days.
+    const double startTime = 3.0E8;
+    const double endTime = startTime + 5.0 * 86400.0;
+    const double maximumRotationError = 1.0E-12;
+    ItrsToGcrsRotationTable rotationTable(
+                boost::bind( &createStandardEarthOrientationCalculator, eopReader ), startTime, endTime,
+                maximumRotationError, basic_astrodynamics::tdb_scale );
+
+    BOOST_CHECK_EQUAL( rotationTable.getStartTime( ), startTime );
+    BOOST_CHECK( rotationTable.getEndTime( ) >= endTime );
+    BOOST_CHECK( rotationTable.getMaximumRotationError( ) <= maximumRotationError );
+    BOOST_CHECK_EQUAL( rotationTable.getTimeScale( ), basic_astrodynamics::tdb_scale );
+
+    // Compare tabulated and directly computed rotation (and rotation rate) at times not coinciding with table nodes.
+    const unsigned int numberOfTestTimes = 10000;
+    std::vector< double > testTimes;
+    for( unsigned int i = 0; i < numberOfTestTimes; i++ )
+    {
+        testTimes.push_back( startTime + ( endTime - startTime ) * ( static_cast< double >( i ) + 0.37 ) /
+                             static_cast< double >( numberOfTestTimes ) );
+    }
+
+    for( unsigned int i = 0; i < numberOfTestTimes; i++ )
+    {
+        std::pair< Eigen::Vector5d, double > rotationAngles =
+                earthOrientationCalculator->getRotationAnglesFromItrsToGcrs< double >(
+                    testTimes.at( i ), basic_astrodynamics::tdb_scale );
+        Eigen::Quaterniond directRotation = calculateRotationFromItrsToGcrs< double >(
+                    rotationAngles, testTimes.at( i ) );
+        Eigen::Matrix3d directRotationRate = calculateRotationRateFromItrsToGcrs< double >(
+                    rotationAngles, testTimes.at( i ) );
+
+        double rotationError = computeRotationAngleBetweenRotations(
+                    directRotation, rotationTable.getRotationFromItrsToGcrs( testTimes.at( i ) ) );
+        BOOST_CHECK_SMALL( rotationError, maximumRotationError );
+
+        // Direct rotation rate only includes the derivative of the Earth rotation angle.
+        BOOST_CHECK_SMALL(
+                    ( rotationTable.getRotationMatrixDerivativeFromItrsToGcrs( testTimes.at( i ) ) -
+                      directRotationRate ).norm( ) / directRotationRate.norm( ), 1.0E-6 );
+    }
+
+    // Check that evaluation outside table interval is not allowed.
+    BOOST_CHECK( !rotationTable.isTimeInTableInterval( startTime - 1.0 ) );
+    BOOST_CHECK_THROW( rotationTable.getRotationFromItrsToGcrs( startTime - 1.0 ), std::runtime_error );
+    BOOST_CHECK_THROW( rotationTable.getRotationFromItrsToGcrs( rotationTable.getEndTime( ) + 1.0 ),
+                       std::runtime_error );
+}
+
+//! Test whether rotation table is identical after saving it to, and loading it from, a binary file.
+BOOST_AUTO_TEST_CASE( testItrsToGcrsRotationTableFile )
+{
+    boost::shared_ptr< EOPReader > eopReader = boost::make_shared< EOPReader >( );
+
+    const double startTime = 3.0E8;
+    const double endTime = startTime + 86400.0;
+    ItrsToGcrsRotationTable rotationTable(
+                boost::bind( &createStandardEarthOrientationCalculator, eopReader ), startTime, endTime,
+                1.0E-11, basic_astrodynamics::tt_scale, 2, 1234567 );
+    BOOST_CHECK_EQUAL( rotationTable.getSourceDataHash( ), 1234567 );
+
+    // Save and load table.
+    std::string fileName = ( boost::filesystem::temp_directory_path( ) /
+                             boost::filesystem::unique_path( "itrsToGcrsRotationTable%%%%%%%%.bin" ) ).string( );
+    rotationTable.saveToFile( fileName );
+    {
+        ItrsToGcrsRotationTable loadedRotationTable( fileName );
+
+        BOOST_CHECK_EQUAL( loadedRotationTable.getStartTime( ), rotationTable.getStartTime( ) );
+        BOOST_CHECK_EQUAL( loadedRotationTable.getEndTime( ), rotationTable.getEndTime( ) );
+        BOOST_CHECK_EQUAL( loadedRotationTable.getTimeStep( ), rotationTable.getTimeStep( ) );
+        BOOST_CHECK_EQUAL( loadedRotationTable.getNumberOfNodes( ), rotationTable.getNumberOfNodes( ) );
+        BOOST_CHECK_EQUAL( loadedRotationTable.getMaximumRotationError( ),
+                           rotationTable.getMaximumRotationError( ) );
+        BOOST_CHECK_EQUAL( loadedRotationTable.getTimeScale( ), basic_astrodynamics::tt_scale );
+        BOOST_CHECK_EQUAL( loadedRotationTable.getSourceDataHash( ), rotationTable.getSourceDataHash( ) );
+
+        for( double currentTime = startTime; currentTime <= endTime; currentTime += 123.4 )
+        {
+            BOOST_CHECK( loadedRotationTable.getRotationFromItrsToGcrs( currentTime ).coeffs( ) ==
+                         rotationTable.getRotationFromItrsToGcrs( currentTime ).coeffs( ) );
+            BOOST_CHECK( loadedRotationTable.getRotationMatrixDerivativeFromItrsToGcrs( currentTime ) ==
+                         rotationTable.getRotationMatrixDerivativeFromItrsToGcrs( currentTime ) );
+        }
+    }
+    boost::filesystem::remove( fileName );
+
+    // Check that invalid files are rejected.
+    BOOST_CHECK_THROW( boost::make_shared< ItrsToGcrsRotationTable >( fileName ), std::runtime_error );
+}
+
+BOOST_AUTO_TEST_SUITE_END( )
+
+} // namespace unit_tests
+
+} // namespace tudat
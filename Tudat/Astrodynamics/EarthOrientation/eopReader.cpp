@@ -9,6 +9,14 @@
  *
  */
 
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+
+#include <boost/cstdint.hpp>
+#include <boost/interprocess/file_mapping.hpp>
+#include <boost/interprocess/mapped_region.hpp>
+
 #include "Tudat/Astrodynamics/BasicAstrodynamics/unitConversions.h"
 #include "Tudat/Astrodynamics/EarthOrientation/eopReader.h"
 
@@ -18,10 +26,28 @@ namespace tudat
 namespace earth_orientation
 {
 
+//! Identifier at start of binary EOP cache file.
+static const char binaryEopCacheFileIdentifier[ 8 ] = { 'T', 'U', 'D', 'A', 'T', 'E', 'O', 'P' };
+
+//! Version of binary EOP cache file format.
+static const int binaryEopCacheFileVersion = 2;
+
+//! Size (in bytes) of header of binary EOP cache file (identifier, version, nutation theory, number of entries, hash of
+//! EOP file contents, file format).
+static const std::size_t binaryEopCacheFileHeaderSize = 40;
+
+//! Maximum length of file format identifier stored in binary EOP cache file.
+static const std::size_t binaryEopCacheFileFormatLength = 8;
+
+//! Number of data columns (MJD, x_{p}, y_{p}, UT1-UTC, LOD, dX, dY) in binary EOP cache file.
+static const std::size_t numberOfBinaryEopCacheFileColumns = 7;
+
 //! Constructor
 EOPReader::EOPReader( const std::string& eopFile,
                       const std::string& format,
-                      const basic_astrodynamics::IAUConventions nutationTheory )
+                      const basic_astrodynamics::IAUConventions nutationTheory,
+                      const std::string& binaryCacheFile ):
+    eopFile_( eopFile ), format_( format ), nutationTheory_( nutationTheory )
 {
     if( format != "C04" )
     {
@@ -31,7 +57,78 @@ EOPReader::EOPReader( const std::string& eopFile,
     {
         std::cerr << ( "Warning, only IAU2000 nutation theory format currently supported by reader." ) << std::endl;
     }
+
+    // Load data from binary cache file, if it exists and is consistent with EOP file and settings.
+    if( binaryCacheFile != "" )
+    {
+        if( readBinaryEopCacheFile( binaryCacheFile, input_output::computeFileContentsHash( eopFile ) ) )
+        {
+            return;
+        }
+    }
+
     readEopFile( eopFile );
+
+    if( binaryCacheFile != "" )
+    {
+        saveToBinaryCacheFile( binaryCacheFile );
+    }
+}
+
+//! Function to save the EOP data to a binary cache file.
+void EOPReader::saveToBinaryCacheFile( const std::string& fileName )
+{
+    // Collect data in columns (all maps have identical keys).
+    const boost::uint64_t numberOfEntries = ut1MinusUtc.size( );
+    std::vector< double > columns( numberOfBinaryEopCacheFileColumns * numberOfEntries );
+    std::map< double, double >::const_iterator ut1Iterator = ut1MinusUtc.begin( );
+    std::map< double, double >::const_iterator lodIterator = lengthOfDayOffset.begin( );
+    std::map< double, Eigen::Vector2d >::const_iterator itrsIterator = cipInItrs.begin( );
+    std::map< double, Eigen::Vector2d >::const_iterator gcrsIterator = cipInGcrsCorrection.begin( );
+    for( std::size_t i = 0; i < numberOfEntries; i++ )
+    {
+        columns[ i ] = ut1Iterator->first;
+        columns[ numberOfEntries + i ] = itrsIterator->second.x( );
+        columns[ 2 * numberOfEntries + i ] = itrsIterator->second.y( );
+        columns[ 3 * numberOfEntries + i ] = ut1Iterator->second;
+        columns[ 4 * numberOfEntries + i ] = lodIterator->second;
+        columns[ 5 * numberOfEntries + i ] = gcrsIterator->second.x( );
+        columns[ 6 * numberOfEntries + i ] = gcrsIterator->second.y( );
+
+        ut1Iterator++;
+        lodIterator++;
+        itrsIterator++;
+        gcrsIterator++;
+    }
+
+    std::ofstream stream( fileName.c_str( ), std::ios::binary | std::ios::trunc );
+    if( !stream.good( ) )
+    {
+        throw std::runtime_error( "Error when writing binary EOP cache file, could not open file " + fileName );
+    }
+
+    if( format_.size( ) > binaryEopCacheFileFormatLength )
+    {
+        throw std::runtime_error( "Error when writing binary EOP cache file, file format " + format_ +
+                                  " cannot be stored." );
+    }
+    char format[ binaryEopCacheFileFormatLength ] = { };
+    std::memcpy( format, format_.data( ), format_.size( ) );
+    const int nutationTheory = static_cast< int >( nutationTheory_ );
+    const boost::uint64_t eopFileHash = input_output::computeFileContentsHash( eopFile_ );
+
+    stream.write( binaryEopCacheFileIdentifier, 8 );
+    stream.write( reinterpret_cast< const char* >( &binaryEopCacheFileVersion ), 4 );
+    stream.write( reinterpret_cast< const char* >( &nutationTheory ), 4 );
+    stream.write( reinterpret_cast< const char* >( &numberOfEntries ), 8 );
+    stream.write( reinterpret_cast< const char* >( &eopFileHash ), 8 );
+    stream.write( format, binaryEopCacheFileFormatLength );
+    stream.write( reinterpret_cast< const char* >( columns.data( ) ), sizeof( double ) * columns.size( ) );
+
+    if( !stream.good( ) )
+    {
+        throw std::runtime_error( "Error when writing binary EOP cache file, could not write file " + fileName );
+    }
 }
 
 //! Function to read EOP file
@@ -40,7 +137,7 @@ void EOPReader::readEopFile( const std::string& fileName )
     using namespace tudat::unit_conversions;
 
     // Open file and create file stream.
-    std::fstream stream( fileName.c_str( ), std::ios::in );
+    std::ifstream stream( fileName.c_str( ) );
 
     // Check if file opened correctly.
     if ( stream.fail( ) )
@@ -51,63 +148,184 @@ void EOPReader::readEopFile( const std::string& fileName )
     // Initialize boolean that gets set to true once the file header is passed.
     bool isHeaderPassed = 0;
 
-    // Line based parsing
+    // Data columns (MJD; x_{p}, y_{p}, UT1-UTC, LOD, dX, dY)
+    std::vector< double > modifiedJulianDays;
+    std::vector< std::vector< double > > eopData( 6 );
+
+    // Line based parsing, in which the start and end of (at most 17) entries on each line are determined in place, so
+    // that only the required entries of data lines are converted.
+    const unsigned int maximumNumberOfEntries = 17;
+    const char* entryStart[ maximumNumberOfEntries ];
+    const char* entryEnd[ maximumNumberOfEntries ];
     std::string line;
-    std::vector< std::string > vectorOfIndividualStrings;
-    while ( !stream.fail( ) && !stream.eof( ) )
+    while ( std::getline( stream, line ) )
     {
-        // Get line from stream
-        std::getline( stream, line );
-
-        // Trim input string (removes all leading and trailing whitespaces).
-        boost::algorithm::trim( line );
+        unsigned int numberOfEntries = 0;
+        const char* currentCharacter = line.c_str( );
+        while( numberOfEntries < maximumNumberOfEntries )
+        {
+            while( *currentCharacter == ' ' || *currentCharacter == '\t' || *currentCharacter == '\r' )
+            {
+                currentCharacter++;
+            }
+            if( *currentCharacter == '\0' )
+            {
+                break;
+            }
 
-        // Split string into multiple strings, each containing one element from a line from the
-        // data file.
-        boost::algorithm::split( vectorOfIndividualStrings,
-                                 line,
-                                 boost::algorithm::is_any_of( " " ),
-                                 boost::algorithm::token_compress_on );
+            entryStart[ numberOfEntries ] = currentCharacter;
+            while( *currentCharacter != '\0' && *currentCharacter != ' ' && *currentCharacter != '\t' &&
+                   *currentCharacter != '\r' )
+            {
+                currentCharacter++;
+            }
+            entryEnd[ numberOfEntries ] = currentCharacter;
+            numberOfEntries++;
+        }
 
         // If first line before data is found, check entry names and set isHeaderPassed to true.
-        if( !isHeaderPassed && vectorOfIndividualStrings[ 0 ] == "Date" )
+        if( !isHeaderPassed )
         {
-            if( vectorOfIndividualStrings[ 6 ] == "dPsi" )
+            if( numberOfEntries > 0 && std::string( entryStart[ 0 ], entryEnd[ 0 ] ) == "Date" )
             {
-                throw std::runtime_error( "Warning, found dPsi, expected dX as CIP offset in GCRS, wrong nutation format requested" );
+                if( numberOfEntries > 6 && std::string( entryStart[ 6 ], entryEnd[ 6 ] ) == "dPsi" )
+                {
+                    throw std::runtime_error( "Warning, found dPsi, expected dX as CIP offset in GCRS, wrong nutation format requested" );
+                }
+                else if( numberOfEntries > 7 && std::string( entryStart[ 7 ], entryEnd[ 7 ] ) == "dEps" )
+                {
+                    throw std::runtime_error( "Warning, found dEps, expected dY as CIP offset in GCRS, wrong nutation format requested" );
+                }
+
+                isHeaderPassed = 1;
             }
-            else if( vectorOfIndividualStrings[ 7 ] == "dEps" )
+        }
+        // Read line of data (MJD, pole position, UT1-UTC, LOD and precession-nutation corrections).
+        else if( numberOfEntries == 16 )
+        {
+            double lineData[ 7 ];
+            for( unsigned int i = 0; i < 7; i++ )
             {
-                throw std::runtime_error( "Warning, found dEps, expected dY as CIP offset in GCRS, wrong nutation format requested" );
+                char* parsedEntryEnd;
+                lineData[ i ] = std::strtod( entryStart[ i + 3 ], &parsedEntryEnd );
+                if( parsedEntryEnd != entryEnd[ i + 3 ] )
+                {
+                    throw std::runtime_error( "Error when reading EOP file " + fileName + ", could not parse line: " + line );
+                }
             }
 
-            isHeaderPassed = 1;
+            modifiedJulianDays.push_back( lineData[ 0 ] );
+            eopData[ 0 ].push_back( convertArcSecondsToRadians< double >( lineData[ 1 ] ) );
+            eopData[ 1 ].push_back( convertArcSecondsToRadians< double >( lineData[ 2 ] ) );
+            eopData[ 2 ].push_back( lineData[ 3 ] );
+            eopData[ 3 ].push_back( lineData[ 4 ] );
+            eopData[ 4 ].push_back( convertArcSecondsToRadians< double >( lineData[ 5 ] ) );
+            eopData[ 5 ].push_back( convertArcSecondsToRadians< double >( lineData[ 6 ] ) );
         }
+    }
 
-        // Read line of data and set values.
-        if( isHeaderPassed && vectorOfIndividualStrings.size( ) == 16 )
+    std::vector< const double* > eopDataPointers;
+    for( unsigned int i = 0; i < eopData.size( ); i++ )
+    {
+        eopDataPointers.push_back( eopData.at( i ).data( ) );
+    }
+    setEopDataMaps( modifiedJulianDays.data( ), eopDataPointers, modifiedJulianDays.size( ) );
+}
+
+//! Function to read binary EOP cache file
+bool EOPReader::readBinaryEopCacheFile( const std::string& fileName, const std::size_t eopFileHash )
+{
+    using namespace boost::interprocess;
+
+    // Read header, and check whether file is a binary EOP cache file.
+    std::size_t fileSize = 0;
+    char header[ binaryEopCacheFileHeaderSize ];
+    {
+        std::ifstream stream( fileName.c_str( ), std::ios::binary );
+        if( !stream.read( header, binaryEopCacheFileHeaderSize ) ||
+                std::memcmp( header, binaryEopCacheFileIdentifier, 8 ) != 0 )
         {
+            return false;
+        }
+        stream.seekg( 0, std::ios::end );
+        fileSize = static_cast< std::size_t >( stream.tellg( ) );
+    }
 
-            // Read pole positions.
-            cipInItrs[ std::stod( vectorOfIndividualStrings[ 3 ] ) ].x( ) =
-                    convertArcSecondsToRadians< double >( std::stod( vectorOfIndividualStrings[ 4 ] ) );
-            cipInItrs[ std::stod( vectorOfIndividualStrings[ 3 ] ) ].y( ) =
-                    convertArcSecondsToRadians< double >( std::stod( vectorOfIndividualStrings[ 5 ] ) );
+    int fileVersion, nutationTheory;
+    boost::uint64_t numberOfEntries, fileEopFileHash;
+    std::memcpy( &fileVersion, header + 8, 4 );
+    std::memcpy( &nutationTheory, header + 12, 4 );
+    std::memcpy( &numberOfEntries, header + 16, 8 );
+    std::memcpy( &fileEopFileHash, header + 24, 8 );
+    std::string format( header + 32, binaryEopCacheFileFormatLength );
+    format = format.substr( 0, format.find( '\0' ) );
 
-            // Read UTC-UT1 and LOD corrections
-            ut1MinusUtc[ std::stod( vectorOfIndividualStrings[ 3 ] ) ] =
-                    std::stod( vectorOfIndividualStrings[ 6 ] );
-            lengthOfDayOffset[ std::stod( vectorOfIndividualStrings[ 3 ] ) ] =
-                    std::stod( vectorOfIndividualStrings[ 7 ] );
+    // Check whether file was written for the same EOP file and settings, and has the size given by its header.
+    if( fileVersion != binaryEopCacheFileVersion ||
+            nutationTheory != static_cast< int >( nutationTheory_ ) || format != format_ ||
+            fileEopFileHash != static_cast< boost::uint64_t >( eopFileHash ) ||
+            fileSize != binaryEopCacheFileHeaderSize +
+            sizeof( double ) * numberOfBinaryEopCacheFileColumns * numberOfEntries )
+    {
+        return false;
+    }
 
-            // Read precession-nutation corrections.
-            cipInGcrsCorrection[ std::stod( vectorOfIndividualStrings[ 3 ] ) ].x( ) =
-                    convertArcSecondsToRadians< double >( std::stod( vectorOfIndividualStrings[ 8 ] ) );
-            cipInGcrsCorrection[ std::stod( vectorOfIndividualStrings[ 3 ] ) ].y( ) =
-                    convertArcSecondsToRadians< double >( std::stod( vectorOfIndividualStrings[ 9 ] ) );
+    if( numberOfEntries > 0 )
+    {
+        try
+        {
+            file_mapping eopCacheFile( fileName.c_str( ), read_only );
+            mapped_region mappedEopData( eopCacheFile, read_only );
 
+            const double* modifiedJulianDays = reinterpret_cast< const double* >(
+                        static_cast< const char* >( mappedEopData.get_address( ) ) + binaryEopCacheFileHeaderSize );
+            std::vector< const double* > eopDataPointers;
+            for( unsigned int i = 1; i < numberOfBinaryEopCacheFileColumns; i++ )
+            {
+                eopDataPointers.push_back( modifiedJulianDays + i * numberOfEntries );
+            }
+            setEopDataMaps( modifiedJulianDays, eopDataPointers, numberOfEntries );
         }
+        catch( const interprocess_exception& caughtException )
+        {
+            throw std::runtime_error( "Error when reading binary EOP cache file " + fileName +
+                                      ", could not map file: " + caughtException.what( ) );
+        }
+    }
+
+    return true;
+}
+
+//! Function to set the EOP data maps from columns of EOP data.
+void EOPReader::setEopDataMaps( const double* modifiedJulianDays, const std::vector< const double* >& eopData,
+                                const std::size_t numberOfEntries )
+{
+    // Data is (in general) sorted by date, so that each entry is inserted at the end of the maps. Entries with identical
+    // dates replace earlier entries.
+    for( std::size_t i = 0; i < numberOfEntries; i++ )
+    {
+        const double currentDay = modifiedJulianDays[ i ];
+        cipInItrs.insert( cipInItrs.end( ), std::make_pair( currentDay, Eigen::Vector2d::Zero( ) ) )->second =
+                Eigen::Vector2d( eopData[ 0 ][ i ], eopData[ 1 ][ i ] );
+        ut1MinusUtc.insert( ut1MinusUtc.end( ), std::make_pair( currentDay, 0.0 ) )->second = eopData[ 2 ][ i ];
+        lengthOfDayOffset.insert( lengthOfDayOffset.end( ), std::make_pair( currentDay, 0.0 ) )->second =
+                eopData[ 3 ][ i ];
+        cipInGcrsCorrection.insert(
+                    cipInGcrsCorrection.end( ), std::make_pair( currentDay, Eigen::Vector2d::Zero( ) ) )->second =
+                Eigen::Vector2d( eopData[ 4 ][ i ], eopData[ 5 ][ i ] );
+    }
+}
+
+//! Function to check whether a file is a binary EOP cache file
+bool isBinaryEopCacheFile( const std::string& fileName )
+{
+    std::ifstream stream( fileName.c_str( ), std::ios::binary );
+    char identifier[ 8 ];
+    if( !stream.read( identifier, 8 ) )
+    {
+        return false;
     }
+    return ( std::memcmp( identifier, binaryEopCacheFileIdentifier, 8 ) == 0 );
 }
 
 }
@@ -14,6 +14,7 @@
 
 #include <map>
 #include <string>
+#include <vector>
 #include <boost/algorithm/string.hpp>
 #include <boost/algorithm/string/trim.hpp>
 #include <Eigen/Core>
@@ -41,15 +42,20 @@ public:
 
     //! Constructor
     /*!
-     * Constructor
+     * Constructor. If a binary cache file is provided, the EOP data is loaded from this file if it exists, and if it was
+     * written (by saveToBinaryCacheFile) for the same file format, nutation theory and EOP file contents. Otherwise, the
+     * EOP file is read, and the binary cache file is (re)written, so that the text file need not be parsed in later runs.
      * \param eopFile Name of EOP file that is to be used
      * \param format Identifier for file format that is provied
      * \param nutationTheory Nutation theory w.r.t. which the EOP data is given.
+     * \param binaryCacheFile Name of binary cache file from which the EOP data is loaded, or to which it is saved (none
+     * if empty).
      */
     EOPReader(
             const std::string& eopFile = tudat::input_output::getEarthOrientationDataFilesPath( ) + "eopc04_08_IAU2000.62-now.txt",
             const std::string& format = "C04",
-            const basic_astrodynamics::IAUConventions nutationTheory = basic_astrodynamics::iau_2006 );
+            const basic_astrodynamics::IAUConventions nutationTheory = basic_astrodynamics::iau_2006,
+            const std::string& binaryCacheFile = "" );
 
     //! Function to retrieve the data of UT1-UTC, as provided in the EOP file.
     std::map< double, double > getUt1MinusUtcMapRaw( )
@@ -139,15 +145,55 @@ public:
 
     }
 
+    //! Function to save the EOP data to a binary cache file.
+    /*!
+     * Function to save the EOP data (as converted from the text file) to a binary cache file, which may be loaded in later
+     * runs by providing it to the constructor, avoiding the parsing of the text file. The file format, nutation theory
+     * and a hash of the contents of the EOP file are stored in the cache file, and checked when loading it.
+     * \param fileName Name of binary cache file that is to be written.
+     */
+    void saveToBinaryCacheFile( const std::string& fileName );
+
 private:
 
     //! Function to read EOP file
     /*!
-     * Function to read EOP file
+     * Function to read EOP file, parsing each data line once, and storing the data in columns before creating the
+     * data maps.
      * \param fileName EOP file name.
      */
     void readEopFile( const std::string& fileName );
 
+    //! Function to read binary EOP cache file
+    /*!
+     * Function to read binary EOP cache file, as written by saveToBinaryCacheFile, by memory-mapping the file and
+     * creating the data maps directly from its columns. The data is only read if the file is a valid binary EOP cache
+     * file, written for the file format, nutation theory and EOP file contents of this object.
+     * \param fileName Binary EOP cache file name.
+     * \param eopFileHash Hash of the contents of the EOP file (see input_output::computeFileContentsHash).
+     * \return True if the data was read from the binary cache file.
+     */
+    bool readBinaryEopCacheFile( const std::string& fileName, const std::size_t eopFileHash );
+
+    //! Function to set the EOP data maps from columns of EOP data.
+    /*!
+     * Function to set the EOP data maps from columns of EOP data.
+     * \param modifiedJulianDays Modified Julian days at which the EOP data is given.
+     * \param eopData Pointers to columns (x_{p}, y_{p}, UT1-UTC, LOD, dX, dY; angles in radians) of EOP data.
+     * \param numberOfEntries Number of entries in each column.
+     */
+    void setEopDataMaps( const double* modifiedJulianDays, const std::vector< const double* >& eopData,
+                         const std::size_t numberOfEntries );
+
+    //! Name of EOP file that is used
+    std::string eopFile_;
+
+    //! Identifier for file format of EOP file
+    std::string format_;
+
+    //! Nutation theory w.r.t. which the EOP data is given.
+    basic_astrodynamics::IAUConventions nutationTheory_;
+
     //! Terrestrial pole position corrections (CIP in ITRS; polar motion), read from file
     std::map< double, Eigen::Vector2d > cipInItrs;
 
@@ -162,6 +208,14 @@ private:
 
 };
 
+//! Function to check whether a file is a binary EOP cache file
+/*!
+ * Function to check whether a file is a binary EOP cache file, as written by EOPReader::saveToBinaryCacheFile.
+ * \param fileName Name of file that is to be checked.
+ * \return True if file exists and starts with the binary EOP cache file identifier.
+ */
+bool isBinaryEopCacheFile( const std::string& fileName );
+
 }
 
 }
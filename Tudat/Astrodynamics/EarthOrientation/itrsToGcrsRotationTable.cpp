@@ -0,0 +1,403 @@
+/*    Copyright (c) 2010-2017, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ *
+ */
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <fstream>
+#include <stdexcept>
+
+#include <boost/bind.hpp>
+#include <boost/make_shared.hpp>
+#include <boost/interprocess/file_mapping.hpp>
+
+#include "Tudat/Basics/parallelComputation.h"
+#include "Tudat/Astrodynamics/BasicAstrodynamics/physicalConstants.h"
+#include "Tudat/Mathematics/BasicMathematics/mathematicalConstants.h"
+#include "Tudat/Mathematics/BasicMathematics/linearAlgebra.h"
+#include "Tudat/Astrodynamics/EarthOrientation/itrsToGcrsRotationTable.h"
+
+namespace tudat
+{
+
+namespace earth_orientation
+{
+
+//! Identifier at start of binary rotation table file.
+static const char rotationTableFileIdentifier[ 8 ] = { 'T', 'U', 'D', 'A', 'T', 'R', 'O', 'T' };
+
+//! Version of binary rotation table file format.
+static const int rotationTableFileVersion = 2;
+
+//! Size (in bytes) of header of binary rotation table file (identifier, version, time scale, start time, time step,
+//! number of entries, maximum rotation error, source data hash).
+static const std::size_t rotationTableFileHeaderSize = 56;
+
+//! Number of values stored per table entry (rotation quaternion and its time derivative).
+static const unsigned int numberOfValuesPerTableEntry = 8;
+
+//! Maximum number of times the time step is halved if the requested accuracy is not reached.
+static const unsigned int maximumNumberOfTimeStepReductions = 4;
+
+//! Constructor, generates the rotation table.
+ItrsToGcrsRotationTable::ItrsToGcrsRotationTable(
+        const boost::function< boost::shared_ptr< EarthOrientationAnglesCalculator >( ) >
+        earthOrientationCalculatorCreationFunction,
+        const double startTime,
+        const double endTime,
+        const double maximumRotationError,
+        const basic_astrodynamics::TimeScales timeScale,
+        const unsigned int numberOfThreads,
+        const std::size_t sourceDataHash ):
+    startTime_( startTime ), timeScale_( timeScale ), sourceDataHash_( sourceDataHash )
+{
+    if( !( endTime > startTime ) )
+    {
+        throw std::runtime_error( "Error when creating ITRS to GCRS rotation table, end time must be after start time." );
+    }
+
+    if( !( maximumRotationError > 0.0 ) )
+    {
+        throw std::runtime_error( "Error when creating ITRS to GCRS rotation table, maximum rotation error must be "
+                                  "positive." );
+    }
+
+    // Create Earth orientation calculator for each thread.
+    std::vector< boost::shared_ptr< EarthOrientationAnglesCalculator > > earthOrientationCalculators;
+    for( unsigned int i = 0; i < utilities::getNumberOfThreadsToUse( numberOfThreads ); i++ )
+    {
+        earthOrientationCalculators.push_back( earthOrientationCalculatorCreationFunction( ) );
+    }
+
+    // Estimate time step from interpolation error of cubic Hermite polynomial, for quaternion coefficients varying at
+    // half the Earth rotation rate. The fourth-order error term is parallel to the quaternion itself (and is removed by
+    // normalization), so that the rotation angle error is dominated by a fifth-order term.
+    const double halfEarthRotationRate =
+            0.5 * 2.0 * mathematical_constants::PI / physical_constants::JULIAN_DAY * 1.00273781191135448;
+    double timeStep = std::min( std::pow( 1000.0 * maximumRotationError, 0.2 ) / halfEarthRotationRate,
+                                endTime - startTime );
+
+    // Generate table, and reduce time step until required accuracy is reached.
+    for( unsigned int i = 0; i <= maximumNumberOfTimeStepReductions; i++ )
+    {
+        // Set time step such that table ends at requested end time.
+        double numberOfIntervals = std::ceil( ( endTime - startTime ) / timeStep );
+        numberOfNodes_ = static_cast< unsigned int >( numberOfIntervals ) + 1;
+        timeStep_ = ( endTime - startTime ) / numberOfIntervals;
+
+        computeTableEntries( earthOrientationCalculators );
+        maximumRotationError_ = computeMaximumRotationError( earthOrientationCalculators );
+
+        if( maximumRotationError_ <= maximumRotationError )
+        {
+            break;
+        }
+        else if( i == maximumNumberOfTimeStepReductions )
+        {
+            throw std::runtime_error( "Error when creating ITRS to GCRS rotation table, maximum rotation error " +
+                                      std::to_string( maximumRotationError ) + " not reached (" +
+                                      std::to_string( maximumRotationError_ ) + " with time step " +
+                                      std::to_string( timeStep_ ) + ")." );
+        }
+        timeStep = 0.5 * timeStep_;
+    }
+}
+
+//! Constructor, memory-maps the rotation table from a binary file.
+ItrsToGcrsRotationTable::ItrsToGcrsRotationTable( const std::string& fileName )
+{
+    // Map file into memory.
+    try
+    {
+        boost::interprocess::file_mapping tableFile( fileName.c_str( ), boost::interprocess::read_only );
+        mappedTableFile_ = boost::make_shared< boost::interprocess::mapped_region >(
+                    tableFile, boost::interprocess::read_only );
+    }
+    catch( boost::interprocess::interprocess_exception& caughtException )
+    {
+        throw std::runtime_error( "Error when loading ITRS to GCRS rotation table, could not map file " + fileName +
+                                  ": " + caughtException.what( ) );
+    }
+
+    // Read and check header.
+    const char* fileData = static_cast< const char* >( mappedTableFile_->get_address( ) );
+    if( mappedTableFile_->get_size( ) < rotationTableFileHeaderSize ||
+            std::memcmp( fileData, rotationTableFileIdentifier, 8 ) != 0 )
+    {
+        throw std::runtime_error( "Error when loading ITRS to GCRS rotation table, file " + fileName +
+                                  " is not a rotation table file." );
+    }
+
+    int fileVersion, timeScale;
+    unsigned long long numberOfNodes, sourceDataHash;
+    std::memcpy( &fileVersion, fileData + 8, 4 );
+    std::memcpy( &timeScale, fileData + 12, 4 );
+    std::memcpy( &startTime_, fileData + 16, 8 );
+    std::memcpy( &timeStep_, fileData + 24, 8 );
+    std::memcpy( &numberOfNodes, fileData + 32, 8 );
+    std::memcpy( &maximumRotationError_, fileData + 40, 8 );
+    std::memcpy( &sourceDataHash, fileData + 48, 8 );
+
+    if( fileVersion != rotationTableFileVersion )
+    {
+        throw std::runtime_error( "Error when loading ITRS to GCRS rotation table, file " + fileName +
+                                  " has unsupported version " + std::to_string( fileVersion ) + "." );
+    }
+
+    if( numberOfNodes < 2 || mappedTableFile_->get_size( ) != rotationTableFileHeaderSize +
+            numberOfNodes * numberOfValuesPerTableEntry * sizeof( double ) )
+    {
+        throw std::runtime_error( "Error when loading ITRS to GCRS rotation table, size of file " + fileName +
+                                  " is inconsistent with its header." );
+    }
+
+    timeScale_ = static_cast< basic_astrodynamics::TimeScales >( timeScale );
+    numberOfNodes_ = static_cast< unsigned int >( numberOfNodes );
+    sourceDataHash_ = static_cast< std::size_t >( sourceDataHash );
+}
+
+//! Function to save the rotation table to a binary file.
+void ItrsToGcrsRotationTable::saveToFile( const std::string& fileName ) const
+{
+    std::ofstream tableFile( fileName.c_str( ), std::ios::binary | std::ios::trunc );
+    if( !tableFile.good( ) )
+    {
+        throw std::runtime_error( "Error when saving ITRS to GCRS rotation table, could not open file " + fileName );
+    }
+
+    // Write header.
+    const int timeScale = static_cast< int >( timeScale_ );
+    const unsigned long long numberOfNodes = numberOfNodes_;
+    const unsigned long long sourceDataHash = sourceDataHash_;
+    tableFile.write( rotationTableFileIdentifier, 8 );
+    tableFile.write( reinterpret_cast< const char* >( &rotationTableFileVersion ), 4 );
+    tableFile.write( reinterpret_cast< const char* >( &timeScale ), 4 );
+    tableFile.write( reinterpret_cast< const char* >( &startTime_ ), 8 );
+    tableFile.write( reinterpret_cast< const char* >( &timeStep_ ), 8 );
+    tableFile.write( reinterpret_cast< const char* >( &numberOfNodes ), 8 );
+    tableFile.write( reinterpret_cast< const char* >( &maximumRotationError_ ), 8 );
+    tableFile.write( reinterpret_cast< const char* >( &sourceDataHash ), 8 );
+
+    // Write table entries.
+    tableFile.write( reinterpret_cast< const char* >( getTableEntriesData( ) ),
+                     static_cast< std::streamsize >(
+                         numberOfNodes_ * numberOfValuesPerTableEntry * sizeof( double ) ) );
+
+    if( !tableFile.good( ) )
+    {
+        throw std::runtime_error( "Error when saving ITRS to GCRS rotation table, could not write file " + fileName );
+    }
+}
+
+//! Function to compute the rotation from ITRS to GCRS.
+Eigen::Quaterniond ItrsToGcrsRotationTable::getRotationFromItrsToGcrs( const double time ) const
+{
+    Eigen::Vector4d rotationQuaternion, rotationQuaternionDerivative;
+    interpolateRotationQuaternion( time, rotationQuaternion, rotationQuaternionDerivative );
+    return Eigen::Quaterniond( rotationQuaternion ).normalized( );
+}
+
+//! Function to compute the time derivative of the rotation matrix from ITRS to GCRS.
+Eigen::Matrix3d ItrsToGcrsRotationTable::getRotationMatrixDerivativeFromItrsToGcrs( const double time ) const
+{
+    Eigen::Vector4d rotationQuaternion, rotationQuaternionDerivative;
+    interpolateRotationQuaternion( time, rotationQuaternion, rotationQuaternionDerivative );
+
+    // Compute angular velocity (in GCRS) from quaternion and its derivative, and compute derivative of rotation matrix
+    const double quaternionNorm = rotationQuaternion.norm( );
+    Eigen::Quaterniond normalizedRotation = Eigen::Quaterniond( rotationQuaternion / quaternionNorm );
+    Eigen::Vector3d angularVelocity =
+            2.0 * ( Eigen::Quaterniond( rotationQuaternionDerivative / quaternionNorm ) *
+                    normalizedRotation.conjugate( ) ).vec( );
+
+    return linear_algebra::getCrossProductMatrix( angularVelocity ) * normalizedRotation.toRotationMatrix( );
+}
+
+//! Function to compute the table entries for the current time step.
+void ItrsToGcrsRotationTable::computeTableEntries(
+        const std::vector< boost::shared_ptr< EarthOrientationAnglesCalculator > >& earthOrientationCalculators )
+{
+    // Compute slowly varying rotations, and Earth rotation angle, at each node, and at one additional node before/after
+    // the table (for central differences).
+    Eigen::Matrix< double, 4, Eigen::Dynamic > precessionNutationRotations( 4, numberOfNodes_ + 2 );
+    Eigen::Matrix< double, 4, Eigen::Dynamic > polarMotionRotations( 4, numberOfNodes_ + 2 );
+    Eigen::VectorXd earthRotationAngles( numberOfNodes_ + 2 );
+    Eigen::VectorXd ut1MinusTimes( numberOfNodes_ + 2 );
+
+    utilities::executeParallelLoopWithThreadIndex(
+                numberOfNodes_ + 2, earthOrientationCalculators.size( ),
+                boost::bind( &ItrsToGcrsRotationTable::computeNodeRotationAngles, this, _1, _2,
+                             boost::cref( earthOrientationCalculators ), boost::ref( precessionNutationRotations ),
+                             boost::ref( polarMotionRotations ), boost::ref( earthRotationAngles ),
+                             boost::ref( ut1MinusTimes ) ) );
+
+    // Compute rotation quaternion, and its time derivative, at each node.
+    const double earthRotationRate =
+            2.0 * mathematical_constants::PI / physical_constants::JULIAN_DAY * 1.00273781191135448;
+    tableEntries_.resize( numberOfNodes_ * numberOfValuesPerTableEntry );
+    mappedTableFile_.reset( );
+    for( unsigned int i = 0; i < numberOfNodes_; i++ )
+    {
+        Eigen::Quaterniond precessionNutationRotation( precessionNutationRotations.col( i + 1 ) );
+        Eigen::Quaterniond precessionNutationRotationDerivative(
+                    ( precessionNutationRotations.col( i + 2 ) - precessionNutationRotations.col( i ) ) /
+                    ( 2.0 * timeStep_ ) );
+        Eigen::Quaterniond polarMotionRotation( polarMotionRotations.col( i + 1 ) );
+        Eigen::Quaterniond polarMotionRotationDerivative(
+                    ( polarMotionRotations.col( i + 2 ) - polarMotionRotations.col( i ) ) / ( 2.0 * timeStep_ ) );
+
+        const double earthRotationAngle = earthRotationAngles( i + 1 );
+        const double earthRotationAngleRate = earthRotationRate *
+                ( 1.0 + ( ut1MinusTimes( i + 2 ) - ut1MinusTimes( i ) ) / ( 2.0 * timeStep_ ) );
+        Eigen::Quaterniond earthRotation = calculateRotationFromTirsToCirs( earthRotationAngle );
+        Eigen::Quaterniond earthRotationDerivative(
+                    -0.5 * earthRotationAngleRate * std::sin( 0.5 * earthRotationAngle ), 0.0, 0.0,
+                    0.5 * earthRotationAngleRate * std::cos( 0.5 * earthRotationAngle ) );
+
+        Eigen::Quaterniond rotation = precessionNutationRotation * earthRotation * polarMotionRotation;
+        Eigen::Vector4d rotationDerivative =
+                ( precessionNutationRotationDerivative * earthRotation * polarMotionRotation ).coeffs( ) +
+                ( precessionNutationRotation * earthRotationDerivative * polarMotionRotation ).coeffs( ) +
+                ( precessionNutationRotation * earthRotation * polarMotionRotationDerivative ).coeffs( );
+
+        // Ensure continuity of quaternion coefficients between subsequent nodes.
+        double sign = 1.0;
+        if( i > 0 && rotation.coeffs( ).dot(
+                    Eigen::Map< const Eigen::Vector4d >(
+                        &tableEntries_[ ( i - 1 ) * numberOfValuesPerTableEntry ] ) ) < 0.0 )
+        {
+            sign = -1.0;
+        }
+
+        Eigen::Map< Eigen::Vector4d > tableRotation( &tableEntries_[ i * numberOfValuesPerTableEntry ] );
+        Eigen::Map< Eigen::Vector4d > tableRotationDerivative( &tableEntries_[ i * numberOfValuesPerTableEntry + 4 ] );
+        tableRotation = sign * rotation.coeffs( );
+        tableRotationDerivative = sign * rotationDerivative;
+    }
+}
+
+//! Function to compute the maximum rotation error of the table.
+double ItrsToGcrsRotationTable::computeMaximumRotationError(
+        const std::vector< boost::shared_ptr< EarthOrientationAnglesCalculator > >& earthOrientationCalculators )
+{
+    std::vector< double > rotationErrors( numberOfNodes_ - 1 );
+    utilities::executeParallelLoopWithThreadIndex(
+                numberOfNodes_ - 1, earthOrientationCalculators.size( ),
+                boost::bind( &ItrsToGcrsRotationTable::computeIntervalRotationError, this, _1, _2,
+                             boost::cref( earthOrientationCalculators ), boost::ref( rotationErrors ) ) );
+
+    return *std::max_element( rotationErrors.begin( ), rotationErrors.end( ) );
+}
+
+//! Function to compute the slowly varying rotations and Earth rotation angle at a single node.
+void ItrsToGcrsRotationTable::computeNodeRotationAngles(
+        const unsigned int nodeIndex, const unsigned int threadIndex,
+        const std::vector< boost::shared_ptr< EarthOrientationAnglesCalculator > >& earthOrientationCalculators,
+        Eigen::Matrix< double, 4, Eigen::Dynamic >& precessionNutationRotations,
+        Eigen::Matrix< double, 4, Eigen::Dynamic >& polarMotionRotations,
+        Eigen::VectorXd& earthRotationAngles,
+        Eigen::VectorXd& ut1MinusTimes ) const
+{
+    double currentTime = startTime_ + ( static_cast< double >( nodeIndex ) - 1.0 ) * timeStep_;
+    std::pair< Eigen::Vector5d, double > rotationAngles =
+            earthOrientationCalculators.at( threadIndex )->getRotationAnglesFromItrsToGcrs< double >(
+                currentTime, timeScale_ );
+
+    precessionNutationRotations.col( nodeIndex ) = calculateRotationFromCirsToGcrs(
+                rotationAngles.first[ 0 ], rotationAngles.first[ 1 ], rotationAngles.first[ 2 ] ).coeffs( );
+    polarMotionRotations.col( nodeIndex ) = calculateRotationFromItrsToTirs(
+                rotationAngles.first[ 3 ], rotationAngles.first[ 4 ],
+                getApproximateTioLocator( currentTime ) ).coeffs( );
+    earthRotationAngles( nodeIndex ) =
+            sofa_interface::calculateEarthRotationAngleTemplated< double >( rotationAngles.second );
+    ut1MinusTimes( nodeIndex ) = rotationAngles.second - currentTime;
+}
+
+//! Function to compute the rotation error of the table at the middle of a single table interval.
+void ItrsToGcrsRotationTable::computeIntervalRotationError(
+        const unsigned int intervalIndex, const unsigned int threadIndex,
+        const std::vector< boost::shared_ptr< EarthOrientationAnglesCalculator > >& earthOrientationCalculators,
+        std::vector< double >& rotationErrors ) const
+{
+    double currentTime = startTime_ + ( static_cast< double >( intervalIndex ) + 0.5 ) * timeStep_;
+    Eigen::Quaterniond directRotation = calculateRotationFromItrsToGcrs< double >(
+                earthOrientationCalculators.at( threadIndex )->getRotationAnglesFromItrsToGcrs< double >(
+                    currentTime, timeScale_ ), currentTime );
+    rotationErrors[ intervalIndex ] = computeRotationAngleBetweenRotations(
+                directRotation, getRotationFromItrsToGcrs( currentTime ) );
+}
+
+//! Function to retrieve pointer to first table entry.
+const double* ItrsToGcrsRotationTable::getTableEntriesData( ) const
+{
+    if( mappedTableFile_ != NULL )
+    {
+        return reinterpret_cast< const double* >(
+                    static_cast< const char* >( mappedTableFile_->get_address( ) ) + rotationTableFileHeaderSize );
+    }
+    else
+    {
+        return tableEntries_.data( );
+    }
+}
+
+//! Function to interpolate the rotation quaternion and its time derivative from the table.
+void ItrsToGcrsRotationTable::interpolateRotationQuaternion( const double time,
+                                                             Eigen::Vector4d& rotationQuaternion,
+                                                             Eigen::Vector4d& rotationQuaternionDerivative ) const
+{
+    if( !isTimeInTableInterval( time ) )
+    {
+        throw std::runtime_error( "Error when interpolating ITRS to GCRS rotation table, time " +
+                                  std::to_string( time ) + " is outside table interval [" +
+                                  std::to_string( startTime_ ) + ", " + std::to_string( getEndTime( ) ) + "]." );
+    }
+
+    // Find table interval and normalized time in interval.
+    const double scaledTime = ( time - startTime_ ) / timeStep_;
+    unsigned int lowerIndex = std::min( static_cast< unsigned int >( scaledTime ), numberOfNodes_ - 2 );
+    const double s = scaledTime - static_cast< double >( lowerIndex );
+
+    // Compute cubic Hermite basis functions and their derivatives.
+    const double sSquared = s * s;
+    const double oneMinusSSquared = ( 1.0 - s ) * ( 1.0 - s );
+    const double lowerValueWeight = ( 1.0 + 2.0 * s ) * oneMinusSSquared;
+    const double lowerDerivativeWeight = s * oneMinusSSquared * timeStep_;
+    const double upperValueWeight = sSquared * ( 3.0 - 2.0 * s );
+    const double upperDerivativeWeight = sSquared * ( s - 1.0 ) * timeStep_;
+    const double lowerValueRateWeight = 6.0 * ( sSquared - s ) / timeStep_;
+    const double lowerDerivativeRateWeight = 3.0 * sSquared - 4.0 * s + 1.0;
+    const double upperDerivativeRateWeight = 3.0 * sSquared - 2.0 * s;
+
+    // Interpolate quaternion and its derivative.
+    const double* lowerEntry = getTableEntriesData( ) + lowerIndex * numberOfValuesPerTableEntry;
+    Eigen::Map< const Eigen::Vector4d > lowerRotation( lowerEntry );
+    Eigen::Map< const Eigen::Vector4d > lowerRotationDerivative( lowerEntry + 4 );
+    Eigen::Map< const Eigen::Vector4d > upperRotation( lowerEntry + 8 );
+    Eigen::Map< const Eigen::Vector4d > upperRotationDerivative( lowerEntry + 12 );
+
+    rotationQuaternion = lowerValueWeight * lowerRotation + lowerDerivativeWeight * lowerRotationDerivative +
+            upperValueWeight * upperRotation + upperDerivativeWeight * upperRotationDerivative;
+    rotationQuaternionDerivative = lowerValueRateWeight * ( lowerRotation - upperRotation ) +
+            lowerDerivativeRateWeight * lowerRotationDerivative + upperDerivativeRateWeight * upperRotationDerivative;
+}
+
+//! Function to compute the rotation angle between two rotations.
+double computeRotationAngleBetweenRotations( const Eigen::Quaterniond& firstRotation,
+                                             const Eigen::Quaterniond& secondRotation )
+{
+    Eigen::Quaterniond differenceRotation = firstRotation.conjugate( ) * secondRotation;
+    return 2.0 * std::atan2( differenceRotation.vec( ).norm( ), std::fabs( differenceRotation.w( ) ) );
+}
+
+} // namespace earth_orientation
+
+} // namespace tudat
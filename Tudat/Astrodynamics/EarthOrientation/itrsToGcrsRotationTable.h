@@ -0,0 +1,314 @@
+/*    Copyright (c) 2010-2017, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ *
+ */
+
+#ifndef TUDAT_ITRSTOGCRSROTATIONTABLE_H
+#define TUDAT_ITRSTOGCRSROTATIONTABLE_H
+
+#include <string>
+#include <vector>
+
+#include <boost/function.hpp>
+#include <boost/shared_ptr.hpp>
+#include <boost/interprocess/mapped_region.hpp>
+
+#include <Eigen/Core>
+#include <Eigen/Geometry>
+
+#include "Tudat/Astrodynamics/EarthOrientation/earthOrientationCalculator.h"
+
+namespace tudat
+{
+
+namespace earth_orientation
+{
+
+//! Class providing the rotation from ITRS to GCRS from a precomputed table.
+/*!
+ *  Class providing the rotation from ITRS to GCRS (and its time derivative) from a precomputed table of rotation
+ *  quaternions and their time derivatives, at equidistant times, using cubic Hermite interpolation. The table is
+ *  generated (in parallel) from an EarthOrientationAnglesCalculator. The time step of the table is chosen such that the
+ *  interpolated rotation agrees with the direct computation to within a user-defined rotation angle. This bound is
+ *  verified upon creation of the table, by comparison with the direct computation at the middle of each table interval
+ *  (where the interpolation error is largest). A table may be saved to a binary file, and memory-mapped from this file
+ *  in later runs, so that it need only be generated once. Evaluating the rotation from the table avoids the evaluation
+ *  of the precession-nutation series, EOP corrections and time scale conversions, and is thread-safe.
+ */
+class ItrsToGcrsRotationTable
+{
+public:
+
+    //! Constructor, generates the rotation table.
+    /*!
+     *  Constructor, generates the rotation table from Earth orientation calculators. Since EarthOrientationAnglesCalculator
+     *  objects are not thread-safe, a function creating such an object is provided, which is called once for each thread
+     *  that is used.
+     *  \param earthOrientationCalculatorCreationFunction Function creating the object from which the Earth orientation
+     *  is computed.
+     *  \param startTime Start time of table (in seconds since J2000, in time scale timeScale).
+     *  \param endTime End time of table (in seconds since J2000, in time scale timeScale).
+     *  \param maximumRotationError Maximum rotation angle (in radians) between the interpolated and directly computed
+     *  rotation from ITRS to GCRS.
+     *  \param timeScale Time scale in which times are provided to the table.
+     *  \param numberOfThreads Number of threads used to generate the table (if 0, the number of concurrent threads
+     *  supported by the hardware is used).
+     *  \param sourceDataHash Hash of the data (EOP file, nutation theory, etc.) from which the Earth orientation is
+     *  computed, which is stored with the table, so that a saved table can be checked for consistency with its source
+     *  data (0 if not used).
+     */
+    ItrsToGcrsRotationTable(
+            const boost::function< boost::shared_ptr< EarthOrientationAnglesCalculator >( ) >
+            earthOrientationCalculatorCreationFunction,
+            const double startTime,
+            const double endTime,
+            const double maximumRotationError = 1.0E-12,
+            const basic_astrodynamics::TimeScales timeScale = basic_astrodynamics::tdb_scale,
+            const unsigned int numberOfThreads = 0,
+            const std::size_t sourceDataHash = 0 );
+
+    //! Constructor, memory-maps the rotation table from a binary file.
+    /*!
+     *  Constructor, memory-maps the rotation table from a binary file, as written by saveToFile. The file is mapped
+     *  read-only, and must not be modified for the lifetime of this object. An exception is thrown if the file is not a
+     *  valid rotation table file.
+     *  \param fileName Name of file from which table is to be loaded.
+     */
+    ItrsToGcrsRotationTable( const std::string& fileName );
+
+    //! Function to save the rotation table to a binary file.
+    /*!
+     *  Function to save the rotation table to a binary file (in native byte order), which may be loaded in later runs by
+     *  the constructor taking a file name.
+     *  \param fileName Name of file to which table is to be saved.
+     */
+    void saveToFile( const std::string& fileName ) const;
+
+    //! Function to compute the rotation from ITRS to GCRS.
+    /*!
+     *  Function to compute the rotation from ITRS to GCRS by interpolation of the table.
+     *  \param time Time at which rotation is to be computed (in seconds since J2000, in time scale of the table).
+     *  \return Rotation from ITRS to GCRS.
+     */
+    Eigen::Quaterniond getRotationFromItrsToGcrs( const double time ) const;
+
+    //! Function to compute the time derivative of the rotation matrix from ITRS to GCRS.
+    /*!
+     *  Function to compute the time derivative of the rotation matrix from ITRS to GCRS by interpolation of the table.
+     *  \param time Time at which rotation is to be computed (in seconds since J2000, in time scale of the table).
+     *  \return Time derivative of the rotation matrix from ITRS to GCRS.
+     */
+    Eigen::Matrix3d getRotationMatrixDerivativeFromItrsToGcrs( const double time ) const;
+
+    //! Function to check whether a time is inside the interval covered by the table.
+    /*!
+     *  Function to check whether a time is inside the interval covered by the table.
+     *  \param time Time that is to be checked (in seconds since J2000, in time scale of the table).
+     *  \return True if rotation at time can be computed from table.
+     */
+    bool isTimeInTableInterval( const double time ) const
+    {
+        return ( time >= startTime_ ) && ( time <= getEndTime( ) );
+    }
+
+    //! Function to retrieve the start time of table.
+    /*!
+     *  Function to retrieve the start time of table.
+     *  \return Start time of table (in seconds since J2000, in time scale of the table).
+     */
+    double getStartTime( ) const
+    {
+        return startTime_;
+    }
+
+    //! Function to retrieve the end time of table.
+    /*!
+     *  Function to retrieve the end time of table (which may be slightly later than the end time requested upon
+     *  generation).
+     *  \return End time of table (in seconds since J2000, in time scale of the table).
+     */
+    double getEndTime( ) const
+    {
+        return startTime_ + timeStep_ * static_cast< double >( numberOfNodes_ - 1 );
+    }
+
+    //! Function to retrieve the time step between table entries.
+    /*!
+     *  Function to retrieve the time step between table entries.
+     *  \return Time step between table entries.
+     */
+    double getTimeStep( ) const
+    {
+        return timeStep_;
+    }
+
+    //! Function to retrieve the number of table entries.
+    /*!
+     *  Function to retrieve the number of table entries.
+     *  \return Number of table entries.
+     */
+    unsigned int getNumberOfNodes( ) const
+    {
+        return numberOfNodes_;
+    }
+
+    //! Function to retrieve the maximum rotation error of the table.
+    /*!
+     *  Function to retrieve the maximum rotation angle between the interpolated and directly computed rotation, as
+     *  found when verifying the table upon its generation.
+     *  \return Maximum rotation error of the table (in radians).
+     */
+    double getMaximumRotationError( ) const
+    {
+        return maximumRotationError_;
+    }
+
+    //! Function to retrieve the time scale in which times are provided to the table.
+    /*!
+     *  Function to retrieve the time scale in which times are provided to the table.
+     *  \return Time scale in which times are provided to the table.
+     */
+    basic_astrodynamics::TimeScales getTimeScale( ) const
+    {
+        return timeScale_;
+    }
+
+    //! Function to retrieve the hash of the data from which the table is generated.
+    /*!
+     *  Function to retrieve the hash of the data from which the table is generated, as provided upon generation.
+     *  \return Hash of the data from which the table is generated (0 if not used).
+     */
+    std::size_t getSourceDataHash( ) const
+    {
+        return sourceDataHash_;
+    }
+
+private:
+
+    //! Function to compute the table entries for the current time step.
+    /*!
+     *  Function to compute the table entries (rotation quaternions and their time derivatives) for the current time
+     *  step. The time derivative of the rotation is obtained from the analytical derivative of the Earth rotation angle,
+     *  and from central differences of the (slowly varying) precession-nutation and polar motion rotations between
+     *  neighbouring table entries.
+     *  \param earthOrientationCalculators Earth orientation calculators, one for each thread.
+     */
+    void computeTableEntries(
+            const std::vector< boost::shared_ptr< EarthOrientationAnglesCalculator > >& earthOrientationCalculators );
+
+    //! Function to compute the maximum rotation error of the table.
+    /*!
+     *  Function to compute the maximum rotation angle between the interpolated and directly computed rotation, at the
+     *  middle of each table interval.
+     *  \param earthOrientationCalculators Earth orientation calculators, one for each thread.
+     *  \return Maximum rotation error of the table (in radians).
+     */
+    double computeMaximumRotationError(
+            const std::vector< boost::shared_ptr< EarthOrientationAnglesCalculator > >& earthOrientationCalculators );
+
+    //! Function to compute the slowly varying rotations and Earth rotation angle at a single node.
+    /*!
+     *  Function to compute the precession-nutation and polar motion rotations, Earth rotation angle and UT1 offset at a
+     *  single node (including the additional nodes before/after the table), as used by computeTableEntries.
+     *  \param nodeIndex Index of node (0 for the additional node before the table).
+     *  \param threadIndex Index of the thread on which the function is called.
+     *  \param earthOrientationCalculators Earth orientation calculators, one for each thread.
+     *  \param precessionNutationRotations Quaternion coefficients of precession-nutation rotations, with one column per
+     *  node (column nodeIndex is set by this function).
+     *  \param polarMotionRotations Quaternion coefficients of polar motion rotations, with one column per node (column
+     *  nodeIndex is set by this function).
+     *  \param earthRotationAngles Earth rotation angles per node (entry nodeIndex is set by this function).
+     *  \param ut1MinusTimes Difference between UT1 and the node time per node (entry nodeIndex is set by this function).
+     */
+    void computeNodeRotationAngles(
+            const unsigned int nodeIndex, const unsigned int threadIndex,
+            const std::vector< boost::shared_ptr< EarthOrientationAnglesCalculator > >& earthOrientationCalculators,
+            Eigen::Matrix< double, 4, Eigen::Dynamic >& precessionNutationRotations,
+            Eigen::Matrix< double, 4, Eigen::Dynamic >& polarMotionRotations,
+            Eigen::VectorXd& earthRotationAngles,
+            Eigen::VectorXd& ut1MinusTimes ) const;
+
+    //! Function to compute the rotation error of the table at the middle of a single table interval.
+    /*!
+     *  Function to compute the rotation angle between the interpolated and directly computed rotation at the middle of
+     *  a single table interval, as used by computeMaximumRotationError.
+     *  \param intervalIndex Index of table interval.
+     *  \param threadIndex Index of the thread on which the function is called.
+     *  \param earthOrientationCalculators Earth orientation calculators, one for each thread.
+     *  \param rotationErrors Rotation errors per interval (entry intervalIndex is set by this function).
+     */
+    void computeIntervalRotationError(
+            const unsigned int intervalIndex, const unsigned int threadIndex,
+            const std::vector< boost::shared_ptr< EarthOrientationAnglesCalculator > >& earthOrientationCalculators,
+            std::vector< double >& rotationErrors ) const;
+
+    //! Function to retrieve pointer to first table entry.
+    /*!
+     *  Function to retrieve pointer to first table entry, either in tableEntries_ or in mappedTableFile_.
+     *  \return Pointer to first table entry.
+     */
+    const double* getTableEntriesData( ) const;
+
+    //! Function to interpolate the rotation quaternion and its time derivative from the table.
+    /*!
+     *  Function to interpolate the (unnormalized) rotation quaternion and its time derivative from the table.
+     *  \param time Time at which rotation is to be computed.
+     *  \param rotationQuaternion Interpolated coefficients (x, y, z, w) of rotation quaternion (returned by reference).
+     *  \param rotationQuaternionDerivative Interpolated coefficients (x, y, z, w) of time derivative of rotation
+     *  quaternion (returned by reference).
+     */
+    void interpolateRotationQuaternion( const double time,
+                                        Eigen::Vector4d& rotationQuaternion,
+                                        Eigen::Vector4d& rotationQuaternionDerivative ) const;
+
+    //! Start time of table.
+    double startTime_;
+
+    //! Time step between table entries.
+    double timeStep_;
+
+    //! Number of table entries.
+    unsigned int numberOfNodes_;
+
+    //! Maximum rotation angle between the interpolated and directly computed rotation.
+    double maximumRotationError_;
+
+    //! Time scale in which times are provided to the table.
+    basic_astrodynamics::TimeScales timeScale_;
+
+    //! Hash of the data from which the table is generated (0 if not used).
+    std::size_t sourceDataHash_;
+
+    //! Table entries, if generated by this object.
+    /*!
+     *  Table entries, if generated by this object. For each table entry, the coefficients (x, y, z, w; i.e. in the order
+     *  of Eigen::Quaterniond::coeffs) of the rotation quaternion are followed by those of its time derivative.
+     */
+    std::vector< double > tableEntries_;
+
+    //! Memory-mapped region of file containing table entries, if loaded from file.
+    boost::shared_ptr< boost::interprocess::mapped_region > mappedTableFile_;
+
+};
+
+//! Function to compute the rotation angle between two rotations.
+/*!
+ *  Function to compute the angle of the rotation that transforms one rotation into another.
+ *  \param firstRotation First rotation.
+ *  \param secondRotation Second rotation.
+ *  \return Angle (in radians) of the rotation from firstRotation to secondRotation.
+ */
+double computeRotationAngleBetweenRotations( const Eigen::Quaterniond& firstRotation,
+                                             const Eigen::Quaterniond& secondRotation );
+
+} // namespace earth_orientation
+
+} // namespace tudat
+
+#endif // TUDAT_ITRSTOGCRSROTATIONTABLE_H
@@ -20,6 +20,7 @@
 #include "Tudat/Mathematics/Interpolators/interpolator.h"
 #include "Tudat/Astrodynamics/Ephemerides/rotationalEphemeris.h"
 #include "Tudat/Astrodynamics/EarthOrientation/earthOrientationCalculator.h"
+#include "Tudat/Astrodynamics/EarthOrientation/itrsToGcrsRotationTable.h"
 
 namespace tudat
 {
@@ -83,6 +84,11 @@ public:
      */
     Eigen::Quaterniond getRotationToBaseFrame( const double ephemerisTime )
     {
+        if( rotationTable_ != NULL && rotationTable_->isTimeInTableInterval( ephemerisTime ) )
+        {
+            return rotationTable_->getRotationFromItrsToGcrs( ephemerisTime );
+        }
+
         return earth_orientation::calculateRotationFromItrsToGcrs< double >(
                     anglesCalculator_->getRotationAnglesFromItrsToGcrs< double >( ephemerisTime, inputTimeScale_ ),
                     ephemerisTime );
@@ -117,6 +123,11 @@ public:
      */
     Eigen::Matrix3d getDerivativeOfRotationToBaseFrame( const double ephemerisTime )
     {
+        if( rotationTable_ != NULL && rotationTable_->isTimeInTableInterval( ephemerisTime ) )
+        {
+            return rotationTable_->getRotationMatrixDerivativeFromItrsToGcrs( ephemerisTime );
+        }
+
         return earth_orientation::calculateRotationRateFromItrsToGcrs< double >( functionToGetRotationAngles( ephemerisTime ),
                                                                                  ephemerisTime );
     }
@@ -136,6 +147,33 @@ public:
         return inputTimeScale_;
     }
 
+    //! Function to set a precomputed table from which the rotation is to be evaluated.
+    /*!
+     *  Function to set a precomputed table from which the rotation (and its derivative) is to be evaluated, for times
+     *  (provided as double) inside the interval covered by the table. Outside this interval, and for extended-precision
+     *  times, the rotation is computed directly from anglesCalculator_.
+     *  \param rotationTable Precomputed table of rotation from ITRS to GCRS (NULL to always compute rotation directly).
+     */
+    void setRotationTable( const boost::shared_ptr< earth_orientation::ItrsToGcrsRotationTable > rotationTable )
+    {
+        if( rotationTable != NULL && rotationTable->getTimeScale( ) != inputTimeScale_ )
+        {
+            throw std::runtime_error( "Error when setting ITRS to GCRS rotation table, time scale of table is "
+                                      "inconsistent with rotation model." );
+        }
+        rotationTable_ = rotationTable;
+    }
+
+    //! Function to retrieve the precomputed table from which the rotation is evaluated.
+    /*!
+     *  Function to retrieve the precomputed table from which the rotation is evaluated (NULL if none is used).
+     *  \return Precomputed table of rotation from ITRS to GCRS.
+     */
+    boost::shared_ptr< earth_orientation::ItrsToGcrsRotationTable > getRotationTable( )
+    {
+        return rotationTable_;
+    }
+
 
 private:
 
@@ -150,6 +188,9 @@ private:
     boost::shared_ptr< earth_orientation::EarthOrientationAnglesCalculator > anglesCalculator_;
 
     basic_astrodynamics::TimeScales inputTimeScale_;
+
+    //! Precomputed table from which rotation is evaluated (if not NULL).
+    boost::shared_ptr< earth_orientation::ItrsToGcrsRotationTable > rotationTable_;
 };
 
 }
@@ -124,6 +124,21 @@ public:
     Eigen::Matrix< long double, 6, 1 > getCartesianLongStateFromExtendedTime(
             const Time& time );
 
+    //! Get state from ephemeris, using a lookup hint that is owned by the caller.
+    /*!
+     * Returns state from ephemeris, as calculated from interpolator_, in the precision of the interpolator. The lookup
+     * hint of the interpolator is provided by the caller, so that this function may be called concurrently from
+     * multiple threads, provided that each thread uses its own hint (and the interpolator is not reset concurrently).
+     * \param time Time at which ephemeris is to be evaluated
+     * \param nearestLowerIndex Nearest lower index in interpolator found during previous call (negative if no
+     * previous call has been made). Set to the nearest lower index of time (returned by reference).
+     * \return State in Cartesian elements from ephemeris.
+     */
+    StateType getTabulatedState( const TimeType time, int& nearestLowerIndex ) const
+    {
+        return interpolator_->interpolate( time, nearestLowerIndex );
+    }
+
 
     //! Function to return the interpolator
     /*!
@@ -1,10 +1,10 @@
-/*    Copyright (c) 2010-2017, Delft University of Technology
- *    All rigths reserved
- *
- *    This file is part of the Tudat. Redistribution and use in source and
- *    binary forms, with or without modification, are permitted exclusively
- *    under the terms of the Modified BSD license. You should have received
- *    a copy of the license with this file. If not, please or visit:
+/*    Copyright (c) 2010-2017, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
  *    http://tudat.tudelft.nl/LICENSE.
  *
  *    References
@@ -24,8 +24,12 @@
 
 #define BOOST_TEST_MAIN
 
+#include <chrono>
 #include <cmath>
+#include <cstdlib>
+#include <iostream>
 #include <limits>
+#include <vector>
 
 #include <boost/lambda/lambda.hpp>
 #include <boost/make_shared.hpp>
@@ -36,6 +40,7 @@
 
 #include "Tudat/Basics/testMacros.h"
 
+#include "Tudat/Astrodynamics/Gravitation/sphericalHarmonicsGravityField.h"
 #include "Tudat/Astrodynamics/Gravitation/sphericalHarmonicsGravityModel.h"
 #include "Tudat/Mathematics/BasicMathematics/sphericalHarmonics.h"
 
@@ -296,6 +301,106 @@ BOOST_AUTO_TEST_CASE( test_SphericalHarmonicsGravitationalAccelerationWrapperCla
     TUDAT_CHECK_MATRIX_CLOSE_FRACTION( expectedAcceleration, acceleration, 1.0e-15 );
 }
 
+// Check fused acceleration/potential kernel against term-by-term computation, for increasing degree and order.
+BOOST_AUTO_TEST_CASE( test_FusedSphericalHarmonicsGravitationalAcceleration )
+{
+    // Short-cuts.
+    using namespace gravitation;
+
+    const double gravitationalParameter = 3.986004418e14;
+    const double planetaryRadius = 6378137.0;
+
+    // Define arbitrary Cartesian position [m].
+    const Eigen::Vector3d position( 5.0e6, -3.0e6, 4.0e6 );
+
+    std::vector< int > maximumDegrees;
+    maximumDegrees.push_back( 10 );
+    maximumDegrees.push_back( 50 );
+    maximumDegrees.push_back( 200 );
+    maximumDegrees.push_back( 360 );
+
+    std::srand( 42 );
+    for( unsigned int i = 0; i < maximumDegrees.size( ); i++ )
+    {
+        const int numberOfDegrees = maximumDegrees.at( i ) + 1;
+
+        // Generate coefficients with Kaula-like magnitude.
+        Eigen::MatrixXd cosineCoefficients = Eigen::MatrixXd::Zero( numberOfDegrees, numberOfDegrees );
+        Eigen::MatrixXd sineCoefficients = Eigen::MatrixXd::Zero( numberOfDegrees, numberOfDegrees );
+        cosineCoefficients( 0, 0 ) = 1.0;
+        for( int degree = 2; degree < numberOfDegrees; degree++ )
+        {
+            for( int order = 0; order <= degree; order++ )
+            {
+                cosineCoefficients( degree, order ) = 1.0E-5 / static_cast< double >( degree * degree ) *
+                        ( 2.0 * static_cast< double >( std::rand( ) ) / RAND_MAX - 1.0 );
+                if( order > 0 )
+                {
+                    sineCoefficients( degree, order ) = 1.0E-5 / static_cast< double >( degree * degree ) *
+                            ( 2.0 * static_cast< double >( std::rand( ) ) / RAND_MAX - 1.0 );
+                }
+            }
+        }
+        const DegreeMajorCoefficientMatrix degreeMajorCosineCoefficients = cosineCoefficients;
+        const DegreeMajorCoefficientMatrix degreeMajorSineCoefficients = sineCoefficients;
+
+        boost::shared_ptr< basic_mathematics::SphericalHarmonicsCache > sphericalHarmonicsCache =
+                boost::make_shared< basic_mathematics::SphericalHarmonicsCache >(
+                    numberOfDegrees, numberOfDegrees + 1 );
+
+        // Compute acceleration and potential with both methods.
+        const Eigen::Vector3d expectedAcceleration = computeGeodesyNormalizedGravitationalAccelerationSum(
+                    position, gravitationalParameter, planetaryRadius,
+                    cosineCoefficients, sineCoefficients, sphericalHarmonicsCache );
+        const double expectedPotential = calculateSphericalHarmonicGravitationalPotential(
+                    position, gravitationalParameter, planetaryRadius,
+                    cosineCoefficients, sineCoefficients, sphericalHarmonicsCache );
+
+        double potential;
+        const Eigen::Vector3d acceleration = computeFusedGeodesyNormalizedGravitationalAccelerationSum(
+                    position, gravitationalParameter, planetaryRadius,
+                    degreeMajorCosineCoefficients, degreeMajorSineCoefficients, sphericalHarmonicsCache, potential );
+
+        TUDAT_CHECK_MATRIX_CLOSE_FRACTION( expectedAcceleration, acceleration, 1.0e-14 );
+        BOOST_CHECK_CLOSE_FRACTION( expectedPotential, potential, 1.0e-14 );
+
+#if COMPILE_UNIT_TEST_BENCHMARKS
+        // Compare run time of both methods, using slightly different positions to force update of cache.
+        const int numberOfEvaluations = std::max( 10, 200000 / ( numberOfDegrees * numberOfDegrees ) );
+        Eigen::Vector3d accelerationSum = Eigen::Vector3d::Zero( );
+
+        std::chrono::steady_clock::time_point startTime = std::chrono::steady_clock::now( );
+        for( int j = 0; j < numberOfEvaluations; j++ )
+        {
+            accelerationSum += computeGeodesyNormalizedGravitationalAccelerationSum(
+                        position + Eigen::Vector3d::Constant( static_cast< double >( j ) ),
+                        gravitationalParameter, planetaryRadius,
+                        cosineCoefficients, sineCoefficients, sphericalHarmonicsCache );
+        }
+        const double termByTermTime = std::chrono::duration_cast< std::chrono::nanoseconds >(
+                    std::chrono::steady_clock::now( ) - startTime ).count( ) * 1.0E-9;
+
+        startTime = std::chrono::steady_clock::now( );
+        for( int j = 0; j < numberOfEvaluations; j++ )
+        {
+            accelerationSum -= computeFusedGeodesyNormalizedGravitationalAccelerationSum(
+                        position + Eigen::Vector3d::Constant( static_cast< double >( j ) ),
+                        gravitationalParameter, planetaryRadius,
+                        degreeMajorCosineCoefficients, degreeMajorSineCoefficients, sphericalHarmonicsCache );
+        }
+        const double fusedTime = std::chrono::duration_cast< std::chrono::nanoseconds >(
+                    std::chrono::steady_clock::now( ) - startTime ).count( ) * 1.0E-9;
+
+        BOOST_CHECK_SMALL( accelerationSum.norm( ) / expectedAcceleration.norm( ),
+                           static_cast< double >( numberOfEvaluations ) * 1.0E-14 );
+
+        std::cout << "Degree " << maximumDegrees.at( i ) << ", time per evaluation (term-by-term/fused) [s]: "
+                  << termByTermTime / numberOfEvaluations << " "
+                  << fusedTime / numberOfEvaluations << std::endl;
+#endif
+    }
+}
+
 BOOST_AUTO_TEST_SUITE_END( )
 
 } // namespace unit_tests
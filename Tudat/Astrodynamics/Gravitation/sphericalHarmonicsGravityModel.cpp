@@ -9,6 +9,7 @@
  *
  */
 
+#include <algorithm>
 #include <cmath>
 #include <limits>
 #include <stdexcept>
@@ -101,6 +102,118 @@ Eigen::Vector3d computeGeodesyNormalizedGravitationalAccelerationSum(
                 sphericalGradient, positionOfBodySubjectToAcceleration );
 }
 
+//! Compute gravitational acceleration and potential due to multiple spherical harmonics terms, defined using
+//! geodesy-normalization, in a single fused pass.
+Eigen::Vector3d computeFusedGeodesyNormalizedGravitationalAccelerationSum(
+        const Eigen::Vector3d& positionOfBodySubjectToAcceleration,
+        const double gravitationalParameter,
+        const double equatorialRadius,
+        const DegreeMajorCoefficientMatrix& cosineHarmonicCoefficients,
+        const DegreeMajorCoefficientMatrix& sineHarmonicCoefficients,
+        boost::shared_ptr< basic_mathematics::SphericalHarmonicsCache > sphericalHarmonicsCache,
+        double& potential )
+{
+    typedef Eigen::Map< const Eigen::ArrayXd > ConstArrayMap;
+
+    // Set highest degree and order.
+    const int highestDegree = cosineHarmonicCoefficients.rows( );
+    const int highestOrder = cosineHarmonicCoefficients.cols( );
+
+    // Declare spherical position vector.
+    Eigen::Vector3d sphericalpositionOfBodySubjectToAcceleration = coordinate_conversions::
+            convertCartesianToSpherical( positionOfBodySubjectToAcceleration );
+    sphericalpositionOfBodySubjectToAcceleration( 1 ) = mathematical_constants::PI / 2.0 -
+            sphericalpositionOfBodySubjectToAcceleration( 1 );
+
+    double sineOfAngle = std::sin( sphericalpositionOfBodySubjectToAcceleration( 1 ) );
+    sphericalHarmonicsCache->update( sphericalpositionOfBodySubjectToAcceleration( 0 ),
+                                     sineOfAngle,
+                                     sphericalpositionOfBodySubjectToAcceleration( 2 ),
+                                     equatorialRadius );
+
+    // Retrieve contiguous storage of cached terms.
+    boost::shared_ptr< basic_mathematics::LegendreCache > legendreCache =
+            sphericalHarmonicsCache->getLegendreCache( );
+    const int legendreStride = legendreCache->getMaximumOrder( ) + 1;
+    const double* legendrePolynomials = legendreCache->getLegendreValues( ).data( );
+    const double* legendrePolynomialDerivatives = legendreCache->getLegendreDerivatives( ).data( );
+    const double* cosinesOfLongitude = sphericalHarmonicsCache->getCosinesOfMultipleLongitude( ).data( );
+    const double* sinesOfLongitude = sphericalHarmonicsCache->getSinesOfMultipleLongitude( ).data( );
+    const std::vector< double >& radiusRatioPowers = sphericalHarmonicsCache->getReferenceRadiusRatioPowersList( );
+
+    // Loop over all degrees, summing contributions of all orders per degree.
+    double radialSum = 0.0;
+    double latitudinalSum = 0.0;
+    double longitudinalSum = 0.0;
+    double potentialSum = 0.0;
+    for ( int degree = 0; degree < highestDegree; degree++ )
+    {
+        const int numberOfOrders = std::min( degree + 1, highestOrder );
+
+        ConstArrayMap currentLegendrePolynomials( legendrePolynomials + degree * legendreStride, numberOfOrders );
+        ConstArrayMap currentLegendrePolynomialDerivatives(
+                    legendrePolynomialDerivatives + degree * legendreStride, numberOfOrders );
+        ConstArrayMap currentCosineCoefficients(
+                    cosineHarmonicCoefficients.data( ) + degree * highestOrder, numberOfOrders );
+        ConstArrayMap currentSineCoefficients(
+                    sineHarmonicCoefficients.data( ) + degree * highestOrder, numberOfOrders );
+        ConstArrayMap currentCosinesOfLongitude( cosinesOfLongitude, numberOfOrders );
+        ConstArrayMap currentSinesOfLongitude( sinesOfLongitude, numberOfOrders );
+
+        // Compute sums over all orders of current degree.
+        const double legendreTermSum =
+                ( currentLegendrePolynomials * ( currentCosineCoefficients * currentCosinesOfLongitude +
+                                                 currentSineCoefficients * currentSinesOfLongitude ) ).sum( );
+        const double legendreDerivativeTermSum =
+                ( currentLegendrePolynomialDerivatives * ( currentCosineCoefficients * currentCosinesOfLongitude +
+                                                           currentSineCoefficients * currentSinesOfLongitude ) ).sum( );
+        const double orderTermSum =
+                ( Eigen::ArrayXd::LinSpaced( numberOfOrders, 0.0, static_cast< double >( numberOfOrders - 1 ) ) *
+                  currentLegendrePolynomials * ( currentSineCoefficients * currentCosinesOfLongitude -
+                                                 currentCosineCoefficients * currentSinesOfLongitude ) ).sum( );
+
+        // Apply radius terms of current degree.
+        const double radiusPowerTerm = radiusRatioPowers[ degree + 1 ];
+        potentialSum += radiusPowerTerm * legendreTermSum;
+        radialSum -= ( static_cast< double >( degree ) + 1.0 ) * radiusPowerTerm * legendreTermSum;
+        latitudinalSum += radiusPowerTerm * legendreDerivativeTermSum;
+        longitudinalSum += radiusPowerTerm * orderTermSum;
+    }
+
+    // Compute gradient premultiplier.
+    const double preMultiplier = gravitationalParameter / equatorialRadius;
+
+    Eigen::Vector3d sphericalGradient;
+    sphericalGradient( basic_mathematics::radiusIndex ) =
+            preMultiplier * radialSum / sphericalpositionOfBodySubjectToAcceleration( 0 );
+    sphericalGradient( basic_mathematics::latitudeIndex ) =
+            preMultiplier * legendreCache->getCurrentPolynomialParameterComplement( ) * latitudinalSum;
+    sphericalGradient( basic_mathematics::longitudeIndex ) = preMultiplier * longitudinalSum;
+
+    potential = preMultiplier * potentialSum;
+
+    // Convert from spherical gradient to Cartesian gradient (which equals acceleration vector) and
+    // return the resulting acceleration vector.
+    return coordinate_conversions::convertSphericalToCartesianGradient(
+                sphericalGradient, positionOfBodySubjectToAcceleration );
+}
+
+//! Compute gravitational acceleration due to multiple spherical harmonics terms, defined using
+//! geodesy-normalization, in a single fused pass.
+Eigen::Vector3d computeFusedGeodesyNormalizedGravitationalAccelerationSum(
+        const Eigen::Vector3d& positionOfBodySubjectToAcceleration,
+        const double gravitationalParameter,
+        const double equatorialRadius,
+        const DegreeMajorCoefficientMatrix& cosineHarmonicCoefficients,
+        const DegreeMajorCoefficientMatrix& sineHarmonicCoefficients,
+        boost::shared_ptr< basic_mathematics::SphericalHarmonicsCache > sphericalHarmonicsCache )
+{
+    double potential;
+    return computeFusedGeodesyNormalizedGravitationalAccelerationSum(
+                positionOfBodySubjectToAcceleration, gravitationalParameter, equatorialRadius,
+                cosineHarmonicCoefficients, sineHarmonicCoefficients, sphericalHarmonicsCache, potential );
+}
+
 //! Compute gravitational acceleration due to single spherical harmonics term.
 Eigen::Vector3d computeSingleGeodesyNormalizedGravitationalAcceleration(
         const Eigen::Vector3d& positionOfBodySubjectToAcceleration,
@@ -89,6 +89,67 @@ Eigen::Vector3d computeGeodesyNormalizedGravitationalAccelerationSum(
         const Eigen::MatrixXd& sineHarmonicCoefficients,
         boost::shared_ptr< basic_mathematics::SphericalHarmonicsCache > sphericalHarmonicsCache );
 
+//! Typedef for matrix of spherical harmonic coefficients, with all orders of a single degree stored contiguously.
+typedef Eigen::Matrix< double, Eigen::Dynamic, Eigen::Dynamic, Eigen::RowMajor > DegreeMajorCoefficientMatrix;
+
+//! Compute gravitational acceleration and potential due to multiple spherical harmonics terms, defined using
+//! geodesy-normalization, in a single fused pass.
+/*!
+ * This function computes the same acceleration as computeGeodesyNormalizedGravitationalAccelerationSum, but evaluates
+ * all terms of a single degree in one loop over contiguous memory: the Legendre polynomials (and derivatives) of the
+ * cache, the sines/cosines of the multiple longitudes and the (degree-major) coefficients. For each degree, the sums
+ * over all orders are vectorized, after which the degree-dependent radius terms are applied once per degree. The
+ * potential is obtained from the same sums at negligible additional cost. Due to the different order of summation,
+ * results differ from those of computeGeodesyNormalizedGravitationalAccelerationSum at round-off level.
+ * \param positionOfBodySubjectToAcceleration Cartesian position vector with respect to the
+ *          reference frame that is associated with the harmonic coefficients.
+ * \param gravitationalParameter Gravitational parameter associated with the spherical harmonics
+ *          [m^3 s^-2].
+ * \param equatorialRadius Reference radius of the spherical harmonics [m].
+ * \param cosineHarmonicCoefficients Matrix with <B>geodesy-normalized</B> cosine harmonic
+ *          coefficients. The row index indicates the degree and the column index indicates the order
+ *          of coefficients.
+ * \param sineHarmonicCoefficients Matrix with <B>geodesy-normalized</B> sine harmonic coefficients.
+ *          The row index indicates the degree and the column index indicates the order of
+ *          coefficients. The matrix must be equal in size to cosineHarmonicCoefficients.
+ * \param sphericalHarmonicsCache Cache object for computing/retrieving repeated terms in spherical harmonics potential
+ *          gradient calculation.
+ * \param potential Gravitational potential at the given position, due to all harmonic terms (returned by reference).
+ * \return Cartesian acceleration vector resulting from the summation of all harmonic terms.
+ */
+Eigen::Vector3d computeFusedGeodesyNormalizedGravitationalAccelerationSum(
+        const Eigen::Vector3d& positionOfBodySubjectToAcceleration,
+        const double gravitationalParameter,
+        const double equatorialRadius,
+        const DegreeMajorCoefficientMatrix& cosineHarmonicCoefficients,
+        const DegreeMajorCoefficientMatrix& sineHarmonicCoefficients,
+        boost::shared_ptr< basic_mathematics::SphericalHarmonicsCache > sphericalHarmonicsCache,
+        double& potential );
+
+//! Compute gravitational acceleration due to multiple spherical harmonics terms, defined using
+//! geodesy-normalization, in a single fused pass.
+/*!
+ * Compute gravitational acceleration due to multiple spherical harmonics terms, defined using
+ * geodesy-normalization, in a single fused pass (see overloaded function for details).
+ * \param positionOfBodySubjectToAcceleration Cartesian position vector with respect to the
+ *          reference frame that is associated with the harmonic coefficients.
+ * \param gravitationalParameter Gravitational parameter associated with the spherical harmonics
+ *          [m^3 s^-2].
+ * \param equatorialRadius Reference radius of the spherical harmonics [m].
+ * \param cosineHarmonicCoefficients Matrix with <B>geodesy-normalized</B> cosine harmonic coefficients.
+ * \param sineHarmonicCoefficients Matrix with <B>geodesy-normalized</B> sine harmonic coefficients.
+ * \param sphericalHarmonicsCache Cache object for computing/retrieving repeated terms in spherical harmonics potential
+ *          gradient calculation.
+ * \return Cartesian acceleration vector resulting from the summation of all harmonic terms.
+ */
+Eigen::Vector3d computeFusedGeodesyNormalizedGravitationalAccelerationSum(
+        const Eigen::Vector3d& positionOfBodySubjectToAcceleration,
+        const double gravitationalParameter,
+        const double equatorialRadius,
+        const DegreeMajorCoefficientMatrix& cosineHarmonicCoefficients,
+        const DegreeMajorCoefficientMatrix& sineHarmonicCoefficients,
+        boost::shared_ptr< basic_mathematics::SphericalHarmonicsCache > sphericalHarmonicsCache );
+
 //! Compute gravitational acceleration due to single spherical harmonics term.
 /*!
  * This function computes the acceleration caused by a single gravitational spherical harmonics
@@ -145,7 +206,7 @@ Eigen::Vector3d computeSingleGeodesyNormalizedGravitationalAcceleration(
  * This templated class implements a general spherical harmonics gravitational acceleration model.
  * The acceleration computed with this class is based on the geodesy-normalization described by
  * (Heiskanen & Moritz, 1967), implemented in the
- * computeGeodesyNormalizedGravitationalAccelerationSum() function. The acceleration computed is a
+ * computeFusedGeodesyNormalizedGravitationalAccelerationSum() function. The acceleration computed is a
  * sum, based on the matrix of coefficients of the model provided.
  */
 class SphericalHarmonicsGravitationalAccelerationModel
@@ -289,7 +350,7 @@ public:
     /*!
      * Returns the gravitational acceleration computed using the input parameters provided to the
      * class. This function serves as a wrapper for the
-     * computeGeodesyNormalizedGravitationalAccelerationSum() function.
+     * computeFusedGeodesyNormalizedGravitationalAccelerationSum() function.
      * \return Computed gravitational acceleration vector.
      */
     Eigen::Vector3d getAcceleration( )
@@ -307,12 +368,16 @@ public:
     {
         if( !( this->currentTime_ == currentTime ) )
         {
-            cosineHarmonicCoefficients = getCosineHarmonicsCoefficients( );
-            sineHarmonicCoefficients = getSineHarmonicsCoefficients( );
+            updateDegreeMajorCoefficients(
+                        getCosineHarmonicsCoefficients( ), retrievedCosineHarmonicCoefficients_,
+                        cosineHarmonicCoefficients );
+            updateDegreeMajorCoefficients(
+                        getSineHarmonicsCoefficients( ), retrievedSineHarmonicCoefficients_,
+                        sineHarmonicCoefficients );
             rotationToIntegrationFrame_ = rotationFromBodyFixedToIntegrationFrameFunction_( );
             this->updateBaseMembers( );
             currentAcceleration_ = rotationToIntegrationFrame_ *
-                    computeGeodesyNormalizedGravitationalAccelerationSum(
+                    computeFusedGeodesyNormalizedGravitationalAccelerationSum(
                         rotationToIntegrationFrame_.inverse( ) * (
                             this->positionOfBodySubjectToAcceleration - this->positionOfBodyExertingAcceleration ),
                         gravitationalParameter,
@@ -384,6 +449,26 @@ protected:
 
 private:
 
+    //! Function to update a degree-major coefficient matrix, if the retrieved coefficients have changed.
+    /*!
+     *  Function to update a degree-major coefficient matrix, if the retrieved coefficients have changed since the
+     *  previous update, so that the conversion to degree-major storage is not repeated for unchanged coefficients.
+     *  \param coefficients Coefficients, as retrieved from coefficient function.
+     *  \param previousCoefficients Coefficients, as retrieved during previous update (updated if changed).
+     *  \param degreeMajorCoefficients Degree-major coefficient matrix (updated if coefficients changed).
+     */
+    void updateDegreeMajorCoefficients( const Eigen::MatrixXd& coefficients,
+                                        Eigen::MatrixXd& previousCoefficients,
+                                        DegreeMajorCoefficientMatrix& degreeMajorCoefficients )
+    {
+        if( coefficients.rows( ) != previousCoefficients.rows( ) ||
+                coefficients.cols( ) != previousCoefficients.cols( ) || coefficients != previousCoefficients )
+        {
+            previousCoefficients = coefficients;
+            degreeMajorCoefficients = coefficients;
+        }
+    }
+
     //! Equatorial radius [m].
     /*!
      * Current value of equatorial (planetary) radius used for spherical harmonics expansion [m].
@@ -392,15 +477,23 @@ private:
 
     //! Matrix of cosine coefficients.
     /*!
-     * Matrix containing coefficients of cosine terms for spherical harmonics expansion.
+     * Matrix containing coefficients of cosine terms for spherical harmonics expansion, stored with all orders of a
+     * single degree contiguous in memory.
      */
-    Eigen::MatrixXd cosineHarmonicCoefficients;
+    DegreeMajorCoefficientMatrix cosineHarmonicCoefficients;
 
     //! Matrix of sine coefficients.
     /*!
-     * Matrix containing coefficients of sine terms for spherical harmonics expansion.
+     * Matrix containing coefficients of sine terms for spherical harmonics expansion, stored with all orders of a
+     * single degree contiguous in memory.
      */
-    Eigen::MatrixXd sineHarmonicCoefficients;
+    DegreeMajorCoefficientMatrix sineHarmonicCoefficients;
+
+    //! Cosine coefficients, as retrieved from getCosineHarmonicsCoefficients during last update.
+    Eigen::MatrixXd retrievedCosineHarmonicCoefficients_;
+
+    //! Sine coefficients, as retrieved from getSineHarmonicsCoefficients during last update.
+    Eigen::MatrixXd retrievedSineHarmonicCoefficients_;
 
     //! Pointer to function returning cosine harmonics coefficients matrix.
     /*!
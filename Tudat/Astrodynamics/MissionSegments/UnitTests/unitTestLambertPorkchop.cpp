@@ -0,0 +1,322 @@
+/*    Copyright (c) 2010-2017, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ *
+ *    References
+ *      Izzo, D., Keplerian_Toolbox.
+ *
+ */
+
+#define BOOST_TEST_MAIN
+
+#include <cmath>
+#include <exception>
+#include <limits>
+#include <stdexcept>
+
+#include <boost/bind.hpp>
+#include <boost/test/unit_test.hpp>
+
+#include <Eigen/Core>
+
+#include "Tudat/Basics/testMacros.h"
+#include "Tudat/Astrodynamics/BasicAstrodynamics/keplerPropagator.h"
+#include "Tudat/Astrodynamics/BasicAstrodynamics/orbitalElementConversions.h"
+#include "Tudat/Astrodynamics/BasicAstrodynamics/physicalConstants.h"
+#include "Tudat/Astrodynamics/BasicAstrodynamics/unitConversions.h"
+#include "Tudat/Astrodynamics/MissionSegments/lambertPorkchop.h"
+#include "Tudat/Astrodynamics/MissionSegments/lambertRoutines.h"
+#include "Tudat/Astrodynamics/MissionSegments/multiRevolutionLambertTargeterIzzo.h"
+
+namespace tudat
+{
+namespace unit_tests
+{
+
+using namespace mission_segments;
+
+//! Gravitational parameter of the Sun used in tests.
+const double sunGravitationalParameter = 1.32712440018e20;
+
+//! Function to compute the Cartesian state of a body on a Keplerian orbit.
+Eigen::Vector6d getKeplerOrbitCartesianState( const Eigen::Vector6d& initialKeplerianState, const double time )
+{
+    return orbital_element_conversions::convertKeplerianToCartesianElements(
+                orbital_element_conversions::propagateKeplerOrbit(
+                    initialKeplerianState, time, sunGravitationalParameter ), sunGravitationalParameter );
+}
+
+//! Function to retrieve the state function of an Earth-like orbit.
+boost::function< Eigen::Vector6d( const double ) > getEarthLikeStateFunction( )
+{
+    Eigen::Vector6d keplerianState;
+    keplerianState << physical_constants::ASTRONOMICAL_UNIT, 0.0167, 0.0, unit_conversions::convertDegreesToRadians(
+                          102.9 ), 0.0, unit_conversions::convertDegreesToRadians( 100.0 );
+    return boost::bind( &getKeplerOrbitCartesianState, keplerianState, _1 );
+}
+
+//! Function to retrieve the state function of a Mars-like orbit.
+boost::function< Eigen::Vector6d( const double ) > getMarsLikeStateFunction( )
+{
+    Eigen::Vector6d keplerianState;
+    keplerianState << 1.5237 * physical_constants::ASTRONOMICAL_UNIT, 0.0934,
+            unit_conversions::convertDegreesToRadians( 1.85 ), unit_conversions::convertDegreesToRadians( 286.5 ),
+            unit_conversions::convertDegreesToRadians( 49.6 ), unit_conversions::convertDegreesToRadians( 20.0 );
+    return boost::bind( &getKeplerOrbitCartesianState, keplerianState, _1 );
+}
+
+//! Function to create equally spaced times.
+std::vector< double > getEquallySpacedTimes( const double startTime, const double endTime,
+                                             const unsigned int numberOfTimes )
+{
+    std::vector< double > times;
+    for( unsigned int i = 0; i < numberOfTimes; i++ )
+    {
+        times.push_back( startTime + ( endTime - startTime ) * static_cast< double >( i ) /
+                         static_cast< double >( numberOfTimes - 1 ) );
+    }
+    return times;
+}
+
+//! Function to compute the lowest total delta-V of a transfer using the existing Lambert routines.
+/*!
+ *  Function to compute the lowest total delta-V of a transfer using the existing (single-call) Lambert routines, with
+ *  the states of the bodies retrieved from the state functions for each transfer.
+ */
+double computeLowestTotalDeltaVWithSingleCalls(
+        const double departureTime, const double arrivalTime,
+        const boost::function< Eigen::Vector6d( const double ) >& departureStateFunction,
+        const boost::function< Eigen::Vector6d( const double ) >& arrivalStateFunction,
+        const int maximumNumberOfRevolutions )
+{
+    const Eigen::Vector6d departureState = departureStateFunction( departureTime );
+    const Eigen::Vector6d arrivalState = arrivalStateFunction( arrivalTime );
+
+    double lowestTotalDeltaV = TUDAT_NAN;
+    Eigen::Vector3d velocityAtDeparture, velocityAtArrival;
+    for( int numberOfRevolutions = 0; numberOfRevolutions <= maximumNumberOfRevolutions; numberOfRevolutions++ )
+    {
+        for( int branch = 0; branch < ( ( numberOfRevolutions == 0 ) ? 1 : 2 ); branch++ )
+        {
+            try
+            {
+                if( numberOfRevolutions == 0 )
+                {
+                    solveLambertProblemIzzo( departureState.segment( 0, 3 ), arrivalState.segment( 0, 3 ),
+                                             arrivalTime - departureTime, sunGravitationalParameter,
+                                             velocityAtDeparture, velocityAtArrival );
+                }
+                else
+                {
+                    MultiRevolutionLambertTargeterIzzo lambertTargeter(
+                                departureState.segment( 0, 3 ), arrivalState.segment( 0, 3 ),
+                                arrivalTime - departureTime, sunGravitationalParameter, numberOfRevolutions,
+                                branch == 1 );
+                    velocityAtDeparture = lambertTargeter.getInertialVelocityAtDeparture( );
+                    velocityAtArrival = lambertTargeter.getInertialVelocityAtArrival( );
+                }
+            }
+            catch( std::exception& )
+            {
+                continue;
+            }
+
+            const double totalDeltaV = ( velocityAtDeparture - departureState.segment( 3, 3 ) ).norm( ) +
+                    ( velocityAtArrival - arrivalState.segment( 3, 3 ) ).norm( );
+            if( !( totalDeltaV >= lowestTotalDeltaV ) )
+            {
+                lowestTotalDeltaV = totalDeltaV;
+            }
+        }
+    }
+    return lowestTotalDeltaV;
+}
+
+BOOST_AUTO_TEST_SUITE( test_lambert_porkchop )
+
+//! Test allocation- and exception-free Lambert kernel against existing Izzo Lambert targeters.
+BOOST_AUTO_TEST_CASE( testLambertTransferKernel )
+// Tested using the test case of the multi-revolution Izzo Lambert targeter.
+{
+    const Eigen::Vector3d departurePosition( 4949101.422118526, 859402.44303969538, -151535.83799466802 );
+    const Eigen::Vector3d arrivalPosition( 3648349.9884584765, 4281879.3154454567, -755010.85145052616 );
+    const double timeOfFlight = 1.0307431655832210e+004;
+    const double gravitationalParameter = 398600.4418e9;
+
+    BOOST_CHECK_EQUAL( computeMaximumNumberOfLambertRevolutions(
+                           departurePosition, arrivalPosition, timeOfFlight, gravitationalParameter ), 4 );
+    BOOST_CHECK_EQUAL( computeMaximumNumberOfLambertRevolutions(
+                           departurePosition, arrivalPosition, -timeOfFlight, gravitationalParameter ), 0 );
+
+    Eigen::Vector3d velocityAtDeparture, velocityAtArrival;
+    Eigen::Vector3d expectedVelocityAtDeparture, expectedVelocityAtArrival;
+    for( int isRetrograde = 0; isRetrograde < 2; isRetrograde++ )
+    {
+        // Compare zero-revolution solution.
+        BOOST_CHECK( computeLambertTransferIzzo( departurePosition, arrivalPosition, timeOfFlight,
+                                                 gravitationalParameter, velocityAtDeparture, velocityAtArrival,
+                                                 0, false, isRetrograde ) );
+        solveLambertProblemIzzo( departurePosition, arrivalPosition, timeOfFlight, gravitationalParameter,
+                                 expectedVelocityAtDeparture, expectedVelocityAtArrival, isRetrograde );
+        TUDAT_CHECK_MATRIX_CLOSE_FRACTION( velocityAtDeparture, expectedVelocityAtDeparture, 1.0E-14 );
+        TUDAT_CHECK_MATRIX_CLOSE_FRACTION( velocityAtArrival, expectedVelocityAtArrival, 1.0E-14 );
+
+        // Compare multi-revolution solutions.
+        for( int numberOfRevolutions = 1; numberOfRevolutions <= 3; numberOfRevolutions++ )
+        {
+            for( int branch = 0; branch < 2; branch++ )
+            {
+                BOOST_CHECK( computeLambertTransferIzzo(
+                                 departurePosition, arrivalPosition, timeOfFlight, gravitationalParameter,
+                                 velocityAtDeparture, velocityAtArrival, numberOfRevolutions, branch == 1,
+                                 isRetrograde ) );
+                MultiRevolutionLambertTargeterIzzo lambertTargeter(
+                            departurePosition, arrivalPosition, timeOfFlight, gravitationalParameter,
+                            numberOfRevolutions, branch == 1, isRetrograde );
+                TUDAT_CHECK_MATRIX_CLOSE_FRACTION(
+                            velocityAtDeparture, lambertTargeter.getInertialVelocityAtDeparture( ), 1.0E-14 );
+                TUDAT_CHECK_MATRIX_CLOSE_FRACTION(
+                            velocityAtArrival, lambertTargeter.getInertialVelocityAtArrival( ), 1.0E-14 );
+            }
+        }
+    }
+
+    // Check that no solution is returned (and outputs are unchanged) for invalid time-of-flight.
+    velocityAtDeparture.setZero( );
+    velocityAtArrival.setZero( );
+    BOOST_CHECK( !computeLambertTransferIzzo( departurePosition, arrivalPosition, -timeOfFlight,
+                                              gravitationalParameter, velocityAtDeparture, velocityAtArrival ) );
+    BOOST_CHECK( !computeLambertTransferIzzo( departurePosition, arrivalPosition, 0.0,
+                                              gravitationalParameter, velocityAtDeparture, velocityAtArrival ) );
+    BOOST_CHECK_EQUAL( velocityAtDeparture.norm( ), 0.0 );
+    BOOST_CHECK_EQUAL( velocityAtArrival.norm( ), 0.0 );
+
+    // Check that no solution is returned for too many revolutions.
+    BOOST_CHECK( !computeLambertTransferIzzo( departurePosition, arrivalPosition, timeOfFlight,
+                                              gravitationalParameter, velocityAtDeparture, velocityAtArrival,
+                                              10, false ) );
+}
+
+//! Test porkchop grid against loop over existing Lambert routines.
+BOOST_AUTO_TEST_CASE( testLambertPorkchop )
+{
+    const boost::function< Eigen::Vector6d( const double ) > earthStateFunction = getEarthLikeStateFunction( );
+    const boost::function< Eigen::Vector6d( const double ) > marsStateFunction = getMarsLikeStateFunction( );
+
+    const std::vector< double > departureTimes = getEquallySpacedTimes(
+                0.0, 800.0 * physical_constants::JULIAN_DAY, 100 );
+    const std::vector< double > arrivalTimes = getEquallySpacedTimes(
+                100.0 * physical_constants::JULIAN_DAY, 1200.0 * physical_constants::JULIAN_DAY, 100 );
+
+    for( int maximumNumberOfRevolutions = 0; maximumNumberOfRevolutions <= 1; maximumNumberOfRevolutions++ )
+    {
+        // Compute porkchop grid.
+        LambertPorkchopResults porkchopResults = computeLambertPorkchop(
+                    departureTimes, earthStateFunction, arrivalTimes, marsStateFunction, sunGravitationalParameter,
+                    maximumNumberOfRevolutions );
+
+        // Compute same transfers with existing routines, retrieving states for each transfer.
+        Eigen::MatrixXd expectedTotalDeltaV = Eigen::MatrixXd::Constant(
+                    departureTimes.size( ), arrivalTimes.size( ), TUDAT_NAN );
+        for( unsigned int i = 0; i < departureTimes.size( ); i++ )
+        {
+            for( unsigned int j = 0; j < arrivalTimes.size( ); j++ )
+            {
+                if( arrivalTimes.at( j ) > departureTimes.at( i ) )
+                {
+                    expectedTotalDeltaV( i, j ) = computeLowestTotalDeltaVWithSingleCalls(
+                                departureTimes.at( i ), arrivalTimes.at( j ), earthStateFunction,
+                                marsStateFunction, maximumNumberOfRevolutions );
+                }
+            }
+        }
+        // Compare results.
+        BOOST_CHECK_EQUAL( porkchopResults.totalDeltaV_.rows( ), static_cast< int >( departureTimes.size( ) ) );
+        BOOST_CHECK_EQUAL( porkchopResults.totalDeltaV_.cols( ), static_cast< int >( arrivalTimes.size( ) ) );
+        int numberOfSolutions = 0, numberOfMultiRevolutionSolutions = 0;
+        for( unsigned int i = 0; i < departureTimes.size( ); i++ )
+        {
+            for( unsigned int j = 0; j < arrivalTimes.size( ); j++ )
+            {
+                const double totalDeltaV = porkchopResults.totalDeltaV_( i, j );
+                if( arrivalTimes.at( j ) <= departureTimes.at( i ) )
+                {
+                    BOOST_CHECK( totalDeltaV != totalDeltaV );
+                    BOOST_CHECK( porkchopResults.departureC3_( i, j ) != porkchopResults.departureC3_( i, j ) );
+                    BOOST_CHECK_EQUAL( porkchopResults.numberOfRevolutions_( i, j ), -1 );
+                    continue;
+                }
+
+                BOOST_CHECK_EQUAL( totalDeltaV == totalDeltaV,
+                                   expectedTotalDeltaV( i, j ) == expectedTotalDeltaV( i, j ) );
+                if( totalDeltaV == totalDeltaV )
+                {
+                    numberOfSolutions++;
+                    if( porkchopResults.numberOfRevolutions_( i, j ) > 0 )
+                    {
+                        numberOfMultiRevolutionSolutions++;
+                    }
+
+                    BOOST_CHECK_CLOSE_FRACTION( totalDeltaV, expectedTotalDeltaV( i, j ), 1.0E-10 );
+                    BOOST_CHECK_CLOSE_FRACTION(
+                                totalDeltaV, porkchopResults.departureDeltaV_( i, j ) +
+                                porkchopResults.arrivalDeltaV_( i, j ), 1.0E-15 );
+                    BOOST_CHECK_CLOSE_FRACTION(
+                                porkchopResults.departureC3_( i, j ), porkchopResults.departureDeltaV_( i, j ) *
+                                porkchopResults.departureDeltaV_( i, j ), 1.0E-15 );
+                    BOOST_CHECK( porkchopResults.numberOfRevolutions_( i, j ) <= maximumNumberOfRevolutions );
+                }
+            }
+        }
+        BOOST_CHECK( numberOfSolutions > 0 );
+        if( maximumNumberOfRevolutions > 0 )
+        {
+            BOOST_CHECK( numberOfMultiRevolutionSolutions > 0 );
+        }
+
+        // Check that results are independent of the number of threads.
+        for( unsigned int numberOfThreads = 1; numberOfThreads <= 4; numberOfThreads *= 2 )
+        {
+            LambertPorkchopResults currentPorkchopResults = computeLambertPorkchop(
+                        departureTimes, earthStateFunction, arrivalTimes, marsStateFunction,
+                        sunGravitationalParameter, maximumNumberOfRevolutions, numberOfThreads );
+            for( unsigned int i = 0; i < departureTimes.size( ); i++ )
+            {
+                for( unsigned int j = 0; j < arrivalTimes.size( ); j++ )
+                {
+                    if( porkchopResults.totalDeltaV_( i, j ) == porkchopResults.totalDeltaV_( i, j ) )
+                    {
+                        BOOST_CHECK_EQUAL( currentPorkchopResults.totalDeltaV_( i, j ),
+                                           porkchopResults.totalDeltaV_( i, j ) );
+                    }
+                    BOOST_CHECK_EQUAL( currentPorkchopResults.numberOfRevolutions_( i, j ),
+                                       porkchopResults.numberOfRevolutions_( i, j ) );
+                }
+            }
+        }
+    }
+
+    // Check that inconsistent input is rejected.
+    bool isExceptionCaught = false;
+    try
+    {
+        computeLambertPorkchop( departureTimes, std::vector< Eigen::Vector6d >( 1 ), arrivalTimes,
+                                std::vector< Eigen::Vector6d >( arrivalTimes.size( ) ),
+                                sunGravitationalParameter );
+    }
+    catch( std::runtime_error& )
+    {
+        isExceptionCaught = true;
+    }
+    BOOST_CHECK( isExceptionCaught );
+}
+
+BOOST_AUTO_TEST_SUITE_END( )
+
+} // namespace unit_tests
+} // namespace tudat
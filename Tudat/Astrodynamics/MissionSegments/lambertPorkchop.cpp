@@ -0,0 +1,497 @@
+/*    Copyright (c) 2010-2017, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ *
+ *    References
+ *      Izzo, D. lambert_problem.h, keptoolbox.
+ *      PyKEP toolbox, Dario Izzo, ESA Advanced Concepts Team.
+ *
+ */
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <stdexcept>
+
+#include <boost/bind.hpp>
+#include <boost/math/special_functions.hpp>
+
+#include <Eigen/Geometry>
+
+#include "Tudat/Basics/parallelComputation.h"
+#include "Tudat/Mathematics/BasicMathematics/mathematicalConstants.h"
+
+#include "Tudat/Astrodynamics/MissionSegments/lambertPorkchop.h"
+#include "Tudat/Astrodynamics/MissionSegments/lambertRoutines.h"
+
+namespace tudat
+{
+namespace mission_segments
+{
+
+//! Compute time-of-flight using Lagrange's equation, including complete revolutions.
+/*!
+ * Computes the time-of-flight according to Lagrange's equation as a function of the x-parameter, including the time of
+ * a number of complete revolutions (identical to MultiRevolutionLambertTargeterIzzo::computeTimeOfFlight).
+ * \param xParameter x parameter in Izzo's algorithm.
+ * \param semiPerimeter Semi-perimeter.
+ * \param chord Chord.
+ * \param isLongway Boolean flag to indicate if the transfer is long-way.
+ * \param semiMajorAxisOfTheMinimumEnergyEllipse Semi-major axis of the minimum energy ellipse.
+ * \param numberOfRevolutions Number of complete revolutions.
+ * \return Computed time-of-flight.
+ */
+double computeMultiRevolutionTimeOfFlightIzzo( const double xParameter, const double semiPerimeter,
+                                               const double chord, const bool isLongway,
+                                               const double semiMajorAxisOfTheMinimumEnergyEllipse,
+                                               const int numberOfRevolutions )
+{
+    // Determine semi-major axis.
+    const double semiMajorAxis = semiMajorAxisOfTheMinimumEnergyEllipse
+            / ( 1.0 - xParameter * xParameter );
+
+    // If x < 1, the solution is an ellipse.
+    if ( xParameter < 1.0 )
+    {
+        const double alphaParameter = 2.0 * std::acos( xParameter );
+        double betaParameter = 2.0 * std::asin( std::sqrt( ( semiPerimeter - chord ) / ( 2.0 * semiMajorAxis ) ) );
+        if ( isLongway )
+        {
+            betaParameter = -betaParameter;
+        }
+
+        return semiMajorAxis * std::sqrt( semiMajorAxis ) *
+                ( ( alphaParameter - std::sin( alphaParameter ) )
+                  - ( betaParameter - std::sin( betaParameter ) )
+                  + 2.0 * mathematical_constants::PI * numberOfRevolutions );
+    }
+    // Otherwise it is a hyperbola.
+    else
+    {
+        const double alphaParameter = 2.0 * boost::math::acosh( xParameter );
+        double betaParameter = 2.0 * boost::math::asinh(
+                    std::sqrt( ( semiPerimeter - chord ) / ( -2.0 * semiMajorAxis ) ) );
+        if ( isLongway )
+        {
+            betaParameter = -betaParameter;
+        }
+
+        return -semiMajorAxis * std::sqrt( -semiMajorAxis ) *
+                ( ( std::sinh( alphaParameter ) - alphaParameter )
+                  - ( std::sinh( betaParameter ) - betaParameter ) );
+    }
+}
+
+//! Solve Lambert problem for a given number of revolutions using Izzo's algorithm, without throwing exceptions.
+bool computeLambertTransferIzzo( const Eigen::Vector3d& cartesianPositionAtDeparture,
+                                 const Eigen::Vector3d& cartesianPositionAtArrival,
+                                 const double timeOfFlight,
+                                 const double gravitationalParameter,
+                                 Eigen::Vector3d& cartesianVelocityAtDeparture,
+                                 Eigen::Vector3d& cartesianVelocityAtArrival,
+                                 const int numberOfRevolutions,
+                                 const bool isRightBranch,
+                                 const bool isRetrograde,
+                                 const double convergenceTolerance,
+                                 const unsigned int maximumNumberOfIterations )
+{
+    using mathematical_constants::PI;
+
+    if ( !( timeOfFlight > 0.0 ) )
+    {
+        return false;
+    }
+
+    // Compute normalizing values.
+    const double radiusAtArrival = cartesianPositionAtArrival.norm( );
+    const double distanceNormalizingValue = cartesianPositionAtDeparture.norm( );
+    const double velocityNormalizingValue = std::sqrt( gravitationalParameter / distanceNormalizingValue );
+    const double timeNormalizingValue = distanceNormalizingValue / velocityNormalizingValue;
+
+    // Compute transfer geometry parameters in adimensional units.
+    const double cosineOfTransferAngle =
+            cartesianPositionAtDeparture.dot( cartesianPositionAtArrival )
+            / ( distanceNormalizingValue * radiusAtArrival );
+    const double normalizedRadiusAtArrival = radiusAtArrival / distanceNormalizingValue;
+    const double chord = std::sqrt( 1.0 + normalizedRadiusAtArrival
+                                    * ( normalizedRadiusAtArrival - 2.0 * cosineOfTransferAngle ) );
+    const double semiPerimeter = ( 1.0 + normalizedRadiusAtArrival + chord ) / 2.0;
+
+    // Determine whether the transfer corresponds to the long- or the short-way solution.
+    bool isLongway = ( cartesianPositionAtDeparture.x( ) * cartesianPositionAtArrival.y( )
+                       - cartesianPositionAtDeparture.y( ) * cartesianPositionAtArrival.x( ) < 0.0 );
+    if ( isRetrograde )
+    {
+        isLongway = !isLongway;
+    }
+
+    const double semiMajorAxisOfTheMinimumEnergyEllipse = semiPerimeter / 2.0;
+
+    double transferAngle = std::acos( cosineOfTransferAngle );
+    if ( isLongway )
+    {
+        transferAngle = 2.0 * PI - transferAngle;
+    }
+
+    const double lambdaParameter = std::sqrt( normalizedRadiusAtArrival )
+            * std::cos( transferAngle / 2.0 ) / semiPerimeter;
+    const double normalizedSpecifiedTimeOfFlight = timeOfFlight / timeNormalizingValue;
+
+    // Find root of time-of-flight equation using secant method: on log( t ) as a function of log( 1 + x ) for zero
+    // revolutions, and on t as a function of tan( x * pi / 2 ) for multiple revolutions.
+    double xParameter;
+    double x1, x2, y1, y2;
+    double rootFindingError = 1.0, xNew = 0.0, yNew = 0.0;
+    unsigned int iterator = 0;
+    if ( numberOfRevolutions == 0 )
+    {
+        const double logarithmOfTheSpecifiedTimeOfFlight = std::log( normalizedSpecifiedTimeOfFlight );
+
+        x1 = std::log( 0.5 );
+        x2 = std::log( 1.5 );
+        y1 = std::log( computeTimeOfFlightIzzo( -0.5, semiPerimeter, chord, isLongway,
+                                                semiMajorAxisOfTheMinimumEnergyEllipse ) )
+                - logarithmOfTheSpecifiedTimeOfFlight;
+        y2 = std::log( computeTimeOfFlightIzzo( 0.5, semiPerimeter, chord, isLongway,
+                                                semiMajorAxisOfTheMinimumEnergyEllipse ) )
+                - logarithmOfTheSpecifiedTimeOfFlight;
+
+        while ( ( rootFindingError > convergenceTolerance ) && ( y1 != y2 )
+                && ( iterator < maximumNumberOfIterations ) )
+        {
+            iterator++;
+            xNew = ( x1 * y2 - y1 * x2 ) / ( y2 - y1 );
+            yNew = std::log( computeTimeOfFlightIzzo( std::exp( xNew ) - 1.0, semiPerimeter, chord, isLongway,
+                                                      semiMajorAxisOfTheMinimumEnergyEllipse ) )
+                    - logarithmOfTheSpecifiedTimeOfFlight;
+            x1 = x2;
+            y1 = y2;
+            x2 = xNew;
+            y2 = yNew;
+            rootFindingError = std::fabs( x1 - xNew );
+        }
+
+        xParameter = std::exp( xNew ) - 1.0;
+    }
+    else
+    {
+        if ( isRightBranch )
+        {
+            x1 = std::tan( .7234 * PI / 2.0 );
+            x2 = std::tan( .5234 * PI / 2.0 );
+        }
+        else
+        {
+            x1 = std::tan( -.5234 * PI / 2.0 );
+            x2 = std::tan( -.2234 * PI / 2.0 );
+        }
+        y1 = computeMultiRevolutionTimeOfFlightIzzo(
+                    std::atan( x1 ) * 2.0 / PI, semiPerimeter, chord, isLongway,
+                    semiMajorAxisOfTheMinimumEnergyEllipse, numberOfRevolutions ) - normalizedSpecifiedTimeOfFlight;
+        y2 = computeMultiRevolutionTimeOfFlightIzzo(
+                    std::atan( x2 ) * 2.0 / PI, semiPerimeter, chord, isLongway,
+                    semiMajorAxisOfTheMinimumEnergyEllipse, numberOfRevolutions ) - normalizedSpecifiedTimeOfFlight;
+
+        while ( ( rootFindingError > convergenceTolerance ) && ( y1 != y2 )
+                && ( iterator < maximumNumberOfIterations ) )
+        {
+            iterator++;
+            xNew = ( x1 * y2 - y1 * x2 ) / ( y2 - y1 );
+            yNew = computeMultiRevolutionTimeOfFlightIzzo(
+                        std::atan( xNew ) * 2.0 / PI, semiPerimeter, chord, isLongway,
+                        semiMajorAxisOfTheMinimumEnergyEllipse, numberOfRevolutions )
+                    - normalizedSpecifiedTimeOfFlight;
+            x1 = x2;
+            y1 = y2;
+            x2 = xNew;
+            y2 = yNew;
+            rootFindingError = std::fabs( x1 - xNew );
+        }
+
+        xParameter = std::atan( xNew ) * 2.0 / PI;
+    }
+
+    // Verify that root-finder has converged.
+    if ( iterator == maximumNumberOfIterations || !( xParameter == xParameter ) )
+    {
+        return false;
+    }
+
+    // Determine semi-major axis of the conic, and eta parameter.
+    const double semiMajorAxis = semiMajorAxisOfTheMinimumEnergyEllipse / ( 1.0 - xParameter * xParameter );
+    double etaParameter, etaParameterSquared, psiParameter;
+    if ( xParameter < 1.0 )
+    {
+        const double alphaParameter = 2.0 * std::acos( xParameter );
+        double betaParameter = 2.0 * std::asin( std::sqrt( ( semiPerimeter - chord )
+                                                           / ( 2.0 * semiMajorAxis ) ) );
+        if ( isLongway )
+        {
+            betaParameter = -betaParameter;
+        }
+        psiParameter = ( alphaParameter - betaParameter ) / 2.0;
+        etaParameterSquared = 2.0 * semiMajorAxis * std::sin( psiParameter )
+                * std::sin( psiParameter ) / semiPerimeter;
+        etaParameter = std::sqrt( etaParameterSquared );
+    }
+    else
+    {
+        const double alphaParameter = 2.0 * boost::math::acosh( xParameter );
+        double betaParameter = 2.0 * boost::math::asinh(
+                    std::sqrt( ( semiPerimeter - chord ) / ( -2.0 * semiMajorAxis ) ) );
+        if ( isLongway )
+        {
+            betaParameter = -betaParameter;
+        }
+        psiParameter = ( alphaParameter - betaParameter ) / 2.0;
+        etaParameterSquared = -2.0 * semiMajorAxis * std::sinh( psiParameter )
+                * std::sinh( psiParameter ) / semiPerimeter;
+        etaParameter = std::sqrt( etaParameterSquared );
+    }
+
+    // Determine radial and transverse velocity components.
+    const double semiLatusRectum = ( normalizedRadiusAtArrival
+                                     / ( semiMajorAxisOfTheMinimumEnergyEllipse * etaParameterSquared ) )
+            * std::sin( transferAngle / 2.0 )
+            * std::sin( transferAngle / 2.0 );
+    const double radialVelocityAtDeparture =
+            ( 1.0 / ( etaParameter * std::sqrt( semiMajorAxisOfTheMinimumEnergyEllipse ) ) )
+            * ( 2.0 * lambdaParameter * semiMajorAxisOfTheMinimumEnergyEllipse
+                - ( lambdaParameter + xParameter * etaParameter ) );
+    const double transverseVelocityAtDeparture = std::sqrt( semiLatusRectum );
+    const double transverseVelocityAtArrival = transverseVelocityAtDeparture / normalizedRadiusAtArrival;
+    const double radialVelocityAtArrival = ( transverseVelocityAtDeparture - transverseVelocityAtArrival )
+            / std::tan( transferAngle / 2.0 ) - radialVelocityAtDeparture;
+
+    // Determine radial and transverse unit vectors.
+    const Eigen::Vector3d radialUnitVectorAtDeparture = cartesianPositionAtDeparture.normalized( );
+    const Eigen::Vector3d radialUnitVectorAtArrival = cartesianPositionAtArrival.normalized( );
+    const Eigen::Vector3d angularMomentumUnitVector = ( isLongway ?
+                radialUnitVectorAtArrival.cross( radialUnitVectorAtDeparture ) :
+                radialUnitVectorAtDeparture.cross( radialUnitVectorAtArrival ) ).normalized( );
+    const Eigen::Vector3d transverseUnitVectorAtDeparture =
+            radialUnitVectorAtDeparture.cross( angularMomentumUnitVector );
+    const Eigen::Vector3d transverseUnitVectorAtArrival =
+            radialUnitVectorAtArrival.cross( angularMomentumUnitVector );
+
+    // Reconstruct dimensional velocity vectors.
+    const Eigen::Vector3d velocityAtDeparture = velocityNormalizingValue * (
+                radialVelocityAtDeparture * radialUnitVectorAtDeparture
+                - transverseVelocityAtDeparture * transverseUnitVectorAtDeparture );
+    const Eigen::Vector3d velocityAtArrival = velocityNormalizingValue * (
+                radialVelocityAtArrival * radialUnitVectorAtArrival
+                - transverseVelocityAtArrival * transverseUnitVectorAtArrival );
+    if ( !velocityAtDeparture.allFinite( ) || !velocityAtArrival.allFinite( ) )
+    {
+        return false;
+    }
+
+    cartesianVelocityAtDeparture = velocityAtDeparture;
+    cartesianVelocityAtArrival = velocityAtArrival;
+    return true;
+}
+
+//! Compute the maximum number of complete revolutions of a Lambert transfer (first guess, as used by Izzo).
+int computeMaximumNumberOfLambertRevolutions( const Eigen::Vector3d& cartesianPositionAtDeparture,
+                                              const Eigen::Vector3d& cartesianPositionAtArrival,
+                                              const double timeOfFlight,
+                                              const double gravitationalParameter )
+{
+    if ( !( timeOfFlight > 0.0 ) )
+    {
+        return 0;
+    }
+
+    const double distanceNormalizingValue = cartesianPositionAtDeparture.norm( );
+    const double timeNormalizingValue = distanceNormalizingValue /
+            std::sqrt( gravitationalParameter / distanceNormalizingValue );
+    const double normalizedRadiusAtArrival = cartesianPositionAtArrival.norm( ) / distanceNormalizingValue;
+    const double cosineOfTransferAngle =
+            cartesianPositionAtDeparture.dot( cartesianPositionAtArrival )
+            / ( distanceNormalizingValue * cartesianPositionAtArrival.norm( ) );
+    const double chord = std::sqrt( 1.0 + normalizedRadiusAtArrival
+                                    * ( normalizedRadiusAtArrival - 2.0 * cosineOfTransferAngle ) );
+    const double semiPerimeter = ( 1.0 + normalizedRadiusAtArrival + chord ) / 2.0;
+
+    // Divide time-of-flight by time-of-flight of minimum energy ellipse.
+    const double minimumEnergyTimeOfFlight = mathematical_constants::PI / 2.0
+            * std::sqrt( 2.0 * semiPerimeter * semiPerimeter * semiPerimeter );
+    return static_cast< int >( ( timeOfFlight / timeNormalizingValue ) / minimumEnergyTimeOfFlight );
+}
+
+//! Function to compute the Lambert transfers for all departure times, and a single arrival time, of a porkchop grid.
+/*!
+ * Function to compute the Lambert transfers for all departure times, and a single arrival time (i.e. a single column of
+ * the results), of a porkchop grid.
+ * \param arrivalIndex Index of the arrival time for which the transfers are computed.
+ * \param departureStates Cartesian states of departure body at departure times (one per column).
+ * \param arrivalStates Cartesian states of arrival body at arrival times (one per column).
+ * \param gravitationalParameter Gravitational parameter of the central body.
+ * \param maximumNumberOfRevolutions Maximum number of complete revolutions of the transfers that are evaluated.
+ * \param isRetrograde Boolean flag to indicate direction of motion.
+ * \param convergenceTolerance Convergence tolerance for the root-finding process.
+ * \param maximumNumberOfIterations Maximum number of iterations of the root-finding process.
+ * \param results Results of the porkchop grid, of which the column of the arrival time is set (returned by reference).
+ */
+void computeLambertPorkchopColumn( const unsigned int arrivalIndex,
+                                   const Eigen::Matrix< double, 6, Eigen::Dynamic >& departureStates,
+                                   const Eigen::Matrix< double, 6, Eigen::Dynamic >& arrivalStates,
+                                   const double gravitationalParameter,
+                                   const int maximumNumberOfRevolutions,
+                                   const bool isRetrograde,
+                                   const double convergenceTolerance,
+                                   const unsigned int maximumNumberOfIterations,
+                                   LambertPorkchopResults& results )
+{
+    const double arrivalTime = results.arrivalTimes_.at( arrivalIndex );
+    const Eigen::Vector3d arrivalPosition = arrivalStates.block< 3, 1 >( 0, arrivalIndex );
+    const Eigen::Vector3d arrivalVelocity = arrivalStates.block< 3, 1 >( 3, arrivalIndex );
+
+    Eigen::Vector3d departurePosition, departureVelocity;
+    Eigen::Vector3d transferVelocityAtDeparture, transferVelocityAtArrival;
+    for( unsigned int departureIndex = 0; departureIndex < results.departureTimes_.size( ); departureIndex++ )
+    {
+        const double timeOfFlight = arrivalTime - results.departureTimes_[ departureIndex ];
+        if( !( timeOfFlight > 0.0 ) )
+        {
+            continue;
+        }
+
+        departurePosition = departureStates.block< 3, 1 >( 0, departureIndex );
+        departureVelocity = departureStates.block< 3, 1 >( 3, departureIndex );
+
+        // Determine numbers of revolutions that are to be evaluated.
+        int currentMaximumNumberOfRevolutions = 0;
+        if( maximumNumberOfRevolutions > 0 )
+        {
+            currentMaximumNumberOfRevolutions = std::min(
+                        maximumNumberOfRevolutions, computeMaximumNumberOfLambertRevolutions(
+                            departurePosition, arrivalPosition, timeOfFlight, gravitationalParameter ) );
+        }
+
+        // Evaluate all transfers, and retain the one with the lowest total delta-V.
+        double lowestTotalDeltaV = std::numeric_limits< double >::infinity( );
+        for( int numberOfRevolutions = 0; numberOfRevolutions <= currentMaximumNumberOfRevolutions;
+             numberOfRevolutions++ )
+        {
+            for( int branch = 0; branch < ( ( numberOfRevolutions == 0 ) ? 1 : 2 ); branch++ )
+            {
+                if( computeLambertTransferIzzo( departurePosition, arrivalPosition, timeOfFlight,
+                                                gravitationalParameter, transferVelocityAtDeparture,
+                                                transferVelocityAtArrival, numberOfRevolutions, branch == 1,
+                                                isRetrograde, convergenceTolerance, maximumNumberOfIterations ) )
+                {
+                    const double departureDeltaV = ( transferVelocityAtDeparture - departureVelocity ).norm( );
+                    const double arrivalDeltaV = ( transferVelocityAtArrival - arrivalVelocity ).norm( );
+                    if( departureDeltaV + arrivalDeltaV < lowestTotalDeltaV )
+                    {
+                        lowestTotalDeltaV = departureDeltaV + arrivalDeltaV;
+                        results.departureDeltaV_( departureIndex, arrivalIndex ) = departureDeltaV;
+                        results.arrivalDeltaV_( departureIndex, arrivalIndex ) = arrivalDeltaV;
+                        results.totalDeltaV_( departureIndex, arrivalIndex ) = lowestTotalDeltaV;
+                        results.departureC3_( departureIndex, arrivalIndex ) = departureDeltaV * departureDeltaV;
+                        results.numberOfRevolutions_( departureIndex, arrivalIndex ) = numberOfRevolutions;
+                        results.isRightBranch_( departureIndex, arrivalIndex ) = ( branch == 1 );
+                    }
+                }
+            }
+        }
+    }
+}
+
+//! Compute Lambert transfers on a grid of departure and arrival times, from tabulated states.
+LambertPorkchopResults computeLambertPorkchop(
+        const std::vector< double >& departureTimes,
+        const std::vector< Eigen::Vector6d >& departureBodyStates,
+        const std::vector< double >& arrivalTimes,
+        const std::vector< Eigen::Vector6d >& arrivalBodyStates,
+        const double gravitationalParameter,
+        const int maximumNumberOfRevolutions,
+        const unsigned int numberOfThreads,
+        const bool isRetrograde,
+        const double convergenceTolerance,
+        const unsigned int maximumNumberOfIterations )
+{
+    if( departureTimes.size( ) != departureBodyStates.size( ) || arrivalTimes.size( ) != arrivalBodyStates.size( ) )
+    {
+        throw std::runtime_error( "Error when computing Lambert porkchop, number of states (" +
+                                  std::to_string( departureBodyStates.size( ) ) + ", " +
+                                  std::to_string( arrivalBodyStates.size( ) ) +
+                                  ") inconsistent with number of times (" +
+                                  std::to_string( departureTimes.size( ) ) + ", " +
+                                  std::to_string( arrivalTimes.size( ) ) + ")" );
+    }
+
+    const unsigned int numberOfDepartureTimes = departureTimes.size( );
+    const unsigned int numberOfArrivalTimes = arrivalTimes.size( );
+
+    // Initialize results (no transfer found).
+    LambertPorkchopResults results;
+    results.departureTimes_ = departureTimes;
+    results.arrivalTimes_ = arrivalTimes;
+    results.departureDeltaV_.setConstant( numberOfDepartureTimes, numberOfArrivalTimes, TUDAT_NAN );
+    results.arrivalDeltaV_.setConstant( numberOfDepartureTimes, numberOfArrivalTimes, TUDAT_NAN );
+    results.totalDeltaV_.setConstant( numberOfDepartureTimes, numberOfArrivalTimes, TUDAT_NAN );
+    results.departureC3_.setConstant( numberOfDepartureTimes, numberOfArrivalTimes, TUDAT_NAN );
+    results.numberOfRevolutions_.setConstant( numberOfDepartureTimes, numberOfArrivalTimes, -1 );
+    results.isRightBranch_.setConstant( numberOfDepartureTimes, numberOfArrivalTimes, false );
+
+    // Store states contiguously.
+    Eigen::Matrix< double, 6, Eigen::Dynamic > departureStates( 6, numberOfDepartureTimes );
+    for( unsigned int i = 0; i < numberOfDepartureTimes; i++ )
+    {
+        departureStates.col( i ) = departureBodyStates.at( i );
+    }
+    Eigen::Matrix< double, 6, Eigen::Dynamic > arrivalStates( 6, numberOfArrivalTimes );
+    for( unsigned int i = 0; i < numberOfArrivalTimes; i++ )
+    {
+        arrivalStates.col( i ) = arrivalBodyStates.at( i );
+    }
+
+    // Compute transfers, with one task per arrival time (column of results).
+    utilities::executeParallelLoop(
+                numberOfArrivalTimes, numberOfThreads,
+                boost::bind( &computeLambertPorkchopColumn, _1, boost::cref( departureStates ),
+                             boost::cref( arrivalStates ), gravitationalParameter, maximumNumberOfRevolutions,
+                             isRetrograde, convergenceTolerance, maximumNumberOfIterations, boost::ref( results ) ) );
+
+    return results;
+}
+
+//! Compute Lambert transfers on a grid of departure and arrival times, from state functions.
+LambertPorkchopResults computeLambertPorkchop(
+        const std::vector< double >& departureTimes,
+        const boost::function< Eigen::Vector6d( const double ) > departureBodyStateFunction,
+        const std::vector< double >& arrivalTimes,
+        const boost::function< Eigen::Vector6d( const double ) > arrivalBodyStateFunction,
+        const double gravitationalParameter,
+        const int maximumNumberOfRevolutions,
+        const unsigned int numberOfThreads,
+        const bool isRetrograde,
+        const double convergenceTolerance,
+        const unsigned int maximumNumberOfIterations )
+{
+    // Tabulate states of departure and arrival bodies.
+    std::vector< Eigen::Vector6d > departureBodyStates( departureTimes.size( ) );
+    for( unsigned int i = 0; i < departureTimes.size( ); i++ )
+    {
+        departureBodyStates[ i ] = departureBodyStateFunction( departureTimes.at( i ) );
+    }
+    std::vector< Eigen::Vector6d > arrivalBodyStates( arrivalTimes.size( ) );
+    for( unsigned int i = 0; i < arrivalTimes.size( ); i++ )
+    {
+        arrivalBodyStates[ i ] = arrivalBodyStateFunction( arrivalTimes.at( i ) );
+    }
+
+    return computeLambertPorkchop( departureTimes, departureBodyStates, arrivalTimes, arrivalBodyStates,
+                                   gravitationalParameter, maximumNumberOfRevolutions, numberOfThreads,
+                                   isRetrograde, convergenceTolerance, maximumNumberOfIterations );
+}
+
+} // namespace mission_segments
+} // namespace tudat
@@ -0,0 +1,183 @@
+/*    Copyright (c) 2010-2017, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ *
+ *    References
+ *      Izzo, D. lambert_problem.h, keptoolbox.
+ *      PyKEP toolbox, Dario Izzo, ESA Advanced Concepts Team.
+ *
+ */
+
+#ifndef TUDAT_LAMBERT_PORKCHOP_H
+#define TUDAT_LAMBERT_PORKCHOP_H
+
+#include <vector>
+
+#include <boost/function.hpp>
+
+#include <Eigen/Core>
+
+#include "Tudat/Basics/basicTypedefs.h"
+
+namespace tudat
+{
+namespace mission_segments
+{
+
+//! Solve Lambert problem for a given number of revolutions using Izzo's algorithm, without throwing exceptions.
+/*!
+ * Solves the Lambert problem using Izzo's algorithm, for a given number of complete revolutions and (if the number of
+ * revolutions is non-zero) branch of the solution. For zero revolutions, the computations are identical to those of
+ * solveLambertProblemIzzo, for multiple revolutions they are identical to those of MultiRevolutionLambertTargeterIzzo.
+ * Contrary to those implementations, this function does not allocate memory or throw exceptions, but returns false if
+ * no solution is found (non-positive time-of-flight, non-converged root-finder, or non-finite solution), which makes it
+ * suitable for evaluating large numbers of (possibly infeasible) transfers, e.g. for porkchop plots.
+ * \param cartesianPositionAtDeparture Cartesian position at departure. [Input]
+ * \param cartesianPositionAtArrival Cartesian position at arrival. [Input]
+ * \param timeOfFlight Time-of-flight between departure and arrival. [Input]
+ * \param gravitationalParameter Gravitational parameter of the central body. [Input]
+ * \param cartesianVelocityAtDeparture Velocity at departure (unchanged if no solution is found). [Output]
+ * \param cartesianVelocityAtArrival Velocity at arrival (unchanged if no solution is found). [Output]
+ * \param numberOfRevolutions Number of complete revolutions of the transfer. [Input, Optional]
+ * \param isRightBranch Boolean denoting whether the right branch of the multi-revolution solution is computed (unused
+ *          for zero revolutions). [Input, Optional]
+ * \param isRetrograde Boolean flag to indicate direction of motion. [Input, Optional]
+ * \param convergenceTolerance Convergence tolerance for the root-finding process. [Input, Optional]
+ * \param maximumNumberOfIterations Maximum number of iterations of the root-finding process. [Input, Optional]
+ * \return True if a solution was found, false otherwise.
+ */
+bool computeLambertTransferIzzo( const Eigen::Vector3d& cartesianPositionAtDeparture,
+                                 const Eigen::Vector3d& cartesianPositionAtArrival,
+                                 const double timeOfFlight,
+                                 const double gravitationalParameter,
+                                 Eigen::Vector3d& cartesianVelocityAtDeparture,
+                                 Eigen::Vector3d& cartesianVelocityAtArrival,
+                                 const int numberOfRevolutions = 0,
+                                 const bool isRightBranch = false,
+                                 const bool isRetrograde = false,
+                                 const double convergenceTolerance = 1.0e-9,
+                                 const unsigned int maximumNumberOfIterations = 50 );
+
+//! Compute the maximum number of complete revolutions of a Lambert transfer (first guess, as used by Izzo).
+/*!
+ * Computes the maximum number of complete revolutions of a Lambert transfer, from the ratio of the time-of-flight to
+ * the period of the minimum energy ellipse (first guess of MultiRevolutionLambertTargeterIzzo). For a number of
+ * revolutions equal to this maximum, the root-finder may not converge, in which case no solution exists.
+ * \param cartesianPositionAtDeparture Cartesian position at departure.
+ * \param cartesianPositionAtArrival Cartesian position at arrival.
+ * \param timeOfFlight Time-of-flight between departure and arrival.
+ * \param gravitationalParameter Gravitational parameter of the central body.
+ * \return Maximum number of complete revolutions (0 for non-positive time-of-flight).
+ */
+int computeMaximumNumberOfLambertRevolutions( const Eigen::Vector3d& cartesianPositionAtDeparture,
+                                              const Eigen::Vector3d& cartesianPositionAtArrival,
+                                              const double timeOfFlight,
+                                              const double gravitationalParameter );
+
+//! Results of Lambert transfers evaluated on a grid of departure and arrival times.
+/*!
+ * Results of Lambert transfers evaluated on a grid of departure and arrival times (e.g. for a porkchop plot). All
+ * matrices have one row per departure time and one column per arrival time. For each combination, the transfer with
+ * the lowest total delta-V over the evaluated numbers of revolutions and branches is stored. The delta-V values are
+ * the magnitudes of the hyperbolic excess velocities w.r.t. the departure and arrival bodies (i.e. no escape or capture
+ * manoeuvres are included). For combinations without a solution (e.g. arrival before departure), the delta-V and C3
+ * values are NaN and the number of revolutions is -1.
+ */
+struct LambertPorkchopResults
+{
+    //! Departure times of the grid.
+    std::vector< double > departureTimes_;
+
+    //! Arrival times of the grid.
+    std::vector< double > arrivalTimes_;
+
+    //! Magnitude of the hyperbolic excess velocity at departure.
+    Eigen::MatrixXd departureDeltaV_;
+
+    //! Magnitude of the hyperbolic excess velocity at arrival.
+    Eigen::MatrixXd arrivalDeltaV_;
+
+    //! Sum of departure and arrival delta-V.
+    Eigen::MatrixXd totalDeltaV_;
+
+    //! Characteristic energy at departure (square of departure delta-V).
+    Eigen::MatrixXd departureC3_;
+
+    //! Number of complete revolutions of the selected transfer (-1 if no transfer was found).
+    Eigen::MatrixXi numberOfRevolutions_;
+
+    //! Boolean denoting whether the selected transfer is on the right branch (false for 0 revolutions).
+    Eigen::Matrix< bool, Eigen::Dynamic, Eigen::Dynamic > isRightBranch_;
+};
+
+//! Compute Lambert transfers on a grid of departure and arrival times, from tabulated states.
+/*!
+ * Computes Lambert transfers (using Izzo's algorithm, see computeLambertTransferIzzo) between a departure and an
+ * arrival body, for all combinations of departure and arrival times, with the states of the bodies tabulated at the
+ * departure and arrival times, respectively. The transfers are computed in parallel (one task per arrival time). For
+ * each combination, the transfers with 0 up to maximumNumberOfRevolutions complete revolutions (both branches) are
+ * evaluated, and the one with the lowest total delta-V is stored.
+ * \param departureTimes Departure times of the grid.
+ * \param departureBodyStates Cartesian states of the departure body at the departure times.
+ * \param arrivalTimes Arrival times of the grid.
+ * \param arrivalBodyStates Cartesian states of the arrival body at the arrival times.
+ * \param gravitationalParameter Gravitational parameter of the central body.
+ * \param maximumNumberOfRevolutions Maximum number of complete revolutions of the transfers that are evaluated.
+ * \param numberOfThreads Number of threads that are used (if 0, the number of concurrent threads supported by the
+ * hardware is used).
+ * \param isRetrograde Boolean flag to indicate direction of motion.
+ * \param convergenceTolerance Convergence tolerance for the root-finding process.
+ * \param maximumNumberOfIterations Maximum number of iterations of the root-finding process.
+ * \return Results of the Lambert transfers on the grid.
+ */
+LambertPorkchopResults computeLambertPorkchop(
+        const std::vector< double >& departureTimes,
+        const std::vector< Eigen::Vector6d >& departureBodyStates,
+        const std::vector< double >& arrivalTimes,
+        const std::vector< Eigen::Vector6d >& arrivalBodyStates,
+        const double gravitationalParameter,
+        const int maximumNumberOfRevolutions = 0,
+        const unsigned int numberOfThreads = 0,
+        const bool isRetrograde = false,
+        const double convergenceTolerance = 1.0e-9,
+        const unsigned int maximumNumberOfIterations = 50 );
+
+//! Compute Lambert transfers on a grid of departure and arrival times, from state functions.
+/*!
+ * Computes Lambert transfers on a grid of departure and arrival times (see function with tabulated states as input),
+ * with the states of the departure and arrival bodies retrieved from the given functions once per departure and
+ * arrival time, respectively (rather than once per combination of times).
+ * \param departureTimes Departure times of the grid.
+ * \param departureBodyStateFunction Function returning the Cartesian state of the departure body at a given time.
+ * \param arrivalTimes Arrival times of the grid.
+ * \param arrivalBodyStateFunction Function returning the Cartesian state of the arrival body at a given time.
+ * \param gravitationalParameter Gravitational parameter of the central body.
+ * \param maximumNumberOfRevolutions Maximum number of complete revolutions of the transfers that are evaluated.
+ * \param numberOfThreads Number of threads that are used for the Lambert transfers (if 0, the number of concurrent
+ * threads supported by the hardware is used). The state functions are always evaluated by the calling thread.
+ * \param isRetrograde Boolean flag to indicate direction of motion.
+ * \param convergenceTolerance Convergence tolerance for the root-finding process.
+ * \param maximumNumberOfIterations Maximum number of iterations of the root-finding process.
+ * \return Results of the Lambert transfers on the grid.
+ */
+LambertPorkchopResults computeLambertPorkchop(
+        const std::vector< double >& departureTimes,
+        const boost::function< Eigen::Vector6d( const double ) > departureBodyStateFunction,
+        const std::vector< double >& arrivalTimes,
+        const boost::function< Eigen::Vector6d( const double ) > arrivalBodyStateFunction,
+        const double gravitationalParameter,
+        const int maximumNumberOfRevolutions = 0,
+        const unsigned int numberOfThreads = 0,
+        const bool isRetrograde = false,
+        const double convergenceTolerance = 1.0e-9,
+        const unsigned int maximumNumberOfIterations = 50 );
+
+} // namespace mission_segments
+} // namespace tudat
+
+#endif // TUDAT_LAMBERT_PORKCHOP_H
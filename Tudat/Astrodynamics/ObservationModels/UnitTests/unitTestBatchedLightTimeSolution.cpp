@@ -0,0 +1,249 @@
+/*    Copyright (c) 2010-2017, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ */
+
+#define BOOST_TEST_MAIN
+
+#include <numeric>
+
+#include <boost/bind.hpp>
+#include <boost/make_shared.hpp>
+#include <boost/test/unit_test.hpp>
+
+#include "Tudat/Astrodynamics/ObservationModels/lightTimeSolution.h"
+#include "Tudat/Astrodynamics/ObservationModels/UnitTests/testLightTimeCorrections.h"
+
+namespace tudat
+{
+namespace unit_tests
+{
+
+using namespace observation_models;
+
+//! Class providing the state of a body on a circular orbit, which counts the number of state evaluations.
+class CountingCircularOrbitStateFunction
+{
+public:
+
+    //! Constructor
+    /*!
+     * Constructor
+     * \param radius Radius of circular orbit.
+     * \param angularRate Angular rate of body on circular orbit.
+     * \param phase Phase of body on circular orbit at zero time.
+     * \param offset Position of center of circular orbit.
+     */
+    CountingCircularOrbitStateFunction( const double radius, const double angularRate, const double phase,
+                                        const Eigen::Vector3d& offset ):
+        numberOfEvaluations_( 0 ), radius_( radius ), angularRate_( angularRate ), phase_( phase ),
+        offset_( offset ){ }
+
+    //! Function to retrieve the state of the body, and increment the number of state evaluations.
+    /*!
+     * Function to retrieve the state of the body, and increment the number of state evaluations.
+     * \param time Time at which state is to be computed
+     * \return State of body at given time.
+     */
+    Eigen::Vector6d getState( const double time )
+    {
+        numberOfEvaluations_++;
+
+        const double angle = angularRate_ * time + phase_;
+        Eigen::Vector6d state;
+        state << offset_.x( ) + radius_ * std::cos( angle ), offset_.y( ) + radius_ * std::sin( angle ),
+                offset_.z( ) + 0.1 * radius_ * std::sin( angle ),
+                -radius_ * angularRate_ * std::sin( angle ), radius_ * angularRate_ * std::cos( angle ),
+                0.1 * radius_ * angularRate_ * std::cos( angle );
+        return state;
+    }
+
+    //! Number of times the state has been evaluated.
+    int numberOfEvaluations_;
+
+private:
+
+    //! Radius of circular orbit.
+    double radius_;
+
+    //! Angular rate of body on circular orbit.
+    double angularRate_;
+
+    //! Phase of body on circular orbit at zero time.
+    double phase_;
+
+    //! Position of center of circular orbit.
+    Eigen::Vector3d offset_;
+};
+
+//! Function to create list of observation times, consisting of a number of dense tracking passes.
+std::vector< double > getTrackingTimes( const int numberOfPasses, const int numberOfObservationsPerPass,
+                                        const double observationInterval, const double passInterval )
+{
+    std::vector< double > times;
+    for( int i = 0; i < numberOfPasses; i++ )
+    {
+        for( int j = 0; j < numberOfObservationsPerPass; j++ )
+        {
+            times.push_back( static_cast< double >( i ) * passInterval +
+                             static_cast< double >( j ) * observationInterval );
+        }
+    }
+    return times;
+}
+
+BOOST_AUTO_TEST_SUITE( test_batched_light_time )
+
+//! Test whether batched light-time solution reproduces single-epoch light-time solutions.
+BOOST_AUTO_TEST_CASE( testBatchedLightTimeSolution )
+{
+    // Create transmitter (ground station-like) and receiver (lunar orbit-like) state functions.
+    boost::shared_ptr< CountingCircularOrbitStateFunction > transmitterStateFunction =
+            boost::make_shared< CountingCircularOrbitStateFunction >(
+                6.4E6, 7.292115E-5, 0.3, Eigen::Vector3d::Zero( ) );
+    boost::shared_ptr< CountingCircularOrbitStateFunction > receiverStateFunction =
+            boost::make_shared< CountingCircularOrbitStateFunction >(
+                3.844E8, 2.6617E-6, 1.2, Eigen::Vector3d( 1.0E7, -2.0E7, 3.0E6 ) );
+
+    std::vector< double > times = getTrackingTimes( 5, 200, 10.0, 86400.0 );
+
+    // Set light-time corrections.
+    std::vector< LightTimeCorrectionFunction > lightTimeCorrections;
+    lightTimeCorrections.push_back( &getTimeDifferenceLightTimeCorrection );
+    lightTimeCorrections.push_back( &getVelocityDifferenceLightTimeCorrection );
+    lightTimeCorrections.push_back( &getPositionDifferenceLightTimeCorrection );
+
+    // Test without corrections, with iterated corrections and with non-iterated corrections.
+    for( unsigned int testCase = 0; testCase < 3; testCase++ )
+    {
+        boost::shared_ptr< LightTimeCalculator< > > lightTimeCalculator = boost::make_shared< LightTimeCalculator< > >(
+                    boost::bind( &CountingCircularOrbitStateFunction::getState, transmitterStateFunction, _1 ),
+                    boost::bind( &CountingCircularOrbitStateFunction::getState, receiverStateFunction, _1 ),
+                    ( testCase == 0 ) ? std::vector< LightTimeCorrectionFunction >( ) : lightTimeCorrections,
+                    testCase == 1 );
+
+        for( unsigned int isTimeAtReception = 0; isTimeAtReception < 2; isTimeAtReception++ )
+        {
+            // Compute light times one at a time.
+            transmitterStateFunction->numberOfEvaluations_ = 0;
+            receiverStateFunction->numberOfEvaluations_ = 0;
+
+            std::vector< double > singleLightTimes( times.size( ) );
+            std::vector< Eigen::Vector6d > singleReceiverStates( times.size( ) ),
+                    singleTransmitterStates( times.size( ) );
+            for( unsigned int i = 0; i < times.size( ); i++ )
+            {
+                singleLightTimes[ i ] = lightTimeCalculator->calculateLightTimeWithLinkEndsStates(
+                            singleReceiverStates[ i ], singleTransmitterStates[ i ], times[ i ], isTimeAtReception );
+            }
+            int numberOfSingleEvaluations =
+                    transmitterStateFunction->numberOfEvaluations_ + receiverStateFunction->numberOfEvaluations_;
+
+            // Compute light times in batch.
+            transmitterStateFunction->numberOfEvaluations_ = 0;
+            receiverStateFunction->numberOfEvaluations_ = 0;
+
+            std::vector< double > batchedLightTimes;
+            std::vector< Eigen::Vector6d > batchedReceiverStates, batchedTransmitterStates;
+            std::vector< int > numberOfIterations;
+            lightTimeCalculator->calculateLightTimesWithLinkEndsStates(
+                        batchedReceiverStates, batchedTransmitterStates, batchedLightTimes, numberOfIterations,
+                        times, isTimeAtReception );
+            int numberOfBatchedEvaluations =
+                    transmitterStateFunction->numberOfEvaluations_ + receiverStateFunction->numberOfEvaluations_;
+
+            // Compare results
+            BOOST_CHECK_EQUAL( batchedLightTimes.size( ), times.size( ) );
+            BOOST_CHECK_EQUAL( numberOfIterations.size( ), times.size( ) );
+            for( unsigned int i = 0; i < times.size( ); i++ )
+            {
+                BOOST_CHECK_SMALL( batchedLightTimes[ i ] - singleLightTimes[ i ], 2.0E-12 );
+                BOOST_CHECK_SMALL( ( batchedReceiverStates[ i ] - singleReceiverStates[ i ] ).segment( 0, 3 ).norm( ),
+                                   1.0E-3 );
+                BOOST_CHECK_SMALL(
+                            ( batchedTransmitterStates[ i ] - singleTransmitterStates[ i ] ).segment( 0, 3 ).norm( ),
+                            1.0E-3 );
+            }
+
+            // Check number of state function evaluations (state at input time is retrieved once per observation).
+            int numberOfObservations = static_cast< int >( times.size( ) );
+            int totalNumberOfIterations = std::accumulate( numberOfIterations.begin( ), numberOfIterations.end( ), 0 );
+            BOOST_CHECK_EQUAL( numberOfBatchedEvaluations, numberOfObservations + totalNumberOfIterations );
+            BOOST_CHECK( 2 * totalNumberOfIterations <= numberOfSingleEvaluations - numberOfObservations );
+        }
+    }
+
+    // Check that unsorted times are rejected.
+    boost::shared_ptr< LightTimeCalculator< > > lightTimeCalculator = boost::make_shared< LightTimeCalculator< > >(
+                boost::bind( &CountingCircularOrbitStateFunction::getState, transmitterStateFunction, _1 ),
+                boost::bind( &CountingCircularOrbitStateFunction::getState, receiverStateFunction, _1 ) );
+    std::vector< double > unsortedTimes = times;
+    std::swap( unsortedTimes.at( 10 ), unsortedTimes.at( 11 ) );
+
+    std::vector< double > batchedLightTimes;
+    std::vector< Eigen::Vector6d > batchedReceiverStates, batchedTransmitterStates;
+    std::vector< int > numberOfIterations;
+    bool isExceptionCaught = false;
+    try
+    {
+        lightTimeCalculator->calculateLightTimesWithLinkEndsStates(
+                    batchedReceiverStates, batchedTransmitterStates, batchedLightTimes, numberOfIterations,
+                    unsortedTimes );
+    }
+    catch( const std::runtime_error& )
+    {
+        isExceptionCaught = true;
+    }
+    BOOST_CHECK_EQUAL( isExceptionCaught, true );
+}
+
+//! Test whether batched light-time solution reproduces single-epoch light-time solutions for long, densely sampled
+//! tracking passes.
+BOOST_AUTO_TEST_CASE( testBatchedLightTimeSolutionDenseTracking )
+{
+    boost::shared_ptr< CountingCircularOrbitStateFunction > transmitterStateFunction =
+            boost::make_shared< CountingCircularOrbitStateFunction >(
+                6.4E6, 7.292115E-5, 0.3, Eigen::Vector3d::Zero( ) );
+    boost::shared_ptr< CountingCircularOrbitStateFunction > receiverStateFunction =
+            boost::make_shared< CountingCircularOrbitStateFunction >(
+                3.844E8, 2.6617E-6, 1.2, Eigen::Vector3d( 1.0E7, -2.0E7, 3.0E6 ) );
+    boost::shared_ptr< LightTimeCalculator< > > lightTimeCalculator = boost::make_shared< LightTimeCalculator< > >(
+                boost::bind( &CountingCircularOrbitStateFunction::getState, transmitterStateFunction, _1 ),
+                boost::bind( &CountingCircularOrbitStateFunction::getState, receiverStateFunction, _1 ) );
+
+    std::vector< double > times = getTrackingTimes( 10, 10000, 1.0, 86400.0 );
+
+    // Compute light times one at a time.
+    std::vector< double > singleLightTimes( times.size( ) );
+    Eigen::Vector6d receiverState, transmitterState;
+    for( unsigned int i = 0; i < times.size( ); i++ )
+    {
+        singleLightTimes[ i ] = lightTimeCalculator->calculateLightTimeWithLinkEndsStates(
+                    receiverState, transmitterState, times[ i ] );
+    }
+
+    // Compute light times in batch.
+    std::vector< double > batchedLightTimes;
+    std::vector< Eigen::Vector6d > batchedReceiverStates, batchedTransmitterStates;
+    std::vector< int > numberOfIterations;
+    lightTimeCalculator->calculateLightTimesWithLinkEndsStates(
+                batchedReceiverStates, batchedTransmitterStates, batchedLightTimes, numberOfIterations, times );
+    BOOST_CHECK_EQUAL( batchedLightTimes.size( ), times.size( ) );
+
+    double maximumDifference = 0.0;
+    for( unsigned int i = 0; i < times.size( ); i++ )
+    {
+        maximumDifference = std::max( maximumDifference, std::fabs( batchedLightTimes[ i ] - singleLightTimes[ i ] ) );
+    }
+    BOOST_CHECK_SMALL( maximumDifference, 2.0E-12 );
+}
+
+BOOST_AUTO_TEST_SUITE_END( )
+
+} // namespace unit_tests
+} // namespace tudat
@@ -16,6 +16,8 @@
 #include <boost/function.hpp>
 #include <iostream>
 #include <map>
+#include <stdexcept>
+#include <string>
 #include <vector>
 
 #include "Tudat/Basics/basicTypedefs.h"
@@ -383,6 +385,160 @@ public:
         return newLightTimeCalculation;
     }
 
+    //! Function to calculate the light times and link-ends states for a sorted list of observation times.
+    /*!
+     *  Function to calculate the transmitter states at transmission time, the receiver states at reception time, and
+     *  the light times, for a list of observation times of a single link, sorted in ascending order. The light-time
+     *  equation f(tau) = tau - ( |r_R(t_R) - r_T(t_T)| / c + corrections ) is solved using Newton iterations, in which
+     *  the derivative of the range w.r.t. the light time is computed from the velocity of the link end that is not
+     *  fixed at the input time (the derivative of the corrections is neglected). Each iteration is started from the
+     *  light time at the previous observation time, extrapolated using the light-time rate between the previous two
+     *  observation times, so that the number of state function evaluations per observation is reduced considerably
+     *  compared to the calculateLightTimeWithLinkEndsStates function. The light-time corrections are handled as in
+     *  that function: if they are not iterated, they are recomputed once upon convergence, after which an additional
+     *  iteration is performed.
+     *  \param receiverStatesOutput Output by reference of receiver states (resized to size of times).
+     *  \param transmitterStatesOutput Output by reference of transmitter states (resized to size of times).
+     *  \param lightTimesOutput Output by reference of light times (resized to size of times).
+     *  \param numberOfIterationsOutput Output by reference of number of iterations (each requiring an evaluation of the
+     *  state function of the link end that is not fixed at the input time) per observation time.
+     *  \param times Times at reception or transmission, sorted in ascending order.
+     *  \param isTimeAtReception True if input times are at reception, false if at transmission.
+     *  \param tolerance Maximum allowed light-time difference between two subsequent iterations
+     *  for which solution is accepted.
+     */
+    void calculateLightTimesWithLinkEndsStates(
+            std::vector< StateType >& receiverStatesOutput,
+            std::vector< StateType >& transmitterStatesOutput,
+            std::vector< ObservationScalarType >& lightTimesOutput,
+            std::vector< int >& numberOfIterationsOutput,
+            const std::vector< TimeType >& times,
+            const bool isTimeAtReception = true,
+            const ObservationScalarType tolerance =
+            ( getDefaultLightTimeTolerance< ObservationScalarType >( ) ) )
+    {
+        using std::fabs;
+
+        const ObservationScalarType speedOfLight = physical_constants::getSpeedOfLight< ObservationScalarType >( );
+
+        receiverStatesOutput.resize( times.size( ) );
+        transmitterStatesOutput.resize( times.size( ) );
+        lightTimesOutput.resize( times.size( ) );
+        numberOfIterationsOutput.resize( times.size( ) );
+
+        TimeType receptionTime, transmissionTime;
+        StateType receiverState, transmitterState;
+        PositionType relativePosition;
+        for( unsigned int i = 0; i < times.size( ); i++ )
+        {
+            const TimeType time = times.at( i );
+
+            // Set initial light-time estimate from previous observation time(s), or zero for the first one.
+            ObservationScalarType currentLightTime =
+                    mathematical_constants::getFloatingInteger< ObservationScalarType >( 0 );
+            if( i > 0 )
+            {
+                if( time < times.at( i - 1 ) )
+                {
+                    throw std::runtime_error( "Error when calculating light times for list of observation times, "
+                                              "times are not sorted" );
+                }
+
+                currentLightTime = lightTimesOutput.at( i - 1 );
+                if( i > 1 && times.at( i - 1 ) != times.at( i - 2 ) )
+                {
+                    currentLightTime += ( lightTimesOutput.at( i - 1 ) - lightTimesOutput.at( i - 2 ) ) *
+                            static_cast< ObservationScalarType >( time - times.at( i - 1 ) ) /
+                            static_cast< ObservationScalarType >( times.at( i - 1 ) - times.at( i - 2 ) );
+                }
+            }
+
+            // Retrieve state of link end that is fixed at input time.
+            if( isTimeAtReception )
+            {
+                receptionTime = time;
+                receiverState = stateFunctionOfReceivingBody_( receptionTime );
+            }
+            else
+            {
+                transmissionTime = time;
+                transmitterState = stateFunctionOfTransmittingBody_( transmissionTime );
+            }
+
+            // Set variable determining whether to update the light time each iteration (corrections are always
+            // computed in the first iteration).
+            bool updateLightTimeCorrections = ( iterateCorrections_ || correctionFunctions_.size( ) == 0 );
+
+            int counter = 0;
+            bool isToleranceReached = false;
+            ObservationScalarType newLightTime, lightTimeDerivative;
+            while( !isToleranceReached )
+            {
+                // Retrieve state of link end that is not fixed at input time, and light-time derivative of range.
+                if( isTimeAtReception )
+                {
+                    transmissionTime = time - currentLightTime;
+                    transmitterState = stateFunctionOfTransmittingBody_( transmissionTime );
+                }
+                else
+                {
+                    receptionTime = time + currentLightTime;
+                    receiverState = stateFunctionOfReceivingBody_( receptionTime );
+                }
+                relativePosition = ( receiverState - transmitterState ).segment( 0, 3 );
+                lightTimeDerivative = relativePosition.normalized( ).dot(
+                            isTimeAtReception ? transmitterState.segment( 3, 3 ) : receiverState.segment( 3, 3 ) ) /
+                        speedOfLight;
+
+                if( updateLightTimeCorrections || counter == 0 )
+                {
+                    setTotalLightTimeCorrection( transmitterState, receiverState, transmissionTime, receptionTime );
+                }
+
+                // Perform Newton update of light time.
+                newLightTime = currentLightTime -
+                        ( currentLightTime - calculateNewLightTimeEstime( receiverState, transmitterState ) ) /
+                        ( mathematical_constants::getFloatingInteger< ObservationScalarType >( 1 ) -
+                          lightTimeDerivative );
+                counter++;
+
+                // Check for convergence.
+                if( fabs( newLightTime - currentLightTime ) < tolerance )
+                {
+                    // If convergence reached, but light-time corrections not iterated,
+                    // perform 1 more iteration to check for change in correction.
+                    if( !updateLightTimeCorrections )
+                    {
+                        updateLightTimeCorrections = true;
+                    }
+                    else
+                    {
+                        isToleranceReached = true;
+                    }
+                }
+                else if( counter == 50 )
+                {
+                    isToleranceReached = true;
+                    std::string errorMessage  =
+                            "Warning, light time unconverged at level " +
+                            std::to_string( fabs( newLightTime - currentLightTime ) ) +
+                            "; current light-time corrections are: "  +
+                            std::to_string( currentCorrection_ ) + " and input time was " +
+                            std::to_string( static_cast< double >( time ) );
+                    std::cerr << errorMessage << std::endl;
+                }
+
+                currentLightTime = newLightTime;
+            }
+
+            // Set output variables.
+            receiverStatesOutput[ i ] = receiverState;
+            transmitterStatesOutput[ i ] = transmitterState;
+            lightTimesOutput[ i ] = newLightTime;
+            numberOfIterationsOutput[ i ] = counter;
+        }
+    }
+
     //! Function to get the part wrt linkend position
     /*!
      *  Function to get the part wrt linkend position
@@ -103,13 +103,16 @@ protected:
 
     //! Function to get the state transition and sensitivity matrix.
     /*!
-     *  Function to get the state transition matrix Phi and sensitivity matrix S at a given time as a single matrix [Phi;S]
+     *  Function to get the state transition matrix Phi and sensitivity matrix S at a given time as a single matrix [Phi;S].
+     *  The interpolator lookup hints of this object are used, so that observation managers that share the
+     *  stateTransitionMatrixInterface_ may be used concurrently from multiple threads.
      *  \param evaluationTime Time at which matrices are to be evaluated
      *  \return Concatenated state transition and sensitivity matrices at given time.
      */
     Eigen::MatrixXd getCombinedStateTransitionAndSensitivityMatrix( const double evaluationTime )
     {
-        return stateTransitionMatrixInterface_->getFullCombinedStateTransitionAndSensitivityMatrix( evaluationTime );
+        return stateTransitionMatrixInterface_->getFullCombinedStateTransitionAndSensitivityMatrix(
+                    evaluationTime, stateTransitionMatrixLookupHints_ );
     }
 
 
@@ -119,6 +122,9 @@ protected:
     //! Object used to compute the state transition/sensitivity matrix at a given time
     boost::shared_ptr< propagators::CombinedStateTransitionAndSensitivityMatrixInterface > stateTransitionMatrixInterface_;
 
+    //! Interpolator lookup hints used when evaluating the state transition/sensitivity matrix of this object.
+    propagators::StateTransitionMatrixLookupHints stateTransitionMatrixLookupHints_;
+
     //!  Map of objects (one per set of link ends) used to compute the scaling of position partials that are used to
     //! compute the observation partials in the derived class
     std::map< LinkEnds, boost::shared_ptr< observation_partials::PositionPartialScaling  > > observationPartialScalers_;
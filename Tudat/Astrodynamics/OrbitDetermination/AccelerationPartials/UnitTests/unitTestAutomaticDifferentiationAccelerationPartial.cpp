@@ -0,0 +1,226 @@
+/*    Copyright (c) 2010-2017, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ */
+
+#define BOOST_TEST_MAIN
+
+#include <boost/make_shared.hpp>
+#include <boost/test/unit_test.hpp>
+
+#include "Tudat/Basics/testMacros.h"
+#include "Tudat/Astrodynamics/BasicAstrodynamics/automaticDifferentiationAcceleration.h"
+#include "Tudat/Astrodynamics/OrbitDetermination/AccelerationPartials/automaticDifferentiationAccelerationPartial.h"
+#include "Tudat/Astrodynamics/OrbitDetermination/AccelerationPartials/numericalAccelerationPartial.h"
+#include "Tudat/SimulationSetup/EstimationSetup/createAccelerationPartials.h"
+
+namespace tudat
+{
+namespace unit_tests
+{
+
+using namespace tudat::basic_astrodynamics;
+using namespace tudat::acceleration_partials;
+using namespace tudat::estimatable_parameters;
+
+//! Functor computing a drag-like acceleration in an exponential atmosphere, with the drag coefficient as parameter.
+struct ExponentialDragAccelerationFunctor
+{
+    template< typename ScalarType >
+    Eigen::Matrix< ScalarType, 3, 1 > operator( )(
+            const double time, const Eigen::Matrix< ScalarType, 6, 1 >& relativeState,
+            const Eigen::Matrix< ScalarType, 1, 1 >& parameters ) const
+    {
+        using std::exp;
+        using basic_mathematics::exp;
+
+        ScalarType density = densityAtReferenceRadius_ * exp(
+                    -( relativeState.template segment< 3 >( 0 ).norm( ) - referenceRadius_ ) / scaleHeight_ );
+        ScalarType speed = relativeState.template segment< 3 >( 3 ).norm( );
+        return -0.5 * areaToMassRatio_ * ( parameters( 0 ) * density * speed ) *
+                relativeState.template segment< 3 >( 3 );
+    }
+
+    double densityAtReferenceRadius_ = 1.0E-11;
+    double referenceRadius_ = 6.778E6;
+    double scaleHeight_ = 7.0E4;
+    double areaToMassRatio_ = 0.02;
+};
+
+//! Drag coefficient, used as estimatable parameter of acceleration defined by ExponentialDragAccelerationFunctor.
+class TestDragCoefficientParameter: public EstimatableParameter< double >
+{
+public:
+    TestDragCoefficientParameter( const double dragCoefficient ):
+        EstimatableParameter< double >( constant_drag_coefficient, "Vehicle" ), dragCoefficient_( dragCoefficient ){ }
+
+    double getParameterValue( ){ return dragCoefficient_; }
+
+    void setParameterValue( const double parameterValue ){ dragCoefficient_ = parameterValue; }
+
+    int getParameterSize( ){ return 1; }
+
+private:
+    double dragCoefficient_;
+};
+
+BOOST_AUTO_TEST_SUITE( test_automatic_differentiation_acceleration_partial )
+
+//! Test automatic differentiation partials against analytical and numerical partials.
+BOOST_AUTO_TEST_CASE( testAutomaticDifferentiationAccelerationPartial )
+{
+    // Create environment.
+    simulation_setup::NamedBodyMap bodyMap;
+    bodyMap[ "Earth" ] = boost::make_shared< simulation_setup::Body >( );
+    bodyMap[ "Vehicle" ] = boost::make_shared< simulation_setup::Body >( );
+
+    Eigen::Vector6d earthState = ( Eigen::Vector6d( ) << 1.0E5, -2.0E5, 3.0E4, 1.0, -2.0, 0.5 ).finished( );
+    Eigen::Vector6d vehicleState = ( Eigen::Vector6d( ) << 6.5E6, 1.8E6, 1.2E6, -1.5E3, 6.8E3, 2.1E3 ).finished( );
+    bodyMap[ "Earth" ]->setState( earthState );
+    bodyMap[ "Vehicle" ]->setState( vehicleState );
+
+    boost::shared_ptr< TestDragCoefficientParameter > dragCoefficient =
+            boost::make_shared< TestDragCoefficientParameter >( 2.2 );
+
+    // Create acceleration and partial.
+    ExponentialDragAccelerationFunctor accelerationFunctor;
+    boost::shared_ptr< AutomaticDifferentiationAcceleration > accelerationModel =
+            createAutomaticDifferentiationAcceleration< 1 >(
+                accelerationFunctor,
+                boost::bind( &simulation_setup::Body::getState, bodyMap[ "Vehicle" ] ),
+                boost::bind( &simulation_setup::Body::getState, bodyMap[ "Earth" ] ),
+                { boost::bind( &TestDragCoefficientParameter::getParameterValue, dragCoefficient ) } );
+    BOOST_CHECK_EQUAL( getAccelerationModelType( accelerationModel ), automatic_differentiation_acceleration );
+
+    boost::shared_ptr< AutomaticDifferentiationAccelerationPartial > accelerationPartial =
+            boost::make_shared< AutomaticDifferentiationAccelerationPartial >(
+                accelerationModel, "Vehicle", "Earth",
+                std::vector< EstimatebleParameterIdentifier >( { dragCoefficient->getParameterName( ) } ) );
+
+    // Compute acceleration and partials.
+    accelerationPartial->update( 0.0 );
+    Eigen::Vector3d acceleration = accelerationModel->getAcceleration( );
+
+    Eigen::MatrixXd partialWrtVehicleState = Eigen::MatrixXd::Zero( 3, 6 );
+    accelerationPartial->wrtStateOfAcceleratedBody( partialWrtVehicleState.block( 0, 0, 3, 6 ) );
+    Eigen::MatrixXd partialWrtEarthState = Eigen::MatrixXd::Zero( 3, 6 );
+    accelerationPartial->wrtStateOfAcceleratingBody( partialWrtEarthState.block( 0, 0, 3, 6 ) );
+
+    std::pair< boost::function< void( Eigen::MatrixXd& ) >, int > parameterPartialFunction =
+            accelerationPartial->getParameterPartialFunction( dragCoefficient );
+    BOOST_CHECK_EQUAL( parameterPartialFunction.second, 1 );
+    Eigen::MatrixXd partialWrtDragCoefficient;
+    parameterPartialFunction.first( partialWrtDragCoefficient );
+
+    // Compute analytical acceleration and partials.
+    Eigen::Vector6d relativeState = vehicleState - earthState;
+    Eigen::Vector3d relativePosition = relativeState.segment( 0, 3 );
+    Eigen::Vector3d relativeVelocity = relativeState.segment( 3, 3 );
+    double density = accelerationFunctor.densityAtReferenceRadius_ *
+            std::exp( -( relativePosition.norm( ) - accelerationFunctor.referenceRadius_ ) /
+                      accelerationFunctor.scaleHeight_ );
+    double dragFactor = 0.5 * accelerationFunctor.areaToMassRatio_ * dragCoefficient->getParameterValue( ) * density;
+
+    Eigen::Vector3d expectedAcceleration = -dragFactor * relativeVelocity.norm( ) * relativeVelocity;
+    Eigen::Matrix< double, 3, 6 > expectedStatePartial;
+    expectedStatePartial.block( 0, 0, 3, 3 ) = -expectedAcceleration * relativePosition.transpose( ) /
+            ( accelerationFunctor.scaleHeight_ * relativePosition.norm( ) );
+    expectedStatePartial.block( 0, 3, 3, 3 ) = -dragFactor * (
+                relativeVelocity.norm( ) * Eigen::Matrix3d::Identity( ) +
+                relativeVelocity * relativeVelocity.transpose( ) / relativeVelocity.norm( ) );
+    Eigen::Vector3d expectedPartialWrtDragCoefficient = expectedAcceleration / dragCoefficient->getParameterValue( );
+
+    // Check automatic differentiation results against analytical results.
+    for( int i = 0; i < 3; i++ )
+    {
+        BOOST_CHECK_CLOSE_FRACTION( acceleration( i ), expectedAcceleration( i ), 1.0E-15 );
+        BOOST_CHECK_CLOSE_FRACTION( partialWrtDragCoefficient( i, 0 ), expectedPartialWrtDragCoefficient( i ),
+                                    1.0E-15 );
+        for( int j = 0; j < 6; j++ )
+        {
+            BOOST_CHECK_SMALL( partialWrtVehicleState( i, j ) - expectedStatePartial( i, j ),
+                               1.0E-15 * expectedStatePartial.block( 0, 3 * ( j / 3 ), 3, 3 ).norm( ) );
+            BOOST_CHECK_EQUAL( partialWrtEarthState( i, j ), -partialWrtVehicleState( i, j ) );
+        }
+    }
+
+    // Check acceleration computed without partials.
+    accelerationModel->resetTime( TUDAT_NAN );
+    accelerationModel->updateMembers( 1.0 );
+    TUDAT_CHECK_MATRIX_CLOSE_FRACTION( accelerationModel->getAcceleration( ), expectedAcceleration, 1.0E-15 );
+
+    // Compute numerical partials.
+    boost::function< void( Eigen::Vector6d ) > vehicleStateSetFunction =
+            boost::bind( &simulation_setup::Body::setState, bodyMap[ "Vehicle" ], _1 );
+    Eigen::Vector3d positionPerturbation = Eigen::Vector3d::Constant( 10.0 );
+    Eigen::Vector3d velocityPerturbation = Eigen::Vector3d::Constant( 1.0E-2 );
+    Eigen::Matrix< double, 3, 7 > numericalPartials;
+    numericalPartials.block( 0, 0, 3, 3 ) = calculateAccelerationWrtStatePartials(
+                vehicleStateSetFunction, accelerationModel, vehicleState, positionPerturbation, 0 );
+    numericalPartials.block( 0, 3, 3, 3 ) = calculateAccelerationWrtStatePartials(
+                vehicleStateSetFunction, accelerationModel, vehicleState, velocityPerturbation, 3 );
+    numericalPartials.block( 0, 6, 3, 1 ) = calculateAccelerationWrtParameterPartials(
+                dragCoefficient, accelerationModel, 1.0E-4 );
+
+    TUDAT_CHECK_MATRIX_CLOSE_FRACTION( numericalPartials.block( 0, 0, 3, 3 ),
+                                       partialWrtVehicleState.block( 0, 0, 3, 3 ), 1.0E-6 );
+    TUDAT_CHECK_MATRIX_CLOSE_FRACTION( numericalPartials.block( 0, 3, 3, 3 ),
+                                       partialWrtVehicleState.block( 0, 3, 3, 3 ), 1.0E-6 );
+    TUDAT_CHECK_MATRIX_CLOSE_FRACTION( numericalPartials.block( 0, 6, 3, 1 ), partialWrtDragCoefficient, 1.0E-8 );
+}
+
+//! Test creation of automatic differentiation acceleration partial from acceleration model map.
+BOOST_AUTO_TEST_CASE( testAutomaticDifferentiationAccelerationPartialCreation )
+{
+    simulation_setup::NamedBodyMap bodyMap;
+    bodyMap[ "Earth" ] = boost::make_shared< simulation_setup::Body >( );
+    bodyMap[ "Vehicle" ] = boost::make_shared< simulation_setup::Body >( );
+    bodyMap[ "Vehicle" ]->setState(
+                ( Eigen::Vector6d( ) << 6.5E6, 1.8E6, 1.2E6, -1.5E3, 6.8E3, 2.1E3 ).finished( ) );
+
+    boost::shared_ptr< AutomaticDifferentiationAcceleration > accelerationModel =
+            createAutomaticDifferentiationAcceleration< 1 >(
+                ExponentialDragAccelerationFunctor( ),
+                boost::bind( &simulation_setup::Body::getState, bodyMap[ "Vehicle" ] ),
+                boost::bind( &simulation_setup::Body::getState, bodyMap[ "Earth" ] ),
+                { boost::lambda::constant( 2.2 ) } );
+
+    boost::shared_ptr< AccelerationPartial > accelerationPartial =
+            simulation_setup::createAnalyticalAccelerationPartial< double >(
+                accelerationModel, std::make_pair( "Vehicle", bodyMap[ "Vehicle" ] ),
+                std::make_pair( "Earth", bodyMap[ "Earth" ] ), bodyMap );
+    BOOST_CHECK( boost::dynamic_pointer_cast< AutomaticDifferentiationAccelerationPartial >( accelerationPartial )
+                 != NULL );
+
+    accelerationPartial->update( 0.0 );
+    Eigen::MatrixXd partialWrtVehicleState = Eigen::MatrixXd::Zero( 3, 6 );
+    accelerationPartial->wrtStateOfAcceleratedBody( partialWrtVehicleState.block( 0, 0, 3, 6 ) );
+    TUDAT_CHECK_MATRIX_CLOSE_FRACTION( partialWrtVehicleState,
+                                       accelerationModel->getCurrentPartials( ).block( 0, 0, 3, 6 ),
+                                       std::numeric_limits< double >::epsilon( ) );
+
+    // Check that inconsistent number of parameters is detected.
+    bool isExceptionCaught = false;
+    try
+    {
+        createAutomaticDifferentiationAcceleration< 1 >(
+                    ExponentialDragAccelerationFunctor( ),
+                    boost::bind( &simulation_setup::Body::getState, bodyMap[ "Vehicle" ] ),
+                    boost::bind( &simulation_setup::Body::getState, bodyMap[ "Earth" ] ) );
+    }
+    catch( std::runtime_error& )
+    {
+        isExceptionCaught = true;
+    }
+    BOOST_CHECK( isExceptionCaught );
+}
+
+BOOST_AUTO_TEST_SUITE_END( )
+
+} // namespace unit_tests
+} // namespace tudat
@@ -0,0 +1,359 @@
+/*    Copyright (c) 2010-2017, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ */
+
+#define BOOST_TEST_MAIN
+
+#include <boost/make_shared.hpp>
+#include <boost/lambda/lambda.hpp>
+#include <boost/test/unit_test.hpp>
+
+#include "Tudat/Basics/testMacros.h"
+#include "Tudat/Mathematics/BasicMathematics/coordinateConversions.h"
+#include "Tudat/Astrodynamics/Gravitation/sphericalHarmonicsGravityModel.h"
+#include "Tudat/Astrodynamics/OrbitDetermination/AccelerationPartials/sphericalHarmonicAccelerationPartial.h"
+#include "Tudat/Astrodynamics/OrbitDetermination/AccelerationPartials/sphericalHarmonicPartialFunctions.h"
+#include "Tudat/Astrodynamics/OrbitDetermination/EstimatableParameters/sphericalHarmonicCosineCoefficients.h"
+#include "Tudat/Astrodynamics/OrbitDetermination/EstimatableParameters/sphericalHarmonicSineCoefficients.h"
+
+namespace tudat
+{
+namespace unit_tests
+{
+
+using namespace tudat::acceleration_partials;
+using namespace tudat::estimatable_parameters;
+
+//! Function to create a set of (non-physical, but well-conditioned) spherical harmonic coefficients.
+void getTestCoefficients( const int maximumDegree, Eigen::MatrixXd& cosineCoefficients,
+                          Eigen::MatrixXd& sineCoefficients )
+{
+    cosineCoefficients = Eigen::MatrixXd::Zero( maximumDegree + 1, maximumDegree + 1 );
+    sineCoefficients = Eigen::MatrixXd::Zero( maximumDegree + 1, maximumDegree + 1 );
+    cosineCoefficients( 0, 0 ) = 1.0;
+    for( int i = 2; i <= maximumDegree; i++ )
+    {
+        for( int j = 0; j <= i; j++ )
+        {
+            cosineCoefficients( i, j ) = 1.0E-6 * std::cos( static_cast< double >( 3 * i + 7 * j ) ) /
+                    static_cast< double >( i * i );
+            if( j > 0 )
+            {
+                sineCoefficients( i, j ) = 1.0E-6 * std::sin( static_cast< double >( 5 * i + 2 * j ) ) /
+                        static_cast< double >( i * i );
+            }
+        }
+    }
+}
+
+//! Function to get list of indices of all coefficients of a given degree and order range.
+std::vector< std::pair< int, int > > getAllBlockIndices( const int minimumDegree, const int maximumDegree,
+                                                         const int minimumOrder )
+{
+    std::vector< std::pair< int, int > > blockIndices;
+    for( int i = minimumDegree; i <= maximumDegree; i++ )
+    {
+        for( int j = minimumOrder; j <= i; j++ )
+        {
+            blockIndices.push_back( std::make_pair( i, j ) );
+        }
+    }
+    return blockIndices;
+}
+
+BOOST_AUTO_TEST_SUITE( test_fused_spherical_harmonic_partials )
+
+//! Test whether fused computation of gradient, Hessian and coefficient partials matches separate computations.
+BOOST_AUTO_TEST_CASE( testFusedSphericalHarmonicPartialKernel )
+{
+    const int maximumDegree = 30;
+    const double gravitationalParameter = 3.986004418E14;
+    const double referenceRadius = 6378137.0;
+
+    Eigen::MatrixXd cosineCoefficients, sineCoefficients;
+    getTestCoefficients( maximumDegree, cosineCoefficients, sineCoefficients );
+
+    // Create cache with second derivatives, as is done by the acceleration partial.
+    boost::shared_ptr< basic_mathematics::SphericalHarmonicsCache > sphericalHarmonicsCache =
+            boost::make_shared< basic_mathematics::SphericalHarmonicsCache >( maximumDegree, maximumDegree + 2 );
+    sphericalHarmonicsCache->getLegendreCache( )->setComputeSecondDerivatives( 1 );
+
+    Eigen::Vector3d cartesianPosition( 4.2E6, -3.5E6, 4.1E6 );
+    Eigen::Vector3d sphericalPosition = coordinate_conversions::convertCartesianToSpherical( cartesianPosition );
+    sphericalPosition( 1 ) = mathematical_constants::PI / 2.0 - sphericalPosition( 1 );
+    sphericalHarmonicsCache->update( sphericalPosition( 0 ), std::sin( sphericalPosition( 1 ) ),
+                                     sphericalPosition( 2 ), referenceRadius );
+
+    // Set all cosine coefficients of degree >= 2, and a subset of sine coefficients (in reversed order) for partials
+    std::vector< std::pair< int, int > > cosineBlockIndices = getAllBlockIndices( 2, maximumDegree, 0 );
+    std::vector< std::pair< int, int > > sineBlockIndices = getAllBlockIndices( 2, 10, 1 );
+    std::reverse( sineBlockIndices.begin( ), sineBlockIndices.end( ) );
+
+    Eigen::MatrixXi cosineColumns = Eigen::MatrixXi::Constant( maximumDegree + 1, maximumDegree + 1, -1 );
+    for( unsigned int i = 0; i < cosineBlockIndices.size( ); i++ )
+    {
+        cosineColumns( cosineBlockIndices.at( i ).first, cosineBlockIndices.at( i ).second ) = i;
+    }
+    Eigen::MatrixXi sineColumns = Eigen::MatrixXi::Constant( maximumDegree + 1, maximumDegree + 1, -1 );
+    for( unsigned int i = 0; i < sineBlockIndices.size( ); i++ )
+    {
+        sineColumns( sineBlockIndices.at( i ).first, sineBlockIndices.at( i ).second ) = i;
+    }
+
+    // Compute fused gradient, Hessian and coefficient partials.
+    Eigen::Vector3d fusedSphericalGradient;
+    Eigen::Matrix3d fusedSphericalHessian;
+    Eigen::MatrixXd fusedCosinePartials = Eigen::MatrixXd::Zero( 3, cosineBlockIndices.size( ) );
+    Eigen::MatrixXd fusedSinePartials = Eigen::MatrixXd::Zero( 3, sineBlockIndices.size( ) );
+    computeSphericalHarmonicGradientHessianAndCoefficientPartials(
+                sphericalPosition, referenceRadius, gravitationalParameter, cosineCoefficients, sineCoefficients,
+                sphericalHarmonicsCache, cosineColumns, sineColumns, fusedSphericalGradient, fusedSphericalHessian,
+                fusedCosinePartials, fusedSinePartials );
+
+    // Compute quantities separately.
+    Eigen::Matrix3d gradientTransformationMatrix =
+            coordinate_conversions::getSphericalToCartesianGradientMatrix( cartesianPosition );
+    Eigen::Vector3d acceleration = gravitation::computeGeodesyNormalizedGravitationalAccelerationSum(
+                cartesianPosition, gravitationalParameter, referenceRadius, cosineCoefficients, sineCoefficients,
+                sphericalHarmonicsCache );
+    Eigen::Matrix3d sphericalHessian = computeCumulativeSphericalHessian(
+                sphericalPosition, referenceRadius, gravitationalParameter, cosineCoefficients, sineCoefficients,
+                sphericalHarmonicsCache );
+    Eigen::MatrixXd cosinePartials = Eigen::MatrixXd::Zero( 3, cosineBlockIndices.size( ) );
+    calculateSphericalHarmonicGravityWrtCCoefficients(
+                sphericalPosition, referenceRadius, gravitationalParameter, sphericalHarmonicsCache, cosineBlockIndices,
+                Eigen::Matrix3d::Identity( ), Eigen::Matrix3d::Identity( ), cosinePartials );
+    Eigen::MatrixXd sinePartials = Eigen::MatrixXd::Zero( 3, sineBlockIndices.size( ) );
+    calculateSphericalHarmonicGravityWrtSCoefficients(
+                sphericalPosition, referenceRadius, gravitationalParameter, sphericalHarmonicsCache, sineBlockIndices,
+                Eigen::Matrix3d::Identity( ), Eigen::Matrix3d::Identity( ), sinePartials );
+
+    // Compare results
+    Eigen::Vector3d fusedAcceleration = gradientTransformationMatrix * fusedSphericalGradient;
+    for( unsigned int i = 0; i < 3; i++ )
+    {
+        BOOST_CHECK_SMALL( std::fabs( fusedAcceleration( i ) - acceleration( i ) ),
+                           1.0E-14 * acceleration.norm( ) );
+        for( unsigned int j = 0; j < 3; j++ )
+        {
+            BOOST_CHECK_SMALL( std::fabs( fusedSphericalHessian( i, j ) - sphericalHessian( i, j ) ),
+                               1.0E-13 * sphericalHessian.cwiseAbs( ).maxCoeff( ) );
+        }
+        for( unsigned int j = 0; j < cosineBlockIndices.size( ); j++ )
+        {
+            BOOST_CHECK_SMALL( std::fabs( fusedCosinePartials( i, j ) - cosinePartials( i, j ) ),
+                               1.0E-14 * cosinePartials.cwiseAbs( ).maxCoeff( ) );
+        }
+        for( unsigned int j = 0; j < sineBlockIndices.size( ); j++ )
+        {
+            BOOST_CHECK_SMALL( std::fabs( fusedSinePartials( i, j ) - sinePartials( i, j ) ),
+                               1.0E-14 * sinePartials.cwiseAbs( ).maxCoeff( ) );
+        }
+    }
+
+    // Check that inconsistent column index matrices are rejected
+    bool isExceptionCaught = false;
+    try
+    {
+        computeSphericalHarmonicGradientHessianAndCoefficientPartials(
+                    sphericalPosition, referenceRadius, gravitationalParameter, cosineCoefficients, sineCoefficients,
+                    sphericalHarmonicsCache, Eigen::MatrixXi::Constant( 3, 3, -1 ), sineColumns,
+                    fusedSphericalGradient, fusedSphericalHessian, fusedCosinePartials, fusedSinePartials );
+    }
+    catch( std::runtime_error& )
+    {
+        isExceptionCaught = true;
+    }
+    BOOST_CHECK_EQUAL( isExceptionCaught, true );
+}
+
+//! Test whether spherical harmonic acceleration partial, which uses the fused computation, produces the same
+//! position and coefficient partials as the separate computations.
+BOOST_AUTO_TEST_CASE( testSphericalHarmonicPartialWithFusedKernel )
+{
+    const int maximumDegree = 20;
+    const double gravitationalParameter = 3.986004418E14;
+    const double referenceRadius = 6378137.0;
+
+    Eigen::MatrixXd cosineCoefficients, sineCoefficients;
+    getTestCoefficients( maximumDegree, cosineCoefficients, sineCoefficients );
+
+    Eigen::Vector3d positionOfAcceleratedBody( 6.1E6, 2.3E6, -1.8E6 );
+    Eigen::Vector3d positionOfAcceleratingBody( 1.0E3, -2.0E3, 5.0E2 );
+    Eigen::Quaterniond rotationToIntegrationFrame =
+            Eigen::Quaterniond( Eigen::AngleAxisd( 0.3, Eigen::Vector3d::UnitZ( ) ) *
+                                Eigen::AngleAxisd( -0.2, Eigen::Vector3d::UnitX( ) ) );
+
+    // Create acceleration model and partial.
+    boost::shared_ptr< gravitation::SphericalHarmonicsGravitationalAccelerationModel > accelerationModel =
+            boost::make_shared< gravitation::SphericalHarmonicsGravitationalAccelerationModel >(
+                boost::lambda::constant( positionOfAcceleratedBody ), gravitationalParameter, referenceRadius,
+                cosineCoefficients, sineCoefficients, boost::lambda::constant( positionOfAcceleratingBody ),
+                boost::lambda::constant( rotationToIntegrationFrame ) );
+    boost::shared_ptr< SphericalHarmonicsGravityPartial > accelerationPartial =
+            boost::make_shared< SphericalHarmonicsGravityPartial >( "Vehicle", "Earth", accelerationModel );
+
+    // Create coefficient parameters (with overlapping cosine blocks).
+    std::vector< boost::shared_ptr< EstimatableParameter< Eigen::VectorXd > > > parameters;
+    parameters.push_back( boost::make_shared< SphericalHarmonicsCosineCoefficients >(
+                              boost::lambda::constant( cosineCoefficients ),
+                              boost::function< void( Eigen::MatrixXd ) >( ),
+                              getAllBlockIndices( 2, 8, 0 ), "Earth" ) );
+    parameters.push_back( boost::make_shared< SphericalHarmonicsCosineCoefficients >(
+                              boost::lambda::constant( cosineCoefficients ),
+                              boost::function< void( Eigen::MatrixXd ) >( ),
+                              getAllBlockIndices( 5, maximumDegree, 3 ), "Earth" ) );
+    parameters.push_back( boost::make_shared< SphericalHarmonicsSineCoefficients >(
+                              boost::lambda::constant( sineCoefficients ),
+                              boost::function< void( Eigen::MatrixXd ) >( ),
+                              getAllBlockIndices( 2, maximumDegree, 1 ), "Earth" ) );
+
+    std::vector< std::pair< boost::function< void( Eigen::MatrixXd& ) >, int > > partialFunctions;
+    for( unsigned int i = 0; i < parameters.size( ); i++ )
+    {
+        partialFunctions.push_back( accelerationPartial->getParameterPartialFunction( parameters.at( i ) ) );
+        BOOST_CHECK_EQUAL( partialFunctions.at( i ).second, parameters.at( i )->getParameterSize( ) );
+    }
+
+    accelerationPartial->update( 0.0 );
+
+    // Compute partials separately.
+    Eigen::Matrix3d rotationToIntegrationFrameMatrix = rotationToIntegrationFrame.toRotationMatrix( );
+    Eigen::Vector3d bodyFixedPosition = rotationToIntegrationFrameMatrix.transpose( ) *
+            ( positionOfAcceleratedBody - positionOfAcceleratingBody );
+    Eigen::Vector3d sphericalPosition = coordinate_conversions::convertCartesianToSpherical( bodyFixedPosition );
+    sphericalPosition( 1 ) = mathematical_constants::PI / 2.0 - sphericalPosition( 1 );
+    boost::shared_ptr< basic_mathematics::SphericalHarmonicsCache > sphericalHarmonicsCache =
+            accelerationModel->getSphericalHarmonicsCache( );
+
+    Eigen::Matrix3d expectedPartialWrtPosition = rotationToIntegrationFrameMatrix *
+            computePartialDerivativeOfBodyFixedSphericalHarmonicAcceleration(
+                bodyFixedPosition, referenceRadius, gravitationalParameter, cosineCoefficients, sineCoefficients,
+                sphericalHarmonicsCache ) * rotationToIntegrationFrameMatrix.transpose( );
+    Eigen::MatrixXd partialWrtPosition = Eigen::MatrixXd::Zero( 3, 3 );
+    accelerationPartial->wrtPositionOfAcceleratedBody( partialWrtPosition.block( 0, 0, 3, 3 ) );
+    TUDAT_CHECK_MATRIX_CLOSE_FRACTION( partialWrtPosition, expectedPartialWrtPosition, 1.0E-13 );
+
+    Eigen::Matrix3d gradientTransformationMatrix =
+            coordinate_conversions::getSphericalToCartesianGradientMatrix( bodyFixedPosition );
+    for( unsigned int i = 0; i < parameters.size( ); i++ )
+    {
+        Eigen::MatrixXd coefficientPartial = Eigen::MatrixXd::Zero( 3, partialFunctions.at( i ).second );
+        partialFunctions.at( i ).first( coefficientPartial );
+
+        Eigen::MatrixXd expectedCoefficientPartial = Eigen::MatrixXd::Zero( 3, partialFunctions.at( i ).second );
+        if( i < 2 )
+        {
+            calculateSphericalHarmonicGravityWrtCCoefficients(
+                        sphericalPosition, referenceRadius, gravitationalParameter, sphericalHarmonicsCache,
+                        boost::dynamic_pointer_cast< SphericalHarmonicsCosineCoefficients >(
+                            parameters.at( i ) )->getBlockIndices( ), gradientTransformationMatrix,
+                        rotationToIntegrationFrameMatrix, expectedCoefficientPartial );
+        }
+        else
+        {
+            calculateSphericalHarmonicGravityWrtSCoefficients(
+                        sphericalPosition, referenceRadius, gravitationalParameter, sphericalHarmonicsCache,
+                        boost::dynamic_pointer_cast< SphericalHarmonicsSineCoefficients >(
+                            parameters.at( i ) )->getBlockIndices( ), gradientTransformationMatrix,
+                        rotationToIntegrationFrameMatrix, expectedCoefficientPartial );
+        }
+
+        for( int j = 0; j < 3; j++ )
+        {
+            for( int k = 0; k < coefficientPartial.cols( ); k++ )
+            {
+                BOOST_CHECK_SMALL( std::fabs( coefficientPartial( j, k ) - expectedCoefficientPartial( j, k ) ),
+                                   1.0E-14 * expectedCoefficientPartial.cwiseAbs( ).maxCoeff( ) );
+            }
+        }
+    }
+}
+
+//! Test whether fused and separate computation of spherical harmonic partials are consistent for a high-degree field with
+//! partials w.r.t. all coefficients, over a range of positions.
+BOOST_AUTO_TEST_CASE( testFusedSphericalHarmonicPartialHighDegree )
+{
+    const int maximumDegree = 100;
+    const int numberOfEvaluations = 200;
+    const double gravitationalParameter = 3.986004418E14;
+    const double referenceRadius = 6378137.0;
+
+    Eigen::MatrixXd cosineCoefficients, sineCoefficients;
+    getTestCoefficients( maximumDegree, cosineCoefficients, sineCoefficients );
+    gravitation::DegreeMajorCoefficientMatrix degreeMajorCosineCoefficients = cosineCoefficients;
+    gravitation::DegreeMajorCoefficientMatrix degreeMajorSineCoefficients = sineCoefficients;
+
+    boost::shared_ptr< basic_mathematics::SphericalHarmonicsCache > sphericalHarmonicsCache =
+            boost::make_shared< basic_mathematics::SphericalHarmonicsCache >( maximumDegree, maximumDegree + 2 );
+    sphericalHarmonicsCache->getLegendreCache( )->setComputeSecondDerivatives( 1 );
+
+    std::vector< std::pair< int, int > > cosineBlockIndices = getAllBlockIndices( 2, maximumDegree, 0 );
+    std::vector< std::pair< int, int > > sineBlockIndices = getAllBlockIndices( 2, maximumDegree, 1 );
+    Eigen::MatrixXi cosineColumns = Eigen::MatrixXi::Constant( maximumDegree + 1, maximumDegree + 1, -1 );
+    for( unsigned int i = 0; i < cosineBlockIndices.size( ); i++ )
+    {
+        cosineColumns( cosineBlockIndices.at( i ).first, cosineBlockIndices.at( i ).second ) = i;
+    }
+    Eigen::MatrixXi sineColumns = Eigen::MatrixXi::Constant( maximumDegree + 1, maximumDegree + 1, -1 );
+    for( unsigned int i = 0; i < sineBlockIndices.size( ); i++ )
+    {
+        sineColumns( sineBlockIndices.at( i ).first, sineBlockIndices.at( i ).second ) = i;
+    }
+
+    Eigen::MatrixXd cosinePartials = Eigen::MatrixXd::Zero( 3, cosineBlockIndices.size( ) );
+    Eigen::MatrixXd sinePartials = Eigen::MatrixXd::Zero( 3, sineBlockIndices.size( ) );
+    Eigen::Matrix3d positionPartial;
+    Eigen::Vector3d sphericalGradient;
+    Eigen::Matrix3d sphericalHessian;
+
+    double separateCheckSum = 0.0, fusedCheckSum = 0.0;
+    for( int i = 0; i < numberOfEvaluations; i++ )
+    {
+        Eigen::Vector3d cartesianPosition( 4.2E6 + 1.0E3 * i, -3.5E6, 4.1E6 - 2.0E3 * i );
+        Eigen::Vector3d sphericalPosition = coordinate_conversions::convertCartesianToSpherical( cartesianPosition );
+        sphericalPosition( 1 ) = mathematical_constants::PI / 2.0 - sphericalPosition( 1 );
+        sphericalHarmonicsCache->update( sphericalPosition( 0 ), std::sin( sphericalPosition( 1 ) ),
+                                         sphericalPosition( 2 ), referenceRadius );
+        Eigen::Matrix3d gradientTransformationMatrix =
+                coordinate_conversions::getSphericalToCartesianGradientMatrix( cartesianPosition );
+
+        // Separate computation of position and coefficient partials.
+        positionPartial = computePartialDerivativeOfBodyFixedSphericalHarmonicAcceleration(
+                    cartesianPosition, referenceRadius, gravitationalParameter, cosineCoefficients, sineCoefficients,
+                    sphericalHarmonicsCache );
+        calculateSphericalHarmonicGravityWrtCCoefficients(
+                    sphericalPosition, referenceRadius, gravitationalParameter, sphericalHarmonicsCache,
+                    cosineBlockIndices, gradientTransformationMatrix, Eigen::Matrix3d::Identity( ), cosinePartials );
+        calculateSphericalHarmonicGravityWrtSCoefficients(
+                    sphericalPosition, referenceRadius, gravitationalParameter, sphericalHarmonicsCache,
+                    sineBlockIndices, gradientTransformationMatrix, Eigen::Matrix3d::Identity( ), sinePartials );
+        separateCheckSum += positionPartial.sum( ) + cosinePartials.sum( ) + sinePartials.sum( );
+
+        // Fused computation of position and coefficient partials.
+        computeSphericalHarmonicGradientHessianAndCoefficientPartials(
+                    sphericalPosition, referenceRadius, gravitationalParameter, degreeMajorCosineCoefficients,
+                    degreeMajorSineCoefficients, sphericalHarmonicsCache, cosineColumns, sineColumns,
+                    sphericalGradient, sphericalHessian, cosinePartials, sinePartials );
+        positionPartial = gradientTransformationMatrix * sphericalHessian * gradientTransformationMatrix.transpose( ) +
+                coordinate_conversions::getDerivativeOfSphericalToCartesianGradient(
+                    sphericalGradient, cartesianPosition );
+        cosinePartials = gradientTransformationMatrix * cosinePartials;
+        sinePartials = gradientTransformationMatrix * sinePartials;
+        fusedCheckSum += positionPartial.sum( ) + cosinePartials.sum( ) + sinePartials.sum( );
+    }
+
+    BOOST_CHECK_SMALL( std::fabs( fusedCheckSum - separateCheckSum ), 1.0E-10 * std::fabs( separateCheckSum ) );
+}
+
+BOOST_AUTO_TEST_SUITE_END( )
+
+} // namespace unit_tests
+
+} // namespace tudat
@@ -0,0 +1,61 @@
+/*    Copyright (c) 2010-2017, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ */
+
+#include "Tudat/Astrodynamics/OrbitDetermination/AccelerationPartials/automaticDifferentiationAccelerationPartial.h"
+
+namespace tudat
+{
+
+namespace acceleration_partials
+{
+
+//! Constructor.
+AutomaticDifferentiationAccelerationPartial::AutomaticDifferentiationAccelerationPartial(
+        const boost::shared_ptr< basic_astrodynamics::AutomaticDifferentiationAcceleration > accelerationModel,
+        const std::string acceleratedBody,
+        const std::string acceleratingBody,
+        const std::vector< estimatable_parameters::EstimatebleParameterIdentifier >& parameterIdentifiers ):
+    AccelerationPartial( acceleratedBody, acceleratingBody,
+                         basic_astrodynamics::automatic_differentiation_acceleration ),
+    accelerationModel_( accelerationModel ), parameterIdentifiers_( parameterIdentifiers )
+{
+    if( parameterIdentifiers_.size( ) > 0 &&
+            static_cast< int >( parameterIdentifiers_.size( ) ) != accelerationModel_->getNumberOfParameters( ) )
+    {
+        throw std::runtime_error( "Error when creating automatic differentiation acceleration partial, number of "
+                                  "parameter identifiers is inconsistent with number of acceleration parameters" );
+    }
+}
+
+//! Function for setting up and retrieving a function returning a partial w.r.t. a double parameter.
+std::pair< boost::function< void( Eigen::MatrixXd& ) >, int >
+AutomaticDifferentiationAccelerationPartial::getParameterPartialFunction(
+        boost::shared_ptr< estimatable_parameters::EstimatableParameter< double > > parameter )
+{
+    std::pair< boost::function< void( Eigen::MatrixXd& ) >, int > partialFunctionPair =
+            std::make_pair( boost::function< void( Eigen::MatrixXd& ) >( ), 0 );
+
+    // Check if parameter corresponds to any of the acceleration model parameters.
+    for( unsigned int i = 0; i < parameterIdentifiers_.size( ); i++ )
+    {
+        if( parameterIdentifiers_.at( i ) == parameter->getParameterName( ) )
+        {
+            partialFunctionPair = std::make_pair( boost::bind(
+                        &AutomaticDifferentiationAccelerationPartial::wrtModelParameter, this, _1, i ), 1 );
+            break;
+        }
+    }
+
+    return partialFunctionPair;
+}
+
+} // namespace acceleration_partials
+
+} // namespace tudat
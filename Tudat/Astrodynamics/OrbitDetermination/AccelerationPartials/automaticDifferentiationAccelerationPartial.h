@@ -0,0 +1,218 @@
+/*    Copyright (c) 2010-2017, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ */
+
+#ifndef TUDAT_AUTOMATICDIFFERENTIATIONACCELERATIONPARTIAL_H
+#define TUDAT_AUTOMATICDIFFERENTIATIONACCELERATIONPARTIAL_H
+
+#include <vector>
+
+#include "Tudat/Astrodynamics/BasicAstrodynamics/automaticDifferentiationAcceleration.h"
+
+#include "Tudat/Astrodynamics/OrbitDetermination/AccelerationPartials/accelerationPartial.h"
+
+namespace tudat
+{
+
+namespace acceleration_partials
+{
+
+//! Class to calculate the partials of an acceleration w.r.t. parameters and states, using automatic differentiation.
+/*!
+ *  Class to calculate the partials of an acceleration w.r.t. parameters and states, using automatic differentiation.
+ *  The partials w.r.t. the states of the bodies undergoing and exerting the acceleration, and w.r.t. the scalar
+ *  parameters of the acceleration, are obtained from a single evaluation of the acceleration with dual numbers, in the
+ *  update function. Partials w.r.t. estimated parameters are provided for those parameters that are matched to a
+ *  scalar parameter of the acceleration model by the list of parameter identifiers provided to the constructor.
+ */
+class AutomaticDifferentiationAccelerationPartial: public AccelerationPartial
+{
+public:
+
+    //! Constructor.
+    /*!
+     *  Constructor.
+     *  \param accelerationModel Acceleration model w.r.t. which partials are to be taken.
+     *  \param acceleratedBody Body undergoing acceleration.
+     *  \param acceleratingBody Body exerting acceleration.
+     *  \param parameterIdentifiers Identifiers of the estimatable parameters corresponding to the scalar parameters of
+     *  the acceleration model (in the same order). If empty (default), no parameter partials are provided. Otherwise,
+     *  the size must be equal to the number of parameters of the acceleration model.
+     */
+    AutomaticDifferentiationAccelerationPartial(
+            const boost::shared_ptr< basic_astrodynamics::AutomaticDifferentiationAcceleration > accelerationModel,
+            const std::string acceleratedBody,
+            const std::string acceleratingBody,
+            const std::vector< estimatable_parameters::EstimatebleParameterIdentifier >& parameterIdentifiers =
+            std::vector< estimatable_parameters::EstimatebleParameterIdentifier >( ) );
+
+    //! Destructor
+    ~AutomaticDifferentiationAccelerationPartial( ){ }
+
+    //! Function for calculating the partial of the acceleration w.r.t. the position of body undergoing acceleration.
+    /*!
+     *  Function for calculating the partial of the acceleration w.r.t. the position of body undergoing acceleration
+     *  and adding it to the existing partial block.
+     *  Update( ) function must have been called during current time step before calling this function.
+     *  \param partialMatrix Block of partial derivatives of acceleration w.r.t. Cartesian position of body
+     *  undergoing acceleration where current partial is to be added.
+     *  \param addContribution Variable denoting whether to return the partial itself (true) or the negative partial (false).
+     *  \param startRow First row in partialMatrix block where the computed partial is to be added.
+     *  \param startColumn First column in partialMatrix block where the computed partial is to be added.
+     */
+    void wrtPositionOfAcceleratedBody(
+            Eigen::Block< Eigen::MatrixXd > partialMatrix,
+            const bool addContribution = 1, const int startRow = 0, const int startColumn = 0 )
+    {
+        addStatePartial( partialMatrix, addContribution, startRow, startColumn, 0 );
+    }
+
+    //! Function for calculating the partial of the acceleration w.r.t. the velocity of body undergoing acceleration.
+    /*!
+     *  Function for calculating the partial of the acceleration w.r.t. the velocity of body undergoing acceleration
+     *  and adding it to the existing partial block.
+     *  Update( ) function must have been called during current time step before calling this function.
+     *  \param partialMatrix Block of partial derivatives of acceleration w.r.t. Cartesian velocity of body
+     *  undergoing acceleration where current partial is to be added.
+     *  \param addContribution Variable denoting whether to return the partial itself (true) or the negative partial (false).
+     *  \param startRow First row in partialMatrix block where the computed partial is to be added.
+     *  \param startColumn First column in partialMatrix block where the computed partial is to be added.
+     */
+    void wrtVelocityOfAcceleratedBody(
+            Eigen::Block< Eigen::MatrixXd > partialMatrix,
+            const bool addContribution = 1, const int startRow = 0, const int startColumn = 3 )
+    {
+        addStatePartial( partialMatrix, addContribution, startRow, startColumn, 3 );
+    }
+
+    //! Function for calculating the partial of the acceleration w.r.t. the position of body exerting acceleration.
+    /*!
+     *  Function for calculating the partial of the acceleration w.r.t. the position of body exerting acceleration and
+     *  adding it to the existing partial block.
+     *  Update( ) function must have been called during current time step before calling this function.
+     *  \param partialMatrix Block of partial derivatives of acceleration w.r.t. Cartesian position of body
+     *  exerting acceleration where current partial is to be added.
+     *  \param addContribution Variable denoting whether to return the partial itself (true) or the negative partial (false).
+     *  \param startRow First row in partialMatrix block where the computed partial is to be added.
+     *  \param startColumn First column in partialMatrix block where the computed partial is to be added.
+     */
+    void wrtPositionOfAcceleratingBody(
+            Eigen::Block< Eigen::MatrixXd > partialMatrix,
+            const bool addContribution = 1, const int startRow = 0, const int startColumn = 0 )
+    {
+        addStatePartial( partialMatrix, !addContribution, startRow, startColumn, 0 );
+    }
+
+    //! Function for calculating the partial of the acceleration w.r.t. the velocity of body exerting acceleration.
+    /*!
+     *  Function for calculating the partial of the acceleration w.r.t. the velocity of body exerting acceleration and
+     *  adding it to the existing partial block.
+     *  Update( ) function must have been called during current time step before calling this function.
+     *  \param partialMatrix Block of partial derivatives of acceleration w.r.t. Cartesian velocity of body
+     *  exerting acceleration where current partial is to be added.
+     *  \param addContribution Variable denoting whether to return the partial itself (true) or the negative partial (false).
+     *  \param startRow First row in partialMatrix block where the computed partial is to be added.
+     *  \param startColumn First column in partialMatrix block where the computed partial is to be added.
+     */
+    void wrtVelocityOfAcceleratingBody(
+            Eigen::Block< Eigen::MatrixXd > partialMatrix,
+            const bool addContribution = 1, const int startRow = 0, const int startColumn = 3 )
+    {
+        addStatePartial( partialMatrix, !addContribution, startRow, startColumn, 3 );
+    }
+
+    //! Function for setting up and retrieving a function returning a partial w.r.t. a double parameter.
+    /*!
+     *  Function for setting up and retrieving a function returning a partial w.r.t. a double parameter.
+     *  Function returns empty function and zero size indicator for parameters with no dependency for current acceleration.
+     *  \param parameter Parameter w.r.t. which partial is to be taken.
+     *  \return Pair of parameter partial function and number of columns in partial (0 for no dependency, 1 otherwise).
+     */
+    std::pair< boost::function< void( Eigen::MatrixXd& ) >, int >
+    getParameterPartialFunction( boost::shared_ptr< estimatable_parameters::EstimatableParameter< double > > parameter );
+
+    //! Function for setting up and retrieving a function returning a partial w.r.t. a vector parameter.
+    /*!
+     *  Function for setting up and retrieving a function returning a partial w.r.t. a vector parameter.
+     *  Function returns empty function and zero size indicator, as no vector parameters are supported.
+     *  \param parameter Parameter w.r.t. which partial is to be taken.
+     *  \return Pair of parameter partial function and number of columns in partial (0 for no dependency).
+     */
+    std::pair< boost::function< void( Eigen::MatrixXd& ) >, int > getParameterPartialFunction(
+            boost::shared_ptr< estimatable_parameters::EstimatableParameter< Eigen::VectorXd > > parameter )
+    {
+        boost::function< void( Eigen::MatrixXd& ) > partialFunction;
+        return std::make_pair( partialFunction, 0 );
+    }
+
+    //! Function for updating partials to current time.
+    /*!
+     *  Function for updating partials to current time, by updating the acceleration model and its partials w.r.t.
+     *  the relative state and parameters in a single automatic differentiation evaluation.
+     *  \param currentTime Time at which partials are to be calculated
+     */
+    void update( const double currentTime = TUDAT_NAN )
+    {
+        if( !( currentTime_ == currentTime ) )
+        {
+            accelerationModel_->updateAccelerationAndPartials( currentTime );
+            currentTime_ = currentTime;
+        }
+    }
+
+protected:
+
+    //! Function to add the current partial w.r.t. the relative position or velocity to a partial block.
+    /*!
+     *  Function to add the current partial w.r.t. the relative position or velocity to a partial block.
+     *  \param partialMatrix Block of partial derivatives where current partial is to be added.
+     *  \param addContribution Variable denoting whether to add (true) or subtract (false) the partial.
+     *  \param startRow First row in partialMatrix block where the computed partial is to be added.
+     *  \param startColumn First column in partialMatrix block where the computed partial is to be added.
+     *  \param stateIndex Index of relative state entry at which partial starts (0 for position; 3 for velocity).
+     */
+    void addStatePartial( Eigen::Block< Eigen::MatrixXd > partialMatrix, const bool addContribution,
+                          const int startRow, const int startColumn, const int stateIndex )
+    {
+        if( addContribution )
+        {
+            partialMatrix.block( startRow, startColumn, 3, 3 ) +=
+                    accelerationModel_->getCurrentPartials( ).block( 0, stateIndex, 3, 3 );
+        }
+        else
+        {
+            partialMatrix.block( startRow, startColumn, 3, 3 ) -=
+                    accelerationModel_->getCurrentPartials( ).block( 0, stateIndex, 3, 3 );
+        }
+    }
+
+    //! Function to retrieve the current partial w.r.t. a scalar parameter of the acceleration model.
+    /*!
+     *  Function to retrieve the current partial w.r.t. a scalar parameter of the acceleration model.
+     *  \param parameterPartial Partial w.r.t. the parameter (returned by reference).
+     *  \param parameterIndex Index of the parameter in the list of parameters of the acceleration model.
+     */
+    void wrtModelParameter( Eigen::MatrixXd& parameterPartial, const int parameterIndex )
+    {
+        parameterPartial = accelerationModel_->getCurrentPartials( ).block( 0, 6 + parameterIndex, 3, 1 );
+    }
+
+    //! Acceleration model w.r.t. which partials are to be taken.
+    boost::shared_ptr< basic_astrodynamics::AutomaticDifferentiationAcceleration > accelerationModel_;
+
+    //! Identifiers of the estimatable parameters corresponding to the scalar parameters of the acceleration model.
+    std::vector< estimatable_parameters::EstimatebleParameterIdentifier > parameterIdentifiers_;
+
+};
+
+} // namespace acceleration_partials
+
+} // namespace tudat
+
+#endif // TUDAT_AUTOMATICDIFFERENTIATIONACCELERATIONPARTIAL_H
@@ -249,6 +249,8 @@ std::pair< boost::function< void( Eigen::MatrixXd& ) >, int > SphericalHarmonics
                 boost::shared_ptr< SphericalHarmonicsCosineCoefficients > coefficientsParameter =
                         boost::dynamic_pointer_cast< SphericalHarmonicsCosineCoefficients >( parameter );
 
+                registerCoefficientPartials( coefficientsParameter->getBlockIndices( ),
+                                             cosineCoefficientPartialColumns_, currentCosineCoefficientPartials_ );
                 partialFunction = boost::bind( &SphericalHarmonicsGravityPartial::wrtCosineCoefficientBlock, this,
                                                coefficientsParameter->getBlockIndices( ), _1 );
                 numberOfRows = coefficientsParameter->getParameterSize( );
@@ -262,6 +264,8 @@ std::pair< boost::function< void( Eigen::MatrixXd& ) >, int > SphericalHarmonics
                 boost::shared_ptr< SphericalHarmonicsSineCoefficients > coefficientsParameter =
                         boost::dynamic_pointer_cast< SphericalHarmonicsSineCoefficients >( parameter );
 
+                registerCoefficientPartials( coefficientsParameter->getBlockIndices( ),
+                                             sineCoefficientPartialColumns_, currentSineCoefficientPartials_ );
                 partialFunction = boost::bind( &SphericalHarmonicsGravityPartial::wrtSineCoefficientBlock, this,
                                                coefficientsParameter->getBlockIndices( ), _1 );
                 numberOfRows = coefficientsParameter->getParameterSize( );
@@ -340,10 +344,33 @@ void SphericalHarmonicsGravityPartial::update( const double currentTime )
                     bodyFixedSphericalPosition_( 2 ), bodyReferenceRadius_( ) );
 
 
+        // Calculate spherical gradient, spherical Hessian and coefficient partials in a single pass.
+        Eigen::Vector3d sphericalPotentialGradient;
+        Eigen::Matrix3d sphericalHessian;
+        computeSphericalHarmonicGradientHessianAndCoefficientPartials(
+                    bodyFixedSphericalPosition_, bodyReferenceRadius_( ), gravitationalParameterFunction_( ),
+                    currentCosineCoefficients_, currentSineCoefficients_, sphericalHarmonicCache_,
+                    cosineCoefficientPartialColumns_, sineCoefficientPartialColumns_,
+                    sphericalPotentialGradient, sphericalHessian,
+                    currentCosineCoefficientPartials_, currentSineCoefficientPartials_ );
+
         // Calculate partial of acceleration wrt position of body undergoing acceleration.
-        currentBodyFixedPartialWrtPosition_ = computePartialDerivativeOfBodyFixedSphericalHarmonicAcceleration(
-                    bodyFixedPosition_, bodyReferenceRadius_( ), gravitationalParameterFunction_( ),
-                    currentCosineCoefficients_, currentSineCoefficients_, sphericalHarmonicCache_ );
+        Eigen::Matrix3d gradientTransformationMatrix = getSphericalToCartesianGradientMatrix( bodyFixedPosition_ );
+        currentBodyFixedPartialWrtPosition_ =
+                gradientTransformationMatrix * sphericalHessian * gradientTransformationMatrix.transpose( ) +
+                getDerivativeOfSphericalToCartesianGradient( sphericalPotentialGradient, bodyFixedPosition_ );
+
+        // Transform coefficient partials to Cartesian position and integration frame.
+        Eigen::Matrix3d coefficientPartialTransformation =
+                currentRotationToBodyFixedFrame_.inverse( ) * gradientTransformationMatrix;
+        if( currentCosineCoefficientPartials_.cols( ) > 0 )
+        {
+            currentCosineCoefficientPartials_ = coefficientPartialTransformation * currentCosineCoefficientPartials_;
+        }
+        if( currentSineCoefficientPartials_.cols( ) > 0 )
+        {
+            currentSineCoefficientPartials_ = coefficientPartialTransformation * currentSineCoefficientPartials_;
+        }
 
         currentPartialWrtVelocity_.setZero( );
         currentPartialWrtPosition_ =
@@ -365,11 +392,11 @@ void SphericalHarmonicsGravityPartial::wrtCosineCoefficientBlock(
         const std::vector< std::pair< int, int > >& blockIndices,
         Eigen::MatrixXd& partialDerivatives )
 {
-    calculateSphericalHarmonicGravityWrtCCoefficients(
-                bodyFixedSphericalPosition_, bodyReferenceRadius_( ), gravitationalParameterFunction_( ),
-                sphericalHarmonicCache_,
-                blockIndices, coordinate_conversions::getSphericalToCartesianGradientMatrix(
-                    bodyFixedPosition_ ), fromBodyFixedToIntegrationFrameRotation_( ), partialDerivatives );
+    for( unsigned int i = 0; i < blockIndices.size( ); i++ )
+    {
+        partialDerivatives.block( 0, i, 3, 1 ) = currentCosineCoefficientPartials_.col(
+                    cosineCoefficientPartialColumns_( blockIndices.at( i ).first, blockIndices.at( i ).second ) );
+    }
 }
 
 //! Function to calculate the partial of the acceleration wrt a set of sine coefficients.
@@ -377,11 +404,43 @@ void SphericalHarmonicsGravityPartial::wrtSineCoefficientBlock(
         const std::vector< std::pair< int, int > >& blockIndices,
         Eigen::MatrixXd& partialDerivatives )
 {
-    calculateSphericalHarmonicGravityWrtSCoefficients(
-                bodyFixedSphericalPosition_, bodyReferenceRadius_( ), gravitationalParameterFunction_( ),
-                sphericalHarmonicCache_,
-                blockIndices, coordinate_conversions::getSphericalToCartesianGradientMatrix(
-                    bodyFixedPosition_ ), fromBodyFixedToIntegrationFrameRotation_( ), partialDerivatives );
+    for( unsigned int i = 0; i < blockIndices.size( ); i++ )
+    {
+        partialDerivatives.block( 0, i, 3, 1 ) = currentSineCoefficientPartials_.col(
+                    sineCoefficientPartialColumns_( blockIndices.at( i ).first, blockIndices.at( i ).second ) );
+    }
+}
+
+//! Function to register a set of coefficients for which partials are to be computed by the update function.
+void SphericalHarmonicsGravityPartial::registerCoefficientPartials(
+        const std::vector< std::pair< int, int > >& blockIndices,
+        Eigen::MatrixXi& coefficientPartialColumns,
+        Eigen::MatrixXd& coefficientPartials )
+{
+    if( coefficientPartialColumns.size( ) == 0 )
+    {
+        coefficientPartialColumns = Eigen::MatrixXi::Constant( maximumDegree_ + 1, maximumOrder_ + 1, -1 );
+    }
+
+    for( unsigned int i = 0; i < blockIndices.size( ); i++ )
+    {
+        int degree = blockIndices.at( i ).first;
+        int order = blockIndices.at( i ).second;
+        if( degree < 0 || degree > maximumDegree_ || order < 0 || order > std::min( degree, maximumOrder_ ) )
+        {
+            throw std::runtime_error( "Error when registering spherical harmonic coefficient partial, degree " +
+                                      std::to_string( degree ) + " and order " + std::to_string( order ) +
+                                      " not in gravity field" );
+        }
+
+        // Assign new column to coefficient, if not yet registered.
+        if( coefficientPartialColumns( degree, order ) < 0 )
+        {
+            coefficientPartialColumns( degree, order ) = coefficientPartials.cols( );
+            coefficientPartials.conservativeResize( 3, coefficientPartials.cols( ) + 1 );
+            coefficientPartials.col( coefficientPartials.cols( ) - 1 ).setZero( );
+        }
+    }
 }
 
 //! Function to calculate an acceleration partial wrt a rotational parameter.
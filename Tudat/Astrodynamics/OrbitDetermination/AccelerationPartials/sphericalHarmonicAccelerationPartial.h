@@ -244,6 +244,7 @@ protected:
      *  are degree and order for each vector entry).
      *  \param partialDerivatives Matrix of acceleration partials that is set by this function (returned by reference),
      *  with each column containg the partial wrt a single coefficient (in same order as blockIndices).
+     *  Partials are retrieved from those computed by the update( time ) function.
      */
     void wrtCosineCoefficientBlock(
             const std::vector< std::pair< int, int > >& blockIndices,
@@ -257,6 +258,7 @@ protected:
      *  are degree and order for each vector entry).
      *  \param partialDerivatives Matrix of acceleration partials that is set by this function (returned by reference),
      *  with each column containg the partial wrt a single coefficient (in same order as blockIndices).
+     *  Partials are retrieved from those computed by the update( time ) function.
      */
     void wrtSineCoefficientBlock(
             const std::vector< std::pair< int, int > >& blockIndices,
@@ -303,6 +305,21 @@ protected:
             const int parameterSize,
             Eigen::MatrixXd& accelerationPartial );
 
+    //! Function to register a set of coefficients for which partials are to be computed by the update function.
+    /*!
+     *  Function to register a set of coefficients for which partials are to be computed by the update( time ) function,
+     *  assigning a column of the coefficient partial matrix to each coefficient that is not yet registered.
+     *  \param blockIndices List of coefficient indices for which partials are to be computed (first and second
+     *  are degree and order for each vector entry).
+     *  \param coefficientPartialColumns Matrix with, at entry (degree, order), the column of the coefficient partial
+     *  matrix in which the partial is stored (-1 if not computed), updated by this function (returned by reference).
+     *  \param coefficientPartials Matrix of coefficient partials, resized by this function (returned by reference).
+     */
+    void registerCoefficientPartials(
+            const std::vector< std::pair< int, int > >& blockIndices,
+            Eigen::MatrixXi& coefficientPartialColumns,
+            Eigen::MatrixXd& coefficientPartials );
+
 
     //! Function to return the gravitational parameter used for calculating the acceleration.
     boost::function< double( ) > gravitationalParameterFunction_;
@@ -345,13 +362,43 @@ protected:
     /*!
      *  Current cosine coefficients of the spherical harmonic gravity field, set by update( time ) function.
      */
-    Eigen::MatrixXd currentCosineCoefficients_;
+    gravitation::DegreeMajorCoefficientMatrix currentCosineCoefficients_;
 
     //! Current sine coefficients of the spherical harmonic gravity field.
     /*!
      *  Current sine coefficients of the spherical harmonic gravity field, set by update( time ) function.
      */
-    Eigen::MatrixXd currentSineCoefficients_;
+    gravitation::DegreeMajorCoefficientMatrix currentSineCoefficients_;
+
+    //! Columns of currentCosineCoefficientPartials_ in which partials w.r.t. cosine coefficients are stored.
+    /*!
+     *  Matrix with, at entry (degree, order), the column of currentCosineCoefficientPartials_ in which the partial
+     *  w.r.t. the cosine coefficient at that degree and order is stored (-1 if not computed). Empty if no partials
+     *  w.r.t. cosine coefficients are computed.
+     */
+    Eigen::MatrixXi cosineCoefficientPartialColumns_;
+
+    //! Columns of currentSineCoefficientPartials_ in which partials w.r.t. sine coefficients are stored.
+    /*!
+     *  Matrix with, at entry (degree, order), the column of currentSineCoefficientPartials_ in which the partial
+     *  w.r.t. the sine coefficient at that degree and order is stored (-1 if not computed). Empty if no partials
+     *  w.r.t. sine coefficients are computed.
+     */
+    Eigen::MatrixXi sineCoefficientPartialColumns_;
+
+    //! Current partials of the acceleration w.r.t. the registered cosine coefficients.
+    /*!
+     *  Current partials of the acceleration (in integration frame) w.r.t. the registered cosine coefficients, set by
+     *  update( time ) function, with column indices given by cosineCoefficientPartialColumns_.
+     */
+    Eigen::MatrixXd currentCosineCoefficientPartials_;
+
+    //! Current partials of the acceleration w.r.t. the registered sine coefficients.
+    /*!
+     *  Current partials of the acceleration (in integration frame) w.r.t. the registered sine coefficients, set by
+     *  update( time ) function, with column indices given by sineCoefficientPartialColumns_.
+     */
+    Eigen::MatrixXd currentSineCoefficientPartials_;
 
     //! Current body-fixed (w.r.t body exerting acceleration) position of body undergoing acceleration
     /*!
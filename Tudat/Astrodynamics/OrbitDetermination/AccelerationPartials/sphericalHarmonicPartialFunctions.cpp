@@ -149,6 +149,133 @@ Eigen::Matrix3d computeCumulativeSphericalHessian(
 
 }
 
+//! Function to compute the spherical gradient, spherical Hessian and coefficient partials of a full spherical harmonic
+//! potential in a single pass
+void computeSphericalHarmonicGradientHessianAndCoefficientPartials(
+        const Eigen::Vector3d& sphericalPosition,
+        const double referenceRadius,
+        const double gravitionalParameter,
+        const gravitation::DegreeMajorCoefficientMatrix& cosineHarmonicCoefficients,
+        const gravitation::DegreeMajorCoefficientMatrix& sineHarmonicCoefficients,
+        const boost::shared_ptr< basic_mathematics::SphericalHarmonicsCache > sphericalHarmonicsCache,
+        const Eigen::MatrixXi& cosineCoefficientPartialColumns,
+        const Eigen::MatrixXi& sineCoefficientPartialColumns,
+        Eigen::Vector3d& sphericalGradient,
+        Eigen::Matrix3d& sphericalHessian,
+        Eigen::MatrixXd& cosineCoefficientPartials,
+        Eigen::MatrixXd& sineCoefficientPartials )
+{
+    const int numberOfDegrees = cosineHarmonicCoefficients.rows( );
+    const int numberOfOrders = cosineHarmonicCoefficients.cols( );
+
+    // Check which coefficient partials are to be computed
+    const bool computeCosinePartials = ( cosineCoefficientPartialColumns.size( ) > 0 );
+    const bool computeSinePartials = ( sineCoefficientPartialColumns.size( ) > 0 );
+    if( ( computeCosinePartials && ( cosineCoefficientPartialColumns.rows( ) != numberOfDegrees ||
+                                     cosineCoefficientPartialColumns.cols( ) != numberOfOrders ) ) ||
+            ( computeSinePartials && ( sineCoefficientPartialColumns.rows( ) != numberOfDegrees ||
+                                       sineCoefficientPartialColumns.cols( ) != numberOfOrders ) ) )
+    {
+        throw std::runtime_error(
+                    "Error when computing fused spherical harmonic partials, coefficient partial column indices are "
+                    "inconsistent with coefficient matrices" );
+    }
+
+    // Retrieve contiguous storage of cached terms.
+    boost::shared_ptr< basic_mathematics::LegendreCache > legendreCache = sphericalHarmonicsCache->getLegendreCache( );
+    const int legendreStride = legendreCache->getMaximumOrder( ) + 1;
+    const double* legendrePolynomials = legendreCache->getLegendreValues( ).data( );
+    const double* legendrePolynomialDerivatives = legendreCache->getLegendreDerivatives( ).data( );
+    const double* legendrePolynomialSecondDerivatives = legendreCache->getLegendreSecondDerivatives( ).data( );
+    const double* cosinesOfLongitude = sphericalHarmonicsCache->getCosinesOfMultipleLongitude( ).data( );
+    const double* sinesOfLongitude = sphericalHarmonicsCache->getSinesOfMultipleLongitude( ).data( );
+    const std::vector< double >& radiusRatioPowers = sphericalHarmonicsCache->getReferenceRadiusRatioPowersList( );
+
+    const double distance = sphericalPosition( radiusIndex );
+    const double cosineOfLatitude = legendreCache->getCurrentPolynomialParameterComplement( );
+    const double sineOfLatitude = legendreCache->getCurrentPolynomialParameter( );
+    const double preMultiplier = gravitionalParameter / referenceRadius;
+
+    // Loop over all degrees, summing contributions of all orders per degree.
+    sphericalGradient.setZero( );
+    sphericalHessian.setZero( );
+    for( int degree = 0; degree < numberOfDegrees; degree++ )
+    {
+        const int currentNumberOfOrders = std::min( degree + 1, numberOfOrders );
+        const double* currentLegendrePolynomials = legendrePolynomials + degree * legendreStride;
+        const double* currentLegendrePolynomialDerivatives = legendrePolynomialDerivatives + degree * legendreStride;
+        const double* currentLegendrePolynomialSecondDerivatives =
+                legendrePolynomialSecondDerivatives + degree * legendreStride;
+        const double* currentCosineCoefficients = cosineHarmonicCoefficients.data( ) + degree * numberOfOrders;
+        const double* currentSineCoefficients = sineHarmonicCoefficients.data( ) + degree * numberOfOrders;
+
+        const double degreeTerm = static_cast< double >( degree + 1 ) / distance;
+        const double radiusPowerTerm = preMultiplier * radiusRatioPowers[ degree + 1 ];
+
+        // Sums over orders of Legendre terms multiplied by (C cos + S sin) or m * (S cos - C sin)
+        double legendreTermSum = 0.0, legendreDerivativeTermSum = 0.0, legendreSecondDerivativeTermSum = 0.0;
+        double orderTermSum = 0.0, orderDerivativeTermSum = 0.0, orderSquaredTermSum = 0.0;
+        for( int order = 0; order < currentNumberOfOrders; order++ )
+        {
+            const double orderValue = static_cast< double >( order );
+            const double inPhaseTerm = currentCosineCoefficients[ order ] * cosinesOfLongitude[ order ] +
+                    currentSineCoefficients[ order ] * sinesOfLongitude[ order ];
+            const double outOfPhaseTerm = currentSineCoefficients[ order ] * cosinesOfLongitude[ order ] -
+                    currentCosineCoefficients[ order ] * sinesOfLongitude[ order ];
+
+            legendreTermSum += currentLegendrePolynomials[ order ] * inPhaseTerm;
+            legendreDerivativeTermSum += currentLegendrePolynomialDerivatives[ order ] * inPhaseTerm;
+            legendreSecondDerivativeTermSum += currentLegendrePolynomialSecondDerivatives[ order ] * inPhaseTerm;
+            orderTermSum += orderValue * currentLegendrePolynomials[ order ] * outOfPhaseTerm;
+            orderDerivativeTermSum += orderValue * currentLegendrePolynomialDerivatives[ order ] * outOfPhaseTerm;
+            orderSquaredTermSum += orderValue * orderValue * currentLegendrePolynomials[ order ] * inPhaseTerm;
+
+            // Set partials w.r.t. coefficients of current degree and order, if required.
+            if( computeCosinePartials && cosineCoefficientPartialColumns( degree, order ) >= 0 )
+            {
+                double* partial =
+                        cosineCoefficientPartials.data( ) + 3 * cosineCoefficientPartialColumns( degree, order );
+                partial[ radiusIndex ] = -radiusPowerTerm * degreeTerm * currentLegendrePolynomials[ order ] *
+                        cosinesOfLongitude[ order ];
+                partial[ latitudeIndex ] = radiusPowerTerm * cosineOfLatitude *
+                        currentLegendrePolynomialDerivatives[ order ] * cosinesOfLongitude[ order ];
+                partial[ longitudeIndex ] = -radiusPowerTerm * orderValue * currentLegendrePolynomials[ order ] *
+                        sinesOfLongitude[ order ];
+            }
+            if( computeSinePartials && sineCoefficientPartialColumns( degree, order ) >= 0 )
+            {
+                double* partial =
+                        sineCoefficientPartials.data( ) + 3 * sineCoefficientPartialColumns( degree, order );
+                partial[ radiusIndex ] = -radiusPowerTerm * degreeTerm * currentLegendrePolynomials[ order ] *
+                        sinesOfLongitude[ order ];
+                partial[ latitudeIndex ] = radiusPowerTerm * cosineOfLatitude *
+                        currentLegendrePolynomialDerivatives[ order ] * sinesOfLongitude[ order ];
+                partial[ longitudeIndex ] = radiusPowerTerm * orderValue * currentLegendrePolynomials[ order ] *
+                        cosinesOfLongitude[ order ];
+            }
+        }
+
+        // Add contributions of current degree to gradient and Hessian.
+        sphericalGradient( radiusIndex ) -= radiusPowerTerm * degreeTerm * legendreTermSum;
+        sphericalGradient( latitudeIndex ) += radiusPowerTerm * cosineOfLatitude * legendreDerivativeTermSum;
+        sphericalGradient( longitudeIndex ) += radiusPowerTerm * orderTermSum;
+
+        sphericalHessian( 0, 0 ) += radiusPowerTerm * degreeTerm * static_cast< double >( degree + 2 ) / distance *
+                legendreTermSum;
+        sphericalHessian( 1, 0 ) -= radiusPowerTerm * degreeTerm * cosineOfLatitude * legendreDerivativeTermSum;
+        sphericalHessian( 2, 0 ) -= radiusPowerTerm * degreeTerm * orderTermSum;
+        sphericalHessian( 1, 1 ) += radiusPowerTerm * ( cosineOfLatitude * cosineOfLatitude *
+                                                        legendreSecondDerivativeTermSum -
+                                                        sineOfLatitude * legendreDerivativeTermSum );
+        sphericalHessian( 2, 1 ) += radiusPowerTerm * cosineOfLatitude * orderDerivativeTermSum;
+        sphericalHessian( 2, 2 ) -= radiusPowerTerm * orderSquaredTermSum;
+    }
+
+    sphericalHessian( 0, 1 ) = sphericalHessian( 1, 0 );
+    sphericalHessian( 0, 2 ) = sphericalHessian( 2, 0 );
+    sphericalHessian( 1, 2 ) = sphericalHessian( 2, 1 );
+}
+
 //! Calculate partial of spherical harmonic acceleration w.r.t. position of body undergoing acceleration
 //! (in the body-fixed frame)
 Eigen::Matrix3d computePartialDerivativeOfBodyFixedSphericalHarmonicAcceleration(
@@ -16,6 +16,7 @@
 #include <Eigen/Core>
 
 #include "Tudat/Mathematics/BasicMathematics/sphericalHarmonics.h"
+#include "Tudat/Astrodynamics/Gravitation/sphericalHarmonicsGravityModel.h"
 
 namespace tudat
 {
@@ -145,6 +146,49 @@ Eigen::Matrix3d computeCumulativeSphericalHessian(
         const Eigen::MatrixXd sineHarmonicCoefficients,
         const boost::shared_ptr< basic_mathematics::SphericalHarmonicsCache > sphericalHarmonicsCache );
 
+//! Function to compute the spherical gradient, spherical Hessian and coefficient partials of a full spherical harmonic
+//! potential in a single pass
+/*!
+ *  Function to compute the spherical gradient, the spherical Hessian and the partials of the spherical gradient w.r.t.
+ *  a set of cosine and sine coefficients of a full spherical harmonic potential, in a single pass over all degrees and
+ *  orders of the expansion. The terms of each degree and order are retrieved from the cache only once, and are used
+ *  for all three quantities. The coefficient partials for which a column index is set are written directly into the
+ *  corresponding column of the output partial matrices.
+ *  \param sphericalPosition Spherical position (radius, ,latitude, longitude) at which potential partials are to be
+ *  evaluated
+ *  \param referenceRadius Reference radius of spherical harmonic potential.
+ *  \param gravitionalParameter Gravitational parameter used for spherical harmonic expansion
+ *  \param cosineHarmonicCoefficients Cosine spherical harmonic coefficients (stored degree-major).
+ *  \param sineHarmonicCoefficients Sine spherical harmonic coefficients (stored degree-major).
+ *  \param sphericalHarmonicsCache Cache object containing precomputed spherical harmonics terms (must be updated to
+ *  current position, with computation of second derivatives of the Legendre polynomials enabled).
+ *  \param cosineCoefficientPartialColumns Matrix with, at entry (degree, order), the column of
+ *  cosineCoefficientPartials in which the partial w.r.t. that cosine coefficient is to be set (-1 if not required).
+ *  Must be empty (no partials required) or of the same size as the coefficient matrices.
+ *  \param sineCoefficientPartialColumns Matrix with, at entry (degree, order), the column of sineCoefficientPartials
+ *  in which the partial w.r.t. that sine coefficient is to be set (-1 if not required). Must be empty (no partials
+ *  required) or of the same size as the coefficient matrices.
+ *  \param sphericalGradient Gradient of potential in spherical coordinates (returned by reference).
+ *  \param sphericalHessian Hessian of potential in spherical coordinates (returned by reference).
+ *  \param cosineCoefficientPartials Partials of the spherical gradient w.r.t. the requested cosine coefficients
+ *  (returned by reference; must have three rows, and a column for each requested coefficient).
+ *  \param sineCoefficientPartials Partials of the spherical gradient w.r.t. the requested sine coefficients
+ *  (returned by reference; must have three rows, and a column for each requested coefficient).
+ */
+void computeSphericalHarmonicGradientHessianAndCoefficientPartials(
+        const Eigen::Vector3d& sphericalPosition,
+        const double referenceRadius,
+        const double gravitionalParameter,
+        const gravitation::DegreeMajorCoefficientMatrix& cosineHarmonicCoefficients,
+        const gravitation::DegreeMajorCoefficientMatrix& sineHarmonicCoefficients,
+        const boost::shared_ptr< basic_mathematics::SphericalHarmonicsCache > sphericalHarmonicsCache,
+        const Eigen::MatrixXi& cosineCoefficientPartialColumns,
+        const Eigen::MatrixXi& sineCoefficientPartialColumns,
+        Eigen::Vector3d& sphericalGradient,
+        Eigen::Matrix3d& sphericalHessian,
+        Eigen::MatrixXd& cosineCoefficientPartials,
+        Eigen::MatrixXd& sineCoefficientPartials );
+
 //! Calculate partial of spherical harmonic acceleration w.r.t. position of body undergoing acceleration
 //! (in the body-fixed frame)
 /*!
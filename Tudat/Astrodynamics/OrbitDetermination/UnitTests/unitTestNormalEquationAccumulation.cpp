@@ -0,0 +1,266 @@
+/*    Copyright (c) 2010-2017, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ */
+
+#define BOOST_TEST_MAIN
+
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+#include <boost/make_shared.hpp>
+#include <boost/test/unit_test.hpp>
+
+#include "Tudat/Basics/testMacros.h"
+#include "Tudat/Astrodynamics/ObservationModels/simulateObservations.h"
+#include "Tudat/Astrodynamics/OrbitDetermination/orbitDeterminationManager.h"
+#include "Tudat/Mathematics/BasicMathematics/leastSquaresEstimation.h"
+#include "Tudat/SimulationSetup/EnvironmentSetup/createBodies.h"
+#include "Tudat/SimulationSetup/EstimationSetup/createEstimatableParameters.h"
+#include "Tudat/SimulationSetup/PropagationSetup/createAccelerationModels.h"
+#include "Tudat/Astrodynamics/Propagators/UnitTests/testEarthOrbiterEnvironment.h"
+
+namespace tudat
+{
+namespace unit_tests
+{
+
+using namespace tudat::observation_models;
+using namespace tudat::estimatable_parameters;
+using namespace tudat::numerical_integrators;
+using namespace tudat::simulation_setup;
+using namespace tudat::propagators;
+
+BOOST_AUTO_TEST_SUITE( test_normal_equation_accumulation )
+
+//! Test whether least squares solution from normal equations accumulated per block is equal to solution from full
+//! information matrix.
+BOOST_AUTO_TEST_CASE( testLeastSquaresFromNormalEquations )
+{
+    const int numberOfObservations = 1000;
+    const int numberOfParameters = 6;
+
+    // Create deterministic information matrix, residuals and weights
+    Eigen::MatrixXd informationMatrix = Eigen::MatrixXd( numberOfObservations, numberOfParameters );
+    Eigen::VectorXd residuals = Eigen::VectorXd( numberOfObservations );
+    Eigen::VectorXd weights = Eigen::VectorXd( numberOfObservations );
+    for( int i = 0; i < numberOfObservations; i++ )
+    {
+        for( int j = 0; j < numberOfParameters; j++ )
+        {
+            informationMatrix( i, j ) = std::sin( 0.01 * static_cast< double >( ( j + 1 ) * i ) + j );
+        }
+        residuals( i ) = std::cos( 0.03 * static_cast< double >( i ) );
+        weights( i ) = 1.0 + 0.5 * std::sin( static_cast< double >( i ) );
+    }
+    Eigen::MatrixXd inverseAprioriCovariance = 0.1 * Eigen::MatrixXd::Identity( numberOfParameters, numberOfParameters );
+
+    std::pair< Eigen::VectorXd, Eigen::MatrixXd > fullSolution =
+            linear_algebra::performLeastSquaresAdjustmentFromInformationMatrix(
+                informationMatrix, residuals, weights, inverseAprioriCovariance );
+
+    // Accumulate normal equations in blocks of unequal size
+    Eigen::MatrixXd normalEquationsMatrix = Eigen::MatrixXd::Zero( numberOfParameters, numberOfParameters );
+    Eigen::VectorXd normalEquationsRightHandSide = Eigen::VectorXd::Zero( numberOfParameters );
+    int blockSize = 37;
+    for( int i = 0; i < numberOfObservations; i += blockSize )
+    {
+        int currentBlockSize = std::min( blockSize, numberOfObservations - i );
+        linear_algebra::addObservationBlockToNormalEquations(
+                    informationMatrix.block( i, 0, currentBlockSize, numberOfParameters ),
+                    residuals.segment( i, currentBlockSize ), weights.segment( i, currentBlockSize ),
+                    normalEquationsMatrix, normalEquationsRightHandSide );
+    }
+
+    std::pair< Eigen::VectorXd, Eigen::MatrixXd > accumulatedSolution =
+            linear_algebra::performLeastSquaresAdjustmentFromNormalEquations(
+                normalEquationsMatrix, normalEquationsRightHandSide, inverseAprioriCovariance );
+
+    TUDAT_CHECK_MATRIX_CLOSE_FRACTION( accumulatedSolution.first, fullSolution.first, 1.0E-10 );
+    TUDAT_CHECK_MATRIX_CLOSE_FRACTION( accumulatedSolution.second, fullSolution.second, 1.0E-12 );
+
+    // Check inconsistent input
+    BOOST_CHECK_THROW( linear_algebra::addObservationBlockToNormalEquations(
+                           informationMatrix, residuals.segment( 0, 10 ), weights,
+                           normalEquationsMatrix, normalEquationsRightHandSide ), std::runtime_error );
+}
+
+//! Test whether estimation with normal equations accumulated per block of observations (optionally on multiple threads)
+//! gives the same result as the estimation using the full matrix of observation partials.
+BOOST_AUTO_TEST_CASE( testEstimationWithNormalEquationAccumulation )
+{
+    typedef OrbitDeterminationManager< double, double > OrbitDeterminationManagerType;
+    typedef OrbitDeterminationManagerType::PodInputType PodInputType;
+
+    NamedBodyMap bodyMap = createEarthOrbiterTestBodies( );
+    addEarthGroundStationsToTestBodies( bodyMap );
+
+    // Create propagation settings
+    SelectedAccelerationMap accelerationMap;
+    accelerationMap[ "Vehicle" ][ "Earth" ].push_back(
+                boost::make_shared< AccelerationSettings >( basic_astrodynamics::central_gravity ) );
+    std::vector< std::string > bodiesToIntegrate( 1, "Vehicle" );
+    std::vector< std::string > centralBodies( 1, "Earth" );
+
+    Eigen::Vector6d initialState = Eigen::Vector6d::Zero( );
+    initialState( 0 ) = 7.2E6;
+    initialState( 4 ) = 6.5E3;
+    initialState( 5 ) = 3.5E3;
+
+    const double initialTime = 0.0;
+    const double finalTime = 86400.0;
+    boost::shared_ptr< TranslationalStatePropagatorSettings< double > > propagatorSettings =
+            boost::make_shared< TranslationalStatePropagatorSettings< double > >(
+                centralBodies, createAccelerationModelsMap( bodyMap, accelerationMap, bodiesToIntegrate, centralBodies ),
+                bodiesToIntegrate, initialState, finalTime );
+    boost::shared_ptr< IntegratorSettings< > > integratorSettings =
+            boost::make_shared< IntegratorSettings< > >( rungeKutta4, initialTime, 30.0 );
+
+    // Define link ends and observation settings
+    std::map< ObservableType, std::vector< LinkEnds > > linkEndsPerObservable;
+    std::vector< std::string > stationNames;
+    stationNames.push_back( "Station1" );
+    stationNames.push_back( "Station2" );
+    for( unsigned int i = 0; i < stationNames.size( ); i++ )
+    {
+        LinkEnds linkEnds;
+        linkEnds[ transmitter ] = std::make_pair( "Earth", stationNames.at( i ) );
+        linkEnds[ receiver ] = std::make_pair( "Vehicle", "" );
+        linkEndsPerObservable[ one_way_range ].push_back( linkEnds );
+
+        linkEnds.clear( );
+        linkEnds[ receiver ] = std::make_pair( "Earth", stationNames.at( i ) );
+        linkEnds[ transmitter ] = std::make_pair( "Vehicle", "" );
+        linkEndsPerObservable[ angular_position ].push_back( linkEnds );
+    }
+
+    ObservationSettingsMap observationSettingsMap;
+    for( std::map< ObservableType, std::vector< LinkEnds > >::iterator linkEndIterator = linkEndsPerObservable.begin( );
+         linkEndIterator != linkEndsPerObservable.end( ); linkEndIterator++ )
+    {
+        for( unsigned int i = 0; i < linkEndIterator->second.size( ); i++ )
+        {
+            observationSettingsMap.insert(
+                        std::make_pair( linkEndIterator->second.at( i ),
+                                        boost::make_shared< ObservationSettings >( linkEndIterator->first ) ) );
+        }
+    }
+
+    // Define estimated parameters
+    std::vector< boost::shared_ptr< EstimatableParameterSettings > > parameterNames;
+    parameterNames.push_back( boost::make_shared< InitialTranslationalStateEstimatableParameterSettings< double > >(
+                                  "Vehicle", initialState, "Earth" ) );
+    parameterNames.push_back( boost::make_shared< EstimatableParameterSettings >( "Earth", gravitational_parameter ) );
+    parameterNames.push_back( boost::make_shared< EstimatableParameterSettings >(
+                                  "Earth", ground_station_position, "Station1" ) );
+    boost::shared_ptr< EstimatableParameterSet< double > > parametersToEstimate =
+            createParametersToEstimate( parameterNames, bodyMap );
+    int numberOfParameters = parametersToEstimate->getParameterSetSize( );
+
+    // Create orbit determination managers, using 1 and 2 threads
+    std::vector< boost::shared_ptr< OrbitDeterminationManagerType > > orbitDeterminationManagers;
+    orbitDeterminationManagers.push_back(
+                boost::make_shared< OrbitDeterminationManagerType >(
+                    bodyMap, parametersToEstimate, observationSettingsMap, integratorSettings, propagatorSettings ) );
+    orbitDeterminationManagers.push_back(
+                boost::make_shared< OrbitDeterminationManagerType >(
+                    bodyMap, parametersToEstimate, observationSettingsMap, integratorSettings, propagatorSettings, 2 ) );
+
+    // Simulate observations from true parameter values
+    orbitDeterminationManagers.at( 0 )->resetParameterEstimate(
+                parametersToEstimate->getFullParameterValues< double >( ) );
+    std::vector< double > observationTimes;
+    for( unsigned int i = 0; i < 1400; i++ )
+    {
+        observationTimes.push_back( 600.0 + static_cast< double >( i ) * 60.0 );
+    }
+    std::map< ObservableType, std::map< LinkEnds, std::pair< std::vector< double >, LinkEndType > > >
+            measurementSimulationInput;
+    for( std::map< ObservableType, std::vector< LinkEnds > >::iterator linkEndIterator = linkEndsPerObservable.begin( );
+         linkEndIterator != linkEndsPerObservable.end( ); linkEndIterator++ )
+    {
+        for( unsigned int i = 0; i < linkEndIterator->second.size( ); i++ )
+        {
+            measurementSimulationInput[ linkEndIterator->first ][ linkEndIterator->second.at( i ) ] =
+                    std::make_pair( observationTimes, receiver );
+        }
+    }
+    PodInputType observationsAndTimes = simulateObservations< double, double >(
+                measurementSimulationInput, orbitDeterminationManagers.at( 0 )->getObservationSimulators( ) );
+    int numberOfObservations =
+            OrbitDeterminationManagerType::getNumberOfObservationsPerObservable( observationsAndTimes ).second;
+
+    // Define perturbed initial parameter values
+    Eigen::VectorXd truthParameters = parametersToEstimate->getFullParameterValues< double >( );
+    Eigen::VectorXd parameterPerturbation = Eigen::VectorXd::Zero( numberOfParameters );
+    parameterPerturbation.segment( 0, 3 ) = Eigen::Vector3d( 10.0, -5.0, 8.0 );
+    parameterPerturbation.segment( 3, 3 ) = Eigen::Vector3d( 1.0E-2, 2.0E-2, -1.0E-2 );
+    parameterPerturbation( 6 ) = 1.0E6;
+    parameterPerturbation.segment( 7, 3 ) = Eigen::Vector3d( 5.0, -3.0, 2.0 );
+
+    Eigen::MatrixXd inverseAprioriCovariance = Eigen::MatrixXd::Zero( numberOfParameters, numberOfParameters );
+    for( int i = 7; i < 10; i++ )
+    {
+        inverseAprioriCovariance( i, i ) = 1.0E-4;
+    }
+
+    // Run estimation using full partials matrix (0), accumulated normal equations (1), accumulated normal equations
+    // on two threads (2)
+    std::vector< boost::shared_ptr< PodOutput< double > > > podOutputs;
+    for( unsigned int testCase = 0; testCase < 3; testCase++ )
+    {
+        parametersToEstimate->resetParameterValues< double >( truthParameters + parameterPerturbation );
+
+        boost::shared_ptr< PodInput< double, double > > podInput =
+                boost::make_shared< PodInput< double, double > >(
+                    observationsAndTimes, numberOfParameters, inverseAprioriCovariance );
+        podInput->defineEstimationSettings( true, true, true, false );
+        if( testCase > 0 )
+        {
+            podInput->defineNormalEquationAccumulationSettings( true, 500 );
+        }
+
+        podOutputs.push_back( orbitDeterminationManagers.at( ( testCase == 2 ) ? 1 : 0 )->estimateParameters(
+                                  podInput, boost::make_shared< EstimationConvergenceChecker >( 2 ) ) );
+    }
+
+    // Check that estimation converged to truth
+    for( int i = 0; i < numberOfParameters; i++ )
+    {
+        BOOST_CHECK_SMALL( std::fabs( podOutputs.at( 0 )->parameterEstimate_( i ) - truthParameters( i ) ),
+                           1.0E-3 * std::fabs( parameterPerturbation( i ) ) );
+    }
+
+    // Compare results of accumulated normal equations to those with full partials matrix (differences due to rounding
+    // in first iteration propagate to the partials and residuals of the second iteration)
+    BOOST_CHECK_EQUAL( podOutputs.at( 0 )->normalizedInformationMatrix_.rows( ), numberOfObservations );
+    for( unsigned int testCase = 1; testCase < 3; testCase++ )
+    {
+        BOOST_CHECK_EQUAL( podOutputs.at( testCase )->normalizedInformationMatrix_.rows( ), 0 );
+        BOOST_CHECK_EQUAL( podOutputs.at( testCase )->residuals_.rows( ), numberOfObservations );
+
+        for( int i = 0; i < numberOfParameters; i++ )
+        {
+            BOOST_CHECK_SMALL( std::fabs( podOutputs.at( testCase )->parameterEstimate_( i ) -
+                                          podOutputs.at( 0 )->parameterEstimate_( i ) ),
+                               1.0E-5 * std::fabs( parameterPerturbation( i ) ) );
+        }
+        TUDAT_CHECK_MATRIX_CLOSE_FRACTION( podOutputs.at( testCase )->informationMatrixTransformationDiagonal_,
+                                           podOutputs.at( 0 )->informationMatrixTransformationDiagonal_, 1.0E-10 );
+        TUDAT_CHECK_MATRIX_CLOSE_FRACTION( podOutputs.at( testCase )->getUnnormalizedInverseCovarianceMatrix( ),
+                                           podOutputs.at( 0 )->getUnnormalizedInverseCovarianceMatrix( ), 1.0E-10 );
+        BOOST_CHECK_SMALL( ( podOutputs.at( testCase )->residuals_ - podOutputs.at( 0 )->residuals_ ).norm( ),
+                           1.0E-5 * podOutputs.at( 0 )->residuals_.norm( ) );
+    }
+}
+
+BOOST_AUTO_TEST_SUITE_END( )
+
+} // namespace unit_tests
+} // namespace tudat
@@ -0,0 +1,268 @@
+/*    Copyright (c) 2010-2017, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ */
+
+#define BOOST_TEST_MAIN
+
+#include <stdexcept>
+#include <vector>
+
+#include <boost/make_shared.hpp>
+#include <boost/test/unit_test.hpp>
+
+#include "Tudat/Astrodynamics/Ephemerides/keplerEphemeris.h"
+#include "Tudat/Astrodynamics/ObservationModels/simulateObservations.h"
+#include "Tudat/Astrodynamics/OrbitDetermination/orbitDeterminationManager.h"
+#include "Tudat/SimulationSetup/EnvironmentSetup/createBodies.h"
+#include "Tudat/SimulationSetup/EstimationSetup/createEstimatableParameters.h"
+#include "Tudat/SimulationSetup/PropagationSetup/createAccelerationModels.h"
+#include "Tudat/Astrodynamics/Propagators/UnitTests/testEarthOrbiterEnvironment.h"
+
+namespace tudat
+{
+namespace unit_tests
+{
+
+using namespace tudat::observation_models;
+using namespace tudat::estimatable_parameters;
+using namespace tudat::numerical_integrators;
+using namespace tudat::simulation_setup;
+using namespace tudat::propagators;
+
+BOOST_AUTO_TEST_SUITE( test_parallel_observation_partials )
+
+//! Test whether the residuals and partials computed with multiple threads are identical to those computed with a single
+//! thread.
+BOOST_AUTO_TEST_CASE( testParallelObservationPartials )
+{
+    typedef OrbitDeterminationManager< double, double > OrbitDeterminationManagerType;
+
+    NamedBodyMap bodyMap = createEarthOrbiterTestBodies( );
+    addEarthGroundStationsToTestBodies( bodyMap );
+
+    // Create propagation settings
+    SelectedAccelerationMap accelerationMap;
+    accelerationMap[ "Vehicle" ][ "Earth" ].push_back(
+                boost::make_shared< AccelerationSettings >( basic_astrodynamics::central_gravity ) );
+    std::vector< std::string > bodiesToIntegrate( 1, "Vehicle" );
+    std::vector< std::string > centralBodies( 1, "Earth" );
+
+    Eigen::Vector6d initialState = Eigen::Vector6d::Zero( );
+    initialState( 0 ) = 7.2E6;
+    initialState( 4 ) = 6.5E3;
+    initialState( 5 ) = 3.5E3;
+
+    const double initialTime = 0.0;
+    const double finalTime = 86400.0;
+    boost::shared_ptr< TranslationalStatePropagatorSettings< double > > propagatorSettings =
+            boost::make_shared< TranslationalStatePropagatorSettings< double > >(
+                centralBodies, createAccelerationModelsMap( bodyMap, accelerationMap, bodiesToIntegrate, centralBodies ),
+                bodiesToIntegrate, initialState, finalTime );
+    boost::shared_ptr< IntegratorSettings< > > integratorSettings =
+            boost::make_shared< IntegratorSettings< > >( rungeKutta4, initialTime, 30.0 );
+
+    // Define link ends
+    std::map< ObservableType, std::vector< LinkEnds > > linkEndsPerObservable;
+    std::vector< std::string > stationNames;
+    stationNames.push_back( "Station1" );
+    stationNames.push_back( "Station2" );
+    for( unsigned int i = 0; i < stationNames.size( ); i++ )
+    {
+        LinkEnds linkEnds;
+        linkEnds[ transmitter ] = std::make_pair( "Earth", stationNames.at( i ) );
+        linkEnds[ receiver ] = std::make_pair( "Vehicle", "" );
+        linkEndsPerObservable[ one_way_range ].push_back( linkEnds );
+        linkEndsPerObservable[ one_way_doppler ].push_back( linkEnds );
+
+        linkEnds.clear( );
+        linkEnds[ receiver ] = std::make_pair( "Earth", stationNames.at( i ) );
+        linkEnds[ transmitter ] = std::make_pair( "Vehicle", "" );
+        linkEndsPerObservable[ angular_position ].push_back( linkEnds );
+    }
+
+    ObservationSettingsMap observationSettingsMap;
+    for( std::map< ObservableType, std::vector< LinkEnds > >::iterator linkEndIterator = linkEndsPerObservable.begin( );
+         linkEndIterator != linkEndsPerObservable.end( ); linkEndIterator++ )
+    {
+        for( unsigned int i = 0; i < linkEndIterator->second.size( ); i++ )
+        {
+            observationSettingsMap.insert(
+                        std::make_pair( linkEndIterator->second.at( i ),
+                                        boost::make_shared< ObservationSettings >( linkEndIterator->first ) ) );
+        }
+    }
+
+    // Define estimated parameters
+    std::vector< boost::shared_ptr< EstimatableParameterSettings > > parameterNames;
+    parameterNames.push_back( boost::make_shared< InitialTranslationalStateEstimatableParameterSettings< double > >(
+                                  "Vehicle", initialState, "Earth" ) );
+    parameterNames.push_back( boost::make_shared< EstimatableParameterSettings >( "Earth", gravitational_parameter ) );
+    parameterNames.push_back( boost::make_shared< EstimatableParameterSettings >( "Earth", rotation_pole_position ) );
+    parameterNames.push_back( boost::make_shared< EstimatableParameterSettings >(
+                                  "Earth", ground_station_position, "Station1" ) );
+    boost::shared_ptr< EstimatableParameterSet< double > > parametersToEstimate =
+            createParametersToEstimate( parameterNames, bodyMap );
+    int numberOfParameters = parametersToEstimate->getParameterSetSize( );
+
+    // Create orbit determination managers, using 1 to 4 threads
+    std::vector< boost::shared_ptr< OrbitDeterminationManagerType > > orbitDeterminationManagers;
+    for( unsigned int i = 1; i <= 4; i++ )
+    {
+        orbitDeterminationManagers.push_back(
+                    boost::make_shared< OrbitDeterminationManagerType >(
+                        bodyMap, parametersToEstimate, observationSettingsMap,
+                        integratorSettings, propagatorSettings, i ) );
+        BOOST_CHECK_EQUAL( orbitDeterminationManagers.at( i - 1 )->getNumberOfThreads( ), i );
+    }
+
+    // Define observation times (in reverse order for one set of link ends, which cannot be split over threads).
+    std::vector< double > observationTimes;
+    for( unsigned int i = 0; i < 2000; i++ )
+    {
+        observationTimes.push_back( 600.0 + static_cast< double >( i ) * 40.0 );
+    }
+    std::vector< double > reverseObservationTimes( observationTimes.rbegin( ), observationTimes.rend( ) );
+
+    std::map< ObservableType, std::map< LinkEnds, std::pair< std::vector< double >, LinkEndType > > >
+            measurementSimulationInput;
+    for( std::map< ObservableType, std::vector< LinkEnds > >::iterator linkEndIterator = linkEndsPerObservable.begin( );
+         linkEndIterator != linkEndsPerObservable.end( ); linkEndIterator++ )
+    {
+        for( unsigned int i = 0; i < linkEndIterator->second.size( ); i++ )
+        {
+            measurementSimulationInput[ linkEndIterator->first ][ linkEndIterator->second.at( i ) ] =
+                    std::make_pair( observationTimes, receiver );
+        }
+    }
+
+    typedef OrbitDeterminationManagerType::PodInputType PodInputType;
+    PodInputType observationsAndTimes = simulateObservations< double, double >(
+                measurementSimulationInput, orbitDeterminationManagers.at( 0 )->getObservationSimulators( ) );
+    observationsAndTimes[ one_way_range ].begin( )->second.second.first = reverseObservationTimes;
+    observationsAndTimes[ one_way_range ].begin( )->second.first.reverseInPlace( );
+
+    int numberOfObservations =
+            OrbitDeterminationManagerType::getNumberOfObservationsPerObservable(
+                observationsAndTimes ).second;
+
+    // Perturb rotation and ground station parameters, so that residuals are non-zero
+    Eigen::VectorXd parameterEstimate = parametersToEstimate->getFullParameterValues< double >( );
+    parameterEstimate( 7 ) += 1.0E-4;
+    parameterEstimate( 9 ) += 10.0;
+    parametersToEstimate->resetParameterValues( parameterEstimate );
+
+    // Compute residuals and partials with each manager, and compare to single-threaded computation
+    std::vector< std::pair< Eigen::VectorXd, Eigen::MatrixXd > > residualsAndPartials(
+                orbitDeterminationManagers.size( ) );
+    for( unsigned int i = 0; i < orbitDeterminationManagers.size( ); i++ )
+    {
+        orbitDeterminationManagers.at( i )->calculateObservationMatrixAndResiduals(
+                    observationsAndTimes, numberOfParameters, numberOfObservations, residualsAndPartials.at( i ) );
+
+        BOOST_CHECK_EQUAL( residualsAndPartials.at( i ).first.rows( ), numberOfObservations );
+        BOOST_CHECK_EQUAL( residualsAndPartials.at( i ).second.rows( ), numberOfObservations );
+        BOOST_CHECK_EQUAL( residualsAndPartials.at( i ).second.cols( ), numberOfParameters );
+        if( i > 0 )
+        {
+            BOOST_CHECK( residualsAndPartials.at( i ).first == residualsAndPartials.at( 0 ).first );
+            BOOST_CHECK( residualsAndPartials.at( i ).second == residualsAndPartials.at( 0 ).second );
+        }
+    }
+
+    // Check that residuals are computed correctly
+    BOOST_CHECK( residualsAndPartials.at( 0 ).first.norm( ) > 0.0 );
+
+    // Check that estimation of observation biases is not allowed with multiple threads
+    observationSettingsMap.clear( );
+    observationSettingsMap.insert(
+                std::make_pair( linkEndsPerObservable.at( one_way_range ).at( 0 ),
+                                boost::make_shared< ObservationSettings >(
+                                    one_way_range, boost::shared_ptr< LightTimeCorrectionSettings >( ),
+                                    boost::make_shared< ConstantObservationBiasSettings >(
+                                        Eigen::Vector1d::Zero( ) ) ) ) );
+    parameterNames.push_back( boost::make_shared< ConstantObservationBiasEstimatableParameterSettings >(
+                                  linkEndsPerObservable.at( one_way_range ).at( 0 ), one_way_range, true ) );
+    parametersToEstimate = createParametersToEstimate( parameterNames, bodyMap );
+    BOOST_CHECK_THROW( OrbitDeterminationManagerType(
+                           bodyMap, parametersToEstimate, observationSettingsMap,
+                           integratorSettings, propagatorSettings, 2 ), std::runtime_error );
+}
+
+//! Test whether link end bodies of which the state cannot be computed concurrently are rejected when using multiple
+//! threads.
+BOOST_AUTO_TEST_CASE( testParallelObservationPartialsBodyStateSafety )
+{
+    typedef OrbitDeterminationManager< double, double > OrbitDeterminationManagerType;
+
+    NamedBodyMap bodyMap = createEarthOrbiterTestBodies( );
+    addEarthGroundStationsToTestBodies( bodyMap );
+
+    // Add body with Kepler ephemeris (not safe for concurrent evaluation) w.r.t. the Earth
+    bodyMap[ "Relay" ] = boost::make_shared< Body >( );
+    bodyMap[ "Relay" ]->setEphemeris( boost::make_shared< ephemerides::KeplerEphemeris >(
+                                          ( Eigen::Vector6d( ) << 4.2E7, 0.01, 0.1, 0.0, 0.0, 0.0 ).finished( ),
+                                          0.0, 3.986004418E14, "Earth", "ECLIPJ2000" ) );
+    setGlobalFrameBodyEphemerides( bodyMap, "SSB", "ECLIPJ2000" );
+
+    // Vehicle (tabulated, w.r.t. constant Earth) and Earth (constant) may be evaluated concurrently.
+    BOOST_CHECK( ( isBodyEphemerisStateEvaluationThreadSafe< double, double >( bodyMap.at( "Vehicle" ) ) ) );
+    BOOST_CHECK( ( isBodyEphemerisStateEvaluationThreadSafe< double, double >( bodyMap.at( "Earth" ) ) ) );
+    BOOST_CHECK( !( isBodyEphemerisStateEvaluationThreadSafe< long double, double >( bodyMap.at( "Vehicle" ) ) ) );
+    BOOST_CHECK( !( isBodyEphemerisStateEvaluationThreadSafe< double, double >( bodyMap.at( "Relay" ) ) ) );
+
+    // Create propagation settings
+    SelectedAccelerationMap accelerationMap;
+    accelerationMap[ "Vehicle" ][ "Earth" ].push_back(
+                boost::make_shared< AccelerationSettings >( basic_astrodynamics::central_gravity ) );
+    std::vector< std::string > bodiesToIntegrate( 1, "Vehicle" );
+    std::vector< std::string > centralBodies( 1, "Earth" );
+
+    Eigen::Vector6d initialState = Eigen::Vector6d::Zero( );
+    initialState( 0 ) = 7.2E6;
+    initialState( 4 ) = 6.5E3;
+    initialState( 5 ) = 3.5E3;
+
+    boost::shared_ptr< TranslationalStatePropagatorSettings< double > > propagatorSettings =
+            boost::make_shared< TranslationalStatePropagatorSettings< double > >(
+                centralBodies, createAccelerationModelsMap( bodyMap, accelerationMap, bodiesToIntegrate, centralBodies ),
+                bodiesToIntegrate, initialState, 3600.0 );
+    boost::shared_ptr< IntegratorSettings< > > integratorSettings =
+            boost::make_shared< IntegratorSettings< > >( rungeKutta4, 0.0, 30.0 );
+
+    std::vector< boost::shared_ptr< EstimatableParameterSettings > > parameterNames;
+    parameterNames.push_back( boost::make_shared< InitialTranslationalStateEstimatableParameterSettings< double > >(
+                                  "Vehicle", initialState, "Earth" ) );
+    boost::shared_ptr< EstimatableParameterSet< double > > parametersToEstimate =
+            createParametersToEstimate( parameterNames, bodyMap );
+
+    // Check that range between ground station and vehicle may be computed with multiple threads
+    LinkEnds linkEnds;
+    linkEnds[ transmitter ] = std::make_pair( "Earth", "Station1" );
+    linkEnds[ receiver ] = std::make_pair( "Vehicle", "" );
+    ObservationSettingsMap observationSettingsMap;
+    observationSettingsMap.insert( std::make_pair( linkEnds, boost::make_shared< ObservationSettings >( one_way_range ) ) );
+    BOOST_CHECK_NO_THROW( OrbitDeterminationManagerType(
+                              bodyMap, parametersToEstimate, observationSettingsMap,
+                              integratorSettings, propagatorSettings, 2 ) );
+
+    // Check that range between vehicle and relay may be computed with a single thread only
+    linkEnds[ transmitter ] = std::make_pair( "Relay", "" );
+    observationSettingsMap.insert( std::make_pair( linkEnds, boost::make_shared< ObservationSettings >( one_way_range ) ) );
+    BOOST_CHECK_NO_THROW( OrbitDeterminationManagerType(
+                              bodyMap, parametersToEstimate, observationSettingsMap,
+                              integratorSettings, propagatorSettings, 1 ) );
+    BOOST_CHECK_THROW( OrbitDeterminationManagerType(
+                           bodyMap, parametersToEstimate, observationSettingsMap,
+                           integratorSettings, propagatorSettings, 2 ), std::runtime_error );
+}
+
+BOOST_AUTO_TEST_SUITE_END( )
+
+} // namespace unit_tests
+} // namespace tudat
@@ -12,9 +12,12 @@
 #define TUDAT_ORBITDETERMINATIONMANAGER_H
 
 #include <algorithm>
+#include <limits>
 
+#include <boost/bind.hpp>
 #include <boost/make_shared.hpp>
 
+#include "Tudat/Basics/parallelComputation.h"
 #include "Tudat/InputOutput/basicInputOutput.h"
 #include "Tudat/Mathematics/BasicMathematics/leastSquaresEstimation.h"
 #include "Tudat/Astrodynamics/ObservationModels/observationManager.h"
@@ -192,6 +195,9 @@ public:
      *  (through estimateParameters function)
      *  \param integratorSettings Settings for numerical integrator.
      *  \param propagatorSettings Settings for propagator.
+     *  \param numberOfThreads Number of threads that are to be used to compute the observations and partials
+     *  (see calculateObservationMatrixAndResiduals). If equal to 0, the number of concurrent threads supported by the
+     *  hardware is used.
      */
     OrbitDeterminationManager(
             const NamedBodyMap &bodyMap,
@@ -199,10 +205,12 @@ public:
             parametersToEstimate,
             const observation_models::SortedObservationSettingsMap& observationSettingsMap,
             const boost::shared_ptr< numerical_integrators::IntegratorSettings< TimeType > > integratorSettings,
-            const boost::shared_ptr< propagators::PropagatorSettings< ObservationScalarType > > propagatorSettings ):
+            const boost::shared_ptr< propagators::PropagatorSettings< ObservationScalarType > > propagatorSettings,
+            const unsigned int numberOfThreads = 1 ):
         parametersToEstimate_( parametersToEstimate )
     {
-        initializeOrbitDeterminationManager( bodyMap, observationSettingsMap, integratorSettings, propagatorSettings );
+        initializeOrbitDeterminationManager( bodyMap, observationSettingsMap, integratorSettings, propagatorSettings,
+                                             numberOfThreads );
     }
 
     //! Constructor
@@ -215,6 +223,9 @@ public:
      *  (through estimateParameters function)
      *  \param integratorSettings Settings for numerical integrator.
      *  \param propagatorSettings Settings for propagator.
+     *  \param numberOfThreads Number of threads that are to be used to compute the observations and partials
+     *  (see calculateObservationMatrixAndResiduals). If equal to 0, the number of concurrent threads supported by the
+     *  hardware is used.
      */
     OrbitDeterminationManager(
             const NamedBodyMap &bodyMap,
@@ -222,11 +233,13 @@ public:
             parametersToEstimate,
             const observation_models::ObservationSettingsMap& observationSettingsMap,
             const boost::shared_ptr< numerical_integrators::IntegratorSettings< TimeType > > integratorSettings,
-            const boost::shared_ptr< propagators::PropagatorSettings< ObservationScalarType > > propagatorSettings ):
+            const boost::shared_ptr< propagators::PropagatorSettings< ObservationScalarType > > propagatorSettings,
+            const unsigned int numberOfThreads = 1 ):
         parametersToEstimate_( parametersToEstimate )
     {
         initializeOrbitDeterminationManager( bodyMap, observation_models::convertUnsortedToSortedObservationSettingsMap(
-                                                 observationSettingsMap ), integratorSettings, propagatorSettings );
+                                                 observationSettingsMap ), integratorSettings, propagatorSettings,
+                                             numberOfThreads );
     }
 
     //! Function to retrieve map of all observation managers
@@ -328,11 +341,27 @@ public:
         return std::make_pair( numberOfObservations, totalNumberOfObservations );
     }
 
+    //! Function to retrieve the number of threads that is used to compute the observations and partials
+    /*!
+     *  Function to retrieve the number of threads that is used to compute the observations and partials
+     *  \return Number of threads that is used to compute the observations and partials
+     */
+    unsigned int getNumberOfThreads( ) const
+    {
+        return numberOfThreads_;
+    }
+
     //! Function to calculate the observation partials matrix and residuals
     /*!
      *  This function calculates the observation partials matrix and residuals, based on the state transition matrix,
      *  sensitivity matrix and body states resulting from the previous numerical integration iteration.
-     *  Partials and observations are calculated by the observationManagers_.
+     *  Partials and observations are calculated by the observationManagers_. If more than one thread is used, the
+     *  observations are distributed over the threads (see calculateObservationMatrixAndResidualsForThread), each of which
+     *  uses its own set of observation managers, and writes a disjoint set of rows of the residuals and partials. The
+     *  result is identical to that obtained with a single thread. The observation managers of each thread evaluate the
+     *  link end states and state transition matrices with their own interpolator lookup hints (see
+     *  simulation_setup::BodyEphemerisStateEvaluator). Bodies for which this is not safe are rejected when the
+     *  manager is created (see checkConcurrentBodyStateEvaluation).
      *  \param observationsAndTimes Observable values and associated time tags, per observable type and set of link ends.
      *  \param parameterVectorSize Length of the vector of estimated parameters
      *  \param totalObservationSize Total number of observations in observationsAndTimes map.
@@ -347,6 +376,18 @@ public:
         residualsAndPartials.second = Eigen::MatrixXd::Zero( totalObservationSize, parameterVectorSize );
         residualsAndPartials.first = Eigen::VectorXd::Zero( totalObservationSize );
 
+        // Distribute observations over threads, if required
+        if( numberOfThreads_ > 1 )
+        {
+            utilities::executeParallelLoop(
+                        numberOfThreads_, numberOfThreads_,
+                        boost::bind( &OrbitDeterminationManager< ObservationScalarType, TimeType >::
+                                     calculateObservationMatrixAndResidualsForThread, this, _1,
+                                     boost::cref( observationsAndTimes ), parameterVectorSize,
+                                     boost::ref( residualsAndPartials ) ) );
+            return;
+        }
+
         // Declare variable denoting current index in vector of all observations.
         int startIndex = 0;
 
@@ -384,6 +425,96 @@ public:
         }
     }
 
+    //! Function to calculate the normalized normal equations and residuals, without storing the observation partials matrix
+    /*!
+     *  This function calculates the normal equations and residuals, based on the state transition matrix, sensitivity
+     *  matrix and body states resulting from the previous numerical integration iteration. Contrary to
+     *  calculateObservationMatrixAndResiduals, the full observation partials matrix is not stored. Instead, the partials
+     *  are computed for blocks of observations, and the contribution of each block to the normal equations is accumulated,
+     *  so that the required memory scales with the square of the number of parameters, instead of with the number of
+     *  observations times the number of parameters. The normal equations are normalized in the same manner as the
+     *  partials matrix in normalizeObservationMatrix. If more than one thread is used, each thread accumulates the normal
+     *  equations of its observations, which are summed afterwards (in a fixed order).
+     *  \param observationsAndTimes Observable values and associated time tags, per observable type and set of link ends.
+     *  \param weightsMatrixDiagonal Diagonal of observation weights matrix, for all observations in observationsAndTimes
+     *  \param parameterVectorSize Length of the vector of estimated parameters
+     *  \param totalObservationSize Total number of observations in observationsAndTimes map.
+     *  \param maximumBlockSize Maximum number of observations for which the partials are computed at once.
+     *  \param residuals Residuals of computed w.r.t. input observable values (return by reference).
+     *  \param normalizedNormalEquations Pair of normalized normal equations matrix H^T*W*H and right-hand side H^T*W*y
+     *  (return by reference).
+     *  \return Vector with scaling values used for normalization
+     */
+    Eigen::VectorXd calculateNormalEquationsAndResiduals(
+            const PodInputType& observationsAndTimes, const Eigen::VectorXd& weightsMatrixDiagonal,
+            const int parameterVectorSize, const int totalObservationSize, const int maximumBlockSize,
+            Eigen::VectorXd& residuals, std::pair< Eigen::MatrixXd, Eigen::VectorXd >& normalizedNormalEquations )
+    {
+        if( weightsMatrixDiagonal.rows( ) != totalObservationSize )
+        {
+            throw std::runtime_error( "Error when accumulating normal equations, size of weights vector is inconsistent" );
+        }
+
+        // Initialize return data and per-thread normal equations
+        residuals = Eigen::VectorXd::Zero( totalObservationSize );
+        std::vector< std::pair< Eigen::MatrixXd, Eigen::VectorXd > > normalEquationsPerThread(
+                    numberOfThreads_, std::make_pair( Eigen::MatrixXd::Zero( parameterVectorSize, parameterVectorSize ),
+                                                      Eigen::VectorXd::Zero( parameterVectorSize ) ) );
+        std::vector< std::pair< Eigen::VectorXd, Eigen::VectorXd > > partialsRangePerThread(
+                    numberOfThreads_, std::make_pair(
+                        Eigen::VectorXd::Constant( parameterVectorSize, std::numeric_limits< double >::max( ) ),
+                        Eigen::VectorXd::Constant( parameterVectorSize, -std::numeric_limits< double >::max( ) ) ) );
+
+        // Accumulate normal equations, distributing observations over threads if required
+        if( numberOfThreads_ > 1 )
+        {
+            utilities::executeParallelLoop(
+                        numberOfThreads_, numberOfThreads_,
+                        boost::bind( &OrbitDeterminationManager< ObservationScalarType, TimeType >::
+                                     calculateNormalEquationsAndResidualsForThread, this, _1,
+                                     boost::cref( observationsAndTimes ), boost::cref( weightsMatrixDiagonal ),
+                                     maximumBlockSize, boost::ref( residuals ), boost::ref( normalEquationsPerThread ),
+                                     boost::ref( partialsRangePerThread ) ) );
+        }
+        else
+        {
+            calculateNormalEquationsAndResidualsForThread(
+                        0, observationsAndTimes, weightsMatrixDiagonal, maximumBlockSize, residuals,
+                        normalEquationsPerThread, partialsRangePerThread );
+        }
+
+        // Sum contributions of all threads.
+        std::pair< Eigen::MatrixXd, Eigen::VectorXd > normalEquations = normalEquationsPerThread.at( 0 );
+        std::pair< Eigen::VectorXd, Eigen::VectorXd > partialsRange = partialsRangePerThread.at( 0 );
+        for( unsigned int i = 1; i < numberOfThreads_; i++ )
+        {
+            normalEquations.first += normalEquationsPerThread.at( i ).first;
+            normalEquations.second += normalEquationsPerThread.at( i ).second;
+            partialsRange.first = partialsRange.first.cwiseMin( partialsRangePerThread.at( i ).first );
+            partialsRange.second = partialsRange.second.cwiseMax( partialsRangePerThread.at( i ).second );
+        }
+
+        // Determine normalization terms in the same manner as normalizeObservationMatrix, and normalize normal equations
+        Eigen::VectorXd normalizationTerms = Eigen::VectorXd( parameterVectorSize );
+        for( int i = 0; i < parameterVectorSize; i++ )
+        {
+            if( std::fabs( partialsRange.first( i ) ) > partialsRange.second( i ) )
+            {
+                normalizationTerms( i ) = partialsRange.first( i );
+            }
+            else
+            {
+                normalizationTerms( i ) = partialsRange.second( i );
+            }
+        }
+
+        normalizedNormalEquations.first = normalEquations.first.cwiseQuotient(
+                    normalizationTerms * normalizationTerms.transpose( ) );
+        normalizedNormalEquations.second = normalEquations.second.cwiseQuotient( normalizationTerms );
+
+        return normalizationTerms;
+    }
+
     //! Function to normalize the matrix of partial derivatives so that each column is in the range [-1,1]
     /*!
      * Function to normalize the matrix of partial derivatives so that each column is in the range [-1,1]
@@ -470,7 +601,8 @@ public:
         ParameterVectorType bestParameterEstimate = ParameterVectorType::Zero( parameterVectorSize );
         Eigen::VectorXd bestTransformationData = Eigen::VectorXd::Zero( parameterVectorSize );
         Eigen::VectorXd bestResiduals = Eigen::VectorXd::Zero( totalNumberOfObservations );
-        Eigen::MatrixXd bestInformationMatrix = Eigen::MatrixXd::Zero( totalNumberOfObservations, parameterVectorSize );
+        Eigen::MatrixXd bestInformationMatrix = Eigen::MatrixXd::Zero(
+                    podInput->getAccumulateNormalEquations( ) ? 0 : totalNumberOfObservations, parameterVectorSize );
         Eigen::VectorXd bestWeightsMatrixDiagonal = Eigen::VectorXd::Zero( totalNumberOfObservations );
         Eigen::MatrixXd bestInverseNormalizedCovarianceMatrix = Eigen::MatrixXd::Zero( parameterVectorSize, parameterVectorSize );
 
@@ -516,14 +648,28 @@ public:
             {
                 std::cout << "Calculating residuals and partials " << totalNumberOfObservations << std::endl;
             }
-            // Calculate residuals and observation matrix for current parameter estimate.
+            // Calculate residuals and observation matrix (or normal equations) for current parameter estimate.
+            Eigen::VectorXd weightsMatrixDiagonal = getConcatenatedWeightsVector( podInput->getWeightsMatrixDiagonals( ) );
             std::pair< Eigen::VectorXd, Eigen::MatrixXd > residualsAndPartials;
-            calculateObservationMatrixAndResiduals(
-                        podInput->getObservationsAndTimes( ), parameterVectorSize, totalNumberOfObservations, residualsAndPartials );
+            std::pair< Eigen::MatrixXd, Eigen::VectorXd > normalizedNormalEquations;
+            Eigen::VectorXd transformationData;
+            if( podInput->getAccumulateNormalEquations( ) )
+            {
+                transformationData = calculateNormalEquationsAndResiduals(
+                            podInput->getObservationsAndTimes( ), weightsMatrixDiagonal, parameterVectorSize,
+                            totalNumberOfObservations, podInput->getNormalEquationsObservationBlockSize( ),
+                            residualsAndPartials.first, normalizedNormalEquations );
+            }
+            else
+            {
+                calculateObservationMatrixAndResiduals(
+                            podInput->getObservationsAndTimes( ), parameterVectorSize, totalNumberOfObservations,
+                            residualsAndPartials );
 
-            //input_output::writeMatrixToFile( residualsAndPartials.second, "currentPartials.dat" );
+                //input_output::writeMatrixToFile( residualsAndPartials.second, "currentPartials.dat" );
 
-            Eigen::VectorXd transformationData = normalizeObservationMatrix( residualsAndPartials.second );
+                transformationData = normalizeObservationMatrix( residualsAndPartials.second );
+            }
 
             Eigen::MatrixXd normalizedInverseAprioriCovarianceMatrix = Eigen::MatrixXd::Zero(
                         numberOfEstimatedParameters, numberOfEstimatedParameters );
@@ -539,11 +685,19 @@ public:
             }
 
             // Perform least squares calculation for correction to parameter vector.
-            std::pair< Eigen::VectorXd, Eigen::MatrixXd > leastSquaresOutput =
-                    linear_algebra::performLeastSquaresAdjustmentFromInformationMatrix(
-                        residualsAndPartials.second.block( 0, 0, residualsAndPartials.second.rows( ), numberOfEstimatedParameters ),
-                        residualsAndPartials.first, getConcatenatedWeightsVector( podInput->getWeightsMatrixDiagonals( ) ),
-                        normalizedInverseAprioriCovarianceMatrix );
+            std::pair< Eigen::VectorXd, Eigen::MatrixXd > leastSquaresOutput;
+            if( podInput->getAccumulateNormalEquations( ) )
+            {
+                leastSquaresOutput = linear_algebra::performLeastSquaresAdjustmentFromNormalEquations(
+                            normalizedNormalEquations.first, normalizedNormalEquations.second,
+                            normalizedInverseAprioriCovarianceMatrix );
+            }
+            else
+            {
+                leastSquaresOutput = linear_algebra::performLeastSquaresAdjustmentFromInformationMatrix(
+                            residualsAndPartials.second.block( 0, 0, residualsAndPartials.second.rows( ), numberOfEstimatedParameters ),
+                            residualsAndPartials.first, weightsMatrixDiagonal, normalizedInverseAprioriCovarianceMatrix );
+            }
             ParameterVectorType parameterAddition =
                     ( leastSquaresOutput.first.cwiseQuotient( transformationData.segment( 0, numberOfEstimatedParameters ) ) ).
                     template cast< ObservationScalarType >( );
@@ -585,11 +739,11 @@ public:
                 bestResidual = residualRms;
                 bestParameterEstimate = oldParameterEstimate;
                 bestResiduals = residualsAndPartials.first;
-                if( podInput->getSaveInformationMatrix( ) )
+                if( podInput->getSaveInformationMatrix( ) && !podInput->getAccumulateNormalEquations( ) )
                 {
                     bestInformationMatrix = residualsAndPartials.second;
                 }
-                bestWeightsMatrixDiagonal = getConcatenatedWeightsVector( podInput->getWeightsMatrixDiagonals( ) );
+                bestWeightsMatrixDiagonal = weightsMatrixDiagonal;
                 bestTransformationData = transformationData;
                 bestInverseNormalizedCovarianceMatrix = leastSquaresOutput.second;
             }
@@ -736,6 +890,354 @@ public:
 
 protected:
 
+    //! Function to check whether any observation link properties (e.g. observation biases) are estimated
+    /*!
+     *  Function to check whether any observation link properties (e.g. observation biases) are estimated. The estimated
+     *  parameter objects for such properties are linked to a single observation model, so they cannot be combined with
+     *  multiple sets of observation managers.
+     *  \return True if any observation link properties are estimated.
+     */
+    bool areObservationLinkPropertiesEstimated( )
+    {
+        bool linkPropertiesAreEstimated = false;
+
+        std::vector< boost::shared_ptr< estimatable_parameters::EstimatableParameter< double > > > doubleParameters =
+                parametersToEstimate_->getEstimatedDoubleParameters( );
+        for( unsigned int i = 0; i < doubleParameters.size( ); i++ )
+        {
+            if( estimatable_parameters::isParameterObservationLinkProperty(
+                        doubleParameters.at( i )->getParameterName( ).first ) )
+            {
+                linkPropertiesAreEstimated = true;
+            }
+        }
+
+        std::vector< boost::shared_ptr< estimatable_parameters::EstimatableParameter< Eigen::VectorXd > > > vectorParameters =
+                parametersToEstimate_->getEstimatedVectorParameters( );
+        for( unsigned int i = 0; i < vectorParameters.size( ); i++ )
+        {
+            if( estimatable_parameters::isParameterObservationLinkProperty(
+                        vectorParameters.at( i )->getParameterName( ).first ) )
+            {
+                linkPropertiesAreEstimated = true;
+            }
+        }
+
+        return linkPropertiesAreEstimated;
+    }
+
+    //! Function to check whether the states of all bodies used by the observation models may be computed concurrently
+    /*!
+     *  Function to check whether the states of all bodies used by the observation models (link end bodies and bodies
+     *  perturbing the light time) may be computed concurrently by the observation managers of multiple threads (see
+     *  simulation_setup::isBodyEphemerisStateEvaluationThreadSafe). An exception is thrown if this is not the case.
+     *  \param bodyMap List of body objects that comprises the environment
+     *  \param observationSettingsMap Sets of observation model settings per link ends and observable type
+     */
+    void checkConcurrentBodyStateEvaluation(
+            const NamedBodyMap& bodyMap,
+            const observation_models::SortedObservationSettingsMap& observationSettingsMap )
+    {
+        using namespace observation_models;
+
+        for( SortedObservationSettingsMap::const_iterator observablesIterator = observationSettingsMap.begin( );
+             observablesIterator != observationSettingsMap.end( ); observablesIterator++ )
+        {
+            for( std::map< LinkEnds, boost::shared_ptr< ObservationSettings > >::const_iterator linkEndIterator =
+                 observablesIterator->second.begin( ); linkEndIterator != observablesIterator->second.end( );
+                 linkEndIterator++ )
+            {
+                // Check link end bodies
+                for( LinkEnds::const_iterator linkEndsIterator = linkEndIterator->first.begin( );
+                     linkEndsIterator != linkEndIterator->first.end( ); linkEndsIterator++ )
+                {
+                    const std::string& bodyName = linkEndsIterator->second.first;
+                    if( bodyMap.count( bodyName ) != 0 &&
+                            !simulation_setup::isBodyEphemerisStateEvaluationThreadSafe< ObservationScalarType, TimeType >(
+                                bodyMap.at( bodyName ) ) )
+                    {
+                        throw std::runtime_error(
+                                    "Error in OrbitDeterminationManager, computing observations and partials on multiple "
+                                    "threads requires the ephemerides of link end body " + bodyName + " and its "
+                                    "ephemeris origin to be tabulated (with observation scalar and time types) or "
+                                    "constant" );
+                    }
+                }
+
+                // Check bodies perturbing the light time
+                const std::vector< boost::shared_ptr< LightTimeCorrectionSettings > >& lightTimeCorrections =
+                        linkEndIterator->second->lightTimeCorrectionsList_;
+                for( unsigned int i = 0; i < lightTimeCorrections.size( ); i++ )
+                {
+                    boost::shared_ptr< FirstOrderRelativisticLightTimeCorrectionSettings > relativisticCorrection =
+                            boost::dynamic_pointer_cast< FirstOrderRelativisticLightTimeCorrectionSettings >(
+                                lightTimeCorrections.at( i ) );
+                    if( relativisticCorrection == NULL )
+                    {
+                        continue;
+                    }
+
+                    const std::vector< std::string > perturbingBodies = relativisticCorrection->getPerturbingBodies( );
+                    for( unsigned int j = 0; j < perturbingBodies.size( ); j++ )
+                    {
+                        if( bodyMap.count( perturbingBodies.at( j ) ) != 0 &&
+                                !simulation_setup::isBodyEphemerisStateEvaluationThreadSafe< double, double >(
+                                    bodyMap.at( perturbingBodies.at( j ) ) ) )
+                        {
+                            throw std::runtime_error(
+                                        "Error in OrbitDeterminationManager, computing observations and partials on "
+                                        "multiple threads requires the ephemerides of light time perturbing body " +
+                                        perturbingBodies.at( j ) + " and its ephemeris origin to be tabulated (with "
+                                        "double precision) or constant" );
+                        }
+                    }
+                }
+            }
+        }
+    }
+
+    //! Function to determine which observation times of a single set of observations are processed by a given thread
+    /*!
+     *  Function to determine which observation times of a single set of observations (single observable type and link
+     *  ends) are processed by a given thread. The observations are split into (nearly) equal contiguous blocks, one per
+     *  thread. If the observation times are not strictly increasing, the full set is assigned to a single thread instead,
+     *  since the observation manager sorts the observations by time.
+     *  \param observationTimes Times at which the observations in the set are evaluated
+     *  \param numberOfObservations Number of entries in the vector of observations of the set
+     *  \param observationSetIndex Index of the set of observations in the full list of observations
+     *  \param threadIndex Index of the thread for which the observation times are to be determined
+     *  \param splitObservationSet Boolean denoting whether the set of observations is split into blocks (returned by
+     *  reference)
+     *  \param firstTimeIndex Index of the first observation time that is processed by the thread (returned by reference)
+     *  \param numberOfTimesInBlock Number of observation times that are processed by the thread (returned by reference)
+     */
+    void getObservationTimeIndicesForThread(
+            const std::vector< TimeType >& observationTimes, const int numberOfObservations,
+            const unsigned int observationSetIndex, const unsigned int threadIndex,
+            bool& splitObservationSet, int& firstTimeIndex, int& numberOfTimesInBlock )
+    {
+        int numberOfObservationTimes = observationTimes.size( );
+
+        // Check whether observations can be split into blocks
+        splitObservationSet =
+                ( numberOfObservationTimes > 0 ) && ( numberOfObservations % numberOfObservationTimes == 0 );
+        for( int i = 1; ( i < numberOfObservationTimes ) && splitObservationSet; i++ )
+        {
+            if( !( observationTimes.at( i - 1 ) < observationTimes.at( i ) ) )
+            {
+                splitObservationSet = false;
+            }
+        }
+
+        firstTimeIndex = 0;
+        numberOfTimesInBlock = 0;
+        if( splitObservationSet )
+        {
+            firstTimeIndex = static_cast< int >(
+                        ( static_cast< long >( numberOfObservationTimes ) * threadIndex ) / numberOfThreads_ );
+            numberOfTimesInBlock = static_cast< int >(
+                        ( static_cast< long >( numberOfObservationTimes ) * ( threadIndex + 1 ) ) /
+                        numberOfThreads_ ) - firstTimeIndex;
+        }
+        else if( observationSetIndex % numberOfThreads_ == threadIndex )
+        {
+            numberOfTimesInBlock = numberOfObservationTimes;
+        }
+    }
+
+    //! Function to calculate the part of the observation partials matrix and residuals that is assigned to a single thread
+    /*!
+     *  Function to calculate the part of the observation partials matrix and residuals that is assigned to a single thread,
+     *  using the observation managers of that thread. The observations are distributed over the threads as defined by
+     *  getObservationTimeIndicesForThread. Each thread writes only the rows of the residuals and partials that are
+     *  assigned to it.
+     *  \param threadIndex Index of the thread for which the computations are to be performed.
+     *  \param observationsAndTimes Observable values and associated time tags, per observable type and set of link ends.
+     *  \param parameterVectorSize Length of the vector of estimated parameters
+     *  \param residualsAndPartials Pair of residuals of computed w.r.t. input observable values and partials of
+     *  observables w.r.t. parameter vector, of which the rows assigned to the current thread are set (modified by
+     *  this function).
+     */
+    void calculateObservationMatrixAndResidualsForThread(
+            const unsigned int threadIndex, const PodInputType& observationsAndTimes, const int parameterVectorSize,
+            std::pair< Eigen::VectorXd, Eigen::MatrixXd >& residualsAndPartials )
+    {
+        // Declare variable denoting current index in vector of all observations.
+        int startIndex = 0;
+        unsigned int observationSetIndex = 0;
+
+        // Iterate over all observable types in observationsAndTimes
+        for( typename PodInputType::const_iterator observablesIterator = observationsAndTimes.begin( );
+             observablesIterator != observationsAndTimes.end( ); observablesIterator++ )
+        {
+            boost::shared_ptr< observation_models::ObservationManagerBase< ObservationScalarType, TimeType > >
+                    currentObservationManager = threadObservationManagers_.at( threadIndex ).at(
+                        observablesIterator->first );
+
+            // Iterate over all link ends for current observable type in observationsAndTimes
+            for( typename SingleObservablePodInputType::const_iterator dataIterator = observablesIterator->second.begin( );
+                 dataIterator != observablesIterator->second.end( ); dataIterator++  )
+            {
+                const std::vector< TimeType >& observationTimes = dataIterator->second.second.first;
+                int numberOfObservations = dataIterator->second.first.size( );
+                int numberOfObservationTimes = observationTimes.size( );
+
+                // Determine observation times for which computations are to be performed by current thread.
+                bool splitObservationSet;
+                int firstTimeIndex, numberOfTimesInBlock;
+                getObservationTimeIndicesForThread(
+                            observationTimes, numberOfObservations, observationSetIndex, threadIndex,
+                            splitObservationSet, firstTimeIndex, numberOfTimesInBlock );
+
+                if( numberOfTimesInBlock > 0 )
+                {
+                    // Compute estimated observables and partials from current parameter estimate.
+                    std::vector< TimeType > blockObservationTimes(
+                                observationTimes.begin( ) + firstTimeIndex,
+                                observationTimes.begin( ) + firstTimeIndex + numberOfTimesInBlock );
+                    std::pair< ObservationVectorType, Eigen::MatrixXd > observationsWithPartials =
+                            currentObservationManager->computeObservationsWithPartials(
+                                blockObservationTimes, dataIterator->first, dataIterator->second.second.second );
+
+                    // Determine rows of observations in current block
+                    int firstObservationIndex = 0;
+                    int numberOfObservationsInBlock = numberOfObservations;
+                    if( splitObservationSet )
+                    {
+                        int observationSize = numberOfObservations / numberOfObservationTimes;
+                        firstObservationIndex = firstTimeIndex * observationSize;
+                        numberOfObservationsInBlock = numberOfTimesInBlock * observationSize;
+                    }
+
+                    // Compute residuals for current block of observations.
+                    residualsAndPartials.first.segment( startIndex + firstObservationIndex, numberOfObservationsInBlock ) =
+                            ( dataIterator->second.first.segment( firstObservationIndex, numberOfObservationsInBlock ) -
+                              observationsWithPartials.first ).template cast< double >( );
+
+                    // Set current observation partials in matrix of all partials
+                    residualsAndPartials.second.block(
+                                startIndex + firstObservationIndex, 0, numberOfObservationsInBlock, parameterVectorSize ) =
+                            observationsWithPartials.second;
+                }
+
+                // Increment current index of observation.
+                startIndex += numberOfObservations;
+                observationSetIndex++;
+            }
+        }
+    }
+
+    //! Function to accumulate the normal equations and compute the residuals for the observations assigned to a single thread
+    /*!
+     *  Function to accumulate the (unnormalized) normal equations and compute the residuals for the observations that are
+     *  assigned to a single thread (see getObservationTimeIndicesForThread), using the observation managers of that thread.
+     *  The observations are processed in blocks of at most maximumBlockSize observations (unless a set of observations
+     *  cannot be split), so that only the partials of a single block are stored at any time.
+     *  \param threadIndex Index of the thread for which the computations are to be performed.
+     *  \param observationsAndTimes Observable values and associated time tags, per observable type and set of link ends.
+     *  \param weightsMatrixDiagonal Diagonal of observation weights matrix, for all observations in observationsAndTimes
+     *  \param maximumBlockSize Maximum number of observations for which the partials are computed at once.
+     *  \param residuals Residuals of computed w.r.t. input observable values, of which the entries assigned to the current
+     *  thread are set (modified by this function).
+     *  \param normalEquationsPerThread Pairs of unnormalized normal equations matrix H^T*W*H and right-hand side H^T*W*y
+     *  per thread, of which the entry of the current thread is updated with the contributions of the observations
+     *  (modified by this function).
+     *  \param partialsRangePerThread Pairs of minimum and maximum value of each column of the observation partials per
+     *  thread, of which the entry of the current thread is updated (modified by this function).
+     */
+    void calculateNormalEquationsAndResidualsForThread(
+            const unsigned int threadIndex, const PodInputType& observationsAndTimes,
+            const Eigen::VectorXd& weightsMatrixDiagonal, const int maximumBlockSize, Eigen::VectorXd& residuals,
+            std::vector< std::pair< Eigen::MatrixXd, Eigen::VectorXd > >& normalEquationsPerThread,
+            std::vector< std::pair< Eigen::VectorXd, Eigen::VectorXd > >& partialsRangePerThread )
+    {
+        std::pair< Eigen::MatrixXd, Eigen::VectorXd >& normalEquations = normalEquationsPerThread.at( threadIndex );
+        std::pair< Eigen::VectorXd, Eigen::VectorXd >& partialsRange = partialsRangePerThread.at( threadIndex );
+
+
+        // Declare variable denoting current index in vector of all observations.
+        int startIndex = 0;
+        unsigned int observationSetIndex = 0;
+
+        // Iterate over all observable types in observationsAndTimes
+        for( typename PodInputType::const_iterator observablesIterator = observationsAndTimes.begin( );
+             observablesIterator != observationsAndTimes.end( ); observablesIterator++ )
+        {
+            boost::shared_ptr< observation_models::ObservationManagerBase< ObservationScalarType, TimeType > >
+                    currentObservationManager = threadObservationManagers_.at( threadIndex ).at(
+                        observablesIterator->first );
+
+            // Iterate over all link ends for current observable type in observationsAndTimes
+            for( typename SingleObservablePodInputType::const_iterator dataIterator = observablesIterator->second.begin( );
+                 dataIterator != observablesIterator->second.end( ); dataIterator++  )
+            {
+                const std::vector< TimeType >& observationTimes = dataIterator->second.second.first;
+                int numberOfObservations = dataIterator->second.first.size( );
+
+                // Determine observation times for which computations are to be performed by current thread.
+                bool splitObservationSet;
+                int firstTimeIndex, numberOfTimesInThread;
+                getObservationTimeIndicesForThread(
+                            observationTimes, numberOfObservations, observationSetIndex, threadIndex,
+                            splitObservationSet, firstTimeIndex, numberOfTimesInThread );
+
+                // Determine number of observation times per block
+                int observationSize = 0;
+                int numberOfTimesPerBlock = numberOfTimesInThread;
+                if( splitObservationSet )
+                {
+                    observationSize = numberOfObservations / observationTimes.size( );
+                    numberOfTimesPerBlock = std::max( 1, maximumBlockSize / observationSize );
+                }
+
+                for( int blockStartIndex = firstTimeIndex; blockStartIndex < firstTimeIndex + numberOfTimesInThread;
+                     blockStartIndex += numberOfTimesPerBlock )
+                {
+                    int numberOfTimesInBlock = std::min(
+                                numberOfTimesPerBlock, firstTimeIndex + numberOfTimesInThread - blockStartIndex );
+
+                    // Compute estimated observables and partials from current parameter estimate.
+                    std::vector< TimeType > blockObservationTimes(
+                                observationTimes.begin( ) + blockStartIndex,
+                                observationTimes.begin( ) + blockStartIndex + numberOfTimesInBlock );
+                    std::pair< ObservationVectorType, Eigen::MatrixXd > observationsWithPartials =
+                            currentObservationManager->computeObservationsWithPartials(
+                                blockObservationTimes, dataIterator->first, dataIterator->second.second.second );
+
+                    // Determine rows of observations in current block
+                    int firstObservationIndex = 0;
+                    int numberOfObservationsInBlock = numberOfObservations;
+                    if( splitObservationSet )
+                    {
+                        firstObservationIndex = blockStartIndex * observationSize;
+                        numberOfObservationsInBlock = numberOfTimesInBlock * observationSize;
+                    }
+
+                    // Compute residuals for current block of observations.
+                    Eigen::VectorXd blockResiduals =
+                            ( dataIterator->second.first.segment( firstObservationIndex, numberOfObservationsInBlock ) -
+                              observationsWithPartials.first ).template cast< double >( );
+                    residuals.segment( startIndex + firstObservationIndex, numberOfObservationsInBlock ) = blockResiduals;
+
+                    // Add current block to normal equations, and update range of partials
+                    linear_algebra::addObservationBlockToNormalEquations(
+                                observationsWithPartials.second, blockResiduals,
+                                weightsMatrixDiagonal.segment( startIndex + firstObservationIndex,
+                                                               numberOfObservationsInBlock ),
+                                normalEquations.first, normalEquations.second );
+                    partialsRange.first = partialsRange.first.cwiseMin(
+                                observationsWithPartials.second.colwise( ).minCoeff( ).transpose( ) );
+                    partialsRange.second = partialsRange.second.cwiseMax(
+                                observationsWithPartials.second.colwise( ).maxCoeff( ).transpose( ) );
+                }
+
+                // Increment current index of observation.
+                startIndex += numberOfObservations;
+                observationSetIndex++;
+            }
+        }
+    }
+
     //! Function called by either constructor to initialize the object.
     /*!
      *  Function called by either constructor to initialize the object.
@@ -745,12 +1247,15 @@ protected:
      *  (through estimateParameters function)
      *  \param integratorSettings Settings for numerical integrator.
      *  \param propagatorSettings Settings for propagator.
+     *  \param numberOfThreads Number of threads that are to be used to compute the observations and partials
+     *  (0 to use number of concurrent threads supported by the hardware).
      */
     void initializeOrbitDeterminationManager(
             const NamedBodyMap &bodyMap,
             const observation_models::SortedObservationSettingsMap& observationSettingsMap,
             const boost::shared_ptr< numerical_integrators::IntegratorSettings< TimeType > > integratorSettings,
-            const boost::shared_ptr< propagators::PropagatorSettings< ObservationScalarType > > propagatorSettings )
+            const boost::shared_ptr< propagators::PropagatorSettings< ObservationScalarType > > propagatorSettings,
+            const unsigned int numberOfThreads )
     {
         using namespace numerical_integrators;
         using namespace orbit_determination;
@@ -838,6 +1343,36 @@ protected:
                         stateTransitionAndSensitivityMatrixInterface_ );
         }
 
+        // Create a separate set of observation managers for each additional thread
+        numberOfThreads_ = utilities::getNumberOfThreadsToUse( numberOfThreads );
+        threadObservationManagers_.clear( );
+        threadObservationManagers_.push_back( observationManagers_ );
+        if( numberOfThreads_ > 1 )
+        {
+            if( areObservationLinkPropertiesEstimated( ) )
+            {
+                throw std::runtime_error(
+                            "Error in OrbitDeterminationManager, computing observations and partials on multiple threads "
+                            "is not supported when estimating observation link properties (e.g. biases)" );
+            }
+            checkConcurrentBodyStateEvaluation( bodyMap, observationSettingsMap );
+
+            for( unsigned int i = 1; i < numberOfThreads_; i++ )
+            {
+                std::map< ObservableType, boost::shared_ptr< ObservationManagerBase< ObservationScalarType, TimeType > > >
+                        currentObservationManagers;
+                for( SortedObservationSettingsMap::const_iterator observablesIterator = observationSettingsMap.begin( );
+                     observablesIterator != observationSettingsMap.end( ); observablesIterator++ )
+                {
+                    currentObservationManagers[ observablesIterator->first ] =
+                            createObservationManagerBase< ObservationScalarType, TimeType >(
+                                observablesIterator->first, observablesIterator->second, bodyMap, parametersToEstimate_,
+                                stateTransitionAndSensitivityMatrixInterface_ );
+                }
+                threadObservationManagers_.push_back( currentObservationManagers );
+            }
+        }
+
         // Set current parameter estimate from body initial states and parameter set.
         currentParameterEstimate_ = parametersToEstimate_->template getFullParameterValues< ObservationScalarType >( );
 
@@ -881,6 +1416,18 @@ protected:
     std::map< observation_models::ObservableType,
     boost::shared_ptr< observation_models::ObservationManagerBase< ObservationScalarType, TimeType > > > observationManagers_;
 
+    //! Number of threads that is used to compute the observations and partials
+    unsigned int numberOfThreads_;
+
+    //! List of observation managers used by each thread.
+    /*!
+     *  List of observation managers used by each thread. The first entry contains the observationManagers_, the others
+     *  are created separately, so that each thread has its own light-time calculators, partial scaling objects, etc.
+     */
+    std::vector< std::map< observation_models::ObservableType,
+    boost::shared_ptr< observation_models::ObservationManagerBase< ObservationScalarType, TimeType > > > >
+    threadObservationManagers_;
+
     //! Container object for all parameters that are to be estimated
     boost::shared_ptr< estimatable_parameters::EstimatableParameterSet< ObservationScalarType > > parametersToEstimate_;
 
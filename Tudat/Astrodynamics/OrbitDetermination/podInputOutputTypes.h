@@ -64,7 +64,9 @@ public:
         reintegrateVariationalEquations_( true ),
         saveInformationMatrix_( true ),
         printOutput_( true ),
-        saveResidualsAndParametersFromEachIteration_( true )
+        saveResidualsAndParametersFromEachIteration_( true ),
+        accumulateNormalEquations_( false ),
+        normalEquationsObservationBlockSize_( 10000 )
     {
         if( inverseOfAprioriCovariance_.rows( ) == 0 )
         {
@@ -210,6 +212,29 @@ public:
         saveStateHistoryForEachIteration_ = saveStateHistoryForEachIteration;
     }
 
+    //! Function to define settings for estimation from accumulated normal equations
+    /*!
+     *  Function to define settings for estimation from accumulated normal equations. In this mode, the normal equations
+     *  (H^T*W*H and H^T*W*y) are accumulated per block of observations, so that the full matrix of observation partials
+     *  (size: number of observations x number of parameters) is never stored. The resulting parameter update and
+     *  covariance are equal to those of the regular estimation (up to numerical rounding), but the partials matrix is not
+     *  available in the PodOutput (regardless of the saveInformationMatrix setting).
+     *  \param accumulateNormalEquations Boolean denoting whether the normal equations are to be accumulated per block of
+     *  observations, instead of computing the full matrix of observation partials
+     *  \param normalEquationsObservationBlockSize Maximum number of observations per block for which partials are computed at
+     *  once (sets of observations that cannot be split are processed as a single block)
+     */
+    void defineNormalEquationAccumulationSettings( const bool accumulateNormalEquations = 1,
+                                                   const int normalEquationsObservationBlockSize = 10000 )
+    {
+        if( normalEquationsObservationBlockSize < 1 )
+        {
+            throw std::runtime_error( "Error when defining normal equation accumulation settings, block size must be positive" );
+        }
+        accumulateNormalEquations_ = accumulateNormalEquations;
+        normalEquationsObservationBlockSize_ = normalEquationsObservationBlockSize;
+    }
+
     //! Function to return the total data structure of observations and associated times/link ends/type (by reference)
     /*!
      * Function to return the total data structure of observations and associated times/link ends/type (by reference)
@@ -313,6 +338,27 @@ public:
         return saveStateHistoryForEachIteration_;
     }
 
+    //! Function to return the boolean denoting whether the normal equations are accumulated per block of observations
+    /*!
+     * Function to return the boolean denoting whether the normal equations are accumulated per block of observations,
+     * instead of computing the full matrix of observation partials
+     * \return Boolean denoting whether the normal equations are accumulated per block of observations
+     */
+    bool getAccumulateNormalEquations( )
+    {
+        return accumulateNormalEquations_;
+    }
+
+    //! Function to return the maximum number of observations per block when accumulating the normal equations
+    /*!
+     * Function to return the maximum number of observations per block when accumulating the normal equations
+     * \return Maximum number of observations per block when accumulating the normal equations
+     */
+    int getNormalEquationsObservationBlockSize( )
+    {
+        return normalEquationsObservationBlockSize_;
+    }
+
 private:
     //! Total data structure of observations and associated times/link ends/type
     PodInputDataType observationsAndTimes_;
@@ -345,6 +391,12 @@ private:
     //! Boolean denoting whether the state history is to be saved on each iteration.
     bool saveStateHistoryForEachIteration_;
 
+    //! Boolean denoting whether the normal equations are accumulated per block of observations
+    bool accumulateNormalEquations_;
+
+    //! Maximum number of observations per block when accumulating the normal equations
+    int normalEquationsObservationBlockSize_;
+
 };
 
 //! Data structure through which the output of the orbit determination is communicated
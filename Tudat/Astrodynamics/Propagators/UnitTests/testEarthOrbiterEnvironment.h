@@ -0,0 +1,87 @@
+/*    Copyright (c) 2010-2017, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ */
+
+#ifndef TUDAT_TEST_EARTH_ORBITER_ENVIRONMENT_H
+#define TUDAT_TEST_EARTH_ORBITER_ENVIRONMENT_H
+
+#include <string>
+#include <vector>
+
+#include <boost/make_shared.hpp>
+
+#include "Tudat/Astrodynamics/BasicAstrodynamics/sphericalBodyShapeModel.h"
+#include "Tudat/Astrodynamics/Ephemerides/constantEphemeris.h"
+#include "Tudat/Astrodynamics/Ephemerides/simpleRotationalEphemeris.h"
+#include "Tudat/Astrodynamics/Ephemerides/tabulatedEphemeris.h"
+#include "Tudat/SimulationSetup/EnvironmentSetup/createBodies.h"
+#include "Tudat/SimulationSetup/EnvironmentSetup/createGroundStations.h"
+
+namespace tudat
+{
+namespace unit_tests
+{
+
+//! Function to create environment (without Spice dependency) with vehicles orbiting the Earth.
+/*!
+ *  Function to create environment (without Spice dependency) with vehicles orbiting the Earth, for unit tests of
+ *  propagation and estimation. The Earth is located at the SSB (constant ephemeris) and has a point-mass gravity field.
+ *  Each vehicle has an (empty) tabulated ephemeris w.r.t. the Earth, to be set by the propagation.
+ *  \param vehicleNames Names of the vehicles that are to be created.
+ *  \return Environment with the Earth and the vehicles.
+ */
+inline simulation_setup::NamedBodyMap createEarthOrbiterTestBodies(
+        const std::vector< std::string >& vehicleNames = std::vector< std::string >( 1, "Vehicle" ) )
+{
+    using namespace tudat::simulation_setup;
+
+    NamedBodyMap bodyMap;
+    bodyMap[ "Earth" ] = boost::make_shared< Body >( );
+    bodyMap[ "Earth" ]->setEphemeris( boost::make_shared< ephemerides::ConstantEphemeris >(
+                                          Eigen::Vector6d( Eigen::Vector6d::Zero( ) ), "SSB", "ECLIPJ2000" ) );
+    bodyMap[ "Earth" ]->setGravityFieldModel( boost::make_shared< gravitation::GravityFieldModel >( 3.986004418E14 ) );
+
+    for( unsigned int i = 0; i < vehicleNames.size( ); i++ )
+    {
+        bodyMap[ vehicleNames.at( i ) ] = boost::make_shared< Body >( );
+        bodyMap[ vehicleNames.at( i ) ]->setEphemeris(
+                    boost::make_shared< ephemerides::TabulatedCartesianEphemeris< > >(
+                        boost::shared_ptr< interpolators::OneDimensionalInterpolator< double, Eigen::Vector6d > >( ),
+                        "Earth", "ECLIPJ2000" ) );
+    }
+    setGlobalFrameBodyEphemerides( bodyMap, "SSB", "ECLIPJ2000" );
+
+    return bodyMap;
+}
+
+//! Function to add a rotation model, shape model and two ground stations to the Earth of a test environment.
+/*!
+ *  Function to add a rotation model, shape model and two ground stations (Station1 and Station2) to the Earth of a test
+ *  environment created by createEarthOrbiterTestBodies, for unit tests of observations and estimation.
+ *  \param bodyMap Environment to which the Earth properties are to be added (modified by this function).
+ */
+inline void addEarthGroundStationsToTestBodies( const simulation_setup::NamedBodyMap& bodyMap )
+{
+    bodyMap.at( "Earth" )->setRotationalEphemeris( boost::make_shared< ephemerides::SimpleRotationalEphemeris >(
+                                                       0.2, 0.4, 0.1, 7.2921151467E-5, 0.0, "ECLIPJ2000", "IAU_Earth" ) );
+    bodyMap.at( "Earth" )->setShapeModel( boost::make_shared< basic_astrodynamics::SphericalBodyShapeModel >( 6378.0E3 ) );
+
+    simulation_setup::createGroundStation(
+                bodyMap.at( "Earth" ), "Station1",
+                ( Eigen::Vector3d( ) << 0.0, 0.35, 0.0 ).finished( ), coordinate_conversions::geodetic_position );
+    simulation_setup::createGroundStation(
+                bodyMap.at( "Earth" ), "Station2",
+                ( Eigen::Vector3d( ) << 0.0, -0.55, 2.0 ).finished( ), coordinate_conversions::geodetic_position );
+}
+
+} // namespace unit_tests
+
+} // namespace tudat
+
+#endif // TUDAT_TEST_EARTH_ORBITER_ENVIRONMENT_H
@@ -0,0 +1,240 @@
+/*    Copyright (c) 2010-2017, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ */
+
+#define BOOST_TEST_MAIN
+
+#include <chrono>
+#include <iostream>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+#include <boost/bind.hpp>
+#include <boost/make_shared.hpp>
+#include <boost/test/unit_test.hpp>
+
+#include "Tudat/SimulationSetup/EnvironmentSetup/createBodies.h"
+#include "Tudat/SimulationSetup/PropagationSetup/batchPropagation.h"
+#include "Tudat/SimulationSetup/PropagationSetup/createAccelerationModels.h"
+#include "Tudat/Astrodynamics/Propagators/UnitTests/testEarthOrbiterEnvironment.h"
+
+namespace tudat
+{
+namespace unit_tests
+{
+
+using namespace tudat::numerical_integrators;
+using namespace tudat::simulation_setup;
+using namespace tudat::propagators;
+
+//! Nominal gravitational parameter of central body used in test
+static const double nominalGravitationalParameter = 3.986004418E14;
+
+//! Function to create propagator settings for test of batch propagation. The propagation is terminated after one day, or
+//! when the vehicle exceeds a given distance from the Earth.
+boost::shared_ptr< SingleArcPropagatorSettings< double > > createBatchPropagationTestPropagatorSettings(
+        const NamedBodyMap& bodyMap )
+{
+    SelectedAccelerationMap accelerationMap;
+    accelerationMap[ "Vehicle" ][ "Earth" ].push_back(
+                boost::make_shared< AccelerationSettings >( basic_astrodynamics::central_gravity ) );
+    std::vector< std::string > bodiesToIntegrate( 1, "Vehicle" );
+    std::vector< std::string > centralBodies( 1, "Earth" );
+
+    Eigen::Vector6d initialState = Eigen::Vector6d::Zero( );
+    initialState( 0 ) = 7.2E6;
+    initialState( 4 ) = 6.5E3;
+    initialState( 5 ) = 3.5E3;
+
+    boost::shared_ptr< SingleDependentVariableSaveSettings > distanceSettings =
+            boost::make_shared< SingleDependentVariableSaveSettings >(
+                relative_distance_dependent_variable, "Vehicle", "Earth" );
+
+    std::vector< boost::shared_ptr< PropagationTerminationSettings > > terminationSettingsList;
+    terminationSettingsList.push_back( boost::make_shared< PropagationTimeTerminationSettings >( 86400.0 ) );
+    terminationSettingsList.push_back( boost::make_shared< PropagationDependentVariableTerminationSettings >(
+                                           distanceSettings, 1.2E7, false ) );
+
+    return boost::make_shared< TranslationalStatePropagatorSettings< double > >(
+                centralBodies, createAccelerationModelsMap( bodyMap, accelerationMap, bodiesToIntegrate, centralBodies ),
+                bodiesToIntegrate, initialState,
+                boost::make_shared< PropagationHybridTerminationSettings >( terminationSettingsList, true ), cowell,
+                boost::make_shared< DependentVariableSaveSettings >(
+                    std::vector< boost::shared_ptr< SingleDependentVariableSaveSettings > >( 1, distanceSettings ), 0 ) );
+}
+
+//! Function to create integrator settings for test of batch propagation.
+boost::shared_ptr< IntegratorSettings< double > > createBatchPropagationTestIntegratorSettings( )
+{
+    return boost::make_shared< IntegratorSettings< > >( rungeKutta4, 0.0, 30.0 );
+}
+
+//! Function to compute perturbed gravitational parameter for given run
+double getPerturbedGravitationalParameter( const unsigned int runIndex )
+{
+    return nominalGravitationalParameter * ( 1.0 + 1.0E-6 * static_cast< double >( runIndex % 5 ) );
+}
+
+//! Function to perturb environment for given run of batch propagation
+void perturbBatchPropagationTestEnvironment( const NamedBodyMap& bodyMap, const unsigned int runIndex )
+{
+    bodyMap.at( "Earth" )->getGravityFieldModel( )->resetGravitationalParameter(
+                getPerturbedGravitationalParameter( runIndex ) );
+}
+
+//! Function to create initial state perturbations for test of batch propagation, with velocity perturbations causing part
+//! of the propagations to terminate on the distance condition.
+std::vector< Eigen::VectorXd > getBatchPropagationTestInitialStatePerturbations( const unsigned int numberOfRuns )
+{
+    std::vector< Eigen::VectorXd > initialStatePerturbations;
+    for( unsigned int i = 0; i < numberOfRuns; i++ )
+    {
+        Eigen::VectorXd currentPerturbation = Eigen::VectorXd::Zero( 6 );
+        currentPerturbation( 0 ) = 10.0 * static_cast< double >( i % 3 );
+        currentPerturbation( 4 ) = 40.0 * static_cast< double >( i );
+        initialStatePerturbations.push_back( currentPerturbation );
+    }
+    return initialStatePerturbations;
+}
+
+BOOST_AUTO_TEST_SUITE( test_batch_propagation )
+
+//! Test whether the results of a batch propagation are identical to those of the individual propagations, regardless of the
+//! number of threads.
+BOOST_AUTO_TEST_CASE( testBatchPropagation )
+{
+    // Define initial state perturbations
+    const unsigned int numberOfRuns = 32;
+    std::vector< Eigen::VectorXd > initialStatePerturbations =
+            getBatchPropagationTestInitialStatePerturbations( numberOfRuns );
+
+    // Perform individual propagations
+    std::vector< BatchPropagationRunResults< > > referenceResults( numberOfRuns );
+    for( unsigned int i = 0; i < numberOfRuns; i++ )
+    {
+        NamedBodyMap bodyMap = createEarthOrbiterTestBodies( );
+        bodyMap.at( "Earth" )->getGravityFieldModel( )->resetGravitationalParameter(
+                    getPerturbedGravitationalParameter( i ) );
+        boost::shared_ptr< SingleArcPropagatorSettings< double > > propagatorSettings =
+                createBatchPropagationTestPropagatorSettings( bodyMap );
+        propagatorSettings->resetInitialStates( propagatorSettings->getInitialStates( ) +
+                                                initialStatePerturbations.at( i ) );
+
+        SingleArcDynamicsSimulator< > dynamicsSimulator(
+                    bodyMap, createBatchPropagationTestIntegratorSettings( ), propagatorSettings );
+        const SolutionHistory< double, double >& stateHistory =
+                dynamicsSimulator.getEquationsOfMotionNumericalSolutionHistory( );
+        referenceResults[ i ].terminationReason_ = dynamicsSimulator.getPropagationTerminationReason( );
+        referenceResults[ i ].finalTime_ = stateHistory.getTime( stateHistory.getNumberOfEntries( ) - 1 );
+        referenceResults[ i ].finalState_ = stateHistory.getEntry( stateHistory.getNumberOfEntries( ) - 1 );
+        referenceResults[ i ].dependentVariableHistory_ = dynamicsSimulator.getDependentVariableSolutionHistory( );
+    }
+
+    // Check that the test covers both termination conditions
+    BOOST_CHECK( referenceResults.front( ).finalTime_ == 86400.0 );
+    BOOST_CHECK( referenceResults.back( ).finalTime_ < 86400.0 );
+
+    std::vector< unsigned int > numberOfThreadsList;
+    numberOfThreadsList.push_back( 1 );
+    numberOfThreadsList.push_back( 4 );
+    numberOfThreadsList.push_back( std::max( std::thread::hardware_concurrency( ), 1U ) );
+
+    for( unsigned int testCase = 0; testCase < numberOfThreadsList.size( ); testCase++ )
+    {
+        // Perform batch propagation
+        std::vector< BatchPropagationRunResults< > > batchResults = propagateBatch< double, double >(
+                    boost::bind( &createEarthOrbiterTestBodies, std::vector< std::string >( 1, "Vehicle" ) ),
+                    &createBatchPropagationTestPropagatorSettings,
+                    &createBatchPropagationTestIntegratorSettings, initialStatePerturbations,
+                    &perturbBatchPropagationTestEnvironment, numberOfThreadsList.at( testCase ), ( testCase == 1 ) );
+
+        // Check that results are identical to those of individual propagations
+        BOOST_CHECK_EQUAL( batchResults.size( ), numberOfRuns );
+        for( unsigned int i = 0; i < numberOfRuns; i++ )
+        {
+            BOOST_CHECK_EQUAL( batchResults.at( i ).terminationReason_, termination_condition_reached );
+            BOOST_CHECK_EQUAL( batchResults.at( i ).terminationReason_, referenceResults.at( i ).terminationReason_ );
+            BOOST_CHECK_EQUAL( batchResults.at( i ).finalTime_, referenceResults.at( i ).finalTime_ );
+            BOOST_CHECK( batchResults.at( i ).finalState_ == referenceResults.at( i ).finalState_ );
+
+            BOOST_CHECK_EQUAL( batchResults.at( i ).dependentVariableHistory_.getNumberOfEntries( ),
+                               referenceResults.at( i ).dependentVariableHistory_.getNumberOfEntries( ) );
+            BOOST_CHECK( batchResults.at( i ).dependentVariableHistory_.getEntries( ) ==
+                         referenceResults.at( i ).dependentVariableHistory_.getEntries( ) );
+
+            if( testCase == 1 )
+            {
+                BOOST_CHECK_EQUAL( batchResults.at( i ).stateHistory_.getNumberOfEntries( ),
+                                   batchResults.at( i ).dependentVariableHistory_.getNumberOfEntries( ) );
+            }
+            else
+            {
+                BOOST_CHECK( batchResults.at( i ).stateHistory_.empty( ) );
+            }
+        }
+    }
+
+    // Check that inconsistent initial state perturbations are rejected
+    initialStatePerturbations.push_back( Eigen::VectorXd::Zero( 3 ) );
+    bool isExceptionCaught = false;
+    try
+    {
+        propagateBatch< double, double >(
+                    boost::bind( &createEarthOrbiterTestBodies, std::vector< std::string >( 1, "Vehicle" ) ),
+                    &createBatchPropagationTestPropagatorSettings,
+                    &createBatchPropagationTestIntegratorSettings, initialStatePerturbations );
+    }
+    catch( const std::runtime_error& )
+    {
+        isExceptionCaught = true;
+    }
+    BOOST_CHECK( isExceptionCaught );
+}
+
+#if COMPILE_UNIT_TEST_BENCHMARKS
+//! Measure the throughput of a batch propagation as a function of the number of threads, up to the number of concurrent
+//! threads supported by the hardware.
+BOOST_AUTO_TEST_CASE( benchmarkBatchPropagationScaling )
+{
+    const unsigned int numberOfRuns = 32;
+    std::vector< Eigen::VectorXd > initialStatePerturbations =
+            getBatchPropagationTestInitialStatePerturbations( numberOfRuns );
+
+    // Use powers of two up to, and including, the number of concurrent threads supported by the hardware
+    const unsigned int maximumNumberOfThreads = std::max( std::thread::hardware_concurrency( ), 1U );
+    std::vector< unsigned int > numberOfThreadsList;
+    for( unsigned int numberOfThreads = 1; numberOfThreads < maximumNumberOfThreads; numberOfThreads *= 2 )
+    {
+        numberOfThreadsList.push_back( numberOfThreads );
+    }
+    numberOfThreadsList.push_back( maximumNumberOfThreads );
+
+    for( unsigned int i = 0; i < numberOfThreadsList.size( ); i++ )
+    {
+        const unsigned int numberOfThreads = numberOfThreadsList.at( i );
+        std::chrono::steady_clock::time_point startTime = std::chrono::steady_clock::now( );
+        propagateBatch< double, double >(
+                    boost::bind( &createEarthOrbiterTestBodies, std::vector< std::string >( 1, "Vehicle" ) ),
+                    &createBatchPropagationTestPropagatorSettings,
+                    &createBatchPropagationTestIntegratorSettings, initialStatePerturbations,
+                    &perturbBatchPropagationTestEnvironment, numberOfThreads );
+        double computationTime = std::chrono::duration< double >( std::chrono::steady_clock::now( ) - startTime ).count( );
+
+        std::cout << "Batch propagation of " << numberOfRuns << " runs with " << numberOfThreads
+                  << " thread(s): " << computationTime << " s, "
+                  << static_cast< double >( numberOfRuns ) / computationTime << " runs/s" << std::endl;
+    }
+}
+#endif
+
+BOOST_AUTO_TEST_SUITE_END( )
+
+} // namespace unit_tests
+} // namespace tudat
@@ -0,0 +1,197 @@
+/*    Copyright (c) 2010-2017, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ */
+
+#define BOOST_TEST_MAIN
+
+#include <boost/make_shared.hpp>
+#include <boost/test/unit_test.hpp>
+
+#include "Tudat/Mathematics/Interpolators/lagrangeInterpolator.h"
+#include "Tudat/Mathematics/Interpolators/linearInterpolator.h"
+#include "Tudat/Astrodynamics/Propagators/stateTransitionMatrixInterface.h"
+
+namespace tudat
+{
+namespace unit_tests
+{
+
+using namespace tudat::interpolators;
+using namespace tudat::propagators;
+
+//! Function to compute a smooth, time-dependent matrix, used as synthetic state transition or sensitivity matrix.
+Eigen::MatrixXd getTestMatrix( const double time, const int numberOfRows, const int numberOfColumns )
+{
+    Eigen::MatrixXd matrix = Eigen::MatrixXd( numberOfRows, numberOfColumns );
+    for( int i = 0; i < numberOfRows; i++ )
+    {
+        for( int j = 0; j < numberOfColumns; j++ )
+        {
+            matrix( i, j ) = std::sin( 1.0E-4 * static_cast< double >( i + 1 ) * time + static_cast< double >( j ) ) +
+                    static_cast< double >( i - j ) * 1.0E-5 * time;
+        }
+    }
+    return matrix;
+}
+
+//! Function to create a single-arc state transition and sensitivity matrix interface, with synthetic matrix histories.
+boost::shared_ptr< SingleArcCombinedStateTransitionAndSensitivityMatrixInterface > getTestInterface(
+        const int stateSize, const int numberOfParameters, const int numberOfDataPoints, const double timeStep,
+        const int numberOfStages, const bool useLinearSensitivityInterpolator = false,
+        const bool offsetSensitivityTimes = false )
+{
+    std::vector< double > times, sensitivityTimes;
+    std::vector< Eigen::MatrixXd > stateTransitionMatrices, sensitivityMatrices;
+    for( int i = 0; i < numberOfDataPoints; i++ )
+    {
+        times.push_back( static_cast< double >( i ) * timeStep );
+        sensitivityTimes.push_back(
+                    times.back( ) + ( ( offsetSensitivityTimes && i > 0 && i < numberOfDataPoints - 1 ) ?
+                                          0.1 * timeStep : 0.0 ) );
+        stateTransitionMatrices.push_back( getTestMatrix( times.back( ), stateSize, stateSize ) );
+        sensitivityMatrices.push_back( getTestMatrix( sensitivityTimes.back( ), stateSize,
+                                                      numberOfParameters - stateSize ) );
+    }
+
+    boost::shared_ptr< OneDimensionalInterpolator< double, Eigen::MatrixXd > > stateTransitionMatrixInterpolator =
+            boost::make_shared< LagrangeInterpolator< double, Eigen::MatrixXd > >(
+                times, stateTransitionMatrices, numberOfStages );
+    boost::shared_ptr< OneDimensionalInterpolator< double, Eigen::MatrixXd > > sensitivityMatrixInterpolator;
+    if( useLinearSensitivityInterpolator )
+    {
+        sensitivityMatrixInterpolator = boost::make_shared< LinearInterpolator< double, Eigen::MatrixXd > >(
+                    sensitivityTimes, sensitivityMatrices );
+    }
+    else
+    {
+        sensitivityMatrixInterpolator = boost::make_shared< LagrangeInterpolator< double, Eigen::MatrixXd > >(
+                    sensitivityTimes, sensitivityMatrices, numberOfStages );
+    }
+
+    return boost::make_shared< SingleArcCombinedStateTransitionAndSensitivityMatrixInterface >(
+                stateTransitionMatrixInterpolator, sensitivityMatrixInterpolator, stateSize, numberOfParameters );
+}
+
+BOOST_AUTO_TEST_SUITE( test_batched_state_transition_matrix_interpolation )
+
+//! Test whether batched evaluation of state transition and sensitivity matrices reproduces single evaluations.
+BOOST_AUTO_TEST_CASE( testBatchedStateTransitionMatrixInterpolation )
+{
+    const int stateSize = 6;
+    const int numberOfDataPoints = 200;
+    const double timeStep = 60.0;
+
+    // Set evaluation times, including times in boundary regions and at data points.
+    std::vector< double > evaluationTimes;
+    for( int i = 0; i < 2000; i++ )
+    {
+        evaluationTimes.push_back( static_cast< double >( i ) * timeStep * ( numberOfDataPoints - 1 ) / 2000.0 );
+        if( i % 100 == 0 )
+        {
+            evaluationTimes.push_back( std::floor( evaluationTimes.back( ) / timeStep ) * timeStep + timeStep );
+        }
+    }
+    evaluationTimes.push_back( timeStep * ( numberOfDataPoints - 1 ) );
+    std::sort( evaluationTimes.begin( ), evaluationTimes.end( ) );
+
+    // Test Lagrange interpolators on the same times, Lagrange interpolators on different times, a non-Lagrange
+    // sensitivity interpolator, and a state transition matrix without sensitivity matrix.
+    for( unsigned int testCase = 0; testCase < 5; testCase++ )
+    {
+        int numberOfParameters = ( testCase == 3 ) ? stateSize : stateSize + 4;
+        int numberOfStages = ( testCase == 4 ) ? 6 : 8;
+        boost::shared_ptr< SingleArcCombinedStateTransitionAndSensitivityMatrixInterface > matrixInterface =
+                getTestInterface( stateSize, numberOfParameters, numberOfDataPoints, timeStep, numberOfStages,
+                                  testCase == 2, testCase == 1 );
+
+        // Evaluate twice, to check reuse of preallocated matrices.
+        std::vector< Eigen::MatrixXd > batchedMatrices;
+        for( unsigned int j = 0; j < 2; j++ )
+        {
+            matrixInterface->getCombinedStateTransitionAndSensitivityMatrices( evaluationTimes, batchedMatrices );
+            BOOST_CHECK_EQUAL( batchedMatrices.size( ), evaluationTimes.size( ) );
+
+            for( unsigned int i = 0; i < evaluationTimes.size( ); i++ )
+            {
+                Eigen::MatrixXd singleMatrix =
+                        matrixInterface->getCombinedStateTransitionAndSensitivityMatrix( evaluationTimes.at( i ) );
+                BOOST_CHECK_EQUAL( batchedMatrices.at( i ).rows( ), stateSize );
+                BOOST_CHECK_EQUAL( batchedMatrices.at( i ).cols( ), numberOfParameters );
+                BOOST_CHECK_SMALL( ( batchedMatrices.at( i ) - singleMatrix ).cwiseAbs( ).maxCoeff( ), 1.0E-12 );
+            }
+        }
+    }
+
+    // Check that matrix histories are reset when resetting the interpolators.
+    boost::shared_ptr< SingleArcCombinedStateTransitionAndSensitivityMatrixInterface > matrixInterface =
+            getTestInterface( stateSize, stateSize + 4, numberOfDataPoints, timeStep, 8 );
+    boost::shared_ptr< SingleArcCombinedStateTransitionAndSensitivityMatrixInterface > otherMatrixInterface =
+            getTestInterface( stateSize, stateSize + 4, numberOfDataPoints / 2 + 1, 2.0 * timeStep, 6 );
+
+    std::vector< Eigen::MatrixXd > batchedMatrices;
+    matrixInterface->getCombinedStateTransitionAndSensitivityMatrices( evaluationTimes, batchedMatrices );
+    matrixInterface->updateMatrixInterpolators( otherMatrixInterface->getStateTransitionMatrixInterpolator( ),
+                                                otherMatrixInterface->getSensitivityMatrixInterpolator( ) );
+    matrixInterface->getCombinedStateTransitionAndSensitivityMatrices( evaluationTimes, batchedMatrices );
+    for( unsigned int i = 0; i < evaluationTimes.size( ); i += 10 )
+    {
+        Eigen::MatrixXd singleMatrix =
+                otherMatrixInterface->getCombinedStateTransitionAndSensitivityMatrix( evaluationTimes.at( i ) );
+        BOOST_CHECK_SMALL( ( batchedMatrices.at( i ) - singleMatrix ).cwiseAbs( ).maxCoeff( ), 1.0E-12 );
+    }
+}
+
+//! Test whether batched evaluation of state transition and sensitivity matrices reproduces single evaluations for a large
+//! number of epochs, when reusing the output matrices of a previous batched evaluation.
+BOOST_AUTO_TEST_CASE( testBatchedStateTransitionMatrixInterpolationReusedOutput )
+{
+    const int stateSize = 6;
+    const int numberOfParameters = 16;
+    const int numberOfDataPoints = 5000;
+    const double timeStep = 60.0;
+    const int numberOfEvaluations = 100000;
+
+    boost::shared_ptr< SingleArcCombinedStateTransitionAndSensitivityMatrixInterface > matrixInterface =
+            getTestInterface( stateSize, numberOfParameters, numberOfDataPoints, timeStep, 8 );
+
+    std::vector< double > evaluationTimes;
+    for( int i = 0; i < numberOfEvaluations; i++ )
+    {
+        evaluationTimes.push_back( static_cast< double >( i ) * timeStep * ( numberOfDataPoints - 1 ) /
+                                   static_cast< double >( numberOfEvaluations ) );
+    }
+
+    // Evaluate matrices one at a time.
+    std::vector< Eigen::MatrixXd > singleMatrices( numberOfEvaluations );
+    for( int i = 0; i < numberOfEvaluations; i++ )
+    {
+        singleMatrices[ i ] = matrixInterface->getCombinedStateTransitionAndSensitivityMatrix( evaluationTimes[ i ] );
+    }
+
+    // Evaluate matrices in batch (first call includes creation of matrix history and output matrices, second call
+    // reuses the output matrices).
+    std::vector< Eigen::MatrixXd > batchedMatrices;
+    matrixInterface->getCombinedStateTransitionAndSensitivityMatrices( evaluationTimes, batchedMatrices );
+    matrixInterface->getCombinedStateTransitionAndSensitivityMatrices( evaluationTimes, batchedMatrices );
+    BOOST_CHECK_EQUAL( batchedMatrices.size( ), evaluationTimes.size( ) );
+
+    double maximumDifference = 0.0;
+    for( int i = 0; i < numberOfEvaluations; i++ )
+    {
+        maximumDifference = std::max(
+                    maximumDifference, ( batchedMatrices[ i ] - singleMatrices[ i ] ).cwiseAbs( ).maxCoeff( ) );
+    }
+    BOOST_CHECK_SMALL( maximumDifference, 1.0E-12 );
+}
+
+BOOST_AUTO_TEST_SUITE_END( )
+
+} // namespace unit_tests
+
+} // namespace tudat
@@ -0,0 +1,178 @@
+/*    Copyright (c) 2010-2017, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ */
+
+#define BOOST_TEST_MAIN
+
+#include <boost/make_shared.hpp>
+#include <boost/test/unit_test.hpp>
+
+#include "Tudat/Basics/testMacros.h"
+#include "Tudat/Mathematics/NumericalIntegrators/createNumericalIntegrator.h"
+#include "Tudat/SimulationSetup/EnvironmentSetup/createBodies.h"
+#include "Tudat/SimulationSetup/EstimationSetup/createEstimatableParameters.h"
+#include "Tudat/SimulationSetup/PropagationSetup/createAccelerationModels.h"
+#include "Tudat/SimulationSetup/PropagationSetup/variationalEquationsSolver.h"
+#include "Tudat/Astrodynamics/Propagators/UnitTests/testEarthOrbiterEnvironment.h"
+
+namespace tudat
+{
+namespace unit_tests
+{
+
+using namespace tudat::numerical_integrators;
+using namespace tudat::simulation_setup;
+using namespace tudat::propagators;
+using namespace tudat::estimatable_parameters;
+
+//! Function to propagate variational equations of vehicles orbiting the Earth, with dense or block-sparse state partials
+/*!
+ *  Function to propagate variational equations of vehicles orbiting the Earth, with dense or block-sparse
+ *  multiplication of the state partials. All vehicles are accelerated by the Earth's point mass. If requested, the
+ *  second vehicle is propagated w.r.t. the first vehicle (hierarchical dynamics), and is also accelerated by it.
+ *  \return Pair of final state transition matrix and sensitivity matrix.
+ */
+std::pair< Eigen::MatrixXd, Eigen::MatrixXd > propagateBlockSparseVariationalEquationsTestCase(
+        const unsigned int numberOfVehicles, const bool useCoupledVehicles, const bool useBlockSparseStatePartials,
+        int& numberOfNonZeroBlocks )
+{
+    std::vector< std::string > vehicleNames;
+    for( unsigned int i = 0; i < numberOfVehicles; i++ )
+    {
+        vehicleNames.push_back( "Vehicle" + std::to_string( i ) );
+    }
+    NamedBodyMap bodyMap = createEarthOrbiterTestBodies( vehicleNames );
+    for( unsigned int i = 0; i < numberOfVehicles; i++ )
+    {
+        bodyMap.at( vehicleNames.at( i ) )->setGravityFieldModel(
+                    boost::make_shared< gravitation::GravityFieldModel >( 1.0E4 ) );
+    }
+
+    // Set accelerations and initial states.
+    SelectedAccelerationMap accelerationMap;
+    std::vector< std::string > bodiesToIntegrate;
+    std::vector< std::string > centralBodies;
+    Eigen::VectorXd initialStates = Eigen::VectorXd::Zero( 6 * numberOfVehicles );
+    for( unsigned int i = 0; i < numberOfVehicles; i++ )
+    {
+        std::string vehicleName = "Vehicle" + std::to_string( i );
+        bodiesToIntegrate.push_back( vehicleName );
+        accelerationMap[ vehicleName ][ "Earth" ].push_back(
+                    boost::make_shared< AccelerationSettings >( basic_astrodynamics::central_gravity ) );
+
+        if( useCoupledVehicles && i == 1 )
+        {
+            accelerationMap[ vehicleName ][ "Vehicle0" ].push_back(
+                        boost::make_shared< AccelerationSettings >( basic_astrodynamics::central_gravity ) );
+            centralBodies.push_back( "Vehicle0" );
+            initialStates.segment( 6 * i, 6 ) << 1.0E3, 0.0, 0.0, 0.0, 0.1, 0.0;
+        }
+        else
+        {
+            const double inclination = 0.1 * static_cast< double >( i );
+            centralBodies.push_back( "Earth" );
+            initialStates.segment( 6 * i, 6 ) << 7.0E6 + 1.0E4 * i, 0.0, 0.0,
+                    0.0, 7.5E3 * std::cos( inclination ), 7.5E3 * std::sin( inclination );
+        }
+    }
+
+    boost::shared_ptr< TranslationalStatePropagatorSettings< double > > propagatorSettings =
+            boost::make_shared< TranslationalStatePropagatorSettings< double > >(
+                centralBodies,
+                createAccelerationModelsMap( bodyMap, accelerationMap, bodiesToIntegrate, centralBodies ),
+                bodiesToIntegrate, initialStates, 600.0 );
+    boost::shared_ptr< IntegratorSettings< > > integratorSettings =
+            boost::make_shared< IntegratorSettings< > >( rungeKutta4, 0.0, 10.0 );
+
+    // Estimate initial states of all vehicles and gravitational parameter of Earth.
+    std::vector< boost::shared_ptr< EstimatableParameterSettings > > parameterNames;
+    for( unsigned int i = 0; i < numberOfVehicles; i++ )
+    {
+        parameterNames.push_back( boost::make_shared< InitialTranslationalStateEstimatableParameterSettings< double > >(
+                                      bodiesToIntegrate.at( i ), initialStates.segment( 6 * i, 6 ),
+                                      centralBodies.at( i ) ) );
+    }
+    parameterNames.push_back( boost::make_shared< EstimatableParameterSettings >( "Earth", gravitational_parameter ) );
+    boost::shared_ptr< EstimatableParameterSet< double > > parametersToEstimate =
+            createParametersToEstimate( parameterNames, bodyMap );
+
+    // Propagate variational equations with requested multiplication of state partials.
+    SingleArcVariationalEquationsSolver< > variationalEquationsSolver(
+                bodyMap, integratorSettings, propagatorSettings, parametersToEstimate, true,
+                boost::shared_ptr< IntegratorSettings< double > >( ), false, false );
+    boost::shared_ptr< VariationalEquations > variationalEquations =
+            variationalEquationsSolver.getDynamicsSimulator( )->getDynamicsStateDerivative( )->
+            getVariationalEquations( );
+    numberOfNonZeroBlocks = variationalEquations->getNumberOfNonZeroStatePartialBlocks( );
+    variationalEquations->setUseBlockSparseStatePartials( useBlockSparseStatePartials );
+
+    variationalEquationsSolver.integrateVariationalAndDynamicalEquations( propagatorSettings->getInitialStates( ), true );
+
+    std::vector< std::map< double, Eigen::MatrixXd > > variationalEquationsSolution =
+            variationalEquationsSolver.getNumericalVariationalEquationsSolution( );
+    return std::make_pair( variationalEquationsSolution.at( 0 ).rbegin( )->second,
+                           variationalEquationsSolution.at( 1 ).rbegin( )->second );
+}
+
+BOOST_AUTO_TEST_SUITE( test_block_sparse_variational_equations )
+
+//! Test whether block-sparse multiplication of state partials reproduces dense multiplication, including cross-terms
+//! between bodies and hierarchical dynamics.
+BOOST_AUTO_TEST_CASE( testBlockSparseVariationalEquations )
+{
+    for( unsigned int useCoupledVehicles = 0; useCoupledVehicles < 2; useCoupledVehicles++ )
+    {
+        int numberOfNonZeroBlocks;
+        std::pair< Eigen::MatrixXd, Eigen::MatrixXd > denseResult = propagateBlockSparseVariationalEquationsTestCase(
+                    4, useCoupledVehicles, false, numberOfNonZeroBlocks );
+        std::pair< Eigen::MatrixXd, Eigen::MatrixXd > sparseResult = propagateBlockSparseVariationalEquationsTestCase(
+                    4, useCoupledVehicles, true, numberOfNonZeroBlocks );
+
+        // Check sparsity: one block per vehicle, plus partials of second vehicle w.r.t. first vehicle.
+        BOOST_CHECK_EQUAL( numberOfNonZeroBlocks, useCoupledVehicles ? 5 : 4 );
+
+        // Check that coupling between vehicles is present in state transition matrix.
+        BOOST_CHECK_EQUAL( denseResult.first.block( 6, 0, 6, 6 ).norm( ) > 0.0, useCoupledVehicles );
+        BOOST_CHECK_EQUAL( denseResult.first.block( 12, 0, 6, 6 ).norm( ), 0.0 );
+
+        for( int i = 0; i < denseResult.first.rows( ); i++ )
+        {
+            for( int j = 0; j < denseResult.first.cols( ); j++ )
+            {
+                BOOST_CHECK_SMALL( sparseResult.first( i, j ) - denseResult.first( i, j ),
+                                   1.0E-13 * denseResult.first.row( i ).norm( ) );
+            }
+            BOOST_CHECK_SMALL( sparseResult.second( i, 0 ) - denseResult.second( i, 0 ),
+                               1.0E-13 * std::fabs( denseResult.second( i, 0 ) ) );
+        }
+    }
+}
+
+//! Test whether propagation of variational equations with block-sparse state partials reproduces propagation with dense
+//! state partials, for increasing number of bodies.
+BOOST_AUTO_TEST_CASE( testBlockSparseVariationalEquationsNumberOfBodies )
+{
+    std::vector< unsigned int > numbersOfVehicles = { 1, 5, 10, 20 };
+    for( unsigned int i = 0; i < numbersOfVehicles.size( ); i++ )
+    {
+        int numberOfNonZeroBlocks;
+        std::pair< Eigen::MatrixXd, Eigen::MatrixXd > denseResult = propagateBlockSparseVariationalEquationsTestCase(
+                    numbersOfVehicles.at( i ), false, false, numberOfNonZeroBlocks );
+        std::pair< Eigen::MatrixXd, Eigen::MatrixXd > sparseResult = propagateBlockSparseVariationalEquationsTestCase(
+                    numbersOfVehicles.at( i ), false, true, numberOfNonZeroBlocks );
+
+        BOOST_CHECK_EQUAL( numberOfNonZeroBlocks, static_cast< int >( numbersOfVehicles.at( i ) ) );
+        BOOST_CHECK( ( sparseResult.first - denseResult.first ).norm( ) <= 1.0E-13 * denseResult.first.norm( ) );
+    }
+}
+
+BOOST_AUTO_TEST_SUITE_END( )
+
+} // namespace unit_tests
+} // namespace tudat
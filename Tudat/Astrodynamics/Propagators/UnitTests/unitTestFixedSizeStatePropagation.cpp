@@ -0,0 +1,234 @@
+/*    Copyright (c) 2010-2017, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ */
+
+#define BOOST_TEST_MAIN
+
+#include <chrono>
+#include <iostream>
+
+#include <boost/make_shared.hpp>
+#include <boost/test/unit_test.hpp>
+
+#include "Tudat/Mathematics/NumericalIntegrators/createNumericalIntegrator.h"
+#include "Tudat/SimulationSetup/EnvironmentSetup/createBodies.h"
+#include "Tudat/SimulationSetup/PropagationSetup/createAccelerationModels.h"
+#include "Tudat/SimulationSetup/PropagationSetup/dynamicsSimulator.h"
+#include "Tudat/Astrodynamics/Propagators/UnitTests/testEarthOrbiterEnvironment.h"
+
+namespace tudat
+{
+namespace unit_tests
+{
+
+using namespace tudat::numerical_integrators;
+using namespace tudat::simulation_setup;
+using namespace tudat::propagators;
+
+//! Function to create propagator settings for propagation of a single vehicle around the Earth, for 10 days.
+boost::shared_ptr< TranslationalStatePropagatorSettings< double > > createFixedSizeTestPropagatorSettings(
+        const NamedBodyMap& bodyMap )
+{
+    SelectedAccelerationMap accelerationMap;
+    accelerationMap[ "Vehicle" ][ "Earth" ].push_back(
+                boost::make_shared< AccelerationSettings >( basic_astrodynamics::central_gravity ) );
+    std::vector< std::string > bodiesToIntegrate( 1, "Vehicle" );
+    std::vector< std::string > centralBodies( 1, "Earth" );
+
+    Eigen::Vector6d initialState = Eigen::Vector6d::Zero( );
+    initialState( 0 ) = 7.2E6;
+    initialState( 4 ) = 6.5E3;
+    initialState( 5 ) = 3.5E3;
+
+    std::vector< boost::shared_ptr< SingleDependentVariableSaveSettings > > dependentVariables;
+    dependentVariables.push_back( boost::make_shared< SingleDependentVariableSaveSettings >(
+                                      relative_distance_dependent_variable, "Vehicle", "Earth" ) );
+
+    const double finalTime = 10.0 * 86400.0;
+    return boost::make_shared< TranslationalStatePropagatorSettings< double > >(
+                centralBodies, createAccelerationModelsMap( bodyMap, accelerationMap, bodiesToIntegrate, centralBodies ),
+                bodiesToIntegrate, initialState, finalTime, cowell,
+                boost::make_shared< DependentVariableSaveSettings >( dependentVariables, 0 ) );
+}
+
+//! Function to create integrator settings for test case (0: RKF7(8) with variable step size, 1: RK4).
+boost::shared_ptr< IntegratorSettings< > > createFixedSizeTestIntegratorSettings( const unsigned int testCase )
+{
+    if( testCase == 0 )
+    {
+        return boost::make_shared< RungeKuttaVariableStepSizeSettings< > >(
+                    rungeKuttaVariableStepSize, 0.0, 10.0, RungeKuttaCoefficients::rungeKuttaFehlberg78,
+                    1.0E-3, 1.0E4, 1.0E-12, 1.0E-12 );
+    }
+    else
+    {
+        return boost::make_shared< IntegratorSettings< > >( rungeKutta4, 0.0, 10.0 );
+    }
+}
+
+//! Function to propagate state directly through integration interface, with dynamic-size state vectors.
+void integrateWithDynamicSizeState(
+        const boost::shared_ptr< DynamicsStateDerivativeModel< > > stateDerivativeModel,
+        const boost::shared_ptr< PropagationTerminationCondition > terminationCondition,
+        const Eigen::Vector6d& initialState, const boost::shared_ptr< IntegratorSettings< > > integratorSettings,
+        SolutionHistory< double, double >& stateHistory )
+{
+    SolutionHistory< double, double > dependentVariableHistory, computationTimeHistory;
+    EquationIntegrationInterface< Eigen::VectorXd, double >::integrateEquations(
+                boost::bind( &DynamicsStateDerivativeModel< >::computeStateDerivative,
+                             stateDerivativeModel, _1, _2 ), stateHistory,
+                Eigen::VectorXd( initialState ), integratorSettings,
+                boost::bind( &PropagationTerminationCondition::checkStopCondition,
+                             terminationCondition, _1, _2 ),
+                dependentVariableHistory, computationTimeHistory );
+}
+
+//! Function to propagate state directly through integration interface, with fixed-size state vectors.
+void integrateWithFixedSizeState(
+        const boost::shared_ptr< DynamicsStateDerivativeModel< > > stateDerivativeModel,
+        const boost::shared_ptr< PropagationTerminationCondition > terminationCondition,
+        const Eigen::Vector6d& initialState, const boost::shared_ptr< IntegratorSettings< > > integratorSettings,
+        SolutionHistory< double, double >& stateHistory )
+{
+    SolutionHistory< double, double > dependentVariableHistory, computationTimeHistory;
+    EquationIntegrationInterface< Eigen::Vector6d, double >::integrateEquations(
+                boost::bind( &DynamicsStateDerivativeModel< >::computeFixedSizeStateDerivative< 6 >,
+                             stateDerivativeModel, _1, _2 ), stateHistory,
+                initialState, integratorSettings,
+                boost::bind( &PropagationTerminationCondition::checkStopCondition,
+                             terminationCondition, _1, _2 ),
+                dependentVariableHistory, computationTimeHistory );
+}
+
+BOOST_AUTO_TEST_SUITE( test_fixed_size_state_propagation )
+
+//! Test whether propagation of a single body with fixed-size state vectors gives results consistent with propagation
+//! using dynamic-size state vectors.
+BOOST_AUTO_TEST_CASE( testFixedSizeStatePropagation )
+{
+    NamedBodyMap bodyMap = createEarthOrbiterTestBodies( );
+    boost::shared_ptr< TranslationalStatePropagatorSettings< double > > propagatorSettings =
+            createFixedSizeTestPropagatorSettings( bodyMap );
+    Eigen::Vector6d initialState = propagatorSettings->getInitialStates( );
+
+    for( unsigned int testCase = 0; testCase < 2; testCase++ )
+    {
+        boost::shared_ptr< IntegratorSettings< > > integratorSettings = createFixedSizeTestIntegratorSettings( testCase );
+
+        // Propagate with dynamics simulator (which automatically selects fixed-size state vectors)
+        SingleArcDynamicsSimulator< > dynamicsSimulator( bodyMap, integratorSettings, propagatorSettings );
+        SolutionHistory< double, double > simulatorStateHistory =
+                dynamicsSimulator.getEquationsOfMotionNumericalSolutionHistory( );
+
+        // Propagate the same dynamics as multi-type propagation with dynamics simulator (which uses dynamic-size state
+        // vectors, since the propagator settings are not single-body translational settings)
+        std::map< IntegratedStateType, std::vector< boost::shared_ptr< SingleArcPropagatorSettings< double > > > >
+                propagatorSettingsMap;
+        propagatorSettingsMap[ translational_state ].push_back( propagatorSettings );
+        SingleArcDynamicsSimulator< > multiTypeDynamicsSimulator(
+                    bodyMap, integratorSettings, boost::make_shared< MultiTypePropagatorSettings< double > >(
+                        propagatorSettingsMap, propagatorSettings->getTerminationSettings( ) ) );
+        SolutionHistory< double, double > multiTypeSimulatorStateHistory =
+                multiTypeDynamicsSimulator.getEquationsOfMotionNumericalSolutionHistory( );
+        SolutionHistory< double, double > simulatorDependentVariableHistory =
+                dynamicsSimulator.getDependentVariableSolutionHistory( );
+
+        boost::shared_ptr< DynamicsStateDerivativeModel< > > stateDerivativeModel =
+                dynamicsSimulator.getDynamicsStateDerivative( );
+        boost::shared_ptr< PropagationTerminationCondition > terminationCondition =
+                createPropagationTerminationConditions(
+                    propagatorSettings->getTerminationSettings( ), bodyMap, integratorSettings->initialTimeStep_ );
+
+        // Propagate with dynamic and fixed size state vectors, directly through integration interface.
+        SolutionHistory< double, double > dynamicSizeStateHistory, fixedSizeStateHistory;
+        integrateWithDynamicSizeState(
+                    stateDerivativeModel, terminationCondition, initialState, integratorSettings, dynamicSizeStateHistory );
+        integrateWithFixedSizeState(
+                    stateDerivativeModel, terminationCondition, initialState, integratorSettings, fixedSizeStateHistory );
+
+        // Check that dynamics simulator uses fixed-size path, and results are consistent with dynamic-size path.
+        BOOST_CHECK_EQUAL( simulatorStateHistory.getNumberOfEntries( ), fixedSizeStateHistory.getNumberOfEntries( ) );
+        BOOST_CHECK( simulatorStateHistory.getTimes( ) == fixedSizeStateHistory.getTimes( ) );
+        BOOST_CHECK( simulatorStateHistory.getEntries( ) == fixedSizeStateHistory.getEntries( ) );
+        BOOST_CHECK_EQUAL( simulatorDependentVariableHistory.getNumberOfEntries( ),
+                           simulatorStateHistory.getNumberOfEntries( ) );
+
+        // Check that multi-type propagation with dynamics simulator is consistent with dynamic-size path.
+        BOOST_CHECK( multiTypeSimulatorStateHistory.getTimes( ) == dynamicSizeStateHistory.getTimes( ) );
+        BOOST_CHECK( multiTypeSimulatorStateHistory.getEntries( ) == dynamicSizeStateHistory.getEntries( ) );
+
+        BOOST_CHECK_EQUAL( dynamicSizeStateHistory.getNumberOfEntries( ), fixedSizeStateHistory.getNumberOfEntries( ) );
+        for( unsigned int i = 0; i < fixedSizeStateHistory.getNumberOfEntries( ); i++ )
+        {
+            BOOST_CHECK_CLOSE_FRACTION( dynamicSizeStateHistory.getTime( i ), fixedSizeStateHistory.getTime( i ),
+                                        1.0E-12 );
+            Eigen::Vector6d dynamicSizeState = dynamicSizeStateHistory.getEntry( i );
+            Eigen::Vector6d fixedSizeState = fixedSizeStateHistory.getEntry( i );
+            BOOST_CHECK_SMALL( ( dynamicSizeState - fixedSizeState ).segment( 0, 3 ).norm( ) /
+                               fixedSizeState.segment( 0, 3 ).norm( ), 1.0E-10 );
+            BOOST_CHECK_SMALL( ( dynamicSizeState - fixedSizeState ).segment( 3, 3 ).norm( ) /
+                               fixedSizeState.segment( 3, 3 ).norm( ), 1.0E-10 );
+        }
+    }
+}
+
+#if COMPILE_UNIT_TEST_BENCHMARKS
+//! Compare computation times of propagation of a single body with dynamic-size and fixed-size state vectors. Note that
+//! only the integrator uses fixed-size state vectors: the state derivative models are evaluated on dynamic-size buffers
+//! in both cases.
+BOOST_AUTO_TEST_CASE( benchmarkFixedSizeStatePropagation )
+{
+    NamedBodyMap bodyMap = createEarthOrbiterTestBodies( );
+    boost::shared_ptr< TranslationalStatePropagatorSettings< double > > propagatorSettings =
+            createFixedSizeTestPropagatorSettings( bodyMap );
+    Eigen::Vector6d initialState = propagatorSettings->getInitialStates( );
+
+    for( unsigned int testCase = 0; testCase < 2; testCase++ )
+    {
+        boost::shared_ptr< IntegratorSettings< > > integratorSettings = createFixedSizeTestIntegratorSettings( testCase );
+        SingleArcDynamicsSimulator< > dynamicsSimulator( bodyMap, integratorSettings, propagatorSettings );
+        boost::shared_ptr< DynamicsStateDerivativeModel< > > stateDerivativeModel =
+                dynamicsSimulator.getDynamicsStateDerivative( );
+        boost::shared_ptr< PropagationTerminationCondition > terminationCondition =
+                createPropagationTerminationConditions(
+                    propagatorSettings->getTerminationSettings( ), bodyMap, integratorSettings->initialTimeStep_ );
+
+        const unsigned int numberOfRepetitions = ( testCase == 0 ) ? 20 : 5;
+        double dynamicSizeComputationTime = 0.0, fixedSizeComputationTime = 0.0;
+        SolutionHistory< double, double > dynamicSizeStateHistory, fixedSizeStateHistory;
+        for( unsigned int i = 0; i < numberOfRepetitions; i++ )
+        {
+            std::chrono::steady_clock::time_point startTime = std::chrono::steady_clock::now( );
+            integrateWithDynamicSizeState(
+                        stateDerivativeModel, terminationCondition, initialState, integratorSettings,
+                        dynamicSizeStateHistory );
+            dynamicSizeComputationTime +=
+                    std::chrono::duration< double >( std::chrono::steady_clock::now( ) - startTime ).count( );
+
+            startTime = std::chrono::steady_clock::now( );
+            integrateWithFixedSizeState(
+                        stateDerivativeModel, terminationCondition, initialState, integratorSettings,
+                        fixedSizeStateHistory );
+            fixedSizeComputationTime +=
+                    std::chrono::duration< double >( std::chrono::steady_clock::now( ) - startTime ).count( );
+        }
+
+        std::cout << ( ( testCase == 0 ) ? "RKF7(8)" : "RK4" ) << " propagation of "
+                  << fixedSizeStateHistory.getNumberOfEntries( ) - 1 << " steps: dynamic-size state "
+                  << dynamicSizeComputationTime / numberOfRepetitions << " s, fixed-size state "
+                  << fixedSizeComputationTime / numberOfRepetitions << " s (speedup "
+                  << dynamicSizeComputationTime / fixedSizeComputationTime << ")" << std::endl;
+    }
+}
+#endif
+
+BOOST_AUTO_TEST_SUITE_END( )
+
+} // namespace unit_tests
+} // namespace tudat
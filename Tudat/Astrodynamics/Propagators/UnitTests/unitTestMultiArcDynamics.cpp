@@ -51,7 +51,7 @@ BOOST_AUTO_TEST_CASE( testKeplerMultiArcDynamics )
     //Load spice kernels.
     spice_interface::loadStandardSpiceKernels( );
 
-    for( unsigned testCase = 0; testCase < 3; testCase++ )
+    for( unsigned testCase = 0; testCase < 5; testCase++ )
     {
         std::vector< std::string > bodyNames;
         bodyNames.push_back( "Earth" );
@@ -128,12 +128,25 @@ BOOST_AUTO_TEST_CASE( testKeplerMultiArcDynamics )
         AccelerationMap accelerationModelMap = createAccelerationModelsMap(
                     bodyMap, accelerationMap, bodiesToIntegrate, centralBodies );
 
+        // For parallel propagation (cases 3 and 4): create separate environment and acceleration models for each arc
+        std::vector< NamedBodyMap > arcBodyMaps;
+        if( testCase >= 3 )
+        {
+            for( unsigned int i = 0; i < numberOfIntegrationArcs; i++ )
+            {
+                arcBodyMaps.push_back( createBodies( bodySettings ) );
+                setGlobalFrameBodyEphemerides( arcBodyMaps.at( i ), "SSB", "ECLIPJ2000" );
+            }
+        }
+
         std::vector< boost::shared_ptr< SingleArcPropagatorSettings< double > > > arcPropagationSettingsList;
         for( unsigned int i = 0; i < numberOfIntegrationArcs; i++ )
         {
             arcPropagationSettingsList.push_back(
                         boost::make_shared< TranslationalStatePropagatorSettings< double > >
-                        ( centralBodies, accelerationModelMap, bodiesToIntegrate,
+                        ( centralBodies, ( testCase >= 3 ) ? createAccelerationModelsMap(
+                                              arcBodyMaps.at( i ), accelerationMap, bodiesToIntegrate, centralBodies ) :
+                                          accelerationModelMap, bodiesToIntegrate,
                           systemInitialStates.at( i ), integrationArcEnds.at( i ) ) );
         }
 
@@ -171,6 +184,28 @@ BOOST_AUTO_TEST_CASE( testKeplerMultiArcDynamics )
                         bodyMap, integratorSettings, boost::make_shared< MultiArcPropagatorSettings< double > >(
                             arcPropagationSettingsList, true ), integrationArcStarts );
         }
+        // For cases 3 and 4: test multi-arc estimation with arcs propagated in parallel, each with its own environment. For
+        // case 4, the arc initial states are interpolated from previous state (so that arcs are propagated sequentially).
+        else
+        {
+            std::vector< boost::shared_ptr< IntegratorSettings< > > > integratorSettingsList;
+            for( unsigned int i = 0; i < numberOfIntegrationArcs; i++ )
+            {
+                integratorSettingsList.push_back( boost::make_shared< IntegratorSettings< > >
+                                                  ( rungeKutta4, integrationArcStarts.at( i ), 120.0 ) );
+            }
+            MultiArcDynamicsSimulator< > dynamicsSimulator(
+                        bodyMap, arcBodyMaps, integratorSettingsList, boost::make_shared< MultiArcPropagatorSettings< double > >(
+                            arcPropagationSettingsList, ( testCase == 4 ) ), 4 );
+
+            // Check that integrator settings may not be shared between arcs
+            std::vector< boost::shared_ptr< IntegratorSettings< > > > sharedIntegratorSettingsList(
+                        numberOfIntegrationArcs, integratorSettingsList.at( 0 ) );
+            BOOST_CHECK_THROW( MultiArcDynamicsSimulator< >(
+                                   bodyMap, arcBodyMaps, sharedIntegratorSettingsList,
+                                   boost::make_shared< MultiArcPropagatorSettings< double > >(
+                                       arcPropagationSettingsList ), 4 ), std::runtime_error );
+        }
 
 
         boost::shared_ptr< Ephemeris > moonEphemeris = bodyMap.at( "Moon" )->getEphemeris( );
@@ -202,7 +237,7 @@ BOOST_AUTO_TEST_CASE( testKeplerMultiArcDynamics )
             }
 
             // Check if output corresponds to expected analytical solution
-            if( testCase < 2 || i == 0 )
+            if( ( testCase != 2 && testCase != 4 ) || i == 0 )
             {
                 double currentTestTime = testStartTime;
                 while( currentTestTime < testEndTime )
@@ -0,0 +1,245 @@
+/*    Copyright (c) 2010-2017, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ */
+
+#define BOOST_TEST_MAIN
+
+#include <boost/filesystem.hpp>
+#include <boost/make_shared.hpp>
+#include <boost/test/unit_test.hpp>
+
+#include "Tudat/Astrodynamics/Propagators/propagationOutputSink.h"
+#include "Tudat/InputOutput/binaryDataFile.h"
+#include "Tudat/Mathematics/NumericalIntegrators/createNumericalIntegrator.h"
+#include "Tudat/SimulationSetup/EnvironmentSetup/createBodies.h"
+#include "Tudat/SimulationSetup/PropagationSetup/createAccelerationModels.h"
+#include "Tudat/SimulationSetup/PropagationSetup/dynamicsSimulator.h"
+#include "Tudat/Astrodynamics/Propagators/UnitTests/testEarthOrbiterEnvironment.h"
+
+namespace tudat
+{
+namespace unit_tests
+{
+
+using namespace tudat::numerical_integrators;
+using namespace tudat::simulation_setup;
+using namespace tudat::propagators;
+
+//! Function to create propagator settings for test of propagation output sinks.
+boost::shared_ptr< TranslationalStatePropagatorSettings< double > > createPropagationOutputSinkTestSettings(
+        const NamedBodyMap& bodyMap, const TranslationalPropagatorType propagatorType, const double finalTime )
+{
+    SelectedAccelerationMap accelerationMap;
+    accelerationMap[ "Vehicle" ][ "Earth" ].push_back(
+                boost::make_shared< AccelerationSettings >( basic_astrodynamics::central_gravity ) );
+    std::vector< std::string > bodiesToIntegrate( 1, "Vehicle" );
+    std::vector< std::string > centralBodies( 1, "Earth" );
+
+    Eigen::Vector6d initialState = Eigen::Vector6d::Zero( );
+    initialState( 0 ) = 7.2E6;
+    initialState( 4 ) = 6.5E3;
+    initialState( 5 ) = 3.5E3;
+
+    std::vector< boost::shared_ptr< SingleDependentVariableSaveSettings > > dependentVariables;
+    dependentVariables.push_back( boost::make_shared< SingleDependentVariableSaveSettings >(
+                                      relative_distance_dependent_variable, "Vehicle", "Earth" ) );
+    dependentVariables.push_back( boost::make_shared< SingleDependentVariableSaveSettings >(
+                                      relative_position_dependent_variable, "Vehicle", "Earth" ) );
+
+    return boost::make_shared< TranslationalStatePropagatorSettings< double > >(
+                centralBodies,
+                createAccelerationModelsMap( bodyMap, accelerationMap, bodiesToIntegrate, centralBodies ),
+                bodiesToIntegrate, initialState, finalTime, propagatorType,
+                boost::make_shared< DependentVariableSaveSettings >( dependentVariables, 0 ) );
+}
+
+//! Function to store output received by a FunctionPropagationOutputSink.
+void storePropagationOutput( const double time, const Eigen::VectorXd& state, const Eigen::VectorXd& dependentVariables,
+                             SolutionHistory< double, double >& stateHistory,
+                             SolutionHistory< double, double >& dependentVariableHistory )
+{
+    stateHistory.addEntry( time, state );
+    dependentVariableHistory.addEntry( time, dependentVariables );
+}
+
+BOOST_AUTO_TEST_SUITE( test_propagation_output_sink )
+
+//! Test whether output passed to a sink during propagation is identical to the retained histories, with and without
+//! retaining the histories, for propagators with and without conversion of the propagated state.
+BOOST_AUTO_TEST_CASE( testFunctionPropagationOutputSink )
+{
+    NamedBodyMap bodyMap = createEarthOrbiterTestBodies( );
+    boost::shared_ptr< IntegratorSettings< > > integratorSettings =
+            boost::make_shared< RungeKuttaVariableStepSizeSettings< > >(
+                rungeKuttaVariableStepSize, 0.0, 10.0, RungeKuttaCoefficients::rungeKuttaFehlberg78,
+                1.0E-3, 1.0E4, 1.0E-12, 1.0E-12 );
+
+    std::vector< TranslationalPropagatorType > propagatorTypes;
+    propagatorTypes.push_back( cowell );
+    propagatorTypes.push_back( gauss_keplerian );
+    for( unsigned int i = 0; i < propagatorTypes.size( ); i++ )
+    {
+        boost::shared_ptr< TranslationalStatePropagatorSettings< double > > propagatorSettings =
+                createPropagationOutputSinkTestSettings( bodyMap, propagatorTypes.at( i ), 10.0 * 86400.0 );
+
+        // Propagate without output sink.
+        SingleArcDynamicsSimulator< > referenceSimulator( bodyMap, integratorSettings, propagatorSettings );
+        SolutionHistory< double, double > referenceStateHistory =
+                referenceSimulator.getEquationsOfMotionNumericalSolutionHistory( );
+        SolutionHistory< double, double > referenceDependentVariableHistory =
+                referenceSimulator.getDependentVariableSolutionHistory( );
+        const unsigned int numberOfEntries = referenceStateHistory.getNumberOfEntries( );
+
+        for( unsigned int saveHistory = 0; saveHistory < 2; saveHistory++ )
+        {
+            // Propagate with output sink storing output.
+            SolutionHistory< double, double > sinkStateHistory, sinkDependentVariableHistory;
+            bool isFinalized = false;
+            propagatorSettings->resetOutputSink(
+                        boost::make_shared< FunctionPropagationOutputSink< > >(
+                            boost::bind( &storePropagationOutput, _1, _2, _3,
+                                         boost::ref( sinkStateHistory ), boost::ref( sinkDependentVariableHistory ) ),
+                            [ & ]( ){ isFinalized = true; } ), saveHistory );
+            SingleArcDynamicsSimulator< > dynamicsSimulator( bodyMap, integratorSettings, propagatorSettings );
+            propagatorSettings->resetOutputSink( boost::shared_ptr< PropagationOutputSink< > >( ) );
+
+            // Check that sink received all epochs, identical to reference history.
+            BOOST_CHECK( isFinalized );
+            BOOST_CHECK_EQUAL( sinkStateHistory.getNumberOfEntries( ), numberOfEntries );
+            BOOST_CHECK( sinkStateHistory.getTimes( ) == referenceStateHistory.getTimes( ) );
+            BOOST_CHECK( sinkStateHistory.getEntries( ) == referenceStateHistory.getEntries( ) );
+            BOOST_CHECK( sinkDependentVariableHistory.getTimes( ) == referenceDependentVariableHistory.getTimes( ) );
+            BOOST_CHECK( sinkDependentVariableHistory.getEntries( ) ==
+                         referenceDependentVariableHistory.getEntries( ) );
+            BOOST_CHECK_EQUAL( sinkDependentVariableHistory.getNumberOfRows( ), 4 );
+
+            // Check retained histories: full history, or only final entry.
+            const SolutionHistory< double, double >& stateHistory =
+                    dynamicsSimulator.getEquationsOfMotionNumericalSolutionHistory( );
+            const SolutionHistory< double, double >& dependentVariableHistory =
+                    dynamicsSimulator.getDependentVariableSolutionHistory( );
+            if( saveHistory )
+            {
+                BOOST_CHECK( stateHistory.getEntries( ) == referenceStateHistory.getEntries( ) );
+                BOOST_CHECK( dependentVariableHistory.getEntries( ) ==
+                             referenceDependentVariableHistory.getEntries( ) );
+            }
+            else
+            {
+                BOOST_CHECK_EQUAL( stateHistory.getNumberOfEntries( ), 1 );
+                BOOST_CHECK_EQUAL( dependentVariableHistory.getNumberOfEntries( ), 1 );
+                BOOST_CHECK_EQUAL( dynamicsSimulator.getCummulativeComputationTimeSolutionHistory( )
+                                   .getNumberOfEntries( ), 1 );
+                BOOST_CHECK_EQUAL( stateHistory.getTime( 0 ), referenceStateHistory.getTime( numberOfEntries - 1 ) );
+                BOOST_CHECK( stateHistory.getEntry( 0 ) == referenceStateHistory.getEntry( numberOfEntries - 1 ) );
+                BOOST_CHECK( dependentVariableHistory.getEntry( 0 ) ==
+                             referenceDependentVariableHistory.getEntry( numberOfEntries - 1 ) );
+            }
+        }
+
+        // Check that setting integrated result is not permitted if histories are not retained.
+        propagatorSettings->resetOutputSink(
+                    boost::make_shared< FunctionPropagationOutputSink< > >(
+                        [ ]( const double, const Eigen::VectorXd&, const Eigen::VectorXd& ){ } ), false );
+        BOOST_CHECK_THROW( SingleArcDynamicsSimulator< >( bodyMap, integratorSettings, propagatorSettings, true,
+                                                          false, true ), std::runtime_error );
+    }
+}
+
+//! Test whether output written to a binary file during propagation (with and without downsampling) is consistent with
+//! retained histories.
+BOOST_AUTO_TEST_CASE( testBinaryFilePropagationOutputSink )
+{
+    NamedBodyMap bodyMap = createEarthOrbiterTestBodies( );
+    boost::shared_ptr< IntegratorSettings< > > integratorSettings =
+            boost::make_shared< IntegratorSettings< > >( rungeKutta4, 0.0, 10.0 );
+    boost::shared_ptr< TranslationalStatePropagatorSettings< double > > propagatorSettings =
+            createPropagationOutputSinkTestSettings( bodyMap, cowell, 5.0 * 86400.0 + 5.0 );
+
+    SingleArcDynamicsSimulator< > referenceSimulator( bodyMap, integratorSettings, propagatorSettings );
+    SolutionHistory< double, double > referenceStateHistory =
+            referenceSimulator.getEquationsOfMotionNumericalSolutionHistory( );
+    SolutionHistory< double, double > referenceDependentVariableHistory =
+            referenceSimulator.getDependentVariableSolutionHistory( );
+    const unsigned int numberOfEntries = referenceStateHistory.getNumberOfEntries( );
+
+    const std::string fileName = ( boost::filesystem::temp_directory_path( ) /
+                                   boost::filesystem::unique_path( "propagationOutput%%%%%%%%.bin" ) ).string( );
+    const std::string downsampledFileName =
+            ( boost::filesystem::temp_directory_path( ) /
+              boost::filesystem::unique_path( "propagationOutput%%%%%%%%.bin" ) ).string( );
+    for( unsigned int writeAsynchronously = 0; writeAsynchronously < 2; writeAsynchronously++ )
+    {
+        // Write full output to file, without retaining histories.
+        propagatorSettings->resetOutputSink(
+                    boost::make_shared< BinaryFilePropagationOutputSink< > >(
+                        fileName, "Test propagation", writeAsynchronously ), false );
+        {
+            SingleArcDynamicsSimulator< > dynamicsSimulator( bodyMap, integratorSettings, propagatorSettings );
+        }
+
+        input_output::BinaryDataFileContents fileContents = input_output::readBinaryDataFile( fileName );
+        BOOST_CHECK_EQUAL( fileContents.header_, "Test propagation" );
+        BOOST_CHECK_EQUAL( fileContents.data_.rows( ), numberOfEntries );
+        BOOST_CHECK_EQUAL( fileContents.data_.cols( ), 11 );
+        BOOST_CHECK_EQUAL( fileContents.variables_.size( ), 4 );
+        BOOST_CHECK_EQUAL( fileContents.variables_.at( 0 ).name_, "epoch" );
+        BOOST_CHECK_EQUAL( fileContents.variables_.at( 1 ).name_, "state" );
+        BOOST_CHECK_EQUAL( fileContents.variables_.at( 1 ).size_, 6 );
+        BOOST_CHECK_EQUAL( fileContents.variables_.at( 2 ).firstColumn_, 7 );
+        BOOST_CHECK_EQUAL( fileContents.variables_.at( 2 ).size_, 1 );
+        BOOST_CHECK_EQUAL( fileContents.variables_.at( 3 ).firstColumn_, 8 );
+        BOOST_CHECK_EQUAL( fileContents.variables_.at( 3 ).size_, 3 );
+        for( unsigned int i = 0; i < numberOfEntries; i++ )
+        {
+            BOOST_CHECK_EQUAL( fileContents.data_( i, 0 ), referenceStateHistory.getTime( i ) );
+            BOOST_CHECK( fileContents.data_.block( i, 1, 1, 6 ).transpose( ) == referenceStateHistory.getEntry( i ) );
+            BOOST_CHECK( fileContents.data_.block( i, 7, 1, 4 ).transpose( ) ==
+                         referenceDependentVariableHistory.getEntry( i ) );
+        }
+
+        // Write downsampled output to file.
+        const double outputInterval = 3600.0;
+        propagatorSettings->resetOutputSink(
+                    boost::make_shared< DownsamplingPropagationOutputSink< > >(
+                        boost::make_shared< BinaryFilePropagationOutputSink< > >(
+                            downsampledFileName, "", writeAsynchronously ), outputInterval ), false );
+        {
+            SingleArcDynamicsSimulator< > dynamicsSimulator( bodyMap, integratorSettings, propagatorSettings );
+        }
+
+        std::map< double, Eigen::VectorXd > downsampledOutput =
+                input_output::readDataMapFromBinaryFile( downsampledFileName );
+        BOOST_CHECK_EQUAL( downsampledOutput.size( ), 122 );
+        BOOST_CHECK_EQUAL( downsampledOutput.begin( )->first, referenceStateHistory.getTime( 0 ) );
+        BOOST_CHECK_EQUAL( downsampledOutput.rbegin( )->first, referenceStateHistory.getTime( numberOfEntries - 1 ) );
+        BOOST_CHECK( downsampledOutput.rbegin( )->second.segment( 0, 6 ) ==
+                     referenceStateHistory.getEntry( numberOfEntries - 1 ) );
+        double previousTime = TUDAT_NAN;
+        for( std::map< double, Eigen::VectorXd >::const_iterator outputIterator = downsampledOutput.begin( );
+             outputIterator != downsampledOutput.end( ); outputIterator++ )
+        {
+            if( outputIterator != downsampledOutput.begin( ) &&
+                    outputIterator->first != downsampledOutput.rbegin( )->first )
+            {
+                BOOST_CHECK_EQUAL( outputIterator->first - previousTime, outputInterval );
+            }
+            previousTime = outputIterator->first;
+        }
+    }
+    propagatorSettings->resetOutputSink( boost::shared_ptr< PropagationOutputSink< > >( ) );
+
+    boost::filesystem::remove( fileName );
+    boost::filesystem::remove( downsampledFileName );
+}
+
+BOOST_AUTO_TEST_SUITE_END( )
+
+} // namespace unit_tests
+} // namespace tudat
@@ -0,0 +1,236 @@
+/*    Copyright (c) 2010-2017, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ */
+
+#define BOOST_TEST_MAIN
+
+#include <limits>
+
+#include <boost/test/unit_test.hpp>
+#include <boost/make_shared.hpp>
+
+#include "Tudat/Astrodynamics/Ephemerides/constantEphemeris.h"
+#include "Tudat/Astrodynamics/Propagators/integrateEquations.h"
+#include "Tudat/Astrodynamics/Propagators/solutionHistory.h"
+#include "Tudat/SimulationSetup/EnvironmentSetup/createBodies.h"
+#include "Tudat/SimulationSetup/PropagationSetup/createAccelerationModels.h"
+#include "Tudat/SimulationSetup/PropagationSetup/dynamicsSimulator.h"
+
+namespace tudat
+{
+
+namespace unit_tests
+{
+
+using namespace tudat::propagators;
+using namespace tudat::numerical_integrators;
+using namespace tudat::simulation_setup;
+
+//! State derivative of harmonic oscillator (with unit frequency), used to test numerical integration output.
+Eigen::VectorXd computeHarmonicOscillatorStateDerivative( const double time, const Eigen::VectorXd& state )
+{
+    Eigen::VectorXd stateDerivative = Eigen::VectorXd::Zero( 2 );
+    stateDerivative( 0 ) = state( 1 );
+    stateDerivative( 1 ) = -state( 0 );
+    return stateDerivative;
+}
+
+//! Function to terminate propagation at given final time.
+bool checkFinalTime( const double currentTime, const double finalTime )
+{
+    return currentTime >= finalTime;
+}
+
+BOOST_AUTO_TEST_SUITE( test_solution_history )
+
+//! Test storage, growth and map conversion of solution history.
+BOOST_AUTO_TEST_CASE( testSolutionHistoryStorage )
+{
+    SolutionHistory< double, double > solutionHistory;
+    BOOST_CHECK_EQUAL( solutionHistory.empty( ), true );
+
+    // Add entries, forcing storage to be reallocated several times.
+    const unsigned int numberOfEntries = 1000;
+    for( unsigned int i = 0; i < numberOfEntries; i++ )
+    {
+        solutionHistory.addEntry( static_cast< double >( i ),
+                                  Eigen::Vector3d( static_cast< double >( i ), 2.0 * i, 3.0 * i ) );
+    }
+    BOOST_CHECK_EQUAL( solutionHistory.getNumberOfEntries( ), numberOfEntries );
+    BOOST_CHECK_EQUAL( solutionHistory.getNumberOfRows( ), 3 );
+    BOOST_CHECK_EQUAL( solutionHistory.getNumberOfColumns( ), 1 );
+    BOOST_CHECK_EQUAL( solutionHistory.getEntries( ).cols( ), static_cast< int >( numberOfEntries ) );
+    BOOST_CHECK_EQUAL( solutionHistory.areTimesIncreasing( ), true );
+    for( unsigned int i = 0; i < numberOfEntries; i++ )
+    {
+        BOOST_CHECK_EQUAL( solutionHistory.getTime( i ), static_cast< double >( i ) );
+        BOOST_CHECK_EQUAL( solutionHistory.getEntry( i )( 2, 0 ), 3.0 * i );
+    }
+
+    // Check that entry at existing final time overwrites this entry, as would be the case for a map.
+    solutionHistory.addEntry( static_cast< double >( numberOfEntries - 1 ), Eigen::Vector3d::Zero( ) );
+    BOOST_CHECK_EQUAL( solutionHistory.getNumberOfEntries( ), numberOfEntries );
+    BOOST_CHECK_EQUAL( solutionHistory.getEntry( numberOfEntries - 1 ).norm( ), 0.0 );
+
+    // Check that entries of inconsistent size are rejected.
+    BOOST_CHECK_THROW( solutionHistory.addEntry( 2.0E3, Eigen::Vector2d::Zero( ) ), std::runtime_error );
+
+    // Check conversion to and from map.
+    std::map< double, Eigen::VectorXd > solutionMap = solutionHistory.convertToMap< Eigen::VectorXd >( );
+    BOOST_CHECK_EQUAL( solutionMap.size( ), numberOfEntries );
+    SolutionHistory< double, double > reconstructedSolutionHistory( solutionMap );
+    BOOST_CHECK_EQUAL( reconstructedSolutionHistory.getNumberOfEntries( ), numberOfEntries );
+    for( unsigned int i = 0; i < numberOfEntries; i++ )
+    {
+        BOOST_CHECK_EQUAL( reconstructedSolutionHistory.getTime( i ), solutionHistory.getTime( i ) );
+        for( unsigned int j = 0; j < 3; j++ )
+        {
+            BOOST_CHECK_EQUAL( reconstructedSolutionHistory.getEntry( i )( j, 0 ),
+                               solutionHistory.getEntry( i )( j, 0 ) );
+        }
+    }
+
+    // Check clearing of history
+    solutionHistory.clear( );
+    BOOST_CHECK_EQUAL( solutionHistory.getNumberOfEntries( ), 0 );
+    solutionHistory.addEntry( 0.0, Eigen::Vector2d::Zero( ) );
+    BOOST_CHECK_EQUAL( solutionHistory.getNumberOfRows( ), 2 );
+
+    // Check scalar history, with decreasing times (as for backwards propagation).
+    SolutionHistory< double, double > scalarHistory;
+    for( unsigned int i = 0; i < 10; i++ )
+    {
+        scalarHistory.addEntry( -static_cast< double >( i ), static_cast< double >( i ) );
+    }
+    BOOST_CHECK_EQUAL( scalarHistory.areTimesIncreasing( ), false );
+    BOOST_CHECK_EQUAL( scalarHistory.getIndexInIncreasingTimeOrder( 0 ), 9 );
+    std::map< double, double > scalarMap = scalarHistory.convertToMap< double >( );
+    BOOST_CHECK_EQUAL( scalarMap.begin( )->first, -9.0 );
+    BOOST_CHECK_EQUAL( scalarMap.begin( )->second, 9.0 );
+}
+
+//! Test whether numerical integration to solution history produces the same results as integration to map.
+BOOST_AUTO_TEST_CASE( testSolutionHistoryIntegrationOutput )
+{
+    const double finalTime = 1.0E4;
+    boost::shared_ptr< IntegratorSettings< double > > integratorSettings =
+            boost::make_shared< IntegratorSettings< double > >( rungeKutta4, 0.0, 0.01 );
+    Eigen::VectorXd initialState = Eigen::VectorXd::Zero( 2 );
+    initialState( 0 ) = 1.0;
+
+    // Integrate equations with map output
+    std::map< double, Eigen::VectorXd > solutionMap;
+    std::map< double, Eigen::VectorXd > dependentVariableMap;
+    std::map< double, double > computationTimeMap;
+    EquationIntegrationInterface< Eigen::VectorXd, double >::integrateEquations(
+                &computeHarmonicOscillatorStateDerivative, solutionMap, initialState, integratorSettings,
+                boost::bind( &checkFinalTime, _1, finalTime ), dependentVariableMap, computationTimeMap );
+
+    // Integrate equations with solution history output
+    SolutionHistory< double, double > solutionHistory;
+    SolutionHistory< double, double > dependentVariableHistory;
+    SolutionHistory< double, double > computationTimeHistory;
+    EquationIntegrationInterface< Eigen::VectorXd, double >::integrateEquations(
+                &computeHarmonicOscillatorStateDerivative, solutionHistory, initialState, integratorSettings,
+                boost::bind( &checkFinalTime, _1, finalTime ), dependentVariableHistory, computationTimeHistory );
+
+    // Check that results are identical
+    BOOST_CHECK_EQUAL( solutionHistory.getNumberOfEntries( ), solutionMap.size( ) );
+    BOOST_CHECK_EQUAL( computationTimeHistory.getNumberOfEntries( ), computationTimeMap.size( ) );
+    unsigned int index = 0;
+    for( std::map< double, Eigen::VectorXd >::const_iterator solutionIterator = solutionMap.begin( );
+         solutionIterator != solutionMap.end( ); solutionIterator++ )
+    {
+        BOOST_CHECK_EQUAL( solutionHistory.getTime( index ), solutionIterator->first );
+        BOOST_CHECK_EQUAL( solutionHistory.getEntry( index )( 0, 0 ), solutionIterator->second( 0 ) );
+        BOOST_CHECK_EQUAL( solutionHistory.getEntry( index )( 1, 0 ), solutionIterator->second( 1 ) );
+        index++;
+    }
+}
+
+//! Test whether single-arc propagation with contiguous solution storage correctly resets the ephemeris of the
+//! propagated body, and whether the (adapter) map output is consistent with the contiguous output.
+BOOST_AUTO_TEST_CASE( testSolutionHistoryEphemerisReset )
+{
+    const double earthGravitationalParameter = 3.986004418E14;
+
+    // Create bodies
+    NamedBodyMap bodyMap;
+    bodyMap[ "Earth" ] = boost::make_shared< Body >( );
+    bodyMap[ "Earth" ]->setEphemeris( boost::make_shared< ephemerides::ConstantEphemeris >(
+                                          Eigen::Vector6d( Eigen::Vector6d::Zero( ) ), "SSB", "ECLIPJ2000" ) );
+    bodyMap[ "Earth" ]->setGravityFieldModel(
+                boost::make_shared< gravitation::GravityFieldModel >( earthGravitationalParameter ) );
+    bodyMap[ "Vehicle" ] = boost::make_shared< Body >( );
+    bodyMap[ "Vehicle" ]->setEphemeris( boost::make_shared< ephemerides::TabulatedCartesianEphemeris< > >(
+                                            boost::shared_ptr< interpolators::OneDimensionalInterpolator
+                                            < double, Eigen::Vector6d > >( ), "Earth", "ECLIPJ2000" ) );
+    setGlobalFrameBodyEphemerides( bodyMap, "SSB", "ECLIPJ2000" );
+
+    // Create propagation settings
+    SelectedAccelerationMap accelerationMap;
+    accelerationMap[ "Vehicle" ][ "Earth" ].push_back(
+                boost::make_shared< AccelerationSettings >( basic_astrodynamics::central_gravity ) );
+    std::vector< std::string > bodiesToIntegrate( 1, "Vehicle" );
+    std::vector< std::string > centralBodies( 1, "Earth" );
+    Eigen::VectorXd initialState = Eigen::VectorXd::Zero( 6 );
+    initialState( 0 ) = 7.0E6;
+    initialState( 4 ) = 7.5E3;
+    initialState( 5 ) = 1.0E3;
+    boost::shared_ptr< TranslationalStatePropagatorSettings< double > > propagatorSettings =
+            boost::make_shared< TranslationalStatePropagatorSettings< double > >(
+                centralBodies, createAccelerationModelsMap( bodyMap, accelerationMap, bodiesToIntegrate, centralBodies ),
+                bodiesToIntegrate, initialState, 1.0E4 );
+    boost::shared_ptr< IntegratorSettings< > > integratorSettings =
+            boost::make_shared< IntegratorSettings< > >( rungeKutta4, 0.0, 10.0 );
+
+    // Propagate orbit
+    SingleArcDynamicsSimulator< > dynamicsSimulator(
+                bodyMap, integratorSettings, propagatorSettings, true, false, true );
+    const SolutionHistory< double, double >& solutionHistory =
+            dynamicsSimulator.getEquationsOfMotionNumericalSolutionHistory( );
+    std::map< double, Eigen::VectorXd > solutionMap = dynamicsSimulator.getEquationsOfMotionNumericalSolution( );
+
+    // Check consistency of contiguous and map output, and of reset ephemeris
+    BOOST_CHECK_EQUAL( solutionHistory.getNumberOfEntries( ), solutionMap.size( ) );
+    BOOST_CHECK_EQUAL( solutionHistory.getNumberOfRows( ), 6 );
+    unsigned int index = 0;
+    for( std::map< double, Eigen::VectorXd >::const_iterator solutionIterator = solutionMap.begin( );
+         solutionIterator != solutionMap.end( ); solutionIterator++ )
+    {
+        Eigen::Vector6d ephemerisState =
+                bodyMap.at( "Vehicle" )->getEphemeris( )->getCartesianState( solutionIterator->first );
+        BOOST_CHECK_EQUAL( solutionHistory.getTime( index ), solutionIterator->first );
+        for( unsigned int i = 0; i < 6; i++ )
+        {
+            BOOST_CHECK_EQUAL( solutionHistory.getEntry( index )( i, 0 ), solutionIterator->second( i ) );
+            BOOST_CHECK_SMALL( std::fabs( ephemerisState( i ) - solutionIterator->second( i ) ),
+                               1.0E-8 * std::fabs( solutionIterator->second( i ) ) + 1.0E-8 );
+        }
+        index++;
+    }
+
+    // Check that map output is created once per propagation, and regenerated after new propagation
+    BOOST_CHECK_EQUAL( &dynamicsSimulator.getEquationsOfMotionNumericalSolution( ),
+                       &dynamicsSimulator.getEquationsOfMotionNumericalSolution( ) );
+    initialState( 4 ) = 7.4E3;
+    dynamicsSimulator.integrateEquationsOfMotion( initialState );
+    const std::map< double, Eigen::VectorXd >& newSolutionMap =
+            dynamicsSimulator.getEquationsOfMotionNumericalSolution( );
+    BOOST_CHECK_EQUAL( solutionHistory.getNumberOfEntries( ), newSolutionMap.size( ) );
+    BOOST_CHECK_EQUAL( newSolutionMap.rbegin( )->second( 0 ),
+                       solutionHistory.getEntry( solutionHistory.getNumberOfEntries( ) - 1 )( 0, 0 ) );
+    BOOST_CHECK( newSolutionMap.rbegin( )->second( 0 ) != solutionMap.rbegin( )->second( 0 ) );
+}
+
+BOOST_AUTO_TEST_SUITE_END( )
+
+} // namespace unit_tests
+
+} // namespace tudat
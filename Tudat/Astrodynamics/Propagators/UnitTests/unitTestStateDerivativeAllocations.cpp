@@ -0,0 +1,229 @@
+/*    Copyright (c) 2010-2017, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ */
+
+#define BOOST_TEST_MAIN
+
+#include <cstdlib>
+#include <iostream>
+#include <new>
+#include <string>
+
+#include <boost/make_shared.hpp>
+#include <boost/test/unit_test.hpp>
+
+#include "Tudat/Mathematics/NumericalIntegrators/createNumericalIntegrator.h"
+#include "Tudat/SimulationSetup/EnvironmentSetup/createBodies.h"
+#include "Tudat/SimulationSetup/PropagationSetup/createAccelerationModels.h"
+#include "Tudat/SimulationSetup/PropagationSetup/dynamicsSimulator.h"
+#include "Tudat/Astrodynamics/Propagators/UnitTests/testEarthOrbiterEnvironment.h"
+
+//! Number of heap allocations through (global) operator new performed since start of program.
+static unsigned long long numberOfHeapAllocations = 0;
+
+// Replace global allocation and deallocation functions, so that allocations through operator new are counted.
+void* operator new( std::size_t size )
+{
+    numberOfHeapAllocations++;
+    void* memory = std::malloc( size == 0 ? 1 : size );
+    if( memory == NULL )
+    {
+        throw std::bad_alloc( );
+    }
+    return memory;
+}
+
+void* operator new[ ]( std::size_t size )
+{
+    return operator new( size );
+}
+
+void operator delete( void* memory ) noexcept
+{
+    std::free( memory );
+}
+
+void operator delete[ ]( void* memory ) noexcept
+{
+    operator delete( memory );
+}
+
+namespace tudat
+{
+namespace unit_tests
+{
+
+using namespace tudat::numerical_integrators;
+using namespace tudat::simulation_setup;
+using namespace tudat::propagators;
+
+BOOST_AUTO_TEST_SUITE( test_state_derivative_allocations )
+
+//! Test whether evaluation of the state derivative for point-mass dynamics is free of heap allocations.
+BOOST_AUTO_TEST_CASE( testStateDerivativeAllocations )
+{
+    NamedBodyMap bodyMap = createEarthOrbiterTestBodies( );
+
+    SelectedAccelerationMap accelerationMap;
+    accelerationMap[ "Vehicle" ][ "Earth" ].push_back(
+                boost::make_shared< AccelerationSettings >( basic_astrodynamics::central_gravity ) );
+    std::vector< std::string > bodiesToIntegrate( 1, "Vehicle" );
+    std::vector< std::string > centralBodies( 1, "Earth" );
+
+    Eigen::Vector6d initialState = Eigen::Vector6d::Zero( );
+    initialState( 0 ) = 7.2E6;
+    initialState( 4 ) = 6.5E3;
+    initialState( 5 ) = 3.5E3;
+
+    boost::shared_ptr< TranslationalStatePropagatorSettings< double > > propagatorSettings =
+            boost::make_shared< TranslationalStatePropagatorSettings< double > >(
+                centralBodies, createAccelerationModelsMap( bodyMap, accelerationMap, bodiesToIntegrate, centralBodies ),
+                bodiesToIntegrate, initialState, 86400.0 );
+    boost::shared_ptr< IntegratorSettings< > > integratorSettings =
+            boost::make_shared< RungeKuttaVariableStepSizeSettings< > >(
+                rungeKuttaVariableStepSize, 0.0, 10.0, RungeKuttaCoefficients::rungeKuttaFehlberg78,
+                1.0E-3, 1.0E4, 1.0E-10, 1.0E-10 );
+
+    SingleArcDynamicsSimulator< > dynamicsSimulator(
+                bodyMap, integratorSettings, propagatorSettings, false, false, false );
+    boost::shared_ptr< DynamicsStateDerivativeModel< > > stateDerivativeModel =
+            dynamicsSimulator.getDynamicsStateDerivative( );
+    stateDerivativeModel->setPropagationSettings( std::vector< IntegratedStateType >( ), true, false );
+
+    // Compute state derivative in place, and check that no allocations are performed
+    const unsigned int numberOfEvaluations = 10000;
+    Eigen::MatrixXd state = initialState;
+    Eigen::MatrixXd stateDerivative = Eigen::MatrixXd::Zero( 6, 1 );
+    stateDerivativeModel->computeStateDerivativeInPlace( 0.0, state, stateDerivative );
+
+    unsigned long long numberOfAllocationsAtStart = numberOfHeapAllocations;
+    for( unsigned int i = 0; i < numberOfEvaluations; i++ )
+    {
+        state( 0 ) += 1.0;
+        stateDerivativeModel->computeStateDerivativeInPlace( static_cast< double >( i ), state, stateDerivative );
+    }
+    unsigned long long numberOfInPlaceAllocations = numberOfHeapAllocations - numberOfAllocationsAtStart;
+    BOOST_CHECK_EQUAL( numberOfInPlaceAllocations, 0 );
+
+    // Check that the by-value function gives identical results
+    BOOST_CHECK( stateDerivative == stateDerivativeModel->computeStateDerivative( 1.0E3, state ) );
+}
+
+//! Function to count the heap allocations during propagation of vehicles in (uncoupled) orbits around the Earth.
+/*!
+ *  Function to count the heap allocations during propagation of vehicles in (uncoupled) orbits around the Earth, using
+ *  a Runge-Kutta-Fehlberg 7(8) integrator with a fixed step size of 10 s (tolerances are set such that all steps are
+ *  accepted), without retaining the solution history.
+ *  \param numberOfVehicles Number of propagated vehicles.
+ *  \param finalTime End time of the propagation.
+ *  \param useMultiTypeSettings Boolean denoting whether the translational propagator settings are to be wrapped in
+ *  MultiTypePropagatorSettings.
+ *  \return Number of heap allocations performed by SingleArcDynamicsSimulator::integrateEquationsOfMotion.
+ */
+unsigned long long countPropagationAllocations( const unsigned int numberOfVehicles, const double finalTime,
+                                                const bool useMultiTypeSettings = false )
+{
+    std::vector< std::string > bodiesToIntegrate;
+    for( unsigned int i = 0; i < numberOfVehicles; i++ )
+    {
+        bodiesToIntegrate.push_back( "Vehicle" + std::to_string( i ) );
+    }
+    std::vector< std::string > centralBodies( numberOfVehicles, "Earth" );
+    NamedBodyMap bodyMap = createEarthOrbiterTestBodies( bodiesToIntegrate );
+
+    SelectedAccelerationMap accelerationMap;
+    Eigen::VectorXd initialState = Eigen::VectorXd::Zero( 6 * numberOfVehicles );
+    for( unsigned int i = 0; i < numberOfVehicles; i++ )
+    {
+        accelerationMap[ bodiesToIntegrate.at( i ) ][ "Earth" ].push_back(
+                    boost::make_shared< AccelerationSettings >( basic_astrodynamics::central_gravity ) );
+        initialState( 6 * i ) = 7.2E6 + 1.0E5 * i;
+        initialState( 6 * i + 4 ) = 6.5E3;
+        initialState( 6 * i + 5 ) = 3.5E3;
+    }
+
+    boost::shared_ptr< TranslationalStatePropagatorSettings< double > > propagatorSettings =
+            boost::make_shared< TranslationalStatePropagatorSettings< double > >(
+                centralBodies, createAccelerationModelsMap( bodyMap, accelerationMap, bodiesToIntegrate, centralBodies ),
+                bodiesToIntegrate, initialState, finalTime );
+    boost::shared_ptr< SingleArcPropagatorSettings< double > > simulatorPropagatorSettings = propagatorSettings;
+    if( useMultiTypeSettings )
+    {
+        std::map< IntegratedStateType, std::vector< boost::shared_ptr< SingleArcPropagatorSettings< double > > > >
+                propagatorSettingsMap;
+        propagatorSettingsMap[ translational_state ].push_back( propagatorSettings );
+        simulatorPropagatorSettings = boost::make_shared< MultiTypePropagatorSettings< double > >(
+                    propagatorSettingsMap, propagatorSettings->getTerminationSettings( ) );
+    }
+    simulatorPropagatorSettings->resetOutputSink( boost::shared_ptr< PropagationOutputSink< double > >( ), false );
+    boost::shared_ptr< IntegratorSettings< > > integratorSettings =
+            boost::make_shared< RungeKuttaVariableStepSizeSettings< > >(
+                rungeKuttaVariableStepSize, 0.0, 10.0, RungeKuttaCoefficients::rungeKuttaFehlberg78,
+                10.0, 10.0, 1.0E10, 1.0E10 );
+
+    SingleArcDynamicsSimulator< > dynamicsSimulator(
+                bodyMap, integratorSettings, simulatorPropagatorSettings, false, false, false );
+
+    unsigned long long numberOfAllocationsAtStart = numberOfHeapAllocations;
+    dynamicsSimulator.integrateEquationsOfMotion( simulatorPropagatorSettings->getInitialStates( ) );
+    return numberOfHeapAllocations - numberOfAllocationsAtStart;
+}
+
+//! Test the number of heap allocations per integration step during propagation with the dynamics simulator, which sets
+//! the in-place state derivative function of the numerical integrator, and uses fixed-size state vectors only for
+//! single-body translational dynamics.
+BOOST_AUTO_TEST_CASE( testPropagationStepAllocations )
+{
+    // Number of integration steps in 1 day.
+    const unsigned int numberOfSteps = 8640;
+
+    // Propagate single vehicle, single vehicle using multi-type settings, and two vehicles.
+    for( unsigned int testCase = 0; testCase < 3; testCase++ )
+    {
+        const unsigned int numberOfVehicles = ( testCase == 2 ) ? 2 : 1;
+        const bool useMultiTypeSettings = ( testCase == 1 );
+
+        // Propagate once before counting, to exclude one-time allocations (e.g. of static data).
+        countPropagationAllocations( numberOfVehicles, 86400.0, useMultiTypeSettings );
+
+        // Take difference in number of allocations between propagation of 1 and 2 days, to exclude the allocations
+        // upon initialization and finalization of the propagation.
+        unsigned long long numberOfAllocationsOneDay =
+                countPropagationAllocations( numberOfVehicles, 86400.0, useMultiTypeSettings );
+        unsigned long long numberOfAllocationsTwoDays =
+                countPropagationAllocations( numberOfVehicles, 2.0 * 86400.0, useMultiTypeSettings );
+        BOOST_CHECK( numberOfAllocationsTwoDays >= numberOfAllocationsOneDay );
+
+#if COMPILE_UNIT_TEST_BENCHMARKS
+        std::cout << "Heap allocations per integration step for " << numberOfVehicles << " vehicle(s)"
+                  << ( useMultiTypeSettings ? " (multi-type settings): " : ": " )
+                  << static_cast< double >( numberOfAllocationsTwoDays - numberOfAllocationsOneDay ) / numberOfSteps
+                  << std::endl;
+#endif
+
+        if( testCase == 0 )
+        {
+            // Single-body translational dynamics is propagated with fixed-size state vectors: integration steps are
+            // free of allocations.
+            BOOST_CHECK_EQUAL( numberOfAllocationsTwoDays - numberOfAllocationsOneDay, 0 );
+        }
+        else
+        {
+            // Other propagations use dynamic-size state vectors, of which (at least) the state returned by
+            // performIntegrationStep is allocated. The 13 state derivative evaluations per step are performed in
+            // place, so the number of allocations per step is bounded independently of the number of stages.
+            BOOST_CHECK( numberOfAllocationsTwoDays - numberOfAllocationsOneDay <= 2 * numberOfSteps );
+        }
+    }
+}
+
+BOOST_AUTO_TEST_SUITE_END( )
+
+} // namespace unit_tests
+} // namespace tudat
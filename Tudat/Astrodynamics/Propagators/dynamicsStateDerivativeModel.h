@@ -26,6 +26,7 @@
 #include "Tudat/Astrodynamics/BasicAstrodynamics/torqueModelTypes.h"
 #include "Tudat/Astrodynamics/Propagators/bodyMassStateDerivative.h"
 #include "Tudat/Astrodynamics/Propagators/singleStateTypeDerivative.h"
+#include "Tudat/Astrodynamics/Propagators/solutionHistory.h"
 #include "Tudat/Astrodynamics/Propagators/nBodyStateDerivative.h"
 #include "Tudat/Astrodynamics/Propagators/rotationalMotionStateDerivative.h"
 #include "Tudat/Astrodynamics/Propagators/variationalEquations.h"
@@ -65,7 +66,7 @@ public:
             stateDerivativeModels,
             const boost::function< void(
                 const TimeType, const std::unordered_map< IntegratedStateType, Eigen::Matrix< StateScalarType, Eigen::Dynamic, 1 > >&,
-                const std::vector< IntegratedStateType > ) > environmentUpdateFunction,
+                const std::vector< IntegratedStateType >& ) > environmentUpdateFunction,
             const boost::shared_ptr< VariationalEquations > variationalEquations =
             boost::shared_ptr< VariationalEquations >( ) ):
         environmentUpdateFunction_( environmentUpdateFunction ), variationalEquations_( variationalEquations )
@@ -118,6 +119,8 @@ public:
                     Eigen::Matrix< StateScalarType, Eigen::Dynamic, 1 >::Zero(
                         stateTypeSize_.at( stateDerivativeModels.at( i )->getIntegratedStateType( )  ), 1 );
         }
+
+        createStateDerivativeEvaluationPlan( );
     }
 
 
@@ -134,26 +137,38 @@ public:
      */
     StateType computeStateDerivative( const TimeType time, const StateType& state )
     {
-        //std::cout << "Computing state derivative: " << state.transpose( ) << std::endl;
+        computeStateDerivativeInPlace( time, state, stateDerivative_ );
+        return stateDerivative_;
+    }
+
+    //! Function to calculate the system state derivative, writing the result into an existing matrix
+    /*!
+     *  Function to calculate the system state derivative, with settings as by last call to
+     *  setPropagationSettings function, writing the result into the provided matrix. The models are evaluated using the
+     *  evaluation plan that is created upon construction, so that (for dynamics types that do not allocate memory
+     *  internally) no heap allocations are performed by this function, provided that the size of stateDerivative is
+     *  equal to that of state. The state may be any Eigen matrix or vector type (e.g. the fixed-size state vector of the
+     *  numerical integrator), so that it does not need to be copied to a StateType object first.
+     *  \param time Current time.
+     *  \param state Current complete state.
+     *  \param stateDerivative Calculated state derivative (returned by reference; resized if required).
+     */
+    template< typename StateDerivedType >
+    void computeStateDerivativeInPlace( const TimeType time, const Eigen::MatrixBase< StateDerivedType >& state,
+                                        StateType& stateDerivative )
+    {
         // Initialize state derivative
-        if( stateDerivative_.rows( ) != state.rows( ) || stateDerivative_.cols( ) != state.cols( )  )
+        if( stateDerivative.rows( ) != state.rows( ) || stateDerivative.cols( ) != state.cols( )  )
         {
-            stateDerivative_.resize( state.rows( ), state.cols( ) );
+            stateDerivative.resize( state.rows( ), state.cols( ) );
         }
 
         // If dynamical equations are integrated, update the environment with the current state.
         if( evaluateDynamicsEquations_ )
         {
-            // Iterate over all types of equations.
-            for( stateDerivativeModelsIterator_ = stateDerivativeModels_.begin( );
-                 stateDerivativeModelsIterator_ != stateDerivativeModels_.end( );
-                 stateDerivativeModelsIterator_++ )
-
+            for( unsigned int i = 0; i < numberOfStateDerivativeModels_; i++ )
             {
-                for( unsigned int i = 0; i < stateDerivativeModelsIterator_->second.size( ); i++ )
-                {
-                    stateDerivativeModelsIterator_->second.at( i )->clearStateDerivativeModel( );
-                }
+                stateDerivativeModelList_[ i ]->clearStateDerivativeModel( );
             }
 
             convertCurrentStateToGlobalRepresentationPerType( state, time, evaluateVariationalEquations_ );
@@ -162,10 +177,7 @@ public:
         }
         else
         {
-            environmentUpdateFunction_(
-                        time, std::unordered_map<
-                        IntegratedStateType, Eigen::Matrix< StateScalarType, Eigen::Dynamic, 1 > >( ),
-                        integratedStatesFromEnvironment_ );
+            environmentUpdateFunction_( time, emptyStatesPerType_, integratedStatesFromEnvironment_ );
         }
 
         if( evaluateVariationalEquations_ )
@@ -174,37 +186,23 @@ public:
         }
 
         // If dynamical equations are integrated, evaluate dynamics state derivatives.
-        std::pair< int, int > currentIndices;
         if( evaluateDynamicsEquations_ )
         {
-            // Iterate over all types of equations.
-            for( stateDerivativeModelsIterator_ = stateDerivativeModels_.begin( );
-                 stateDerivativeModelsIterator_ != stateDerivativeModels_.end( );
-                 stateDerivativeModelsIterator_++ )
-
+            // Update state derivative models
+            for( unsigned int i = 0; i < numberOfStateDerivativeModels_; i++ )
             {
-                for( unsigned int i = 0; i < stateDerivativeModelsIterator_->second.size( ); i++ )
-                {
-                    // Update state derivative models
-                    stateDerivativeModelsIterator_->second.at( i )->updateStateDerivativeModel( time );
-                }
+                stateDerivativeModelList_[ i ]->updateStateDerivativeModel( time );
             }
 
-            for( stateDerivativeModelsIterator_ = stateDerivativeModels_.begin( );
-                 stateDerivativeModelsIterator_ != stateDerivativeModels_.end( );
-                 stateDerivativeModelsIterator_++ )
-
+            // Evaluate and set current dynamical state derivative
+            for( unsigned int i = 0; i < numberOfStateDerivativeModels_; i++ )
             {
-                for( unsigned int i = 0; i < stateDerivativeModelsIterator_->second.size( ); i++ )
-                {
-                    // Evaluate and set current dynamical state derivative
-                    currentIndices = stateIndices_.at( stateDerivativeModelsIterator_->first ).at( i );
-
-                    stateDerivativeModelsIterator_->second.at( i )->calculateSystemStateDerivative(
-                                time, state.block( currentIndices.first, dynamicsStartColumn_, currentIndices.second, 1 ),
-                                stateDerivative_.block( currentIndices.first, dynamicsStartColumn_, currentIndices.second, 1 ) );
-
-                }
+                currentModelStates_[ i ] = state.block(
+                            stateIndicesList_[ i ].first, dynamicsStartColumn_, stateIndicesList_[ i ].second, 1 );
+                stateDerivativeModelList_[ i ]->calculateSystemStateDerivative(
+                            time, currentModelStates_[ i ],
+                            stateDerivative.block( stateIndicesList_[ i ].first, dynamicsStartColumn_,
+                                                   stateIndicesList_[ i ].second, 1 ) );
             }
         }
 
@@ -216,10 +214,50 @@ public:
 
             variationalEquations_->evaluateVariationalEquations< StateScalarType >(
                         time, state.block( 0, 0, totalStateSize_, variationalEquations_->getNumberOfParameterValues( ) ),
-                        stateDerivative_.block( 0, 0, totalStateSize_, variationalEquations_->getNumberOfParameterValues( ) )  );
+                        stateDerivative.block( 0, 0, totalStateSize_, variationalEquations_->getNumberOfParameterValues( ) )  );
         }
+    }
 
-        return stateDerivative_;
+    //! Function to calculate the system state derivative for a state vector with a size known at compile time
+    /*!
+     *  Function to calculate the system state derivative for a state vector with a size known at compile time (e.g. 6 for
+     *  the translational dynamics of a single body). Using this function as the state derivative function of the numerical
+     *  integrator allows all operations inside the integrator to be performed on fixed-size vectors. The state
+     *  derivative models themselves still operate on dynamic-size types: the state is passed to
+     *  computeStateDerivativeInPlace directly, and the state derivative is computed in a preallocated buffer, which is
+     *  copied to the returned vector, so that no heap allocations are performed by this function.
+     *  \param time Current time.
+     *  \param state Current complete state (must not include variational equations).
+     *  \return Calculated state derivative.
+     */
+    template< int NumberOfRows >
+    Eigen::Matrix< StateScalarType, NumberOfRows, 1 > computeFixedSizeStateDerivative(
+            const TimeType time, const Eigen::Matrix< StateScalarType, NumberOfRows, 1 >& state )
+    {
+        computeStateDerivativeInPlace( time, state, stateVectorDerivativeBuffer_ );
+        return stateVectorDerivativeBuffer_;
+    }
+
+    //! Function to calculate the system state derivative of a state vector, writing the result into an existing vector
+    /*!
+     *  Function to calculate the system state derivative for a state vector (with a size known at compile time, or
+     *  Eigen::Dynamic), writing the result into the provided vector. This function is set as the in-place state
+     *  derivative function of the numerical integrator by the dynamics simulator, so that the integrator can write the
+     *  state derivatives into its preallocated buffers. The state is passed to computeStateDerivativeInPlace directly.
+     *  The state derivative is computed in a preallocated buffer and then copied to stateDerivative, since the state
+     *  derivative models write their result into a block of a StateType (dynamic-size matrix) object. No heap
+     *  allocations are performed by this function once the buffer (and stateDerivative) have the size of the state.
+     *  \param time Current time.
+     *  \param state Current complete state (must not include variational equations).
+     *  \param stateDerivative Calculated state derivative (returned by reference; resized if required).
+     */
+    template< int NumberOfRows >
+    void computeStateVectorDerivativeInPlace(
+            const TimeType time, const Eigen::Matrix< StateScalarType, NumberOfRows, 1 >& state,
+            Eigen::Matrix< StateScalarType, NumberOfRows, 1 >& stateDerivative )
+    {
+        computeStateDerivativeInPlace( time, state, stateVectorDerivativeBuffer_ );
+        stateDerivative = stateVectorDerivativeBuffer_;
     }
 
     //! Function to calculate the system state derivative with double precision, regardless of template arguments
@@ -337,6 +375,34 @@ public:
         }
     }
 
+    //! Function to convert a state history from propagator-specific form to the conventional form.
+    /*!
+     * Function to convert a state history from propagator-specific form to the conventional form
+     * (not necessarily in inertial frame), with both histories stored in contiguous memory.
+     * \sa DynamicsStateDerivativeModel::convertToOutputSolution
+     * \param convertedSolution State history (rawSolution), converted to the 'conventional form' (by reference)
+     * \param rawSolution State history in propagator-specific form (i.e. form that is used in
+     *        numerical integration).
+     */
+    void convertNumericalStateSolutionsToOutputSolutions(
+            SolutionHistory< TimeType, StateScalarType >& convertedSolution,
+            const SolutionHistory< TimeType, StateScalarType >& rawSolution )
+    {
+        convertedSolution.clear( );
+        convertedSolution.reserve( rawSolution.getNumberOfEntries( ) );
+
+        // Iterate over all times.
+        Eigen::Matrix< StateScalarType, Eigen::Dynamic, 1 > currentRawState;
+        for( unsigned int i = 0; i < rawSolution.getNumberOfEntries( ); i++ )
+        {
+            // Convert solution at this time to output (Cartesian with propagation origin frame for
+            // translational dynamics) solution
+            currentRawState = rawSolution.getEntries( ).col( i );
+            convertedSolution.addEntry(
+                        rawSolution.getTime( i ), convertToOutputSolution( currentRawState, rawSolution.getTime( i ) ) );
+        }
+    }
+
     //! Function to add variational equations to the state derivative model
     /*!
      * Function to add variational equations to the state derivative model.
@@ -347,6 +413,16 @@ public:
         variationalEquations_ = variationalEquations;
     }
 
+    //! Function to retrieve the variational equations of the state derivative model
+    /*!
+     * Function to retrieve the variational equations of the state derivative model
+     * \return Object used for computing the state derivative in the variational equations (NULL if none)
+     */
+    boost::shared_ptr< VariationalEquations > getVariationalEquations( )
+    {
+        return variationalEquations_;
+    }
+
 
     //! Function to set which segments of the full state to propagate
     /*!
@@ -448,6 +524,44 @@ public:
 
 private:
 
+    //! Function to create the flat list of state derivative models and associated indices and work buffers.
+    /*!
+     * Function to create the flat list of state derivative models, in the order in which they are evaluated, with the
+     * associated indices in the full state vector and in the per-type state in conventional form, as well as the work
+     * buffers used to pass the current state to each model. This evaluation plan is created once, upon construction, so
+     * that no iteration over maps and no (re)allocation of memory is required when evaluating the state derivative.
+     */
+    void createStateDerivativeEvaluationPlan( )
+    {
+        stateDerivativeModelList_.clear( );
+        stateIndicesList_.clear( );
+        conventionalStateStartIndices_.clear( );
+        conventionalStatesOfModels_.clear( );
+        currentModelStates_.clear( );
+
+        for( stateDerivativeModelsIterator_ = stateDerivativeModels_.begin( );
+             stateDerivativeModelsIterator_ != stateDerivativeModels_.end( );
+             stateDerivativeModelsIterator_++ )
+        {
+            int currentStateTypeSize = 0;
+            for( unsigned int i = 0; i < stateDerivativeModelsIterator_->second.size( ); i++ )
+            {
+                std::pair< int, int > currentIndices = stateIndices_.at( stateDerivativeModelsIterator_->first ).at( i );
+
+                stateDerivativeModelList_.push_back( stateDerivativeModelsIterator_->second.at( i ) );
+                stateIndicesList_.push_back( currentIndices );
+                conventionalStateStartIndices_.push_back( currentStateTypeSize );
+                conventionalStatesOfModels_.push_back(
+                            &currentStatesPerTypeInConventionalRepresentation_.at( stateDerivativeModelsIterator_->first ) );
+                currentModelStates_.push_back(
+                            Eigen::Matrix< StateScalarType, Eigen::Dynamic, 1 >::Zero( currentIndices.second ) );
+
+                currentStateTypeSize += currentIndices.second;
+            }
+        }
+        numberOfStateDerivativeModels_ = stateDerivativeModelList_.size( );
+    }
+
     //! Function to convert the to the conventional form in the global frame per dynamics type.
     /*!
      * Function to convert the propagator-specific form of the state to the conventional form in the global frame, split
@@ -462,8 +576,10 @@ private:
      * \param stateIncludesVariationalState Boolean defining whether the stae includes the state transition/sensitivity
      * matrices
      */
+    template< typename StateDerivedType >
     void convertCurrentStateToGlobalRepresentationPerType(
-            const StateType& state, const TimeType& time, const bool stateIncludesVariationalState )
+            const Eigen::MatrixBase< StateDerivedType >& state, const TimeType& time,
+            const bool stateIncludesVariationalState )
     {
         int startColumn = 0;
         if( stateIncludesVariationalState )
@@ -475,43 +591,22 @@ private:
             startColumn = 0;
         }
 
-        std::pair< int, int > currentIndices;
-
-        // Iterate over all state derivative models
-        for( stateDerivativeModelsIterator_ = stateDerivativeModels_.begin( );
-             stateDerivativeModelsIterator_ != stateDerivativeModels_.end( );
-             stateDerivativeModelsIterator_++ )
+        // Iterate over all state derivative models, and set current block in split state (in global form)
+        for( unsigned int i = 0; i < numberOfStateDerivativeModels_; i++ )
         {
-            int currentStateTypeSize = 0;
-
-            // Iterate over all state derivative models of current type
-            for( unsigned int i = 0; i < stateDerivativeModelsIterator_->second.size( ); i++ )
-            {
-                // Get state block indices of current state derivative model
-                currentIndices = stateIndices_.at( stateDerivativeModelsIterator_->first ).at( i );
-
-//                std::cout << "Pre-converted state: " << state.block( currentIndices.first, startColumn, currentIndices.second, 1 ).transpose( ) << std::endl;
-
-                // Set current block in split state (in global form)
-                stateDerivativeModelsIterator_->second.at( i )->convertCurrentStateToGlobalRepresentation(
-                            state.block( currentIndices.first, startColumn, currentIndices.second, 1 ), time,
-                            currentStatesPerTypeInConventionalRepresentation_.at(
-                                stateDerivativeModelsIterator_->first ).block(
-                                currentStateTypeSize, 0, currentIndices.second, 1 ) );
-
-//                std::cout << "Converted state: " << currentStatesPerTypeInConventionalRepresentation_.at(
-//                               stateDerivativeModelsIterator_->first ).block(
-//                               currentStateTypeSize, 0, currentIndices.second, 1 ).transpose( ) << std::endl;
-
-                currentStateTypeSize += currentIndices.second;
-            }
+            currentModelStates_[ i ] = state.block(
+                        stateIndicesList_[ i ].first, startColumn, stateIndicesList_[ i ].second, 1 );
+            stateDerivativeModelList_[ i ]->convertCurrentStateToGlobalRepresentation(
+                        currentModelStates_[ i ], time,
+                        conventionalStatesOfModels_[ i ]->block(
+                            conventionalStateStartIndices_[ i ], 0, stateIndicesList_[ i ].second, 1 ) );
         }
     }
 
     boost::function<
     void( const TimeType, const std::unordered_map< IntegratedStateType,
           Eigen::Matrix< StateScalarType, Eigen::Dynamic, 1 > >&,
-          const std::vector< IntegratedStateType > ) > environmentUpdateFunction_;
+          const std::vector< IntegratedStateType >& ) > environmentUpdateFunction_;
 
     //! Object used for computing the state derivative in the variational equations
     boost::shared_ptr< VariationalEquations > variationalEquations_;
@@ -534,6 +629,25 @@ private:
     typename std::unordered_map< IntegratedStateType, std::vector< boost::shared_ptr
     < SingleStateTypeDerivative< StateScalarType, TimeType > > > >::iterator stateDerivativeModelsIterator_;
 
+    //! Flat list of state derivative models, in the order in which they are evaluated.
+    std::vector< boost::shared_ptr< SingleStateTypeDerivative< StateScalarType, TimeType > > > stateDerivativeModelList_;
+
+    //! Start index and size of the state of each entry of stateDerivativeModelList_ in the full state vector.
+    std::vector< std::pair< int, int > > stateIndicesList_;
+
+    //! Start index of the state of each entry of stateDerivativeModelList_ in the associated entry of
+    //! currentStatesPerTypeInConventionalRepresentation_.
+    std::vector< int > conventionalStateStartIndices_;
+
+    //! Entry of currentStatesPerTypeInConventionalRepresentation_ associated with each entry of stateDerivativeModelList_
+    std::vector< Eigen::Matrix< StateScalarType, Eigen::Dynamic, 1 >* > conventionalStatesOfModels_;
+
+    //! Work buffers with the current propagated state of each entry of stateDerivativeModelList_.
+    std::vector< Eigen::Matrix< StateScalarType, Eigen::Dynamic, 1 > > currentModelStates_;
+
+    //! Number of entries in stateDerivativeModelList_.
+    unsigned int numberOfStateDerivativeModels_;
+
     //! Total length of state vector.
     int totalStateSize_;
 
@@ -554,10 +668,17 @@ private:
     //! Current state derivative, as computed by computeStateDerivative.
     StateType stateDerivative_;
 
+    //! Buffer for current state derivative, as used by computeFixedSizeStateDerivative and
+    //! computeStateVectorDerivativeInPlace.
+    StateType stateVectorDerivativeBuffer_;
+
     //! Current state in 'conventional' representation, computed from current propagated state by
     //! convertCurrentStateToGlobalRepresentationPerType
     std::unordered_map< IntegratedStateType, Eigen::Matrix< StateScalarType, Eigen::Dynamic, 1 > >
     currentStatesPerTypeInConventionalRepresentation_;
+
+    //! Empty list of states per type, passed to environment update function if dynamical equations are not evaluated.
+    std::unordered_map< IntegratedStateType, Eigen::Matrix< StateScalarType, Eigen::Dynamic, 1 > > emptyStatesPerType_;
 };
 
 //! Function to retrieve a single given acceleration model from a list of models
@@ -22,6 +22,7 @@
 #include "Tudat/Astrodynamics/BasicAstrodynamics/timeConversions.h"
 #include "Tudat/Basics/timeType.h"
 #include "Tudat/Astrodynamics/Propagators/singleStateTypeDerivative.h"
+#include "Tudat/Astrodynamics/Propagators/solutionHistory.h"
 #include "Tudat/Mathematics/NumericalIntegrators/createNumericalIntegrator.h"
 #include "Tudat/Mathematics/Interpolators/lagrangeInterpolator.h"
 #include "Tudat/SimulationSetup/PropagationSetup/propagationTermination.h"
@@ -39,12 +40,11 @@ namespace propagators
  *  \param integrator Numerical integrator used for propagation
  *  \param initialTimeStep Time step to use for first step of numerical integration
  *  \param stopPropagationFunction Function determining whether the propagation is to be stopped at the current time.
- *  \param solutionHistory History of dependent variables that are to be saved given as map
- *  (time as key; returned by reference)
- *  \param dependentVariableHistory History of dependent variables that are to be saved given as map
- *  (time as key; returned by reference)
- *  \param cummulativeComputationTimeHistory History of cummulative computation times that are to be saved given
- *  as map (time as key; returned by reference)
+ *  \param solutionHistory History of numerical states, stored in contiguous memory (returned by reference)
+ *  \param dependentVariableHistory History of dependent variables that are to be saved, stored in contiguous memory
+ *  (returned by reference)
+ *  \param cummulativeComputationTimeHistory History of cummulative computation times that are to be saved, stored in
+ *  contiguous memory (returned by reference)
  *  \param dependentVariableFunction Function returning dependent variables (obtained from environment and state
  *  derivative model).
  *  \param saveFrequency Frequency at which to save the numerical integrated states (in units of i.e. per n integration time
@@ -52,6 +52,11 @@ namespace propagators
  *  \param printInterval Frequency with which to print progress to console (nan = never).
  *  \param initialClockTime Initial clock time from which to determine cummulative computation time.
  *  By default now(), i.e. the moment at which this function is called.
+ *  \param savedStepFunction Function called for each saved epoch (including the initial epoch), with the epoch, the
+ *  numerical state and the dependent variables (empty if dependentVariableFunction is empty) as input. By default none.
+ *  \param saveSolutionHistory Boolean denoting whether the full histories are to be retained. If false, each history
+ *  only contains its last entry, so that the memory use is independent of the number of steps (in which case the
+ *  output is to be processed through savedStepFunction).
  *  \return Event that triggered the termination of the propagation
  */
 template< typename StateType = Eigen::MatrixXd, typename TimeType = double, typename TimeStepType = TimeType  >
@@ -59,14 +64,17 @@ PropagationTerminationReason integrateEquationsFromIntegrator(
         const boost::shared_ptr< numerical_integrators::NumericalIntegrator< TimeType, StateType, StateType, TimeStepType > > integrator,
         const TimeStepType initialTimeStep,
         const boost::function< bool( const double, const double ) > stopPropagationFunction,
-        std::map< TimeType, StateType >& solutionHistory,
-        std::map< TimeType, Eigen::VectorXd >& dependentVariableHistory,
-        std::map< TimeType, double >& cummulativeComputationTimeHistory,
+        SolutionHistory< TimeType, typename StateType::Scalar >& solutionHistory,
+        SolutionHistory< TimeType, double >& dependentVariableHistory,
+        SolutionHistory< TimeType, double >& cummulativeComputationTimeHistory,
         const boost::function< Eigen::VectorXd( ) > dependentVariableFunction =
         boost::function< Eigen::VectorXd( ) >( ),
         const int saveFrequency = TUDAT_NAN,
         const TimeType printInterval = TUDAT_NAN,
-        const std::chrono::steady_clock::time_point initialClockTime = std::chrono::steady_clock::now( ) )
+        const std::chrono::steady_clock::time_point initialClockTime = std::chrono::steady_clock::now( ),
+        const boost::function< void( const TimeType, const StateType&, const Eigen::VectorXd& ) > savedStepFunction =
+        boost::function< void( const TimeType, const StateType&, const Eigen::VectorXd& ) >( ),
+        const bool saveSolutionHistory = true )
 {
     PropagationTerminationReason propagationTerminationReason;
 
@@ -77,20 +85,27 @@ PropagationTerminationReason integrateEquationsFromIntegrator(
 
     // Initialization of numerical solutions for variational equations
     solutionHistory.clear( );
-    solutionHistory[ currentTime ] = newState;
+    solutionHistory.addEntry( currentTime, newState );
 
     dependentVariableHistory.clear( );
+    Eigen::VectorXd currentDependentVariables;
     if( !dependentVariableFunction.empty( ) )
     {
         integrator->getStateDerivativeFunction( )( currentTime, newState );
-        dependentVariableHistory[ currentTime ] = dependentVariableFunction( );
+        currentDependentVariables = dependentVariableFunction( );
+        dependentVariableHistory.addEntry( currentTime, currentDependentVariables );
+    }
+
+    if( !savedStepFunction.empty( ) )
+    {
+        savedStepFunction( currentTime, newState, currentDependentVariables );
     }
 
     // CPU time
     cummulativeComputationTimeHistory.clear( );
     double currentCPUTime = std::chrono::duration_cast< std::chrono::nanoseconds >(
                 std::chrono::steady_clock::now( ) - initialClockTime ).count() * 1.0e-9;
-    cummulativeComputationTimeHistory[ currentTime ] = currentCPUTime;
+    cummulativeComputationTimeHistory.addEntry( currentTime, currentCPUTime );
 
 
     // Set initial time step and total integration time.
@@ -129,17 +144,30 @@ PropagationTerminationReason integrateEquationsFromIntegrator(
                 currentTime = integrator->getCurrentIndependentVariable( );
                 timeStep = integrator->getNextStepSize( );
 
-                // Save integration result in map
+                // Save integration result
                 saveIndex++;
                 saveIndex = saveIndex % saveFrequency;
                 if( saveIndex == 0 )
                 {
-                    solutionHistory[ currentTime ] = newState;
+                    // Only retain last entry if full history is not to be saved (allocated memory is reused).
+                    if( !saveSolutionHistory )
+                    {
+                        solutionHistory.clear( );
+                        dependentVariableHistory.clear( );
+                    }
+
+                    solutionHistory.addEntry( currentTime, newState );
 
                     if( !dependentVariableFunction.empty( ) )
                     {
                         integrator->getStateDerivativeFunction( )( currentTime, newState );
-                        dependentVariableHistory[ currentTime ] = dependentVariableFunction( );
+                        currentDependentVariables = dependentVariableFunction( );
+                        dependentVariableHistory.addEntry( currentTime, currentDependentVariables );
+                    }
+
+                    if( !savedStepFunction.empty( ) )
+                    {
+                        savedStepFunction( currentTime, newState, currentDependentVariables );
                     }
                 }
             }
@@ -154,7 +182,11 @@ PropagationTerminationReason integrateEquationsFromIntegrator(
 
             currentCPUTime = std::chrono::duration_cast< std::chrono::nanoseconds >(
                         std::chrono::steady_clock::now( ) - initialClockTime ).count() * 1.0e-9;
-            cummulativeComputationTimeHistory[ currentTime ] = currentCPUTime;
+            if( !saveSolutionHistory )
+            {
+                cummulativeComputationTimeHistory.clear( );
+            }
+            cummulativeComputationTimeHistory.addEntry( currentTime, currentCPUTime );
 
 
             // Print solutions
@@ -191,6 +223,58 @@ PropagationTerminationReason integrateEquationsFromIntegrator(
     return propagationTerminationReason;
 }
 
+//! Function to numerically integrate a given first order differential equation, with results stored in maps
+/*!
+ *  Function to numerically integrate a given first order differential equation, with the state derivative a function of
+ *  a single independent variable and the current state, with the results provided as maps (see function with
+ *  SolutionHistory output for details).
+ *  \param integrator Numerical integrator used for propagation
+ *  \param initialTimeStep Time step to use for first step of numerical integration
+ *  \param stopPropagationFunction Function determining whether the propagation is to be stopped at the current time.
+ *  \param solutionHistory History of numerical states given as map (time as key; returned by reference)
+ *  \param dependentVariableHistory History of dependent variables that are to be saved given as map
+ *  (time as key; returned by reference)
+ *  \param cummulativeComputationTimeHistory History of cummulative computation times that are to be saved given
+ *  as map (time as key; returned by reference)
+ *  \param dependentVariableFunction Function returning dependent variables (obtained from environment and state
+ *  derivative model).
+ *  \param saveFrequency Frequency at which to save the numerical integrated states (in units of i.e. per n integration time
+ *  steps, with n = saveFrequency).
+ *  \param printInterval Frequency with which to print progress to console (nan = never).
+ *  \param initialClockTime Initial clock time from which to determine cummulative computation time.
+ *  By default now(), i.e. the moment at which this function is called.
+ *  \return Event that triggered the termination of the propagation
+ */
+template< typename StateType = Eigen::MatrixXd, typename TimeType = double, typename TimeStepType = TimeType  >
+PropagationTerminationReason integrateEquationsFromIntegrator(
+        const boost::shared_ptr< numerical_integrators::NumericalIntegrator< TimeType, StateType, StateType, TimeStepType > > integrator,
+        const TimeStepType initialTimeStep,
+        const boost::function< bool( const double, const double ) > stopPropagationFunction,
+        std::map< TimeType, StateType >& solutionHistory,
+        std::map< TimeType, Eigen::VectorXd >& dependentVariableHistory,
+        std::map< TimeType, double >& cummulativeComputationTimeHistory,
+        const boost::function< Eigen::VectorXd( ) > dependentVariableFunction =
+        boost::function< Eigen::VectorXd( ) >( ),
+        const int saveFrequency = TUDAT_NAN,
+        const TimeType printInterval = TUDAT_NAN,
+        const std::chrono::steady_clock::time_point initialClockTime = std::chrono::steady_clock::now( ) )
+{
+    SolutionHistory< TimeType, typename StateType::Scalar > contiguousSolutionHistory;
+    SolutionHistory< TimeType, double > contiguousDependentVariableHistory;
+    SolutionHistory< TimeType, double > contiguousComputationTimeHistory;
+
+    PropagationTerminationReason propagationTerminationReason = integrateEquationsFromIntegrator< StateType, TimeType, TimeStepType >(
+                integrator, initialTimeStep, stopPropagationFunction, contiguousSolutionHistory,
+                contiguousDependentVariableHistory, contiguousComputationTimeHistory, dependentVariableFunction,
+                saveFrequency, printInterval, initialClockTime );
+
+    contiguousSolutionHistory.convertToMap( solutionHistory );
+    contiguousDependentVariableHistory.convertToMap( dependentVariableHistory );
+    contiguousComputationTimeHistory.convertToMap( cummulativeComputationTimeHistory );
+
+    return propagationTerminationReason;
+}
+
 
 //! Interface class for integrating some state derivative function.
 /*!
@@ -235,7 +319,54 @@ public:
             const boost::function< Eigen::VectorXd( ) > dependentVariableFunction =
             boost::function< Eigen::VectorXd( ) >( ),
             const TimeType printInterval = TUDAT_NAN,
-            const std::chrono::steady_clock::time_point initialClockTime = std::chrono::steady_clock::now( ) );
+            const std::chrono::steady_clock::time_point initialClockTime = std::chrono::steady_clock::now( ),
+            const boost::function< void( const TimeType, const StateType&, const Eigen::VectorXd& ) >
+            savedStepFunction = boost::function< void( const TimeType, const StateType&, const Eigen::VectorXd& ) >( ),
+            const bool saveSolutionHistory = true );
+
+    //! Function to numerically integrate a given first order differential equation, with results in contiguous memory
+    /*!
+     *  Function to numerically integrate a given first order differential equation, with the state derivative a function of
+     *  a single independent variable and the current state. The results are stored in SolutionHistory objects, which
+     *  store all results in contiguous memory.
+     *  \param stateDerivativeFunction Function returning the state derivative from current time and state.
+     *  \param solutionHistory History of numerical states (returned by reference)
+     *  \param initialState Initial state
+     *  \param integratorSettings Settings for numerical integrator.
+     *  \param stopPropagationFunction Function determining whether the propagation is to be stopped at the current time.
+     *  \param dependentVariableHistory History of dependent variables that are to be saved (returned by reference)
+     *  \param cummulativeComputationTimeHistory History of cummulative computation times that are to be saved
+     *  (returned by reference)
+     *  \param dependentVariableFunction Function returning dependent variables (obtained from environment and state
+     *  derivative model).
+     *  \param printInterval Frequency with which to print progress to console (nan = never).
+     *  \param initialClockTime Initial clock time from which to determine cummulative computation time.
+     *  By default now(), i.e. the moment at which this function is called.
+     *  \param savedStepFunction Function called for each saved epoch, with the epoch, the numerical state and the
+     *  dependent variables as input (none by default).
+     *  \param saveSolutionHistory Boolean denoting whether the full histories are to be retained (if false, only the
+     *  last entry is retained).
+     *  \param inPlaceStateDerivativeFunction Function computing the same state derivative as stateDerivativeFunction,
+     *  but writing it into an existing object, to be used by the integrator if supported (none by default).
+     *  \return Event that triggered the termination of the propagation
+     */
+    static PropagationTerminationReason integrateEquations(
+            boost::function< StateType( const TimeType, const StateType& ) > stateDerivativeFunction,
+            SolutionHistory< TimeType, typename StateType::Scalar >& solutionHistory,
+            const StateType initialState,
+            const boost::shared_ptr< numerical_integrators::IntegratorSettings< TimeType > > integratorSettings,
+            const boost::function< bool( const double, const double ) > stopPropagationFunction,
+            SolutionHistory< TimeType, double >& dependentVariableHistory,
+            SolutionHistory< TimeType, double >& cummulativeComputationTimeHistory,
+            const boost::function< Eigen::VectorXd( ) > dependentVariableFunction =
+            boost::function< Eigen::VectorXd( ) >( ),
+            const TimeType printInterval = TUDAT_NAN,
+            const std::chrono::steady_clock::time_point initialClockTime = std::chrono::steady_clock::now( ),
+            const boost::function< void( const TimeType, const StateType&, const Eigen::VectorXd& ) >
+            savedStepFunction = boost::function< void( const TimeType, const StateType&, const Eigen::VectorXd& ) >( ),
+            const bool saveSolutionHistory = true,
+            const boost::function< void( const TimeType, const StateType&, StateType& ) > inPlaceStateDerivativeFunction =
+            boost::function< void( const TimeType, const StateType&, StateType& ) >( ) );
 };
 
 //! Interface class for integrating some state derivative function.
@@ -276,11 +407,71 @@ public:
             boost::function< Eigen::VectorXd( ) >( ),
             const double printInterval = TUDAT_NAN,
             const std::chrono::steady_clock::time_point initialClockTime = std::chrono::steady_clock::now( ) )
+    {
+        SolutionHistory< double, typename StateType::Scalar > contiguousSolutionHistory;
+        SolutionHistory< double, double > contiguousDependentVariableHistory;
+        SolutionHistory< double, double > contiguousComputationTimeHistory;
+
+        PropagationTerminationReason propagationTerminationReason = integrateEquations(
+                    stateDerivativeFunction, contiguousSolutionHistory, initialState, integratorSettings,
+                    stopPropagationFunction, contiguousDependentVariableHistory, contiguousComputationTimeHistory,
+                    dependentVariableFunction, printInterval, initialClockTime );
+
+        contiguousSolutionHistory.convertToMap( solutionHistory );
+        contiguousDependentVariableHistory.convertToMap( dependentVariableHistory );
+        contiguousComputationTimeHistory.convertToMap( cummulativeComputationTimeHistory );
+
+        return propagationTerminationReason;
+    }
+
+    //! Function to numerically integrate a given first order differential equation, with results in contiguous memory
+    /*!
+     *  Function to numerically integrate a given first order differential equation, with the state derivative a function of
+     *  a single independent variable and the current state. The results are stored in SolutionHistory objects, which
+     *  store all results in contiguous memory.
+     *  \param stateDerivativeFunction Function returning the state derivative from current time and state.
+     *  \param solutionHistory History of numerical states (returned by reference)
+     *  \param initialState Initial state
+     *  \param integratorSettings Settings for numerical integrator.
+     *  \param stopPropagationFunction Function determining whether the propagation is to be stopped at the current time.
+     *  \param dependentVariableHistory History of dependent variables that are to be saved (returned by reference)
+     *  \param cummulativeComputationTimeHistory History of cummulative computation times that are to be saved
+     *  (returned by reference)
+     *  \param dependentVariableFunction Function returning dependent variables (obtained from environment and state
+     *  derivative model).
+     *  \param printInterval Frequency with which to print progress to console (nan = never).
+     *  \param initialClockTime Initial clock time from which to determine cummulative computation time.
+     *  By default now(), i.e. the moment at which this function is called.
+     *  \param savedStepFunction Function called for each saved epoch, with the epoch, the numerical state and the
+     *  dependent variables as input (none by default).
+     *  \param saveSolutionHistory Boolean denoting whether the full histories are to be retained (if false, only the
+     *  last entry is retained).
+     *  \param inPlaceStateDerivativeFunction Function computing the same state derivative as stateDerivativeFunction,
+     *  but writing it into an existing object, to be used by the integrator if supported (none by default).
+     *  \return Event that triggered the termination of the propagation
+     */
+    static PropagationTerminationReason integrateEquations(
+            boost::function< StateType( const double, const StateType& ) > stateDerivativeFunction,
+            SolutionHistory< double, typename StateType::Scalar >& solutionHistory,
+            const StateType initialState,
+            const boost::shared_ptr< numerical_integrators::IntegratorSettings< double > > integratorSettings,
+            const boost::function< bool( const double, const double ) > stopPropagationFunction,
+            SolutionHistory< double, double >& dependentVariableHistory,
+            SolutionHistory< double, double >& cummulativeComputationTimeHistory,
+            const boost::function< Eigen::VectorXd( ) > dependentVariableFunction =
+            boost::function< Eigen::VectorXd( ) >( ),
+            const double printInterval = TUDAT_NAN,
+            const std::chrono::steady_clock::time_point initialClockTime = std::chrono::steady_clock::now( ),
+            const boost::function< void( const double, const StateType&, const Eigen::VectorXd& ) >
+            savedStepFunction = boost::function< void( const double, const StateType&, const Eigen::VectorXd& ) >( ),
+            const bool saveSolutionHistory = true,
+            const boost::function< void( const double, const StateType&, StateType& ) > inPlaceStateDerivativeFunction =
+            boost::function< void( const double, const StateType&, StateType& ) >( ) )
     {
         // Create numerical integrator.
         boost::shared_ptr< numerical_integrators::NumericalIntegrator< double, StateType, StateType > > integrator =
                 numerical_integrators::createIntegrator< double, StateType >(
-                    stateDerivativeFunction, initialState, integratorSettings );
+                    stateDerivativeFunction, initialState, integratorSettings, inPlaceStateDerivativeFunction );
 
         if ( integratorSettings->assessPropagationTerminationConditionDuringIntegrationSubsteps_ )
         {
@@ -294,7 +485,9 @@ public:
                     dependentVariableFunction,
                     integratorSettings->saveFrequency_,
                     printInterval,
-                    initialClockTime );
+                    initialClockTime,
+                    savedStepFunction,
+                    saveSolutionHistory );
     }
 };
 
@@ -336,11 +529,71 @@ public:
             boost::function< Eigen::VectorXd( ) >( ),
             const Time printInterval = TUDAT_NAN,
             const std::chrono::steady_clock::time_point initialClockTime = std::chrono::steady_clock::now( ) )
+    {
+        SolutionHistory< Time, typename StateType::Scalar > contiguousSolutionHistory;
+        SolutionHistory< Time, double > contiguousDependentVariableHistory;
+        SolutionHistory< Time, double > contiguousComputationTimeHistory;
+
+        PropagationTerminationReason propagationTerminationReason = integrateEquations(
+                    stateDerivativeFunction, contiguousSolutionHistory, initialState, integratorSettings,
+                    stopPropagationFunction, contiguousDependentVariableHistory, contiguousComputationTimeHistory,
+                    dependentVariableFunction, printInterval, initialClockTime );
+
+        contiguousSolutionHistory.convertToMap( solutionHistory );
+        contiguousDependentVariableHistory.convertToMap( dependentVariableHistory );
+        contiguousComputationTimeHistory.convertToMap( cummulativeComputationTimeHistory );
+
+        return propagationTerminationReason;
+    }
+
+    //! Function to numerically integrate a given first order differential equation, with results in contiguous memory
+    /*!
+     *  Function to numerically integrate a given first order differential equation, with the state derivative a function of
+     *  a single independent variable and the current state. The results are stored in SolutionHistory objects, which
+     *  store all results in contiguous memory.
+     *  \param stateDerivativeFunction Function returning the state derivative from current time and state.
+     *  \param solutionHistory History of numerical states (returned by reference)
+     *  \param initialState Initial state
+     *  \param integratorSettings Settings for numerical integrator.
+     *  \param stopPropagationFunction Function determining whether the propagation is to be stopped at the current time.
+     *  \param dependentVariableHistory History of dependent variables that are to be saved (returned by reference)
+     *  \param cummulativeComputationTimeHistory History of cummulative computation times that are to be saved
+     *  (returned by reference)
+     *  \param dependentVariableFunction Function returning dependent variables (obtained from environment and state
+     *  derivative model).
+     *  \param printInterval Frequency with which to print progress to console (nan = never).
+     *  \param initialClockTime Initial clock time from which to determine cummulative computation time.
+     *  By default now(), i.e. the moment at which this function is called.
+     *  \param savedStepFunction Function called for each saved epoch, with the epoch, the numerical state and the
+     *  dependent variables as input (none by default).
+     *  \param saveSolutionHistory Boolean denoting whether the full histories are to be retained (if false, only the
+     *  last entry is retained).
+     *  \param inPlaceStateDerivativeFunction Function computing the same state derivative as stateDerivativeFunction,
+     *  but writing it into an existing object, to be used by the integrator if supported (none by default).
+     *  \return Event that triggered the termination of the propagation
+     */
+    static PropagationTerminationReason integrateEquations(
+            boost::function< StateType( const Time, const StateType& ) > stateDerivativeFunction,
+            SolutionHistory< Time, typename StateType::Scalar >& solutionHistory,
+            const StateType initialState,
+            const boost::shared_ptr< numerical_integrators::IntegratorSettings< Time > > integratorSettings,
+            const boost::function< bool( const double, const double ) > stopPropagationFunction,
+            SolutionHistory< Time, double >& dependentVariableHistory,
+            SolutionHistory< Time, double >& cummulativeComputationTimeHistory,
+            const boost::function< Eigen::VectorXd( ) > dependentVariableFunction =
+            boost::function< Eigen::VectorXd( ) >( ),
+            const Time printInterval = TUDAT_NAN,
+            const std::chrono::steady_clock::time_point initialClockTime = std::chrono::steady_clock::now( ),
+            const boost::function< void( const Time, const StateType&, const Eigen::VectorXd& ) >
+            savedStepFunction = boost::function< void( const Time, const StateType&, const Eigen::VectorXd& ) >( ),
+            const bool saveSolutionHistory = true,
+            const boost::function< void( const Time, const StateType&, StateType& ) > inPlaceStateDerivativeFunction =
+            boost::function< void( const Time, const StateType&, StateType& ) >( ) )
     {
         // Create numerical integrator.
         boost::shared_ptr< numerical_integrators::NumericalIntegrator< Time, StateType, StateType, long double > > integrator =
                 numerical_integrators::createIntegrator< Time, StateType, long double  >(
-                    stateDerivativeFunction, initialState, integratorSettings );
+                    stateDerivativeFunction, initialState, integratorSettings, inPlaceStateDerivativeFunction );
 
         if ( integratorSettings->assessPropagationTerminationConditionDuringIntegrationSubsteps_ )
         {
@@ -354,7 +607,9 @@ public:
                     dependentVariableFunction,
                     integratorSettings->saveFrequency_,
                     printInterval,
-                    initialClockTime );
+                    initialClockTime,
+                    savedStepFunction,
+                    saveSolutionHistory );
     }
 };
 
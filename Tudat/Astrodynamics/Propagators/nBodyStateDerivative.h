@@ -208,11 +208,20 @@ public:
             const Eigen::Matrix< StateScalarType, Eigen::Dynamic, 1 >& internalSolution, const TimeType& time,
             Eigen::Block< Eigen::Matrix< StateScalarType, Eigen::Dynamic, 1 > > currentCartesianLocalSoluton )
     {
-        this->convertToOutputSolution( internalSolution, time, currentCartesianLocalSoluton );
+        // Copy states to work buffers of required type, to prevent creation of temporaries.
+        internalSolutionBuffer_ = internalSolution;
+        if( localSolutionBuffer_.rows( ) != internalSolution.rows( ) )
+        {
+            localSolutionBuffer_.resize( internalSolution.rows( ) );
+        }
+
+        this->convertToOutputSolution(
+                    internalSolutionBuffer_, time, localSolutionBuffer_.block( 0, 0, internalSolution.rows( ), 1 ) );
 
         centralBodyData_->getReferenceFrameOriginInertialStates(
-                    currentCartesianLocalSoluton, time, centralBodyStatesWrtGlobalOrigin_, true );
+                    localSolutionBuffer_, time, centralBodyStatesWrtGlobalOrigin_, true );
 
+        currentCartesianLocalSoluton = localSolutionBuffer_;
         for( unsigned int i = 0; i < centralBodyStatesWrtGlobalOrigin_.size( ); i++ )
         {
             currentCartesianLocalSoluton.segment( i * 6, 6 ) += centralBodyStatesWrtGlobalOrigin_[ i ];
@@ -440,6 +449,12 @@ protected:
 
     //! List of states of teh central bodies of the propagated bodies.
     std::vector< Eigen::Matrix< StateScalarType, 6, 1 >  > centralBodyStatesWrtGlobalOrigin_;
+
+    //! Work buffer for propagated state in convertCurrentStateToGlobalRepresentation
+    Eigen::Matrix< StateScalarType, Eigen::Dynamic, Eigen::Dynamic > internalSolutionBuffer_;
+
+    //! Work buffer for state in conventional form (local frame) in convertCurrentStateToGlobalRepresentation
+    Eigen::Matrix< StateScalarType, Eigen::Dynamic, 1 > localSolutionBuffer_;
 };
 
 } // namespace propagators
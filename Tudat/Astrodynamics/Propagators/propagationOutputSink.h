@@ -0,0 +1,364 @@
+/*    Copyright (c) 2010-2017, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ */
+
+#ifndef TUDAT_PROPAGATIONOUTPUTSINK_H
+#define TUDAT_PROPAGATIONOUTPUTSINK_H
+
+#include <cmath>
+#include <map>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include <boost/function.hpp>
+#include <boost/make_shared.hpp>
+#include <boost/shared_ptr.hpp>
+
+#include <Eigen/Core>
+
+#include "Tudat/InputOutput/binaryDataFile.h"
+
+namespace tudat
+{
+
+namespace propagators
+{
+
+//! Base class for objects that process the output of a propagation while it is being produced.
+/*!
+ *  Base class for objects that process the output of a propagation (state and dependent variables at each saved epoch)
+ *  while it is being produced, e.g. to write it to a file, downsample it, or reduce it to statistics. When such a sink
+ *  is used, the state and dependent variable histories need not be retained in memory during the propagation (see
+ *  SingleArcPropagatorSettings::resetOutputSink). The initialize function is called before the propagation is started,
+ *  the processOutput function once for each saved epoch (including the initial epoch), and the finalize function once
+ *  the propagation is terminated.
+ */
+template< typename StateScalarType = double >
+class PropagationOutputSink
+{
+public:
+
+    //! Virtual destructor.
+    virtual ~PropagationOutputSink( ){ }
+
+    //! Function called before the start of the propagation.
+    /*!
+     *  Function called before the start of the propagation (default does nothing).
+     *  \param stateSize Size of the (output) state vector.
+     *  \param dependentVariablesSize Size of the dependent variable vector (0 if no dependent variables are saved).
+     *  \param dependentVariableIds Map listing starting entry of dependent variables in dependent variable vector,
+     *  along with associated ID.
+     */
+    virtual void initialize( const unsigned int stateSize, const unsigned int dependentVariablesSize,
+                             const std::map< int, std::string >& dependentVariableIds ){ }
+
+    //! Function called for each saved epoch of the propagation.
+    /*!
+     *  Function called for each saved epoch of the propagation.
+     *  \param time Epoch at which the output is valid.
+     *  \param state State at the given epoch, in the conventional form (\sa
+     *  SingleStateTypeDerivative::convertToOutputSolution).
+     *  \param dependentVariables Dependent variables at the given epoch (empty if no dependent variables are saved).
+     */
+    virtual void processOutput( const double time, const Eigen::Matrix< StateScalarType, Eigen::Dynamic, 1 >& state,
+                                const Eigen::VectorXd& dependentVariables ) = 0;
+
+    //! Function called once the propagation is terminated.
+    /*!
+     *  Function called once the propagation is terminated (default does nothing).
+     */
+    virtual void finalize( ){ }
+};
+
+//! Propagation output sink that passes each saved epoch to a user-defined function.
+template< typename StateScalarType = double >
+class FunctionPropagationOutputSink: public PropagationOutputSink< StateScalarType >
+{
+public:
+
+    //! Typedef for function processing the output at a single epoch.
+    typedef boost::function< void( const double, const Eigen::Matrix< StateScalarType, Eigen::Dynamic, 1 >&,
+                                   const Eigen::VectorXd& ) > OutputFunction;
+
+    //! Constructor.
+    /*!
+     *  Constructor.
+     *  \param outputFunction Function called for each saved epoch, with epoch, state and dependent variables as input.
+     *  \param finalizationFunction Function called once the propagation is terminated (none by default).
+     */
+    FunctionPropagationOutputSink( const OutputFunction outputFunction,
+                                   const boost::function< void( ) > finalizationFunction =
+            boost::function< void( ) >( ) ):
+        outputFunction_( outputFunction ), finalizationFunction_( finalizationFunction ){ }
+
+    //! Function called for each saved epoch of the propagation, passes the output to outputFunction_.
+    /*!
+     *  Function called for each saved epoch of the propagation, passes the output to outputFunction_.
+     *  \param time Epoch at which the output is valid.
+     *  \param state State at the given epoch.
+     *  \param dependentVariables Dependent variables at the given epoch.
+     */
+    void processOutput( const double time, const Eigen::Matrix< StateScalarType, Eigen::Dynamic, 1 >& state,
+                        const Eigen::VectorXd& dependentVariables )
+    {
+        outputFunction_( time, state, dependentVariables );
+    }
+
+    //! Function called once the propagation is terminated, calls finalizationFunction_ (if any).
+    void finalize( )
+    {
+        if( !finalizationFunction_.empty( ) )
+        {
+            finalizationFunction_( );
+        }
+    }
+
+private:
+
+    //! Function called for each saved epoch.
+    OutputFunction outputFunction_;
+
+    //! Function called once the propagation is terminated.
+    boost::function< void( ) > finalizationFunction_;
+};
+
+//! Propagation output sink that forwards a downsampled output to another sink.
+/*!
+ *  Propagation output sink that forwards a downsampled output to another sink: an epoch is only forwarded if it is at
+ *  least a given interval after the last forwarded epoch. The first and last epochs of the propagation are always
+ *  forwarded.
+ */
+template< typename StateScalarType = double >
+class DownsamplingPropagationOutputSink: public PropagationOutputSink< StateScalarType >
+{
+public:
+
+    //! Constructor.
+    /*!
+     *  Constructor.
+     *  \param outputSink Sink to which the downsampled output is forwarded.
+     *  \param minimumOutputInterval Minimum (absolute) time interval between two forwarded epochs.
+     */
+    DownsamplingPropagationOutputSink(
+            const boost::shared_ptr< PropagationOutputSink< StateScalarType > > outputSink,
+            const double minimumOutputInterval ):
+        outputSink_( outputSink ), minimumOutputInterval_( minimumOutputInterval ),
+        isFirstOutput_( true ), isLastOutputForwarded_( true ){ }
+
+    //! Function called before the start of the propagation, initializes the downsampled sink.
+    /*!
+     *  Function called before the start of the propagation, initializes the downsampled sink.
+     *  \param stateSize Size of the (output) state vector.
+     *  \param dependentVariablesSize Size of the dependent variable vector.
+     *  \param dependentVariableIds Map listing starting entry of dependent variables in dependent variable vector,
+     *  along with associated ID.
+     */
+    void initialize( const unsigned int stateSize, const unsigned int dependentVariablesSize,
+                     const std::map< int, std::string >& dependentVariableIds )
+    {
+        isFirstOutput_ = true;
+        isLastOutputForwarded_ = true;
+        outputSink_->initialize( stateSize, dependentVariablesSize, dependentVariableIds );
+    }
+
+    //! Function called for each saved epoch of the propagation, forwards the output if required.
+    /*!
+     *  Function called for each saved epoch of the propagation, forwards the output if it is the first output, or if it
+     *  is at least minimumOutputInterval_ after the last forwarded output. Otherwise, the output is stored, so that it
+     *  can be forwarded when the propagation is terminated.
+     *  \param time Epoch at which the output is valid.
+     *  \param state State at the given epoch.
+     *  \param dependentVariables Dependent variables at the given epoch.
+     */
+    void processOutput( const double time, const Eigen::Matrix< StateScalarType, Eigen::Dynamic, 1 >& state,
+                        const Eigen::VectorXd& dependentVariables )
+    {
+        if( isFirstOutput_ || !( std::fabs( time - lastForwardedTime_ ) < minimumOutputInterval_ ) )
+        {
+            outputSink_->processOutput( time, state, dependentVariables );
+            lastForwardedTime_ = time;
+            isFirstOutput_ = false;
+            isLastOutputForwarded_ = true;
+        }
+        else
+        {
+            lastTime_ = time;
+            lastState_ = state;
+            lastDependentVariables_ = dependentVariables;
+            isLastOutputForwarded_ = false;
+        }
+    }
+
+    //! Function called once the propagation is terminated, forwards final output (if needed) and finalizes the sink.
+    void finalize( )
+    {
+        if( !isLastOutputForwarded_ )
+        {
+            outputSink_->processOutput( lastTime_, lastState_, lastDependentVariables_ );
+            isLastOutputForwarded_ = true;
+        }
+        outputSink_->finalize( );
+    }
+
+private:
+
+    //! Sink to which the downsampled output is forwarded.
+    boost::shared_ptr< PropagationOutputSink< StateScalarType > > outputSink_;
+
+    //! Minimum (absolute) time interval between two forwarded epochs.
+    double minimumOutputInterval_;
+
+    //! Boolean denoting whether no output has been forwarded yet.
+    bool isFirstOutput_;
+
+    //! Boolean denoting whether the last output that was received has been forwarded.
+    bool isLastOutputForwarded_;
+
+    //! Last epoch that was forwarded.
+    double lastForwardedTime_;
+
+    //! Last epoch that was received (if not forwarded).
+    double lastTime_;
+
+    //! Last state that was received (if not forwarded).
+    Eigen::Matrix< StateScalarType, Eigen::Dynamic, 1 > lastState_;
+
+    //! Last dependent variables that were received (if not forwarded).
+    Eigen::VectorXd lastDependentVariables_;
+};
+
+//! Propagation output sink that writes the output to a binary data file.
+/*!
+ *  Propagation output sink that writes the output to a binary data file (see BinaryDataFileWriter), with one row per
+ *  saved epoch, containing the epoch, the state and the dependent variables. The file describes the variables in the
+ *  columns as "epoch", "state" and the dependent variable IDs. The file can be read with readBinaryDataFile, or with
+ *  readDataMapFromBinaryFile to obtain a map with the state and dependent variables as values. If a propagation is not
+ *  finalized (e.g. due to an exception), the file is completed when the sink is reinitialized or destroyed.
+ */
+template< typename StateScalarType = double >
+class BinaryFilePropagationOutputSink: public PropagationOutputSink< StateScalarType >
+{
+public:
+
+    //! Constructor.
+    /*!
+     *  Constructor.
+     *  \param filePath Path of the file that is to be written (overwritten for each propagation).
+     *  \param header Free text header of the file.
+     *  \param writeAsynchronously Boolean denoting whether the file is to be written by a separate thread.
+     */
+    BinaryFilePropagationOutputSink( const std::string& filePath, const std::string& header = "",
+                                     const bool writeAsynchronously = false ):
+        filePath_( filePath ), header_( header ), writeAsynchronously_( writeAsynchronously ){ }
+
+    //! Function called before the start of the propagation, opens the file and writes its header.
+    /*!
+     *  Function called before the start of the propagation, opens the file and writes its header.
+     *  \param stateSize Size of the (output) state vector.
+     *  \param dependentVariablesSize Size of the dependent variable vector.
+     *  \param dependentVariableIds Map listing starting entry of dependent variables in dependent variable vector,
+     *  along with associated ID.
+     */
+    void initialize( const unsigned int stateSize, const unsigned int dependentVariablesSize,
+                     const std::map< int, std::string >& dependentVariableIds )
+    {
+        stateSize_ = stateSize;
+        dependentVariablesSize_ = dependentVariablesSize;
+
+        std::vector< input_output::BinaryDataFileVariable > variables;
+        variables.push_back( input_output::BinaryDataFileVariable( "epoch", 0, 1 ) );
+        variables.push_back( input_output::BinaryDataFileVariable( "state", 1, stateSize ) );
+
+        // Determine size of each dependent variable from start index of next variable.
+        for( std::map< int, std::string >::const_iterator variableIterator = dependentVariableIds.begin( );
+             variableIterator != dependentVariableIds.end( ); variableIterator++ )
+        {
+            std::map< int, std::string >::const_iterator nextVariableIterator = variableIterator;
+            nextVariableIterator++;
+            const int variableEnd = ( nextVariableIterator == dependentVariableIds.end( ) ) ?
+                        static_cast< int >( dependentVariablesSize ) : nextVariableIterator->first;
+            variables.push_back( input_output::BinaryDataFileVariable(
+                                     variableIterator->second, 1 + stateSize + variableIterator->first,
+                                     variableEnd - variableIterator->first ) );
+        }
+
+        fileWriter_.reset( );
+        fileWriter_ = boost::make_shared< input_output::BinaryDataFileWriter >(
+                    filePath_, 1 + stateSize + dependentVariablesSize, variables, header_, writeAsynchronously_ );
+        currentRow_.resize( 1 + stateSize + dependentVariablesSize );
+    }
+
+    //! Function called for each saved epoch of the propagation, adds the output as a row to the file.
+    /*!
+     *  Function called for each saved epoch of the propagation, adds the output as a row to the file.
+     *  \param time Epoch at which the output is valid.
+     *  \param state State at the given epoch.
+     *  \param dependentVariables Dependent variables at the given epoch.
+     */
+    void processOutput( const double time, const Eigen::Matrix< StateScalarType, Eigen::Dynamic, 1 >& state,
+                        const Eigen::VectorXd& dependentVariables )
+    {
+        if( fileWriter_ == NULL )
+        {
+            throw std::runtime_error( "Error when writing propagation output to " + filePath_ +
+                                      ", output sink not initialized" );
+        }
+        if( static_cast< unsigned int >( state.rows( ) ) != stateSize_ ||
+                static_cast< unsigned int >( dependentVariables.rows( ) ) != dependentVariablesSize_ )
+        {
+            throw std::runtime_error( "Error when writing propagation output to " + filePath_ +
+                                      ", output is of inconsistent size" );
+        }
+
+        currentRow_( 0 ) = time;
+        currentRow_.segment( 1, stateSize_ ) = state.template cast< double >( );
+        currentRow_.segment( 1 + stateSize_, dependentVariablesSize_ ) = dependentVariables;
+        fileWriter_->addRow( currentRow_ );
+    }
+
+    //! Function called once the propagation is terminated, completes and closes the file.
+    void finalize( )
+    {
+        if( fileWriter_ != NULL )
+        {
+            fileWriter_->close( );
+            fileWriter_.reset( );
+        }
+    }
+
+private:
+
+    //! Path of the file that is written.
+    std::string filePath_;
+
+    //! Free text header of the file.
+    std::string header_;
+
+    //! Boolean denoting whether the file is to be written by a separate thread.
+    bool writeAsynchronously_;
+
+    //! Size of the (output) state vector.
+    unsigned int stateSize_;
+
+    //! Size of the dependent variable vector.
+    unsigned int dependentVariablesSize_;
+
+    //! Object writing the file during the propagation (null if no propagation is in progress).
+    boost::shared_ptr< input_output::BinaryDataFileWriter > fileWriter_;
+
+    //! Pre-allocated row that is written to the file.
+    Eigen::VectorXd currentRow_;
+};
+
+} // namespace propagators
+
+} // namespace tudat
+
+#endif // TUDAT_PROPAGATIONOUTPUTSINK_H
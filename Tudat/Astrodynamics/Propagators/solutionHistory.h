@@ -0,0 +1,366 @@
+/*    Copyright (c) 2010-2017, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ */
+
+#ifndef TUDAT_SOLUTIONHISTORY_H
+#define TUDAT_SOLUTIONHISTORY_H
+
+#include <algorithm>
+#include <map>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include <Eigen/Core>
+
+namespace tudat
+{
+
+namespace propagators
+{
+
+//! Class to convert an entry of a SolutionHistory to a given type.
+/*!
+ *  Class to convert an entry of a SolutionHistory to a given type (an Eigen vector or matrix type).
+ */
+template< typename StateType, typename StateScalarType >
+struct SolutionHistoryEntryConverter
+{
+    //! Function to convert an entry of a SolutionHistory to the requested type
+    static StateType convertEntry(
+            const Eigen::Map< const Eigen::Matrix< StateScalarType, Eigen::Dynamic, Eigen::Dynamic > >& entry )
+    {
+        return StateType( entry );
+    }
+};
+
+//! Class to convert an entry of a SolutionHistory to a scalar (for histories of scalars).
+template< typename StateScalarType >
+struct SolutionHistoryEntryConverter< StateScalarType, StateScalarType >
+{
+    //! Function to convert an entry of a SolutionHistory to a scalar
+    static StateScalarType convertEntry(
+            const Eigen::Map< const Eigen::Matrix< StateScalarType, Eigen::Dynamic, Eigen::Dynamic > >& entry )
+    {
+        return entry( 0, 0 );
+    }
+};
+
+//! Class to store the history of a (numerically integrated) time-dependent vector or matrix in contiguous memory.
+/*!
+ *  Class to store the history of a (numerically integrated) time-dependent vector or matrix, such as the solution of a
+ *  numerical integration, a dependent variable history or a computation time history. As opposed to a
+ *  std::map< TimeType, Eigen::Matrix >, all times are stored in a single contiguous vector, and all entries are stored
+ *  in a single contiguous matrix (one column per entry, with matrix-valued entries stored in column-major order). The
+ *  storage grows geometrically, so that adding an entry has amortized constant cost and requires no heap allocation for
+ *  most entries.
+ *  Entries are stored in the order in which they are added, which must be monotonic in time (e.g. increasing for forward
+ *  propagation, decreasing for backward propagation). If an entry is added at the same time as the last entry, the last
+ *  entry is overwritten, consistent with the behaviour of the map-based history.
+ *  The template parameter TimeType denotes the type of the independent variable, StateScalarType the scalar type of the
+ *  stored entries.
+ */
+template< typename TimeType = double, typename StateScalarType = double >
+class SolutionHistory
+{
+public:
+
+    //! Typedef for the matrix in which the entries are stored.
+    typedef Eigen::Matrix< StateScalarType, Eigen::Dynamic, Eigen::Dynamic > EntryMatrix;
+
+    //! Constructor, creates an empty history.
+    SolutionHistory( ):
+        numberOfRows_( 0 ), numberOfColumns_( 0 ), numberOfEntries_( 0 ), reservedNumberOfEntries_( 0 ){ }
+
+    //! Constructor from map-based history.
+    /*!
+     *  Constructor from map-based history, entries are stored in order of increasing time.
+     *  \param dataMap History of vectors/matrices, with time as key.
+     */
+    template< typename StateType >
+    SolutionHistory( const std::map< TimeType, StateType >& dataMap ):
+        numberOfRows_( 0 ), numberOfColumns_( 0 ), numberOfEntries_( 0 ), reservedNumberOfEntries_( 0 )
+    {
+        resetFromMap( dataMap );
+    }
+
+    //! Function to remove all entries from the history.
+    /*!
+     *  Function to remove all entries from the history. The memory that is allocated for the entries is retained, so that
+     *  a subsequent propagation of the same size does not require any new allocations.
+     */
+    void clear( )
+    {
+        times_.clear( );
+        numberOfEntries_ = 0;
+    }
+
+    //! Function to reserve memory for a given number of entries.
+    /*!
+     *  Function to reserve memory for a given number of entries. If the size of the entries is not yet known (no entries
+     *  have been added yet), the memory for the entries is allocated when the first entry is added.
+     *  \param numberOfEntries Number of entries for which memory is to be reserved.
+     */
+    void reserve( const unsigned int numberOfEntries )
+    {
+        reservedNumberOfEntries_ = numberOfEntries;
+        times_.reserve( numberOfEntries );
+        if( getEntrySize( ) > 0 && static_cast< unsigned int >( values_.cols( ) ) < numberOfEntries )
+        {
+            values_.conservativeResize( getEntrySize( ), numberOfEntries );
+        }
+    }
+
+    //! Function to add an entry at the end of the history.
+    /*!
+     *  Function to add an entry at the end of the history. If the time is equal to the time of the last entry, the last
+     *  entry is overwritten. The size of the entry must be equal to the size of all previous entries (since last clear).
+     *  \param time Time at which the entry is valid.
+     *  \param entry Vector or matrix that is to be stored.
+     */
+    template< typename Derived >
+    void addEntry( const TimeType& time, const Eigen::MatrixBase< Derived >& entry )
+    {
+        // Set entry size from first entry, and check consistency of subsequent entries.
+        if( numberOfEntries_ == 0 )
+        {
+            if( entry.rows( ) != numberOfRows_ || entry.cols( ) != numberOfColumns_ )
+            {
+                numberOfRows_ = entry.rows( );
+                numberOfColumns_ = entry.cols( );
+                values_.resize( getEntrySize( ), std::max( reservedNumberOfEntries_, getMinimumCapacity( ) ) );
+            }
+        }
+        else if( entry.rows( ) != numberOfRows_ || entry.cols( ) != numberOfColumns_ )
+        {
+            throw std::runtime_error( "Error when adding entry to solution history, size of entry (" +
+                                      std::to_string( entry.rows( ) ) + "x" + std::to_string( entry.cols( ) ) +
+                                      ") is inconsistent with history (" + std::to_string( numberOfRows_ ) + "x" +
+                                      std::to_string( numberOfColumns_ ) + ")" );
+        }
+
+        // Overwrite last entry if time is unchanged, else append.
+        if( !( numberOfEntries_ > 0 && times_.back( ) == time ) )
+        {
+            if( numberOfEntries_ == static_cast< unsigned int >( values_.cols( ) ) )
+            {
+                values_.conservativeResize( Eigen::NoChange, std::max( 2 * numberOfEntries_, getMinimumCapacity( ) ) );
+            }
+            times_.push_back( time );
+            numberOfEntries_++;
+        }
+
+        Eigen::Map< EntryMatrix >( values_.col( numberOfEntries_ - 1 ).data( ), numberOfRows_, numberOfColumns_ ) = entry;
+    }
+
+    //! Function to add a scalar entry at the end of the history.
+    /*!
+     *  Function to add a scalar entry at the end of the history (stored as 1x1 matrix), see templated addEntry function.
+     *  \param time Time at which the entry is valid.
+     *  \param entry Scalar that is to be stored.
+     */
+    void addEntry( const TimeType& time, const StateScalarType entry )
+    {
+        addEntry( time, Eigen::Matrix< StateScalarType, 1, 1 >::Constant( entry ) );
+    }
+
+    //! Function to retrieve the number of entries in the history
+    /*!
+     *  Function to retrieve the number of entries in the history
+     *  \return Number of entries in the history
+     */
+    unsigned int getNumberOfEntries( ) const
+    {
+        return numberOfEntries_;
+    }
+
+    //! Function to retrieve whether the history is empty
+    /*!
+     *  Function to retrieve whether the history is empty
+     *  \return True if the history contains no entries.
+     */
+    bool empty( ) const
+    {
+        return ( numberOfEntries_ == 0 );
+    }
+
+    //! Function to retrieve the number of rows of each entry
+    /*!
+     *  Function to retrieve the number of rows of each entry
+     *  \return Number of rows of each entry
+     */
+    int getNumberOfRows( ) const
+    {
+        return numberOfRows_;
+    }
+
+    //! Function to retrieve the number of columns of each entry
+    /*!
+     *  Function to retrieve the number of columns of each entry
+     *  \return Number of columns of each entry
+     */
+    int getNumberOfColumns( ) const
+    {
+        return numberOfColumns_;
+    }
+
+    //! Function to retrieve the times of all entries
+    /*!
+     *  Function to retrieve the times of all entries, in the order in which they were added.
+     *  \return Times of all entries
+     */
+    const std::vector< TimeType >& getTimes( ) const
+    {
+        return times_;
+    }
+
+    //! Function to retrieve the time of a single entry
+    /*!
+     *  Function to retrieve the time of a single entry
+     *  \param index Index of entry
+     *  \return Time of entry
+     */
+    const TimeType& getTime( const unsigned int index ) const
+    {
+        return times_[ index ];
+    }
+
+    //! Function to retrieve a single entry (without copying)
+    /*!
+     *  Function to retrieve a single entry, as a (read-only) view on the contiguous storage.
+     *  \param index Index of entry
+     *  \return Entry with given index
+     */
+    Eigen::Map< const EntryMatrix > getEntry( const unsigned int index ) const
+    {
+        return Eigen::Map< const EntryMatrix >( values_.col( index ).data( ), numberOfRows_, numberOfColumns_ );
+    }
+
+    //! Function to retrieve all entries (without copying)
+    /*!
+     *  Function to retrieve all entries, as a (read-only) view on the contiguous storage. Each column contains a single
+     *  entry (matrix-valued entries are stored in column-major order).
+     *  \return Matrix with all entries, with one entry per column.
+     */
+    typename EntryMatrix::ConstColsBlockXpr getEntries( ) const
+    {
+        return values_.leftCols( numberOfEntries_ );
+    }
+
+    //! Function to retrieve whether the times of the entries are in increasing order
+    /*!
+     *  Function to retrieve whether the times of the entries are in increasing order (i.e. whether the entries result
+     *  from a forward propagation).
+     *  \return True if times of the entries are increasing (or if there are less than two entries).
+     */
+    bool areTimesIncreasing( ) const
+    {
+        return ( numberOfEntries_ < 2 ) || ( times_.front( ) < times_.back( ) );
+    }
+
+    //! Function to retrieve the index of an entry, with entries sorted by increasing time
+    /*!
+     *  Function to retrieve the index of an entry, with entries sorted by increasing time, allowing histories from forward
+     *  and backward propagations to be processed in the same manner.
+     *  \param sortedIndex Index of entry in list of entries sorted by increasing time
+     *  \return Index of entry in history
+     */
+    unsigned int getIndexInIncreasingTimeOrder( const unsigned int sortedIndex ) const
+    {
+        return areTimesIncreasing( ) ? sortedIndex : ( numberOfEntries_ - 1 - sortedIndex );
+    }
+
+    //! Function to retrieve the history as a map
+    /*!
+     *  Function to retrieve the history as a map, with time as key (adapter for map-based interfaces).
+     *  \param dataMap History as map (returned by reference; existing contents are removed).
+     */
+    template< typename StateType >
+    void convertToMap( std::map< TimeType, StateType >& dataMap ) const
+    {
+        dataMap.clear( );
+        typename std::map< TimeType, StateType >::iterator hintIterator = dataMap.end( );
+        for( unsigned int i = 0; i < numberOfEntries_; i++ )
+        {
+            unsigned int currentIndex = getIndexInIncreasingTimeOrder( i );
+            hintIterator = dataMap.insert( hintIterator, std::make_pair( times_[ currentIndex ],
+                                                                         SolutionHistoryEntryConverter< StateType, StateScalarType >::
+                                                                         convertEntry( getEntry( currentIndex ) ) ) );
+        }
+    }
+
+    //! Function to retrieve the history as a map
+    /*!
+     *  Function to retrieve the history as a map, with time as key (adapter for map-based interfaces).
+     *  \return History as map.
+     */
+    template< typename StateType >
+    std::map< TimeType, StateType > convertToMap( ) const
+    {
+        std::map< TimeType, StateType > dataMap;
+        convertToMap( dataMap );
+        return dataMap;
+    }
+
+    //! Function to reset the history from a map
+    /*!
+     *  Function to reset the history from a map, entries are stored in order of increasing time.
+     *  \param dataMap History of vectors/matrices, with time as key.
+     */
+    template< typename StateType >
+    void resetFromMap( const std::map< TimeType, StateType >& dataMap )
+    {
+        clear( );
+        reserve( dataMap.size( ) );
+        for( typename std::map< TimeType, StateType >::const_iterator dataIterator = dataMap.begin( );
+             dataIterator != dataMap.end( ); dataIterator++ )
+        {
+            addEntry( dataIterator->first, dataIterator->second );
+        }
+    }
+
+private:
+
+    //! Function to retrieve the number of scalar values in a single entry.
+    unsigned int getEntrySize( ) const
+    {
+        return numberOfRows_ * numberOfColumns_;
+    }
+
+    //! Function to retrieve the number of entries for which memory is allocated when the first entry is added.
+    static unsigned int getMinimumCapacity( )
+    {
+        return 64;
+    }
+
+    //! Times of all entries, in the order in which they were added.
+    std::vector< TimeType > times_;
+
+    //! Matrix with all entries (one column per entry), the number of columns is the current capacity of the history.
+    EntryMatrix values_;
+
+    //! Number of rows of each entry
+    int numberOfRows_;
+
+    //! Number of columns of each entry
+    int numberOfColumns_;
+
+    //! Number of entries in the history
+    unsigned int numberOfEntries_;
+
+    //! Number of entries for which memory was reserved by the user.
+    unsigned int reservedNumberOfEntries_;
+
+};
+
+} // namespace propagators
+
+} // namespace tudat
+
+#endif // TUDAT_SOLUTIONHISTORY_H
@@ -18,6 +18,43 @@ namespace tudat
 namespace propagators
 {
 
+//! Function to get the concatenated state transition and sensitivity matrices at a list of times.
+void CombinedStateTransitionAndSensitivityMatrixInterface::getCombinedStateTransitionAndSensitivityMatrices(
+        const std::vector< double >& evaluationTimes,
+        std::vector< Eigen::MatrixXd >& combinedMatrices )
+{
+    combinedMatrices.resize( evaluationTimes.size( ) );
+    for( unsigned int i = 0; i < evaluationTimes.size( ); i++ )
+    {
+        combinedMatrices[ i ] = getCombinedStateTransitionAndSensitivityMatrix( evaluationTimes[ i ] );
+    }
+}
+
+//! Function to create a contiguous matrix history from a list of matrices.
+/*!
+ *  Function to create a contiguous matrix history from a list of matrices, with column i of the history containing the
+ *  (column-major) entries of the i^th matrix.
+ *  \param matrices List of matrices (all of equal size) from which the history is to be created.
+ *  \param numberOfRows Required number of rows of each matrix.
+ *  \param numberOfColumns Required number of columns of each matrix.
+ *  \return Contiguous matrix history.
+ */
+Eigen::MatrixXd createContiguousMatrixHistory(
+        const std::vector< Eigen::MatrixXd >& matrices, const int numberOfRows, const int numberOfColumns )
+{
+    Eigen::MatrixXd matrixHistory = Eigen::MatrixXd( numberOfRows * numberOfColumns, matrices.size( ) );
+    for( unsigned int i = 0; i < matrices.size( ); i++ )
+    {
+        if( matrices.at( i ).rows( ) != numberOfRows || matrices.at( i ).cols( ) != numberOfColumns )
+        {
+            throw std::runtime_error( "Error when creating contiguous matrix history, matrix size is inconsistent" );
+        }
+        matrixHistory.col( i ) = Eigen::Map< const Eigen::VectorXd >(
+                    matrices.at( i ).data( ), numberOfRows * numberOfColumns );
+    }
+    return matrixHistory;
+}
+
 //! Function to reset the state transition and sensitivity matrix interpolators
 void SingleArcCombinedStateTransitionAndSensitivityMatrixInterface::updateMatrixInterpolators(
         const boost::shared_ptr< interpolators::OneDimensionalInterpolator< double, Eigen::MatrixXd > >
@@ -27,6 +64,54 @@ void SingleArcCombinedStateTransitionAndSensitivityMatrixInterface::updateMatrix
 {
     stateTransitionMatrixInterpolator_ = stateTransitionMatrixInterpolator;
     sensitivityMatrixInterpolator_ = sensitivityMatrixInterpolator;
+
+    // Clear contiguous matrix histories of previous interpolators.
+    areMatrixHistoriesSet_ = false;
+    stateTransitionMatrixLagrangeInterpolator_.reset( );
+    sensitivityMatrixLagrangeInterpolator_.reset( );
+    stateTransitionMatrixHistory_.resize( 0, 0 );
+    sensitivityMatrixHistory_.resize( 0, 0 );
+}
+
+//! Function to create the contiguous state transition and sensitivity matrix histories.
+void SingleArcCombinedStateTransitionAndSensitivityMatrixInterface::createContiguousMatrixHistories( )
+{
+    stateTransitionMatrixLagrangeInterpolator_ =
+            boost::dynamic_pointer_cast< interpolators::LagrangeInterpolator< double, Eigen::MatrixXd > >(
+                stateTransitionMatrixInterpolator_ );
+    if( stateTransitionMatrixLagrangeInterpolator_ != NULL )
+    {
+        stateTransitionMatrixHistory_ = createContiguousMatrixHistory(
+                    stateTransitionMatrixLagrangeInterpolator_->getDependentValues( ),
+                    stateTransitionMatrixSize_, stateTransitionMatrixSize_ );
+    }
+
+    if( sensitivityMatrixSize_ > 0 )
+    {
+        sensitivityMatrixLagrangeInterpolator_ =
+                boost::dynamic_pointer_cast< interpolators::LagrangeInterpolator< double, Eigen::MatrixXd > >(
+                    sensitivityMatrixInterpolator_ );
+        if( sensitivityMatrixLagrangeInterpolator_ != NULL )
+        {
+            sensitivityMatrixHistory_ = createContiguousMatrixHistory(
+                        sensitivityMatrixLagrangeInterpolator_->getDependentValues( ),
+                        stateTransitionMatrixSize_, sensitivityMatrixSize_ );
+        }
+    }
+
+    // Check if Lagrange weights of state transition matrix can be reused for sensitivity matrix.
+    useStateTransitionWeightsForSensitivity_ =
+            ( stateTransitionMatrixLagrangeInterpolator_ != NULL && sensitivityMatrixLagrangeInterpolator_ != NULL );
+    if( useStateTransitionWeightsForSensitivity_ )
+    {
+        useStateTransitionWeightsForSensitivity_ =
+                ( stateTransitionMatrixLagrangeInterpolator_->getNumberOfStages( ) ==
+                  sensitivityMatrixLagrangeInterpolator_->getNumberOfStages( ) ) &&
+                ( stateTransitionMatrixLagrangeInterpolator_->getIndependentValues( ) ==
+                  sensitivityMatrixLagrangeInterpolator_->getIndependentValues( ) );
+    }
+
+    areMatrixHistoriesSet_ = true;
 }
 
 //! Function to get the concatenated state transition and sensitivity matrix at a given time.
@@ -48,6 +133,107 @@ Eigen::MatrixXd SingleArcCombinedStateTransitionAndSensitivityMatrixInterface::g
     return combinedStateTransitionMatrix_;
 }
 
+//! Function to get the concatenated state transition and sensitivity matrix at a given time, using caller-owned hints.
+Eigen::MatrixXd SingleArcCombinedStateTransitionAndSensitivityMatrixInterface::getFullCombinedStateTransitionAndSensitivityMatrix(
+        const double evaluationTime, StateTransitionMatrixLookupHints& lookupHints )
+{
+    Eigen::MatrixXd combinedStateTransitionMatrix = Eigen::MatrixXd::Zero(
+                stateTransitionMatrixSize_, stateTransitionMatrixSize_ + sensitivityMatrixSize_ );
+
+    // Set Phi and S matrices.
+    combinedStateTransitionMatrix.block( 0, 0, stateTransitionMatrixSize_, stateTransitionMatrixSize_ ) =
+            stateTransitionMatrixInterpolator_->interpolate(
+                evaluationTime, lookupHints.stateTransitionMatrixNearestLowerIndex_ );
+
+    if( sensitivityMatrixSize_ > 0 )
+    {
+        combinedStateTransitionMatrix.block( 0, stateTransitionMatrixSize_, stateTransitionMatrixSize_, sensitivityMatrixSize_ )=
+                sensitivityMatrixInterpolator_->interpolate( evaluationTime, lookupHints.sensitivityMatrixNearestLowerIndex_ );
+    }
+
+    return combinedStateTransitionMatrix;
+}
+
+//! Function to get the concatenated state transition and sensitivity matrices at a list of times.
+void SingleArcCombinedStateTransitionAndSensitivityMatrixInterface::getCombinedStateTransitionAndSensitivityMatrices(
+        const std::vector< double >& evaluationTimes,
+        std::vector< Eigen::MatrixXd >& combinedMatrices )
+{
+    if( !areMatrixHistoriesSet_ )
+    {
+        createContiguousMatrixHistories( );
+    }
+
+    const int numberOfStateTransitionMatrixEntries = stateTransitionMatrixSize_ * stateTransitionMatrixSize_;
+    const int numberOfSensitivityMatrixEntries = stateTransitionMatrixSize_ * sensitivityMatrixSize_;
+
+    // Declare lookup hints and Lagrange weights, which are reused for all times.
+    int stateTransitionNearestLowerIndex = -1, sensitivityNearestLowerIndex = -1, directNearestLowerIndex = -1;
+    int stateTransitionFirstDataPoint = 0, sensitivityFirstDataPoint = 0;
+    Eigen::VectorXd stateTransitionWeights, sensitivityWeights;
+    bool areStateTransitionWeightsComputed;
+
+    combinedMatrices.resize( evaluationTimes.size( ) );
+    for( unsigned int i = 0; i < evaluationTimes.size( ); i++ )
+    {
+        Eigen::MatrixXd& currentMatrix = combinedMatrices[ i ];
+        if( currentMatrix.rows( ) != stateTransitionMatrixSize_ ||
+                currentMatrix.cols( ) != stateTransitionMatrixSize_ + sensitivityMatrixSize_ )
+        {
+            currentMatrix.resize( stateTransitionMatrixSize_, stateTransitionMatrixSize_ + sensitivityMatrixSize_ );
+        }
+
+        // Set Phi matrix, from contiguous history if Lagrange weights are available.
+        areStateTransitionWeightsComputed = false;
+        if( stateTransitionMatrixLagrangeInterpolator_ != NULL )
+        {
+            areStateTransitionWeightsComputed = stateTransitionMatrixLagrangeInterpolator_->computeInterpolationWeights(
+                        evaluationTimes[ i ], stateTransitionNearestLowerIndex, stateTransitionFirstDataPoint,
+                        stateTransitionWeights );
+        }
+
+        if( areStateTransitionWeightsComputed )
+        {
+            Eigen::Map< Eigen::VectorXd >( currentMatrix.data( ), numberOfStateTransitionMatrixEntries ).noalias( ) =
+                    stateTransitionMatrixHistory_.middleCols(
+                        stateTransitionFirstDataPoint, stateTransitionWeights.rows( ) ) * stateTransitionWeights;
+        }
+        else
+        {
+            directNearestLowerIndex = -1;
+            currentMatrix.leftCols( stateTransitionMatrixSize_ ) =
+                    stateTransitionMatrixInterpolator_->interpolate( evaluationTimes[ i ], directNearestLowerIndex );
+        }
+
+        // Set S matrix, reusing Lagrange weights of Phi matrix if possible.
+        if( sensitivityMatrixSize_ > 0 )
+        {
+            Eigen::Map< Eigen::VectorXd > sensitivityMatrixEntries(
+                        currentMatrix.data( ) + numberOfStateTransitionMatrixEntries,
+                        numberOfSensitivityMatrixEntries );
+            if( useStateTransitionWeightsForSensitivity_ && areStateTransitionWeightsComputed )
+            {
+                sensitivityMatrixEntries.noalias( ) = sensitivityMatrixHistory_.middleCols(
+                            stateTransitionFirstDataPoint, stateTransitionWeights.rows( ) ) * stateTransitionWeights;
+            }
+            else if( sensitivityMatrixLagrangeInterpolator_ != NULL &&
+                     sensitivityMatrixLagrangeInterpolator_->computeInterpolationWeights(
+                         evaluationTimes[ i ], sensitivityNearestLowerIndex, sensitivityFirstDataPoint,
+                         sensitivityWeights ) )
+            {
+                sensitivityMatrixEntries.noalias( ) = sensitivityMatrixHistory_.middleCols(
+                            sensitivityFirstDataPoint, sensitivityWeights.rows( ) ) * sensitivityWeights;
+            }
+            else
+            {
+                directNearestLowerIndex = -1;
+                currentMatrix.rightCols( sensitivityMatrixSize_ ) =
+                        sensitivityMatrixInterpolator_->interpolate( evaluationTimes[ i ], directNearestLowerIndex );
+            }
+        }
+    }
+}
+
 //! Constructor
 MultiArcCombinedStateTransitionAndSensitivityMatrixInterface::MultiArcCombinedStateTransitionAndSensitivityMatrixInterface(
         const std::vector< boost::shared_ptr< interpolators::OneDimensionalInterpolator< double, Eigen::MatrixXd > > >
@@ -141,6 +327,35 @@ Eigen::MatrixXd MultiArcCombinedStateTransitionAndSensitivityMatrixInterface::ge
     return combinedStateTransitionMatrix;
 }
 
+//! Function to get the concatenated state transition matrices for each arc and sensitivity matrix at a given time,
+//! using caller-owned hints.
+Eigen::MatrixXd MultiArcCombinedStateTransitionAndSensitivityMatrixInterface::getFullCombinedStateTransitionAndSensitivityMatrix(
+        const double evaluationTime, StateTransitionMatrixLookupHints& lookupHints )
+{
+    Eigen::MatrixXd combinedStateTransitionMatrix = Eigen::MatrixXd::Zero(
+                stateTransitionMatrixSize_, numberOfStateArcs_ * stateTransitionMatrixSize_ + sensitivityMatrixSize_ );
+
+    // Determine current arc, and reset matrix lookup hints if arc has changed.
+    int previousArc = lookupHints.currentArc_;
+    int currentArc = lookUpscheme_->findNearestLowerNeighbour( evaluationTime, lookupHints.currentArc_ );
+    if( currentArc != previousArc )
+    {
+        lookupHints.stateTransitionMatrixNearestLowerIndex_ = -1;
+        lookupHints.sensitivityMatrixNearestLowerIndex_ = -1;
+    }
+
+    // Set Phi and S matrices of current arc.
+    combinedStateTransitionMatrix.block( 0, currentArc * stateTransitionMatrixSize_, stateTransitionMatrixSize_, stateTransitionMatrixSize_ ) =
+            stateTransitionMatrixInterpolators_.at( currentArc )->interpolate(
+                evaluationTime, lookupHints.stateTransitionMatrixNearestLowerIndex_ );
+    combinedStateTransitionMatrix.block(
+                0, numberOfStateArcs_ * stateTransitionMatrixSize_, stateTransitionMatrixSize_, sensitivityMatrixSize_ ) =
+            sensitivityMatrixInterpolators_.at( currentArc )->interpolate(
+                evaluationTime, lookupHints.sensitivityMatrixNearestLowerIndex_ );
+
+    return combinedStateTransitionMatrix;
+}
+
 }
 
 }
@@ -18,6 +18,7 @@
 #include <Eigen/Core>
 
 #include "Tudat/Mathematics/Interpolators/oneDimensionalInterpolator.h"
+#include "Tudat/Mathematics/Interpolators/lagrangeInterpolator.h"
 
 namespace tudat
 {
@@ -25,6 +26,31 @@ namespace tudat
 namespace propagators
 {
 
+//! Interpolator lookup hints for the state transition and sensitivity matrices, owned by the caller.
+/*!
+ *  Interpolator lookup hints for the state transition and sensitivity matrices, owned by the caller. By using a separate
+ *  object per thread, the matrices of a single CombinedStateTransitionAndSensitivityMatrixInterface may be interpolated
+ *  concurrently from multiple threads.
+ */
+class StateTransitionMatrixLookupHints
+{
+public:
+
+    //! Constructor, initializes all hints to -1 (no previous lookup).
+    StateTransitionMatrixLookupHints( ):
+        currentArc_( -1 ), stateTransitionMatrixNearestLowerIndex_( -1 ), sensitivityMatrixNearestLowerIndex_( -1 )
+    { }
+
+    //! Arc in which previous evaluation time was located (multi-arc only).
+    int currentArc_;
+
+    //! Nearest lower index in state transition matrix interpolator found during previous lookup.
+    int stateTransitionMatrixNearestLowerIndex_;
+
+    //! Nearest lower index in sensitivity matrix interpolator found during previous lookup.
+    int sensitivityMatrixNearestLowerIndex_;
+};
+
 //! Base class for interface object of interpolation of numerically propagated state transition and sensitivity matrices.
 /*!
  *  Base class for interface object of interpolation of numerically propagated state transition and sensitivity matrices.
@@ -71,6 +97,36 @@ public:
      */
     virtual Eigen::MatrixXd getFullCombinedStateTransitionAndSensitivityMatrix( const double evaluationTime ) = 0;
 
+    //! Function to get the concatenated state transition and sensitivity matrix at a given time, which includes
+    //! zero values for parameters not active in current arc, using lookup hints owned by the caller.
+    /*!
+     *  Function to get the concatenated state transition and sensitivity matrix at a given time, which includes
+     *  zero values for parameters not active in current arc (as getFullCombinedStateTransitionAndSensitivityMatrix),
+     *  using interpolator lookup hints owned by the caller. This function does not modify the state of this object or
+     *  its interpolators, and may be called concurrently from multiple threads, provided that each thread uses its own
+     *  lookup hints.
+     *  \param evaluationTime Time at which to evaluate matrix interpolators
+     *  \param lookupHints Lookup hints found during the previous call (updated by this function).
+     *  \return Concatenated state transition and sensitivity matrices, including inactive parameters at
+     *  evaluationTime.
+     */
+    virtual Eigen::MatrixXd getFullCombinedStateTransitionAndSensitivityMatrix(
+            const double evaluationTime, StateTransitionMatrixLookupHints& lookupHints ) = 0;
+
+    //! Function to get the concatenated state transition and sensitivity matrices at a list of times.
+    /*!
+     *  Function to get the concatenated state transition and sensitivity matrices at a list of times, as returned by
+     *  getCombinedStateTransitionAndSensitivityMatrix for each time. In this base class implementation, the matrices
+     *  are evaluated one time at a time; derived classes may override this function with a more efficient
+     *  implementation.
+     *  \param evaluationTimes Times at which to evaluate matrix interpolators (should be sorted in ascending order).
+     *  \param combinedMatrices Concatenated state transition and sensitivity matrices at each of the evaluationTimes
+     *  (returned by reference).
+     */
+    virtual void getCombinedStateTransitionAndSensitivityMatrices(
+            const std::vector< double >& evaluationTimes,
+            std::vector< Eigen::MatrixXd >& combinedMatrices );
+
     //! Function to get the size of state transition matrix
     /*!
      * Function to get the size of state transition matrix
@@ -133,7 +189,8 @@ public:
             const int numberOfParameters ):
         CombinedStateTransitionAndSensitivityMatrixInterface( numberOfInitialDynamicalParameters, numberOfParameters ),
         stateTransitionMatrixInterpolator_( stateTransitionMatrixInterpolator ),
-        sensitivityMatrixInterpolator_( sensitivityMatrixInterpolator )
+        sensitivityMatrixInterpolator_( sensitivityMatrixInterpolator ),
+        areMatrixHistoriesSet_( false ), useStateTransitionWeightsForSensitivity_( false )
     {
         combinedStateTransitionMatrix_ = Eigen::MatrixXd::Zero(
                         stateTransitionMatrixSize_, stateTransitionMatrixSize_ + sensitivityMatrixSize_ );
@@ -195,6 +252,37 @@ public:
         return getCombinedStateTransitionAndSensitivityMatrix( evaluationTime );
     }
 
+    //! Function to get the concatenated state transition and sensitivity matrix at a given time, using lookup hints
+    //! owned by the caller.
+    /*!
+     *  Function to get the concatenated state transition and sensitivity matrix at a given time (as
+     *  getCombinedStateTransitionAndSensitivityMatrix), using interpolator lookup hints owned by the caller, so that
+     *  it may be called concurrently from multiple threads (each with its own hints).
+     *  \param evaluationTime Time at which to evaluate matrix interpolators
+     *  \param lookupHints Lookup hints found during the previous call (updated by this function).
+     *  \return Concatenated state transition and sensitivity matrices.
+     */
+    Eigen::MatrixXd getFullCombinedStateTransitionAndSensitivityMatrix(
+            const double evaluationTime, StateTransitionMatrixLookupHints& lookupHints );
+
+    //! Function to get the concatenated state transition and sensitivity matrices at a list of times.
+    /*!
+     *  Function to get the concatenated state transition and sensitivity matrices at a list of times. For matrices
+     *  interpolated by a LagrangeInterpolator, the Lagrange weights are computed once per time, and are used for all
+     *  matrix entries, by combining the relevant columns of a contiguous copy of the matrix history (with one column
+     *  per matrix) directly into the output matrix. No memory is allocated per time if the entries of
+     *  combinedMatrices are already of the correct size. The contiguous matrix histories are created at the first call
+     *  to this function (after construction or resetting of the interpolators), so that this function should not be
+     *  called concurrently from multiple threads. Times in the boundary regions of the interpolation domain, and
+     *  matrices interpolated by other types of interpolators, are evaluated by the interpolators directly.
+     *  \param evaluationTimes Times at which to evaluate matrix interpolators (should be sorted in ascending order).
+     *  \param combinedMatrices Concatenated state transition and sensitivity matrices at each of the evaluationTimes
+     *  (returned by reference). Existing entries of correct size are overwritten without reallocation.
+     */
+    void getCombinedStateTransitionAndSensitivityMatrices(
+            const std::vector< double >& evaluationTimes,
+            std::vector< Eigen::MatrixXd >& combinedMatrices );
+
     //! Function to get the size of the total parameter vector.
     /*!
      * Function to get the size of the total parameter vector. For single-arc, this is simply the combination of
@@ -212,6 +300,13 @@ private:
     //! Predefined matrix to use as return value when calling getCombinedStateTransitionAndSensitivityMatrix.
     Eigen::MatrixXd combinedStateTransitionMatrix_;
 
+    //! Function to create the contiguous state transition and sensitivity matrix histories.
+    /*!
+     *  Function to create the contiguous state transition and sensitivity matrix histories from the data points of the
+     *  matrix interpolators, for those interpolators that are of type LagrangeInterpolator.
+     */
+    void createContiguousMatrixHistories( );
+
     //! Interpolator returning the state transition matrix as a function of time.
     boost::shared_ptr< interpolators::OneDimensionalInterpolator< double, Eigen::MatrixXd > >
     stateTransitionMatrixInterpolator_;
@@ -219,6 +314,27 @@ private:
     //! Interpolator returning the sensitivity matrix as a function of time.
     boost::shared_ptr< interpolators::OneDimensionalInterpolator< double, Eigen::MatrixXd > >
     sensitivityMatrixInterpolator_;
+
+    //! Boolean denoting whether the contiguous matrix histories have been created for the current interpolators.
+    bool areMatrixHistoriesSet_;
+
+    //! State transition matrix interpolator, cast to LagrangeInterpolator (NULL if of other type).
+    boost::shared_ptr< interpolators::LagrangeInterpolator< double, Eigen::MatrixXd > >
+    stateTransitionMatrixLagrangeInterpolator_;
+
+    //! Sensitivity matrix interpolator, cast to LagrangeInterpolator (NULL if of other type).
+    boost::shared_ptr< interpolators::LagrangeInterpolator< double, Eigen::MatrixXd > >
+    sensitivityMatrixLagrangeInterpolator_;
+
+    //! Contiguous history of state transition matrices, with column i the (column-major) entries of the i^th matrix.
+    Eigen::MatrixXd stateTransitionMatrixHistory_;
+
+    //! Contiguous history of sensitivity matrices, with column i the (column-major) entries of the i^th matrix.
+    Eigen::MatrixXd sensitivityMatrixHistory_;
+
+    //! Boolean denoting whether the state transition and sensitivity matrices are given at the same times (with the
+    //! same number of interpolation stages), so that the Lagrange weights can be reused for the sensitivity matrix.
+    bool useStateTransitionWeightsForSensitivity_;
 };
 
 //! Interface object of interpolation of numerically propagated state transition and sensitivity matrices for multi-arc
@@ -317,6 +433,19 @@ public:
      */
     Eigen::MatrixXd getFullCombinedStateTransitionAndSensitivityMatrix( const double evaluationTime );
 
+    //! Function to get the concatenated state transition matrices for each arc and sensitivity matrix at a given time,
+    //! using lookup hints owned by the caller.
+    /*!
+     *  Function to get the concatenated state transition matrices for each arc and sensitivity matrix at a given time
+     *  (as getFullCombinedStateTransitionAndSensitivityMatrix), using interpolator lookup hints owned by the caller, so
+     *  that it may be called concurrently from multiple threads (each with its own hints).
+     *  \param evaluationTime Time at which to evaluate matrix interpolators
+     *  \param lookupHints Lookup hints found during the previous call (updated by this function).
+     *  \return Concatenated state transition and sensitivity matrices.
+     */
+    Eigen::MatrixXd getFullCombinedStateTransitionAndSensitivityMatrix(
+            const double evaluationTime, StateTransitionMatrixLookupHints& lookupHints );
+
 private:
 
     //! List of interpolators returning the state transition matrix as a function of time.
@@ -8,6 +8,7 @@
  *    http://tudat.tudelft.nl/LICENSE.
  */
 #include <map>
+#include <set>
 
 #include <boost/function.hpp>
 
@@ -26,8 +27,23 @@ namespace propagators
 //! Calculates matrix containing partial derivatives of state derivatives w.r.t. body state.
 void VariationalEquations::setBodyStatePartialMatrix( )
 {
-    // Initialize partial matrix
-    variationalMatrix_.setZero( );
+    // Initialize partial matrix (only blocks that can be non-zero, if sparsity is used)
+    if( !useBlockSparseStatePartials_ )
+    {
+        variationalMatrix_.setZero( );
+    }
+    else
+    {
+        for( unsigned int i = 0; i < nonZeroStatePartialBlocks_.size( ); i++ )
+        {
+            for( unsigned int j = 0; j < nonZeroStatePartialBlocks_.at( i ).size( ); j++ )
+            {
+                const int columnBlock = nonZeroStatePartialBlocks_.at( i ).at( j );
+                variationalMatrix_.block( stateBlockStartIndices_.at( i ), stateBlockStartIndices_.at( columnBlock ),
+                                          stateBlockSizes_.at( i ), stateBlockSizes_.at( columnBlock ) ).setZero( );
+            }
+        }
+    }
 
     if( dynamicalStatesToEstimate_.count( propagators::transational_state ) > 0 )
     {
@@ -175,6 +191,130 @@ void VariationalEquations::setStatePartialFunctionList( )
     }
 }
 
+//! Function (called by constructor) to determine which blocks of the state partial matrix can be non-zero.
+void VariationalEquations::setStatePartialBlockSparsity( )
+{
+    isStatePartialBlockSparsityAvailable_ = false;
+    useBlockSparseStatePartials_ = false;
+
+    // Determine blocks of single-body states, ordered by start index.
+    std::map< int, int > blockSizes;
+    for( std::map< propagators::IntegratedStateType,
+         std::vector< std::pair< std::string, std::string > > >::iterator
+         estimatedStateIterator = dynamicalStatesToEstimate_.begin( );
+         estimatedStateIterator != dynamicalStatesToEstimate_.end( );
+         estimatedStateIterator++ )
+    {
+        if( stateTypeStartIndices_.count( estimatedStateIterator->first ) == 0 )
+        {
+            return;
+        }
+
+        int currentStateSize = getSingleIntegrationSize( estimatedStateIterator->first );
+        for( unsigned int i = 0; i < estimatedStateIterator->second.size( ); i++ )
+        {
+            blockSizes[ stateTypeStartIndices_.at( estimatedStateIterator->first ) + i * currentStateSize ] =
+                    currentStateSize;
+        }
+    }
+
+    // Check that blocks cover full state partial matrix, and set index of block for each start index.
+    stateBlockStartIndices_.clear( );
+    stateBlockSizes_.clear( );
+    std::map< int, int > blockIndices;
+    int currentStartIndex = 0;
+    for( std::map< int, int >::const_iterator blockIterator = blockSizes.begin( );
+         blockIterator != blockSizes.end( ); blockIterator++ )
+    {
+        if( blockIterator->first != currentStartIndex )
+        {
+            return;
+        }
+        blockIndices[ blockIterator->first ] = stateBlockStartIndices_.size( );
+        stateBlockStartIndices_.push_back( blockIterator->first );
+        stateBlockSizes_.push_back( blockIterator->second );
+        currentStartIndex += blockIterator->second;
+    }
+    if( currentStartIndex != totalDynamicalStateSize_ )
+    {
+        return;
+    }
+
+    std::vector< std::set< int > > nonZeroBlocks( stateBlockStartIndices_.size( ) );
+
+    // Add blocks with derivative of position w.r.t. velocity.
+    if( dynamicalStatesToEstimate_.count( propagators::transational_state ) > 0 )
+    {
+        int startIndex = stateTypeStartIndices_.at( propagators::transational_state );
+        for( unsigned int i = 0; i < dynamicalStatesToEstimate_.at( propagators::transational_state ).size( ); i++ )
+        {
+            int blockIndex = blockIndices.at( startIndex + i * 6 );
+            nonZeroBlocks[ blockIndex ].insert( blockIndex );
+        }
+    }
+
+    // Add blocks for which state partial functions exist.
+    for( std::map< IntegratedStateType, std::vector< std::multimap< std::pair< int, int >,
+         boost::function< void( Eigen::Block< Eigen::MatrixXd > ) > > > >::iterator
+         typeIterator = statePartialList_.begin( ); typeIterator != statePartialList_.end( ); typeIterator++ )
+    {
+        int startIndex = stateTypeStartIndices_.at( typeIterator->first );
+        int currentStateSize = getSingleIntegrationSize( typeIterator->first );
+        for( unsigned int i = 0; i < typeIterator->second.size( ); i++ )
+        {
+            if( blockIndices.count( startIndex + i * currentStateSize ) == 0 )
+            {
+                return;
+            }
+            int rowBlockIndex = blockIndices.at( startIndex + i * currentStateSize );
+
+            for( statePartialIterator_ = typeIterator->second.at( i ).begin( );
+                 statePartialIterator_ != typeIterator->second.at( i ).end( );
+                 statePartialIterator_++ )
+            {
+                if( blockIndices.count( statePartialIterator_->first.first ) == 0 ||
+                        stateBlockSizes_.at( blockIndices.at( statePartialIterator_->first.first ) ) !=
+                        statePartialIterator_->first.second )
+                {
+                    return;
+                }
+                nonZeroBlocks[ rowBlockIndex ].insert( blockIndices.at( statePartialIterator_->first.first ) );
+            }
+        }
+    }
+
+    // Add blocks to which non-zero blocks are added for hierarchical dynamics (in same order as in partial matrix).
+    for( unsigned int i = 0; i < statePartialAdditionIndices_.size( ); i++ )
+    {
+        if( blockIndices.count( statePartialAdditionIndices_.at( i ).first ) == 0 ||
+                blockIndices.count( statePartialAdditionIndices_.at( i ).second ) == 0 )
+        {
+            return;
+        }
+        int fromBlockIndex = blockIndices.at( statePartialAdditionIndices_.at( i ).first );
+        int toBlockIndex = blockIndices.at( statePartialAdditionIndices_.at( i ).second );
+        for( unsigned int j = 0; j < nonZeroBlocks.size( ); j++ )
+        {
+            if( nonZeroBlocks.at( j ).count( fromBlockIndex ) > 0 )
+            {
+                nonZeroBlocks[ j ].insert( toBlockIndex );
+            }
+        }
+    }
+
+    // Set sparsity, and use block-sparse multiplication if less than half of the blocks can be non-zero.
+    nonZeroStatePartialBlocks_.resize( nonZeroBlocks.size( ) );
+    for( unsigned int i = 0; i < nonZeroBlocks.size( ); i++ )
+    {
+        nonZeroStatePartialBlocks_[ i ] = std::vector< int >(
+                    nonZeroBlocks.at( i ).begin( ), nonZeroBlocks.at( i ).end( ) );
+    }
+    isStatePartialBlockSparsityAvailable_ = true;
+    useBlockSparseStatePartials_ =
+            ( 2 * getNumberOfNonZeroStatePartialBlocks( ) <
+              static_cast< int >( stateBlockStartIndices_.size( ) * stateBlockStartIndices_.size( ) ) );
+}
+
 }
 
 }
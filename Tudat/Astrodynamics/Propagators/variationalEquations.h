@@ -100,6 +100,9 @@ public:
         setStatePartialFunctionList( );
         setTranslationalStatePartialFrameScalingFunctions( parametersToEstimate );
         setParameterPartialFunctionList( parametersToEstimate );
+
+        // Determine which blocks of state partial matrix can be non-zero.
+        setStatePartialBlockSparsity( );
     }
     
     //! Calculates matrix containing partial derivatives of state derivatives w.r.t. body state.
@@ -126,8 +129,51 @@ public:
         setBodyStatePartialMatrix( );
 
         // Add partials of body positions and velocities.
-        currentMatrixDerivative.block( 0, 0, totalDynamicalStateSize_, numberOfParameterValues_ ) =
-                ( variationalMatrix_.template cast< StateScalarType >( ) * stateTransitionAndSensitivityMatrices );
+        if( !useBlockSparseStatePartials_ )
+        {
+            currentMatrixDerivative.block( 0, 0, totalDynamicalStateSize_, numberOfParameterValues_ ) =
+                    ( variationalMatrix_.template cast< StateScalarType >( ) * stateTransitionAndSensitivityMatrices );
+        }
+        else
+        {
+            // Multiply only blocks of state partial matrix that can be non-zero.
+            for( unsigned int i = 0; i < stateBlockStartIndices_.size( ); i++ )
+            {
+                const std::vector< int >& currentNonZeroBlocks = nonZeroStatePartialBlocks_.at( i );
+                if( currentNonZeroBlocks.size( ) == 0 )
+                {
+                    currentMatrixDerivative.block( stateBlockStartIndices_.at( i ), 0, stateBlockSizes_.at( i ),
+                                                   numberOfParameterValues_ ).setZero( );
+                }
+
+                for( unsigned int j = 0; j < currentNonZeroBlocks.size( ); j++ )
+                {
+                    const int columnBlock = currentNonZeroBlocks.at( j );
+                    if( j == 0 )
+                    {
+                        currentMatrixDerivative.block( stateBlockStartIndices_.at( i ), 0, stateBlockSizes_.at( i ),
+                                                       numberOfParameterValues_ ).noalias( ) =
+                                variationalMatrix_.block(
+                                    stateBlockStartIndices_.at( i ), stateBlockStartIndices_.at( columnBlock ),
+                                    stateBlockSizes_.at( i ), stateBlockSizes_.at( columnBlock ) ).template
+                                cast< StateScalarType >( ) * stateTransitionAndSensitivityMatrices.block(
+                                    stateBlockStartIndices_.at( columnBlock ), 0, stateBlockSizes_.at( columnBlock ),
+                                    numberOfParameterValues_ );
+                    }
+                    else
+                    {
+                        currentMatrixDerivative.block( stateBlockStartIndices_.at( i ), 0, stateBlockSizes_.at( i ),
+                                                       numberOfParameterValues_ ).noalias( ) +=
+                                variationalMatrix_.block(
+                                    stateBlockStartIndices_.at( i ), stateBlockStartIndices_.at( columnBlock ),
+                                    stateBlockSizes_.at( i ), stateBlockSizes_.at( columnBlock ) ).template
+                                cast< StateScalarType >( ) * stateTransitionAndSensitivityMatrices.block(
+                                    stateBlockStartIndices_.at( columnBlock ), 0, stateBlockSizes_.at( columnBlock ),
+                                    numberOfParameterValues_ );
+                    }
+                }
+            }
+        }
     }
 
     //! Calculates matrix containing partial derivatives of state derivatives w.r.t. parameters.
@@ -226,7 +272,56 @@ public:
     {
         return numberOfParameterValues_;
     }
-    
+
+    //! Function to set whether the block-sparse multiplication of the state partials is used.
+    /*!
+     *  Function to set whether the contribution of the state partials to the variational equations is computed by
+     *  multiplying only the blocks of the state partial matrix that can be non-zero (if true), or by a dense product
+     *  (if false). By default, the block-sparse multiplication is used if less than half of the blocks can be non-zero.
+     *  \param useBlockSparseStatePartials Boolean denoting whether the block-sparse multiplication is to be used.
+     */
+    void setUseBlockSparseStatePartials( const bool useBlockSparseStatePartials )
+    {
+        if( useBlockSparseStatePartials && !isStatePartialBlockSparsityAvailable_ )
+        {
+            throw std::runtime_error( "Error when setting block-sparse state partials in variational equations, "
+                                      "sparsity could not be determined" );
+        }
+        useBlockSparseStatePartials_ = useBlockSparseStatePartials;
+    }
+
+    //! Function to retrieve whether the block-sparse multiplication of the state partials is used.
+    /*!
+     *  Function to retrieve whether the block-sparse multiplication of the state partials is used.
+     *  \return Boolean denoting whether the block-sparse multiplication is used.
+     */
+    bool getUseBlockSparseStatePartials( )
+    {
+        return useBlockSparseStatePartials_;
+    }
+
+    //! Function to retrieve the number of blocks of the state partial matrix that can be non-zero.
+    /*!
+     *  Function to retrieve the number of blocks of the state partial matrix that can be non-zero, where each block
+     *  corresponds to the partial of the state derivative of a single body w.r.t. the state of a single body.
+     *  \return Number of blocks of the state partial matrix that can be non-zero (-1 if sparsity could not be
+     *  determined).
+     */
+    int getNumberOfNonZeroStatePartialBlocks( )
+    {
+        if( !isStatePartialBlockSparsityAvailable_ )
+        {
+            return -1;
+        }
+
+        int numberOfNonZeroBlocks = 0;
+        for( unsigned int i = 0; i < nonZeroStatePartialBlocks_.size( ); i++ )
+        {
+            numberOfNonZeroBlocks += nonZeroStatePartialBlocks_.at( i ).size( );
+        }
+        return numberOfNonZeroBlocks;
+    }
+
 protected:
     
 private:
@@ -237,6 +332,16 @@ private:
      * w.r.t. a current state (stored in the statePartialList_ member) from the state derivative partials.
      */
     void setStatePartialFunctionList( );
+
+    //! Function (called by constructor) to determine which blocks of the state partial matrix can be non-zero.
+    /*!
+     * Function (called by constructor) to determine which blocks of the state partial matrix can be non-zero, from the
+     * statePartialList_ and statePartialAdditionIndices_ members. The matrix is divided in blocks corresponding to the
+     * states of single bodies. A block can only be non-zero if a state partial function exists for it, if it contains
+     * the derivative of the position w.r.t. the velocity, or if a non-zero block is added to it by the hierarchical
+     * dynamics correction. If the sparsity cannot be determined, the dense multiplication is always used.
+     */
+    void setStatePartialBlockSparsity( );
         
     //! Function to add parameter partial functions for single state derivative model, and set of parameter objects.
     /*!
@@ -495,6 +600,21 @@ private:
 
     //! Total matrix of partial derivatives of state derivatives w.r.t. parameter vectors.
     Eigen::MatrixXd variationalParameterMatrix_;
+
+    //! Start indices (in state partial matrix) of the blocks corresponding to the states of single bodies.
+    std::vector< int > stateBlockStartIndices_;
+
+    //! Sizes of the blocks corresponding to the states of single bodies.
+    std::vector< int > stateBlockSizes_;
+
+    //! Indices of column blocks of the state partial matrix that can be non-zero, for each row block.
+    std::vector< std::vector< int > > nonZeroStatePartialBlocks_;
+
+    //! Boolean denoting whether the blocks of the state partial matrix that can be non-zero have been determined.
+    bool isStatePartialBlockSparsityAvailable_;
+
+    //! Boolean denoting whether the block-sparse multiplication of the state partials is used.
+    bool useBlockSparseStatePartials_;
 };
 
 
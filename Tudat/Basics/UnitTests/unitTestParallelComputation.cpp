@@ -0,0 +1,126 @@
+/*    Copyright (c) 2010-2017, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ */
+
+#define BOOST_TEST_MAIN
+
+#include <stdexcept>
+#include <vector>
+
+#include <boost/bind.hpp>
+#include <boost/test/unit_test.hpp>
+
+#include "Tudat/Basics/parallelComputation.h"
+
+namespace tudat
+{
+namespace unit_tests
+{
+
+//! Function used as test task: computes sum of integers up to index, and throws if index is equal to failingTaskIndex.
+void computeTestTask( const unsigned int taskIndex, std::vector< unsigned int >& results,
+                      const unsigned int failingTaskIndex )
+{
+    if( taskIndex == failingTaskIndex )
+    {
+        throw std::runtime_error( "Error in test task" );
+    }
+
+    unsigned int sum = 0;
+    for( unsigned int i = 0; i <= taskIndex; i++ )
+    {
+        sum += i;
+    }
+    results[ taskIndex ] = sum;
+}
+
+//! Function used as test task: stores index of thread on which task is executed, and counts tasks per thread.
+void computeTestTaskWithThreadIndex( const unsigned int taskIndex, const unsigned int threadIndex,
+                                     std::vector< unsigned int >& threadIndices,
+                                     std::vector< unsigned int >& numberOfTasksPerThread )
+{
+    threadIndices[ taskIndex ] = threadIndex;
+    numberOfTasksPerThread[ threadIndex ]++;
+}
+
+BOOST_AUTO_TEST_SUITE( test_parallel_computation )
+
+//! Test whether all tasks are executed exactly once, for various numbers of threads.
+BOOST_AUTO_TEST_CASE( testParallelLoop )
+{
+    const unsigned int numberOfTasks = 1000;
+    for( unsigned int numberOfThreads = 0; numberOfThreads < 6; numberOfThreads++ )
+    {
+        std::vector< unsigned int > results( numberOfTasks, 0 );
+        utilities::executeParallelLoop(
+                    numberOfTasks, numberOfThreads,
+                    boost::bind( &computeTestTask, _1, boost::ref( results ), numberOfTasks ) );
+
+        for( unsigned int i = 0; i < numberOfTasks; i++ )
+        {
+            BOOST_CHECK_EQUAL( results.at( i ), i * ( i + 1 ) / 2 );
+        }
+    }
+
+    // Check that loop without tasks is handled correctly
+    std::vector< unsigned int > results;
+    BOOST_CHECK_NO_THROW( utilities::executeParallelLoop(
+                              0, 4, boost::bind( &computeTestTask, _1, boost::ref( results ), 0 ) ) );
+}
+
+//! Test whether an exception thrown by a task is passed on to the calling thread.
+BOOST_AUTO_TEST_CASE( testParallelLoopException )
+{
+    const unsigned int numberOfTasks = 100;
+    for( unsigned int numberOfThreads = 1; numberOfThreads < 6; numberOfThreads++ )
+    {
+        std::vector< unsigned int > results( numberOfTasks, 0 );
+        BOOST_CHECK_THROW( utilities::executeParallelLoop(
+                               numberOfTasks, numberOfThreads,
+                               boost::bind( &computeTestTask, _1, boost::ref( results ), 37 ) ),
+                           std::runtime_error );
+    }
+}
+
+//! Test whether the thread index provided to the tasks is valid and unique per thread.
+BOOST_AUTO_TEST_CASE( testParallelLoopWithThreadIndex )
+{
+    const unsigned int numberOfTasks = 1000;
+    for( unsigned int numberOfThreads = 0; numberOfThreads < 6; numberOfThreads++ )
+    {
+        unsigned int numberOfThreadsUsed =
+                utilities::getNumberOfThreadsForParallelLoop( numberOfTasks, numberOfThreads );
+        std::vector< unsigned int > threadIndices( numberOfTasks, numberOfThreadsUsed );
+        std::vector< unsigned int > numberOfTasksPerThread( numberOfThreadsUsed, 0 );
+        utilities::executeParallelLoopWithThreadIndex(
+                    numberOfTasks, numberOfThreads,
+                    boost::bind( &computeTestTaskWithThreadIndex, _1, _2, boost::ref( threadIndices ),
+                                 boost::ref( numberOfTasksPerThread ) ) );
+
+        // Check that each task was run on a valid thread, and that per-thread data was not modified concurrently.
+        unsigned int totalNumberOfTasks = 0;
+        for( unsigned int i = 0; i < numberOfThreadsUsed; i++ )
+        {
+            totalNumberOfTasks += numberOfTasksPerThread.at( i );
+        }
+        BOOST_CHECK_EQUAL( totalNumberOfTasks, numberOfTasks );
+        for( unsigned int i = 0; i < numberOfTasks; i++ )
+        {
+            BOOST_CHECK( threadIndices.at( i ) < numberOfThreadsUsed );
+        }
+    }
+
+    BOOST_CHECK_EQUAL( utilities::getNumberOfThreadsForParallelLoop( 3, 8 ), 3 );
+    BOOST_CHECK_EQUAL( utilities::getNumberOfThreadsForParallelLoop( 0, 8 ), 1 );
+}
+
+BOOST_AUTO_TEST_SUITE_END( )
+
+} // namespace unit_tests
+} // namespace tudat
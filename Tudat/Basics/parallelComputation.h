@@ -0,0 +1,191 @@
+/*    Copyright (c) 2010-2017, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ */
+
+#ifndef TUDAT_PARALLEL_COMPUTATION_H
+#define TUDAT_PARALLEL_COMPUTATION_H
+
+#include <atomic>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include <boost/bind.hpp>
+#include <boost/function.hpp>
+
+namespace tudat
+{
+
+namespace utilities
+{
+
+//! Function to retrieve the number of threads to use for a parallel computation.
+/*!
+ *  Function to retrieve the number of threads to use for a parallel computation, from a user-defined number of threads.
+ *  \param requestedNumberOfThreads Number of threads requested by user. If equal to 0, the number of concurrent threads
+ *  supported by the hardware is returned.
+ *  \return Number of threads to use for a parallel computation (at least 1).
+ */
+inline unsigned int getNumberOfThreadsToUse( const unsigned int requestedNumberOfThreads )
+{
+    unsigned int numberOfThreads = requestedNumberOfThreads;
+    if( numberOfThreads == 0 )
+    {
+        numberOfThreads = std::thread::hardware_concurrency( );
+    }
+    return ( numberOfThreads == 0 ) ? 1 : numberOfThreads;
+}
+
+//! Function that is run by a single worker thread of a parallel loop
+/*!
+ *  Function that is run by a single worker thread of a parallel loop. The worker retrieves the next unprocessed task index
+ *  until all tasks have been processed, or until a task in any of the threads has thrown an exception.
+ *  \param task Function performing the task with the given index (first argument), on the thread with the given index
+ *  (second argument).
+ *  \param threadIndex Index of the current thread.
+ *  \param numberOfTasks Total number of tasks.
+ *  \param nextTaskIndex Index of next task that is to be processed (shared between threads).
+ *  \param firstException First exception that was thrown by any of the tasks (shared between threads).
+ *  \param exceptionMutex Mutex protecting firstException.
+ */
+inline void executeParallelLoopTasks(
+        const boost::function< void( const unsigned int, const unsigned int ) >& task,
+        const unsigned int threadIndex,
+        const unsigned int numberOfTasks,
+        std::atomic< unsigned int >& nextTaskIndex,
+        std::exception_ptr& firstException,
+        std::mutex& exceptionMutex )
+{
+    unsigned int currentTaskIndex = nextTaskIndex++;
+    while( currentTaskIndex < numberOfTasks )
+    {
+        try
+        {
+            task( currentTaskIndex, threadIndex );
+        }
+        catch( ... )
+        {
+            std::lock_guard< std::mutex > exceptionLock( exceptionMutex );
+            if( !firstException )
+            {
+                firstException = std::current_exception( );
+            }
+
+            // Prevent any further tasks from being started.
+            nextTaskIndex = numberOfTasks;
+        }
+        currentTaskIndex = nextTaskIndex++;
+    }
+}
+
+//! Function to retrieve the number of threads that is used by a parallel loop
+/*!
+ *  Function to retrieve the number of threads that is used by a parallel loop (see executeParallelLoop), which is limited
+ *  by the number of tasks.
+ *  \param numberOfTasks Number of tasks that are to be executed.
+ *  \param requestedNumberOfThreads Number of threads requested by user. If equal to 0, the number of concurrent threads
+ *  supported by the hardware is used.
+ *  \return Number of threads that is used by the parallel loop (at least 1).
+ */
+inline unsigned int getNumberOfThreadsForParallelLoop(
+        const unsigned int numberOfTasks, const unsigned int requestedNumberOfThreads )
+{
+    unsigned int numberOfThreads = getNumberOfThreadsToUse( requestedNumberOfThreads );
+    if( numberOfThreads > numberOfTasks )
+    {
+        numberOfThreads = numberOfTasks;
+    }
+    return ( numberOfThreads == 0 ) ? 1 : numberOfThreads;
+}
+
+//! Function to execute a list of independent tasks, distributed over a number of threads, providing the thread index.
+/*!
+ *  Function to execute a list of independent tasks, distributed over a number of threads, as executeParallelLoop. In
+ *  addition to the task index, the index of the thread on which the task is executed is provided to the task, so that
+ *  the task may use data that is owned by that thread (e.g. a copy of the environment). The thread index is in the range
+ *  0...( getNumberOfThreadsForParallelLoop( numberOfTasks, requestedNumberOfThreads ) - 1 ), and no two tasks with the
+ *  same thread index are executed concurrently.
+ *  \param numberOfTasks Number of tasks that are to be executed, with indices 0...( numberOfTasks - 1 ).
+ *  \param requestedNumberOfThreads Number of threads that are to be used. If equal to 0, the number of concurrent threads
+ *  supported by the hardware is used.
+ *  \param task Function performing the task with the given index (first argument), on the thread with the given index
+ *  (second argument).
+ */
+inline void executeParallelLoopWithThreadIndex(
+        const unsigned int numberOfTasks,
+        const unsigned int requestedNumberOfThreads,
+        const boost::function< void( const unsigned int, const unsigned int ) >& task )
+{
+    unsigned int numberOfThreads = getNumberOfThreadsForParallelLoop( numberOfTasks, requestedNumberOfThreads );
+
+    if( numberOfThreads <= 1 )
+    {
+        for( unsigned int i = 0; i < numberOfTasks; i++ )
+        {
+            task( i, 0 );
+        }
+    }
+    else
+    {
+        std::atomic< unsigned int > nextTaskIndex( 0 );
+        std::exception_ptr firstException;
+        std::mutex exceptionMutex;
+
+        // Start additional threads, and use current thread as final worker.
+        std::vector< std::thread > workerThreads;
+        for( unsigned int i = 0; i < numberOfThreads - 1; i++ )
+        {
+            workerThreads.push_back(
+                        std::thread( &executeParallelLoopTasks, std::cref( task ), i, numberOfTasks,
+                                     std::ref( nextTaskIndex ), std::ref( firstException ),
+                                     std::ref( exceptionMutex ) ) );
+        }
+        executeParallelLoopTasks( task, numberOfThreads - 1, numberOfTasks, nextTaskIndex, firstException,
+                                  exceptionMutex );
+
+        for( unsigned int i = 0; i < workerThreads.size( ); i++ )
+        {
+            workerThreads.at( i ).join( );
+        }
+
+        if( firstException )
+        {
+            std::rethrow_exception( firstException );
+        }
+    }
+}
+
+//! Function to execute a list of independent tasks, distributed over a number of threads.
+/*!
+ *  Function to execute a list of independent tasks, distributed over a number of threads. The tasks are handed out to
+ *  the threads one at a time (in order of index), so that tasks with unequal run time are balanced over the threads.
+ *  The calling thread is used as one of the worker threads. If only one thread is to be used, all tasks are executed
+ *  in order in the calling thread. If any of the tasks throws an exception, no new tasks are started, and the first
+ *  exception is rethrown in the calling thread after all threads have finished.
+ *  NOTE: the user is responsible for ensuring that the tasks do not modify any shared data.
+ *  \param numberOfTasks Number of tasks that are to be executed, with indices 0...( numberOfTasks - 1 ).
+ *  \param requestedNumberOfThreads Number of threads that are to be used. If equal to 0, the number of concurrent threads
+ *  supported by the hardware is used.
+ *  \param task Function performing the task with the given index.
+ */
+inline void executeParallelLoop(
+        const unsigned int numberOfTasks,
+        const unsigned int requestedNumberOfThreads,
+        const boost::function< void( const unsigned int ) >& task )
+{
+    executeParallelLoopWithThreadIndex( numberOfTasks, requestedNumberOfThreads, boost::bind( task, _1 ) );
+}
+
+} // namespace utilities
+
+} // namespace tudat
+
+#endif // TUDAT_PARALLEL_COMPUTATION_H
@@ -60,8 +60,10 @@ std::map< S, T > linearlyScaleKeyOfMap(
 
         }
 
-        // Set scalted map key with corresponding value in new map
-        scaledMap[ newKey ] = mapIterator->second;
+        // Set scalted map key with corresponding value in new map (new keys are sorted for positive scale, so that
+        // they are inserted at the end of the map; entries with identical new keys replace earlier entries)
+        scaledMap.insert( scaledMap.end( ), std::make_pair( newKey, mapIterator->second ) )->second =
+                mapIterator->second;
     }
     return scaledMap;
 }
@@ -0,0 +1,162 @@
+/*    Copyright (c) 2010-2017, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ */
+
+#define BOOST_TEST_MAIN
+
+#include <cmath>
+#include <map>
+
+#include <boost/filesystem.hpp>
+#include <boost/test/unit_test.hpp>
+
+#include <Eigen/Core>
+
+#include "Tudat/InputOutput/basicInputOutput.h"
+#include "Tudat/InputOutput/binaryDataFile.h"
+
+namespace tudat
+{
+namespace unit_tests
+{
+
+using namespace tudat::input_output;
+
+//! Function to create a unique path for a temporary file.
+boost::filesystem::path getTemporaryFilePath( const std::string& fileNameModel )
+{
+    return boost::filesystem::temp_directory_path( ) / boost::filesystem::unique_path( fileNameModel );
+}
+
+BOOST_AUTO_TEST_SUITE( test_binary_data_file )
+
+//! Test whether tables written to binary data files are read back identically, for synchronous and asynchronous
+//! writing, and for tables that do and do not fill the last block.
+BOOST_AUTO_TEST_CASE( testBinaryDataFileRoundTrip )
+{
+    std::vector< BinaryDataFileVariable > variables;
+    variables.push_back( BinaryDataFileVariable( "epoch", 0, 1 ) );
+    variables.push_back( BinaryDataFileVariable( "Earth-centered state of body", 1, 6 ) );
+    variables.push_back( BinaryDataFileVariable( "Altitude of body w.r.t. Earth", 7, 1 ) );
+    const std::string header = "Test header\nwith two lines\n";
+
+    std::vector< unsigned int > numbersOfRows = { 0, 1, 99, 100, 1001 };
+    for( unsigned int writeAsynchronously = 0; writeAsynchronously < 2; writeAsynchronously++ )
+    {
+        for( unsigned int i = 0; i < numbersOfRows.size( ); i++ )
+        {
+            Eigen::MatrixXd table = Eigen::MatrixXd::Random( numbersOfRows.at( i ), 8 );
+            boost::filesystem::path filePath = getTemporaryFilePath( "binaryDataFile%%%%%%%%.bin" );
+            {
+                BinaryDataFileWriter writer( filePath, 8, variables, header, writeAsynchronously, 100 );
+                for( int j = 0; j < table.rows( ); j++ )
+                {
+                    writer.addRow( Eigen::VectorXd( table.row( j ).transpose( ) ) );
+                }
+                BOOST_CHECK_EQUAL( writer.getNumberOfRows( ), numbersOfRows.at( i ) );
+                BOOST_CHECK_THROW( writer.addRow( Eigen::VectorXd::Zero( 7 ) ), std::runtime_error );
+            }
+
+            BOOST_CHECK( isBinaryDataFile( filePath ) );
+            BinaryDataFileContents fileContents = readBinaryDataFile( filePath );
+            BOOST_CHECK_EQUAL( fileContents.header_, header );
+            BOOST_CHECK_EQUAL( fileContents.variables_.size( ), variables.size( ) );
+            for( unsigned int j = 0; j < variables.size( ); j++ )
+            {
+                BOOST_CHECK_EQUAL( fileContents.variables_.at( j ).name_, variables.at( j ).name_ );
+                BOOST_CHECK_EQUAL( fileContents.variables_.at( j ).firstColumn_, variables.at( j ).firstColumn_ );
+                BOOST_CHECK_EQUAL( fileContents.variables_.at( j ).size_, variables.at( j ).size_ );
+            }
+            BOOST_CHECK_EQUAL( fileContents.data_.rows( ), table.rows( ) );
+            BOOST_CHECK_EQUAL( fileContents.data_.cols( ), 8 );
+            BOOST_CHECK( fileContents.data_ == table );
+
+            boost::filesystem::remove( filePath );
+        }
+    }
+}
+
+//! Test whether data maps are written to, and read from, binary data files correctly.
+BOOST_AUTO_TEST_CASE( testBinaryDataMapFile )
+{
+    // Create data map representing propagation results of 10^5 epochs.
+    std::map< double, Eigen::VectorXd > dataMap;
+    for( int i = 0; i < 100000; i++ )
+    {
+        Eigen::VectorXd values( 20 );
+        for( int j = 0; j < 20; j++ )
+        {
+            values( j ) = std::sin( 0.001 * i + j ) * std::pow( 10.0, j % 7 );
+        }
+        dataMap[ 10.0 * i + 0.1 ] = values;
+    }
+
+    std::vector< BinaryDataFileVariable > variables;
+    variables.push_back( BinaryDataFileVariable( "state", 0, 12 ) );
+    variables.push_back( BinaryDataFileVariable( "dependent", 12, 8 ) );
+
+    boost::filesystem::path binaryFilePath = getTemporaryFilePath( "binaryDataFile%%%%%%%%.bin" );
+
+    for( unsigned int writeAsynchronously = 0; writeAsynchronously < 2; writeAsynchronously++ )
+    {
+        writeDataMapToBinaryFile( dataMap, binaryFilePath, variables, "", writeAsynchronously );
+
+        // Check map read from file.
+        std::map< double, Eigen::VectorXd > readDataMap = readDataMapFromBinaryFile( binaryFilePath );
+        BOOST_CHECK_EQUAL( readDataMap.size( ), dataMap.size( ) );
+        auto readIterator = readDataMap.begin( );
+        for( auto iterator = dataMap.begin( ); iterator != dataMap.end( ); iterator++, readIterator++ )
+        {
+            BOOST_CHECK_EQUAL( readIterator->first, iterator->first );
+            BOOST_CHECK( readIterator->second == iterator->second );
+        }
+
+        // Check that key has been added to variables.
+        BinaryDataFileContents fileContents = readBinaryDataFile( binaryFilePath );
+        BOOST_CHECK_EQUAL( fileContents.variables_.size( ), 3 );
+        BOOST_CHECK_EQUAL( fileContents.variables_.at( 0 ).name_, "epoch" );
+        BOOST_CHECK_EQUAL( fileContents.variables_.at( 2 ).name_, "dependent" );
+        BOOST_CHECK_EQUAL( fileContents.variables_.at( 2 ).firstColumn_, 13 );
+    }
+
+    boost::filesystem::remove( binaryFilePath );
+}
+
+//! Test whether invalid binary data files, and invalid input, are rejected.
+BOOST_AUTO_TEST_CASE( testBinaryDataFileErrors )
+{
+    boost::filesystem::path filePath = getTemporaryFilePath( "binaryDataFile%%%%%%%%.bin" );
+
+    // Check that variables exceeding the table are rejected.
+    BOOST_CHECK_THROW( BinaryDataFileWriter( filePath, 3, { BinaryDataFileVariable( "state", 1, 3 ) } ),
+                       std::runtime_error );
+
+    // Check that text files are rejected.
+    writeMatrixToFile( Eigen::Matrix3d( Eigen::Matrix3d::Identity( ) ), filePath.filename( ).string( ), 16,
+                       filePath.parent_path( ) );
+    BOOST_CHECK( !isBinaryDataFile( filePath ) );
+    BOOST_CHECK_THROW( readBinaryDataFile( filePath ), std::runtime_error );
+
+    // Check that truncated files are rejected.
+    {
+        BinaryDataFileWriter writer( filePath, 2 );
+        writer.addRow( Eigen::Vector2d( 1.0, 2.0 ) );
+        writer.addRow( Eigen::Vector2d( 3.0, 4.0 ) );
+    }
+    BOOST_CHECK_EQUAL( readBinaryDataFile( filePath ).data_.rows( ), 2 );
+    boost::filesystem::resize_file( filePath, boost::filesystem::file_size( filePath ) - 8 );
+    BOOST_CHECK_THROW( readBinaryDataFile( filePath ), std::runtime_error );
+
+    boost::filesystem::remove( filePath );
+}
+
+BOOST_AUTO_TEST_SUITE_END( )
+
+} // namespace unit_tests
+} // namespace tudat
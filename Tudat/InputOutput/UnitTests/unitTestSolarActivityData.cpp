@@ -15,11 +15,14 @@
 
 #define BOOST_TEST_MAIN
 
+#include <chrono>
+#include <iostream>
 #include <istream>
 #include <string>
 #include <vector>
 #include <map>
 
+#include <boost/filesystem.hpp>
 #include <boost/shared_ptr.hpp>
 #include <boost/test/unit_test.hpp>
 
@@ -183,6 +186,139 @@ BOOST_AUTO_TEST_CASE( test_function_readSolarActivityData )
     }
 }
 
+//! Function to read solar activity data file with the generic parser and extractor.
+tudat::input_output::solar_activity::SolarActivityDataMap readSolarActivityDataWithParserAndExtractor(
+        const std::string& filePath )
+{
+    using namespace tudat::input_output::solar_activity;
+
+    std::ifstream dataFile( filePath.c_str( ) );
+    ParseSolarActivityData solarActivityParser;
+    ExtractSolarActivityData solarActivityExtractor;
+    tudat::input_output::parsed_data_vector_utilities::ParsedDataVectorPtr parsedDataVector =
+            solarActivityParser.parse( dataFile );
+    SolarActivityDataMap solarActivity;
+    for( unsigned int i = 0; i < parsedDataVector->size( ); i++ )
+    {
+        SolarActivityDataPtr currentData = solarActivityExtractor.extract( parsedDataVector->at( i ) );
+        solarActivity[ tudat::basic_astrodynamics::convertCalendarDateToJulianDay(
+                    currentData->year, currentData->month, currentData->day, 0, 0, 0.0 ) ] = currentData;
+    }
+    return solarActivity;
+}
+
+//! Function to check whether two solar activity data objects are identical.
+void checkSolarActivityDataEquality(
+        const tudat::input_output::solar_activity::SolarActivityData& expectedData,
+        const tudat::input_output::solar_activity::SolarActivityData& data )
+{
+    BOOST_CHECK_EQUAL( expectedData.year, data.year );
+    BOOST_CHECK_EQUAL( expectedData.month, data.month );
+    BOOST_CHECK_EQUAL( expectedData.day, data.day );
+    BOOST_CHECK_EQUAL( expectedData.bartelsSolarRotationNumber, data.bartelsSolarRotationNumber );
+    BOOST_CHECK_EQUAL( expectedData.dayOfBartelsCycle, data.dayOfBartelsCycle );
+    BOOST_CHECK_EQUAL( expectedData.planetaryRangeIndexSum, data.planetaryRangeIndexSum );
+    BOOST_CHECK_EQUAL( expectedData.planetaryEquivalentAmplitudeAverage, data.planetaryEquivalentAmplitudeAverage );
+    BOOST_CHECK_EQUAL( expectedData.planetaryDailyCharacterFigure, data.planetaryDailyCharacterFigure );
+    BOOST_CHECK_EQUAL( expectedData.planetaryDailyCharacterFigureConverted,
+                       data.planetaryDailyCharacterFigureConverted );
+    BOOST_CHECK_EQUAL( expectedData.internationalSunspotNumber, data.internationalSunspotNumber );
+    BOOST_CHECK_EQUAL( expectedData.solarRadioFlux107Adjusted, data.solarRadioFlux107Adjusted );
+    BOOST_CHECK_EQUAL( expectedData.fluxQualifier, data.fluxQualifier );
+    BOOST_CHECK_EQUAL( expectedData.centered81DaySolarRadioFlux107Adjusted,
+                       data.centered81DaySolarRadioFlux107Adjusted );
+    BOOST_CHECK_EQUAL( expectedData.last81DaySolarRadioFlux107Adjusted, data.last81DaySolarRadioFlux107Adjusted );
+    BOOST_CHECK_EQUAL( expectedData.solarRadioFlux107Observed, data.solarRadioFlux107Observed );
+    BOOST_CHECK_EQUAL( expectedData.centered81DaySolarRadioFlux107Observed,
+                       data.centered81DaySolarRadioFlux107Observed );
+    BOOST_CHECK_EQUAL( expectedData.last81DaySolarRadioFlux107Observed, data.last81DaySolarRadioFlux107Observed );
+    BOOST_CHECK( expectedData.planetaryRangeIndexVector == data.planetaryRangeIndexVector );
+    BOOST_CHECK( expectedData.planetaryEquivalentAmplitudeVector == data.planetaryEquivalentAmplitudeVector );
+    BOOST_CHECK_EQUAL( expectedData.dataType, data.dataType );
+}
+
+//! Test whether data read with readSolarActivityData (both from the text file and from a binary file) is identical to
+//! that obtained with the generic parser and extractor.
+BOOST_AUTO_TEST_CASE( test_function_readSolarActivityData_binary )
+{
+    using namespace tudat::input_output::solar_activity;
+
+    std::string cppPath( __FILE__ );
+    std::string folder = cppPath.substr( 0, cppPath.find_last_of( "/\\" ) + 1 );
+    std::string filePath = folder + "sw19571001.txt";
+    std::string binaryFilePath = ( boost::filesystem::temp_directory_path( ) /
+                                   boost::filesystem::unique_path( "solarActivity%%%%%%%%.bin" ) ).string( );
+
+    // Read file with parser and extractor.
+    SolarActivityDataMap expectedSolarActivity = readSolarActivityDataWithParserAndExtractor( filePath );
+
+    // Read text file.
+    SolarActivityDataMap solarActivity = readSolarActivityData( filePath );
+
+    // Write and read binary file.
+    writeBinarySolarActivityDataFile( solarActivity, binaryFilePath );
+    BOOST_CHECK( isBinarySolarActivityDataFile( binaryFilePath ) );
+    BOOST_CHECK( !isBinarySolarActivityDataFile( filePath ) );
+
+    SolarActivityDataMap binarySolarActivity = readSolarActivityData( binaryFilePath );
+
+    // Compare all data.
+    BOOST_CHECK_EQUAL( solarActivity.size( ), expectedSolarActivity.size( ) );
+    BOOST_CHECK_EQUAL( binarySolarActivity.size( ), expectedSolarActivity.size( ) );
+    SolarActivityDataMap::const_iterator textIterator = solarActivity.begin( );
+    SolarActivityDataMap::const_iterator binaryIterator = binarySolarActivity.begin( );
+    for( SolarActivityDataMap::const_iterator expectedIterator = expectedSolarActivity.begin( );
+         expectedIterator != expectedSolarActivity.end( ) && textIterator != solarActivity.end( ) &&
+         binaryIterator != binarySolarActivity.end( ); expectedIterator++ )
+    {
+        BOOST_CHECK_EQUAL( expectedIterator->first, textIterator->first );
+        BOOST_CHECK_EQUAL( expectedIterator->first, binaryIterator->first );
+        checkSolarActivityDataEquality( *expectedIterator->second, *textIterator->second );
+        checkSolarActivityDataEquality( *expectedIterator->second, *binaryIterator->second );
+        textIterator++;
+        binaryIterator++;
+    }
+
+    // Check that truncated binary file is rejected.
+    boost::filesystem::resize_file( binaryFilePath, boost::filesystem::file_size( binaryFilePath ) - 8 );
+    BOOST_CHECK_THROW( readSolarActivityData( binaryFilePath ), std::runtime_error );
+
+    boost::filesystem::remove( binaryFilePath );
+}
+
+#if COMPILE_UNIT_TEST_BENCHMARKS
+//! Compare reading times of solar activity data with the generic parser and extractor, and with readSolarActivityData
+//! from the text file and from a binary file.
+BOOST_AUTO_TEST_CASE( benchmark_readSolarActivityData_binary )
+{
+    using namespace tudat::input_output::solar_activity;
+
+    std::string cppPath( __FILE__ );
+    std::string folder = cppPath.substr( 0, cppPath.find_last_of( "/\\" ) + 1 );
+    std::string filePath = folder + "sw19571001.txt";
+    std::string binaryFilePath = ( boost::filesystem::temp_directory_path( ) /
+                                   boost::filesystem::unique_path( "solarActivity%%%%%%%%.bin" ) ).string( );
+
+    std::chrono::steady_clock::time_point startTime = std::chrono::steady_clock::now( );
+    readSolarActivityDataWithParserAndExtractor( filePath );
+    double parserReadTime = std::chrono::duration< double >( std::chrono::steady_clock::now( ) - startTime ).count( );
+
+    startTime = std::chrono::steady_clock::now( );
+    SolarActivityDataMap solarActivity = readSolarActivityData( filePath );
+    double textReadTime = std::chrono::duration< double >( std::chrono::steady_clock::now( ) - startTime ).count( );
+
+    writeBinarySolarActivityDataFile( solarActivity, binaryFilePath );
+    startTime = std::chrono::steady_clock::now( );
+    readSolarActivityData( binaryFilePath );
+    double binaryReadTime = std::chrono::duration< double >( std::chrono::steady_clock::now( ) - startTime ).count( );
+
+    std::cout << "Reading solar activity data: parser/extractor " << 1.0E3 * parserReadTime << " ms, text "
+              << 1.0E3 * textReadTime << " ms, binary " << 1.0E3 * binaryReadTime << " ms" << std::endl;
+
+    boost::filesystem::remove( binaryFilePath );
+}
+#endif
+
 BOOST_AUTO_TEST_SUITE_END( )
 
 }   // unit_tests
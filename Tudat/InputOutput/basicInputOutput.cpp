@@ -14,9 +14,13 @@
  *
  */
  
+#include <iterator>
 #include <sstream>
+#include <stdexcept>
 #include <string>
 
+#include <boost/functional/hash.hpp>
+
 #include "Tudat/InputOutput/basicInputOutput.h"
 
 namespace tudat
@@ -124,5 +128,18 @@ std::vector< boost::filesystem::path > listAllFilesInDirectory(
     return listOfFileNamesWithPath_;
 }
 
+//! Compute hash of the contents of a file.
+std::size_t computeFileContentsHash( const std::string& fileName )
+{
+    std::ifstream file( fileName.c_str( ), std::ios::binary );
+    if( !file.good( ) )
+    {
+        throw std::runtime_error( "Error when computing hash of file contents, could not open file " + fileName );
+    }
+
+    std::string fileContents( ( std::istreambuf_iterator< char >( file ) ), std::istreambuf_iterator< char >( ) );
+    return boost::hash_range( fileContents.begin( ), fileContents.end( ) );
+}
+
 } // namespace input_output
 } // namespace tudat
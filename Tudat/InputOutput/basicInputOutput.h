@@ -142,6 +142,16 @@ std::string printInFormattedScientificNotation(
 std::vector< boost::filesystem::path > listAllFilesInDirectory(
         const boost::filesystem::path& directory, const bool isRecurseIntoSubdirectories = false );
 
+//! Compute hash of the contents of a file.
+/*!
+ * Computes a hash of the (binary) contents of a file, for instance to check whether a cache file that was generated from
+ * the file is consistent with its current contents. The hash is computed with boost::hash_range, and is therefore not
+ * guaranteed to be identical between platforms or Boost versions.
+ * \param fileName Name of file of which the contents are to be hashed.
+ * \return Hash of the contents of the file.
+ */
+std::size_t computeFileContentsHash( const std::string& fileName );
+
 //! Write a value to a stream.
 /*!
  * Write a value to a stream, left-aligned at a specified precision. Value is preceded by
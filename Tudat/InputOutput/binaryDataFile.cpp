@@ -0,0 +1,383 @@
+/*    Copyright (c) 2010-2017, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ */
+
+#include <cstdint>
+#include <cstring>
+#include <iostream>
+
+#include "Tudat/InputOutput/binaryDataFile.h"
+
+namespace tudat
+{
+namespace input_output
+{
+
+//! Identifier at start of binary data file.
+static const char binaryDataFileIdentifier[ 8 ] = { 'T', 'U', 'D', 'A', 'T', 'B', 'D', 'F' };
+
+//! Version of binary data file format.
+static const std::int32_t binaryDataFileVersion = 1;
+
+//! Function to write an unsigned integer to a binary stream, as 4 bytes.
+static void writeUnsignedIntegerToBinaryStream( std::ostream& stream, const unsigned int value )
+{
+    std::uint32_t valueToWrite = static_cast< std::uint32_t >( value );
+    stream.write( reinterpret_cast< const char* >( &valueToWrite ), sizeof( std::uint32_t ) );
+}
+
+//! Function to write a string to a binary stream, preceded by its length.
+static void writeStringToBinaryStream( std::ostream& stream, const std::string& value )
+{
+    writeUnsignedIntegerToBinaryStream( stream, value.size( ) );
+    stream.write( value.data( ), value.size( ) );
+}
+
+//! Function to read an unsigned integer (stored as 4 bytes) from a binary stream.
+static unsigned int readUnsignedIntegerFromBinaryStream( std::istream& stream, const std::string& fileName )
+{
+    std::uint32_t value;
+    if( !stream.read( reinterpret_cast< char* >( &value ), sizeof( std::uint32_t ) ) )
+    {
+        throw std::runtime_error( "Error when reading binary data file " + fileName + ", file is truncated" );
+    }
+    return static_cast< unsigned int >( value );
+}
+
+//! Function to read a string (preceded by its length) from a binary stream.
+static std::string readStringFromBinaryStream( std::istream& stream, const std::string& fileName,
+                                               const std::uintmax_t fileSize )
+{
+    unsigned int stringLength = readUnsignedIntegerFromBinaryStream( stream, fileName );
+    if( stringLength > fileSize )
+    {
+        throw std::runtime_error( "Error when reading binary data file " + fileName + ", file is truncated" );
+    }
+
+    std::string value( stringLength, ' ' );
+    if( stringLength > 0 && !stream.read( &value[ 0 ], stringLength ) )
+    {
+        throw std::runtime_error( "Error when reading binary data file " + fileName + ", file is truncated" );
+    }
+    return value;
+}
+
+//! Constructor, opens the file and writes the file header.
+BinaryDataFileWriter::BinaryDataFileWriter( const boost::filesystem::path& filePath,
+                                            const unsigned int numberOfColumns,
+                                            const std::vector< BinaryDataFileVariable >& variables,
+                                            const std::string& header,
+                                            const bool writeAsynchronously,
+                                            const unsigned int numberOfRowsPerBlock ):
+    fileName_( filePath.string( ) ), numberOfColumns_( numberOfColumns ), writeAsynchronously_( writeAsynchronously ),
+    numberOfRowsPerBlock_( numberOfRowsPerBlock ), numberOfRowsInCurrentBlock_( 0 ), numberOfRows_( 0 ),
+    isClosed_( false )
+{
+    if( numberOfRowsPerBlock_ == 0 )
+    {
+        throw std::runtime_error( "Error when creating binary data file " + fileName_ +
+                                  ", number of rows per block must be positive" );
+    }
+
+    for( unsigned int i = 0; i < variables.size( ); i++ )
+    {
+        if( variables.at( i ).firstColumn_ + variables.at( i ).size_ > numberOfColumns_ )
+        {
+            throw std::runtime_error( "Error when creating binary data file " + fileName_ + ", variable " +
+                                      variables.at( i ).name_ + " exceeds number of columns" );
+        }
+    }
+
+    // Check if output directory exists; create it if it doesn't.
+    if( !filePath.parent_path( ).empty( ) && !boost::filesystem::exists( filePath.parent_path( ) ) )
+    {
+        boost::filesystem::create_directories( filePath.parent_path( ) );
+    }
+
+    stream_.open( fileName_.c_str( ), std::ios::binary | std::ios::trunc );
+    if( !stream_ )
+    {
+        throw std::runtime_error( "Error when creating binary data file, could not open file " + fileName_ );
+    }
+
+    // Write file header.
+    stream_.write( binaryDataFileIdentifier, 8 );
+    stream_.write( reinterpret_cast< const char* >( &binaryDataFileVersion ), sizeof( std::int32_t ) );
+    writeUnsignedIntegerToBinaryStream( stream_, numberOfColumns_ );
+    writeUnsignedIntegerToBinaryStream( stream_, variables.size( ) );
+    for( unsigned int i = 0; i < variables.size( ); i++ )
+    {
+        writeUnsignedIntegerToBinaryStream( stream_, variables.at( i ).firstColumn_ );
+        writeUnsignedIntegerToBinaryStream( stream_, variables.at( i ).size_ );
+        writeStringToBinaryStream( stream_, variables.at( i ).name_ );
+    }
+    writeStringToBinaryStream( stream_, header );
+
+    if( !stream_ )
+    {
+        throw std::runtime_error( "Error when creating binary data file, could not write file " + fileName_ );
+    }
+
+    currentBlockValues_.resize( numberOfColumns_ * numberOfRowsPerBlock_ );
+}
+
+//! Destructor, completes the file (if close has not been called).
+BinaryDataFileWriter::~BinaryDataFileWriter( )
+{
+    try
+    {
+        close( );
+    }
+    catch( std::exception& caughtException )
+    {
+        std::cerr << caughtException.what( ) << std::endl;
+    }
+}
+
+//! Function to add a row to the table.
+void BinaryDataFileWriter::addRow( const Eigen::VectorXd& row )
+{
+    if( static_cast< unsigned int >( row.rows( ) ) != numberOfColumns_ )
+    {
+        throw std::runtime_error( "Error when writing binary data file " + fileName_ + ", row has " +
+                                  std::to_string( row.rows( ) ) + " entries, but table has " +
+                                  std::to_string( numberOfColumns_ ) + " columns" );
+    }
+    addRow( row.data( ) );
+}
+
+//! Function to add a row to the table.
+void BinaryDataFileWriter::addRow( const double* rowValues )
+{
+    if( isClosed_ )
+    {
+        throw std::runtime_error( "Error when writing binary data file " + fileName_ + ", file is already closed" );
+    }
+
+    // Store values by column.
+    double* currentValue = currentBlockValues_.data( ) + numberOfRowsInCurrentBlock_;
+    for( unsigned int i = 0; i < numberOfColumns_; i++ )
+    {
+        *currentValue = rowValues[ i ];
+        currentValue += numberOfRowsPerBlock_;
+    }
+    numberOfRowsInCurrentBlock_++;
+    numberOfRows_++;
+
+    if( numberOfRowsInCurrentBlock_ == numberOfRowsPerBlock_ )
+    {
+        writeCurrentBlock( );
+    }
+}
+
+//! Function to write all remaining rows to the file, and close it.
+void BinaryDataFileWriter::close( )
+{
+    if( isClosed_ )
+    {
+        return;
+    }
+    isClosed_ = true;
+
+    writeCurrentBlock( );
+    waitForAsynchronousWrite( );
+
+    stream_.close( );
+    if( stream_.fail( ) )
+    {
+        throw std::runtime_error( "Error when writing binary data file, could not close file " + fileName_ );
+    }
+}
+
+//! Function to write the current block to the file (directly or asynchronously), and start a new block.
+void BinaryDataFileWriter::writeCurrentBlock( )
+{
+    if( numberOfRowsInCurrentBlock_ == 0 )
+    {
+        return;
+    }
+
+    if( writeAsynchronously_ )
+    {
+        // Wait until previous block has been written, and write current block in separate thread.
+        waitForAsynchronousWrite( );
+        writtenBlockValues_.swap( currentBlockValues_ );
+        currentBlockValues_.resize( numberOfColumns_ * numberOfRowsPerBlock_ );
+        writerThread_ = std::thread( &BinaryDataFileWriter::writeBlock, this, std::cref( writtenBlockValues_ ),
+                                     numberOfRowsInCurrentBlock_ );
+    }
+    else
+    {
+        writeBlock( currentBlockValues_, numberOfRowsInCurrentBlock_ );
+        if( writeException_ )
+        {
+            std::exception_ptr caughtException = writeException_;
+            writeException_ = nullptr;
+            std::rethrow_exception( caughtException );
+        }
+    }
+    numberOfRowsInCurrentBlock_ = 0;
+}
+
+//! Function to write a block to the file.
+void BinaryDataFileWriter::writeBlock( const std::vector< double >& blockValues,
+                                       const unsigned int numberOfRowsInBlock )
+{
+    try
+    {
+        writeUnsignedIntegerToBinaryStream( stream_, numberOfRowsInBlock );
+        for( unsigned int i = 0; i < numberOfColumns_; i++ )
+        {
+            stream_.write( reinterpret_cast< const char* >( blockValues.data( ) + i * numberOfRowsPerBlock_ ),
+                           numberOfRowsInBlock * sizeof( double ) );
+        }
+
+        if( !stream_ )
+        {
+            throw std::runtime_error( "Error when writing binary data file, could not write file " + fileName_ );
+        }
+    }
+    catch( ... )
+    {
+        writeException_ = std::current_exception( );
+    }
+}
+
+//! Function to wait until the block that is being written asynchronously is written, and rethrow any error.
+void BinaryDataFileWriter::waitForAsynchronousWrite( )
+{
+    if( writerThread_.joinable( ) )
+    {
+        writerThread_.join( );
+    }
+
+    if( writeException_ )
+    {
+        std::exception_ptr caughtException = writeException_;
+        writeException_ = nullptr;
+        std::rethrow_exception( caughtException );
+    }
+}
+
+//! Function to check whether a file is a binary data file.
+bool isBinaryDataFile( const boost::filesystem::path& filePath )
+{
+    std::ifstream stream( filePath.string( ).c_str( ), std::ios::binary );
+    char identifier[ 8 ];
+    if( !stream.read( identifier, 8 ) )
+    {
+        return false;
+    }
+    return ( std::memcmp( identifier, binaryDataFileIdentifier, 8 ) == 0 );
+}
+
+//! Function to read a binary data file.
+BinaryDataFileContents readBinaryDataFile( const boost::filesystem::path& filePath )
+{
+    const std::string fileName = filePath.string( );
+    if( !isBinaryDataFile( filePath ) )
+    {
+        throw std::runtime_error( "Error when reading binary data file, " + fileName + " is not a binary data file" );
+    }
+
+    const std::uintmax_t fileSize = boost::filesystem::file_size( filePath );
+    std::ifstream stream( fileName.c_str( ), std::ios::binary );
+    stream.seekg( 8 );
+
+    // Read file header.
+    std::int32_t fileVersion;
+    stream.read( reinterpret_cast< char* >( &fileVersion ), sizeof( std::int32_t ) );
+    if( !stream || fileVersion != binaryDataFileVersion )
+    {
+        throw std::runtime_error( "Error when reading binary data file " + fileName + ", unsupported version " +
+                                  std::to_string( fileVersion ) );
+    }
+
+    BinaryDataFileContents fileContents;
+    const unsigned int numberOfColumns = readUnsignedIntegerFromBinaryStream( stream, fileName );
+    const unsigned int numberOfVariables = readUnsignedIntegerFromBinaryStream( stream, fileName );
+    if( numberOfVariables > fileSize )
+    {
+        throw std::runtime_error( "Error when reading binary data file " + fileName + ", file is truncated" );
+    }
+    for( unsigned int i = 0; i < numberOfVariables; i++ )
+    {
+        BinaryDataFileVariable variable;
+        variable.firstColumn_ = readUnsignedIntegerFromBinaryStream( stream, fileName );
+        variable.size_ = readUnsignedIntegerFromBinaryStream( stream, fileName );
+        variable.name_ = readStringFromBinaryStream( stream, fileName, fileSize );
+        fileContents.variables_.push_back( variable );
+    }
+    fileContents.header_ = readStringFromBinaryStream( stream, fileName, fileSize );
+
+    // Determine total number of rows from block sizes.
+    const std::uintmax_t dataStartPosition = static_cast< std::uintmax_t >( stream.tellg( ) );
+    std::vector< std::pair< std::uintmax_t, unsigned int > > blockPositionsAndSizes;
+    std::uintmax_t currentPosition = dataStartPosition;
+    unsigned long numberOfRows = 0;
+    while( currentPosition < fileSize )
+    {
+        stream.seekg( currentPosition );
+        unsigned int numberOfRowsInBlock = readUnsignedIntegerFromBinaryStream( stream, fileName );
+        currentPosition += sizeof( std::uint32_t );
+        if( numberOfRowsInBlock == 0 || static_cast< std::uintmax_t >( numberOfRowsInBlock ) * numberOfColumns *
+                sizeof( double ) > fileSize - currentPosition )
+        {
+            throw std::runtime_error( "Error when reading binary data file " + fileName + ", file is truncated" );
+        }
+
+        blockPositionsAndSizes.push_back( std::make_pair( currentPosition, numberOfRowsInBlock ) );
+        currentPosition += static_cast< std::uintmax_t >( numberOfRowsInBlock ) * numberOfColumns * sizeof( double );
+        numberOfRows += numberOfRowsInBlock;
+    }
+
+    // Read blocks directly into columns of data matrix.
+    fileContents.data_.resize( numberOfRows, numberOfColumns );
+    unsigned long currentRow = 0;
+    for( unsigned int i = 0; i < blockPositionsAndSizes.size( ); i++ )
+    {
+        const unsigned int numberOfRowsInBlock = blockPositionsAndSizes.at( i ).second;
+        stream.seekg( blockPositionsAndSizes.at( i ).first );
+        for( unsigned int j = 0; j < numberOfColumns; j++ )
+        {
+            stream.read( reinterpret_cast< char* >( fileContents.data_.col( j ).data( ) + currentRow ),
+                         numberOfRowsInBlock * sizeof( double ) );
+        }
+        currentRow += numberOfRowsInBlock;
+    }
+
+    if( !stream )
+    {
+        throw std::runtime_error( "Error when reading binary data file " + fileName + ", could not read file" );
+    }
+
+    return fileContents;
+}
+
+//! Function to read a data map from a binary data file.
+std::map< double, Eigen::VectorXd > readDataMapFromBinaryFile( const boost::filesystem::path& filePath )
+{
+    BinaryDataFileContents fileContents = readBinaryDataFile( filePath );
+    if( fileContents.data_.cols( ) < 1 )
+    {
+        throw std::runtime_error( "Error when reading data map from binary data file " + filePath.string( ) +
+                                  ", file has no columns" );
+    }
+
+    std::map< double, Eigen::VectorXd > dataMap;
+    const int numberOfValueColumns = fileContents.data_.cols( ) - 1;
+    for( int i = 0; i < fileContents.data_.rows( ); i++ )
+    {
+        dataMap[ fileContents.data_( i, 0 ) ] = fileContents.data_.block( i, 1, 1, numberOfValueColumns ).transpose( );
+    }
+    return dataMap;
+}
+
+} // namespace input_output
+} // namespace tudat
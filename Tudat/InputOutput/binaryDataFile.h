@@ -0,0 +1,283 @@
+/*    Copyright (c) 2010-2017, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ */
+
+#ifndef TUDAT_BINARY_DATA_FILE_H
+#define TUDAT_BINARY_DATA_FILE_H
+
+#include <exception>
+#include <fstream>
+#include <map>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <Eigen/Core>
+
+#include <boost/filesystem.hpp>
+
+namespace tudat
+{
+namespace input_output
+{
+
+//! Description of a variable stored in a binary data file.
+/*!
+ *  Description of a variable stored in a binary data file, consisting of a name (e.g. the variable id obtained from
+ *  propagators::getVariableId) and the range of columns of the file in which the variable is stored.
+ */
+struct BinaryDataFileVariable
+{
+    //! Constructor.
+    /*!
+     *  Constructor.
+     *  \param name Name of the variable.
+     *  \param firstColumn Index of the first column in which the variable is stored.
+     *  \param size Number of (consecutive) columns in which the variable is stored.
+     */
+    BinaryDataFileVariable( const std::string& name = "", const unsigned int firstColumn = 0,
+                            const unsigned int size = 1 ):
+        name_( name ), firstColumn_( firstColumn ), size_( size ) { }
+
+    //! Name of the variable.
+    std::string name_;
+
+    //! Index of the first column in which the variable is stored.
+    unsigned int firstColumn_;
+
+    //! Number of (consecutive) columns in which the variable is stored.
+    unsigned int size_;
+};
+
+//! Contents of a binary data file.
+struct BinaryDataFileContents
+{
+    //! Descriptions of the variables stored in the file.
+    std::vector< BinaryDataFileVariable > variables_;
+
+    //! Header (free text) of the file.
+    std::string header_;
+
+    //! Data stored in the file, with one row per entry (e.g. epoch) and one column per file column.
+    Eigen::MatrixXd data_;
+};
+
+//! Class to write a table of double-precision values to a binary data file.
+/*!
+ *  Class to write a table of double-precision values to a binary data file, row by row. The file starts with a header,
+ *  which contains an identifier, the format version, the number of columns, descriptions of the variables stored in the
+ *  columns, and a free text header. The rows are then stored in blocks of (at most) a given number of rows, in which
+ *  the values are stored by column (i.e. all values of the first column of the block, followed by all values of the
+ *  second column, etc.), preceded by the number of rows in the block. Values are stored in the native binary
+ *  representation of the machine, so that no formatting or parsing is required, and the number of rows need not be
+ *  known before writing the file. Rows are buffered in memory until a block is complete. If requested, completed blocks
+ *  are written to the file asynchronously, by a separate thread, while the next block is being filled. The file is
+ *  completed when calling close, or when the object is destroyed.
+ */
+class BinaryDataFileWriter
+{
+public:
+
+    //! Constructor, opens the file and writes the file header.
+    /*!
+     *  Constructor, opens the file and writes the file header. The directory of the file is created if it does not
+     *  exist.
+     *  \param filePath Path of the file that is to be written.
+     *  \param numberOfColumns Number of columns of the table.
+     *  \param variables Descriptions of the variables stored in the columns of the table.
+     *  \param header Free text header of the file.
+     *  \param writeAsynchronously Boolean denoting whether completed blocks are to be written to the file by a separate
+     *  thread.
+     *  \param numberOfRowsPerBlock Maximum number of rows in a block.
+     */
+    BinaryDataFileWriter( const boost::filesystem::path& filePath,
+                          const unsigned int numberOfColumns,
+                          const std::vector< BinaryDataFileVariable >& variables =
+            std::vector< BinaryDataFileVariable >( ),
+                          const std::string& header = "",
+                          const bool writeAsynchronously = false,
+                          const unsigned int numberOfRowsPerBlock = 4096 );
+
+    //! Destructor, completes the file (if close has not been called).
+    ~BinaryDataFileWriter( );
+
+    //! Function to add a row to the table.
+    /*!
+     *  Function to add a row to the table. The row is written to the file once the current block is complete.
+     *  \param row Values of the row (size must be equal to the number of columns).
+     */
+    void addRow( const Eigen::VectorXd& row );
+
+    //! Function to add a row to the table.
+    /*!
+     *  Function to add a row to the table, with the values provided as a contiguous array.
+     *  \param rowValues Pointer to first of numberOfColumns values of the row.
+     */
+    void addRow( const double* rowValues );
+
+    //! Function to write all remaining rows to the file, and close it.
+    /*!
+     *  Function to write all remaining rows to the file, and close it. No rows may be added afterwards.
+     */
+    void close( );
+
+    //! Function to retrieve the number of columns of the table.
+    /*!
+     *  Function to retrieve the number of columns of the table.
+     *  \return Number of columns of the table.
+     */
+    unsigned int getNumberOfColumns( ) const
+    {
+        return numberOfColumns_;
+    }
+
+    //! Function to retrieve the number of rows that have been added to the table.
+    /*!
+     *  Function to retrieve the number of rows that have been added to the table (including those that have not yet
+     *  been written to the file).
+     *  \return Number of rows that have been added to the table.
+     */
+    unsigned long getNumberOfRows( ) const
+    {
+        return numberOfRows_;
+    }
+
+private:
+
+    //! Function to write the current block to the file (directly or asynchronously), and start a new block.
+    void writeCurrentBlock( );
+
+    //! Function to write a block to the file.
+    /*!
+     *  Function to write a block to the file. If an error occurs, it is stored in writeException_.
+     *  \param blockValues Values of the block, stored by column, with numberOfRowsPerBlock_ entries per column.
+     *  \param numberOfRowsInBlock Number of rows in the block.
+     */
+    void writeBlock( const std::vector< double >& blockValues, const unsigned int numberOfRowsInBlock );
+
+    //! Function to wait until the block that is being written asynchronously is written, and rethrow any error.
+    void waitForAsynchronousWrite( );
+
+    //! Path of the file that is written.
+    std::string fileName_;
+
+    //! Stream to which the file is written.
+    std::ofstream stream_;
+
+    //! Number of columns of the table.
+    unsigned int numberOfColumns_;
+
+    //! Boolean denoting whether completed blocks are written to the file by a separate thread.
+    bool writeAsynchronously_;
+
+    //! Maximum number of rows in a block.
+    unsigned int numberOfRowsPerBlock_;
+
+    //! Values of the block that is currently being filled, stored by column.
+    std::vector< double > currentBlockValues_;
+
+    //! Number of rows in the block that is currently being filled.
+    unsigned int numberOfRowsInCurrentBlock_;
+
+    //! Values of the block that is being written asynchronously.
+    std::vector< double > writtenBlockValues_;
+
+    //! Thread writing a block asynchronously (not joinable if no block is being written).
+    std::thread writerThread_;
+
+    //! Error that occurred when writing a block asynchronously (null if none).
+    std::exception_ptr writeException_;
+
+    //! Total number of rows that have been added to the table.
+    unsigned long numberOfRows_;
+
+    //! Boolean denoting whether the file has been closed.
+    bool isClosed_;
+};
+
+//! Function to check whether a file is a binary data file.
+/*!
+ *  Function to check whether a file is a binary data file, as written by BinaryDataFileWriter, by checking the
+ *  identifier at the start of the file.
+ *  \param filePath Path of the file.
+ *  \return True if the file exists and is a binary data file, false otherwise.
+ */
+bool isBinaryDataFile( const boost::filesystem::path& filePath );
+
+//! Function to read a binary data file.
+/*!
+ *  Function to read a binary data file, as written by BinaryDataFileWriter.
+ *  \param filePath Path of the file.
+ *  \return Contents (variables, header and data) of the file.
+ */
+BinaryDataFileContents readBinaryDataFile( const boost::filesystem::path& filePath );
+
+//! Function to write a data map to a binary data file.
+/*!
+ *  Function to write a data map to a binary data file, with the keys stored in the first column and the values in the
+ *  subsequent columns (binary equivalent of writeDataMapToTextFile).
+ *  \param dataMap Map with data, all values must have the same size.
+ *  \param filePath Path of the output file.
+ *  \param variables Descriptions of the variables stored in the values of the map (with column indices relative to
+ *  the start of the values). A variable describing the keys is added as first variable.
+ *  \param header Free text header of the file.
+ *  \param writeAsynchronously Boolean denoting whether the file is to be written by a separate thread.
+ *  \param keyName Name of the variable describing the keys of the map.
+ */
+template< typename KeyType, typename ScalarType >
+void writeDataMapToBinaryFile(
+        const std::map< KeyType, Eigen::Matrix< ScalarType, Eigen::Dynamic, 1 > >& dataMap,
+        const boost::filesystem::path& filePath,
+        const std::vector< BinaryDataFileVariable >& variables = std::vector< BinaryDataFileVariable >( ),
+        const std::string& header = "",
+        const bool writeAsynchronously = false,
+        const std::string& keyName = "epoch" )
+{
+    const unsigned int numberOfValueColumns = dataMap.empty( ) ? 0 : dataMap.begin( )->second.rows( );
+
+    // Add key to variable descriptions, and shift other variables by one column.
+    std::vector< BinaryDataFileVariable > fileVariables;
+    fileVariables.push_back( BinaryDataFileVariable( keyName, 0, 1 ) );
+    for( unsigned int i = 0; i < variables.size( ); i++ )
+    {
+        fileVariables.push_back( BinaryDataFileVariable(
+                                     variables.at( i ).name_, variables.at( i ).firstColumn_ + 1,
+                                     variables.at( i ).size_ ) );
+    }
+
+    BinaryDataFileWriter writer( filePath, numberOfValueColumns + 1, fileVariables, header, writeAsynchronously );
+    Eigen::VectorXd row( numberOfValueColumns + 1 );
+    for( auto mapIterator = dataMap.begin( ); mapIterator != dataMap.end( ); mapIterator++ )
+    {
+        if( static_cast< unsigned int >( mapIterator->second.rows( ) ) != numberOfValueColumns )
+        {
+            throw std::runtime_error( "Error when writing data map to binary file " + filePath.string( ) +
+                                      ", values are of inconsistent size" );
+        }
+        row( 0 ) = static_cast< double >( mapIterator->first );
+        row.segment( 1, numberOfValueColumns ) = mapIterator->second.template cast< double >( );
+        writer.addRow( row );
+    }
+    writer.close( );
+}
+
+//! Function to read a data map from a binary data file.
+/*!
+ *  Function to read a data map from a binary data file, with the keys taken from the first column and the values from
+ *  the subsequent columns (as written by writeDataMapToBinaryFile).
+ *  \param filePath Path of the file.
+ *  \return Map with data read from file.
+ */
+std::map< double, Eigen::VectorXd > readDataMapFromBinaryFile( const boost::filesystem::path& filePath );
+
+} // namespace input_output
+} // namespace tudat
+
+#endif // TUDAT_BINARY_DATA_FILE_H
@@ -81,7 +81,7 @@ boost::shared_ptr< SolarActivityData > ExtractSolarActivityData::extract(
     {
         solarActivityContainer->dataType = getField< unsigned int >( data, dataType );
     }
-    catch( std::bad_cast )
+    catch( const std::bad_cast& )
     {
         solarActivityContainer->dataType = std::numeric_limits< unsigned int >::max( );
     }
@@ -11,6 +11,8 @@
 
 #include "Tudat/InputOutput/fixedWidthParser.h"
 
+#include <stdexcept>
+
 #include <boost/algorithm/string.hpp>
 
 namespace tudat
@@ -46,6 +48,17 @@ FixedWidthParser::FixedWidthParser( int numberOfFields, ... ) : TextParser( fals
     va_end( listOfArguments );
 }
 
+//! Create a parser that parses based on specified field widths and field type list.
+FixedWidthParser::FixedWidthParser( const std::vector< FieldType >& fieldTypes, const std::vector< int >& fieldWidths ):
+    TextParser( false ), numberOfFields_( fieldTypes.size( ) ), typeList( fieldTypes ), sizeList( fieldWidths ),
+    doTrim( true )
+{
+    if( fieldTypes.size( ) != fieldWidths.size( ) )
+    {
+        throw std::runtime_error( "Error when creating fixed-width parser, number of field types and widths differ." );
+    }
+}
+
 //! Parses one line of text.
 void FixedWidthParser::parseLine( std::string& line )
 {
@@ -39,6 +39,14 @@ public:
      */
     FixedWidthParser( int numberOfFields, ... );
 
+    //! Create a parser that parses based on specified field widths and field type list.
+    /*!
+     * Create a parser that parses based on specified field widths and field type list, provided as vectors.
+     * \param fieldTypes Types of fields that are to be parsed.
+     * \param fieldWidths Widths of fields that are to be parsed (same size as fieldTypes).
+     */
+    FixedWidthParser( const std::vector< FieldType >& fieldTypes, const std::vector< int >& fieldWidths );
+
     //! Set trim: Trim whitespace off fields (default=true).
     void setTrim( bool trim ) { doTrim = trim; }
 
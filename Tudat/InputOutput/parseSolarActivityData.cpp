@@ -28,30 +28,45 @@ namespace input_output
 namespace solar_activity
 {
 
-//! Parses the stream of text.
-void ParseSolarActivityData::parseStream( std::istream& fileContent)
+//! Function to retrieve the types of the fixed-width fields on a line of a SpaceWeather data file.
+const std::vector< FieldType >& getSolarActivityDataFieldTypes( )
 {
-
     using namespace tudat::input_output::field_types::solar_activity;
     using namespace tudat::input_output::field_types::time;
 
+    static const FieldType fieldTypes[ numberOfSolarActivityDataFields ] =
+    { year, month, day, bartelsSolarRotationNumber, dayOfBartelsCycle,
+      planetaryRangeIndex0to3, planetaryRangeIndex3to6, planetaryRangeIndex6to9,
+      planetaryRangeIndex9to12, planetaryRangeIndex12to15, planetaryRangeIndex15to18,
+      planetaryRangeIndex18to21, planetaryRangeIndex21to24, planetaryRangeIndexSum,
+      planetaryEquivalentAmplitude0to3, planetaryEquivalentAmplitude3to6,
+      planetaryEquivalentAmplitude6to9, planetaryEquivalentAmplitude9to12,
+      planetaryEquivalentAmplitude12to15, planetaryEquivalentAmplitude15to18,
+      planetaryEquivalentAmplitude18to21, planetaryEquivalentAmplitude21to24,
+      planetaryEquivalentAmplitudeAverage, planetaryDailyCharacterFigure,
+      planetaryDailyCharacterFigureConverted, internationalSunspotNumber,
+      solarRadioFlux107Adjusted, fluxQualifier, centered81DaySolarRadioFlux107Adjusted,
+      last81DaySolarRadioFlux107Adjusted, solarRadioFlux107Observed,
+      centered81DaySolarRadioFlux107Observed, last81DaySolarRadioFlux107Observed, dataType };
+    static const std::vector< FieldType > fieldTypeVector( fieldTypes, fieldTypes + numberOfSolarActivityDataFields );
+    return fieldTypeVector;
+}
+
+//! Function to retrieve the widths of the fixed-width fields on a line of a SpaceWeather data file.
+const std::vector< int >& getSolarActivityDataFieldWidths( )
+{
+    static const int fieldWidths[ numberOfSolarActivityDataFields ] =
+    { 4, 3, 3, 5, 3, 3, 3, 3, 3, 3, 3, 3, 3, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 2, 4, 6, 2, 6, 6, 6, 6, 6, 2 };
+    static const std::vector< int > fieldWidthVector( fieldWidths, fieldWidths + numberOfSolarActivityDataFields );
+    return fieldWidthVector;
+}
+
+//! Parses the stream of text.
+void ParseSolarActivityData::parseStream( std::istream& fileContent)
+{
     // Construct FixedWidthParser containing the fieldtypes occuring in the solar activity file
     tudat::input_output::FixedWidthParser solarParser(
-            34, year, month, day, bartelsSolarRotationNumber, dayOfBartelsCycle,
-            planetaryRangeIndex0to3, planetaryRangeIndex3to6, planetaryRangeIndex6to9,
-            planetaryRangeIndex9to12, planetaryRangeIndex12to15, planetaryRangeIndex15to18,
-            planetaryRangeIndex18to21, planetaryRangeIndex21to24, planetaryRangeIndexSum,
-            planetaryEquivalentAmplitude0to3, planetaryEquivalentAmplitude3to6,
-            planetaryEquivalentAmplitude6to9, planetaryEquivalentAmplitude9to12,
-            planetaryEquivalentAmplitude12to15, planetaryEquivalentAmplitude15to18,
-            planetaryEquivalentAmplitude18to21, planetaryEquivalentAmplitude21to24,
-            planetaryEquivalentAmplitudeAverage, planetaryDailyCharacterFigure,
-            planetaryDailyCharacterFigureConverted, internationalSunspotNumber,
-            solarRadioFlux107Adjusted, fluxQualifier, centered81DaySolarRadioFlux107Adjusted,
-            last81DaySolarRadioFlux107Adjusted, solarRadioFlux107Observed,
-            centered81DaySolarRadioFlux107Observed, last81DaySolarRadioFlux107Observed, dataType,
-            4, 3, 3, 5, 3, 3, 3, 3, 3, 3, 3, 3, 3, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 2, 4, 6, 2, 6,
-            6, 6, 6, 6, 2 );
+                getSolarActivityDataFieldTypes( ), getSolarActivityDataFieldWidths( ) );
 
     // String containing line to be parsed
     std::string line;
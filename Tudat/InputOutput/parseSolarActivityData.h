@@ -19,6 +19,8 @@
 #ifndef TUDAT_PARSESOLARACTIVITY_H
 #define TUDAT_PARSESOLARACTIVITY_H
 
+#include <vector>
+
 #include "Tudat/InputOutput/parsedDataVectorUtilities.h"
 #include "Tudat/InputOutput/textParser.h"
 
@@ -108,6 +110,25 @@ namespace input_output
 namespace solar_activity
 {
 
+//! Number of fixed-width fields on a line of a SpaceWeather data file (with the data type appended to the line).
+static const unsigned int numberOfSolarActivityDataFields = 34;
+
+//! Function to retrieve the types of the fixed-width fields on a line of a SpaceWeather data file.
+/*!
+ * Function to retrieve the types of the fixed-width fields on a line of a SpaceWeather data file, in the order in which
+ * they occur on the line (with the data type appended to the line, as done by ParseSolarActivityData).
+ * \return Types of fields on a line of a SpaceWeather data file.
+ */
+const std::vector< FieldType >& getSolarActivityDataFieldTypes( );
+
+//! Function to retrieve the widths of the fixed-width fields on a line of a SpaceWeather data file.
+/*!
+ * Function to retrieve the widths of the fixed-width fields on a line of a SpaceWeather data file, in the order in
+ * which they occur on the line (with the data type appended to the line, as done by ParseSolarActivityData).
+ * \return Widths of fields on a line of a SpaceWeather data file.
+ */
+const std::vector< int >& getSolarActivityDataFieldWidths( );
+
 //! Solar activity parser class.
 /*!
  * This class implements a fixed width parser specifically designed for parsing solar activity
@@ -15,10 +15,20 @@
  *
  */
 
+#include <algorithm>
+#include <cctype>
+#include <cstring>
+#include <fstream>
 #include <istream>
+#include <limits>
 #include <string>
 #include <vector>
 
+#include <boost/cstdint.hpp>
+#include <boost/interprocess/file_mapping.hpp>
+#include <boost/interprocess/mapped_region.hpp>
+#include <boost/lexical_cast.hpp>
+#include <boost/make_shared.hpp>
 #include <boost/test/unit_test.hpp>
 
 #include "Tudat/Basics/testMacros.h"
@@ -93,41 +103,462 @@ std::ostream& operator << ( std::ostream& stream,
     return stream;
 }
 
-//! This function reads a SpaceWeather data file and returns a map with SolarActivityData
-SolarActivityDataMap readSolarActivityData( std::string filePath )
+//! Function to retrieve the index of a field on a line of a SpaceWeather data file.
+/*!
+ * Function to retrieve the index of a field on a line of a SpaceWeather data file, as defined by
+ * getSolarActivityDataFieldTypes.
+ * \param fieldType Type of field for which the index is to be retrieved.
+ * \return Index of field on line.
+ */
+static unsigned int getSolarActivityDataFieldIndex( const FieldType fieldType )
+{
+    const std::vector< FieldType >& fieldTypes = getSolarActivityDataFieldTypes( );
+    return static_cast< unsigned int >(
+                std::find( fieldTypes.begin( ), fieldTypes.end( ), fieldType ) - fieldTypes.begin( ) );
+}
+
+//! Function to convert a field of a SpaceWeather data file line.
+/*!
+ * Function to convert a fixed-width field of a SpaceWeather data file line, after trimming leading and trailing
+ * whitespace (identical to the conversion by FixedWidthParser and FieldValue).
+ * \param fieldStart Pointers to first character of fields.
+ * \param fieldEnd Pointers to one past the last character of fields.
+ * \param fieldIndex Index of field that is to be converted.
+ * \return Converted field.
+ */
+template< typename T >
+static T convertSolarActivityDataField( const char* const* fieldStart, const char* const* fieldEnd,
+                                        const unsigned int fieldIndex )
 {
-    // Data Vector container
-    tudat::input_output::parsed_data_vector_utilities::ParsedDataVectorPtr parsedDataVector;
+    return boost::lexical_cast< T >( fieldStart[ fieldIndex ],
+                                     static_cast< std::size_t >( fieldEnd[ fieldIndex ] - fieldStart[ fieldIndex ] ) );
+}
 
-    // datafile Parser and Extractor
-    tudat::input_output::solar_activity::ParseSolarActivityData solarActivityParser;
-    tudat::input_output::solar_activity::ExtractSolarActivityData solarActivityExtractor;
+//! Function to parse a line of a SpaceWeather data file.
+/*!
+ * Function to parse a line of a SpaceWeather data file in a single pass over its fixed-width fields (as defined by
+ * getSolarActivityDataFieldTypes and getSolarActivityDataFieldWidths), without creating intermediate parsed data
+ * objects. Only non-empty Kp/Ap, Cp/C9, sunspot number and flux qualifier fields are extracted, as in
+ * ExtractSolarActivityData.
+ * \param line Line of data file, with data type appended (as in ParseSolarActivityData).
+ * \return Solar activity data on line.
+ */
+static SolarActivityDataPtr parseSolarActivityDataLine( const std::string& line )
+{
+    using namespace tudat::input_output::field_types::solar_activity;
+    using namespace tudat::input_output::field_types::time;
+
+    static const std::vector< int >& fieldWidths = getSolarActivityDataFieldWidths( );
+
+    static const unsigned int yearIndex = getSolarActivityDataFieldIndex( year );
+    static const unsigned int monthIndex = getSolarActivityDataFieldIndex( month );
+    static const unsigned int dayIndex = getSolarActivityDataFieldIndex( day );
+    static const unsigned int bartelsSolarRotationNumberIndex =
+            getSolarActivityDataFieldIndex( bartelsSolarRotationNumber );
+    static const unsigned int dayOfBartelsCycleIndex = getSolarActivityDataFieldIndex( dayOfBartelsCycle );
+    static const unsigned int planetaryRangeIndexIndices[ 8 ] =
+    { getSolarActivityDataFieldIndex( planetaryRangeIndex0to3 ),
+      getSolarActivityDataFieldIndex( planetaryRangeIndex3to6 ),
+      getSolarActivityDataFieldIndex( planetaryRangeIndex6to9 ),
+      getSolarActivityDataFieldIndex( planetaryRangeIndex9to12 ),
+      getSolarActivityDataFieldIndex( planetaryRangeIndex12to15 ),
+      getSolarActivityDataFieldIndex( planetaryRangeIndex15to18 ),
+      getSolarActivityDataFieldIndex( planetaryRangeIndex18to21 ),
+      getSolarActivityDataFieldIndex( planetaryRangeIndex21to24 ) };
+    static const unsigned int planetaryRangeIndexSumIndex = getSolarActivityDataFieldIndex( planetaryRangeIndexSum );
+    static const unsigned int planetaryEquivalentAmplitudeIndices[ 8 ] =
+    { getSolarActivityDataFieldIndex( planetaryEquivalentAmplitude0to3 ),
+      getSolarActivityDataFieldIndex( planetaryEquivalentAmplitude3to6 ),
+      getSolarActivityDataFieldIndex( planetaryEquivalentAmplitude6to9 ),
+      getSolarActivityDataFieldIndex( planetaryEquivalentAmplitude9to12 ),
+      getSolarActivityDataFieldIndex( planetaryEquivalentAmplitude12to15 ),
+      getSolarActivityDataFieldIndex( planetaryEquivalentAmplitude15to18 ),
+      getSolarActivityDataFieldIndex( planetaryEquivalentAmplitude18to21 ),
+      getSolarActivityDataFieldIndex( planetaryEquivalentAmplitude21to24 ) };
+    static const unsigned int planetaryEquivalentAmplitudeAverageIndex =
+            getSolarActivityDataFieldIndex( planetaryEquivalentAmplitudeAverage );
+    static const unsigned int planetaryDailyCharacterFigureIndex =
+            getSolarActivityDataFieldIndex( planetaryDailyCharacterFigure );
+    static const unsigned int planetaryDailyCharacterFigureConvertedIndex =
+            getSolarActivityDataFieldIndex( planetaryDailyCharacterFigureConverted );
+    static const unsigned int internationalSunspotNumberIndex =
+            getSolarActivityDataFieldIndex( internationalSunspotNumber );
+    static const unsigned int solarRadioFlux107AdjustedIndex =
+            getSolarActivityDataFieldIndex( solarRadioFlux107Adjusted );
+    static const unsigned int fluxQualifierIndex = getSolarActivityDataFieldIndex( fluxQualifier );
+    static const unsigned int centered81DaySolarRadioFlux107AdjustedIndex =
+            getSolarActivityDataFieldIndex( centered81DaySolarRadioFlux107Adjusted );
+    static const unsigned int last81DaySolarRadioFlux107AdjustedIndex =
+            getSolarActivityDataFieldIndex( last81DaySolarRadioFlux107Adjusted );
+    static const unsigned int solarRadioFlux107ObservedIndex =
+            getSolarActivityDataFieldIndex( solarRadioFlux107Observed );
+    static const unsigned int centered81DaySolarRadioFlux107ObservedIndex =
+            getSolarActivityDataFieldIndex( centered81DaySolarRadioFlux107Observed );
+    static const unsigned int last81DaySolarRadioFlux107ObservedIndex =
+            getSolarActivityDataFieldIndex( last81DaySolarRadioFlux107Observed );
+    static const unsigned int dataTypeIndex = getSolarActivityDataFieldIndex( dataType );
+
+    // Determine trimmed fields.
+    const char* fieldStart[ numberOfSolarActivityDataFields ];
+    const char* fieldEnd[ numberOfSolarActivityDataFields ];
+    std::size_t currentFieldIndex = 0;
+    for( unsigned int i = 0; i < numberOfSolarActivityDataFields; i++ )
+    {
+        if( currentFieldIndex > line.size( ) )
+        {
+            throw std::runtime_error( "Error when reading solar activity data, line is too short: " + line );
+        }
+
+        const char* start = line.c_str( ) + currentFieldIndex;
+        const char* end = line.c_str( ) +
+                std::min( currentFieldIndex + static_cast< std::size_t >( fieldWidths[ i ] ), line.size( ) );
+        while( start < end && std::isspace( static_cast< unsigned char >( *start ) ) )
+        {
+            start++;
+        }
+        while( end > start && std::isspace( static_cast< unsigned char >( *( end - 1 ) ) ) )
+        {
+            end--;
+        }
+        fieldStart[ i ] = start;
+        fieldEnd[ i ] = end;
+
+        currentFieldIndex += fieldWidths[ i ];
+    }
+
+    SolarActivityDataPtr solarActivityData = boost::make_shared< SolarActivityData >( );
+    solarActivityData->year = convertSolarActivityDataField< unsigned int >( fieldStart, fieldEnd, yearIndex );
+    solarActivityData->month = convertSolarActivityDataField< unsigned int >( fieldStart, fieldEnd, monthIndex );
+    solarActivityData->day = convertSolarActivityDataField< unsigned int >( fieldStart, fieldEnd, dayIndex );
+    solarActivityData->bartelsSolarRotationNumber =
+            convertSolarActivityDataField< unsigned int >( fieldStart, fieldEnd, bartelsSolarRotationNumberIndex );
+    solarActivityData->dayOfBartelsCycle =
+            convertSolarActivityDataField< unsigned int >( fieldStart, fieldEnd, dayOfBartelsCycleIndex );
+    solarActivityData->solarRadioFlux107Adjusted =
+            convertSolarActivityDataField< double >( fieldStart, fieldEnd, solarRadioFlux107AdjustedIndex );
+    solarActivityData->centered81DaySolarRadioFlux107Adjusted = convertSolarActivityDataField< double >(
+                fieldStart, fieldEnd, centered81DaySolarRadioFlux107AdjustedIndex );
+    solarActivityData->last81DaySolarRadioFlux107Adjusted = convertSolarActivityDataField< double >(
+                fieldStart, fieldEnd, last81DaySolarRadioFlux107AdjustedIndex );
+    solarActivityData->solarRadioFlux107Observed =
+            convertSolarActivityDataField< double >( fieldStart, fieldEnd, solarRadioFlux107ObservedIndex );
+    solarActivityData->centered81DaySolarRadioFlux107Observed = convertSolarActivityDataField< double >(
+                fieldStart, fieldEnd, centered81DaySolarRadioFlux107ObservedIndex );
+    solarActivityData->last81DaySolarRadioFlux107Observed = convertSolarActivityDataField< double >(
+                fieldStart, fieldEnd, last81DaySolarRadioFlux107ObservedIndex );
+    try
+    {
+        solarActivityData->dataType =
+                convertSolarActivityDataField< unsigned int >( fieldStart, fieldEnd, dataTypeIndex );
+    }
+    catch( const std::bad_cast& )
+    {
+        solarActivityData->dataType = std::numeric_limits< unsigned int >::max( );
+    }
 
+    // Make sure only non-empty fields are extracted
+    if( fieldStart[ planetaryRangeIndexIndices[ 0 ] ] != fieldEnd[ planetaryRangeIndexIndices[ 0 ] ] )
+    {
+        for( unsigned int i = 0; i < 8; i++ )
+        {
+            solarActivityData->planetaryRangeIndexVector( i ) = convertSolarActivityDataField< unsigned int >(
+                        fieldStart, fieldEnd, planetaryRangeIndexIndices[ i ] );
+            solarActivityData->planetaryEquivalentAmplitudeVector( i ) = convertSolarActivityDataField< unsigned int >(
+                        fieldStart, fieldEnd, planetaryEquivalentAmplitudeIndices[ i ] );
+        }
+        solarActivityData->planetaryRangeIndexSum =
+                convertSolarActivityDataField< unsigned int >( fieldStart, fieldEnd, planetaryRangeIndexSumIndex );
+        solarActivityData->planetaryEquivalentAmplitudeAverage = convertSolarActivityDataField< unsigned int >(
+                    fieldStart, fieldEnd, planetaryEquivalentAmplitudeAverageIndex );
+    }
+
+    if( fieldStart[ planetaryDailyCharacterFigureIndex ] != fieldEnd[ planetaryDailyCharacterFigureIndex ] )
+    {
+        solarActivityData->planetaryDailyCharacterFigure = convertSolarActivityDataField< double >(
+                    fieldStart, fieldEnd, planetaryDailyCharacterFigureIndex );
+        solarActivityData->planetaryDailyCharacterFigureConverted = convertSolarActivityDataField< unsigned int >(
+                    fieldStart, fieldEnd, planetaryDailyCharacterFigureConvertedIndex );
+    }
+
+    if( fieldStart[ internationalSunspotNumberIndex ] != fieldEnd[ internationalSunspotNumberIndex ] )
+    {
+        solarActivityData->internationalSunspotNumber =
+                convertSolarActivityDataField< unsigned int >( fieldStart, fieldEnd, internationalSunspotNumberIndex );
+    }
+
+    if( fieldStart[ fluxQualifierIndex ] != fieldEnd[ fluxQualifierIndex ] )
+    {
+        solarActivityData->fluxQualifier =
+                convertSolarActivityDataField< unsigned int >( fieldStart, fieldEnd, fluxQualifierIndex );
+    }
+
+    return solarActivityData;
+}
+
+//! Function to add solar activity data to a data map.
+/*!
+ * Function to add solar activity data to a data map, with the Julian day of the data as key. Data is (in general)
+ * sorted by date, so that it is inserted at the end of the map. Data with a date already in the map replaces the
+ * existing data.
+ * \param dataMap Data map to which data is to be added.
+ * \param solarActivityData Data that is to be added.
+ */
+static void addSolarActivityDataToMap( SolarActivityDataMap& dataMap, const SolarActivityDataPtr solarActivityData )
+{
+    double julianDate = tudat::basic_astrodynamics::convertCalendarDateToJulianDay(
+                solarActivityData->year, solarActivityData->month, solarActivityData->day, 0, 0, 0.0 );
+    dataMap.insert( dataMap.end( ), std::make_pair( julianDate, solarActivityData ) )->second = solarActivityData;
+}
+
+//! This function reads a SpaceWeather data file and returns a map with SolarActivityData
+SolarActivityDataMap readSolarActivityData( std::string filePath )
+{
+    if( isBinarySolarActivityDataFile( filePath ) )
+    {
+        return readBinarySolarActivityDataFile( filePath );
+    }
 
-    // Open dataFile and Parse
+    // Open dataFile
     std::ifstream dataFile;
     dataFile.open( filePath.c_str( ), std::ifstream::in );
-    parsedDataVector = solarActivityParser.parse( dataFile );
-    dataFile.close( );
 
-    int numberOfLines = parsedDataVector->size( );
     SolarActivityDataMap dataMap;
-    double julianDate = TUDAT_NAN;
 
-    // Save each line to datamap
-    for(int i = 0 ; i < numberOfLines ; i++ ){
-        julianDate = tudat::basic_astrodynamics::convertCalendarDateToJulianDay(
-                    solarActivityExtractor.extract( parsedDataVector->at( i ) )->year,
-                    solarActivityExtractor.extract( parsedDataVector->at( i ) )->month,
-                    solarActivityExtractor.extract( parsedDataVector->at( i ) )->day,
-                    0, 0, 0.0 ) ;
-        dataMap[ julianDate ] = solarActivityExtractor.extract( parsedDataVector->at( i ) ) ;
+    // Parse lines in data blocks (observed/daily predicted/monthly predicted/monthly fit), and save each line to datamap
+    std::string line;
+    int dataType = 0;
+    bool validdata = false;
+    while ( std::getline( dataFile, line ) )
+    {
+        // Determine dataType of line (observed/daily predicted/monthly predicted/monthly fit)
+        if ( line.compare( 0, 14, "BEGIN OBSERVED" ) == 0 )
+        {
+            dataType = 1;
+            validdata = true;
+        }
+        else if ( line.compare( 0, 21, "BEGIN DAILY_PREDICTED" ) == 0 )
+        {
+            dataType = 2;
+            validdata = true;
+        }
+        else if ( line.compare( 0, 23, "BEGIN MONTHLY_PREDICTED" ) == 0 )
+        {
+            dataType = 3;
+            validdata = true;
+        }
+        else if ( line.compare( 0, 17, "BEGIN MONTHLY_FIT" ) == 0 )
+        {
+            dataType = 4;
+            validdata = true;
+        }
+        else if ( line.compare( 0, 12, "END OBSERVED" ) == 0 ||
+                  line.compare( 0, 19, "END DAILY_PREDICTED" ) == 0 ||
+                  line.compare( 0, 21, "END MONTHLY_PREDICTED" ) == 0 ||
+                  line.compare( 0, 15, "END MONTHLY_FIT" ) == 0 )
+        {
+            validdata = false;
+        }
+        else if ( validdata )
+        {
+            // Add datatype at the end of the line (as in ParseSolarActivityData), and parse line
+            addSolarActivityDataToMap( dataMap, parseSolarActivityDataLine(
+                                           line + " " + std::to_string( dataType ) ) );
+        }
     }
 
     return dataMap;
 
 }
 
+//! Identifier at start of binary solar activity data file.
+static const char binarySolarActivityDataFileIdentifier[ 8 ] = { 'T', 'U', 'D', 'A', 'T', 'S', 'W', 'D' };
+
+//! Version of binary solar activity data file format.
+static const int binarySolarActivityDataFileVersion = 1;
+
+//! Size (in bytes) of header of binary solar activity data file (identifier, version, unused, number of entries).
+static const std::size_t binarySolarActivityDataFileHeaderSize = 24;
+
+//! Number of data columns in binary solar activity data file.
+/*!
+ * Number of data columns in binary solar activity data file: year, month, day, Bartels solar rotation number, day of
+ * Bartels cycle, 8 Kp values, Kp sum, 8 Ap values, Ap average, Cp, C9, sunspot number, F10.7 (adjusted), flux
+ * qualifier, centered and last 81-day F10.7 (adjusted), F10.7 (observed), centered and last 81-day F10.7 (observed)
+ * and data type.
+ */
+static const std::size_t numberOfBinarySolarActivityDataFileColumns = 34;
+
+//! Function to check whether a file is a binary solar activity data file
+bool isBinarySolarActivityDataFile( const std::string& filePath )
+{
+    std::ifstream stream( filePath.c_str( ), std::ios::binary );
+    char identifier[ 8 ];
+    if( !stream.read( identifier, 8 ) )
+    {
+        return false;
+    }
+    return ( std::memcmp( identifier, binarySolarActivityDataFileIdentifier, 8 ) == 0 );
+}
+
+//! Function to write solar activity data to a binary file
+void writeBinarySolarActivityDataFile( const SolarActivityDataMap& solarActivityData, const std::string& filePath )
+{
+    // Collect data in columns.
+    const boost::uint64_t numberOfEntries = solarActivityData.size( );
+    std::vector< double > columns( numberOfBinarySolarActivityDataFileColumns * numberOfEntries );
+    std::size_t currentEntry = 0;
+    for( SolarActivityDataMap::const_iterator dataIterator = solarActivityData.begin( );
+         dataIterator != solarActivityData.end( ); dataIterator++ )
+    {
+        const SolarActivityData& currentData = *dataIterator->second;
+        double* currentColumnEntry = columns.data( ) + currentEntry;
+
+        double entryValues[ numberOfBinarySolarActivityDataFileColumns ] =
+        { static_cast< double >( currentData.year ), static_cast< double >( currentData.month ),
+          static_cast< double >( currentData.day ), static_cast< double >( currentData.bartelsSolarRotationNumber ),
+          static_cast< double >( currentData.dayOfBartelsCycle ),
+          currentData.planetaryRangeIndexVector( 0 ), currentData.planetaryRangeIndexVector( 1 ),
+          currentData.planetaryRangeIndexVector( 2 ), currentData.planetaryRangeIndexVector( 3 ),
+          currentData.planetaryRangeIndexVector( 4 ), currentData.planetaryRangeIndexVector( 5 ),
+          currentData.planetaryRangeIndexVector( 6 ), currentData.planetaryRangeIndexVector( 7 ),
+          static_cast< double >( currentData.planetaryRangeIndexSum ),
+          currentData.planetaryEquivalentAmplitudeVector( 0 ), currentData.planetaryEquivalentAmplitudeVector( 1 ),
+          currentData.planetaryEquivalentAmplitudeVector( 2 ), currentData.planetaryEquivalentAmplitudeVector( 3 ),
+          currentData.planetaryEquivalentAmplitudeVector( 4 ), currentData.planetaryEquivalentAmplitudeVector( 5 ),
+          currentData.planetaryEquivalentAmplitudeVector( 6 ), currentData.planetaryEquivalentAmplitudeVector( 7 ),
+          static_cast< double >( currentData.planetaryEquivalentAmplitudeAverage ),
+          currentData.planetaryDailyCharacterFigure,
+          static_cast< double >( currentData.planetaryDailyCharacterFigureConverted ),
+          static_cast< double >( currentData.internationalSunspotNumber ),
+          currentData.solarRadioFlux107Adjusted, static_cast< double >( currentData.fluxQualifier ),
+          currentData.centered81DaySolarRadioFlux107Adjusted, currentData.last81DaySolarRadioFlux107Adjusted,
+          currentData.solarRadioFlux107Observed, currentData.centered81DaySolarRadioFlux107Observed,
+          currentData.last81DaySolarRadioFlux107Observed, static_cast< double >( currentData.dataType ) };
+
+        for( std::size_t i = 0; i < numberOfBinarySolarActivityDataFileColumns; i++ )
+        {
+            currentColumnEntry[ i * numberOfEntries ] = entryValues[ i ];
+        }
+        currentEntry++;
+    }
+
+    std::ofstream stream( filePath.c_str( ), std::ios::binary | std::ios::trunc );
+    if( !stream.good( ) )
+    {
+        throw std::runtime_error( "Error when writing binary solar activity data file, could not open file " +
+                                  filePath );
+    }
+
+    const int unusedHeaderEntry = 0;
+    stream.write( binarySolarActivityDataFileIdentifier, 8 );
+    stream.write( reinterpret_cast< const char* >( &binarySolarActivityDataFileVersion ), 4 );
+    stream.write( reinterpret_cast< const char* >( &unusedHeaderEntry ), 4 );
+    stream.write( reinterpret_cast< const char* >( &numberOfEntries ), 8 );
+    stream.write( reinterpret_cast< const char* >( columns.data( ) ), sizeof( double ) * columns.size( ) );
+
+    if( !stream.good( ) )
+    {
+        throw std::runtime_error( "Error when writing binary solar activity data file, could not write file " +
+                                  filePath );
+    }
+}
+
+//! Function to read solar activity data from a binary file
+SolarActivityDataMap readBinarySolarActivityDataFile( const std::string& filePath )
+{
+    using namespace boost::interprocess;
+
+    // Read and check header.
+    std::size_t fileSize = 0;
+    char header[ binarySolarActivityDataFileHeaderSize ];
+    {
+        std::ifstream stream( filePath.c_str( ), std::ios::binary );
+        if( !stream.read( header, binarySolarActivityDataFileHeaderSize ) ||
+                std::memcmp( header, binarySolarActivityDataFileIdentifier, 8 ) != 0 )
+        {
+            throw std::runtime_error( "Error when reading binary solar activity data file, " + filePath +
+                                      " is not a binary solar activity data file" );
+        }
+        stream.seekg( 0, std::ios::end );
+        fileSize = static_cast< std::size_t >( stream.tellg( ) );
+    }
+
+    int fileVersion;
+    boost::uint64_t numberOfEntries;
+    std::memcpy( &fileVersion, header + 8, 4 );
+    std::memcpy( &numberOfEntries, header + 16, 8 );
+
+    if( fileVersion != binarySolarActivityDataFileVersion )
+    {
+        throw std::runtime_error( "Error when reading binary solar activity data file " + filePath +
+                                  ", unsupported version " + std::to_string( fileVersion ) );
+    }
+
+    if( fileSize != binarySolarActivityDataFileHeaderSize +
+            sizeof( double ) * numberOfBinarySolarActivityDataFileColumns * numberOfEntries )
+    {
+        throw std::runtime_error( "Error when reading binary solar activity data file " + filePath +
+                                  ", file size is inconsistent with header" );
+    }
+
+    SolarActivityDataMap dataMap;
+    if( numberOfEntries > 0 )
+    {
+        try
+        {
+            file_mapping solarActivityDataFile( filePath.c_str( ), read_only );
+            mapped_region mappedSolarActivityData( solarActivityDataFile, read_only );
+
+            const double* columns = reinterpret_cast< const double* >(
+                        static_cast< const char* >( mappedSolarActivityData.get_address( ) ) +
+                        binarySolarActivityDataFileHeaderSize );
+            for( std::size_t j = 0; j < numberOfEntries; j++ )
+            {
+                const double* entry = columns + j;
+                SolarActivityDataPtr solarActivityData = boost::make_shared< SolarActivityData >( );
+                solarActivityData->year = static_cast< unsigned int >( entry[ 0 ] );
+                solarActivityData->month = static_cast< unsigned int >( entry[ numberOfEntries ] );
+                solarActivityData->day = static_cast< unsigned int >( entry[ 2 * numberOfEntries ] );
+                solarActivityData->bartelsSolarRotationNumber =
+                        static_cast< unsigned int >( entry[ 3 * numberOfEntries ] );
+                solarActivityData->dayOfBartelsCycle = static_cast< unsigned int >( entry[ 4 * numberOfEntries ] );
+                for( unsigned int i = 0; i < 8; i++ )
+                {
+                    solarActivityData->planetaryRangeIndexVector( i ) = entry[ ( 5 + i ) * numberOfEntries ];
+                    solarActivityData->planetaryEquivalentAmplitudeVector( i ) =
+                            entry[ ( 14 + i ) * numberOfEntries ];
+                }
+                solarActivityData->planetaryRangeIndexSum =
+                        static_cast< unsigned int >( entry[ 13 * numberOfEntries ] );
+                solarActivityData->planetaryEquivalentAmplitudeAverage =
+                        static_cast< unsigned int >( entry[ 22 * numberOfEntries ] );
+                solarActivityData->planetaryDailyCharacterFigure = entry[ 23 * numberOfEntries ];
+                solarActivityData->planetaryDailyCharacterFigureConverted =
+                        static_cast< unsigned int >( entry[ 24 * numberOfEntries ] );
+                solarActivityData->internationalSunspotNumber =
+                        static_cast< unsigned int >( entry[ 25 * numberOfEntries ] );
+                solarActivityData->solarRadioFlux107Adjusted = entry[ 26 * numberOfEntries ];
+                solarActivityData->fluxQualifier = static_cast< unsigned int >( entry[ 27 * numberOfEntries ] );
+                solarActivityData->centered81DaySolarRadioFlux107Adjusted = entry[ 28 * numberOfEntries ];
+                solarActivityData->last81DaySolarRadioFlux107Adjusted = entry[ 29 * numberOfEntries ];
+                solarActivityData->solarRadioFlux107Observed = entry[ 30 * numberOfEntries ];
+                solarActivityData->centered81DaySolarRadioFlux107Observed = entry[ 31 * numberOfEntries ];
+                solarActivityData->last81DaySolarRadioFlux107Observed = entry[ 32 * numberOfEntries ];
+                solarActivityData->dataType = static_cast< unsigned int >( entry[ 33 * numberOfEntries ] );
+
+                addSolarActivityDataToMap( dataMap, solarActivityData );
+            }
+        }
+        catch( interprocess_exception& caughtException )
+        {
+            throw std::runtime_error( "Error when reading binary solar activity data file " + filePath +
+                                      ", could not map file: " + caughtException.what( ) );
+        }
+    }
+
+    return dataMap;
+}
+
 } // solar_activity
 } // input_output
 } // tudat
@@ -168,13 +168,43 @@ typedef std::map< double , SolarActivityDataPtr >  SolarActivityDataMap ;
 
 //! Function that reads a SpaceWeather data file
 /*!
- * This function reads a SpaceWeather data file and returns a map with SolarActivityData
+ * This function reads a SpaceWeather data file and returns a map with SolarActivityData. The file may either be a
+ * SpaceWeather text file, which is parsed in a single pass over its fixed-width fields, or a binary solar activity
+ * data file, as written by writeBinarySolarActivityDataFile.
  *
  * \param filePath std::string
  * \return solarActivityDataMap std::map< double , SolarActivityDataPtr >
  */
 SolarActivityDataMap readSolarActivityData( std::string filePath ) ;
 
+//! Function to check whether a file is a binary solar activity data file
+/*!
+ * Function to check whether a file is a binary solar activity data file, as written by
+ * writeBinarySolarActivityDataFile.
+ * \param filePath Name of file that is to be checked.
+ * \return True if file exists and starts with the binary solar activity data file identifier.
+ */
+bool isBinarySolarActivityDataFile( const std::string& filePath );
+
+//! Function to write solar activity data to a binary file
+/*!
+ * Function to write solar activity data to a binary file (in native byte order), which may be read by
+ * readSolarActivityData in later runs, avoiding the parsing of the SpaceWeather text file. The data is stored in
+ * columns, one for each (scalar) variable of SolarActivityData.
+ * \param solarActivityData Solar activity data that is to be written.
+ * \param filePath Name of binary file that is to be written.
+ */
+void writeBinarySolarActivityDataFile( const SolarActivityDataMap& solarActivityData, const std::string& filePath );
+
+//! Function to read solar activity data from a binary file
+/*!
+ * Function to read solar activity data from a binary file, as written by writeBinarySolarActivityDataFile, by
+ * memory-mapping the file.
+ * \param filePath Name of binary file that is to be read.
+ * \return solarActivityDataMap std::map< double , SolarActivityDataPtr >
+ */
+SolarActivityDataMap readBinarySolarActivityDataFile( const std::string& filePath );
+
 } // namespace solar_activity
 } // namespace input_output
 } // namespace tudat
@@ -26,11 +26,12 @@ static std::map< AtmosphereTypes, std::string > atmosphereTypes =
 {
     { exponential_atmosphere, "exponential" },
     { tabulated_atmosphere, "tabulated" },
-    { nrlmsise00, "nrlmsise00" }
+    { nrlmsise00, "nrlmsise00" },
+    { gridded_atmosphere, "gridded" }
 };
 
 //! `AtmosphereTypes` not supported by `json_interface`.
-static std::vector< AtmosphereTypes > unsupportedAtmosphereTypes = { };
+static std::vector< AtmosphereTypes > unsupportedAtmosphereTypes = { gridded_atmosphere };
 
 //! Convert `AtmosphereTypes` to `json`.
 inline void to_json( nlohmann::json& jsonObject, const AtmosphereTypes& atmosphereType )
@@ -33,6 +33,8 @@ void to_json( nlohmann::json& jsonObject, const boost::shared_ptr< ExportSetting
     jsonObject[ K::onlyInitialStep ] = exportSettings->onlyInitialStep_;
     jsonObject[ K::onlyFinalStep ] = exportSettings->onlyFinalStep_;
     jsonObject[ K::numericalPrecision ] = exportSettings->numericalPrecision_;
+    jsonObject[ K::fileFormat ] = exportSettings->fileFormat_;
+    jsonObject[ K::writeAsynchronously ] = exportSettings->writeAsynchronously_;
 }
 
 //! Create a shared pointer to a `ExportSettings` object from a `json` object.
@@ -49,6 +51,8 @@ void from_json( const nlohmann::json& jsonObject, boost::shared_ptr< ExportSetti
     updateFromJSONIfDefined( exportSettings->onlyInitialStep_, jsonObject, K::onlyInitialStep );
     updateFromJSONIfDefined( exportSettings->onlyFinalStep_, jsonObject, K::onlyFinalStep );
     updateFromJSONIfDefined( exportSettings->numericalPrecision_, jsonObject, K::numericalPrecision );
+    updateFromJSONIfDefined( exportSettings->fileFormat_, jsonObject, K::fileFormat );
+    updateFromJSONIfDefined( exportSettings->writeAsynchronously_, jsonObject, K::writeAsynchronously );
 }
 
 } // namespace simulation_setup
@@ -11,6 +11,7 @@
 #ifndef TUDAT_JSONINTERFACE_EXPORT_H
 #define TUDAT_JSONINTERFACE_EXPORT_H
 
+#include "Tudat/InputOutput/binaryDataFile.h"
 #include "Tudat/SimulationSetup/PropagationSetup/dynamicsSimulator.h"
 #include "Tudat/JsonInterface/Propagation/variable.h"
 
@@ -23,6 +24,35 @@ namespace tudat
 namespace json_interface
 {
 
+//! Formats of the files to which results are exported.
+enum ExportFileFormat
+{
+    textFileFormat,
+    binaryFileFormat
+};
+
+//! Map of `ExportFileFormat`s string representations.
+static std::map< ExportFileFormat, std::string > exportFileFormats =
+{
+    { textFileFormat, "text" },
+    { binaryFileFormat, "binary" }
+};
+
+//! `ExportFileFormat`s not supported by `json_interface`.
+static std::vector< ExportFileFormat > unsupportedExportFileFormats = { };
+
+//! Convert `ExportFileFormat` to `json`.
+inline void to_json( nlohmann::json& jsonObject, const ExportFileFormat& exportFileFormat )
+{
+    jsonObject = json_interface::stringFromEnum( exportFileFormat, exportFileFormats );
+}
+
+//! Convert `json` to `ExportFileFormat`.
+inline void from_json( const nlohmann::json& jsonObject, ExportFileFormat& exportFileFormat )
+{
+    exportFileFormat = json_interface::enumFromString( jsonObject, exportFileFormats );
+}
+
 class ExportSettings
 {
 public:
@@ -62,6 +92,14 @@ public:
 
     //! Whether to print only the values corresponding to the final integration step.
     bool onlyFinalStep_ = false;
+
+    //! Format of the output file.
+    //! If binary, the results are written to a columnar binary data file (see input_output::BinaryDataFileWriter),
+    //! in which the variables are identified by their IDs, and numericalPrecision_ is not used.
+    ExportFileFormat fileFormat_ = textFileFormat;
+
+    //! Whether to write the binary output file in a separate thread (only used for binary file format).
+    bool writeAsynchronously_ = false;
 };
 
 //! Create a `json` object from a shared pointer to a `ExportSettings` object.
@@ -175,6 +213,30 @@ void exportResultsOfDynamicsSimulator(
             }
         }
 
+        // Create binary data file writer, if requested, to which the results are written directly.
+        boost::shared_ptr< BinaryDataFileWriter > binaryFileWriter;
+        const unsigned int firstVariableColumn = exportSettings->epochsInFirstColumn_ ? 1 : 0;
+        if ( exportSettings->fileFormat_ == binaryFileFormat )
+        {
+            std::vector< BinaryDataFileVariable > fileVariables;
+            if ( exportSettings->epochsInFirstColumn_ )
+            {
+                fileVariables.push_back( BinaryDataFileVariable( "epoch", 0, 1 ) );
+            }
+            unsigned int currentColumn = firstVariableColumn;
+            for ( unsigned int i = 0; i < variables.size( ); ++i )
+            {
+                fileVariables.push_back( BinaryDataFileVariable( getVariableId( variables.at( i ) ), currentColumn,
+                                                                 variableSizes.at( i ) ) );
+                currentColumn += variableSizes.at( i );
+            }
+            binaryFileWriter = boost::make_shared< BinaryDataFileWriter >(
+                        exportSettings->outputFile_, cols + firstVariableColumn, fileVariables,
+                        exportSettings->header_, exportSettings->writeAsynchronously_ );
+        }
+        Eigen::VectorXd binaryFileRow( cols + firstVariableColumn );
+        Eigen::VectorXd result( cols );
+
         // Concatenate requested results
         std::map< TimeType, Eigen::VectorXd > results;
         for ( auto it = statesHistory.begin( ); it != statesHistory.end( ); ++it )
@@ -191,7 +253,6 @@ void exportResultsOfDynamicsSimulator(
             unsigned int currentIndex = 0;
 
             const TimeType epoch = it->first;
-            Eigen::VectorXd result = Eigen::VectorXd::Zero( cols );
             for ( unsigned int i = 0; i < variables.size( ); ++i )
             {
                 const boost::shared_ptr< VariableSettings > variable = variables.at( i );
@@ -201,14 +262,12 @@ void exportResultsOfDynamicsSimulator(
                 {
                 case independentVariable:
                 {
-                    result.segment( currentIndex, variableSize ) =
-                            ( Eigen::VectorXd( 1 ) << static_cast< double >( epoch ) ).finished( );
+                    result( currentIndex ) = static_cast< double >( epoch );
                     break;
                 }
                 case cpuTimeVariable:
                 {
-                    result.segment( currentIndex, variableSize ) =
-                            ( Eigen::VectorXd( 1 ) << cpuTimes.at( epoch ) ).finished( );
+                    result( currentIndex ) = cpuTimes.at( epoch );
                     break;
                 }
                 case stateVariable:
@@ -227,10 +286,28 @@ void exportResultsOfDynamicsSimulator(
                 }
                 currentIndex += variableSize;
             }
-            results[ epoch ] = result;
+
+            if ( binaryFileWriter )
+            {
+                if ( exportSettings->epochsInFirstColumn_ )
+                {
+                    binaryFileRow( 0 ) = static_cast< double >( epoch );
+                }
+                binaryFileRow.segment( firstVariableColumn, cols ) = result;
+                binaryFileWriter->addRow( binaryFileRow );
+            }
+            else
+            {
+                results[ epoch ] = result;
+            }
         }
 
-        if ( exportSettings->epochsInFirstColumn_ )
+        if ( binaryFileWriter )
+        {
+            // Write remaining results to binary file.
+            binaryFileWriter->close( );
+        }
+        else if ( exportSettings->epochsInFirstColumn_ )
         {
             // Write results map to file.
             writeDataMapToTextFile( results,
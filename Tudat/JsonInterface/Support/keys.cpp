@@ -367,6 +367,8 @@ const std::string Keys::Export::epochsInFirstColumn = "epochsInFirstColumn";
 const std::string Keys::Export::onlyInitialStep = "onlyInitialStep";
 const std::string Keys::Export::onlyFinalStep = "onlyFinalStep";
 const std::string Keys::Export::numericalPrecision = "numericalPrecision";
+const std::string Keys::Export::fileFormat = "fileFormat";
+const std::string Keys::Export::writeAsynchronously = "writeAsynchronously";
 
 
 //  Options
@@ -397,6 +397,8 @@ struct Keys
         static const std::string onlyInitialStep;
         static const std::string onlyFinalStep;
         static const std::string numericalPrecision;
+        static const std::string fileFormat;
+        static const std::string writeAsynchronously;
     };
 
     static const std::string options;
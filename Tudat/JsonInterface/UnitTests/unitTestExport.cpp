@@ -10,6 +10,13 @@
 
 #define BOOST_TEST_MAIN
 
+#include <boost/filesystem.hpp>
+
+#include "Tudat/Astrodynamics/Ephemerides/constantEphemeris.h"
+#include "Tudat/InputOutput/binaryDataFile.h"
+#include "Tudat/SimulationSetup/EnvironmentSetup/createBodies.h"
+#include "Tudat/SimulationSetup/PropagationSetup/createAccelerationModels.h"
+#include "Tudat/SimulationSetup/PropagationSetup/dynamicsSimulator.h"
 #include "Tudat/JsonInterface/UnitTests/unitTestSupport.h"
 #include "Tudat/JsonInterface/Propagation/export.h"
 
@@ -77,6 +84,119 @@ BOOST_AUTO_TEST_CASE( test_json_export_partial_result )
     BOOST_CHECK_EQUAL_JSON( fromFileSettings, manualSettings );
 }
 
+// Test 3: binary result
+BOOST_AUTO_TEST_CASE( test_json_export_binary_result )
+{
+    using namespace tudat::propagators;
+    using namespace tudat::json_interface;
+
+    // Create ExportSettings from JSON file
+    const boost::shared_ptr< ExportSettings > fromFileSettings =
+            parseJSONFile< boost::shared_ptr< ExportSettings > >( INPUT( "binaryResult" ) );
+
+    // Create ExportSettings manually
+    const std::string outputFile = "binary.bin";
+    const std::vector< boost::shared_ptr< VariableSettings > > variables =
+    {
+        boost::make_shared< VariableSettings >( stateVariable ),
+        boost::make_shared< SingleDependentVariableSaveSettings >( altitude_dependent_variable, "body", "Earth" ),
+    };
+    boost::shared_ptr< ExportSettings > manualSettings =
+            boost::make_shared< ExportSettings >( outputFile, variables );
+    manualSettings->fileFormat_ = binaryFileFormat;
+    manualSettings->writeAsynchronously_ = true;
+
+    // Compare
+    BOOST_CHECK_EQUAL_JSON( fromFileSettings, manualSettings );
+}
+
+// Test 4: export results to binary file, and read them back
+BOOST_AUTO_TEST_CASE( test_json_export_binary_file )
+{
+    using namespace tudat::simulation_setup;
+    using namespace tudat::propagators;
+    using namespace tudat::numerical_integrators;
+    using namespace tudat::json_interface;
+
+    // Create Earth (at SSB, without Spice) and vehicle.
+    NamedBodyMap bodyMap;
+    bodyMap[ "Earth" ] = boost::make_shared< Body >( );
+    bodyMap[ "Earth" ]->setEphemeris( boost::make_shared< ephemerides::ConstantEphemeris >(
+                                          Eigen::Vector6d( Eigen::Vector6d::Zero( ) ), "SSB", "ECLIPJ2000" ) );
+    bodyMap[ "Earth" ]->setGravityFieldModel( boost::make_shared< gravitation::GravityFieldModel >( 3.986004418E14 ) );
+    bodyMap[ "body" ] = boost::make_shared< Body >( );
+    setGlobalFrameBodyEphemerides( bodyMap, "SSB", "ECLIPJ2000" );
+
+    // Propagate orbit, saving distance to Earth.
+    SelectedAccelerationMap accelerationSettings;
+    accelerationSettings[ "body" ][ "Earth" ].push_back(
+                boost::make_shared< AccelerationSettings >( basic_astrodynamics::central_gravity ) );
+    const std::vector< std::string > bodiesToPropagate = { "body" };
+    const std::vector< std::string > centralBodies = { "Earth" };
+    const basic_astrodynamics::AccelerationMap accelerationModelMap = createAccelerationModelsMap(
+                bodyMap, accelerationSettings, bodiesToPropagate, centralBodies );
+
+    const boost::shared_ptr< SingleDependentVariableSaveSettings > distanceVariable =
+            boost::make_shared< SingleDependentVariableSaveSettings >(
+                relative_distance_dependent_variable, "body", "Earth" );
+    const Eigen::Vector6d initialState = ( Eigen::Vector6d( ) << 7.0E6, 0.0, 0.0, 0.0, 7.5E3, 1.0E3 ).finished( );
+    const boost::shared_ptr< TranslationalStatePropagatorSettings< double > > propagatorSettings =
+            boost::make_shared< TranslationalStatePropagatorSettings< double > >(
+                centralBodies, accelerationModelMap, bodiesToPropagate, initialState, 3600.0, cowell,
+                boost::make_shared< DependentVariableSaveSettings >(
+                    std::vector< boost::shared_ptr< SingleDependentVariableSaveSettings > >( 1, distanceVariable ),
+                    false ) );
+    const boost::shared_ptr< IntegratorSettings< > > integratorSettings =
+            boost::make_shared< IntegratorSettings< > >( rungeKutta4, 0.0, 10.0 );
+    const boost::shared_ptr< SingleArcDynamicsSimulator< > > dynamicsSimulator =
+            boost::make_shared< SingleArcDynamicsSimulator< > >( bodyMap, integratorSettings, propagatorSettings );
+
+    // Export epochs, states and distances to binary file.
+    const boost::filesystem::path outputFile = boost::filesystem::temp_directory_path( ) /
+            boost::filesystem::unique_path( "binaryExport%%%%%%%%.bin" );
+    const std::vector< boost::shared_ptr< VariableSettings > > variables =
+    {
+        boost::make_shared< VariableSettings >( stateVariable ),
+        distanceVariable
+    };
+    const boost::shared_ptr< ExportSettings > exportSettings =
+            boost::make_shared< ExportSettings >( outputFile, variables );
+    exportSettings->fileFormat_ = binaryFileFormat;
+    exportSettings->writeAsynchronously_ = true;
+    exportSettings->header_ = "Binary export test";
+    exportResultsOfDynamicsSimulator( dynamicsSimulator, { exportSettings } );
+
+    // Read file, and compare with propagation results.
+    const std::map< double, Eigen::VectorXd > stateHistory = dynamicsSimulator->getEquationsOfMotionNumericalSolution( );
+    const std::map< double, Eigen::VectorXd > dependentVariableHistory =
+            dynamicsSimulator->getDependentVariableHistory( );
+
+    BOOST_CHECK( input_output::isBinaryDataFile( outputFile ) );
+    const input_output::BinaryDataFileContents fileContents = input_output::readBinaryDataFile( outputFile );
+    BOOST_CHECK_EQUAL( fileContents.header_, exportSettings->header_ );
+    BOOST_CHECK_EQUAL( fileContents.variables_.size( ), 3 );
+    BOOST_CHECK_EQUAL( fileContents.variables_.at( 2 ).name_,
+                       dynamicsSimulator->getDependentVariableIds( ).at( 0 ) );
+    BOOST_CHECK_EQUAL( fileContents.data_.rows( ), static_cast< int >( stateHistory.size( ) ) );
+    BOOST_CHECK_EQUAL( fileContents.data_.cols( ), 8 );
+
+    const std::map< double, Eigen::VectorXd > resultsMap = input_output::readDataMapFromBinaryFile( outputFile );
+    BOOST_CHECK_EQUAL( resultsMap.size( ), stateHistory.size( ) );
+
+    int currentRow = 0;
+    for ( auto stateIterator = stateHistory.begin( ); stateIterator != stateHistory.end( ); ++stateIterator )
+    {
+        const Eigen::VectorXd expectedRow = ( Eigen::VectorXd( 7 ) << stateIterator->second,
+                                              dependentVariableHistory.at( stateIterator->first ) ).finished( );
+        BOOST_CHECK_EQUAL( fileContents.data_( currentRow, 0 ), stateIterator->first );
+        BOOST_CHECK( fileContents.data_.block( currentRow, 1, 1, 7 ).transpose( ) == expectedRow );
+        BOOST_CHECK( resultsMap.at( stateIterator->first ) == expectedRow );
+        currentRow++;
+    }
+
+    boost::filesystem::remove( outputFile );
+}
+
 BOOST_AUTO_TEST_SUITE_END( )
 
 } // namespace unit_tests
@@ -0,0 +1,135 @@
+/*    Copyright (c) 2010-2017, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ */
+
+#define BOOST_TEST_MAIN
+
+#include <limits>
+
+#include <boost/test/unit_test.hpp>
+
+#include <Eigen/Core>
+#include <Eigen/Geometry>
+
+#include "Tudat/Basics/testMacros.h"
+#include "Tudat/Mathematics/BasicMathematics/dualNumber.h"
+
+namespace tudat
+{
+namespace unit_tests
+{
+
+using namespace tudat::basic_mathematics;
+
+typedef DualNumber< double, 2 > TestDualNumber;
+
+BOOST_AUTO_TEST_SUITE( test_dual_number )
+
+//! Test derivatives of arithmetic operations and mathematical functions against analytical derivatives.
+BOOST_AUTO_TEST_CASE( testDualNumberFunctions )
+{
+    const double xValue = 0.3;
+    const double yValue = 1.7;
+    TestDualNumber x = TestDualNumber::createIndependentVariable( xValue, 0 );
+    TestDualNumber y = TestDualNumber::createIndependentVariable( yValue, 1 );
+
+    const double tolerance = 4.0 * std::numeric_limits< double >::epsilon( );
+
+    // Check arithmetic operations, with derivatives w.r.t. x and y.
+    TestDualNumber result = x * y + 2.0 * x - y / 3.0;
+    BOOST_CHECK_CLOSE_FRACTION( result.getValue( ), xValue * yValue + 2.0 * xValue - yValue / 3.0, tolerance );
+    BOOST_CHECK_CLOSE_FRACTION( result.getDerivatives( )( 0 ), yValue + 2.0, tolerance );
+    BOOST_CHECK_CLOSE_FRACTION( result.getDerivatives( )( 1 ), xValue - 1.0 / 3.0, tolerance );
+
+    result = x / y;
+    BOOST_CHECK_CLOSE_FRACTION( result.getDerivatives( )( 0 ), 1.0 / yValue, tolerance );
+    BOOST_CHECK_CLOSE_FRACTION( result.getDerivatives( )( 1 ), -xValue / ( yValue * yValue ), tolerance );
+
+    result = 1.0 / y;
+    BOOST_CHECK_EQUAL( result.getDerivatives( )( 0 ), 0.0 );
+    BOOST_CHECK_CLOSE_FRACTION( result.getDerivatives( )( 1 ), -1.0 / ( yValue * yValue ), tolerance );
+
+    // Check single-argument functions, with derivative w.r.t. x.
+    BOOST_CHECK_CLOSE_FRACTION( sqrt( x ).getDerivatives( )( 0 ), 0.5 / std::sqrt( xValue ), tolerance );
+    BOOST_CHECK_CLOSE_FRACTION( exp( x ).getDerivatives( )( 0 ), std::exp( xValue ), tolerance );
+    BOOST_CHECK_CLOSE_FRACTION( log( x ).getDerivatives( )( 0 ), 1.0 / xValue, tolerance );
+    BOOST_CHECK_CLOSE_FRACTION( sin( x ).getDerivatives( )( 0 ), std::cos( xValue ), tolerance );
+    BOOST_CHECK_CLOSE_FRACTION( cos( x ).getDerivatives( )( 0 ), -std::sin( xValue ), tolerance );
+    BOOST_CHECK_CLOSE_FRACTION( tan( x ).getDerivatives( )( 0 ),
+                                1.0 / ( std::cos( xValue ) * std::cos( xValue ) ), tolerance );
+    BOOST_CHECK_CLOSE_FRACTION( asin( x ).getDerivatives( )( 0 ),
+                                1.0 / std::sqrt( 1.0 - xValue * xValue ), tolerance );
+    BOOST_CHECK_CLOSE_FRACTION( acos( x ).getDerivatives( )( 0 ),
+                                -1.0 / std::sqrt( 1.0 - xValue * xValue ), tolerance );
+    BOOST_CHECK_CLOSE_FRACTION( atan( x ).getDerivatives( )( 0 ), 1.0 / ( 1.0 + xValue * xValue ), tolerance );
+    BOOST_CHECK_CLOSE_FRACTION( sinh( x ).getDerivatives( )( 0 ), std::cosh( xValue ), tolerance );
+    BOOST_CHECK_CLOSE_FRACTION( cosh( x ).getDerivatives( )( 0 ), std::sinh( xValue ), tolerance );
+    BOOST_CHECK_CLOSE_FRACTION( tanh( x ).getDerivatives( )( 0 ),
+                                1.0 - std::tanh( xValue ) * std::tanh( xValue ), tolerance );
+    BOOST_CHECK_CLOSE_FRACTION( pow( x, 3.5 ).getDerivatives( )( 0 ), 3.5 * std::pow( xValue, 2.5 ), tolerance );
+    BOOST_CHECK_CLOSE_FRACTION( fabs( -x ).getDerivatives( )( 0 ), 1.0, tolerance );
+
+    // Check two-argument functions, with derivatives w.r.t. x and y.
+    result = atan2( y, x );
+    BOOST_CHECK_CLOSE_FRACTION( result.getValue( ), std::atan2( yValue, xValue ), tolerance );
+    BOOST_CHECK_CLOSE_FRACTION( result.getDerivatives( )( 0 ), -yValue / ( xValue * xValue + yValue * yValue ),
+                                tolerance );
+    BOOST_CHECK_CLOSE_FRACTION( result.getDerivatives( )( 1 ), xValue / ( xValue * xValue + yValue * yValue ),
+                                tolerance );
+
+    result = pow( x, y );
+    BOOST_CHECK_CLOSE_FRACTION( result.getDerivatives( )( 0 ), yValue * std::pow( xValue, yValue - 1.0 ),
+                                tolerance );
+    BOOST_CHECK_CLOSE_FRACTION( result.getDerivatives( )( 1 ), std::log( xValue ) * std::pow( xValue, yValue ),
+                                tolerance );
+}
+
+//! Test use of dual numbers as scalar type of Eigen vectors, by differentiating a point-mass gravity acceleration.
+BOOST_AUTO_TEST_CASE( testDualNumberEigenOperations )
+{
+    typedef DualNumber< double, 3 > PositionDualNumber;
+
+    const Eigen::Vector3d position = ( Eigen::Vector3d( ) << 7.0E6, -1.2E6, 3.4E6 ).finished( );
+    const double gravitationalParameter = 3.986004418E14;
+
+    Eigen::Matrix< PositionDualNumber, 3, 1 > dualPosition;
+    for( int i = 0; i < 3; i++ )
+    {
+        dualPosition( i ) = PositionDualNumber::createIndependentVariable( position( i ), i );
+    }
+
+    // Compute acceleration with Eigen operations, including product with constant matrix.
+    const Eigen::Matrix3d rotationMatrix = Eigen::Matrix3d( Eigen::AngleAxisd( 0.3, Eigen::Vector3d::UnitZ( ) ) );
+    PositionDualNumber distance = dualPosition.norm( );
+    Eigen::Matrix< PositionDualNumber, 3, 1 > rotatedAcceleration =
+            rotationMatrix * ( -gravitationalParameter * dualPosition / ( distance * distance * distance ) );
+
+    // Compute analytical acceleration and partial.
+    const double distanceValue = position.norm( );
+    Eigen::Vector3d expectedAcceleration =
+            -rotationMatrix * gravitationalParameter * position / std::pow( distanceValue, 3.0 );
+    Eigen::Matrix3d expectedPartial = rotationMatrix * gravitationalParameter / std::pow( distanceValue, 3.0 ) * (
+                3.0 * position * position.transpose( ) / ( distanceValue * distanceValue ) -
+                Eigen::Matrix3d::Identity( ) );
+
+    for( int i = 0; i < 3; i++ )
+    {
+        BOOST_CHECK_CLOSE_FRACTION( rotatedAcceleration( i ).getValue( ), expectedAcceleration( i ), 1.0E-15 );
+        for( int j = 0; j < 3; j++ )
+        {
+            BOOST_CHECK_SMALL( rotatedAcceleration( i ).getDerivatives( )( j ) - expectedPartial( i, j ),
+                               1.0E-14 * expectedPartial.norm( ) );
+        }
+    }
+}
+
+BOOST_AUTO_TEST_SUITE_END( )
+
+} // namespace unit_tests
+} // namespace tudat
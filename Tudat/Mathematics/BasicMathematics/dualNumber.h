@@ -0,0 +1,540 @@
+/*    Copyright (c) 2010-2017, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ */
+
+#ifndef TUDAT_DUAL_NUMBER_H
+#define TUDAT_DUAL_NUMBER_H
+
+#include <cmath>
+#include <iostream>
+
+#include <Eigen/Core>
+
+namespace tudat
+{
+
+namespace basic_mathematics
+{
+
+//! Dual number, used for forward-mode automatic differentiation.
+/*!
+ *  Dual number, used for forward-mode automatic differentiation. The number stores a value and the derivatives of this
+ *  value w.r.t. a fixed number of independent variables. All arithmetic operations and mathematical functions defined
+ *  below propagate these derivatives by the chain rule, so that evaluating a function (templated on its scalar type)
+ *  with dual numbers as input returns both the function value and its exact Jacobian in a single pass.
+ *  \tparam ScalarType Scalar type of value and derivatives.
+ *  \tparam NumberOfDerivatives Number of independent variables w.r.t. which derivatives are propagated.
+ */
+template< typename ScalarType, int NumberOfDerivatives >
+class DualNumber
+{
+public:
+
+    //! Typedef for vector of derivatives.
+    typedef Eigen::Matrix< ScalarType, NumberOfDerivatives, 1 > DerivativeVector;
+
+    //! Default constructor, sets value and derivatives to zero.
+    DualNumber( ): value_( 0.0 ), derivatives_( DerivativeVector::Zero( ) ){ }
+
+    //! Constructor for a constant (i.e. with zero derivatives).
+    /*!
+     *  Constructor for a constant (i.e. with zero derivatives). Constructor is not explicit, so that constants can be
+     *  used directly in expressions with dual numbers.
+     *  \param value Value of number.
+     */
+    DualNumber( const ScalarType value ): value_( value ), derivatives_( DerivativeVector::Zero( ) ){ }
+
+    //! Constructor from value and derivatives.
+    /*!
+     *  Constructor from value and derivatives.
+     *  \param value Value of number.
+     *  \param derivatives Derivatives of number w.r.t. the independent variables.
+     */
+    DualNumber( const ScalarType value, const DerivativeVector& derivatives ):
+        value_( value ), derivatives_( derivatives ){ }
+
+    //! Function to create an independent variable.
+    /*!
+     *  Function to create an independent variable, i.e. a number with unit derivative w.r.t. itself, and zero
+     *  derivatives w.r.t. all other independent variables.
+     *  \param value Value of independent variable.
+     *  \param index Index of independent variable in vector of derivatives.
+     *  \return Independent variable.
+     */
+    static DualNumber createIndependentVariable( const ScalarType value, const int index )
+    {
+        return DualNumber( value, DerivativeVector::Unit( index ) );
+    }
+
+    //! Function to retrieve value of number.
+    /*!
+     *  Function to retrieve value of number.
+     *  \return Value of number.
+     */
+    const ScalarType& getValue( ) const
+    {
+        return value_;
+    }
+
+    //! Function to retrieve derivatives of number w.r.t. the independent variables.
+    /*!
+     *  Function to retrieve derivatives of number w.r.t. the independent variables.
+     *  \return Derivatives of number w.r.t. the independent variables.
+     */
+    const DerivativeVector& getDerivatives( ) const
+    {
+        return derivatives_;
+    }
+
+    //! Unary minus operator.
+    DualNumber operator-( ) const
+    {
+        return DualNumber( -value_, -derivatives_ );
+    }
+
+    //! Unary plus operator.
+    DualNumber operator+( ) const
+    {
+        return *this;
+    }
+
+    //! Addition assignment operator.
+    DualNumber& operator+=( const DualNumber& other )
+    {
+        value_ += other.value_;
+        derivatives_ += other.derivatives_;
+        return *this;
+    }
+
+    //! Subtraction assignment operator.
+    DualNumber& operator-=( const DualNumber& other )
+    {
+        value_ -= other.value_;
+        derivatives_ -= other.derivatives_;
+        return *this;
+    }
+
+    //! Multiplication assignment operator.
+    DualNumber& operator*=( const DualNumber& other )
+    {
+        derivatives_ = other.value_ * derivatives_ + value_ * other.derivatives_;
+        value_ *= other.value_;
+        return *this;
+    }
+
+    //! Division assignment operator.
+    DualNumber& operator/=( const DualNumber& other )
+    {
+        const ScalarType inverseValue = 1.0 / other.value_;
+        value_ *= inverseValue;
+        derivatives_ = ( derivatives_ - value_ * other.derivatives_ ) * inverseValue;
+        return *this;
+    }
+
+private:
+
+    //! Value of number.
+    ScalarType value_;
+
+    //! Derivatives of number w.r.t. the independent variables.
+    DerivativeVector derivatives_;
+
+public:
+
+    EIGEN_MAKE_ALIGNED_OPERATOR_NEW
+
+};
+
+//! Addition operator of dual numbers.
+template< typename ScalarType, int NumberOfDerivatives >
+DualNumber< ScalarType, NumberOfDerivatives > operator+(
+        DualNumber< ScalarType, NumberOfDerivatives > left, const DualNumber< ScalarType, NumberOfDerivatives >& right )
+{
+    return left += right;
+}
+
+//! Addition operator of dual number and constant.
+template< typename ScalarType, int NumberOfDerivatives >
+DualNumber< ScalarType, NumberOfDerivatives > operator+(
+        const DualNumber< ScalarType, NumberOfDerivatives >& left, const ScalarType right )
+{
+    return DualNumber< ScalarType, NumberOfDerivatives >( left.getValue( ) + right, left.getDerivatives( ) );
+}
+
+//! Addition operator of constant and dual number.
+template< typename ScalarType, int NumberOfDerivatives >
+DualNumber< ScalarType, NumberOfDerivatives > operator+(
+        const ScalarType left, const DualNumber< ScalarType, NumberOfDerivatives >& right )
+{
+    return DualNumber< ScalarType, NumberOfDerivatives >( left + right.getValue( ), right.getDerivatives( ) );
+}
+
+//! Subtraction operator of dual numbers.
+template< typename ScalarType, int NumberOfDerivatives >
+DualNumber< ScalarType, NumberOfDerivatives > operator-(
+        DualNumber< ScalarType, NumberOfDerivatives > left, const DualNumber< ScalarType, NumberOfDerivatives >& right )
+{
+    return left -= right;
+}
+
+//! Subtraction operator of dual number and constant.
+template< typename ScalarType, int NumberOfDerivatives >
+DualNumber< ScalarType, NumberOfDerivatives > operator-(
+        const DualNumber< ScalarType, NumberOfDerivatives >& left, const ScalarType right )
+{
+    return DualNumber< ScalarType, NumberOfDerivatives >( left.getValue( ) - right, left.getDerivatives( ) );
+}
+
+//! Subtraction operator of constant and dual number.
+template< typename ScalarType, int NumberOfDerivatives >
+DualNumber< ScalarType, NumberOfDerivatives > operator-(
+        const ScalarType left, const DualNumber< ScalarType, NumberOfDerivatives >& right )
+{
+    return DualNumber< ScalarType, NumberOfDerivatives >( left - right.getValue( ), -right.getDerivatives( ) );
+}
+
+//! Multiplication operator of dual numbers.
+template< typename ScalarType, int NumberOfDerivatives >
+DualNumber< ScalarType, NumberOfDerivatives > operator*(
+        DualNumber< ScalarType, NumberOfDerivatives > left, const DualNumber< ScalarType, NumberOfDerivatives >& right )
+{
+    return left *= right;
+}
+
+//! Multiplication operator of dual number and constant.
+template< typename ScalarType, int NumberOfDerivatives >
+DualNumber< ScalarType, NumberOfDerivatives > operator*(
+        const DualNumber< ScalarType, NumberOfDerivatives >& left, const ScalarType right )
+{
+    return DualNumber< ScalarType, NumberOfDerivatives >( left.getValue( ) * right, left.getDerivatives( ) * right );
+}
+
+//! Multiplication operator of constant and dual number.
+template< typename ScalarType, int NumberOfDerivatives >
+DualNumber< ScalarType, NumberOfDerivatives > operator*(
+        const ScalarType left, const DualNumber< ScalarType, NumberOfDerivatives >& right )
+{
+    return DualNumber< ScalarType, NumberOfDerivatives >( left * right.getValue( ), left * right.getDerivatives( ) );
+}
+
+//! Division operator of dual numbers.
+template< typename ScalarType, int NumberOfDerivatives >
+DualNumber< ScalarType, NumberOfDerivatives > operator/(
+        DualNumber< ScalarType, NumberOfDerivatives > left, const DualNumber< ScalarType, NumberOfDerivatives >& right )
+{
+    return left /= right;
+}
+
+//! Division operator of dual number and constant.
+template< typename ScalarType, int NumberOfDerivatives >
+DualNumber< ScalarType, NumberOfDerivatives > operator/(
+        const DualNumber< ScalarType, NumberOfDerivatives >& left, const ScalarType right )
+{
+    return DualNumber< ScalarType, NumberOfDerivatives >( left.getValue( ) / right, left.getDerivatives( ) / right );
+}
+
+//! Division operator of constant and dual number.
+template< typename ScalarType, int NumberOfDerivatives >
+DualNumber< ScalarType, NumberOfDerivatives > operator/(
+        const ScalarType left, const DualNumber< ScalarType, NumberOfDerivatives >& right )
+{
+    const ScalarType value = left / right.getValue( );
+    return DualNumber< ScalarType, NumberOfDerivatives >(
+                value, -value / right.getValue( ) * right.getDerivatives( ) );
+}
+
+//! Equality operator, compares only values of dual numbers.
+template< typename ScalarType, int NumberOfDerivatives >
+bool operator==( const DualNumber< ScalarType, NumberOfDerivatives >& left,
+                 const DualNumber< ScalarType, NumberOfDerivatives >& right )
+{
+    return left.getValue( ) == right.getValue( );
+}
+
+//! Inequality operator, compares only values of dual numbers.
+template< typename ScalarType, int NumberOfDerivatives >
+bool operator!=( const DualNumber< ScalarType, NumberOfDerivatives >& left,
+                 const DualNumber< ScalarType, NumberOfDerivatives >& right )
+{
+    return left.getValue( ) != right.getValue( );
+}
+
+//! Smaller-than operator, compares only values of dual numbers.
+template< typename ScalarType, int NumberOfDerivatives >
+bool operator<( const DualNumber< ScalarType, NumberOfDerivatives >& left,
+                const DualNumber< ScalarType, NumberOfDerivatives >& right )
+{
+    return left.getValue( ) < right.getValue( );
+}
+
+//! Greater-than operator, compares only values of dual numbers.
+template< typename ScalarType, int NumberOfDerivatives >
+bool operator>( const DualNumber< ScalarType, NumberOfDerivatives >& left,
+                const DualNumber< ScalarType, NumberOfDerivatives >& right )
+{
+    return left.getValue( ) > right.getValue( );
+}
+
+//! Smaller-than-or-equal operator, compares only values of dual numbers.
+template< typename ScalarType, int NumberOfDerivatives >
+bool operator<=( const DualNumber< ScalarType, NumberOfDerivatives >& left,
+                 const DualNumber< ScalarType, NumberOfDerivatives >& right )
+{
+    return left.getValue( ) <= right.getValue( );
+}
+
+//! Greater-than-or-equal operator, compares only values of dual numbers.
+template< typename ScalarType, int NumberOfDerivatives >
+bool operator>=( const DualNumber< ScalarType, NumberOfDerivatives >& left,
+                 const DualNumber< ScalarType, NumberOfDerivatives >& right )
+{
+    return left.getValue( ) >= right.getValue( );
+}
+
+//! Output stream operator, writes value and derivatives of dual number.
+template< typename ScalarType, int NumberOfDerivatives >
+std::ostream& operator<<( std::ostream& stream, const DualNumber< ScalarType, NumberOfDerivatives >& number )
+{
+    stream << "(" << number.getValue( ) << "; " << number.getDerivatives( ).transpose( ) << ")";
+    return stream;
+}
+
+//! Function to create a dual number from a function value and its derivative w.r.t. the function argument (chain rule).
+template< typename ScalarType, int NumberOfDerivatives >
+DualNumber< ScalarType, NumberOfDerivatives > applyChainRule(
+        const ScalarType value, const ScalarType derivative,
+        const DualNumber< ScalarType, NumberOfDerivatives >& argument )
+{
+    return DualNumber< ScalarType, NumberOfDerivatives >( value, derivative * argument.getDerivatives( ) );
+}
+
+//! Square root of dual number.
+template< typename ScalarType, int NumberOfDerivatives >
+DualNumber< ScalarType, NumberOfDerivatives > sqrt( const DualNumber< ScalarType, NumberOfDerivatives >& number )
+{
+    const ScalarType value = std::sqrt( number.getValue( ) );
+    return applyChainRule( value, 0.5 / value, number );
+}
+
+//! Exponential of dual number.
+template< typename ScalarType, int NumberOfDerivatives >
+DualNumber< ScalarType, NumberOfDerivatives > exp( const DualNumber< ScalarType, NumberOfDerivatives >& number )
+{
+    const ScalarType value = std::exp( number.getValue( ) );
+    return applyChainRule( value, value, number );
+}
+
+//! Natural logarithm of dual number.
+template< typename ScalarType, int NumberOfDerivatives >
+DualNumber< ScalarType, NumberOfDerivatives > log( const DualNumber< ScalarType, NumberOfDerivatives >& number )
+{
+    return applyChainRule( std::log( number.getValue( ) ), 1.0 / number.getValue( ), number );
+}
+
+//! Sine of dual number.
+template< typename ScalarType, int NumberOfDerivatives >
+DualNumber< ScalarType, NumberOfDerivatives > sin( const DualNumber< ScalarType, NumberOfDerivatives >& number )
+{
+    return applyChainRule( std::sin( number.getValue( ) ), std::cos( number.getValue( ) ), number );
+}
+
+//! Cosine of dual number.
+template< typename ScalarType, int NumberOfDerivatives >
+DualNumber< ScalarType, NumberOfDerivatives > cos( const DualNumber< ScalarType, NumberOfDerivatives >& number )
+{
+    return applyChainRule( std::cos( number.getValue( ) ), -std::sin( number.getValue( ) ), number );
+}
+
+//! Tangent of dual number.
+template< typename ScalarType, int NumberOfDerivatives >
+DualNumber< ScalarType, NumberOfDerivatives > tan( const DualNumber< ScalarType, NumberOfDerivatives >& number )
+{
+    const ScalarType value = std::tan( number.getValue( ) );
+    return applyChainRule( value, 1.0 + value * value, number );
+}
+
+//! Inverse sine of dual number.
+template< typename ScalarType, int NumberOfDerivatives >
+DualNumber< ScalarType, NumberOfDerivatives > asin( const DualNumber< ScalarType, NumberOfDerivatives >& number )
+{
+    return applyChainRule( std::asin( number.getValue( ) ),
+                           1.0 / std::sqrt( 1.0 - number.getValue( ) * number.getValue( ) ), number );
+}
+
+//! Inverse cosine of dual number.
+template< typename ScalarType, int NumberOfDerivatives >
+DualNumber< ScalarType, NumberOfDerivatives > acos( const DualNumber< ScalarType, NumberOfDerivatives >& number )
+{
+    return applyChainRule( std::acos( number.getValue( ) ),
+                           -1.0 / std::sqrt( 1.0 - number.getValue( ) * number.getValue( ) ), number );
+}
+
+//! Inverse tangent of dual number.
+template< typename ScalarType, int NumberOfDerivatives >
+DualNumber< ScalarType, NumberOfDerivatives > atan( const DualNumber< ScalarType, NumberOfDerivatives >& number )
+{
+    return applyChainRule( std::atan( number.getValue( ) ),
+                           1.0 / ( 1.0 + number.getValue( ) * number.getValue( ) ), number );
+}
+
+//! Two-argument inverse tangent of dual numbers.
+template< typename ScalarType, int NumberOfDerivatives >
+DualNumber< ScalarType, NumberOfDerivatives > atan2( const DualNumber< ScalarType, NumberOfDerivatives >& y,
+                                                     const DualNumber< ScalarType, NumberOfDerivatives >& x )
+{
+    const ScalarType inverseSquaredNorm = 1.0 / ( x.getValue( ) * x.getValue( ) + y.getValue( ) * y.getValue( ) );
+    return DualNumber< ScalarType, NumberOfDerivatives >(
+                std::atan2( y.getValue( ), x.getValue( ) ),
+                ( x.getValue( ) * y.getDerivatives( ) - y.getValue( ) * x.getDerivatives( ) ) * inverseSquaredNorm );
+}
+
+//! Hyperbolic sine of dual number.
+template< typename ScalarType, int NumberOfDerivatives >
+DualNumber< ScalarType, NumberOfDerivatives > sinh( const DualNumber< ScalarType, NumberOfDerivatives >& number )
+{
+    return applyChainRule( std::sinh( number.getValue( ) ), std::cosh( number.getValue( ) ), number );
+}
+
+//! Hyperbolic cosine of dual number.
+template< typename ScalarType, int NumberOfDerivatives >
+DualNumber< ScalarType, NumberOfDerivatives > cosh( const DualNumber< ScalarType, NumberOfDerivatives >& number )
+{
+    return applyChainRule( std::cosh( number.getValue( ) ), std::sinh( number.getValue( ) ), number );
+}
+
+//! Hyperbolic tangent of dual number.
+template< typename ScalarType, int NumberOfDerivatives >
+DualNumber< ScalarType, NumberOfDerivatives > tanh( const DualNumber< ScalarType, NumberOfDerivatives >& number )
+{
+    const ScalarType value = std::tanh( number.getValue( ) );
+    return applyChainRule( value, 1.0 - value * value, number );
+}
+
+//! Dual number raised to constant power.
+template< typename ScalarType, int NumberOfDerivatives >
+DualNumber< ScalarType, NumberOfDerivatives > pow( const DualNumber< ScalarType, NumberOfDerivatives >& number,
+                                                   const ScalarType exponent )
+{
+    const ScalarType value = std::pow( number.getValue( ), exponent );
+    return applyChainRule( value, exponent * std::pow( number.getValue( ), exponent - 1.0 ), number );
+}
+
+//! Dual number raised to dual number power (base must be positive).
+template< typename ScalarType, int NumberOfDerivatives >
+DualNumber< ScalarType, NumberOfDerivatives > pow( const DualNumber< ScalarType, NumberOfDerivatives >& base,
+                                                   const DualNumber< ScalarType, NumberOfDerivatives >& exponent )
+{
+    const ScalarType value = std::pow( base.getValue( ), exponent.getValue( ) );
+    return DualNumber< ScalarType, NumberOfDerivatives >(
+                value, value * ( exponent.getValue( ) / base.getValue( ) * base.getDerivatives( ) +
+                                 std::log( base.getValue( ) ) * exponent.getDerivatives( ) ) );
+}
+
+//! Absolute value of dual number.
+template< typename ScalarType, int NumberOfDerivatives >
+DualNumber< ScalarType, NumberOfDerivatives > abs( const DualNumber< ScalarType, NumberOfDerivatives >& number )
+{
+    return ( number.getValue( ) < 0.0 ) ? -number : number;
+}
+
+//! Absolute value of dual number.
+template< typename ScalarType, int NumberOfDerivatives >
+DualNumber< ScalarType, NumberOfDerivatives > fabs( const DualNumber< ScalarType, NumberOfDerivatives >& number )
+{
+    return abs( number );
+}
+
+//! Square of dual number (used by Eigen for norm computations).
+template< typename ScalarType, int NumberOfDerivatives >
+DualNumber< ScalarType, NumberOfDerivatives > abs2( const DualNumber< ScalarType, NumberOfDerivatives >& number )
+{
+    return number * number;
+}
+
+//! Complex conjugate of dual number (used by Eigen for dot products), which is the number itself.
+template< typename ScalarType, int NumberOfDerivatives >
+const DualNumber< ScalarType, NumberOfDerivatives >& conj( const DualNumber< ScalarType, NumberOfDerivatives >& number )
+{
+    return number;
+}
+
+//! Real part of dual number (used by Eigen), which is the number itself.
+template< typename ScalarType, int NumberOfDerivatives >
+const DualNumber< ScalarType, NumberOfDerivatives >& real( const DualNumber< ScalarType, NumberOfDerivatives >& number )
+{
+    return number;
+}
+
+//! Imaginary part of dual number (used by Eigen), which is zero.
+template< typename ScalarType, int NumberOfDerivatives >
+DualNumber< ScalarType, NumberOfDerivatives > imag( const DualNumber< ScalarType, NumberOfDerivatives >& )
+{
+    return DualNumber< ScalarType, NumberOfDerivatives >( 0.0 );
+}
+
+//! Function to retrieve value of scalar, overload for double, to be used in code templated on scalar type.
+inline double getDualNumberValue( const double number )
+{
+    return number;
+}
+
+//! Function to retrieve value of dual number, to be used in code templated on scalar type.
+template< typename ScalarType, int NumberOfDerivatives >
+ScalarType getDualNumberValue( const DualNumber< ScalarType, NumberOfDerivatives >& number )
+{
+    return number.getValue( );
+}
+
+} // namespace basic_mathematics
+
+} // namespace tudat
+
+namespace Eigen
+{
+
+//! Eigen numerical traits of dual number, required for use of dual numbers as Eigen matrix scalar type.
+template< typename ScalarType, int NumberOfDerivatives >
+struct NumTraits< tudat::basic_mathematics::DualNumber< ScalarType, NumberOfDerivatives > >: NumTraits< ScalarType >
+{
+    typedef tudat::basic_mathematics::DualNumber< ScalarType, NumberOfDerivatives > Real;
+    typedef tudat::basic_mathematics::DualNumber< ScalarType, NumberOfDerivatives > NonInteger;
+    typedef tudat::basic_mathematics::DualNumber< ScalarType, NumberOfDerivatives > Nested;
+    typedef tudat::basic_mathematics::DualNumber< ScalarType, NumberOfDerivatives > Literal;
+
+    enum
+    {
+        IsComplex = 0,
+        IsInteger = 0,
+        IsSigned = 1,
+        RequireInitialization = 1,
+        ReadCost = 1 + NumberOfDerivatives,
+        AddCost = 1 + NumberOfDerivatives,
+        MulCost = 1 + 2 * NumberOfDerivatives
+    };
+};
+
+//! Eigen traits for products of dual numbers and constants (e.g. constant matrix times dual-number vector).
+template< typename ScalarType, int NumberOfDerivatives, typename BinaryOperation >
+struct ScalarBinaryOpTraits< tudat::basic_mathematics::DualNumber< ScalarType, NumberOfDerivatives >, ScalarType,
+        BinaryOperation >
+{
+    typedef tudat::basic_mathematics::DualNumber< ScalarType, NumberOfDerivatives > ReturnType;
+};
+
+//! Eigen traits for products of constants and dual numbers (e.g. constant matrix times dual-number vector).
+template< typename ScalarType, int NumberOfDerivatives, typename BinaryOperation >
+struct ScalarBinaryOpTraits< ScalarType, tudat::basic_mathematics::DualNumber< ScalarType, NumberOfDerivatives >,
+        BinaryOperation >
+{
+    typedef tudat::basic_mathematics::DualNumber< ScalarType, NumberOfDerivatives > ReturnType;
+};
+
+} // namespace Eigen
+
+#endif // TUDAT_DUAL_NUMBER_H
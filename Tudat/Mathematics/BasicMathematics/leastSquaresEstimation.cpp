@@ -139,6 +139,47 @@ std::pair< Eigen::VectorXd, Eigen::MatrixXd > performLeastSquaresAdjustmentFromI
                 checkConditionNumber, maximumAllowedConditionNumber );
 }
 
+//! Function to add the contribution of a block of observations to the normal equations
+void addObservationBlockToNormalEquations(
+        const Eigen::MatrixXd& informationMatrixBlock,
+        const Eigen::VectorXd& observationResidualsBlock,
+        const Eigen::VectorXd& diagonalOfWeightMatrixBlock,
+        Eigen::MatrixXd& normalEquationsMatrix,
+        Eigen::VectorXd& normalEquationsRightHandSide )
+{
+    if( ( informationMatrixBlock.rows( ) != observationResidualsBlock.rows( ) ) ||
+            ( informationMatrixBlock.rows( ) != diagonalOfWeightMatrixBlock.rows( ) ) )
+    {
+        throw std::runtime_error( "Error when adding observations to normal equations, number of observations is inconsistent" );
+    }
+
+    if( ( normalEquationsMatrix.rows( ) != informationMatrixBlock.cols( ) ) ||
+            ( normalEquationsMatrix.cols( ) != informationMatrixBlock.cols( ) ) ||
+            ( normalEquationsRightHandSide.rows( ) != informationMatrixBlock.cols( ) ) )
+    {
+        throw std::runtime_error( "Error when adding observations to normal equations, number of parameters is inconsistent" );
+    }
+
+    normalEquationsMatrix.noalias( ) += informationMatrixBlock.transpose( ) *
+            diagonalOfWeightMatrixBlock.asDiagonal( ) * informationMatrixBlock;
+    normalEquationsRightHandSide.noalias( ) += informationMatrixBlock.transpose( ) *
+            ( diagonalOfWeightMatrixBlock.cwiseProduct( observationResidualsBlock ) );
+}
+
+//! Function to perform an iteration of least squares estimation from accumulated normal equations and a priori information
+std::pair< Eigen::VectorXd, Eigen::MatrixXd > performLeastSquaresAdjustmentFromNormalEquations(
+        const Eigen::MatrixXd& normalEquationsMatrix,
+        const Eigen::VectorXd& normalEquationsRightHandSide,
+        const Eigen::MatrixXd& inverseOfAPrioriCovarianceMatrix,
+        const bool checkConditionNumber,
+        const double maximumAllowedConditionNumber )
+{
+    Eigen::MatrixXd inverseOfCovarianceMatrix = inverseOfAPrioriCovarianceMatrix + normalEquationsMatrix;
+    return std::make_pair( solveSystemOfEquationsWithSvd( inverseOfCovarianceMatrix, normalEquationsRightHandSide,
+                                                          checkConditionNumber, maximumAllowedConditionNumber ),
+                           inverseOfCovarianceMatrix );
+}
+
 //! Function to fit a univariate polynomial through a set of data
 Eigen::VectorXd getLeastSquaresPolynomialFit(
         const Eigen::VectorXd& independentValues,
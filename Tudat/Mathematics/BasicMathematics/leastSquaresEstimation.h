@@ -160,6 +160,49 @@ std::pair< Eigen::VectorXd, Eigen::MatrixXd > performLeastSquaresAdjustmentFromI
         const bool checkConditionNumber = 1,
         const double maximumAllowedConditionNumber = 1.0E8 );
 
+//! Function to add the contribution of a block of observations to the normal equations
+/*!
+ * Function to add the contribution of a block of observations to the normal equations, so that the normal equations of a
+ * (large) set of observations can be accumulated without storing the full information matrix. The terms
+ * H^T*W*H and H^T*W*y of the current block are added to the normalEquationsMatrix and normalEquationsRightHandSide,
+ * respectively.
+ * \param informationMatrixBlock Matrix containing partial derivatives of current block of observations (rows) w.r.t.
+ * estimated parameters (columns)
+ * \param observationResidualsBlock Difference between measured and simulated observations in current block
+ * \param diagonalOfWeightMatrixBlock Diagonal of observation weights matrix for current block of observations
+ * \param normalEquationsMatrix Matrix H^T*W*H of observations processed so far, to which the contribution of the current
+ * block is added (modified by this function)
+ * \param normalEquationsRightHandSide Vector H^T*W*y of observations processed so far, to which the contribution of the
+ * current block is added (modified by this function)
+ */
+void addObservationBlockToNormalEquations(
+        const Eigen::MatrixXd& informationMatrixBlock,
+        const Eigen::VectorXd& observationResidualsBlock,
+        const Eigen::VectorXd& diagonalOfWeightMatrixBlock,
+        Eigen::MatrixXd& normalEquationsMatrix,
+        Eigen::VectorXd& normalEquationsRightHandSide );
+
+//! Function to perform an iteration of least squares estimation from accumulated normal equations and a priori information
+/*!
+ * Function to perform an iteration of least squares estimation from accumulated normal equations (see
+ * addObservationBlockToNormalEquations) and a priori information. The result is equal to that of
+ * performLeastSquaresAdjustmentFromInformationMatrix for the full set of observations.
+ * \param normalEquationsMatrix Matrix H^T*W*H, accumulated over all observations
+ * \param normalEquationsRightHandSide Vector H^T*W*y, accumulated over all observations
+ * \param inverseOfAPrioriCovarianceMatrix Inverse of a priori covariance matrix
+ * \param checkConditionNumber Boolean to denote whether the condition number is checked when estimating (warning is printed
+ * when value exceeds maximumAllowedConditionNumber)
+ * \param maximumAllowedConditionNumber Maximum value of the condition number of the covariance matrix that is allowed
+ * (warning printed when exceeded)
+ * \return Pair containing: (first: parameter adjustment, second: inverse covariance)
+ */
+std::pair< Eigen::VectorXd, Eigen::MatrixXd > performLeastSquaresAdjustmentFromNormalEquations(
+        const Eigen::MatrixXd& normalEquationsMatrix,
+        const Eigen::VectorXd& normalEquationsRightHandSide,
+        const Eigen::MatrixXd& inverseOfAPrioriCovarianceMatrix,
+        const bool checkConditionNumber = 1,
+        const double maximumAllowedConditionNumber = 1.0E8 );
+
 //! Function to fit a univariate polynomial through a set of data
 /*!
  *  Function to fit a univariate polynomial through a set of data. User must provide independent variables and observations
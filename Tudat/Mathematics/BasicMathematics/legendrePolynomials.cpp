@@ -9,6 +9,8 @@
  *
  */
 
+#include <algorithm>
+#include <cmath>
 #include <sstream>
 #include <stdexcept>
 
@@ -72,30 +74,25 @@ void LegendreCache::update( const double polynomialParameter  )
         // Set complement of argument (assuming it to be sine of latitude) cosine of latitude is always positive.
         currentPolynomialParameterComplement_ = std::sqrt( 1.0 - polynomialParameter * polynomialParameter );
 
-        LegendreCache& thisReference = *this;
-
         int jMax = -1;
-        for( int i = 0; i <= maximumDegree_; i++ )
+        if( useGeodesyNormalization_ )
         {
-            jMax = std::min( i, maximumOrder_ );
-            for( int j = 0; j <= jMax ; j++ )
-            {
-                // Compute legendre polynomial
-                legendreValues_[ i * ( maximumOrder_ + 1 ) + j ] = legendrePolynomialFunction_( i, j, thisReference );
+            updateGeodesyNormalizedPolynomials( );
+        }
+        else
+        {
+            LegendreCache& thisReference = *this;
 
-                if( j != 0 )
+            for( int i = 0; i <= maximumDegree_; i++ )
+            {
+                jMax = std::min( i, maximumOrder_ );
+                for( int j = 0; j <= jMax ; j++ )
                 {
+                    // Compute legendre polynomial
+                    legendreValues_[ i * ( maximumOrder_ + 1 ) + j ] = legendrePolynomialFunction_( i, j, thisReference );
+
                     // Compute legendre polynomial derivative
-                    if( useGeodesyNormalization_ )
-                    {
-                        legendreDerivatives_[ i * ( maximumOrder_ + 1 ) + ( j - 1 ) ] =
-                                computeGeodesyLegendrePolynomialDerivative(
-                                    i, j - 1, currentPolynomialParameter_,
-                                    legendreValues_[ i * ( maximumOrder_ + 1 ) + ( j - 1 ) ],
-                                legendreValues_[ i * ( maximumOrder_ + 1 ) + j ],
-                                derivativeNormalizations_[ i * ( maximumOrder_ + 1 ) + ( j - 1 ) ] );
-                    }
-                    else
+                    if( j != 0 )
                     {
                         legendreDerivatives_[ i * ( maximumOrder_ + 1 ) + ( j - 1 ) ] =
                                 computeLegendrePolynomialDerivative(
@@ -103,22 +100,10 @@ void LegendreCache::update( const double polynomialParameter  )
                                     legendreValues_[ i * ( maximumOrder_ + 1 ) + ( j - 1 ) ],
                                 legendreValues_[ i * ( maximumOrder_ + 1 ) + j ] );
                     }
-
                 }
-            }
 
-            // Compute legendre polynomial derivative for i = j  (if needed)
-            if( jMax == i )
-            {
-                if( useGeodesyNormalization_ )
-                {
-                    legendreDerivatives_[ i * ( maximumOrder_ + 1 ) +  jMax ] =
-                            computeGeodesyLegendrePolynomialDerivative(
-                                i, jMax, currentPolynomialParameter_,
-                                legendreValues_[ i * ( maximumOrder_ + 1 ) + jMax ], 0.0,
-                            derivativeNormalizations_[ i * ( maximumOrder_ + 1 ) + jMax ] );
-                }
-                else
+                // Compute legendre polynomial derivative for i = j  (if needed)
+                if( jMax == i )
                 {
                     legendreDerivatives_[ i * ( maximumOrder_ + 1 ) + jMax ] =
                             computeLegendrePolynomialDerivative(
@@ -225,10 +210,107 @@ void LegendreCache::resetMaximumDegreeAndOrder( const int maximumDegree, const i
         }
     }
 
+    // Pre-compute coefficients of geodesy-normalized recursion.
+    verticalRecursionNormalizations_.resize( ( maximumDegree_ + 1 ) * ( maximumOrder_ + 1 ) );
+    verticalRecursionTwoDegreesPriorMultipliers_.resize( ( maximumDegree_ + 1 ) * ( maximumOrder_ + 1 ) );
+    verticalRecursionOneDegreePriorMultipliers_.resize( maximumDegree_ + 1 );
+    sectoralRecursionMultipliers_.resize( maximumDegree_ + 1 );
+
+    for( int i = 2; i <= maximumDegree_; i++ )
+    {
+        verticalRecursionOneDegreePriorMultipliers_[ i ] = std::sqrt( 2.0 * static_cast< double >( i ) - 1.0 );
+        sectoralRecursionMultipliers_[ i ] = std::sqrt( ( 2.0 * static_cast< double >( i ) + 1.0 )
+                                                        / ( 6.0 * static_cast< double >( i ) ) );
+        for( int j = 0; ( ( j < i ) && ( j <= maximumOrder_ ) ) ; j++ )
+        {
+            verticalRecursionNormalizations_[ i * ( maximumOrder_ + 1 ) + j ] = std::sqrt(
+                        ( 2.0 * static_cast< double >( i ) + 1.0 )
+                        / ( ( static_cast< double >( i + j ) ) * ( static_cast< double >( i - j ) ) ) );
+            verticalRecursionTwoDegreesPriorMultipliers_[ i * ( maximumOrder_ + 1 ) + j ] = std::sqrt(
+                        ( static_cast< double >( i + j ) - 1.0 ) * ( static_cast< double >( i - j ) - 1.0 )
+                        / ( 2.0 * static_cast< double >( i ) - 3.0 ) );
+        }
+    }
+
+    // Reset polynomials, so that entries with order > degree are zero.
+    std::fill( legendreValues_.begin( ), legendreValues_.end( ), 0.0 );
+    std::fill( legendreDerivatives_.begin( ), legendreDerivatives_.end( ), 0.0 );
+
     currentPolynomialParameter_ = TUDAT_NAN;
     currentPolynomialParameterComplement_ = TUDAT_NAN;
 }
 
+//! Function to update the geodesy-normalized Legendre polynomials and their first derivatives.
+void LegendreCache::updateGeodesyNormalizedPolynomials( )
+{
+    const int stride = maximumOrder_ + 1;
+    const double polynomialParameter = currentPolynomialParameter_;
+    const double polynomialParameterComplementSquare = 1.0 - polynomialParameter * polynomialParameter;
+    const double polynomialParameterComplement = std::sqrt( polynomialParameterComplementSquare );
+
+    double* legendreValues = legendreValues_.data( );
+    double* legendreDerivatives = legendreDerivatives_.data( );
+
+    // Set polynomials up to degree and order 1 explicitly.
+    for( int i = 0; ( i <= 1 ) && ( i <= maximumDegree_ ); i++ )
+    {
+        for( int j = 0; ( j <= i ) && ( j <= maximumOrder_ ); j++ )
+        {
+            legendreValues[ i * stride + j ] = computeGeodesyLegendrePolynomialExplicit( i, j, polynomialParameter );
+        }
+    }
+
+    // Compute remaining polynomials through degree recursion (for order < degree) and sectoral recursion.
+    int jMax = -1;
+    for( int i = 2; i <= maximumDegree_; i++ )
+    {
+        double* currentDegreeValues = legendreValues + i * stride;
+        const double* oneDegreePriorValues = currentDegreeValues - stride;
+        const double* twoDegreesPriorValues = oneDegreePriorValues - stride;
+        const double* normalizations = verticalRecursionNormalizations_.data( ) + i * stride;
+        const double* twoDegreesPriorMultipliers = verticalRecursionTwoDegreesPriorMultipliers_.data( ) + i * stride;
+        const double oneDegreePriorMultiplier = verticalRecursionOneDegreePriorMultipliers_[ i ];
+
+        jMax = std::min( i - 1, maximumOrder_ );
+        for( int j = 0; j <= jMax; j++ )
+        {
+            currentDegreeValues[ j ] = normalizations[ j ] *
+                    ( oneDegreePriorMultiplier * polynomialParameter * oneDegreePriorValues[ j ]
+                      - twoDegreesPriorMultipliers[ j ] * twoDegreesPriorValues[ j ] );
+        }
+
+        if( i <= maximumOrder_ )
+        {
+            currentDegreeValues[ i ] = sectoralRecursionMultipliers_[ i ] * legendreValues[ stride + 1 ] *
+                    oneDegreePriorValues[ i - 1 ];
+        }
+    }
+
+    // Compute first derivatives from polynomials at same degree.
+    for( int i = 0; i <= maximumDegree_; i++ )
+    {
+        const double* currentDegreeValues = legendreValues + i * stride;
+        const double* normalizations = derivativeNormalizations_.data( ) + i * stride;
+        double* currentDegreeDerivatives = legendreDerivatives + i * stride;
+
+        jMax = std::min( i, maximumOrder_ );
+        for( int j = 0; j < jMax; j++ )
+        {
+            currentDegreeDerivatives[ j ] =
+                    normalizations[ j ] * currentDegreeValues[ j + 1 ] / polynomialParameterComplement
+                    - static_cast< double >( j ) * polynomialParameter / polynomialParameterComplementSquare
+                    * currentDegreeValues[ j ];
+        }
+
+        if( jMax == i )
+        {
+            currentDegreeDerivatives[ jMax ] =
+                    - static_cast< double >( jMax ) * polynomialParameter / polynomialParameterComplementSquare
+                    * currentDegreeValues[ jMax ];
+        }
+    }
+}
+
 
 //! Get Legendre polynomial value from the cache.
 double LegendreCache::getLegendrePolynomial(
@@ -178,6 +178,40 @@ public:
         currentPolynomialParameter_ = TUDAT_NAN;
     }
 
+    //! Function to retrieve the list of current values of Legendre polynomials.
+    /*!
+     * Function to retrieve the list of current values of Legendre polynomials, as computed by last call to update
+     * function. The polynomial at degree and order (n,m) is at entry n * ( getMaximumOrder( ) + 1 ) + m, so that all
+     * orders of a single degree are stored contiguously. Entries with m > n are not set.
+     * \return List of current values of Legendre polynomials.
+     */
+    const std::vector< double >& getLegendreValues( )
+    {
+        return legendreValues_;
+    }
+
+    //! Function to retrieve the list of current values of first derivatives of Legendre polynomials.
+    /*!
+     * Function to retrieve the list of current values of first derivatives of Legendre polynomials, as computed by
+     * last call to update function. Storage is identical to that of getLegendreValues function.
+     * \return List of current values of first derivatives of Legendre polynomials.
+     */
+    const std::vector< double >& getLegendreDerivatives( )
+    {
+        return legendreDerivatives_;
+    }
+
+    //! Function to retrieve the list of current values of second derivatives of Legendre polynomials.
+    /*!
+     * Function to retrieve the list of current values of second derivatives of Legendre polynomials, as computed by
+     * last call to update function (only set if computation of second derivatives is enabled). Storage is identical
+     * to that of getLegendreValues function.
+     * \return List of current values of second derivatives of Legendre polynomials.
+     */
+    const std::vector< double >& getLegendreSecondDerivatives( )
+    {
+        return legendreSecondDerivatives_;
+    }
 
 
 private:
@@ -231,6 +265,43 @@ private:
     //! update function.
     bool computeSecondDerivatives_;
 
+    //! Pre-computed normalization factors of the geodesy-normalized degree recursion, at degree and order (n,m)
+    /*!
+     * Pre-computed normalization factors of the geodesy-normalized degree recursion, at degree and order (n,m),
+     * stored at entry n * ( maximumOrder_ + 1 ) + m. Entry is equal to sqrt( ( 2n + 1 ) / ( ( n + m )( n - m ) ) ).
+     */
+    std::vector< double > verticalRecursionNormalizations_;
+
+    //! Pre-computed multipliers of the two-degrees-prior polynomial in geodesy-normalized degree recursion.
+    /*!
+     * Pre-computed multipliers of the two-degrees-prior polynomial in geodesy-normalized degree recursion, stored at
+     * entry n * ( maximumOrder_ + 1 ) + m. Entry is equal to sqrt( ( n + m - 1 )( n - m - 1 ) / ( 2n - 3 ) ).
+     */
+    std::vector< double > verticalRecursionTwoDegreesPriorMultipliers_;
+
+    //! Pre-computed multipliers of the one-degree-prior polynomial in geodesy-normalized degree recursion.
+    /*!
+     * Pre-computed multipliers of the one-degree-prior polynomial in geodesy-normalized degree recursion, stored at
+     * entry n. Entry is equal to sqrt( 2n - 1 ).
+     */
+    std::vector< double > verticalRecursionOneDegreePriorMultipliers_;
+
+    //! Pre-computed multipliers of geodesy-normalized sectoral recursion
+    /*!
+     * Pre-computed multipliers of geodesy-normalized sectoral recursion, stored at entry n. Entry is equal to
+     * sqrt( ( 2n + 1 ) / ( 6n ) ).
+     */
+    std::vector< double > sectoralRecursionMultipliers_;
+
+    //! Function to update the geodesy-normalized Legendre polynomials and their first derivatives.
+    /*!
+     * Function to update the geodesy-normalized Legendre polynomials and their first derivatives, using the
+     * pre-computed recursion coefficients. The recursion is performed degree by degree, with all orders of a single
+     * degree computed in a single loop over contiguous memory. The results are identical to those of the
+     * computeGeodesyLegendrePolynomialFromCache and computeGeodesyLegendrePolynomialDerivative functions.
+     */
+    void updateGeodesyNormalizedPolynomials( );
+
 
 };
 
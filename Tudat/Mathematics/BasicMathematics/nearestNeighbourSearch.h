@@ -73,7 +73,7 @@ int computeNearestLeftNeighborUsingBinarySearch(
  */
 template< typename IndependentVariableType >
 int computeNearestLeftNeighborUsingBinarySearch(
-        const std::vector< IndependentVariableType > vectorOfSortedData,
+        const std::vector< IndependentVariableType >& vectorOfSortedData,
         const IndependentVariableType targetValueInVectorOfSortedData )
 {
     // Declare local variables.
@@ -12,6 +12,8 @@
 #ifndef TUDAT_SPHERICAL_HARMONICS_H
 #define TUDAT_SPHERICAL_HARMONICS_H
 
+#include <vector>
+
 #include <Eigen/Core>
 
 #include <boost/make_shared.hpp>
@@ -128,6 +130,39 @@ public:
         return referenceRadiusRatioPowers_[ degreePlusOne ];
     }
 
+    //! Function to retrieve the list of current sines of m times the longitude.
+    /*!
+     * Function to retrieve the list of current sines of m times the longitude, with entry i denoting
+     * sine( i * longitude ).
+     * \return List of current sines of m times the longitude.
+     */
+    const std::vector< double >& getSinesOfMultipleLongitude( )
+    {
+        return sinesOfLongitude_;
+    }
+
+    //! Function to retrieve the list of current cosines of m times the longitude.
+    /*!
+     * Function to retrieve the list of current cosines of m times the longitude, with entry i denoting
+     * cosine( i * longitude ).
+     * \return List of current cosines of m times the longitude.
+     */
+    const std::vector< double >& getCosinesOfMultipleLongitude( )
+    {
+        return cosinesOfLongitude_;
+    }
+
+    //! Function to retrieve the list of current powers of the reference radius divided by the distance.
+    /*!
+     * Function to retrieve the list of current powers of the reference radius divided by the distance, with entry i
+     * denoting this ratio to the power i.
+     * \return List of current powers of the reference radius divided by the distance.
+     */
+    const std::vector< double >& getReferenceRadiusRatioPowersList( )
+    {
+        return referenceRadiusRatioPowers_;
+    }
+
     //! Function to get the maximum degree of cache.
     /*!
      * Function to get the maximum degree of cache
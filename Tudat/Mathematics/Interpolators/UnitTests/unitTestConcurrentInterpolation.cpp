@@ -0,0 +1,338 @@
+/*    Copyright (c) 2010-2017, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ */
+
+#define BOOST_TEST_MAIN
+
+#include <chrono>
+#include <cmath>
+#include <iostream>
+#include <mutex>
+#include <vector>
+
+#include <boost/bind.hpp>
+#include <boost/make_shared.hpp>
+#include <boost/test/unit_test.hpp>
+
+#include <Eigen/Core>
+
+#include "Tudat/Basics/parallelComputation.h"
+#include "Tudat/Mathematics/Interpolators/cubicSplineInterpolator.h"
+#include "Tudat/Mathematics/Interpolators/hermiteCubicSplineInterpolator.h"
+#include "Tudat/Mathematics/Interpolators/lagrangeInterpolator.h"
+#include "Tudat/Mathematics/Interpolators/linearInterpolator.h"
+#include "Tudat/Mathematics/Interpolators/piecewiseConstantInterpolator.h"
+
+namespace tudat
+{
+namespace unit_tests
+{
+
+using namespace interpolators;
+
+typedef Eigen::Matrix< double, 6, 1 > Vector6d;
+
+//! Function to create list of times at which to evaluate interpolators.
+/*!
+ *  Function to create list of times at which to evaluate interpolators, either monotonically increasing, or
+ *  scattered over the full interval (deterministic sequence).
+ */
+std::vector< double > getEvaluationTimes( const double startTime, const double endTime,
+                                          const unsigned int numberOfTimes, const bool monotonic )
+{
+    std::vector< double > evaluationTimes;
+    for( unsigned int i = 0; i < numberOfTimes; i++ )
+    {
+        double fraction = monotonic ? static_cast< double >( i ) / static_cast< double >( numberOfTimes ) :
+                                      std::fmod( 0.6180339887498949 * static_cast< double >( i ), 1.0 );
+        evaluationTimes.push_back( startTime + fraction * ( endTime - startTime ) );
+    }
+    return evaluationTimes;
+}
+
+//! Function to create list of times at which to evaluate interpolators, in blocks starting at arbitrary times.
+/*!
+ *  Function to create list of times at which to evaluate interpolators, consisting of blocks of evaluation times (each
+ *  either monotonically increasing or scattered), with the blocks starting at arbitrary times.
+ */
+std::vector< double > getBlockedEvaluationTimes( const unsigned int numberOfBlocks, const unsigned int blockSize,
+                                                 const bool monotonic )
+{
+    std::vector< double > evaluationTimes;
+    for( unsigned int i = 0; i < numberOfBlocks; i++ )
+    {
+        double blockStartTime = 1.0E3 + 9.0E4 * std::fmod( 0.6180339887498949 * static_cast< double >( i ), 1.0 );
+        std::vector< double > blockTimes = getEvaluationTimes(
+                    blockStartTime, blockStartTime + 5.0E3, blockSize, monotonic );
+        evaluationTimes.insert( evaluationTimes.end( ), blockTimes.begin( ), blockTimes.end( ) );
+    }
+    return evaluationTimes;
+}
+
+//! Function to create Lagrange interpolator for smooth periodic test function.
+boost::shared_ptr< OneDimensionalInterpolator< double, Vector6d > > getTestInterpolator(
+        const unsigned int numberOfNodes )
+{
+    std::map< double, Vector6d > dataMap;
+    for( unsigned int i = 0; i < numberOfNodes; i++ )
+    {
+        double currentTime = 10.0 * static_cast< double >( i );
+        Vector6d currentState;
+        for( int j = 0; j < 6; j++ )
+        {
+            currentState( j ) = std::sin( 1.0E-3 * ( j + 1 ) * currentTime );
+        }
+        dataMap[ currentTime ] = currentState;
+    }
+    return boost::make_shared< LagrangeInterpolator< double, Vector6d > >( dataMap, 8 );
+}
+
+//! Function to evaluate a block of evaluation times with an interpolator, using a hint owned by this function.
+void evaluateInterpolatorBlockWithHint(
+        const unsigned int blockIndex, const unsigned int blockSize,
+        const boost::shared_ptr< OneDimensionalInterpolator< double, Vector6d > > interpolator,
+        const std::vector< double >& evaluationTimes, std::vector< Vector6d >& results )
+{
+    int nearestLowerIndex = -1;
+    for( unsigned int i = blockIndex * blockSize; i < ( blockIndex + 1 ) * blockSize; i++ )
+    {
+        results[ i ] = interpolator->interpolate( evaluationTimes[ i ], nearestLowerIndex );
+    }
+}
+
+//! Function to evaluate a block of evaluation times with an interpolator, using the internal hint, protected by a mutex.
+void evaluateInterpolatorBlockWithLock(
+        const unsigned int blockIndex, const unsigned int blockSize,
+        const boost::shared_ptr< OneDimensionalInterpolator< double, Vector6d > > interpolator,
+        const std::vector< double >& evaluationTimes, std::vector< Vector6d >& results,
+        std::mutex& interpolatorMutex )
+{
+    for( unsigned int i = blockIndex * blockSize; i < ( blockIndex + 1 ) * blockSize; i++ )
+    {
+        std::lock_guard< std::mutex > interpolatorLock( interpolatorMutex );
+        results[ i ] = interpolator->interpolate( evaluationTimes[ i ] );
+    }
+}
+
+//! Interpolator that only implements the single-argument interpolate function (as done by existing derived classes).
+class NearestNeighbourTestInterpolator: public OneDimensionalInterpolator< double, double >
+{
+public:
+
+    using OneDimensionalInterpolator< double, double >::interpolate;
+
+    //! Constructor
+    NearestNeighbourTestInterpolator( const std::vector< double >& independentValues,
+                                      const std::vector< double >& dependentValues )
+    {
+        independentValues_ = independentValues;
+        dependentValues_ = dependentValues;
+        makeLookupScheme( huntingAlgorithm );
+    }
+
+    //! Function interpolates dependent variable value at given independent variable value (nearest lower value).
+    double interpolate( const double independentVariableValue )
+    {
+        return dependentValues_.at( lookUpScheme_->findNearestLowerNeighbour( independentVariableValue ) );
+    }
+};
+
+BOOST_AUTO_TEST_SUITE( test_concurrent_interpolation )
+
+//! Test whether a derived class implementing only the single-argument interpolate function can be used.
+BOOST_AUTO_TEST_CASE( testInterpolatorWithoutLookupHint )
+{
+    std::vector< double > independentValues, dependentValues;
+    for( unsigned int i = 0; i < 10; i++ )
+    {
+        independentValues.push_back( static_cast< double >( i ) );
+        dependentValues.push_back( static_cast< double >( i * i ) );
+    }
+    boost::shared_ptr< OneDimensionalInterpolator< double, double > > interpolator =
+            boost::make_shared< NearestNeighbourTestInterpolator >( independentValues, dependentValues );
+    BOOST_CHECK_EQUAL( interpolator->interpolate( 3.5 ), 9.0 );
+
+    // Check that interpolation with caller-owned hint is not supported.
+    int nearestLowerIndex = -1;
+    bool isExceptionCaught = false;
+    try
+    {
+        interpolator->interpolate( 3.5, nearestLowerIndex );
+    }
+    catch( const std::runtime_error& )
+    {
+        isExceptionCaught = true;
+    }
+    BOOST_CHECK_EQUAL( isExceptionCaught, true );
+
+    // Check lookup with caller-owned hint.
+    BOOST_CHECK_EQUAL( interpolator->getLookUpScheme( )->findNearestLowerNeighbour( 7.5, nearestLowerIndex ), 7 );
+    BOOST_CHECK_EQUAL( nearestLowerIndex, 7 );
+}
+
+//! Test whether interpolation with caller-owned lookup hint gives results identical to interpolation with internal hint.
+BOOST_AUTO_TEST_CASE( testInterpolationWithLookupHint )
+{
+    // Create data
+    std::vector< double > independentValues;
+    std::vector< double > dependentValues;
+    std::vector< double > derivativeValues;
+    for( unsigned int i = 0; i < 500; i++ )
+    {
+        independentValues.push_back( static_cast< double >( i ) + 0.1 * std::sin( static_cast< double >( i ) ) );
+        dependentValues.push_back( std::cos( 0.05 * independentValues.back( ) ) );
+        derivativeValues.push_back( -0.05 * std::sin( 0.05 * independentValues.back( ) ) );
+    }
+
+    // Create interpolators of each type, with both lookup schemes
+    std::vector< boost::shared_ptr< OneDimensionalInterpolator< double, double > > > interpolators;
+    for( unsigned int i = 0; i < 2; i++ )
+    {
+        AvailableLookupScheme lookupScheme = ( i == 0 ) ? huntingAlgorithm : binarySearch;
+        interpolators.push_back( boost::make_shared< LinearInterpolator< double, double > >(
+                                     independentValues, dependentValues, lookupScheme ) );
+        interpolators.push_back( boost::make_shared< CubicSplineInterpolator< double, double > >(
+                                     independentValues, dependentValues, lookupScheme ) );
+        interpolators.push_back( boost::make_shared< LagrangeInterpolator< double, double > >(
+                                     independentValues, dependentValues, 8, lookupScheme ) );
+        interpolators.push_back( boost::make_shared< HermiteCubicSplineInterpolator< double, double > >(
+                                     independentValues, dependentValues, derivativeValues, lookupScheme ) );
+        interpolators.push_back( boost::make_shared< PiecewiseConstantInterpolator< double, double > >(
+                                     independentValues, dependentValues, lookupScheme ) );
+    }
+
+    // Compare results for monotonic and scattered evaluation times
+    for( unsigned int i = 0; i < 2; i++ )
+    {
+        std::vector< double > evaluationTimes = getEvaluationTimes(
+                    independentValues.front( ), independentValues.back( ), 2000, ( i == 0 ) );
+        for( unsigned int j = 0; j < interpolators.size( ); j++ )
+        {
+            int nearestLowerIndex = -1;
+            for( unsigned int k = 0; k < evaluationTimes.size( ); k++ )
+            {
+                BOOST_CHECK_EQUAL( interpolators.at( j )->interpolate( evaluationTimes.at( k ), nearestLowerIndex ),
+                                   interpolators.at( j )->interpolate( evaluationTimes.at( k ) ) );
+            }
+        }
+    }
+
+    // Check that invalid hints are handled by reverting to binary search
+    int invalidHint = 10000;
+    BOOST_CHECK_EQUAL( interpolators.at( 0 )->interpolate( 250.0, invalidHint ),
+                       interpolators.at( 0 )->interpolate( 250.0 ) );
+    BOOST_CHECK_EQUAL( invalidHint, interpolators.at( 0 )->getLookUpScheme( )->findNearestLowerNeighbour( 250.0 ) );
+}
+
+//! Test concurrent evaluation of single interpolator, using caller-owned hints and using mutex-protected internal hint.
+BOOST_AUTO_TEST_CASE( testConcurrentInterpolation )
+{
+    boost::shared_ptr< OneDimensionalInterpolator< double, Vector6d > > interpolator = getTestInterpolator( 10000 );
+
+    const unsigned int numberOfBlocks = 16;
+    const unsigned int blockSize = 25000;
+    const unsigned int numberOfThreads = 4;
+
+    for( unsigned int testCase = 0; testCase < 2; testCase++ )
+    {
+        std::vector< double > evaluationTimes = getBlockedEvaluationTimes( numberOfBlocks, blockSize, ( testCase == 0 ) );
+
+        // Evaluate interpolator serially, using internal hint.
+        std::vector< Vector6d > serialResults( evaluationTimes.size( ) );
+        for( unsigned int i = 0; i < evaluationTimes.size( ); i++ )
+        {
+            serialResults[ i ] = interpolator->interpolate( evaluationTimes[ i ] );
+        }
+
+        // Evaluate interpolator concurrently, using internal hint protected by mutex.
+        std::vector< Vector6d > lockedResults( evaluationTimes.size( ) );
+        std::mutex interpolatorMutex;
+        utilities::executeParallelLoop(
+                    numberOfBlocks, numberOfThreads,
+                    boost::bind( &evaluateInterpolatorBlockWithLock, _1, blockSize, interpolator,
+                                 boost::cref( evaluationTimes ), boost::ref( lockedResults ),
+                                 boost::ref( interpolatorMutex ) ) );
+
+        // Evaluate interpolator concurrently, using caller-owned hints.
+        std::vector< Vector6d > concurrentResults( evaluationTimes.size( ) );
+        utilities::executeParallelLoop(
+                    numberOfBlocks, numberOfThreads,
+                    boost::bind( &evaluateInterpolatorBlockWithHint, _1, blockSize, interpolator,
+                                 boost::cref( evaluationTimes ), boost::ref( concurrentResults ) ) );
+
+        // Check that results are identical
+        unsigned int numberOfDifferentConcurrentResults = 0;
+        unsigned int numberOfDifferentLockedResults = 0;
+        for( unsigned int i = 0; i < evaluationTimes.size( ); i++ )
+        {
+            if( serialResults[ i ] != concurrentResults[ i ] )
+            {
+                numberOfDifferentConcurrentResults++;
+            }
+            if( serialResults[ i ] != lockedResults[ i ] )
+            {
+                numberOfDifferentLockedResults++;
+            }
+        }
+        BOOST_CHECK_EQUAL( numberOfDifferentConcurrentResults, 0 );
+        BOOST_CHECK_EQUAL( numberOfDifferentLockedResults, 0 );
+    }
+}
+
+#if COMPILE_UNIT_TEST_BENCHMARKS
+//! Compare computation time of concurrent evaluation of single interpolator with serial and mutex-protected evaluation
+//! (contention benchmark).
+BOOST_AUTO_TEST_CASE( benchmarkConcurrentInterpolation )
+{
+    boost::shared_ptr< OneDimensionalInterpolator< double, Vector6d > > interpolator = getTestInterpolator( 10000 );
+
+    const unsigned int numberOfBlocks = 16;
+    const unsigned int blockSize = 25000;
+    const unsigned int numberOfThreads = 4;
+
+    for( unsigned int testCase = 0; testCase < 2; testCase++ )
+    {
+        std::vector< double > evaluationTimes = getBlockedEvaluationTimes( numberOfBlocks, blockSize, ( testCase == 0 ) );
+        std::vector< Vector6d > results( evaluationTimes.size( ) );
+
+        std::chrono::steady_clock::time_point startTime = std::chrono::steady_clock::now( );
+        for( unsigned int i = 0; i < evaluationTimes.size( ); i++ )
+        {
+            results[ i ] = interpolator->interpolate( evaluationTimes[ i ] );
+        }
+        double serialTime = std::chrono::duration< double >( std::chrono::steady_clock::now( ) - startTime ).count( );
+
+        std::mutex interpolatorMutex;
+        startTime = std::chrono::steady_clock::now( );
+        utilities::executeParallelLoop(
+                    numberOfBlocks, numberOfThreads,
+                    boost::bind( &evaluateInterpolatorBlockWithLock, _1, blockSize, interpolator,
+                                 boost::cref( evaluationTimes ), boost::ref( results ),
+                                 boost::ref( interpolatorMutex ) ) );
+        double lockedTime = std::chrono::duration< double >( std::chrono::steady_clock::now( ) - startTime ).count( );
+
+        startTime = std::chrono::steady_clock::now( );
+        utilities::executeParallelLoop(
+                    numberOfBlocks, numberOfThreads,
+                    boost::bind( &evaluateInterpolatorBlockWithHint, _1, blockSize, interpolator,
+                                 boost::cref( evaluationTimes ), boost::ref( results ) ) );
+        double concurrentTime = std::chrono::duration< double >( std::chrono::steady_clock::now( ) - startTime ).count( );
+
+        std::cout << ( ( testCase == 0 ) ? "Monotonic" : "Scattered" ) << " evaluation of "
+                  << evaluationTimes.size( ) << " states with " << numberOfThreads << " threads: serial "
+                  << serialTime << " s, mutex-protected " << lockedTime << " s, caller-owned hint "
+                  << concurrentTime << " s" << std::endl;
+    }
+}
+#endif
+
+BOOST_AUTO_TEST_SUITE_END( )
+
+} // namespace unit_tests
+} // namespace tudat
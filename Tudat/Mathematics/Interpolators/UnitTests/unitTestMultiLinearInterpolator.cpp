@@ -11,13 +11,18 @@
 
 #define BOOST_TEST_MAIN
 
+#include <boost/make_shared.hpp>
 #include <boost/test/unit_test.hpp>
 #include <boost/multi_array.hpp>
 
+#include <chrono>
+#include <iostream>
 #include <limits>
 #include <vector>
 #include <cmath>
 
+#include <Eigen/Core>
+
 #include "Tudat/Basics/testMacros.h"
 #include "Tudat/InputOutput/matrixTextFileReader.h"
 
@@ -29,6 +34,231 @@ namespace tudat
 namespace unit_tests
 {
 
+//! Reference implementation of multi-linear interpolation, calculated recursively over all dimensions (as was done by
+//! MultiLinearInterpolator previously), used to verify and benchmark MultiLinearInterpolator.
+template< int NumberOfDimensions >
+class RecursiveMultiLinearInterpolator
+{
+public:
+
+    RecursiveMultiLinearInterpolator( const std::vector< std::vector< double > >& independentValues,
+                                      const boost::multi_array< double, NumberOfDimensions >& dependentData ):
+        independentValues_( independentValues ), dependentData_( dependentData )
+    {
+        for ( int i = 0; i < NumberOfDimensions; i++ )
+        {
+            lookUpSchemes_.push_back( boost::make_shared< interpolators::HuntingAlgorithmLookupScheme< double > >(
+                                          independentValues_[ i ] ) );
+        }
+    }
+
+    double interpolate( const std::vector< double >& independentValuesToInterpolate )
+    {
+        std::vector< int > nearestLowerIndices;
+        nearestLowerIndices.resize( NumberOfDimensions );
+        for ( unsigned int i = 0; i < NumberOfDimensions; i++ )
+        {
+            nearestLowerIndices[ i ] = lookUpSchemes_[ i ]->findNearestLowerNeighbour(
+                        independentValuesToInterpolate[ i ] );
+        }
+
+        boost::array< int, NumberOfDimensions > interpolationIndices;
+        return performRecursiveInterpolationStep( 0, independentValuesToInterpolate,
+                                                  interpolationIndices, nearestLowerIndices );
+    }
+
+private:
+
+    double performRecursiveInterpolationStep(
+            const unsigned int currentVariable,
+            const std::vector< double >& independentValuesToInterpolate,
+            boost::array< int, NumberOfDimensions > currentArrayIndices,
+            const std::vector< int >& nearestLowerIndices )
+    {
+        const double lowerValue = independentValues_[ currentVariable ][ nearestLowerIndices[ currentVariable ] ];
+        const double upperValue = independentValues_[ currentVariable ][ nearestLowerIndices[ currentVariable ] + 1 ];
+        const double upperFraction = ( independentValuesToInterpolate[ currentVariable ] - lowerValue ) /
+                ( upperValue - lowerValue );
+        const double lowerFraction = -( independentValuesToInterpolate[ currentVariable ] - upperValue ) /
+                ( upperValue - lowerValue );
+
+        double upperContribution, lowerContribution;
+        if ( currentVariable == NumberOfDimensions - 1 )
+        {
+            currentArrayIndices[ NumberOfDimensions - 1 ] = nearestLowerIndices[ currentVariable ];
+            lowerContribution = dependentData_( currentArrayIndices );
+            currentArrayIndices[ NumberOfDimensions - 1 ] = nearestLowerIndices[ currentVariable ] + 1;
+            upperContribution = dependentData_( currentArrayIndices );
+        }
+        else
+        {
+            currentArrayIndices[ currentVariable ] = nearestLowerIndices[ currentVariable ];
+            lowerContribution = performRecursiveInterpolationStep(
+                        currentVariable + 1, independentValuesToInterpolate,
+                        currentArrayIndices, nearestLowerIndices );
+            currentArrayIndices[ currentVariable ] = nearestLowerIndices[ currentVariable ] + 1;
+            upperContribution = performRecursiveInterpolationStep(
+                        currentVariable + 1, independentValuesToInterpolate,
+                        currentArrayIndices, nearestLowerIndices );
+        }
+
+        return upperFraction * upperContribution + lowerFraction * lowerContribution;
+    }
+
+    std::vector< boost::shared_ptr< interpolators::LookUpScheme< double > > > lookUpSchemes_;
+
+    std::vector< std::vector< double > > independentValues_;
+
+    boost::multi_array< double, NumberOfDimensions > dependentData_;
+};
+
+//! Function to create a (non-equidistant) table of given dimension, and test points (in random order) in its domain.
+template< int NumberOfDimensions >
+void createMultiLinearInterpolationTestTable(
+        const int numberOfDataPointsPerDimension, const unsigned int numberOfTestPoints,
+        std::vector< std::vector< double > >& independentValues,
+        boost::multi_array< double, NumberOfDimensions >& dependentData,
+        std::vector< std::vector< double > >& testPoints,
+        std::vector< boost::array< double, NumberOfDimensions > >& testPointArrays )
+{
+    // Create (non-equidistant) independent variables and dependent data.
+    independentValues.clear( );
+    independentValues.resize( NumberOfDimensions );
+    boost::array< int, NumberOfDimensions > tableShape;
+    for ( int i = 0; i < NumberOfDimensions; i++ )
+    {
+        for ( int j = 0; j < numberOfDataPointsPerDimension; j++ )
+        {
+            independentValues[ i ].push_back( static_cast< double >( j ) + 0.3 * std::sin( 1.7 * j + i ) );
+        }
+        tableShape[ i ] = numberOfDataPointsPerDimension;
+    }
+
+    dependentData.resize( tableShape );
+    for ( unsigned int i = 0; i < dependentData.num_elements( ); i++ )
+    {
+        dependentData.data( )[ i ] = std::sin( 0.37 * i ) + 0.01 * i;
+    }
+
+    // Create test points, in random order.
+    testPoints.assign( numberOfTestPoints, std::vector< double >( NumberOfDimensions ) );
+    testPointArrays.resize( numberOfTestPoints );
+    for ( unsigned int i = 0; i < numberOfTestPoints; i++ )
+    {
+        for ( int j = 0; j < NumberOfDimensions; j++ )
+        {
+            const double scaledValue = std::fmod( ( i + 1 ) * ( 0.6180339887 + 0.1234567 * j ), 1.0 );
+            testPoints[ i ][ j ] = independentValues[ j ].front( ) +
+                    scaledValue * ( independentValues[ j ].back( ) - independentValues[ j ].front( ) );
+            testPointArrays[ i ][ j ] = testPoints[ i ][ j ];
+        }
+    }
+}
+
+//! Function to compare results of multi-linear interpolation (single-point, with lookup hints and multi-point) with those
+//! of the reference recursive implementation, for a table of given dimension.
+template< int NumberOfDimensions >
+void compareWithRecursiveMultiLinearInterpolation( const int numberOfDataPointsPerDimension,
+                                                   const unsigned int numberOfTestPoints )
+{
+    std::vector< std::vector< double > > independentValues;
+    boost::multi_array< double, NumberOfDimensions > dependentData;
+    std::vector< std::vector< double > > testPoints;
+    std::vector< boost::array< double, NumberOfDimensions > > testPointArrays;
+    createMultiLinearInterpolationTestTable< NumberOfDimensions >(
+                numberOfDataPointsPerDimension, numberOfTestPoints, independentValues, dependentData,
+                testPoints, testPointArrays );
+
+    RecursiveMultiLinearInterpolator< NumberOfDimensions > recursiveInterpolator( independentValues, dependentData );
+    interpolators::MultiLinearInterpolator< double, double, NumberOfDimensions > interpolator(
+                independentValues, dependentData );
+
+    // Compute results of reference and current implementations.
+    std::vector< double > recursiveResults( numberOfTestPoints );
+    std::vector< double > results( numberOfTestPoints );
+    for ( unsigned int i = 0; i < numberOfTestPoints; i++ )
+    {
+        recursiveResults[ i ] = recursiveInterpolator.interpolate( testPoints[ i ] );
+        results[ i ] = interpolator.interpolate( testPoints[ i ] );
+    }
+
+    std::vector< double > multiPointResults;
+    interpolator.interpolateAtPoints( testPointArrays, multiPointResults );
+
+    // Interpolated values are computed with the same operations, so results should be identical.
+    boost::array< int, NumberOfDimensions > nearestLowerIndices;
+    nearestLowerIndices.fill( -1 );
+    BOOST_CHECK_EQUAL( multiPointResults.size( ), numberOfTestPoints );
+    for ( unsigned int i = 0; i < numberOfTestPoints; i++ )
+    {
+        BOOST_CHECK_EQUAL( results[ i ], recursiveResults[ i ] );
+        BOOST_CHECK_EQUAL( multiPointResults[ i ], recursiveResults[ i ] );
+        BOOST_CHECK_EQUAL( interpolator.interpolateWithLookupHints( testPoints[ i ], nearestLowerIndices ),
+                           recursiveResults[ i ] );
+    }
+
+    // Check that table values are reproduced at the data points, including the upper boundaries.
+    std::vector< double > dataPoint( NumberOfDimensions );
+    for ( int i = 0; i < NumberOfDimensions; i++ )
+    {
+        dataPoint[ i ] = independentValues[ i ].back( );
+    }
+    BOOST_CHECK_EQUAL( interpolator.interpolate( dataPoint ),
+                       dependentData.data( )[ dependentData.num_elements( ) - 1 ] );
+    for ( int i = 0; i < NumberOfDimensions; i++ )
+    {
+        dataPoint[ i ] = independentValues[ i ].front( );
+    }
+    BOOST_CHECK_EQUAL( interpolator.interpolate( dataPoint ), dependentData.data( )[ 0 ] );
+}
+
+#if COMPILE_UNIT_TEST_BENCHMARKS
+//! Function to compare computation times of multi-linear interpolation (single-point and multi-point) with those of the
+//! reference recursive implementation, for a table of given dimension.
+template< int NumberOfDimensions >
+void benchmarkMultiLinearInterpolation( const int numberOfDataPointsPerDimension,
+                                        const unsigned int numberOfTestPoints )
+{
+    std::vector< std::vector< double > > independentValues;
+    boost::multi_array< double, NumberOfDimensions > dependentData;
+    std::vector< std::vector< double > > testPoints;
+    std::vector< boost::array< double, NumberOfDimensions > > testPointArrays;
+    createMultiLinearInterpolationTestTable< NumberOfDimensions >(
+                numberOfDataPointsPerDimension, numberOfTestPoints, independentValues, dependentData,
+                testPoints, testPointArrays );
+
+    RecursiveMultiLinearInterpolator< NumberOfDimensions > recursiveInterpolator( independentValues, dependentData );
+    interpolators::MultiLinearInterpolator< double, double, NumberOfDimensions > interpolator(
+                independentValues, dependentData );
+
+    std::vector< double > results( numberOfTestPoints );
+    std::chrono::steady_clock::time_point startTime = std::chrono::steady_clock::now( );
+    for ( unsigned int i = 0; i < numberOfTestPoints; i++ )
+    {
+        results[ i ] = recursiveInterpolator.interpolate( testPoints[ i ] );
+    }
+    double recursiveTime = std::chrono::duration< double >( std::chrono::steady_clock::now( ) - startTime ).count( );
+
+    startTime = std::chrono::steady_clock::now( );
+    for ( unsigned int i = 0; i < numberOfTestPoints; i++ )
+    {
+        results[ i ] = interpolator.interpolate( testPoints[ i ] );
+    }
+    double iterativeTime = std::chrono::duration< double >( std::chrono::steady_clock::now( ) - startTime ).count( );
+
+    startTime = std::chrono::steady_clock::now( );
+    interpolator.interpolateAtPoints( testPointArrays, results );
+    double multiPointTime = std::chrono::duration< double >( std::chrono::steady_clock::now( ) - startTime ).count( );
+
+    std::cout << NumberOfDimensions << "-D table of " << dependentData.num_elements( )
+              << " entries, interpolation time per point: recursive "
+              << 1.0E9 * recursiveTime / numberOfTestPoints << " ns, iterative "
+              << 1.0E9 * iterativeTime / numberOfTestPoints << " ns, multi-point "
+              << 1.0E9 * multiPointTime / numberOfTestPoints << " ns (speedup "
+              << recursiveTime / iterativeTime << ", " << recursiveTime / multiPointTime << ")" << std::endl;
+}
+#endif
+
 BOOST_AUTO_TEST_SUITE( test_multi_linear_interpolation )
 
 // Test 1: Comparison to MATLAB solution of the example provided in matlab's interp2 function
@@ -149,6 +379,76 @@ BOOST_AUTO_TEST_CASE( test4Dimensions )
                                 std::numeric_limits< double >::epsilon( ) );
 }
 
+// Test 3: comparison of results with recursive implementation, for 2- to 5-dimensional tables.
+BOOST_AUTO_TEST_CASE( testIterativeInterpolation )
+{
+    compareWithRecursiveMultiLinearInterpolation< 2 >( 50, 200000 );
+    compareWithRecursiveMultiLinearInterpolation< 3 >( 20, 200000 );
+    compareWithRecursiveMultiLinearInterpolation< 4 >( 12, 200000 );
+    compareWithRecursiveMultiLinearInterpolation< 5 >( 8, 200000 );
+}
+
+#if COMPILE_UNIT_TEST_BENCHMARKS
+// Benchmark: comparison of computation times with recursive implementation, for 2- to 5-dimensional tables.
+BOOST_AUTO_TEST_CASE( benchmarkIterativeInterpolation )
+{
+    benchmarkMultiLinearInterpolation< 2 >( 50, 200000 );
+    benchmarkMultiLinearInterpolation< 3 >( 20, 200000 );
+    benchmarkMultiLinearInterpolation< 4 >( 12, 200000 );
+    benchmarkMultiLinearInterpolation< 5 >( 8, 200000 );
+}
+#endif
+
+// Test 4: interpolation of vector-valued dependent variables (as used for aerodynamic coefficients), compared to
+// interpolation of each of the entries separately.
+BOOST_AUTO_TEST_CASE( testVectorInterpolation )
+{
+    std::vector< std::vector< double > > independentValues( 3 );
+    for ( int i = 0; i < 3; i++ )
+    {
+        for ( int j = 0; j < 7 + i; j++ )
+        {
+            independentValues[ i ].push_back( 0.5 * j * j + i );
+        }
+    }
+
+    boost::multi_array< Eigen::Vector3d, 3 > vectorData( boost::extents[ 7 ][ 8 ][ 9 ] );
+    std::vector< boost::multi_array< double, 3 > > entryData(
+                3, boost::multi_array< double, 3 >( boost::extents[ 7 ][ 8 ][ 9 ] ) );
+    for ( unsigned int i = 0; i < vectorData.num_elements( ); i++ )
+    {
+        vectorData.data( )[ i ] = Eigen::Vector3d( std::sin( 0.1 * i ), std::cos( 0.3 * i ), 0.01 * i );
+        for ( int j = 0; j < 3; j++ )
+        {
+            entryData[ j ].data( )[ i ] = vectorData.data( )[ i ]( j );
+        }
+    }
+
+    interpolators::MultiLinearInterpolator< double, Eigen::Vector3d, 3 > vectorInterpolator(
+                independentValues, vectorData, interpolators::binarySearch );
+    std::vector< boost::array< double, 3 > > testPoints;
+    for ( int i = 0; i < 100; i++ )
+    {
+        boost::array< double, 3 > testPoint = { { 0.18 * i, 1.0 + 0.245 * i, 2.0 + 0.3 * i } };
+        testPoints.push_back( testPoint );
+    }
+    std::vector< Eigen::Vector3d > multiPointResults;
+    vectorInterpolator.interpolateAtPoints( testPoints, multiPointResults );
+
+    for ( int j = 0; j < 3; j++ )
+    {
+        interpolators::MultiLinearInterpolator< double, double, 3 > entryInterpolator(
+                    independentValues, entryData[ j ] );
+        for ( unsigned int i = 0; i < testPoints.size( ); i++ )
+        {
+            std::vector< double > testPoint( testPoints[ i ].begin( ), testPoints[ i ].end( ) );
+            BOOST_CHECK_EQUAL( vectorInterpolator.interpolate( testPoint )( j ),
+                               entryInterpolator.interpolate( testPoint ) );
+            BOOST_CHECK_EQUAL( multiPointResults[ i ]( j ), entryInterpolator.interpolate( testPoint ) );
+        }
+    }
+}
+
 BOOST_AUTO_TEST_SUITE_END( )
 
 } // namespace unit_tests
@@ -114,7 +114,7 @@ public:
     independentValues_;
     using OneDimensionalInterpolator< IndependentVariableType, DependentVariableType >::
     lookUpScheme_;
-    using Interpolator< IndependentVariableType, DependentVariableType >::interpolate;
+    using OneDimensionalInterpolator< IndependentVariableType, DependentVariableType >::interpolate;
 
     //! Cubic spline interpolator constructor.
     /*!
@@ -211,23 +211,38 @@ public:
      */
     ~CubicSplineInterpolator( ){ }
 
+    //! Function interpolates dependent variable value at given independent variable value.
+    /*!
+     *  Function interpolates dependent variable value at given independent variable value, using the lookup hint
+     *  stored in this object (may not be called concurrently from multiple threads, see overloaded function).
+     *  \param targetIndependentVariableValue Value of independent variable at which interpolation is to take place.
+     *  \return Interpolated value of dependent variable.
+     */
+    DependentVariableType interpolate( const IndependentVariableType targetIndependentVariableValue )
+    {
+        return interpolate( targetIndependentVariableValue, this->nearestLowerIndex_ );
+    }
+
     //! Interpolate.
     /*!
      * Executes interpolation of data at a given target value of the independent variable, to
-     * yield an interpolated value of the dependent variable.
+     * yield an interpolated value of the dependent variable. A lookup hint that is owned by the caller is used,
+     * so that this function may be called concurrently from multiple threads (each with its own hint).
      * \param targetIndependentVariableValue Target independent variable value at which point
      * the interpolation is performed.
+     * \param nearestLowerIndex Nearest lower index found during previous call (negative if no previous call
+     * has been made). Set to the nearest lower index of targetIndependentVariableValue (returned by reference).
      * \return Interpolated dependent variable value.
      */
     DependentVariableType interpolate(
-            const IndependentVariableType targetIndependentVariableValue )
+            const IndependentVariableType targetIndependentVariableValue, int& nearestLowerIndex ) const
     {
         using std::pow;
 
         // Determine the lower entry in the table corresponding to the target independent variable
         // value.
         int lowerEntry_ = lookUpScheme_->findNearestLowerNeighbour(
-                    targetIndependentVariableValue );
+                    targetIndependentVariableValue, nearestLowerIndex );
 
         // Get independent variable values bounding interval in which requested value lies.
         IndependentVariableType lowerValue, upperValue;
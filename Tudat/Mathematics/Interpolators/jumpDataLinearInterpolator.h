@@ -53,7 +53,7 @@ public:
     using OneDimensionalInterpolator< IndependentVariableType, DependentVariableType >::dependentValues_;
     using OneDimensionalInterpolator< IndependentVariableType, DependentVariableType >::independentValues_;
     using OneDimensionalInterpolator< IndependentVariableType, DependentVariableType >::lookUpScheme_;
-    using Interpolator< IndependentVariableType, DependentVariableType >::interpolate;
+    using OneDimensionalInterpolator< IndependentVariableType, DependentVariableType >::interpolate;
 
     //! Constructor from map of independent/dependent data.
     /*!
@@ -132,15 +132,31 @@ public:
 
     //! Function interpolates dependent variable value at given independent variable value.
     /*!
-     *  Function interpolates dependent variable value at given independent variable value.
+     *  Function interpolates dependent variable value at given independent variable value, using the lookup hint
+     *  stored in this object (may not be called concurrently from multiple threads, see overloaded function).
+     *  \param independentVariableValue Value of independent variable at which interpolation is to take place.
+     *  \return Interpolated value of dependent variable.
+     */
+    DependentVariableType interpolate( const IndependentVariableType independentVariableValue )
+    {
+        return interpolate( independentVariableValue, this->nearestLowerIndex_ );
+    }
+
+    //! Function interpolates dependent variable value at given independent variable value.
+    /*!
+     *  Function interpolates dependent variable value at given independent variable value, using a lookup hint
+     *  that is owned by the caller (may be called concurrently from multiple threads, each with its own hint).
      *  \param independentVariableValue Value of independent variable at which interpolation
      *  is to take place.
+     *  \param nearestLowerIndex Nearest lower index found during previous call (negative if no previous call
+     *  has been made). Set to the nearest lower index of independentVariableValue (returned by reference).
      *  \return Interpolated value of dependent variable.
      */
-    DependentVariableType interpolate( const IndependentVariableType independentVariableValue )
+    DependentVariableType interpolate( const IndependentVariableType independentVariableValue,
+                                       int& nearestLowerIndex ) const
     {
         // Lookup nearest lower index.
-        int newNearestLowerIndex = lookUpScheme_->findNearestLowerNeighbour( independentVariableValue );
+        int newNearestLowerIndex = lookUpScheme_->findNearestLowerNeighbour( independentVariableValue, nearestLowerIndex );
 
         DependentVariableType interpolatedValue;
 
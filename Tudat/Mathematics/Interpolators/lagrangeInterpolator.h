@@ -19,6 +19,8 @@
 
 #include <boost/make_shared.hpp>
 
+#include <Eigen/Core>
+
 #include "Tudat/Mathematics/BasicMathematics/mathematicalConstants.h"
 
 #include "Tudat/Mathematics/Interpolators/oneDimensionalInterpolator.h"
@@ -131,9 +133,6 @@ public:
         // interpolation call.
         initializeDenominators( );
         initializeBoundaryInterpolators( selectedLookupScheme );
-
-        // Pre-allocate cache vector for computational efficiency.
-        independentVariableDifferenceCache.resize( 2 * offsetEntries_ + 2 );
     }
 
     //! Constructor from map of independent/dependent data.
@@ -196,8 +195,6 @@ public:
         //interpolation call.
         initializeDenominators( );
         initializeBoundaryInterpolators( selectedLookupScheme );
-
-        independentVariableDifferenceCache.resize( 2 * offsetEntries_ + 2 );
     }
 
     //! Destructor.
@@ -213,13 +210,179 @@ public:
      *  Note that the number of data points, not the values of the independent variables
      *  are used for determining the center (in case of a non-equispaced grid). If the required
      *  interpolating polynimial goes beyond the independent variable bondaries,
-     *  a cubic spline with natural boundary conditions is used.
+     *  a cubic spline with natural boundary conditions is used. The lookup hints of this object (and of the
+     *  boundary interpolators) are used and updated, so that this function may not be called concurrently from
+     *  multiple threads.
+     *  \param targetIndependentVariableValue Value of independent variable at which interpolation
+     *  is to take place.
+     *  \return Interpolated value of dependent variable.
+     */
+    DependentVariableType interpolate( const IndependentVariableType targetIndependentVariableValue )
+    {
+        return performInterpolation( targetIndependentVariableValue, this->nearestLowerIndex_, false );
+    }
+
+    //! Function interpolates dependent variable value at given independent variable value, using a caller-owned hint.
+    /*!
+     *  Function interpolates dependent variable value at given independent variable value (see single-argument
+     *  function). This function does not modify the state of the interpolator, and may be called concurrently from
+     *  multiple threads, provided that each thread uses its own lookup hint.
      *  \param targetIndependentVariableValue Value of independent variable at which interpolation
      *  is to take place.
+     *  \param nearestLowerIndex Nearest lower index found during previous call (negative if no previous call
+     *  has been made). Set to the nearest lower index of targetIndependentVariableValue (returned by reference).
      *  \return Interpolated value of dependent variable.
      */
     DependentVariableType interpolate(
-            const IndependentVariableType targetIndependentVariableValue )
+            const IndependentVariableType targetIndependentVariableValue, int& nearestLowerIndex ) const
+    {
+        return performInterpolation( targetIndependentVariableValue, nearestLowerIndex, true );
+    }
+
+    //! Function to compute the weights of the data points in the interpolating polynomial at a given value.
+    /*!
+     *  Function to compute the weights with which the dependent values of the data points are multiplied and summed to
+     *  obtain the interpolated value at a given independent variable value. The weights may then be reused for each
+     *  entry of a (matrix-valued) dependent variable, or for any other data set defined at the same independent
+     *  variable values. The weights are only computed if the centered Lagrange polynomial is used at the requested
+     *  value, i.e. not in the boundary regions of the interpolation domain, in which case the interpolate function
+     *  must be used instead. This function does not modify the state of the interpolator, and may be called
+     *  concurrently from multiple threads, provided that each thread uses its own lookup hint.
+     *  \param targetIndependentVariableValue Value of independent variable at which interpolation
+     *  is to take place.
+     *  \param nearestLowerIndex Nearest lower index found during previous call (negative if no previous call
+     *  has been made). Set to the nearest lower index of targetIndependentVariableValue (returned by reference).
+     *  \param firstDataPointIndex Index of the first of the data points used by the interpolating polynomial
+     *  (returned by reference).
+     *  \param weights Weights of the consecutive data points used by the interpolating polynomial, starting at
+     *  firstDataPointIndex (returned by reference; only resized if its size differs from the number of stages).
+     *  \return True if the weights were computed, false if targetIndependentVariableValue is in a boundary region.
+     */
+    bool computeInterpolationWeights(
+            const IndependentVariableType targetIndependentVariableValue, int& nearestLowerIndex,
+            int& firstDataPointIndex, Eigen::Matrix< ScalarType, Eigen::Dynamic, 1 >& weights ) const
+    {
+        // Find interpolation interval, and check if centered lagrange interpolation can be used.
+        int lowerEntry = lookUpScheme_->findNearestLowerNeighbour(
+                    targetIndependentVariableValue, nearestLowerIndex );
+        if( lowerEntry < offsetEntries_ || lowerEntry >= numberOfIndependentValues_ - offsetEntries_ - 1 )
+        {
+            return false;
+        }
+
+        if( weights.rows( ) != numberOfStages_ )
+        {
+            weights.resize( numberOfStages_ );
+        }
+        firstDataPointIndex = lowerEntry - offsetEntries_;
+
+        // Compute repeated numerator, and check if requested independent variable is equal to data point
+        ScalarType repeatedNumerator = mathematical_constants::getFloatingInteger< ScalarType >( 1 );
+        for( int i = 0; i < numberOfStages_; i++ )
+        {
+            if( independentValues_[ firstDataPointIndex + i ] == targetIndependentVariableValue )
+            {
+                weights.setZero( );
+                weights( i ) = mathematical_constants::getFloatingInteger< ScalarType >( 1 );
+                return true;
+            }
+            repeatedNumerator *= static_cast< ScalarType >(
+                        targetIndependentVariableValue - independentValues_[ firstDataPointIndex + i ] );
+        }
+
+        // Compute weight of each data point.
+        for( int i = 0; i < numberOfStages_; i++ )
+        {
+            weights( i ) = repeatedNumerator /
+                    ( static_cast< ScalarType >(
+                          targetIndependentVariableValue - independentValues_[ firstDataPointIndex + i ] ) *
+                      denominators[ lowerEntry ][ i ] );
+        }
+        return true;
+    }
+
+    //! Function to retrieve the number of stages of interpolator
+    /*!
+     * Function to retrieve the number of stages of interpolator
+     * \return Number of stages of interpolator
+     */
+    int getNumberOfStages( )
+    {
+        return numberOfStages_;
+    }
+
+
+protected:
+
+private:
+
+    //! Function called at initialization which pre-computes the denominators of the
+    //! interpolants at each interval.
+    /*!
+     *  Function called at initialization which pre-computes the denominators of the interpolants
+     *  at each interval, i.e. each interval between two subsequent independent variable values.
+     */
+    void initializeDenominators( )
+    {
+        // Check validity of requested number of stages"
+        if( numberOfStages_% 2 != 0 )
+        {
+            throw std::runtime_error(
+                        "Error, Lagrange interp. only implemented for even number of stages." );
+        }
+        if( numberOfStages_ < 2 )
+        {
+            throw std::runtime_error(
+                        "Error, Lagrange interplator number of stages must be greater than 2." );
+        }
+
+        // Determine offset from boundary of interpolation interval where interpolant is valid.
+        offsetEntries_ = numberOfStages_ / 2 - 1;
+
+        // Iterate over all intervals and calculate denominators
+        int currentIterationStart;
+        denominators.resize( numberOfIndependentValues_ );
+        for( int i = offsetEntries_; i <= numberOfIndependentValues_ - offsetEntries_; i++ )
+        {
+            // Determine start index in independent variables for current polynomial
+            currentIterationStart = i - offsetEntries_;
+
+            denominators[ i ].resize( 2 * offsetEntries_ + 2 );
+
+            // Calculate all denominators for single interval.
+            for( int j = 0; j <= 2 * offsetEntries_ + 1; j++ )
+            {
+                denominators[ i ][ j ] =
+                        mathematical_constants::getFloatingInteger< ScalarType >( 1 );
+
+                for( int k = 0; k <= 2 * offsetEntries_ + 1; k++ )
+                {
+                    if( k != j )
+                    {
+                        denominators[ i ][ j ] *= static_cast< ScalarType >(
+                                    independentValues_[ j + currentIterationStart ] -
+                                    independentValues_[ k + currentIterationStart ] );
+                    }
+                }
+            }
+        }
+    }
+
+    //! Function interpolates dependent variable value at given independent variable value.
+    /*!
+     *  Function interpolates dependent variable value at given independent variable value, called by both interpolate
+     *  functions.
+     *  \param targetIndependentVariableValue Value of independent variable at which interpolation
+     *  is to take place.
+     *  \param nearestLowerIndex Nearest lower index found during previous call (negative if no previous call
+     *  has been made). Set to the nearest lower index of targetIndependentVariableValue (returned by reference).
+     *  \param useCallerOwnedHint Boolean denoting whether the boundary interpolators are evaluated with a hint derived
+     *  from nearestLowerIndex (if true), or with their own stored hint (if false, not thread-safe).
+     *  \return Interpolated value of dependent variable.
+     */
+    DependentVariableType performInterpolation(
+            const IndependentVariableType targetIndependentVariableValue, int& nearestLowerIndex,
+            const bool useCallerOwnedHint ) const
     {
         using std::pow;
 
@@ -236,7 +399,7 @@ public:
 
         // Find interpolation interval
         int lowerEntry = lookUpScheme_->findNearestLowerNeighbour(
-                    targetIndependentVariableValue );
+                    targetIndependentVariableValue, nearestLowerIndex );
 
         // Check if requested interval is inside region in which centered lagrange interpolation
         // can be used.
@@ -249,8 +412,17 @@ public:
             }
             else if( numberOfStages_ > 2 )
             {
-                interpolatedValue = beginInterpolator_->interpolate(
-                            targetIndependentVariableValue );
+                if( useCallerOwnedHint )
+                {
+                    // Begin interpolator is defined on first data points: nearest lower index is identical.
+                    int boundaryNearestLowerIndex = lowerEntry;
+                    interpolatedValue = beginInterpolator_->interpolate(
+                                targetIndependentVariableValue, boundaryNearestLowerIndex );
+                }
+                else
+                {
+                    interpolatedValue = beginInterpolator_->interpolate( targetIndependentVariableValue );
+                }
             }
         }
         else if( lowerEntry >= numberOfIndependentValues_ - offsetEntries_ - 1 )
@@ -262,8 +434,17 @@ public:
             }
             else if( numberOfStages_ > 2 )
             {
-                interpolatedValue = endInterpolator_->interpolate(
-                            targetIndependentVariableValue );
+                if( useCallerOwnedHint )
+                {
+                    // End interpolator is defined on last data points: nearest lower index is offset.
+                    int boundaryNearestLowerIndex = lowerEntry - endInterpolatorStartIndex_;
+                    interpolatedValue = endInterpolator_->interpolate(
+                                targetIndependentVariableValue, boundaryNearestLowerIndex );
+                }
+                else
+                {
+                    interpolatedValue = endInterpolator_->interpolate( targetIndependentVariableValue );
+                }
             }
         }
         else
@@ -287,27 +468,25 @@ public:
             }
             else
             {
-                // Set up repeated numerator and cache of independent variable values from which
+                // Set up repeated numerator from independent variable values from which
                 // interpolant is created.
                 int j = 0;
                 for( int i = 0; i <= 2 * offsetEntries_ + 1; i++ )
                 {
                     j = i + lowerEntry - offsetEntries_;
-                    independentVariableDifferenceCache[ i ] =
-                            static_cast< ScalarType >(
+                    repeatedNumerator *= static_cast< ScalarType >(
                                 targetIndependentVariableValue - independentValues_[ j ] );
 
-                    repeatedNumerator *= independentVariableDifferenceCache[ i ];
-
                 }
 
-                // Evaluate interpolating polynomial at requested data point.
+                // Evaluate interpolating polynomial at requested data point (differences are recomputed,
+                // rather than cached, so that no member variables are modified).
                 for( int i = 0; i <=  2 *offsetEntries_ + 1; i++ )
                 {
                     j = i + lowerEntry - offsetEntries_;
                     interpolatedValue += dependentValues_[ j ]  *
                             ( repeatedNumerator /
-                              ( independentVariableDifferenceCache[ i ] *
+                              ( static_cast< ScalarType >( targetIndependentVariableValue - independentValues_[ j ] ) *
                                 denominators[ lowerEntry ][ j - lowerEntry + offsetEntries_ ] ) );
                 }
             }
@@ -316,73 +495,6 @@ public:
         return interpolatedValue;
     }
 
-    //! Function to retrieve the number of stages of interpolator
-    /*!
-     * Function to retrieve the number of stages of interpolator
-     * \return Number of stages of interpolator
-     */
-    int getNumberOfStages( )
-    {
-        return numberOfStages_;
-    }
-
-
-protected:
-
-private:
-
-    //! Function called at initialization which pre-computes the denominators of the
-    //! interpolants at each interval.
-    /*!
-     *  Function called at initialization which pre-computes the denominators of the interpolants
-     *  at each interval, i.e. each interval between two subsequent independent variable values.
-     */
-    void initializeDenominators( )
-    {
-        // Check validity of requested number of stages"
-        if( numberOfStages_% 2 != 0 )
-        {
-            throw std::runtime_error(
-                        "Error, Lagrange interp. only implemented for even number of stages." );
-        }
-        if( numberOfStages_ < 2 )
-        {
-            throw std::runtime_error(
-                        "Error, Lagrange interplator number of stages must be greater than 2." );
-        }
-
-        // Determine offset from boundary of interpolation interval where interpolant is valid.
-        offsetEntries_ = numberOfStages_ / 2 - 1;
-
-        // Iterate over all intervals and calculate denominators
-        int currentIterationStart;
-        denominators.resize( numberOfIndependentValues_ );
-        for( int i = offsetEntries_; i <= numberOfIndependentValues_ - offsetEntries_; i++ )
-        {
-            // Determine start index in independent variables for current polynomial
-            currentIterationStart = i - offsetEntries_;
-
-            denominators[ i ].resize( 2 * offsetEntries_ + 2 );
-
-            // Calculate all denominators for single interval.
-            for( int j = 0; j <= 2 * offsetEntries_ + 1; j++ )
-            {
-                denominators[ i ][ j ] =
-                        mathematical_constants::getFloatingInteger< ScalarType >( 1 );
-
-                for( int k = 0; k <= 2 * offsetEntries_ + 1; k++ )
-                {
-                    if( k != j )
-                    {
-                        denominators[ i ][ j ] *= static_cast< ScalarType >(
-                                    independentValues_[ j + currentIterationStart ] -
-                                    independentValues_[ k + currentIterationStart ] );
-                    }
-                }
-            }
-        }
-    }
-
     //! Function called at initialization which creates the interpolators used at the boundaries
     //! of the interpolation domain.
     /*!
@@ -397,6 +509,8 @@ private:
     void initializeBoundaryInterpolators(
             const AvailableLookupScheme selectedLookupScheme = huntingAlgorithm )
     {
+        endInterpolatorStartIndex_ = 0;
+
         // Create interpolators
         if( boundaryHandling_ == lagrange_cubic_spline_boundary_interpolation )
         {
@@ -425,6 +539,7 @@ private:
                     < IndependentVariableType, DependentVariableType, ScalarType > >( startMap );
             endInterpolator_ = boost::make_shared< CubicSplineInterpolator
                     < IndependentVariableType, DependentVariableType, ScalarType > >( endMap );
+            endInterpolatorStartIndex_ = numberOfIndependentValues_ - cubicSplineInputSize - 1;
         }
     }
 
@@ -452,7 +567,8 @@ private:
      */
     int offsetEntries_;
 
-    std::vector< ScalarType > independentVariableDifferenceCache;
+    //! Index of first data point used by the interpolator at the end of the domain.
+    int endInterpolatorStartIndex_;
 
     //! Interpolator to be used at beginning of domain.
     boost::shared_ptr< OneDimensionalInterpolator
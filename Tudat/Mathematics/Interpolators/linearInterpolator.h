@@ -54,7 +54,7 @@ public:
     independentValues_;
     using OneDimensionalInterpolator< IndependentVariableType, DependentVariableType >::
     lookUpScheme_;
-    using Interpolator< IndependentVariableType, DependentVariableType >::interpolate;
+    using OneDimensionalInterpolator< IndependentVariableType, DependentVariableType >::interpolate;
 
     //! Constructor from map of independent/dependent data.
     /*!
@@ -140,16 +140,32 @@ public:
 
     //! Function interpolates dependent variable value at given independent variable value.
     /*!
-     * Function interpolates dependent variable value at given independent variable value.
+     *  Function interpolates dependent variable value at given independent variable value, using the lookup hint
+     *  stored in this object (may not be called concurrently from multiple threads, see overloaded function).
+     *  \param independentVariableValue Value of independent variable at which interpolation is to take place.
+     *  \return Interpolated value of dependent variable.
+     */
+    DependentVariableType interpolate( const IndependentVariableType independentVariableValue )
+    {
+        return interpolate( independentVariableValue, this->nearestLowerIndex_ );
+    }
+
+    //! Function interpolates dependent variable value at given independent variable value.
+    /*!
+     * Function interpolates dependent variable value at given independent variable value, using a lookup hint
+     * that is owned by the caller (may be called concurrently from multiple threads, each with its own hint).
      * \param independentVariableValue Value of independent variable at which interpolation
      *          is to take place.
+     * \param nearestLowerIndex Nearest lower index found during previous call (negative if no previous call
+     *          has been made). Set to the nearest lower index of independentVariableValue (returned by reference).
      * \return Interpolated value of dependent variable.
      */
-    DependentVariableType interpolate( const IndependentVariableType independentVariableValue )
+    DependentVariableType interpolate( const IndependentVariableType independentVariableValue,
+                                       int& nearestLowerIndex ) const
     {
         // Lookup nearest lower index.
         int newNearestLowerIndex = lookUpScheme_->findNearestLowerNeighbour(
-                    independentVariableValue );
+                    independentVariableValue, nearestLowerIndex );
 
         // Perform linear interpolation.
         DependentVariableType interpolatedValue = dependentValues_[ newNearestLowerIndex ] +
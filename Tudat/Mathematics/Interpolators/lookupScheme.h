@@ -69,6 +69,27 @@ public:
      */
     virtual int findNearestLowerNeighbour( const IndependentVariableType valueToLookup ) = 0;
 
+    //! Find nearest left neighbour, using a lookup hint that is owned by the caller.
+    /*!
+     * Function finds nearest left neighbour of given value in independentVariableValues_, using a hint (typically the
+     * result of the previous lookup) that is stored by the caller. This function does not modify the state of the
+     * object, so that a single object can be used by multiple threads concurrently (each with its own hint). The
+     * default implementation performs a binary search, without using the hint.
+     * \param valueToLookup Value of which nearest neaighbour is to be determined.
+     * \param nearestLowerIndexHint Index from which to start the search (typically the result of the previous call).
+     * A negative value denotes that no hint is available. Set to the index that is returned by this function (returned
+     * by reference).
+     * \return Index of entry in independentVariableValues_ vector which is nearest lower neighbour
+     * to valueToLookup.
+     */
+    virtual int findNearestLowerNeighbour( const IndependentVariableType valueToLookup,
+                                           int& nearestLowerIndexHint ) const
+    {
+        nearestLowerIndexHint = basic_mathematics::computeNearestLeftNeighborUsingBinarySearch
+                < IndependentVariableType >( independentVariableValues_, valueToLookup );
+        return nearestLowerIndexHint;
+    }
+
 protected:
 
     //! Vector of independent variable values in which lookup is to be performed.
@@ -99,8 +120,7 @@ public:
     HuntingAlgorithmLookupScheme( const std::vector< IndependentVariableType >&
                                   independentVariableValues )
         : LookUpScheme< IndependentVariableType >( independentVariableValues ),
-          isFirstLookupDone( 0 ),
-          previousNearestLowerIndex_( 0 )
+          previousNearestLowerIndex_( -1 )
     { }
 
     //! Default destructor
@@ -112,31 +132,50 @@ public:
     //! Find nearest left neighbour.
     /*!
      * Function finds nearest left neighbour of given value in ndependentVariableValues_. If this
-     * is first call of function, a binary search is used.
+     * is first call of function, a binary search is used. The result of the previous call is stored in this object,
+     * so that this function may not be called concurrently from multiple threads (see overloaded function).
      * \param valueToLookup Value of which nearest neighbour is to be determined.
      * \return Index of entry in independentVariableValues_ vector which is nearest lower neighbour
      * to valueToLookup.
      */
     int findNearestLowerNeighbour( const IndependentVariableType valueToLookup )
+    {
+        return findNearestLowerNeighbour( valueToLookup, previousNearestLowerIndex_ );
+    }
+
+    //! Find nearest left neighbour, using a lookup hint that is owned by the caller.
+    /*!
+     * Function finds nearest left neighbour of given value in independentVariableValues_, starting the hunting
+     * algorithm from the hint provided by the caller. If no (valid) hint is provided, a binary search is used. This
+     * function does not modify the state of this object, and may be called concurrently from multiple threads,
+     * provided that each thread uses its own hint.
+     * \param valueToLookup Value of which nearest neighbour is to be determined.
+     * \param nearestLowerIndexHint Nearest left index during previous call (negative if no previous call has been
+     * made). Set to the index that is returned by this function (returned by reference).
+     * \return Index of entry in independentVariableValues_ vector which is nearest lower neighbour
+     * to valueToLookup.
+     */
+    int findNearestLowerNeighbour( const IndependentVariableType valueToLookup,
+                                   int& nearestLowerIndexHint ) const
     {
         // Initialize return value.
         int newNearestLowerIndex = 0;
 
-        // If this is first call of function, use binary search.
-        if ( !isFirstLookupDone )
+        // If no valid hint is available, use binary search.
+        if ( nearestLowerIndexHint < 0 ||
+             nearestLowerIndexHint > static_cast< int >( independentVariableValues_.size( ) ) - 2 )
         {
             newNearestLowerIndex = basic_mathematics::computeNearestLeftNeighborUsingBinarySearch
                     < IndependentVariableType >( independentVariableValues_, valueToLookup );
-            isFirstLookupDone = 1;
         }
 
         else
         {
             // If requested value is in same interval, return same value as previous time.
             if ( basic_mathematics::isIndependentVariableInInterval< IndependentVariableType >
-                 ( previousNearestLowerIndex_,  valueToLookup, independentVariableValues_ ) )
+                 ( nearestLowerIndexHint,  valueToLookup, independentVariableValues_ ) )
             {
-                newNearestLowerIndex = previousNearestLowerIndex_;
+                newNearestLowerIndex = nearestLowerIndexHint;
             }
 
             // Otherwise, perform hunting algorithm.
@@ -145,27 +184,21 @@ public:
                 newNearestLowerIndex =
                         basic_mathematics::findNearestLeftNeighbourUsingHuntingAlgorithm<
                         IndependentVariableType >
-                        (  valueToLookup, previousNearestLowerIndex_, independentVariableValues_ );
+                        (  valueToLookup, nearestLowerIndexHint, independentVariableValues_ );
             }
         }
 
         // Set calculated value for use in next call.
-        previousNearestLowerIndex_ = newNearestLowerIndex;
+        nearestLowerIndexHint = newNearestLowerIndex;
 
         return newNearestLowerIndex;
     }
 
 private:
 
-    //! Boolean to denote whether a lookup has been done.
-    /*!
-     * Boolean to denote whether a lookup has been done.
-     */
-    bool isFirstLookupDone;
-
     //! Nearest left index during previous call.
     /*!
-     * Nearest left index during previous call
+     * Nearest left index during previous call (negative if no lookup has been done yet).
      */
     int previousNearestLowerIndex_;
 };
@@ -211,6 +244,24 @@ public:
         return basic_mathematics::computeNearestLeftNeighborUsingBinarySearch
                 < IndependentVariableType >( independentVariableValues_, valueToLookup );
     }
+
+    //! Find nearest left neighbour.
+    /*!
+     * Function finds nearest left neighbour of given value in independentVariableValues_. The hint provided as input
+     * is not used by the binary search, but is set to the index that is found. This function may be called
+     * concurrently from multiple threads.
+     * \param valueToLookup Value of which nearest neaighbour is to be determined.
+     * \param nearestLowerIndexHint Set to the index that is returned by this function (returned by reference).
+     * \return Index of entry in independentVariableValues_ vector which is nearest lower neighbour
+     * to valueToLookup.
+     */
+    int findNearestLowerNeighbour( const IndependentVariableType valueToLookup,
+                                   int& nearestLowerIndexHint ) const
+    {
+        nearestLowerIndexHint = basic_mathematics::computeNearestLeftNeighborUsingBinarySearch
+                < IndependentVariableType >( independentVariableValues_, valueToLookup );
+        return nearestLowerIndexHint;
+    }
 };
 
 //! Typedef for shared-pointer to LookUpScheme object with double-type entries.
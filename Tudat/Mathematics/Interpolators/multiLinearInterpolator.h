@@ -47,8 +47,10 @@ namespace interpolators
 //! Class for performing multi-linear interpolation for arbitrary number of independent variables.
 /*!
  * Class for performing multi-linear interpolation for arbitrary number of independent variables.
- * Interpolation is calculated recursively over all dimensions of independent variables. Note
- * that the types (i.e. double, float) of all independent variables must be the same.
+ * The dependent variable values at the 2^{NumberOfDimensions} corners of the grid hyper-rectangle
+ * containing the interpolation point are retrieved using precomputed memory offsets, after which
+ * the interpolation is calculated iteratively, reducing the number of dimensions by one in each
+ * step. Note that the types (i.e. double, float) of all independent variables must be the same.
  * \tparam IndependentVariableType Type for independent variables.
  * \tparam DependentVariableType Type for dependent variable.
  * \tparam NumberOfDimensions Number of independent variables.
@@ -60,6 +62,12 @@ class MultiLinearInterpolator: public Interpolator< IndependentVariableType,
 {
 public:
 
+    //! Typedef for array of indices of nearest lower neighbours in all dimensions.
+    typedef boost::array< int, NumberOfDimensions > IndexArray;
+
+    //! Typedef for array of values of independent variables at a single point.
+    typedef boost::array< IndependentVariableType, NumberOfDimensions > IndependentValueArray;
+
     //! Constructor taking independent and dependent variable data.
     /*!
      * \param independentValues Vector of vectors containing data points of independent variables,
@@ -96,6 +104,8 @@ public:
         }
 
         makeLookupSchemes( selectedLookupScheme );
+        computeCornerOffsets( );
+        nearestLowerIndices_.fill( -1 );
     }
 
     //! Default destructor
@@ -106,7 +116,10 @@ public:
 
     //! Function to perform interpolation.
     /*!
-     *  This function performs the multilinear interpolation.
+     *  This function performs the multilinear interpolation. The nearest lower indices that are found
+     *  during the interpolation are stored in this object, and used as a starting point for the lookup in
+     *  the next call. Consequently, this function may not be called concurrently from multiple threads
+     *  (see overloaded function).
      *  \param independentValuesToInterpolate Vector of values of independent variables at which
      *  the value of the dependent variable is to be determined.
      *  \return Interpolated value of dependent variable in all dimensions.
@@ -114,27 +127,53 @@ public:
     DependentVariableType interpolate(
             const std::vector< IndependentVariableType >& independentValuesToInterpolate )
     {
-        // Determine the nearest lower neighbours.
-        std::vector< int > nearestLowerIndices;
-        nearestLowerIndices.resize( NumberOfDimensions );
-        for ( unsigned int i = 0; i < NumberOfDimensions; i++ )
-        {
-            nearestLowerIndices[ i ] = lookUpSchemes_[ i ]->findNearestLowerNeighbour(
-                    independentValuesToInterpolate[ i ] );
-        }
+        return interpolateWithLookupHints( independentValuesToInterpolate, nearestLowerIndices_ );
+    }
 
-        // Initialize function evaluation indices to -1 for debugging purposes.
-        boost::array< int, NumberOfDimensions > interpolationIndices;
-        for ( int i = 0; i < NumberOfDimensions; i++ )
+    //! Function to perform interpolation, using lookup hints that are owned by the caller.
+    /*!
+     *  This function performs the multilinear interpolation, using lookup hints (the nearest lower
+     *  indices of the previous call) that are stored by the caller. This function does not modify the
+     *  state of the interpolator, so that a single interpolator can be used concurrently from multiple
+     *  threads, provided that each thread uses its own hints.
+     *  \param independentValuesToInterpolate Vector of values of independent variables at which
+     *  the value of the dependent variable is to be determined.
+     *  \param nearestLowerIndices Nearest lower indices in all dimensions found during previous call
+     *  (negative if no previous call has been made). Set to the nearest lower indices of
+     *  independentValuesToInterpolate (returned by reference).
+     *  \return Interpolated value of dependent variable in all dimensions.
+     */
+    DependentVariableType interpolateWithLookupHints(
+            const std::vector< IndependentVariableType >& independentValuesToInterpolate,
+            IndexArray& nearestLowerIndices ) const
+    {
+        return interpolateAtPoint( independentValuesToInterpolate.data( ), nearestLowerIndices );
+    }
+
+    //! Function to perform interpolation at multiple points.
+    /*!
+     *  This function performs the multilinear interpolation at multiple points. The lookup of each point
+     *  starts from the nearest lower indices of the previous point, so that the lookup is most efficient
+     *  if subsequent points are close to one another. This function does not modify the state of the
+     *  interpolator, and may be called concurrently from multiple threads.
+     *  \param independentValuesToInterpolate Vector of values of independent variables at each point at which
+     *  the value of the dependent variable is to be determined.
+     *  \param interpolatedValues Interpolated values of dependent variable, at each point (returned by
+     *  reference).
+     */
+    void interpolateAtPoints(
+            const std::vector< IndependentValueArray >& independentValuesToInterpolate,
+            std::vector< DependentVariableType >& interpolatedValues ) const
+    {
+        IndexArray nearestLowerIndices;
+        nearestLowerIndices.fill( -1 );
+
+        interpolatedValues.resize( independentValuesToInterpolate.size( ) );
+        for( unsigned int i = 0; i < independentValuesToInterpolate.size( ); i++ )
         {
-            interpolationIndices[ i ] = -1;
+            interpolatedValues[ i ] = interpolateAtPoint(
+                        independentValuesToInterpolate[ i ].data( ), nearestLowerIndices );
         }
-
-        // Call first step of interpolation, this function calls itself at subsequent independent
-        // variable dimensions to evaluate and properly scale dependent variable table values at
-        // all 2^n grid edges.
-        return performRecursiveInterpolationStep( 0, independentValuesToInterpolate,
-                                                  interpolationIndices, nearestLowerIndices );
     }
 
     //! Function to return the number of independent variables of the interpolation.
@@ -151,6 +190,13 @@ public:
 
 private:
 
+    //! Number of corners of a grid hyper-rectangle.
+    static const int numberOfCorners = 1 << NumberOfDimensions;
+
+    //! Typedef for (signed) index and memory offset type of dependent data.
+    typedef typename boost::multi_array< DependentVariableType, static_cast< size_t >( NumberOfDimensions ) >::index
+    DataIndex;
+
     //! Make the lookup scheme that is to be used.
     /*!
      * This function creates the look up scheme that is to be used in determining the interval of
@@ -161,7 +207,6 @@ private:
      */
     void makeLookupSchemes( const AvailableLookupScheme selectedScheme )
     {
-        lookUpSchemes_.resize( NumberOfDimensions );
         // Find which type of scheme is used.
         switch( selectedScheme )
         {
@@ -195,87 +240,92 @@ private:
         }
     }
 
-    //! Perform the step in a single dimension of the interpolation process.
+    //! Function to compute the memory offsets of the corners of a grid hyper-rectangle.
     /*!
-     * Function calculates single dimension of the interpolation process. Function calls itself if
-     * final dimension not yet reached. Calling this function with currentVariable = 0 will result
-     * in 2^{NumberOfDimensions} number of calls to the function at currentVariable =
-     * NumberOfDimensions -1. As such, the complete series of calls, starting at currentVariable =
-     * 0, retrieves the dependent variable values at all edges of the grid hyper-rectangle and
-     * properly scales them.
-     * \param currentVariable Dimension in which this interpolation step is to be performed.
-     * \param independentValuesToInterpolate Vector of values of independent variables at which
+     * Function to compute the memory offsets of the dependent variable values at the corners of a grid
+     * hyper-rectangle, with respect to the value at its lower corner, from the strides of dependentData_.
+     * In the index of a corner, the bit for the first independent variable is the most significant one,
+     * and a set bit denotes the upper data point in that dimension.
+     */
+    void computeCornerOffsets( )
+    {
+        for( int i = 0; i < numberOfCorners; i++ )
+        {
+            cornerOffsets_[ i ] = 0;
+            for( int j = 0; j < NumberOfDimensions; j++ )
+            {
+                if( i & ( 1 << ( NumberOfDimensions - 1 - j ) ) )
+                {
+                    cornerOffsets_[ i ] += dependentData_.strides( )[ j ];
+                }
+            }
+        }
+    }
+
+    //! Function to perform interpolation at a single point.
+    /*!
+     * Function to perform interpolation at a single point. The fractions of the lower and upper data
+     * points in each dimension are computed once, after which the dependent variable values at all
+     * corners of the grid hyper-rectangle are interpolated along the last dimension, then along the
+     * second-to-last dimension, etc., until a single value remains.
+     * \param independentValuesToInterpolate Pointer to values of independent variables at which
      *          interpolation is to be performed.
-     * \param currentArrayIndices Array of indices modified at index = currentVariable at each
-     *          call of function. Variable is passed to dependentData in highest step to return
-     *          data for interpolation.
-     * \param nearestLowerIndices Indices in subvectors of independentValues_ vector. That is, the
-     *  n-th entry of nearestLowerIndices represent the nearest lower neighbour in the n-th
-     *  interpolation dimension of the independent variable vectors.
-     * \return Interpolated value in a single dimension
+     * \param nearestLowerIndices Nearest lower indices in all dimensions found during previous call
+     *          (negative if no previous call has been made). Set to the nearest lower indices of
+     *          independentValuesToInterpolate (returned by reference).
+     * \return Interpolated value of dependent variable in all dimensions.
      */
-    DependentVariableType performRecursiveInterpolationStep(
-            const unsigned int currentVariable,
-            const std::vector< IndependentVariableType >& independentValuesToInterpolate,
-            boost::array< int, NumberOfDimensions > currentArrayIndices,
-            const std::vector< int >& nearestLowerIndices )
+    DependentVariableType interpolateAtPoint(
+            const IndependentVariableType* independentValuesToInterpolate,
+            IndexArray& nearestLowerIndices ) const
     {
-        IndependentVariableType upperFraction, lowerFraction;
-        DependentVariableType upperContribution, lowerContribution;
-
-        // Calculate fractions of data points above and below independent
-        // variable value to be added to interpolated value.
-        upperFraction = ( independentValuesToInterpolate[ currentVariable ] -
-                          independentValues_[ currentVariable ]
-                          [ nearestLowerIndices[ currentVariable ] ] ) /
-                ( independentValues_[ currentVariable ]
-                  [ nearestLowerIndices[ currentVariable ] + 1 ] -
-                  independentValues_[ currentVariable ]
-                  [ nearestLowerIndices[ currentVariable ] ] );
-        lowerFraction = -( independentValuesToInterpolate[ currentVariable ] -
-                           independentValues_[ currentVariable ]
-                           [ nearestLowerIndices[ currentVariable ] + 1 ] ) /
-                ( independentValues_[ currentVariable ]
-                  [ nearestLowerIndices[ currentVariable ] + 1 ] -
-                  independentValues_[ currentVariable ]
-                  [ nearestLowerIndices[ currentVariable ] ] );
-
-        // If at top dimension, call dependent variable data.
-        if ( currentVariable == NumberOfDimensions - 1 )
+        // Determine the nearest lower neighbours, and fractions of data points above and below
+        // independent variable value in each dimension.
+        IndependentValueArray upperFractions, lowerFractions;
+        DataIndex lowerCornerOffset = 0;
+        for ( int i = 0; i < NumberOfDimensions; i++ )
         {
-            currentArrayIndices[ NumberOfDimensions - 1 ] = nearestLowerIndices[ currentVariable ];
-            lowerContribution = dependentData_( currentArrayIndices );
-            currentArrayIndices[ NumberOfDimensions - 1 ] = nearestLowerIndices[ currentVariable ]
-                                                            + 1;
-            upperContribution = dependentData_( currentArrayIndices );
+            const int lowerIndex = lookUpSchemes_[ i ]->findNearestLowerNeighbour(
+                        independentValuesToInterpolate[ i ], nearestLowerIndices[ i ] );
+            const std::vector< IndependentVariableType >& currentIndependentValues = independentValues_[ i ];
+            upperFractions[ i ] =
+                    ( independentValuesToInterpolate[ i ] - currentIndependentValues[ lowerIndex ] ) /
+                    ( currentIndependentValues[ lowerIndex + 1 ] - currentIndependentValues[ lowerIndex ] );
+            lowerFractions[ i ] =
+                    -( independentValuesToInterpolate[ i ] - currentIndependentValues[ lowerIndex + 1 ] ) /
+                    ( currentIndependentValues[ lowerIndex + 1 ] - currentIndependentValues[ lowerIndex ] );
+            lowerCornerOffset += lowerIndex * dependentData_.strides( )[ i ];
         }
 
-        // If at lower dimension, update currentArrayIndices and call function with
-        // currentVariable++.
-        else
+        // Retrieve dependent variable values at all corners of grid hyper-rectangle.
+        const DependentVariableType* lowerCornerValue = dependentData_.origin( ) + lowerCornerOffset;
+        boost::array< DependentVariableType, numberOfCorners > cornerValues;
+        for( int i = 0; i < numberOfCorners; i++ )
         {
-            currentArrayIndices[ currentVariable ] = nearestLowerIndices[ currentVariable ];
-            lowerContribution = performRecursiveInterpolationStep(
-                        currentVariable + 1, independentValuesToInterpolate,
-                        currentArrayIndices, nearestLowerIndices );
-            currentArrayIndices[ currentVariable ] = nearestLowerIndices[ currentVariable ] + 1;
-            upperContribution = performRecursiveInterpolationStep(
-                        currentVariable + 1, independentValuesToInterpolate,
-                        currentArrayIndices, nearestLowerIndices );
+            cornerValues[ i ] = lowerCornerValue[ cornerOffsets_[ i ] ];
+        }
+
+        // Interpolate in one dimension at a time, starting at last dimension (least significant bit of
+        // corner index).
+        for( int i = NumberOfDimensions - 1; i >= 0; i-- )
+        {
+            for( int j = 0; j < ( 1 << i ); j++ )
+            {
+                cornerValues[ j ] = upperFractions[ i ] * cornerValues[ 2 * j + 1 ] +
+                        lowerFractions[ i ] * cornerValues[ 2 * j ];
+            }
         }
 
-        // Return interpolated value.
-        DependentVariableType returnValue = upperFraction * upperContribution +
-                                            lowerFraction * lowerContribution;
-        return returnValue;
+        return cornerValues[ 0 ];
     }
 
-    //! Vector with pointers to look-up scheme.
+    //! Array with pointers to look-up scheme.
     /*!
      * Pointers to the look-up schemes that is used to determine in which interval the requested
      * independent variable value falls.
      */
-    std::vector< boost::shared_ptr< LookUpScheme< IndependentVariableType > > > lookUpSchemes_;
+    boost::array< boost::shared_ptr< LookUpScheme< IndependentVariableType > >, NumberOfDimensions >
+    lookUpSchemes_;
 
     //! Vector of vectors containing independent variables.
     /*!
@@ -290,6 +340,16 @@ private:
      * independent variable points.
      */
     boost::multi_array< DependentVariableType, static_cast< size_t >( NumberOfDimensions )> dependentData_;
+
+    //! Memory offsets of the dependent variable values at the corners of a grid hyper-rectangle.
+    /*!
+     * Memory offsets of the dependent variable values at the corners of a grid hyper-rectangle, with
+     * respect to the value at its lower corner (see computeCornerOffsets).
+     */
+    boost::array< DataIndex, numberOfCorners > cornerOffsets_;
+
+    //! Nearest lower indices found during previous call of interpolate function without lookup hints.
+    IndexArray nearestLowerIndices_;
 };
 
 } // namespace interpolators
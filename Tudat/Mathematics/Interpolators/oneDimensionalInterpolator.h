@@ -12,6 +12,7 @@
 #ifndef TUDAT_ONE_DIMENSIONAL_INTERPOLATOR_H
 #define TUDAT_ONE_DIMENSIONAL_INTERPOLATOR_H
 
+#include <stdexcept>
 #include <vector>
 
 #include <boost/shared_ptr.hpp>
@@ -39,6 +40,12 @@ public:
 
     using Interpolator< IndependentVariableType, DependentVariableType >::interpolate;
 
+    //! Constructor.
+    /*!
+     * Constructor, initializes the lookup hint that is used by the interpolate function without hint as input.
+     */
+    OneDimensionalInterpolator( ): nearestLowerIndex_( -1 ) { }
+
     //! Destructor.
     /*!
      * Destructor.
@@ -69,7 +76,9 @@ public:
 
     //! Function to perform interpolation.
     /*!
-     * This function performs the interpolation
+     * This function performs the interpolation. Implementations may store the result of the lookup in the object
+     * (for instance in nearestLowerIndex_), for use in the next call, so that this function may in general not be
+     * called concurrently from multiple threads (see overloaded function).
      * \param independentVariableValue Independent variable value at which the value of the
      *          dependent variable is to be determined.
      * \return Interpolated value of dependent variable.
@@ -77,6 +86,24 @@ public:
     virtual DependentVariableType
             interpolate( const IndependentVariableType independentVariableValue ) = 0;
 
+    //! Function to perform interpolation, using a lookup hint that is owned by the caller.
+    /*!
+     * This function performs the interpolation, using a lookup hint (the nearest lower index of the previous call)
+     * that is stored by the caller. Implementations do not modify the state of the interpolator, so that a single
+     * interpolator can be used concurrently from multiple threads, provided that each thread uses its own hint.
+     * The default implementation throws an exception, as the interpolator does not support caller-owned hints.
+     * \param independentVariableValue Independent variable value at which the value of the
+     *          dependent variable is to be determined.
+     * \param nearestLowerIndex Nearest lower index found during previous call (negative if no previous call
+     * has been made). Set to the nearest lower index of independentVariableValue (returned by reference).
+     * \return Interpolated value of dependent variable.
+     */
+    virtual DependentVariableType
+            interpolate( const IndependentVariableType independentVariableValue, int& nearestLowerIndex ) const
+    {
+        throw std::runtime_error( "Error, interpolation with caller-owned lookup hint not supported by interpolator" );
+    }
+
     //! Function to return the number of independent variables of the interpolation.
     /*!
      *  Function to return the number of independent variables of the interpolation, which is always
@@ -172,6 +199,13 @@ protected:
      * Vector with independent variables.
      */
     std::vector< IndependentVariableType > independentValues_;
+
+    //! Nearest lower index found during previous call to interpolate function without hint as input.
+    /*!
+     * Nearest lower index found during previous call to interpolate function without hint as input (negative if no
+     * call has been made), for use by derived classes.
+     */
+    int nearestLowerIndex_;
 };
 
 } // namespace interpolators
@@ -35,7 +35,7 @@ public:
     using OneDimensionalInterpolator< IndependentVariableType, DependentVariableType >::dependentValues_;
     using OneDimensionalInterpolator< IndependentVariableType, DependentVariableType >::independentValues_;
     using OneDimensionalInterpolator< IndependentVariableType, DependentVariableType >::lookUpScheme_;
-    using Interpolator< IndependentVariableType, DependentVariableType >::interpolate;
+    using OneDimensionalInterpolator< IndependentVariableType, DependentVariableType >::interpolate;
 
     //! Constructor from vectors of independent/dependent data.
     /*!
@@ -107,11 +107,27 @@ public:
 
     //! Function interpolates dependent variable value at given independent variable value.
     /*!
-     * Function interpolates dependent variable value at given independent variable value using piecewise constant algorithm.
+     *  Function interpolates dependent variable value at given independent variable value, using the lookup hint
+     *  stored in this object (may not be called concurrently from multiple threads, see overloaded function).
+     *  \param targetIndependentVariableValue Value of independent variable at which interpolation is to take place.
+     *  \return Interpolated value of dependent variable.
+     */
+    DependentVariableType interpolate( const IndependentVariableType targetIndependentVariableValue )
+    {
+        return interpolate( targetIndependentVariableValue, this->nearestLowerIndex_ );
+    }
+
+    //! Function interpolates dependent variable value at given independent variable value.
+    /*!
+     * Function interpolates dependent variable value at given independent variable value using piecewise constant algorithm,
+     * using a lookup hint that is owned by the caller (may be called concurrently from multiple threads, each with its own hint).
      * \param targetIndependentVariableValue Value of independent variable at which interpolation is to take place.
+     * \param nearestLowerIndex Nearest lower index found during previous call (negative if no previous call has been made).
+     * Set to the nearest lower index of targetIndependentVariableValue, if a lookup is performed (returned by reference).
      * \return Interpolated value of dependent variable.
      */
-    DependentVariableType interpolate( const IndependentVariableType targetIndependentVariableValue )
+    DependentVariableType interpolate( const IndependentVariableType targetIndependentVariableValue,
+                                       int& nearestLowerIndex ) const
     {
         // Determine the lower entry in the table corresponding to the target independent variable value.
         int lowerEntry;
@@ -125,7 +141,7 @@ public:
         }
         else
         {
-            lowerEntry = lookUpScheme_->findNearestLowerNeighbour( targetIndependentVariableValue );
+            lowerEntry = lookUpScheme_->findNearestLowerNeighbour( targetIndependentVariableValue, nearestLowerIndex );
         }
 
         // Return interpolated value
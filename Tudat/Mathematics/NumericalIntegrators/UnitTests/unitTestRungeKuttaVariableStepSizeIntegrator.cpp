@@ -37,6 +37,7 @@
 #include <limits>
 #include <string>
 #include <typeinfo>
+#include <vector>
 
 namespace tudat
 {
@@ -313,6 +314,92 @@ BOOST_AUTO_TEST_CASE( testVariableStepIntegrateToFunction )
     BOOST_CHECK_CLOSE_FRACTION( fixedStepIntegratedValue.x( ), integratedValue.x( ), 1.0E-10 );
 }
 
+//! Compute van der Pol state derivative, writing the result into an existing vector.
+void computeVanDerPolStateDerivativeInPlace( const double time, const Eigen::VectorXd& state,
+                                             Eigen::VectorXd& stateDerivative )
+{
+    stateDerivative = numerical_integrator_test_functions::computeVanDerPolStateDerivative( time, state );
+}
+
+//! Test if integration with in-place state derivative function and preallocated stage buffers
+//! gives results identical to integration with state derivative function returning by value,
+//! and to a direct evaluation using all (including zero) entries of the Butcher tableau.
+BOOST_AUTO_TEST_CASE( testInPlaceStateDerivativeEvaluation )
+{
+    using namespace numerical_integrators;
+    using namespace unit_tests::numerical_integrator_test_functions;
+
+    std::vector< RungeKuttaCoefficients::CoefficientSets > coefficientSets;
+    coefficientSets.push_back( RungeKuttaCoefficients::rungeKuttaFehlberg45 );
+    coefficientSets.push_back( RungeKuttaCoefficients::rungeKuttaFehlberg56 );
+    coefficientSets.push_back( RungeKuttaCoefficients::rungeKuttaFehlberg78 );
+    coefficientSets.push_back( RungeKuttaCoefficients::rungeKutta87DormandPrince );
+
+    for ( unsigned int i = 0; i < coefficientSets.size( ); i++ )
+    {
+        const RungeKuttaCoefficients coefficients = RungeKuttaCoefficients::get( coefficientSets.at( i ) );
+
+        // Create integrators with state derivative function returning by value and in place.
+        RungeKuttaVariableStepSizeIntegratorXd byValueIntegrator(
+                    coefficients, &computeVanDerPolStateDerivative, 0.0,
+                    ( Eigen::VectorXd( 2 ) << 1.0, 2.0 ).finished( ), 0.0, 10.0, 1.0E-10, 1.0E-10 );
+        RungeKuttaVariableStepSizeIntegratorXd inPlaceIntegrator(
+                    coefficients, &computeVanDerPolStateDerivative, 0.0,
+                    ( Eigen::VectorXd( 2 ) << 1.0, 2.0 ).finished( ), 0.0, 10.0, 1.0E-10, 1.0E-10 );
+        inPlaceIntegrator.setInPlaceStateDerivativeFunction( &computeVanDerPolStateDerivativeInPlace );
+
+        for ( unsigned int step = 0; step < 50; step++ )
+        {
+            const double previousTime = byValueIntegrator.getCurrentIndependentVariable( );
+            const Eigen::VectorXd previousState = byValueIntegrator.getCurrentState( );
+
+            // Perform integration step (including rejected steps) with both integrators.
+            byValueIntegrator.performIntegrationStep(
+                        ( step == 0 ) ? 1.0 : byValueIntegrator.getNextStepSize( ) );
+            inPlaceIntegrator.performIntegrationStep(
+                        ( step == 0 ) ? 1.0 : inPlaceIntegrator.getNextStepSize( ) );
+
+            // Check that results are identical.
+            BOOST_CHECK_EQUAL( byValueIntegrator.getCurrentIndependentVariable( ),
+                               inPlaceIntegrator.getCurrentIndependentVariable( ) );
+            BOOST_CHECK( byValueIntegrator.getCurrentState( ) == inPlaceIntegrator.getCurrentState( ) );
+            BOOST_CHECK_EQUAL( byValueIntegrator.getNextStepSize( ), inPlaceIntegrator.getNextStepSize( ) );
+
+            // Compute accepted step directly, using all entries of the Butcher tableau.
+            const double stepSize = byValueIntegrator.getCurrentIndependentVariable( ) - previousTime;
+            std::vector< Eigen::VectorXd > directStateDerivatives;
+            Eigen::VectorXd lowerOrderEstimate = previousState, higherOrderEstimate = previousState;
+            for ( int stage = 0; stage < coefficients.cCoefficients.rows( ); stage++ )
+            {
+                Eigen::VectorXd intermediateState( previousState );
+                for ( int column = 0; column < stage; column++ )
+                {
+                    intermediateState += stepSize * coefficients.aCoefficients( stage, column )
+                            * directStateDerivatives[ column ];
+                }
+                directStateDerivatives.push_back(
+                            computeVanDerPolStateDerivative(
+                                previousTime + coefficients.cCoefficients( stage ) * stepSize,
+                                intermediateState ) );
+                lowerOrderEstimate += coefficients.bCoefficients( 0, stage ) * stepSize *
+                        directStateDerivatives[ stage ];
+                higherOrderEstimate += coefficients.bCoefficients( 1, stage ) * stepSize *
+                        directStateDerivatives[ stage ];
+            }
+
+            // Check if direct result matches result from integrator.
+            TUDAT_CHECK_MATRIX_CLOSE_FRACTION(
+                        ( ( coefficients.orderEstimateToIntegrate == RungeKuttaCoefficients::lower ) ?
+                              lowerOrderEstimate : higherOrderEstimate ),
+                        byValueIntegrator.getCurrentState( ), 1.0E-15 );
+        }
+
+        // Check that stage buffers are retained.
+        BOOST_CHECK_EQUAL( inPlaceIntegrator.getCurrentStateDerivatives( ).size( ),
+                           static_cast< unsigned int >( coefficients.cCoefficients.rows( ) ) );
+    }
+}
+
 BOOST_AUTO_TEST_SUITE_END( )
 
 } // namespace unit_tests
@@ -204,6 +204,9 @@ public:
  *  \param stateDerivativeFunction Function returning the state derivative from current time and state.
  *  \param initialState Initial state for numerical integration
  *  \param integratorSettings Settings for numerical integrator.
+ *  \param inPlaceStateDerivativeFunction Function computing the same state derivative as stateDerivativeFunction, but
+ *  writing it into an existing object (none by default). If provided, it is used by integrators that support it
+ *  (currently RungeKuttaVariableStepSizeIntegrator) to avoid returning the state derivatives by value.
  *  \return Numerical integrator object
  */
 template< typename IndependentVariableType, typename DependentVariableType, typename TimeStepType = IndependentVariableType >
@@ -212,7 +215,10 @@ DependentVariableType, TimeStepType > > createIntegrator(
         boost::function< DependentVariableType(
             const IndependentVariableType, const DependentVariableType& ) > stateDerivativeFunction,
         const DependentVariableType initialState,
-        boost::shared_ptr< IntegratorSettings< IndependentVariableType > > integratorSettings )
+        boost::shared_ptr< IntegratorSettings< IndependentVariableType > > integratorSettings,
+        const boost::function< void( const IndependentVariableType, const DependentVariableType&,
+                                     DependentVariableType& ) > inPlaceStateDerivativeFunction =
+        boost::function< void( const IndependentVariableType, const DependentVariableType&, DependentVariableType& ) >( ) )
 
 {    
     boost::shared_ptr< NumericalIntegrator
@@ -249,7 +255,9 @@ DependentVariableType, TimeStepType > > createIntegrator(
             // Get requested RK coefficients and create integrator.
             RungeKuttaCoefficients coefficients =  RungeKuttaCoefficients::get(
                         variableStepIntegratorSettings->coefficientSet_ );
-            integrator = boost::make_shared<
+            boost::shared_ptr< RungeKuttaVariableStepSizeIntegrator
+                    < IndependentVariableType, DependentVariableType, DependentVariableType, TimeStepType > >
+                    variableStepIntegrator = boost::make_shared<
                     RungeKuttaVariableStepSizeIntegrator
                     < IndependentVariableType, DependentVariableType, DependentVariableType, TimeStepType > >
                     ( coefficients,
@@ -261,6 +269,8 @@ DependentVariableType, TimeStepType > > createIntegrator(
                       static_cast< TimeStepType >( variableStepIntegratorSettings->safetyFactorForNextStepSize_ ),
                       static_cast< TimeStepType >( variableStepIntegratorSettings->maximumFactorIncreaseForNextStepSize_ ),
                       static_cast< TimeStepType >( variableStepIntegratorSettings->minimumFactorDecreaseForNextStepSize_ ) );
+            variableStepIntegrator->setInPlaceStateDerivativeFunction( inPlaceStateDerivativeFunction );
+            integrator = variableStepIntegrator;
         }
         break;
     }
@@ -79,6 +79,14 @@ public:
     typedef typename ReinitializableNumericalIntegratorBase::NumericalIntegratorBase::
     StateDerivativeFunction StateDerivativeFunction;
 
+    //! Typedef to the in-place state derivative function.
+    /*!
+     * Typedef to a state derivative function that writes the state derivative into an existing object, instead of
+     * returning it by value. This should be a pointer to a function or a boost function.
+     */
+    typedef boost::function< void(
+            const IndependentVariableType, const StateType&, StateDerivativeType& ) > InPlaceStateDerivativeFunction;
+
     //! Exception that is thrown if the minimum step size is exceeded.
     /*!
      * Exception thrown by RungeKuttaVariableStepSizeIntegrator< >::
@@ -144,6 +152,8 @@ public:
                         &RungeKuttaVariableStepSizeIntegrator::computeNewStepSize,
                         this, _1, _2, _3, _4, _5, _6, _7, _8 );
         }
+
+        allocateStageBuffers( );
     }
 
     //! Default constructor.
@@ -206,6 +216,8 @@ public:
                         &RungeKuttaVariableStepSizeIntegrator::computeNewStepSize,
                         this, _1, _2, _3, _4, _5, _6, _7, _8 );
         }
+
+        allocateStageBuffers( );
     }
 
     //! Get step size of the next step.
@@ -243,6 +255,20 @@ public:
         return currentStateDerivatives_;
     }
 
+    //! Set in-place state derivative function.
+    /*!
+     * Sets a function that computes the state derivative into an existing object. If set, this function is used
+     * instead of the state derivative function passed to the constructor to evaluate the stages of the Runge-Kutta
+     * scheme, so that the state derivatives are written directly into the preallocated stage buffers. The function
+     * passed here must compute the same state derivative as the function passed to the constructor. An empty
+     * function resets the integrator to use the function passed to the constructor.
+     * \param inPlaceStateDerivativeFunction In-place state derivative function.
+     */
+    void setInPlaceStateDerivativeFunction( const InPlaceStateDerivativeFunction& inPlaceStateDerivativeFunction )
+    {
+        inPlaceStateDerivativeFunction_ = inPlaceStateDerivativeFunction;
+    }
+
     //! Perform a single integration step.
     /*!
      * Perform a single integration step and compute a new step size.
@@ -290,6 +316,21 @@ public:
 
 protected:
 
+    //! Allocate buffers used during integration step.
+    /*!
+     * Allocates the buffers for the state derivatives per stage, the intermediate state and the lower and higher order
+     * estimates, so that no (re)allocation is needed when performing integration steps.
+     */
+    void allocateStageBuffers( )
+    {
+        currentStateDerivatives_.resize(
+                    this->coefficients_.cCoefficients.rows( ),
+                    StateDerivativeType::Zero( this->currentState_.rows( ), this->currentState_.cols( ) ) );
+        intermediateState_ = this->currentState_;
+        lowerOrderEstimate_ = this->currentState_;
+        higherOrderEstimate_ = this->currentState_;
+    }
+
     //! Computes the next step size and validates the result.
     /*!
      * Computes the next step size based on a higher and lower order estimate, determines if the
@@ -419,11 +460,28 @@ protected:
      */
     NewStepSizeFunction newStepSizeFunction_;
 
+    //! Function that computes the state derivative into an existing object (empty if not used).
+    /*!
+     * Function that computes the state derivative into an existing object, as set by
+     * setInPlaceStateDerivativeFunction. If empty, stateDerivativeFunction_ is used to evaluate the stages.
+     */
+    InPlaceStateDerivativeFunction inPlaceStateDerivativeFunction_;
+
     //! Vector of state derivatives.
     /*!
-     * Vector of state derivatives, i.e. values of k_{i} in Runge-Kutta scheme.
+     * Vector of state derivatives, i.e. values of k_{i} in Runge-Kutta scheme. The size of the vector is set to the
+     * number of stages upon construction, and the entries are overwritten by each integration step.
      */
     std::vector< StateDerivativeType > currentStateDerivatives_;
+
+    //! Intermediate state at which the state derivative of the current stage is evaluated (buffer).
+    StateType intermediateState_;
+
+    //! Lower order estimate of the state at the end of the current step (buffer).
+    StateType lowerOrderEstimate_;
+
+    //! Higher order estimate of the state at the end of the current step (buffer).
+    StateType higherOrderEstimate_;
 };
 
 //! Perform a single integration step.
@@ -432,31 +490,36 @@ StateType
 RungeKuttaVariableStepSizeIntegrator< IndependentVariableType, StateType, StateDerivativeType, TimeStepType >
 ::performIntegrationStep( const TimeStepType stepSize )
 {
-    // Define and allocated vector for the number of stages.
-    currentStateDerivatives_.clear( );
-    currentStateDerivatives_.reserve( this->coefficients_.cCoefficients.rows( ) );
-
-    // Define lower and higher order estimates.
-    StateType lowerOrderEstimate( this->currentState_ ),
-              higherOrderEstimate( this->currentState_ );
+    // Initialize lower and higher order estimates (buffers allocated upon construction).
+    lowerOrderEstimate_ = this->currentState_;
+    higherOrderEstimate_ = this->currentState_;
 
     // Compute the k_i state derivatives per stage.
     for ( int stage = 0; stage < this->coefficients_.cCoefficients.rows( ); stage++ )
     {
-        // Compute the intermediate state to pass to the state derivative for this stage.
-        StateType intermediateState( this->currentState_ );
-
-        // Compute the intermediate state.
+        // Compute the intermediate state to pass to the state derivative for this stage, skipping
+        // zero entries of the Butcher tableau.
+        intermediateState_ = this->currentState_;
         for ( int column = 0; column < stage; column++ )
         {
-            intermediateState += stepSize * this->coefficients_.aCoefficients( stage, column )
-                    * currentStateDerivatives_[ column ];
+            if ( this->coefficients_.aCoefficients( stage, column ) != 0.0 )
+            {
+                intermediateState_ += stepSize * this->coefficients_.aCoefficients( stage, column )
+                        * currentStateDerivatives_[ column ];
+            }
         }
 
-        // Compute the state derivative.
+        // Compute the state derivative, directly in the stage buffer if possible.
         const IndependentVariableType time = this->currentIndependentVariable_ +
                 this->coefficients_.cCoefficients( stage ) * stepSize;
-        currentStateDerivatives_.push_back( this->stateDerivativeFunction_( time, intermediateState ) );
+        if ( inPlaceStateDerivativeFunction_ )
+        {
+            inPlaceStateDerivativeFunction_( time, intermediateState_, currentStateDerivatives_[ stage ] );
+        }
+        else
+        {
+            currentStateDerivatives_[ stage ] = this->stateDerivativeFunction_( time, intermediateState_ );
+        }
 
         // Check if propagation should terminate because the propagation termination condition has been reached
         // while computing the intermediate state.
@@ -467,16 +530,22 @@ RungeKuttaVariableStepSizeIntegrator< IndependentVariableType, StateType, StateD
             return this->currentState_;
         }
 
-        // Update the estimate.
-        lowerOrderEstimate += this->coefficients_.bCoefficients( 0, stage ) * stepSize *
-                currentStateDerivatives_[ stage ];
-        higherOrderEstimate += this->coefficients_.bCoefficients( 1, stage ) * stepSize *
-                currentStateDerivatives_[ stage ];
+        // Update the estimates, skipping zero entries of the Butcher tableau.
+        if ( this->coefficients_.bCoefficients( 0, stage ) != 0.0 )
+        {
+            lowerOrderEstimate_ += this->coefficients_.bCoefficients( 0, stage ) * stepSize *
+                    currentStateDerivatives_[ stage ];
+        }
+        if ( this->coefficients_.bCoefficients( 1, stage ) != 0.0 )
+        {
+            higherOrderEstimate_ += this->coefficients_.bCoefficients( 1, stage ) * stepSize *
+                    currentStateDerivatives_[ stage ];
+        }
     }
 
     // Determine if the error was within bounds and compute a new step size.
-    if ( computeNextStepSizeAndValidateResult( lowerOrderEstimate,
-                                               higherOrderEstimate, stepSize ) )
+    if ( computeNextStepSizeAndValidateResult( lowerOrderEstimate_,
+                                               higherOrderEstimate_, stepSize ) )
     {
         // Accept the current step.
         this->lastIndependentVariable_ = this->currentIndependentVariable_;
@@ -486,11 +555,11 @@ RungeKuttaVariableStepSizeIntegrator< IndependentVariableType, StateType, StateD
         switch ( this->coefficients_.orderEstimateToIntegrate )
         {
         case RungeKuttaCoefficients::lower:
-            this->currentState_ = lowerOrderEstimate;
+            this->currentState_ = lowerOrderEstimate_;
             return this->currentState_;
 
         case RungeKuttaCoefficients::higher:
-            this->currentState_ = higherOrderEstimate;
+            this->currentState_ = higherOrderEstimate_;
             return this->currentState_;
 
         default: // The default case will never occur because OrderEstimateToIntegrate is an enum.
@@ -577,25 +646,15 @@ RungeKuttaVariableStepSizeIntegrator< IndependentVariableType, StateType, StateD
 {
     TUDAT_UNUSED_PARAMETER( lowerOrder);
 
-    // Compute the truncation error based on the higher and lower order estimates.
-    const StateType truncationError_ =
-            ( higherOrderEstimate - lowerOrderEstimate ).array( ).abs( );
-
-    // Compute error tolerance based on relative and absolute error tolerances.
-    const StateType errorTolerance_ =
-            ( higherOrderEstimate.array( ).abs( ) *
-              relativeErrorTolerance.array( ) ).matrix( )
-            + absoluteErrorTolerance;
-
-    // Compute relative truncation error. This will indicate if the current step satisfies the
-    // required tolerances.
-    const StateType relativeTruncationError_ = truncationError_.array( ) /
-            errorTolerance_.array( );
-
     // Compute the maximum error based on the largest coefficient in the relative truncation error
-    // matrix.
-    const typename StateType::Scalar maximumErrorInState_
-            = relativeTruncationError_.array( ).abs( ).maxCoeff( );
+    // matrix, which is the truncation error (difference between the higher and lower order
+    // estimates) divided by the error tolerance (based on relative and absolute error
+    // tolerances). This will indicate if the current step satisfies the required tolerances.
+    // The expression is evaluated without creating temporary matrices.
+    const typename StateType::Scalar maximumErrorInState_ =
+            ( ( higherOrderEstimate - lowerOrderEstimate ).array( ).abs( ) /
+              ( higherOrderEstimate.array( ).abs( ) * relativeErrorTolerance.array( ) +
+                absoluteErrorTolerance.array( ) ) ).maxCoeff( );
 
     // Compute the new step size. This is based off of the equation given in
     // (Montenbruck and Gill, 2005).
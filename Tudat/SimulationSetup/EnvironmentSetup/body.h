@@ -24,8 +24,10 @@
 #include "Tudat/Astrodynamics/BasicAstrodynamics/timeConversions.h"
 #include "Tudat/Astrodynamics/BasicAstrodynamics/accelerationModel.h"
 #include "Tudat/Astrodynamics/BasicAstrodynamics/bodyShapeModel.h"
+#include "Tudat/Astrodynamics/Ephemerides/constantEphemeris.h"
 #include "Tudat/Astrodynamics/Ephemerides/ephemeris.h"
 #include "Tudat/Astrodynamics/Ephemerides/rotationalEphemeris.h"
+#include "Tudat/Astrodynamics/Ephemerides/tabulatedEphemeris.h"
 #include "Tudat/Astrodynamics/Gravitation/gravityFieldModel.h"
 #include "Tudat/Astrodynamics/Gravitation/gravityFieldVariations.h"
 #include "Tudat/Astrodynamics/Gravitation/timeDependentSphericalHarmonicsGravityField.h"
@@ -42,6 +44,8 @@ namespace tudat
 namespace simulation_setup
 {
 
+class Body;
+
 //! Base class used for the determination of the inertial state of a Body's ephemeris origin
 /*!
  *  Base class used for the determination of the inertial state of a Body's ephemeris origin. This base class is used
@@ -56,14 +60,39 @@ public:
     /*!
      * Constructor
      * \param baseFrameId Name of frame origin for which inertial state is computed by this class
+     * \param frameOriginBody Body object of the frame origin, if the inertial state is the state of this body computed
+     * from its ephemeris (as Body::getStateInBaseFrameFromEphemeris), NULL otherwise.
      */
     BaseStateInterface(
-            const std::string baseFrameId ):
-        baseFrameId_( baseFrameId ){ }
+            const std::string baseFrameId,
+            const boost::shared_ptr< Body > frameOriginBody = boost::shared_ptr< Body >( ) ):
+        baseFrameId_( baseFrameId ), frameOriginBody_( frameOriginBody ){ }
 
     //! Destructor
     virtual ~BaseStateInterface( ){ }
 
+    //! Function to retrieve the name of frame origin for which inertial state is computed by this class
+    /*!
+     *  Function to retrieve the name of frame origin for which inertial state is computed by this class
+     *  \return Name of frame origin for which inertial state is computed by this class (empty if the ephemeris origin
+     *  of the body is the global frame origin).
+     */
+    std::string getBaseFrameId( ) const
+    {
+        return baseFrameId_;
+    }
+
+    //! Function to retrieve the body object of the frame origin
+    /*!
+     *  Function to retrieve the body object of the frame origin
+     *  \return Body object of the frame origin, if the inertial state is the state of this body computed from its
+     *  ephemeris (as Body::getStateInBaseFrameFromEphemeris), NULL otherwise.
+     */
+    boost::shared_ptr< Body > getFrameOriginBody( ) const
+    {
+        return frameOriginBody_;
+    }
+
     //! Function through which the state of baseFrameId_ in the inertial frame can be determined
     /*!
      *  Function through which the state of baseFrameId_ in the inertial frame can be determined
@@ -114,6 +143,9 @@ protected:
 
     //! Name of frame origin for which inertial state is computed by this class
     std::string baseFrameId_;
+
+    //! Body object of the frame origin, if the inertial state is the state of this body computed from its ephemeris.
+    boost::shared_ptr< Body > frameOriginBody_;
 };
 
 //! Class used for the determination of the inertial state of a Body's ephemeris origin
@@ -129,12 +161,15 @@ public:
      * \param stateFunction Function returning frame's inertial state as a function of time.
      * \param subtractStateFunction Boolean denoting whether to subtract or add the state function (i.e. whether to multiply
      * result of stateFunction by -1).
+     * \param frameOriginBody Body object of the frame origin, if stateFunction is the state of this body computed from its
+     * ephemeris (as Body::getStateInBaseFrameFromEphemeris), NULL otherwise.
      */
     BaseStateInterfaceImplementation(
             const std::string baseFrameId,
             const boost::function< Eigen::Matrix< StateScalarType, 6, 1 >( const TimeType ) > stateFunction,
-            const bool subtractStateFunction = 0 ):
-        BaseStateInterface( baseFrameId ),
+            const bool subtractStateFunction = 0,
+            const boost::shared_ptr< Body > frameOriginBody = boost::shared_ptr< Body >( ) ):
+        BaseStateInterface( baseFrameId, frameOriginBody ),
         stateFunction_( stateFunction ), stateMultiplier_( ( subtractStateFunction == 0 ) ? 1.0 : -1.0 )
     { }
 
@@ -1229,6 +1264,190 @@ private:
 //! Typdef for a list of body objects (as unordered_map for efficiency reasons)
 typedef std::unordered_map< std::string, boost::shared_ptr< Body > > NamedBodyMap;
 
+//! Class to compute the state of a body from its ephemeris, with an interpolator lookup hint owned by this object
+/*!
+ *  Class to compute the state of a body from its ephemeris and global-to-ephemeris-frame function (as
+ *  Body::getStateInBaseFrameFromEphemeris), without modifying the current state stored in the Body object. If the
+ *  ephemeris of the body is a TabulatedCartesianEphemeris (with the same state scalar and time types), the interpolator
+ *  is evaluated with a lookup hint that is stored in this object. If the ephemeris origin of the body is another body
+ *  (see BaseStateInterface::getFrameOriginBody), the state of the origin is computed by a BodyEphemerisStateEvaluator
+ *  owned by this object, instead of by Body::getStateInBaseFrameFromEphemeris (which modifies the origin Body object).
+ *  Separate objects for the same body may therefore be used concurrently from multiple threads (one object per thread),
+ *  provided that the ephemerides that are not tabulated and the remaining frame origin states may be evaluated
+ *  concurrently (see isBodyEphemerisStateEvaluationThreadSafe).
+ */
+template< typename StateScalarType = double, typename TimeType = double >
+class BodyEphemerisStateEvaluator
+{
+public:
+
+    //! Constructor
+    /*!
+     * Constructor. The ephemeris and frame origin state of the body are retrieved at the first call to
+     * getStateInBaseFrame, so that the object may be created before the environment is fully set up.
+     * \param body Body for which the state is to be computed.
+     */
+    BodyEphemerisStateEvaluator( const boost::shared_ptr< Body > body ):
+        body_( body ), isEphemerisRetrieved_( false ), nearestLowerIndex_( -1 )
+    { }
+
+    //! Function to compute the state of the body in the global frame
+    /*!
+     * Function to compute the state of the body in the global frame.
+     * \param time Time at which state is to be computed.
+     * \return State of the body in the global frame
+     */
+    Eigen::Matrix< StateScalarType, 6, 1 > getStateInBaseFrame( const TimeType time )
+    {
+        if( body_->getIsBodyGlobalFrameOrigin( ) == 1 )
+        {
+            return Eigen::Matrix< StateScalarType, 6, 1 >::Zero( );
+        }
+        else if( body_->getIsBodyGlobalFrameOrigin( ) != 0 )
+        {
+            throw std::runtime_error( "Error when setting body state, global origin not yet defined." );
+        }
+
+        if( !isEphemerisRetrieved_ )
+        {
+            retrieveEphemeris( );
+        }
+
+        if( tabulatedEphemeris_ != NULL )
+        {
+            return tabulatedEphemeris_->getTabulatedState( time, nearestLowerIndex_ ) + getFrameOriginState( time );
+        }
+        else
+        {
+            return bodyEphemeris_->getTemplatedStateFromEphemeris< StateScalarType, TimeType >( time ) +
+                    getFrameOriginState( time );
+        }
+    }
+
+private:
+
+    //! Function to retrieve the ephemeris and frame origin state of the body.
+    void retrieveEphemeris( )
+    {
+        bodyEphemeris_ = body_->getEphemeris( );
+        if( bodyEphemeris_ == NULL )
+        {
+            throw std::runtime_error( "Error when computing body state from ephemeris, body has no ephemeris" );
+        }
+
+        tabulatedEphemeris_ = boost::dynamic_pointer_cast<
+                ephemerides::TabulatedCartesianEphemeris< StateScalarType, TimeType > >( bodyEphemeris_ );
+        ephemerisFrameToBaseFrame_ = body_->getEphemerisFrameToBaseFrame( );
+        if( ephemerisFrameToBaseFrame_->getFrameOriginBody( ) != NULL )
+        {
+            frameOriginStateEvaluator_ = boost::make_shared< BodyEphemerisStateEvaluator< StateScalarType, TimeType > >(
+                        ephemerisFrameToBaseFrame_->getFrameOriginBody( ) );
+        }
+        isEphemerisRetrieved_ = true;
+    }
+
+    //! Function to compute the state of the ephemeris origin of the body w.r.t. the global origin
+    /*!
+     * Function to compute the state of the ephemeris origin of the body w.r.t. the global origin
+     * \param time Time at which state is to be computed.
+     * \return State of the ephemeris origin of the body w.r.t. the global origin
+     */
+    Eigen::Matrix< StateScalarType, 6, 1 > getFrameOriginState( const TimeType time )
+    {
+        if( frameOriginStateEvaluator_ != NULL )
+        {
+            return frameOriginStateEvaluator_->getStateInBaseFrame( time );
+        }
+        else
+        {
+            return ephemerisFrameToBaseFrame_->getBaseFrameState< TimeType, StateScalarType >( time );
+        }
+    }
+
+    //! Body for which the state is to be computed.
+    boost::shared_ptr< Body > body_;
+
+    //! Boolean denoting whether bodyEphemeris_, tabulatedEphemeris_ and ephemerisFrameToBaseFrame_ have been retrieved.
+    bool isEphemerisRetrieved_;
+
+    //! Ephemeris of body_
+    boost::shared_ptr< ephemerides::Ephemeris > bodyEphemeris_;
+
+    //! Ephemeris of body_, cast to tabulated ephemeris (NULL if not tabulated).
+    boost::shared_ptr< ephemerides::TabulatedCartesianEphemeris< StateScalarType, TimeType > > tabulatedEphemeris_;
+
+    //! Class returning the state of the ephemeris origin of body_ w.r.t. the global origin
+    boost::shared_ptr< BaseStateInterface > ephemerisFrameToBaseFrame_;
+
+    //! Object computing the state of the ephemeris origin of body_, if this origin is another body (NULL otherwise).
+    boost::shared_ptr< BodyEphemerisStateEvaluator< StateScalarType, TimeType > > frameOriginStateEvaluator_;
+
+    //! Nearest lower index in the interpolator of tabulatedEphemeris_ found during the previous call.
+    int nearestLowerIndex_;
+};
+
+//! Function to check whether BodyEphemerisStateEvaluator objects for a body may be used concurrently
+/*!
+ *  Function to check whether separate BodyEphemerisStateEvaluator objects for a body may be used concurrently from
+ *  multiple threads. This is the case if the body is the global frame origin, or if its ephemeris is either a
+ *  TabulatedCartesianEphemeris with the given state scalar and time types (evaluated with the lookup hint of the
+ *  evaluator) or a ConstantEphemeris, and its ephemeris origin is either the global frame origin or a body for which
+ *  this function returns true. In all other cases, the ephemeris or the frame origin state modify data that is shared
+ *  between the evaluators.
+ *  \param body Body for which the check is to be performed.
+ *  \return True if separate BodyEphemerisStateEvaluator objects for the body may be used concurrently.
+ */
+template< typename StateScalarType = double, typename TimeType = double >
+bool isBodyEphemerisStateEvaluationThreadSafe( const boost::shared_ptr< Body > body )
+{
+    if( body->getIsBodyGlobalFrameOrigin( ) == 1 )
+    {
+        return true;
+    }
+
+    // Check ephemeris of body
+    boost::shared_ptr< ephemerides::Ephemeris > bodyEphemeris = body->getEphemeris( );
+    if( bodyEphemeris == NULL ||
+            ( boost::dynamic_pointer_cast< ephemerides::TabulatedCartesianEphemeris< StateScalarType, TimeType > >(
+                  bodyEphemeris ) == NULL &&
+              boost::dynamic_pointer_cast< ephemerides::ConstantEphemeris >( bodyEphemeris ) == NULL ) )
+    {
+        return false;
+    }
+
+    // Check ephemeris origin of body
+    boost::shared_ptr< BaseStateInterface > ephemerisFrameToBaseFrame = body->getEphemerisFrameToBaseFrame( );
+    if( ephemerisFrameToBaseFrame->getBaseFrameId( ) == "" )
+    {
+        return true;
+    }
+    else if( ephemerisFrameToBaseFrame->getFrameOriginBody( ) != NULL )
+    {
+        return isBodyEphemerisStateEvaluationThreadSafe< StateScalarType, TimeType >(
+                    ephemerisFrameToBaseFrame->getFrameOriginBody( ) );
+    }
+    else
+    {
+        return false;
+    }
+}
+
+//! Function to create a function that computes the state of a body from its ephemeris, with its own lookup hint
+/*!
+ *  Function to create a function that computes the state of a body from its ephemeris, with its own interpolator
+ *  lookup hint, using a new BodyEphemerisStateEvaluator object. Functions created by separate calls to this function may
+ *  be used concurrently from multiple threads (see BodyEphemerisStateEvaluator).
+ *  \param body Body for which the state function is to be created.
+ *  \return Function returning the state of the body in the global frame.
+ */
+template< typename StateScalarType = double, typename TimeType = double >
+boost::function< Eigen::Matrix< StateScalarType, 6, 1 >( const TimeType ) > createBodyEphemerisStateFunction(
+        const boost::shared_ptr< Body > body )
+{
+    return boost::bind( &BodyEphemerisStateEvaluator< StateScalarType, TimeType >::getStateInBaseFrame,
+                        boost::make_shared< BodyEphemerisStateEvaluator< StateScalarType, TimeType > >( body ), _1 );
+}
+
 //! Function ot retrieve the common global translational state origin of the environment
 /*!
  * Function ot retrieve the common global translational state origin of the environment. This function throws an exception
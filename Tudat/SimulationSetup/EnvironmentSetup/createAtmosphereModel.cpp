@@ -12,6 +12,7 @@
 #include <boost/bind.hpp>
 
 #include "Tudat/Astrodynamics/Aerodynamics/exponentialAtmosphere.h"
+#include "Tudat/Astrodynamics/Aerodynamics/griddedAtmosphere.h"
 #include "Tudat/Astrodynamics/Aerodynamics/tabulatedAtmosphere.h"
 #if USE_NRLMSISE00
 #include "Tudat/Astrodynamics/Aerodynamics/nrlmsise00Atmosphere.h"
@@ -135,10 +136,49 @@ boost::shared_ptr< aerodynamics::AtmosphereModel > createAtmosphereModel(
         // Create atmosphere model using NRLMISE00 input function
         boost::function< tudat::aerodynamics::NRLMSISE00Input (double,double,double,double) > inputFunction =
                 boost::bind(&tudat::aerodynamics::nrlmsiseInputFunction,_1,_2,_3,_4, solarActivityData , false , TUDAT_NAN );
-        atmosphereModel = boost::make_shared< aerodynamics::NRLMSISE00Atmosphere >( inputFunction );
+        boost::shared_ptr< aerodynamics::NRLMSISE00Atmosphere > nrlmsise00Atmosphere =
+                boost::make_shared< aerodynamics::NRLMSISE00Atmosphere >( inputFunction );
+        if( nrlmsise00AtmosphereSettings != NULL )
+        {
+            nrlmsise00Atmosphere->setCacheSettings(
+                        nrlmsise00AtmosphereSettings->getMaximumNumberOfCacheEntries( ),
+                        nrlmsise00AtmosphereSettings->getAltitudeResolution( ),
+                        nrlmsise00AtmosphereSettings->getAngleResolution( ),
+                        nrlmsise00AtmosphereSettings->getTimeResolution( ) );
+        }
+        atmosphereModel = nrlmsise00Atmosphere;
         break;
     }
 #endif
+    case gridded_atmosphere:
+    {
+        // Check whether settings for atmosphere are consistent with its type
+        boost::shared_ptr< GriddedAtmosphereSettings > griddedAtmosphereSettings =
+                boost::dynamic_pointer_cast< GriddedAtmosphereSettings >( atmosphereSettings );
+        if( griddedAtmosphereSettings == NULL )
+        {
+            throw std::runtime_error(
+                        "Error, expected gridded atmosphere settings for body " + body );
+        }
+        else
+        {
+            // Create grid by sampling atmosphere model, created once for each thread.
+            atmosphereModel = boost::make_shared< GriddedAtmosphere >(
+                        boost::bind( &createAtmosphereModel,
+                                     griddedAtmosphereSettings->getSampledAtmosphereSettings( ), body ),
+                        griddedAtmosphereSettings->getMinimumAltitude( ),
+                        griddedAtmosphereSettings->getMaximumAltitude( ),
+                        griddedAtmosphereSettings->getNumberOfAltitudes( ),
+                        griddedAtmosphereSettings->getNumberOfLatitudes( ),
+                        griddedAtmosphereSettings->getNumberOfLocalSolarTimes( ),
+                        griddedAtmosphereSettings->getStartEpoch( ),
+                        griddedAtmosphereSettings->getEndEpoch( ),
+                        griddedAtmosphereSettings->getNumberOfEpochs( ),
+                        griddedAtmosphereSettings->getInterpolateLogarithms( ),
+                        griddedAtmosphereSettings->getNumberOfThreads( ) );
+        }
+        break;
+    }
     default:
         throw std::runtime_error(
                     "Error, did not recognize atmosphere model settings type " +
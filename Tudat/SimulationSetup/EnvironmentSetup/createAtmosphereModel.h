@@ -15,6 +15,7 @@
 
 #include <boost/shared_ptr.hpp>
 
+#include "Tudat/Basics/utilityMacros.h"
 #include "Tudat/Astrodynamics/Aerodynamics/atmosphereModel.h"
 
 namespace tudat
@@ -125,7 +126,8 @@ enum AtmosphereTypes
 {
     exponential_atmosphere,
     tabulated_atmosphere,
-    nrlmsise00
+    nrlmsise00,
+    gridded_atmosphere
 };
 
 //! Class for providing settings for atmosphere model.
@@ -263,7 +265,8 @@ public:
      *  https://celestrak.com/SpaceData/sw19571001.txt
      */
     NRLMSISE00AtmosphereSettings( const std::string& spaceWeatherFile ):
-        AtmosphereSettings( nrlmsise00 ), spaceWeatherFile_( spaceWeatherFile ){ }
+        AtmosphereSettings( nrlmsise00 ), spaceWeatherFile_( spaceWeatherFile ), maximumNumberOfCacheEntries_( 0 ),
+        altitudeResolution_( 0.0 ), angleResolution_( 0.0 ), timeResolution_( 0.0 ){ }
 
     //! Function to return file containing space weather data.
     /*!
@@ -272,6 +275,55 @@ public:
      */
     std::string getSpaceWeatherFile( ){ return spaceWeatherFile_; }
 
+    //! Function to set the settings of the cache of model evaluations.
+    /*!
+     *  Function to set the settings of the least-recently-used cache of model evaluations
+     *  (see NRLMSISE00Atmosphere::setCacheSettings).
+     *  \param maximumNumberOfCacheEntries Maximum number of model evaluations that are kept in the cache (if 0, no
+     *  cache is used).
+     *  \param altitudeResolution Resolution to which altitudes are rounded when using the cache [m].
+     *  \param angleResolution Resolution to which longitudes and latitudes are rounded when using the cache [rad].
+     *  \param timeResolution Resolution to which times are rounded when using the cache [s].
+     */
+    void setCacheSettings( const unsigned int maximumNumberOfCacheEntries,
+                           const double altitudeResolution = 0.0,
+                           const double angleResolution = 0.0,
+                           const double timeResolution = 0.0 )
+    {
+        maximumNumberOfCacheEntries_ = maximumNumberOfCacheEntries;
+        altitudeResolution_ = altitudeResolution;
+        angleResolution_ = angleResolution;
+        timeResolution_ = timeResolution;
+    }
+
+    //! Function to return maximum number of model evaluations that are kept in the cache.
+    /*!
+     *  Function to return maximum number of model evaluations that are kept in the cache.
+     *  \return Maximum number of model evaluations that are kept in the cache (if 0, no cache is used).
+     */
+    unsigned int getMaximumNumberOfCacheEntries( ){ return maximumNumberOfCacheEntries_; }
+
+    //! Function to return resolution to which altitudes are rounded when using the cache.
+    /*!
+     *  Function to return resolution to which altitudes are rounded when using the cache.
+     *  \return Resolution to which altitudes are rounded when using the cache [m].
+     */
+    double getAltitudeResolution( ){ return altitudeResolution_; }
+
+    //! Function to return resolution to which longitudes and latitudes are rounded when using the cache.
+    /*!
+     *  Function to return resolution to which longitudes and latitudes are rounded when using the cache.
+     *  \return Resolution to which longitudes and latitudes are rounded when using the cache [rad].
+     */
+    double getAngleResolution( ){ return angleResolution_; }
+
+    //! Function to return resolution to which times are rounded when using the cache.
+    /*!
+     *  Function to return resolution to which times are rounded when using the cache.
+     *  \return Resolution to which times are rounded when using the cache [s].
+     */
+    double getTimeResolution( ){ return timeResolution_; }
+
 private:
 
     //! File containing space weather data.
@@ -279,6 +331,18 @@ private:
      *  File containing space weather data, as in https://celestrak.com/SpaceData/sw19571001.txt
      */
     std::string spaceWeatherFile_;
+
+    //! Maximum number of model evaluations that are kept in the cache (if 0, no cache is used).
+    unsigned int maximumNumberOfCacheEntries_;
+
+    //! Resolution to which altitudes are rounded when using the cache [m].
+    double altitudeResolution_;
+
+    //! Resolution to which longitudes and latitudes are rounded when using the cache [rad].
+    double angleResolution_;
+
+    //! Resolution to which times are rounded when using the cache [s].
+    double timeResolution_;
 };
 
 
@@ -315,6 +379,159 @@ private:
     std::string atmosphereFile_;
 };
 
+//! AtmosphereSettings for defining an atmosphere interpolated from a grid, generated by sampling another atmosphere.
+class GriddedAtmosphereSettings: public AtmosphereSettings
+{
+public:
+
+    //! Constructor.
+    /*!
+     *  Constructor (see GriddedAtmosphere constructor for details on the grid).
+     *  \param sampledAtmosphereSettings Settings for the atmosphere model that is sampled to generate the grid.
+     *  \param minimumAltitude Lowest altitude of the grid [m].
+     *  \param maximumAltitude Highest altitude of the grid [m].
+     *  \param numberOfAltitudes Number of altitude nodes of the grid.
+     *  \param numberOfLatitudes Number of latitude nodes of the grid, equidistant from -90 to 90 degrees.
+     *  \param numberOfLocalSolarTimes Number of local solar time nodes of the grid, equidistant over 24 hours.
+     *  \param startEpoch First epoch at which the model is sampled [s since J2000].
+     *  \param endEpoch Last epoch at which the model is sampled (unused if numberOfEpochs is 1) [s since J2000].
+     *  \param numberOfEpochs Number of epoch nodes of the grid.
+     *  \param interpolateLogarithms Boolean denoting whether the logarithm of density and pressure is interpolated.
+     *  \param numberOfThreads Number of threads used to generate the grid (if 0, the number of concurrent threads
+     *  supported by the hardware is used).
+     */
+    GriddedAtmosphereSettings( const boost::shared_ptr< AtmosphereSettings > sampledAtmosphereSettings,
+                               const double minimumAltitude,
+                               const double maximumAltitude,
+                               const unsigned int numberOfAltitudes,
+                               const unsigned int numberOfLatitudes,
+                               const unsigned int numberOfLocalSolarTimes,
+                               const double startEpoch,
+                               const double endEpoch = TUDAT_NAN,
+                               const unsigned int numberOfEpochs = 1,
+                               const bool interpolateLogarithms = true,
+                               const unsigned int numberOfThreads = 0 ):
+        AtmosphereSettings( gridded_atmosphere ), sampledAtmosphereSettings_( sampledAtmosphereSettings ),
+        minimumAltitude_( minimumAltitude ), maximumAltitude_( maximumAltitude ),
+        numberOfAltitudes_( numberOfAltitudes ), numberOfLatitudes_( numberOfLatitudes ),
+        numberOfLocalSolarTimes_( numberOfLocalSolarTimes ), startEpoch_( startEpoch ), endEpoch_( endEpoch ),
+        numberOfEpochs_( numberOfEpochs ), interpolateLogarithms_( interpolateLogarithms ),
+        numberOfThreads_( numberOfThreads ){ }
+
+    //! Function to return settings for the atmosphere model that is sampled to generate the grid.
+    /*!
+     *  Function to return settings for the atmosphere model that is sampled to generate the grid.
+     *  \return Settings for the atmosphere model that is sampled to generate the grid.
+     */
+    boost::shared_ptr< AtmosphereSettings > getSampledAtmosphereSettings( ){ return sampledAtmosphereSettings_; }
+
+    //! Function to return lowest altitude of the grid.
+    /*!
+     *  Function to return lowest altitude of the grid.
+     *  \return Lowest altitude of the grid [m].
+     */
+    double getMinimumAltitude( ){ return minimumAltitude_; }
+
+    //! Function to return highest altitude of the grid.
+    /*!
+     *  Function to return highest altitude of the grid.
+     *  \return Highest altitude of the grid [m].
+     */
+    double getMaximumAltitude( ){ return maximumAltitude_; }
+
+    //! Function to return number of altitude nodes of the grid.
+    /*!
+     *  Function to return number of altitude nodes of the grid.
+     *  \return Number of altitude nodes of the grid.
+     */
+    unsigned int getNumberOfAltitudes( ){ return numberOfAltitudes_; }
+
+    //! Function to return number of latitude nodes of the grid.
+    /*!
+     *  Function to return number of latitude nodes of the grid.
+     *  \return Number of latitude nodes of the grid.
+     */
+    unsigned int getNumberOfLatitudes( ){ return numberOfLatitudes_; }
+
+    //! Function to return number of local solar time nodes of the grid.
+    /*!
+     *  Function to return number of local solar time nodes of the grid.
+     *  \return Number of local solar time nodes of the grid.
+     */
+    unsigned int getNumberOfLocalSolarTimes( ){ return numberOfLocalSolarTimes_; }
+
+    //! Function to return first epoch at which the model is sampled.
+    /*!
+     *  Function to return first epoch at which the model is sampled.
+     *  \return First epoch at which the model is sampled [s since J2000].
+     */
+    double getStartEpoch( ){ return startEpoch_; }
+
+    //! Function to return last epoch at which the model is sampled.
+    /*!
+     *  Function to return last epoch at which the model is sampled.
+     *  \return Last epoch at which the model is sampled [s since J2000].
+     */
+    double getEndEpoch( ){ return endEpoch_; }
+
+    //! Function to return number of epoch nodes of the grid.
+    /*!
+     *  Function to return number of epoch nodes of the grid.
+     *  \return Number of epoch nodes of the grid.
+     */
+    unsigned int getNumberOfEpochs( ){ return numberOfEpochs_; }
+
+    //! Function to return whether the logarithm of density and pressure is interpolated.
+    /*!
+     *  Function to return whether the logarithm of density and pressure is interpolated.
+     *  \return Boolean denoting whether the logarithm of density and pressure is interpolated.
+     */
+    bool getInterpolateLogarithms( ){ return interpolateLogarithms_; }
+
+    //! Function to return number of threads used to generate the grid.
+    /*!
+     *  Function to return number of threads used to generate the grid.
+     *  \return Number of threads used to generate the grid (if 0, the number of concurrent threads supported by the
+     *  hardware is used).
+     */
+    unsigned int getNumberOfThreads( ){ return numberOfThreads_; }
+
+private:
+
+    //! Settings for the atmosphere model that is sampled to generate the grid.
+    boost::shared_ptr< AtmosphereSettings > sampledAtmosphereSettings_;
+
+    //! Lowest altitude of the grid [m].
+    double minimumAltitude_;
+
+    //! Highest altitude of the grid [m].
+    double maximumAltitude_;
+
+    //! Number of altitude nodes of the grid.
+    unsigned int numberOfAltitudes_;
+
+    //! Number of latitude nodes of the grid.
+    unsigned int numberOfLatitudes_;
+
+    //! Number of local solar time nodes of the grid.
+    unsigned int numberOfLocalSolarTimes_;
+
+    //! First epoch at which the model is sampled [s since J2000].
+    double startEpoch_;
+
+    //! Last epoch at which the model is sampled [s since J2000].
+    double endEpoch_;
+
+    //! Number of epoch nodes of the grid.
+    unsigned int numberOfEpochs_;
+
+    //! Boolean denoting whether the logarithm of density and pressure is interpolated.
+    bool interpolateLogarithms_;
+
+    //! Number of threads used to generate the grid.
+    unsigned int numberOfThreads_;
+};
+
 //! Function to create a wind model.
 /*!
  *  Function to create a wind model based on model-specific settings for the wind model.
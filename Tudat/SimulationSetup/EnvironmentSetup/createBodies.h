@@ -201,7 +201,7 @@ void setGlobalFrameBodyEphemerides( const NamedBodyMap& bodyMap,
                                              bodyMap.at( ephemerisFrameOrigin ), _1 );
                         boost::shared_ptr< BaseStateInterface > baseStateInterface =
                                 boost::make_shared< BaseStateInterfaceImplementation< TimeType, StateScalarType > >(
-                                    ephemerisFrameOrigin, stateFunction );
+                                    ephemerisFrameOrigin, stateFunction, false, bodyMap.at( ephemerisFrameOrigin ) );
                         bodyIterator->second->setEphemerisFrameToBaseFrame( baseStateInterface );
                     }
                 }
@@ -255,7 +255,7 @@ void setGlobalFrameBodyEphemerides( const NamedBodyMap& bodyMap,
                                                  bodyMap.at( ephemerisFrameOrigin ), _1 );
                             boost::shared_ptr< BaseStateInterface > baseStateInterface =
                                     boost::make_shared< BaseStateInterfaceImplementation< TimeType, StateScalarType > >(
-                                        ephemerisFrameOrigin, stateFunction, false );
+                                        ephemerisFrameOrigin, stateFunction, false, bodyMap.at( ephemerisFrameOrigin ) );
                             bodyIterator->second->setEphemerisFrameToBaseFrame( baseStateInterface );
                         }
                     }
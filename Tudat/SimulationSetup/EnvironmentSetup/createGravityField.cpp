@@ -8,6 +8,13 @@
  *    http://tudat.tudelft.nl/LICENSE.
  */
 
+#include <cmath>
+#include <cstring>
+#include <fstream>
+
+#include <boost/filesystem.hpp>
+#include <boost/interprocess/file_mapping.hpp>
+#include <boost/interprocess/mapped_region.hpp>
 #include <boost/make_shared.hpp>
 
 #if USE_CSPICE
@@ -109,6 +116,27 @@ std::pair< double, double  > readGravityFieldFile(
         std::pair< Eigen::MatrixXd, Eigen::MatrixXd >& coefficients,
         const int gravitationalParameterIndex, const int referenceRadiusIndex )
 {
+    // Read binary gravity field file, if provided.
+    if( isBinaryGravityFieldFile( fileName ) )
+    {
+        std::pair< double, double > referenceData =
+                readBinaryGravityFieldFile( fileName, maximumDegree, maximumOrder, coefficients );
+        if( ( gravitationalParameterIndex >= 0 ) && ( referenceRadiusIndex >= 0 ) )
+        {
+            if( referenceData.first != referenceData.first || referenceData.second != referenceData.second )
+            {
+                throw std::runtime_error( "Error when reading binary gravity field file " + fileName +
+                                          ", gravitational parameter and reference radius are not defined in file" );
+            }
+            return referenceData;
+        }
+        else if( ( gravitationalParameterIndex >= 0 ) || ( referenceRadiusIndex >= 0 ) )
+        {
+            throw std::runtime_error( "Error when reading gravity field file, must retrieve either both or neither of Re and mu" );
+        }
+        return std::make_pair( TUDAT_NAN, TUDAT_NAN );
+    }
+
     // Attempt to open gravity file.
     std::fstream stream( fileName.c_str( ), std::ios::in );
     if( stream.fail( ) )
@@ -172,6 +200,12 @@ std::pair< double, double  > readGravityFieldFile(
         // Trim input string (removes all leading and trailing whitespaces).
         boost::algorithm::trim( line );
 
+        // Skip empty lines (e.g. at end of file).
+        if( line.empty( ) )
+        {
+            continue;
+        }
+
         // Split string into multiple strings, each containing one element from a line from the
         // data file.
         boost::algorithm::split( vectorOfIndividualStrings,
@@ -210,6 +244,191 @@ std::pair< double, double  > readGravityFieldFile(
     return std::make_pair( gravitationalParameter, referenceRadius );
 }
 
+//! Identifier at start of binary gravity field file.
+static const char binaryGravityFieldFileIdentifier[ 8 ] = { 'T', 'U', 'D', 'A', 'T', 'S', 'H', 'C' };
+
+//! Version of binary gravity field file format.
+static const int binaryGravityFieldFileVersion = 1;
+
+//! Size (in bytes) of header of binary gravity field file (identifier, version, maximum degree, maximum order, unused
+//! entry, gravitational parameter, reference radius).
+static const std::size_t binaryGravityFieldFileHeaderSize = 40;
+
+//! Function to compute the number of coefficients stored in a binary gravity field file up to (excluding) a given degree.
+static std::size_t getNumberOfBinaryGravityFieldFileEntries( const int degree, const int maximumStoredOrder )
+{
+    std::size_t numberOfEntries = 0;
+    for( int i = 0; i < degree; i++ )
+    {
+        numberOfEntries += 2 * static_cast< std::size_t >( std::min( i, maximumStoredOrder ) + 1 );
+    }
+    return numberOfEntries;
+}
+
+//! Function to check whether a file is a binary spherical harmonic gravity field file
+bool isBinaryGravityFieldFile( const std::string& fileName )
+{
+    std::ifstream stream( fileName.c_str( ), std::ios::binary );
+    char identifier[ 8 ];
+    if( !stream.read( identifier, 8 ) )
+    {
+        return false;
+    }
+    return ( std::memcmp( identifier, binaryGravityFieldFileIdentifier, 8 ) == 0 );
+}
+
+//! Function to write a binary spherical harmonic gravity field file
+void writeBinaryGravityFieldFile(
+        const std::string& fileName, const Eigen::MatrixXd& cosineCoefficients, const Eigen::MatrixXd& sineCoefficients,
+        const double gravitationalParameter, const double referenceRadius )
+{
+    if( cosineCoefficients.rows( ) != sineCoefficients.rows( ) || cosineCoefficients.cols( ) != sineCoefficients.cols( ) ||
+            cosineCoefficients.rows( ) == 0 || cosineCoefficients.cols( ) == 0 )
+    {
+        throw std::runtime_error( "Error when writing binary gravity field file, cosine and sine coefficients are "
+                                  "inconsistent" );
+    }
+
+    std::ofstream stream( fileName.c_str( ), std::ios::binary | std::ios::trunc );
+    if( !stream.good( ) )
+    {
+        throw std::runtime_error( "Error when writing binary gravity field file, could not open file " + fileName );
+    }
+
+    // Write header.
+    const int maximumDegree = static_cast< int >( cosineCoefficients.rows( ) ) - 1;
+    const int maximumOrder = static_cast< int >( cosineCoefficients.cols( ) ) - 1;
+    const int unusedEntry = 0;
+    stream.write( binaryGravityFieldFileIdentifier, 8 );
+    stream.write( reinterpret_cast< const char* >( &binaryGravityFieldFileVersion ), 4 );
+    stream.write( reinterpret_cast< const char* >( &maximumDegree ), 4 );
+    stream.write( reinterpret_cast< const char* >( &maximumOrder ), 4 );
+    stream.write( reinterpret_cast< const char* >( &unusedEntry ), 4 );
+    stream.write( reinterpret_cast< const char* >( &gravitationalParameter ), 8 );
+    stream.write( reinterpret_cast< const char* >( &referenceRadius ), 8 );
+
+    // Write coefficients per degree.
+    std::vector< double > degreeCoefficients;
+    for( int i = 0; i <= maximumDegree; i++ )
+    {
+        const int numberOfOrders = std::min( i, maximumOrder ) + 1;
+        degreeCoefficients.resize( 2 * numberOfOrders );
+        for( int j = 0; j < numberOfOrders; j++ )
+        {
+            degreeCoefficients[ j ] = cosineCoefficients( i, j );
+            degreeCoefficients[ numberOfOrders + j ] = sineCoefficients( i, j );
+        }
+        stream.write( reinterpret_cast< const char* >( degreeCoefficients.data( ) ),
+                      static_cast< std::streamsize >( degreeCoefficients.size( ) * sizeof( double ) ) );
+    }
+
+    if( !stream.good( ) )
+    {
+        throw std::runtime_error( "Error when writing binary gravity field file, could not write file " + fileName );
+    }
+}
+
+//! Function to read a binary spherical harmonic gravity field file
+std::pair< double, double > readBinaryGravityFieldFile(
+        const std::string& fileName, const int maximumDegree, const int maximumOrder,
+        std::pair< Eigen::MatrixXd, Eigen::MatrixXd >& coefficients )
+{
+    using namespace boost::interprocess;
+
+    // Read and check header.
+    std::size_t fileSize = 0;
+    char header[ binaryGravityFieldFileHeaderSize ];
+    {
+        std::ifstream stream( fileName.c_str( ), std::ios::binary );
+        if( !stream.read( header, binaryGravityFieldFileHeaderSize ) ||
+                std::memcmp( header, binaryGravityFieldFileIdentifier, 8 ) != 0 )
+        {
+            throw std::runtime_error( "Error when reading binary gravity field file, " + fileName +
+                                      " is not a binary gravity field file" );
+        }
+        stream.seekg( 0, std::ios::end );
+        fileSize = static_cast< std::size_t >( stream.tellg( ) );
+    }
+
+    int fileVersion, maximumStoredDegree, maximumStoredOrder;
+    double gravitationalParameter, referenceRadius;
+    std::memcpy( &fileVersion, header + 8, 4 );
+    std::memcpy( &maximumStoredDegree, header + 12, 4 );
+    std::memcpy( &maximumStoredOrder, header + 16, 4 );
+    std::memcpy( &gravitationalParameter, header + 24, 8 );
+    std::memcpy( &referenceRadius, header + 32, 8 );
+
+    if( fileVersion != binaryGravityFieldFileVersion )
+    {
+        throw std::runtime_error( "Error when reading binary gravity field file " + fileName +
+                                  ", unsupported version " + std::to_string( fileVersion ) );
+    }
+
+    if( maximumStoredDegree < 0 || maximumStoredOrder < 0 || fileSize != binaryGravityFieldFileHeaderSize +
+            sizeof( double ) * getNumberOfBinaryGravityFieldFileEntries( maximumStoredDegree + 1, maximumStoredOrder ) )
+    {
+        throw std::runtime_error( "Error when reading binary gravity field file " + fileName +
+                                  ", file size is inconsistent with header" );
+    }
+
+    Eigen::MatrixXd cosineCoefficients = Eigen::MatrixXd::Zero( maximumDegree + 1, maximumOrder + 1 );
+    Eigen::MatrixXd sineCoefficients = Eigen::MatrixXd::Zero( maximumDegree + 1, maximumOrder + 1 );
+
+    // Map only the part of the file containing the requested degrees, and copy coefficients directly into matrices.
+    const int maximumReadDegree = std::min( maximumDegree, maximumStoredDegree );
+    const int maximumReadOrder = std::min( maximumOrder, maximumStoredOrder );
+    if( maximumReadDegree >= 0 && maximumReadOrder >= 0 )
+    {
+        try
+        {
+            file_mapping gravityFieldFile( fileName.c_str( ), read_only );
+            mapped_region mappedCoefficients(
+                        gravityFieldFile, read_only, 0, binaryGravityFieldFileHeaderSize + sizeof( double ) *
+                        getNumberOfBinaryGravityFieldFileEntries( maximumReadDegree + 1, maximumStoredOrder ) );
+
+            const double* degreeCoefficients = reinterpret_cast< const double* >(
+                        static_cast< const char* >( mappedCoefficients.get_address( ) ) +
+                        binaryGravityFieldFileHeaderSize );
+            for( int i = 0; i <= maximumReadDegree; i++ )
+            {
+                const int numberOfStoredOrders = std::min( i, maximumStoredOrder ) + 1;
+                const int numberOfReadOrders = std::min( i, maximumReadOrder ) + 1;
+                cosineCoefficients.row( i ).head( numberOfReadOrders ) =
+                        Eigen::Map< const Eigen::RowVectorXd >( degreeCoefficients, numberOfReadOrders );
+                sineCoefficients.row( i ).head( numberOfReadOrders ) =
+                        Eigen::Map< const Eigen::RowVectorXd >(
+                            degreeCoefficients + numberOfStoredOrders, numberOfReadOrders );
+                degreeCoefficients += 2 * numberOfStoredOrders;
+            }
+        }
+        catch( interprocess_exception& caughtException )
+        {
+            throw std::runtime_error( "Error when reading binary gravity field file " + fileName +
+                                      ", could not map file: " + caughtException.what( ) );
+        }
+    }
+
+    // Set cosine coefficient at (0,0) to 1.
+    cosineCoefficients( 0, 0 ) = 1.0;
+    coefficients = std::make_pair( cosineCoefficients, sineCoefficients );
+
+    return std::make_pair( gravitationalParameter, referenceRadius );
+}
+
+//! Function to convert a spherical harmonic gravity field text file to a binary file
+void convertGravityFieldFileToBinary(
+        const std::string& textFileName, const std::string& binaryFileName,
+        const int maximumDegree, const int maximumOrder,
+        const int gravitationalParameterIndex, const int referenceRadiusIndex )
+{
+    std::pair< Eigen::MatrixXd, Eigen::MatrixXd > coefficients;
+    std::pair< double, double > referenceData = readGravityFieldFile(
+                textFileName, maximumDegree, maximumOrder, coefficients,
+                gravitationalParameterIndex, referenceRadiusIndex );
+    writeBinaryGravityFieldFile( binaryFileName, coefficients.first, coefficients.second,
+                                 referenceData.first, referenceData.second );
+}
+
 //! Function to create a gravity field model.
 boost::shared_ptr< gravitation::GravityFieldModel > createGravityFieldModel(
         const boost::shared_ptr< GravityFieldSettings > gravityFieldSettings,
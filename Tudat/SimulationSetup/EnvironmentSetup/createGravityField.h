@@ -400,6 +400,9 @@ boost::shared_ptr< SphericalHarmonicsGravityFieldSettings > createHomogeneousTri
  *  Degree, Order, Cosine Coefficient, Sine Coefficients
  *  Subsequent columns may be present in the file, but are ignored when parsing.
  *  All coefficients not defined in the file are set to zero (except C(0,0) which is always 1.0)
+ *  Alternatively, the file may be a binary gravity field file (see writeBinaryGravityFieldFile), in which case it is
+ *  read by readBinaryGravityFieldFile, and the gravitational parameter and reference radius are taken from its header
+ *  (if gravitationalParameterIndex and referenceRadiusIndex are >=0).
  *  \param fileName Name of PDS gravity field file to be loaded.
  *  \param maximumDegree Maximum degree of gravity field to be loaded.
  *  \param maximumOrder Maximum order of gravity field to be loaded.
@@ -414,6 +417,63 @@ std::pair< double, double > readGravityFieldFile(
         std::pair< Eigen::MatrixXd, Eigen::MatrixXd >& coefficients,
         const int gravitationalParameterIndex = -1, const int referenceRadiusIndex = -1 );
 
+//! Function to check whether a file is a binary spherical harmonic gravity field file
+/*!
+ *  Function to check whether a file is a binary spherical harmonic gravity field file, as written by
+ *  writeBinaryGravityFieldFile (by checking the identifier at the start of the file).
+ *  \param fileName Name of file that is to be checked.
+ *  \return True if file exists and is a binary gravity field file.
+ */
+bool isBinaryGravityFieldFile( const std::string& fileName );
+
+//! Function to write a binary spherical harmonic gravity field file
+/*!
+ *  Function to write spherical harmonic coefficients, gravitational parameter and reference radius to a binary file (in
+ *  native byte order). After a fixed-size header, the coefficients are stored per degree (cosine coefficients of all
+ *  orders, followed by sine coefficients of all orders), so that the coefficients up to any degree are stored in a
+ *  contiguous prefix of the file.
+ *  \param fileName Name of binary gravity field file that is to be written.
+ *  \param cosineCoefficients Cosine spherical harmonic coefficients (degree as row, order as column index).
+ *  \param sineCoefficients Sine spherical harmonic coefficients (degree as row, order as column index).
+ *  \param gravitationalParameter Gravitational parameter of gravity field (NaN if unknown).
+ *  \param referenceRadius Reference radius of gravity field (NaN if unknown).
+ */
+void writeBinaryGravityFieldFile(
+        const std::string& fileName, const Eigen::MatrixXd& cosineCoefficients, const Eigen::MatrixXd& sineCoefficients,
+        const double gravitationalParameter = TUDAT_NAN, const double referenceRadius = TUDAT_NAN );
+
+//! Function to read a binary spherical harmonic gravity field file
+/*!
+ *  Function to read a binary spherical harmonic gravity field file, as written by writeBinaryGravityFieldFile, returns
+ *  (by reference) cosine and sine spherical harmomic coefficients. The file is memory-mapped, and only the part of the
+ *  file containing the coefficients up to the requested maximum degree is mapped and read. As for
+ *  readGravityFieldFile, coefficients not defined in the file are set to zero (except C(0,0) which is always 1.0).
+ *  \param fileName Name of binary gravity field file to be loaded.
+ *  \param maximumDegree Maximum degree of gravity field to be loaded.
+ *  \param maximumOrder Maximum order of gravity field to be loaded.
+ *  \param coefficients Spherical harmonics coefficients (first is cosine, second is sine).
+ *  \return Pair of gravitational parameter and reference radius, as stored in file header.
+ */
+std::pair< double, double > readBinaryGravityFieldFile(
+        const std::string& fileName, const int maximumDegree, const int maximumOrder,
+        std::pair< Eigen::MatrixXd, Eigen::MatrixXd >& coefficients );
+
+//! Function to convert a spherical harmonic gravity field text file to a binary file
+/*!
+ *  Function to convert a spherical harmonic gravity field text file (see readGravityFieldFile) to a binary gravity
+ *  field file (see writeBinaryGravityFieldFile).
+ *  \param textFileName Name of text gravity field file that is to be converted.
+ *  \param binaryFileName Name of binary gravity field file that is to be written.
+ *  \param maximumDegree Maximum degree of coefficients that are converted.
+ *  \param maximumOrder Maximum order of coefficients that are converted.
+ *  \param gravitationalParameterIndex Index of gravitational parameter in header of text file (-1 if none).
+ *  \param referenceRadiusIndex Index of reference radius in header of text file (-1 if none).
+ */
+void convertGravityFieldFileToBinary(
+        const std::string& textFileName, const std::string& binaryFileName,
+        const int maximumDegree, const int maximumOrder,
+        const int gravitationalParameterIndex = -1, const int referenceRadiusIndex = -1 );
+
 //! Function to create a gravity field model.
 /*!
  *  Function to create a gravity field model based on model-specific settings for the gravity field.
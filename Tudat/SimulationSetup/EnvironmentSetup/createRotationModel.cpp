@@ -8,8 +8,14 @@
  *    http://tudat.tudelft.nl/LICENSE.
  */
 
+#include <iostream>
+
+#include <boost/bind.hpp>
+#include <boost/filesystem.hpp>
+#include <boost/functional/hash.hpp>
 #include <boost/make_shared.hpp>
 #include "Tudat/Astrodynamics/Ephemerides/simpleRotationalEphemeris.h"
+#include "Tudat/InputOutput/basicInputOutput.h"
 
 #if USE_CSPICE
 #include "Tudat/External/SpiceInterface/spiceRotationalEphemeris.h"
@@ -30,6 +36,170 @@ namespace tudat
 namespace simulation_setup
 {
 
+#if USE_SOFA
+//! Function to create an object calculating the Earth orientation angles from GCRS<->ITRS rotation model settings.
+boost::shared_ptr< earth_orientation::EarthOrientationAnglesCalculator > createEarthOrientationAnglesCalculator(
+        const boost::shared_ptr< GcrsToItrsRotationModelSettings > gcrsToItrsRotationSettings )
+{
+    // Read EOP file
+    boost::shared_ptr< earth_orientation::EOPReader > eopReader = boost::make_shared< earth_orientation::EOPReader >(
+                gcrsToItrsRotationSettings->getEopFile( ),
+                gcrsToItrsRotationSettings->getEopFileFormat( ),
+                gcrsToItrsRotationSettings->getNutationTheory( ) );
+
+    // Load polar motion corrections
+    boost::shared_ptr< interpolators::LinearInterpolator< double, Eigen::Vector2d > > cipInItrsInterpolator =
+            boost::make_shared< interpolators::LinearInterpolator< double, Eigen::Vector2d > >(
+                eopReader->getCipInItrsMapInSecondsSinceJ2000( ) );
+
+    // Load nutation corrections
+    boost::shared_ptr< interpolators::LinearInterpolator< double, Eigen::Vector2d > > cipInGcrsCorrectionInterpolator =
+            boost::make_shared< interpolators::LinearInterpolator< double, Eigen::Vector2d > >(
+                eopReader->getCipInGcrsCorrectionMapInSecondsSinceJ2000( ) );
+
+    // Create polar motion correction (sub-diural frequencies) object
+    boost::shared_ptr< earth_orientation::ShortPeriodEarthOrientationCorrectionCalculator< Eigen::Vector2d > >
+            shortPeriodPolarMotionCalculator =
+            boost::make_shared< earth_orientation::ShortPeriodEarthOrientationCorrectionCalculator< Eigen::Vector2d > >(
+                gcrsToItrsRotationSettings->getPolarMotionCorrectionSettings( )->conversionFactor_,
+                gcrsToItrsRotationSettings->getPolarMotionCorrectionSettings( )->minimumAmplitude_,
+                gcrsToItrsRotationSettings->getPolarMotionCorrectionSettings( )->amplitudesFiles_,
+                gcrsToItrsRotationSettings->getPolarMotionCorrectionSettings( )->argumentMultipliersFile_ );
+
+    // Create full polar motion calculator
+    boost::shared_ptr< earth_orientation::PolarMotionCalculator > polarMotionCalculator =
+            boost::make_shared< earth_orientation::PolarMotionCalculator >
+            ( cipInItrsInterpolator, shortPeriodPolarMotionCalculator );
+
+    // Create IAU 2006 precession/nutation calculator
+    boost::shared_ptr< earth_orientation::PrecessionNutationCalculator > precessionNutationCalculator =
+            boost::make_shared< earth_orientation::PrecessionNutationCalculator >(
+                gcrsToItrsRotationSettings->getNutationTheory( ), cipInGcrsCorrectionInterpolator );
+
+    // Create UT1 correction (sub-diural frequencies) object
+    boost::shared_ptr< earth_orientation::ShortPeriodEarthOrientationCorrectionCalculator< double > >
+            ut1CorrectionSettings =
+            boost::make_shared< earth_orientation::ShortPeriodEarthOrientationCorrectionCalculator< double > >(
+                gcrsToItrsRotationSettings->getUt1CorrectionSettings( )->conversionFactor_,
+                gcrsToItrsRotationSettings->getUt1CorrectionSettings( )->minimumAmplitude_,
+                gcrsToItrsRotationSettings->getUt1CorrectionSettings( )->amplitudesFiles_,
+                gcrsToItrsRotationSettings->getUt1CorrectionSettings( )->argumentMultipliersFile_ );
+
+    boost::shared_ptr< interpolators::OneDimensionalInterpolator < double, double > > dailyUtcUt1CorrectionInterpolator =
+            boost::make_shared< interpolators::JumpDataLinearInterpolator< double, double > >(
+                eopReader->getUt1MinusUtcMapInSecondsSinceJ2000( ), 0.5, 1.0 );
+
+    // Create default time scale converter
+    boost::shared_ptr< earth_orientation::TerrestrialTimeScaleConverter > terrestrialTimeScaleConverter =
+            boost::make_shared< earth_orientation::TerrestrialTimeScaleConverter >
+            (  dailyUtcUt1CorrectionInterpolator, ut1CorrectionSettings );
+
+    // Create Earth orientation calculator
+    return boost::make_shared< earth_orientation::EarthOrientationAnglesCalculator >(
+                polarMotionCalculator, precessionNutationCalculator, terrestrialTimeScaleConverter );
+}
+
+//! Function to combine the hash of settings for EOP short-period variations with an existing hash.
+/*!
+ *  Function to combine the hash of settings for EOP short-period variations (including the contents of the amplitude
+ *  and argument multiplier files) with an existing hash.
+ *  \param sourceDataHash Hash with which the hash of the settings is combined (modified by this function).
+ *  \param correctionSettings Settings for EOP short-period variations.
+ */
+void combineEopCorrectionSettingsHash( std::size_t& sourceDataHash,
+                                       const boost::shared_ptr< EopCorrectionSettings > correctionSettings )
+{
+    boost::hash_combine( sourceDataHash, correctionSettings->conversionFactor_ );
+    boost::hash_combine( sourceDataHash, correctionSettings->minimumAmplitude_ );
+    for( unsigned int i = 0; i < correctionSettings->amplitudesFiles_.size( ); i++ )
+    {
+        boost::hash_combine( sourceDataHash,
+                             input_output::computeFileContentsHash( correctionSettings->amplitudesFiles_.at( i ) ) );
+    }
+    for( unsigned int i = 0; i < correctionSettings->argumentMultipliersFile_.size( ); i++ )
+    {
+        boost::hash_combine( sourceDataHash, input_output::computeFileContentsHash(
+                                 correctionSettings->argumentMultipliersFile_.at( i ) ) );
+    }
+}
+
+//! Function to compute a hash of the data from which a table of the rotation from ITRS to GCRS is generated.
+std::size_t computeItrsToGcrsRotationTableSourceDataHash(
+        const boost::shared_ptr< GcrsToItrsRotationModelSettings > gcrsToItrsRotationSettings )
+{
+    std::size_t sourceDataHash = 0;
+    boost::hash_combine( sourceDataHash,
+                         input_output::computeFileContentsHash( gcrsToItrsRotationSettings->getEopFile( ) ) );
+    boost::hash_combine( sourceDataHash, gcrsToItrsRotationSettings->getEopFileFormat( ) );
+    boost::hash_combine( sourceDataHash, static_cast< int >( gcrsToItrsRotationSettings->getNutationTheory( ) ) );
+    combineEopCorrectionSettingsHash( sourceDataHash, gcrsToItrsRotationSettings->getUt1CorrectionSettings( ) );
+    combineEopCorrectionSettingsHash( sourceDataHash, gcrsToItrsRotationSettings->getPolarMotionCorrectionSettings( ) );
+    return sourceDataHash;
+}
+
+//! Function to create (or load) a table of the rotation from ITRS to GCRS.
+boost::shared_ptr< earth_orientation::ItrsToGcrsRotationTable > createItrsToGcrsRotationTable(
+        const boost::shared_ptr< GcrsToItrsRotationModelSettings > gcrsToItrsRotationSettings )
+{
+    boost::shared_ptr< ItrsToGcrsRotationTableSettings > tableSettings =
+            gcrsToItrsRotationSettings->getRotationTableSettings( );
+    if( tableSettings == NULL )
+    {
+        throw std::runtime_error( "Error when creating ITRS to GCRS rotation table, no table settings provided." );
+    }
+
+    // Compute hash of the data from which the table is generated, to check consistency of the cache file.
+    std::size_t sourceDataHash = 0;
+    if( tableSettings->cacheFile_ != "" )
+    {
+        sourceDataHash = computeItrsToGcrsRotationTableSourceDataHash( gcrsToItrsRotationSettings );
+    }
+
+    // Load table from cache file, if it exists and is compatible with settings.
+    boost::shared_ptr< earth_orientation::ItrsToGcrsRotationTable > rotationTable;
+    if( tableSettings->cacheFile_ != "" && boost::filesystem::exists( tableSettings->cacheFile_ ) )
+    {
+        try
+        {
+            rotationTable = boost::make_shared< earth_orientation::ItrsToGcrsRotationTable >(
+                        tableSettings->cacheFile_ );
+        }
+        catch( std::runtime_error& caughtException )
+        {
+            std::cerr << "Warning, could not load ITRS to GCRS rotation table cache, regenerating table. "
+                      << caughtException.what( ) << std::endl;
+        }
+
+        if( rotationTable != NULL &&
+                ( rotationTable->getSourceDataHash( ) != sourceDataHash ||
+                  rotationTable->getTimeScale( ) != gcrsToItrsRotationSettings->getInputTimeScale( ) ||
+                  rotationTable->getStartTime( ) > tableSettings->startTime_ ||
+                  rotationTable->getEndTime( ) < tableSettings->endTime_ ||
+                  rotationTable->getMaximumRotationError( ) > tableSettings->maximumRotationError_ ) )
+        {
+            rotationTable.reset( );
+        }
+    }
+
+    // Generate table, and save to cache file if required.
+    if( rotationTable == NULL )
+    {
+        rotationTable = boost::make_shared< earth_orientation::ItrsToGcrsRotationTable >(
+                    boost::bind( &createEarthOrientationAnglesCalculator, gcrsToItrsRotationSettings ),
+                    tableSettings->startTime_, tableSettings->endTime_, tableSettings->maximumRotationError_,
+                    gcrsToItrsRotationSettings->getInputTimeScale( ), tableSettings->numberOfThreads_,
+                    sourceDataHash );
+
+        if( tableSettings->cacheFile_ != "" )
+        {
+            rotationTable->saveToFile( tableSettings->cacheFile_ );
+        }
+    }
+
+    return rotationTable;
+}
+#endif
+
 //! Function to create a rotation model.
 boost::shared_ptr< ephemerides::RotationalEphemeris > createRotationModel(
         const boost::shared_ptr< RotationModelSettings > rotationModelSettings,
@@ -79,64 +249,19 @@ boost::shared_ptr< ephemerides::RotationalEphemeris > createRotationModel(
         }
         else
         {
-            boost::shared_ptr< earth_orientation::EOPReader > eopReader = boost::make_shared< earth_orientation::EOPReader >(
-                        gcrsToItrsRotationSettings->getEopFile( ),
-                        gcrsToItrsRotationSettings->getEopFileFormat( ),
-                        gcrsToItrsRotationSettings->getNutationTheory( ) );
-
-            // Load polar motion corrections
-            boost::shared_ptr< interpolators::LinearInterpolator< double, Eigen::Vector2d > > cipInItrsInterpolator =
-                    boost::make_shared< interpolators::LinearInterpolator< double, Eigen::Vector2d > >(
-                        eopReader->getCipInItrsMapInSecondsSinceJ2000( ) );
-
-            // Load nutation corrections
-            boost::shared_ptr< interpolators::LinearInterpolator< double, Eigen::Vector2d > > cipInGcrsCorrectionInterpolator =
-                    boost::make_shared< interpolators::LinearInterpolator< double, Eigen::Vector2d > >(
-                        eopReader->getCipInGcrsCorrectionMapInSecondsSinceJ2000( ) );
-
-            // Create polar motion correction (sub-diural frequencies) object
-            boost::shared_ptr< earth_orientation::ShortPeriodEarthOrientationCorrectionCalculator< Eigen::Vector2d > >
-                    shortPeriodPolarMotionCalculator =
-                    boost::make_shared< earth_orientation::ShortPeriodEarthOrientationCorrectionCalculator< Eigen::Vector2d > >(
-                        gcrsToItrsRotationSettings->getPolarMotionCorrectionSettings( )->conversionFactor_,
-                        gcrsToItrsRotationSettings->getPolarMotionCorrectionSettings( )->minimumAmplitude_,
-                        gcrsToItrsRotationSettings->getPolarMotionCorrectionSettings( )->amplitudesFiles_,
-                        gcrsToItrsRotationSettings->getPolarMotionCorrectionSettings( )->argumentMultipliersFile_ );
-
-            // Create full polar motion calculator
-            boost::shared_ptr< earth_orientation::PolarMotionCalculator > polarMotionCalculator =
-                    boost::make_shared< earth_orientation::PolarMotionCalculator >
-                    ( cipInItrsInterpolator, shortPeriodPolarMotionCalculator );
-
-            // Create IAU 2006 precession/nutation calculator
-            boost::shared_ptr< earth_orientation::PrecessionNutationCalculator > precessionNutationCalculator =
-                    boost::make_shared< earth_orientation::PrecessionNutationCalculator >(
-                        gcrsToItrsRotationSettings->getNutationTheory( ), cipInGcrsCorrectionInterpolator );
-
-            // Create UT1 correction (sub-diural frequencies) object
-            boost::shared_ptr< earth_orientation::ShortPeriodEarthOrientationCorrectionCalculator< double > >
-                    ut1CorrectionSettings =
-                    boost::make_shared< earth_orientation::ShortPeriodEarthOrientationCorrectionCalculator< double > >(
-                        gcrsToItrsRotationSettings->getUt1CorrectionSettings( )->conversionFactor_,
-                        gcrsToItrsRotationSettings->getUt1CorrectionSettings( )->minimumAmplitude_,
-                        gcrsToItrsRotationSettings->getUt1CorrectionSettings( )->amplitudesFiles_,
-                        gcrsToItrsRotationSettings->getUt1CorrectionSettings( )->argumentMultipliersFile_ );
-
-            boost::shared_ptr< interpolators::OneDimensionalInterpolator < double, double > > dailyUtcUt1CorrectionInterpolator =
-                    boost::make_shared< interpolators::JumpDataLinearInterpolator< double, double > >(
-                        eopReader->getUt1MinusUtcMapInSecondsSinceJ2000( ), 0.5, 1.0 );
-
-            // Create default time scale converter
-            boost::shared_ptr< earth_orientation::TerrestrialTimeScaleConverter > terrestrialTimeScaleConverter =
-                    boost::make_shared< earth_orientation::TerrestrialTimeScaleConverter >
-                    (  dailyUtcUt1CorrectionInterpolator, ut1CorrectionSettings );
-
             // Create rotation model
-            boost::shared_ptr< earth_orientation::EarthOrientationAnglesCalculator > earthOrientationCalculator =
-                    boost::make_shared< earth_orientation::EarthOrientationAnglesCalculator >(
-                        polarMotionCalculator, precessionNutationCalculator, terrestrialTimeScaleConverter );
-            rotationalEphemeris = boost::make_shared< ephemerides::GcrsToItrsRotationModel >(
-                        earthOrientationCalculator, gcrsToItrsRotationSettings->getInputTimeScale( ) );
+            boost::shared_ptr< GcrsToItrsRotationModel > gcrsToItrsRotationModel =
+                    boost::make_shared< GcrsToItrsRotationModel >(
+                        createEarthOrientationAnglesCalculator( gcrsToItrsRotationSettings ),
+                        gcrsToItrsRotationSettings->getInputTimeScale( ) );
+
+            // Create (or load) table from which rotation is evaluated, if required.
+            if( gcrsToItrsRotationSettings->getRotationTableSettings( ) != NULL )
+            {
+                gcrsToItrsRotationModel->setRotationTable(
+                            createItrsToGcrsRotationTable( gcrsToItrsRotationSettings ) );
+            }
+            rotationalEphemeris = gcrsToItrsRotationModel;
 
             break;
         }
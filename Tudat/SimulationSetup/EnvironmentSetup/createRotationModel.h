@@ -22,6 +22,9 @@
 #include "Tudat/Astrodynamics/BasicAstrodynamics/physicalConstants.h"
 #include "Tudat/Astrodynamics/BasicAstrodynamics/unitConversions.h"
 #include "Tudat/External/SofaInterface/earthOrientation.h"
+#if USE_SOFA
+#include "Tudat/Astrodynamics/EarthOrientation/itrsToGcrsRotationTable.h"
+#endif
 
 
 
@@ -207,6 +210,51 @@ struct EopCorrectionSettings
     std::vector< std::string > argumentMultipliersFile_;
 };
 
+//! Settings for precomputing the rotation of a GCRS<->ITRS rotation model in a table
+/*!
+ *  Settings for precomputing the rotation of a GCRS<->ITRS rotation model in a table (see
+ *  earth_orientation::ItrsToGcrsRotationTable), from which the rotation is evaluated inside the table interval. If a cache
+ *  file is provided, the table is loaded from this file if it exists and is compatible with the settings. Otherwise, the
+ *  table is generated and saved to the file, for use in later runs.
+ */
+class ItrsToGcrsRotationTableSettings
+{
+public:
+
+    //! Constructor
+    /*!
+     *  Constructor
+     *  \param startTime Start time of table (in seconds since J2000, in input time scale of rotation model).
+     *  \param endTime End time of table (in seconds since J2000, in input time scale of rotation model).
+     *  \param maximumRotationError Maximum rotation angle (in radians) between the tabulated and directly computed rotation.
+     *  \param cacheFile Name of binary file from which table is loaded, or to which it is saved (none if empty).
+     *  \param numberOfThreads Number of threads used to generate the table (if 0, the number of concurrent threads
+     *  supported by the hardware is used).
+     */
+    ItrsToGcrsRotationTableSettings(
+            const double startTime,
+            const double endTime,
+            const double maximumRotationError = 1.0E-12,
+            const std::string& cacheFile = "",
+            const unsigned int numberOfThreads = 0 ):
+        startTime_( startTime ), endTime_( endTime ), maximumRotationError_( maximumRotationError ),
+        cacheFile_( cacheFile ), numberOfThreads_( numberOfThreads ){ }
+
+    //! Start time of table.
+    double startTime_;
+
+    //! End time of table.
+    double endTime_;
+
+    //! Maximum rotation angle between the tabulated and directly computed rotation.
+    double maximumRotationError_;
+
+    //! Name of binary file from which table is loaded, or to which it is saved (none if empty).
+    std::string cacheFile_;
+
+    //! Number of threads used to generate the table.
+    unsigned int numberOfThreads_;
+};
 
 //! Settings for creating a GCRS<->ITRS rotation model
 class GcrsToItrsRotationModelSettings: public RotationModelSettings
@@ -319,6 +367,27 @@ public:
         return polarMotionCorrectionSettings_;
     }
 
+    //! Function to retrieve the settings for precomputing the rotation in a table
+    /*!
+     * Function to retrieve the settings for precomputing the rotation in a table
+     * \return Settings for precomputing the rotation in a table (NULL if rotation is always computed directly)
+     */
+    boost::shared_ptr< ItrsToGcrsRotationTableSettings > getRotationTableSettings( )
+    {
+        return rotationTableSettings_;
+    }
+
+    //! Function to set the settings for precomputing the rotation in a table
+    /*!
+     * Function to set the settings for precomputing the rotation in a table
+     * \param rotationTableSettings Settings for precomputing the rotation in a table (NULL if rotation is always computed
+     * directly)
+     */
+    void setRotationTableSettings( const boost::shared_ptr< ItrsToGcrsRotationTableSettings > rotationTableSettings )
+    {
+        rotationTableSettings_ = rotationTableSettings;
+    }
+
 private:
 
     //! Time scale in which input to the rotation model class is provided
@@ -339,7 +408,42 @@ private:
     //! Settings for short-period polar motion variations
     boost::shared_ptr< EopCorrectionSettings > polarMotionCorrectionSettings_;
 
+    //! Settings for precomputing the rotation in a table (NULL if rotation is always computed directly)
+    boost::shared_ptr< ItrsToGcrsRotationTableSettings > rotationTableSettings_;
+
 };
+
+//! Function to create an object calculating the Earth orientation angles from GCRS<->ITRS rotation model settings.
+/*!
+ *  Function to create an object calculating the Earth orientation angles from GCRS<->ITRS rotation model settings.
+ *  \param gcrsToItrsRotationSettings Settings for the GCRS<->ITRS rotation model.
+ *  \return Object calculating the Earth orientation angles.
+ */
+boost::shared_ptr< earth_orientation::EarthOrientationAnglesCalculator > createEarthOrientationAnglesCalculator(
+        const boost::shared_ptr< GcrsToItrsRotationModelSettings > gcrsToItrsRotationSettings );
+
+//! Function to compute a hash of the data from which a table of the rotation from ITRS to GCRS is generated.
+/*!
+ *  Function to compute a hash of the data from which a table of the rotation from ITRS to GCRS is generated: the
+ *  contents of the EOP file, the EOP file format, the nutation theory and the settings (including the contents of the
+ *  files) for the short-period UT1 and polar motion corrections.
+ *  \param gcrsToItrsRotationSettings Settings for the GCRS<->ITRS rotation model.
+ *  \return Hash of the data from which the table is generated.
+ */
+std::size_t computeItrsToGcrsRotationTableSourceDataHash(
+        const boost::shared_ptr< GcrsToItrsRotationModelSettings > gcrsToItrsRotationSettings );
+
+//! Function to create (or load) a table of the rotation from ITRS to GCRS.
+/*!
+ *  Function to create a table of the rotation from ITRS to GCRS, from GCRS<->ITRS rotation model settings. If a cache
+ *  file is provided in the table settings, the table is loaded from this file if it exists, and if it was generated
+ *  from the same source data (see computeItrsToGcrsRotationTableSourceDataHash), uses the same time scale, covers the
+ *  requested interval and meets the requested accuracy. Otherwise, the table is generated and saved to the cache file.
+ *  \param gcrsToItrsRotationSettings Settings for the GCRS<->ITRS rotation model (including table settings).
+ *  \return Table of the rotation from ITRS to GCRS.
+ */
+boost::shared_ptr< earth_orientation::ItrsToGcrsRotationTable > createItrsToGcrsRotationTable(
+        const boost::shared_ptr< GcrsToItrsRotationModelSettings > gcrsToItrsRotationSettings );
 #endif
 
 //! Function to create a rotation model.
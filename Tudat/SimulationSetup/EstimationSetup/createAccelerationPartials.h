@@ -26,6 +26,7 @@
 #include "Tudat/Astrodynamics/OrbitDetermination/AccelerationPartials/mutualSphericalHarmonicGravityPartial.h"
 #include "Tudat/Astrodynamics/OrbitDetermination/AccelerationPartials/empiricalAccelerationPartial.h"
 #include "Tudat/Astrodynamics/OrbitDetermination/AccelerationPartials/directTidalDissipationAccelerationPartial.h"
+#include "Tudat/Astrodynamics/OrbitDetermination/AccelerationPartials/automaticDifferentiationAccelerationPartial.h"
 #include "Tudat/Astrodynamics/OrbitDetermination/ObservationPartials/rotationMatrixPartial.h"
 #include "Tudat/SimulationSetup/EstimationSetup/createCartesianStatePartials.h"
 #include "Tudat/Astrodynamics/BasicAstrodynamics/accelerationModelTypes.h"
@@ -367,6 +368,23 @@ boost::shared_ptr< acceleration_partials::AccelerationPartial > createAnalytical
         }
         break;
     }
+    case automatic_differentiation_acceleration:
+    {
+        boost::shared_ptr< AutomaticDifferentiationAcceleration > automaticDifferentiationAcceleration =
+                boost::dynamic_pointer_cast< AutomaticDifferentiationAcceleration >( accelerationModel );
+        if( automaticDifferentiationAcceleration == NULL )
+        {
+            throw std::runtime_error( "Acceleration class type does not match acceleration type (automatic_differentiation_acceleration) when making acceleration partial" );
+        }
+        else
+        {
+            // Create partial-calculating object (state partials only; parameter partials require parameter
+            // identifiers, for which the partial must be created directly).
+            accelerationPartial = boost::make_shared< AutomaticDifferentiationAccelerationPartial >(
+                        automaticDifferentiationAcceleration, acceleratedBody.first, acceleratingBody.first );
+        }
+        break;
+    }
     default:
         std::string errorMessage = "Acceleration model " + std::to_string( accelerationType ) +
                 " not found when making acceleration partial";
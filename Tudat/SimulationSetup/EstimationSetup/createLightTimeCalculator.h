@@ -42,8 +42,8 @@ boost::shared_ptr< ephemerides::Ephemeris > createReferencePointEphemeris(
 
     // Create list of state/rotation functions that are to be used
     std::map< int, boost::function< Eigen::Matrix< StateScalarType, 6, 1 >( const TimeType& ) > > stationEphemerisVector;
-    stationEphemerisVector[ 2 ] = boost::bind( &simulation_setup::Body::getStateInBaseFrameFromEphemeris
-                                               < StateScalarType, TimeType >, bodyWithReferencePoint, _1 );
+    stationEphemerisVector[ 2 ] = simulation_setup::createBodyEphemerisStateFunction< StateScalarType, TimeType >(
+                bodyWithReferencePoint );
     stationEphemerisVector[ 0 ] = referencePointStateFunction;
 
     std::map< int, boost::function< StateType( const TimeType, const StateType& ) > > stationRotationVector;
@@ -97,8 +97,7 @@ boost::function< Eigen::Matrix< StateScalarType, 6, 1 >( const TimeType& ) > get
     {
         // Create function to calculate state of transmitting ground station.
         linkEndCompleteEphemerisFunction =
-                boost::bind( &simulation_setup::Body::getStateInBaseFrameFromEphemeris< StateScalarType, TimeType >,
-                                                        bodyWithLinkEnd, _1 );
+                simulation_setup::createBodyEphemerisStateFunction< StateScalarType, TimeType >( bodyWithLinkEnd );
     }
     return linkEndCompleteEphemerisFunction;
 }
@@ -61,8 +61,8 @@ boost::shared_ptr< LightTimeCorrection > createLightTimeCorrections(
                 {
                     // Set state function.
                     perturbingBodyStateFunctions.push_back(
-                                boost::bind( &simulation_setup::Body::getStateInBaseFrameFromEphemeris< double, double >,
-                                                                         bodyMap.at( perturbingBodies[ i ] ), _1 ) );
+                                simulation_setup::createBodyEphemerisStateFunction< double, double >(
+                                    bodyMap.at( perturbingBodies[ i ] ) ) );
 
                     // Set gravitational parameter function.
                     perturbingBodyGravitationalParameterFunctions.push_back(
@@ -1149,9 +1149,8 @@ public:
             // Create observation model
             observationModel = boost::make_shared< PositionObservationModel<
                     ObservationScalarType, TimeType > >(
-                        boost::bind( &simulation_setup::Body::getStateInBaseFrameFromEphemeris<
-                                     ObservationScalarType, TimeType >,
-                                     bodyMap.at( linkEnds.at( observed_body ).first ), _1 ),
+                        simulation_setup::createBodyEphemerisStateFunction< ObservationScalarType, TimeType >(
+                            bodyMap.at( linkEnds.at( observed_body ).first ) ),
                         observationBias );
 
             break;
@@ -0,0 +1,272 @@
+/*    Copyright (c) 2010-2017, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ */
+
+#ifndef TUDAT_BATCHPROPAGATION_H
+#define TUDAT_BATCHPROPAGATION_H
+
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include <boost/bind.hpp>
+#include <boost/function.hpp>
+#include <boost/make_shared.hpp>
+
+#include <Eigen/Core>
+
+#include "Tudat/Basics/parallelComputation.h"
+#include "Tudat/Mathematics/BasicMathematics/mathematicalConstants.h"
+#include "Tudat/Astrodynamics/Propagators/solutionHistory.h"
+#include "Tudat/SimulationSetup/EnvironmentSetup/body.h"
+#include "Tudat/SimulationSetup/PropagationSetup/dynamicsSimulator.h"
+#include "Tudat/SimulationSetup/PropagationSetup/propagationSettings.h"
+#include "Tudat/SimulationSetup/PropagationSetup/propagationTermination.h"
+
+namespace tudat
+{
+
+namespace propagators
+{
+
+//! Data structure containing the results of a single propagation in a batch propagation
+template< typename StateScalarType = double, typename TimeType = double >
+struct BatchPropagationRunResults
+{
+    //! Constructor, sets termination reason to denote that propagation has not been run, and final time to NaN.
+    BatchPropagationRunResults( ):
+        terminationReason_( propagation_never_run ), finalTime_( TUDAT_NAN ){ }
+
+    //! Event that triggered the termination of the propagation
+    PropagationTerminationReason terminationReason_;
+
+    //! Time at which the propagation was terminated (NaN if no state history was produced)
+    TimeType finalTime_;
+
+    //! State at finalTime_ (in the conventional, i.e. Cartesian for translational dynamics, form; NaN entries if no state
+    //! history was produced)
+    Eigen::Matrix< StateScalarType, Eigen::Dynamic, 1 > finalState_;
+
+    //! History of dependent variables (empty if no dependent variables are saved by the propagator settings)
+    SolutionHistory< TimeType, double > dependentVariableHistory_;
+
+    //! History of propagated states (empty unless requested)
+    SolutionHistory< TimeType, StateScalarType > stateHistory_;
+};
+
+//! Class that performs the propagations of a batch propagation that are assigned to a single thread.
+/*!
+ *  Class that performs the propagations of a batch propagation that are assigned to a single thread. Each object owns
+ *  a full copy of the environment, propagator settings and integrator settings, and a dynamics simulator created from
+ *  these, which is reused for all propagations performed by the thread.
+ */
+template< typename StateScalarType = double, typename TimeType = double >
+class BatchPropagationWorker
+{
+public:
+
+    //! Typedef for state vector
+    typedef Eigen::Matrix< StateScalarType, Eigen::Dynamic, 1 > StateVectorType;
+
+    //! Constructor
+    /*!
+     *  Constructor, creates the environment and settings of this worker and the associated dynamics simulator.
+     *  \param bodyMapCreationFunction Function creating the environment
+     *  \param propagatorSettingsCreationFunction Function creating the propagator settings (including the nominal initial
+     *  state) from the environment
+     *  \param integratorSettingsCreationFunction Function creating the integrator settings
+     */
+    BatchPropagationWorker(
+            const boost::function< simulation_setup::NamedBodyMap( ) >& bodyMapCreationFunction,
+            const boost::function< boost::shared_ptr< SingleArcPropagatorSettings< StateScalarType > >(
+                const simulation_setup::NamedBodyMap& ) >& propagatorSettingsCreationFunction,
+            const boost::function< boost::shared_ptr< numerical_integrators::IntegratorSettings< TimeType > >( ) >&
+            integratorSettingsCreationFunction )
+    {
+        bodyMap_ = bodyMapCreationFunction( );
+        propagatorSettings_ = propagatorSettingsCreationFunction( bodyMap_ );
+        integratorSettings_ = integratorSettingsCreationFunction( );
+        nominalInitialState_ = propagatorSettings_->getInitialStates( );
+
+        dynamicsSimulator_ = boost::make_shared< SingleArcDynamicsSimulator< StateScalarType, TimeType > >(
+                    bodyMap_, integratorSettings_, propagatorSettings_, false, false, false );
+    }
+
+    //! Function to perform a single propagation, with perturbed initial state and environment
+    /*!
+     *  Function to perform a single propagation, with perturbed initial state and environment
+     *  \param runIndex Index of the propagation in the batch
+     *  \param initialStatePerturbation Perturbation that is added to the nominal initial state
+     *  \param environmentPerturbationFunction Function that modifies the environment for a given run index (empty if none)
+     *  \param saveStateHistory Boolean denoting whether the full state history is to be saved
+     *  \param runResults Results of the propagation (returned by reference)
+     */
+    void propagate(
+            const unsigned int runIndex,
+            const StateVectorType& initialStatePerturbation,
+            const boost::function< void( const simulation_setup::NamedBodyMap&, const unsigned int ) >&
+            environmentPerturbationFunction,
+            const bool saveStateHistory,
+            BatchPropagationRunResults< StateScalarType, TimeType >& runResults )
+    {
+        if( !environmentPerturbationFunction.empty( ) )
+        {
+            environmentPerturbationFunction( bodyMap_, runIndex );
+        }
+
+        dynamicsSimulator_->integrateEquationsOfMotion( nominalInitialState_ + initialStatePerturbation );
+
+        // Retrieve results
+        const SolutionHistory< TimeType, StateScalarType >& stateHistory =
+                dynamicsSimulator_->getEquationsOfMotionNumericalSolutionHistory( );
+        runResults.terminationReason_ = dynamicsSimulator_->getPropagationTerminationReason( );
+        if( !stateHistory.empty( ) )
+        {
+            runResults.finalTime_ = stateHistory.getTime( stateHistory.getNumberOfEntries( ) - 1 );
+            runResults.finalState_ = stateHistory.getEntry( stateHistory.getNumberOfEntries( ) - 1 );
+        }
+        else
+        {
+            runResults.finalTime_ = TUDAT_NAN;
+            runResults.finalState_ = StateVectorType::Constant( nominalInitialState_.rows( ), TUDAT_NAN );
+        }
+        runResults.dependentVariableHistory_ = dynamicsSimulator_->getDependentVariableSolutionHistory( );
+        if( saveStateHistory )
+        {
+            runResults.stateHistory_ = stateHistory;
+        }
+    }
+
+    //! Function to retrieve the nominal initial state
+    /*!
+     *  Function to retrieve the nominal initial state, as defined by the propagator settings
+     *  \return Nominal initial state
+     */
+    StateVectorType getNominalInitialState( )
+    {
+        return nominalInitialState_;
+    }
+
+private:
+
+    //! Environment used by this worker
+    simulation_setup::NamedBodyMap bodyMap_;
+
+    //! Propagator settings used by this worker
+    boost::shared_ptr< SingleArcPropagatorSettings< StateScalarType > > propagatorSettings_;
+
+    //! Integrator settings used by this worker
+    boost::shared_ptr< numerical_integrators::IntegratorSettings< TimeType > > integratorSettings_;
+
+    //! Nominal initial state, as defined by the propagator settings
+    StateVectorType nominalInitialState_;
+
+    //! Dynamics simulator used to perform the propagations
+    boost::shared_ptr< SingleArcDynamicsSimulator< StateScalarType, TimeType > > dynamicsSimulator_;
+};
+
+//! Function to perform a single propagation of a batch propagation, on the worker of the given thread
+template< typename StateScalarType, typename TimeType >
+void performBatchPropagationRun(
+        const unsigned int runIndex, const unsigned int threadIndex,
+        const std::vector< boost::shared_ptr< BatchPropagationWorker< StateScalarType, TimeType > > >& workers,
+        const std::vector< Eigen::Matrix< StateScalarType, Eigen::Dynamic, 1 > >& initialStatePerturbations,
+        const boost::function< void( const simulation_setup::NamedBodyMap&, const unsigned int ) >&
+        environmentPerturbationFunction,
+        const bool saveStateHistory,
+        std::vector< BatchPropagationRunResults< StateScalarType, TimeType > >& batchResults )
+{
+    workers.at( threadIndex )->propagate(
+                runIndex, initialStatePerturbations.at( runIndex ), environmentPerturbationFunction, saveStateHistory,
+                batchResults.at( runIndex ) );
+}
+
+//! Function to perform a batch of propagations (e.g. Monte Carlo analysis) with perturbed initial states and environment
+/*!
+ *  Function to perform a batch of propagations (e.g. for a Monte Carlo analysis), each with a perturbed initial state and
+ *  (optionally) a perturbed environment, distributed over a number of threads. The propagations are handed out to the
+ *  threads one at a time, so that propagations with unequal run time are balanced over the threads.
+ *  Since the environment is modified during a propagation, each thread uses its own copy of the environment, propagator
+ *  settings and integrator settings, created by the functions provided here. These copies are created (in the calling
+ *  thread) before the propagations are started, and are reused for all propagations on the same thread. Therefore, the
+ *  environmentPerturbationFunction must fully define the perturbed properties for each run (not modify them w.r.t. their
+ *  current values).
+ *  The results of each propagation are identical to those of a single propagation with the same settings, regardless of
+ *  the number of threads.
+ *  NOTE: The environment models must be safe for concurrent evaluation (i.e. no direct Spice calls during propagation).
+ *  \param bodyMapCreationFunction Function creating the environment (called once per thread)
+ *  \param propagatorSettingsCreationFunction Function creating the propagator settings (including the nominal initial
+ *  state) from the environment (called once per thread)
+ *  \param integratorSettingsCreationFunction Function creating the integrator settings (called once per thread)
+ *  \param initialStatePerturbations List of perturbations that are added to the nominal initial state, one per
+ *  propagation (size of list defines the number of propagations)
+ *  \param environmentPerturbationFunction Function that modifies the environment of a thread for the propagation with
+ *  the given index (second argument), before the propagation is started (no modification if empty)
+ *  \param numberOfThreads Number of threads that are to be used. If equal to 0, the number of concurrent threads
+ *  supported by the hardware is used.
+ *  \param saveStateHistory Boolean denoting whether the full state history of each propagation is to be saved
+ *  \return Results of the propagations, in the same order as initialStatePerturbations
+ */
+template< typename StateScalarType = double, typename TimeType = double >
+std::vector< BatchPropagationRunResults< StateScalarType, TimeType > > propagateBatch(
+        const boost::function< simulation_setup::NamedBodyMap( ) >& bodyMapCreationFunction,
+        const boost::function< boost::shared_ptr< SingleArcPropagatorSettings< StateScalarType > >(
+            const simulation_setup::NamedBodyMap& ) >& propagatorSettingsCreationFunction,
+        const boost::function< boost::shared_ptr< numerical_integrators::IntegratorSettings< TimeType > >( ) >&
+        integratorSettingsCreationFunction,
+        const std::vector< Eigen::Matrix< StateScalarType, Eigen::Dynamic, 1 > >& initialStatePerturbations,
+        const boost::function< void( const simulation_setup::NamedBodyMap&, const unsigned int ) >&
+        environmentPerturbationFunction =
+        boost::function< void( const simulation_setup::NamedBodyMap&, const unsigned int ) >( ),
+        const unsigned int numberOfThreads = 0,
+        const bool saveStateHistory = false )
+{
+    unsigned int numberOfRuns = initialStatePerturbations.size( );
+    std::vector< BatchPropagationRunResults< StateScalarType, TimeType > > batchResults( numberOfRuns );
+    if( numberOfRuns == 0 )
+    {
+        return batchResults;
+    }
+
+    // Create environment and settings for each thread
+    unsigned int numberOfThreadsToUse = utilities::getNumberOfThreadsForParallelLoop( numberOfRuns, numberOfThreads );
+    std::vector< boost::shared_ptr< BatchPropagationWorker< StateScalarType, TimeType > > > workers;
+    for( unsigned int i = 0; i < numberOfThreadsToUse; i++ )
+    {
+        workers.push_back( boost::make_shared< BatchPropagationWorker< StateScalarType, TimeType > >(
+                               bodyMapCreationFunction, propagatorSettingsCreationFunction,
+                               integratorSettingsCreationFunction ) );
+    }
+
+    // Check input consistency
+    for( unsigned int i = 0; i < numberOfRuns; i++ )
+    {
+        if( initialStatePerturbations.at( i ).rows( ) != workers.at( 0 )->getNominalInitialState( ).rows( ) )
+        {
+            throw std::runtime_error( "Error in batch propagation, size of initial state perturbation " +
+                                      std::to_string( i ) + " is inconsistent with propagator settings" );
+        }
+    }
+
+    // Perform propagations
+    utilities::executeParallelLoopWithThreadIndex(
+                numberOfRuns, numberOfThreadsToUse,
+                boost::bind( &performBatchPropagationRun< StateScalarType, TimeType >, _1, _2,
+                             boost::cref( workers ), boost::cref( initialStatePerturbations ),
+                             boost::cref( environmentPerturbationFunction ), saveStateHistory,
+                             boost::ref( batchResults ) ) );
+
+    return batchResults;
+}
+
+} // namespace propagators
+
+} // namespace tudat
+
+#endif // TUDAT_BATCHPROPAGATION_H
@@ -23,6 +23,7 @@
 #include "Tudat/Mathematics/NumericalIntegrators/rungeKuttaCoefficients.h"
 #include "Tudat/Mathematics/Interpolators/cubicSplineInterpolator.h"
 #include "Tudat/Basics/utilities.h"
+#include "Tudat/Basics/parallelComputation.h"
 #include "Tudat/Astrodynamics/Propagators/nBodyStateDerivative.h"
 #include "Tudat/Astrodynamics/Ephemerides/frameManager.h"
 #include "Tudat/Mathematics/NumericalIntegrators/createNumericalIntegrator.h"
@@ -33,6 +34,7 @@
 #include "Tudat/SimulationSetup/PropagationSetup/propagationSettings.h"
 #include "Tudat/SimulationSetup/PropagationSetup/setNumericallyIntegratedStates.h"
 #include "Tudat/Astrodynamics/Propagators/integrateEquations.h"
+#include "Tudat/Astrodynamics/Propagators/solutionHistory.h"
 #include "Tudat/SimulationSetup/PropagationSetup/createStateDerivativeModel.h"
 #include "Tudat/SimulationSetup/PropagationSetup/createEnvironmentUpdater.h"
 #include "Tudat/SimulationSetup/PropagationSetup/propagationTermination.h"
@@ -333,6 +335,9 @@ public:
         integratorSettings_( integratorSettings ),
         propagatorSettings_(
             boost::dynamic_pointer_cast< SingleArcPropagatorSettings< StateScalarType > >( propagatorSettings ) ),
+        isOutputSinkInitialized_( false ),
+        isEquationsOfMotionNumericalSolutionMapSet_( false ), isDependentVariableHistoryMapSet_( false ),
+        isCummulativeComputationTimeHistoryMapSet_( false ),
         initialPropagationTime_( integratorSettings_->initialTime_ ), initialClockTime_( initialClockTime ),
         propagationTerminationReason_( propagation_never_run )
     {
@@ -418,25 +423,98 @@ public:
 
         equationsOfMotionNumericalSolution_.clear( );
         equationsOfMotionNumericalSolutionRaw_.clear( );
+        resetSolutionHistoryMaps( );
 
         dynamicsStateDerivative_->setPropagationSettings( std::vector< IntegratedStateType >( ), 1, 0 );
 
         // Reset initial time to ensure consistency with multi-arc propagation.
         integratorSettings_->initialTime_ = this->initialPropagationTime_;
 
-        // Integrate equations of motion numerically.
-        propagationTerminationReason_ =
-                EquationIntegrationInterface< Eigen::Matrix< StateScalarType, Eigen::Dynamic, 1 >, TimeType >::integrateEquations(
-                    stateDerivativeFunction_, equationsOfMotionNumericalSolutionRaw_,
-                    dynamicsStateDerivative_->convertFromOutputSolution(
-                        initialStates, this->initialPropagationTime_ ), integratorSettings_,
-                    boost::bind( &PropagationTerminationCondition::checkStopCondition,
-                                 propagationTerminationCondition_, _1, _2 ),
-                    dependentVariableHistory_,
-                    cummulativeComputationTimeHistory_,
-                    dependentVariablesFunctions_,
-                    propagatorSettings_->getPrintInterval( ),
-                    initialClockTime_ );
+        Eigen::Matrix< StateScalarType, Eigen::Dynamic, 1 > initialPropagatedStates =
+                dynamicsStateDerivative_->convertFromOutputSolution( initialStates, this->initialPropagationTime_ );
+
+        // Set function passing output at each saved epoch to output sink (if any).
+        boost::shared_ptr< PropagationOutputSink< StateScalarType > > outputSink =
+                propagatorSettings_->getOutputSink( );
+        const bool saveSolutionHistory = propagatorSettings_->getSaveSolutionHistory( );
+        if( !saveSolutionHistory && this->setIntegratedResult_ )
+        {
+            throw std::runtime_error( "Error in dynamics simulator, integrated result cannot be set if solution "
+                                      "history is not saved" );
+        }
+        isOutputSinkInitialized_ = false;
+
+        // Integrate equations of motion numerically. For the translational dynamics of a single body (with a 6-dimensional
+        // propagated state, i.e. not for the USM propagators), the numerical integration is performed on fixed-size state
+        // vectors. In both cases, the state derivative is computed in place by integrators that support this.
+        boost::shared_ptr< TranslationalStatePropagatorSettings< StateScalarType > > translationalPropagatorSettings =
+                boost::dynamic_pointer_cast< TranslationalStatePropagatorSettings< StateScalarType > >(
+                    propagatorSettings_ );
+        if( translationalPropagatorSettings != NULL && translationalPropagatorSettings->bodiesToIntegrate_.size( ) == 1 &&
+                initialPropagatedStates.rows( ) == 6 )
+        {
+            boost::function< void( const TimeType, const Eigen::Matrix< StateScalarType, 6, 1 >&,
+                                   const Eigen::VectorXd& ) > savedStepFunction;
+            if( outputSink != NULL )
+            {
+                savedStepFunction = boost::bind(
+                            &SingleArcDynamicsSimulator< StateScalarType, TimeType >::template
+                            processSavedStepOutput< Eigen::Matrix< StateScalarType, 6, 1 > >, this, _1, _2, _3 );
+            }
+
+            propagationTerminationReason_ =
+                    EquationIntegrationInterface< Eigen::Matrix< StateScalarType, 6, 1 >, TimeType >::integrateEquations(
+                        boost::bind( &DynamicsStateDerivativeModel< TimeType, StateScalarType >::template
+                                     computeFixedSizeStateDerivative< 6 >, dynamicsStateDerivative_, _1, _2 ),
+                        equationsOfMotionNumericalSolutionRaw_,
+                        Eigen::Matrix< StateScalarType, 6, 1 >( initialPropagatedStates ), integratorSettings_,
+                        boost::bind( &PropagationTerminationCondition::checkStopCondition,
+                                     propagationTerminationCondition_, _1, _2 ),
+                        dependentVariableHistory_,
+                        cummulativeComputationTimeHistory_,
+                        dependentVariablesFunctions_,
+                        propagatorSettings_->getPrintInterval( ),
+                        initialClockTime_,
+                        savedStepFunction,
+                        saveSolutionHistory,
+                        boost::bind( &DynamicsStateDerivativeModel< TimeType, StateScalarType >::template
+                                     computeStateVectorDerivativeInPlace< 6 >, dynamicsStateDerivative_, _1, _2, _3 ) );
+        }
+        else
+        {
+            boost::function< void( const TimeType, const Eigen::Matrix< StateScalarType, Eigen::Dynamic, 1 >&,
+                                   const Eigen::VectorXd& ) > savedStepFunction;
+            if( outputSink != NULL )
+            {
+                savedStepFunction = boost::bind(
+                            &SingleArcDynamicsSimulator< StateScalarType, TimeType >::template
+                            processSavedStepOutput< Eigen::Matrix< StateScalarType, Eigen::Dynamic, 1 > >,
+                            this, _1, _2, _3 );
+            }
+
+            propagationTerminationReason_ =
+                    EquationIntegrationInterface< Eigen::Matrix< StateScalarType, Eigen::Dynamic, 1 >, TimeType >::integrateEquations(
+                        stateDerivativeFunction_, equationsOfMotionNumericalSolutionRaw_,
+                        initialPropagatedStates, integratorSettings_,
+                        boost::bind( &PropagationTerminationCondition::checkStopCondition,
+                                     propagationTerminationCondition_, _1, _2 ),
+                        dependentVariableHistory_,
+                        cummulativeComputationTimeHistory_,
+                        dependentVariablesFunctions_,
+                        propagatorSettings_->getPrintInterval( ),
+                        initialClockTime_,
+                        savedStepFunction,
+                        saveSolutionHistory,
+                        boost::bind( &DynamicsStateDerivativeModel< TimeType, StateScalarType >::template
+                                     computeStateVectorDerivativeInPlace< Eigen::Dynamic >, dynamicsStateDerivative_,
+                                     _1, _2, _3 ) );
+        }
+
+        if( outputSink != NULL && isOutputSinkInitialized_ )
+        {
+            outputSink->finalize( );
+        }
+
         dynamicsStateDerivative_->convertNumericalStateSolutionsToOutputSolutions(
                     equationsOfMotionNumericalSolution_, equationsOfMotionNumericalSolutionRaw_ );
 
@@ -451,9 +529,15 @@ public:
      * Function to return the map of state history of numerically integrated bodies.
      * \return Map of state history of numerically integrated bodies.
      */
-    std::map< TimeType, Eigen::Matrix< StateScalarType, Eigen::Dynamic, 1 > > getEquationsOfMotionNumericalSolution( )
+    const std::map< TimeType, Eigen::Matrix< StateScalarType, Eigen::Dynamic, 1 > >&
+    getEquationsOfMotionNumericalSolution( )
     {
-        return equationsOfMotionNumericalSolution_;
+        if( !isEquationsOfMotionNumericalSolutionMapSet_ )
+        {
+            equationsOfMotionNumericalSolution_.convertToMap( equationsOfMotionNumericalSolutionMap_ );
+            isEquationsOfMotionNumericalSolutionMapSet_ = true;
+        }
+        return equationsOfMotionNumericalSolutionMap_;
     }
 
     //! Function to return the map of dependent variable history that was saved during numerical propagation.
@@ -461,9 +545,14 @@ public:
      * Function to return the map of dependent variable history that was saved during numerical propagation.
      * \return Map of dependent variable history that was saved during numerical propagation.
      */
-    std::map< TimeType, Eigen::VectorXd > getDependentVariableHistory( )
+    const std::map< TimeType, Eigen::VectorXd >& getDependentVariableHistory( )
     {
-        return dependentVariableHistory_;
+        if( !isDependentVariableHistoryMapSet_ )
+        {
+            dependentVariableHistory_.convertToMap( dependentVariableHistoryMap_ );
+            isDependentVariableHistoryMapSet_ = true;
+        }
+        return dependentVariableHistoryMap_;
     }
 
     //! Function to return the map of cummulative computation time history that was saved during numerical propagation.
@@ -471,7 +560,45 @@ public:
      * Function to return the map of cummulative computation time history that was saved during numerical propagation.
      * \return Map of cummulative computation time history that was saved during numerical propagation.
      */
-    std::map< TimeType, double > getCummulativeComputationTimeHistory( )
+    const std::map< TimeType, double >& getCummulativeComputationTimeHistory( )
+    {
+        if( !isCummulativeComputationTimeHistoryMapSet_ )
+        {
+            cummulativeComputationTimeHistory_.convertToMap( cummulativeComputationTimeHistoryMap_ );
+            isCummulativeComputationTimeHistoryMapSet_ = true;
+        }
+        return cummulativeComputationTimeHistoryMap_;
+    }
+
+    //! Function to return the state history of numerically integrated bodies, stored in contiguous memory.
+    /*!
+     * Function to return the state history of numerically integrated bodies, stored in contiguous memory (no copy of
+     * the data is made).
+     * \return State history of numerically integrated bodies.
+     */
+    const SolutionHistory< TimeType, StateScalarType >& getEquationsOfMotionNumericalSolutionHistory( )
+    {
+        return equationsOfMotionNumericalSolution_;
+    }
+
+    //! Function to return the dependent variable history that was saved during numerical propagation, stored in contiguous memory.
+    /*!
+     * Function to return the dependent variable history that was saved during numerical propagation, stored in contiguous
+     * memory (no copy of the data is made).
+     * \return Dependent variable history that was saved during numerical propagation.
+     */
+    const SolutionHistory< TimeType, double >& getDependentVariableSolutionHistory( )
+    {
+        return dependentVariableHistory_;
+    }
+
+    //! Function to return the cummulative computation time history, stored in contiguous memory.
+    /*!
+     * Function to return the cummulative computation time history that was saved during numerical propagation, stored in
+     * contiguous memory (no copy of the data is made).
+     * \return Cummulative computation time history that was saved during numerical propagation.
+     */
+    const SolutionHistory< TimeType, double >& getCummulativeComputationTimeSolutionHistory( )
     {
         return cummulativeComputationTimeHistory_;
     }
@@ -516,8 +643,9 @@ public:
             equationsOfMotionNumericalSolution,
             const std::map< TimeType, Eigen::VectorXd >& dependentVariableHistory)
     {
-        equationsOfMotionNumericalSolution_ = equationsOfMotionNumericalSolution;
-        dependentVariableHistory_ = dependentVariableHistory;
+        equationsOfMotionNumericalSolution_.resetFromMap( equationsOfMotionNumericalSolution );
+        dependentVariableHistory_.resetFromMap( dependentVariableHistory );
+        resetSolutionHistoryMaps( );
         processNumericalEquationsOfMotionSolution( );
     }
 
@@ -665,6 +793,29 @@ public:
 
 protected:
 
+    //! Function to pass the output at a single saved epoch to the output sink of the propagator settings.
+    /*!
+     *  Function to pass the output at a single saved epoch to the output sink of the propagator settings, called
+     *  during the numerical integration. The state is converted to the conventional form before being passed to the
+     *  sink, which is initialized when this function is first called in a propagation.
+     *  \param time Epoch at which the output is valid.
+     *  \param rawState State at the given epoch, in the propagator-specific form.
+     *  \param dependentVariables Dependent variables at the given epoch.
+     */
+    template< typename StateType >
+    void processSavedStepOutput( const TimeType time, const StateType& rawState,
+                                 const Eigen::VectorXd& dependentVariables )
+    {
+        currentOutputState_ = dynamicsStateDerivative_->convertToOutputSolution( rawState, time );
+        if( !isOutputSinkInitialized_ )
+        {
+            propagatorSettings_->getOutputSink( )->initialize(
+                        currentOutputState_.rows( ), dependentVariables.rows( ), dependentVariableIds_ );
+            isOutputSinkInitialized_ = true;
+        }
+        propagatorSettings_->getOutputSink( )->processOutput(
+                    static_cast< double >( time ), currentOutputState_, dependentVariables );
+    }
 
     //! This function updates the environment with the numerical solution of the propagation.
     /*!
@@ -682,6 +833,7 @@ protected:
         if( clearNumericalSolutions_ )
         {
             equationsOfMotionNumericalSolution_.clear( );
+            resetSolutionHistoryMaps( );
         }
 
         for( simulation_setup::NamedBodyMap::const_iterator
@@ -692,6 +844,21 @@ protected:
         }
     }
 
+    //! Function to clear the map representations of the solution histories.
+    /*!
+     *  Function to clear the map representations of the solution histories, so that they are regenerated from the
+     *  contiguous histories when next requested.
+     */
+    void resetSolutionHistoryMaps( )
+    {
+        equationsOfMotionNumericalSolutionMap_.clear( );
+        dependentVariableHistoryMap_.clear( );
+        cummulativeComputationTimeHistoryMap_.clear( );
+        isEquationsOfMotionNumericalSolutionMapSet_ = false;
+        isDependentVariableHistoryMapSet_ = false;
+        isCummulativeComputationTimeHistoryMapSet_ = false;
+    }
+
 
     //! List of object (per dynamics type) that process the integrated numerical solution by updating the environment
     std::map< IntegratedStateType, std::vector< boost::shared_ptr<
@@ -744,22 +911,49 @@ protected:
     //! Object for retrieving ephemerides for transformation of reference frame (origins)
     boost::shared_ptr< ephemerides::ReferenceFrameManager > frameManager_;
 
-    //! Map of state history of numerically integrated bodies.
+    //! State history of numerically integrated bodies.
     /*!
-     *  Map of state history of numerically integrated bodies, i.e. the result of the numerical integration, transformed
-     *  into the 'conventional form' (\sa SingleStateTypeDerivative::convertToOutputSolution). Key of map denotes time,
-     *  values are concatenated vectors of integrated body states (order defined by propagatorSettings_).
-     *  NOTE: this map is empty if clearNumericalSolutions_ is set to true.
+     *  State history of numerically integrated bodies, i.e. the result of the numerical integration, transformed
+     *  into the 'conventional form' (\sa SingleStateTypeDerivative::convertToOutputSolution). Each entry
+     *  is a concatenated vector of integrated body states (order defined by propagatorSettings_).
+     *  NOTE: this history is empty if clearNumericalSolutions_ is set to true.
      */
-    std::map< TimeType, Eigen::Matrix< StateScalarType, Eigen::Dynamic, 1 > > equationsOfMotionNumericalSolution_;
+    SolutionHistory< TimeType, StateScalarType > equationsOfMotionNumericalSolution_;
 
-    std::map< TimeType, Eigen::Matrix< StateScalarType, Eigen::Dynamic, 1 > > equationsOfMotionNumericalSolutionRaw_;
+    //! State history of numerically integrated bodies, in the propagator-specific form (i.e. as produced by the integrator)
+    SolutionHistory< TimeType, StateScalarType > equationsOfMotionNumericalSolutionRaw_;
 
-    //! Map of dependent variable history that was saved during numerical propagation.
-    std::map< TimeType, Eigen::VectorXd > dependentVariableHistory_;
+    //! Dependent variable history that was saved during numerical propagation.
+    SolutionHistory< TimeType, double > dependentVariableHistory_;
 
-    //! Map of cummulative computation time history that was saved during numerical propagation.
-    std::map< TimeType, double > cummulativeComputationTimeHistory_;
+    //! Cummulative computation time history that was saved during numerical propagation.
+    SolutionHistory< TimeType, double > cummulativeComputationTimeHistory_;
+
+    //! Boolean denoting whether the output sink has been initialized for the current propagation.
+    bool isOutputSinkInitialized_;
+
+    //! State history of numerically integrated bodies, as map (created from equationsOfMotionNumericalSolution_ when
+    //! first requested).
+    std::map< TimeType, Eigen::Matrix< StateScalarType, Eigen::Dynamic, 1 > > equationsOfMotionNumericalSolutionMap_;
+
+    //! Dependent variable history, as map (created from dependentVariableHistory_ when first requested).
+    std::map< TimeType, Eigen::VectorXd > dependentVariableHistoryMap_;
+
+    //! Cummulative computation time history, as map (created from cummulativeComputationTimeHistory_ when first
+    //! requested).
+    std::map< TimeType, double > cummulativeComputationTimeHistoryMap_;
+
+    //! Boolean denoting whether equationsOfMotionNumericalSolutionMap_ is up to date.
+    bool isEquationsOfMotionNumericalSolutionMapSet_;
+
+    //! Boolean denoting whether dependentVariableHistoryMap_ is up to date.
+    bool isDependentVariableHistoryMapSet_;
+
+    //! Boolean denoting whether cummulativeComputationTimeHistoryMap_ is up to date.
+    bool isCummulativeComputationTimeHistoryMapSet_;
+
+    //! State (in conventional form) at the current saved epoch, as passed to the output sink.
+    Eigen::Matrix< StateScalarType, Eigen::Dynamic, 1 > currentOutputState_;
 
     //! Initial time of propagation
     double initialPropagationTime_;
@@ -918,6 +1112,7 @@ public:
                                 bodyMap, integratorSettings, singleArcSettings.at( i ), false, false, true ) );
                 singleArcDynamicsSimulators_[ i ]->resetSetIntegratedResult( false );
             }
+            integratedStateProcessors_ = singleArcDynamicsSimulators_.at( 0 )->getIntegratedStateProcessors( );
 
             equationsOfMotionNumericalSolution_.resize( arcStartTimes.size( ) );
             dependentVariableHistory_.resize( arcStartTimes.size( ) );
@@ -981,6 +1176,108 @@ public:
                                 bodyMap, integratorSettings.at( i ), singleArcSettings.at( i ), false, false, true ) );
                 singleArcDynamicsSimulators_[ i ]->resetSetIntegratedResult( false );
             }
+            integratedStateProcessors_ = singleArcDynamicsSimulators_.at( 0 )->getIntegratedStateProcessors( );
+
+            equationsOfMotionNumericalSolution_.resize( singleArcSettings.size( ) );
+            dependentVariableHistory_.resize( singleArcSettings.size( ) );
+            cummulativeComputationTimeHistory_.resize( singleArcSettings.size( ) );
+            propagationTerminationReasons_.resize( singleArcSettings.size( ) );
+
+            // Integrate equations of motion if required.
+            if( areEquationsOfMotionToBeIntegrated )
+            {
+                integrateEquationsOfMotion( multiArcPropagatorSettings_->getInitialStates( ) );
+            }
+        }
+    }
+
+    //! Constructor of multi-arc simulator, with arcs that are propagated in parallel.
+    /*!
+     *  Constructor of multi-arc simulator, with arcs that are propagated in parallel. Each arc is propagated using its own
+     *  body map, so that the environment models that are updated during the propagation are not shared between threads.
+     *  Arcs for which the initial state is not provided (i.e. set to NaN, so that it is to be taken from the result of the
+     *  previous arc) are propagated in the same thread as the previous arc, after the previous arc has been propagated. The
+     *  results of the propagation are used to reset the environment of the bodyMap input (if setIntegratedResult is true).
+     *  NOTE: All environment models of the arc body maps (in particular ephemerides of bodies that are not propagated) must
+     *  be safe to evaluate concurrently from multiple threads. This is NOT the case for models that directly call
+     *  Spice (which is not thread-safe): tabulated versions of these models must be used when more than one thread is used.
+     *  \param bodyMap Map of bodies (with names) for which the ephemerides are reset using the propagated dynamics.
+     *  \param arcBodyMaps List of maps of bodies (with names) of all bodies in integration, one per arc. The body maps must
+     *  not share any Body objects between arcs, and the acceleration models in the propagatorSettings of each arc must be
+     *  created using the body map of that arc.
+     *  \param integratorSettings List of integrator settings for numerical integrator, defined per arc (each arc must have
+     *  its own settings object).
+     *  \param propagatorSettings Propagator settings for dynamics (must be of multi arc type)
+     *  \param numberOfThreads Number of threads that are to be used for the propagation. If equal to 0, the number of
+     *  concurrent threads supported by the hardware is used.
+     *  \param areEquationsOfMotionToBeIntegrated Boolean to denote whether equations of motion should be integrated at
+     *  the end of the contructor or not.
+     *  \param clearNumericalSolutions Boolean to determine whether to clear the raw numerical solution member variables
+     *  after propagation and resetting ephemerides (default true).
+     *  \param setIntegratedResult Boolean to determine whether to automatically use the integrated results to set
+     *  ephemerides (default true).
+     */
+    MultiArcDynamicsSimulator(
+            const simulation_setup::NamedBodyMap& bodyMap,
+            const std::vector< simulation_setup::NamedBodyMap >& arcBodyMaps,
+            const std::vector< boost::shared_ptr< numerical_integrators::IntegratorSettings< TimeType > > > integratorSettings,
+            const boost::shared_ptr< PropagatorSettings< StateScalarType > > propagatorSettings,
+            const unsigned int numberOfThreads,
+            const bool areEquationsOfMotionToBeIntegrated = true,
+            const bool clearNumericalSolutions = true,
+            const bool setIntegratedResult = true ):
+        DynamicsSimulator< StateScalarType, TimeType >(
+            bodyMap, clearNumericalSolutions, setIntegratedResult ), numberOfThreads_( numberOfThreads )
+    {
+        multiArcPropagatorSettings_ =
+                boost::dynamic_pointer_cast< MultiArcPropagatorSettings< StateScalarType > >( propagatorSettings );
+        if( multiArcPropagatorSettings_ == NULL )
+        {
+            throw std::runtime_error( "Error when creating multi-arc dynamics simulator, input is not multi arc" );
+        }
+        else
+        {
+            std::vector< boost::shared_ptr< SingleArcPropagatorSettings< StateScalarType > > > singleArcSettings =
+                    multiArcPropagatorSettings_->getSingleArcSettings( );
+
+            if( ( singleArcSettings.size( ) != integratorSettings.size( ) ) ||
+                    ( singleArcSettings.size( ) != arcBodyMaps.size( ) ) )
+            {
+                throw std::runtime_error( "Error when creating multi-arc dynamics simulator, input sizes are inconsistent" );
+            }
+
+            // Integrator settings are modified during propagation, and may therefore not be shared between arcs.
+            for( unsigned int i = 0; i < integratorSettings.size( ); i++ )
+            {
+                for( unsigned int j = 0; j < i; j++ )
+                {
+                    if( integratorSettings.at( i ) == integratorSettings.at( j ) )
+                    {
+                        throw std::runtime_error(
+                                    "Error when creating parallel multi-arc dynamics simulator, integrator settings of arcs " +
+                                    std::to_string( j ) + " and " + std::to_string( i ) + " are the same object" );
+                    }
+                }
+            }
+
+            arcStartTimes_.resize( singleArcSettings.size( ) );
+
+            // Create dynamics simulators, each using its own environment
+            for( unsigned int i = 0; i < singleArcSettings.size( ); i++ )
+            {
+                singleArcDynamicsSimulators_.push_back(
+                            boost::make_shared< SingleArcDynamicsSimulator< StateScalarType, TimeType > >(
+                                arcBodyMaps.at( i ), integratorSettings.at( i ), singleArcSettings.at( i ),
+                                false, false, true ) );
+                singleArcDynamicsSimulators_[ i ]->resetSetIntegratedResult( false );
+            }
+
+            // Create objects to set propagated results in the environment defined by bodyMap
+            if( singleArcSettings.size( ) > 0 )
+            {
+                integratedStateProcessors_ = createIntegratedStateProcessors< TimeType, StateScalarType >(
+                            singleArcSettings.at( 0 ), bodyMap_, createFrameManager( bodyMap_ ) );
+            }
 
             equationsOfMotionNumericalSolution_.resize( singleArcSettings.size( ) );
             dependentVariableHistory_.resize( singleArcSettings.size( ) );
@@ -1057,42 +1354,38 @@ public:
         }
 
 
-        Eigen::Matrix< StateScalarType, Eigen::Dynamic, 1 > currentArcInitialState;
-        std::vector< Eigen::Matrix< StateScalarType, Eigen::Dynamic, 1 > > arcInitialStateList;
-        bool updateInitialStates = false;
+        if( initialStatesList.size( ) != singleArcDynamicsSimulators_.size( ) )
+        {
+            throw std::runtime_error( "Error when doing multi-arc integration, number of initial states is incompatible with settings" );
+        }
 
-        // Propagate dynamics for each arc
+        // Determine sequences of arcs that are to be propagated in order. A new sequence is started for each arc with an
+        // explicitly defined initial state. If initial state is NaN, this signals that the initial state is to be taken from
+        // previous arc, so that the arc must be propagated after (and in the same sequence as) the previous arc.
+        std::vector< unsigned int > arcSequenceStartIndices;
+        bool updateInitialStates = false;
         for( unsigned int i = 0; i < singleArcDynamicsSimulators_.size( ); i++ )
         {
-            // Get arc initial state. If initial state is NaN, this signals that the initial state is to be taken from previous
-            // arc
             if( ( i == 0 ) || ( !linear_algebra::doesMatrixHaveNanEntries( initialStatesList.at( i ) ) ) )
             {
-                currentArcInitialState = initialStatesList.at( i );
+                arcSequenceStartIndices.push_back( i );
             }
             else
             {
-                currentArcInitialState = getArcInitialStateFromPreviousArcResult(
-                            equationsOfMotionNumericalSolution_.at( i - 1 ),
-                            singleArcDynamicsSimulators_.at( i )->getInitialPropagationTime( ) );
-
                 // If arc initial state is taken from previous arc, this indicates that the initial states in propagator settings
                 // need to be updated.
                 updateInitialStates = true;
             }
-            arcInitialStateList.push_back( currentArcInitialState );
-
-            singleArcDynamicsSimulators_.at( i )->integrateEquationsOfMotion( currentArcInitialState );
-            equationsOfMotionNumericalSolution_[ i ] =
-                    singleArcDynamicsSimulators_.at( i )->getEquationsOfMotionNumericalSolution( );
-            dependentVariableHistory_[ i ] =
-                    singleArcDynamicsSimulators_.at( i )->getDependentVariableHistory( );
-            cummulativeComputationTimeHistory_[ i ] =
-                    singleArcDynamicsSimulators_.at( i )->getCummulativeComputationTimeHistory( );
-            propagationTerminationReasons_[ i ] = singleArcDynamicsSimulators_.at( i )->getPropagationTerminationReason( );
-            arcStartTimes_[ i ] = equationsOfMotionNumericalSolution_[ i ].begin( )->first;
         }
 
+        // Propagate dynamics for each sequence of arcs (independent sequences are propagated in parallel, if so requested)
+        std::vector< Eigen::Matrix< StateScalarType, Eigen::Dynamic, 1 > > arcInitialStateList;
+        arcInitialStateList.resize( singleArcDynamicsSimulators_.size( ) );
+        utilities::executeParallelLoop(
+                    arcSequenceStartIndices.size( ), numberOfThreads_,
+                    boost::bind( &MultiArcDynamicsSimulator< StateScalarType, TimeType >::integrateArcSequence, this, _1,
+                                 boost::cref( arcSequenceStartIndices ), boost::cref( initialStatesList ),
+                                 boost::ref( arcInitialStateList ) ) );
 
         if( updateInitialStates )
         {
@@ -1257,6 +1550,52 @@ public:
 
 protected:
 
+    //! Function to numerically integrate the equations of motion of a single sequence of arcs
+    /*!
+     *  Function to numerically integrate the equations of motion of a single sequence of arcs. The first arc in the sequence
+     *  is propagated from the state provided in initialStatesList, the initial states of subsequent arcs in the sequence are
+     *  taken from the propagation results of the previous arc. Only the results of the arcs in the given sequence are
+     *  modified, so that different sequences may be integrated concurrently.
+     *  \param sequenceIndex Index of sequence of arcs that is to be integrated
+     *  \param arcSequenceStartIndices Indices of the first arc in each sequence of arcs
+     *  \param initialStatesList Initial states of all arcs (only those of the first arc in each sequence are used)
+     *  \param arcInitialStateList Initial states of all arcs that are used for the propagation (modified by this function)
+     */
+    void integrateArcSequence(
+            const unsigned int sequenceIndex,
+            const std::vector< unsigned int >& arcSequenceStartIndices,
+            const std::vector< Eigen::Matrix< StateScalarType, Eigen::Dynamic, 1 > >& initialStatesList,
+            std::vector< Eigen::Matrix< StateScalarType, Eigen::Dynamic, 1 > >& arcInitialStateList )
+    {
+        unsigned int firstArcIndex = arcSequenceStartIndices.at( sequenceIndex );
+        unsigned int lastArcIndex = ( sequenceIndex == arcSequenceStartIndices.size( ) - 1 ) ?
+                    singleArcDynamicsSimulators_.size( ) : arcSequenceStartIndices.at( sequenceIndex + 1 );
+
+        for( unsigned int i = firstArcIndex; i < lastArcIndex; i++ )
+        {
+            if( i == firstArcIndex )
+            {
+                arcInitialStateList[ i ] = initialStatesList.at( i );
+            }
+            else
+            {
+                arcInitialStateList[ i ] = getArcInitialStateFromPreviousArcResult(
+                            equationsOfMotionNumericalSolution_.at( i - 1 ),
+                            singleArcDynamicsSimulators_.at( i )->getInitialPropagationTime( ) );
+            }
+
+            singleArcDynamicsSimulators_.at( i )->integrateEquationsOfMotion( arcInitialStateList[ i ] );
+            equationsOfMotionNumericalSolution_[ i ] =
+                    singleArcDynamicsSimulators_.at( i )->getEquationsOfMotionNumericalSolution( );
+            dependentVariableHistory_[ i ] =
+                    singleArcDynamicsSimulators_.at( i )->getDependentVariableHistory( );
+            cummulativeComputationTimeHistory_[ i ] =
+                    singleArcDynamicsSimulators_.at( i )->getCummulativeComputationTimeHistory( );
+            propagationTerminationReasons_[ i ] = singleArcDynamicsSimulators_.at( i )->getPropagationTerminationReason( );
+            arcStartTimes_[ i ] = equationsOfMotionNumericalSolution_[ i ].begin( )->first;
+        }
+    }
+
     //! This function updates the environment with the numerical solution of the propagation.
     /*!
      *  This function updates the environment with the numerical solution of the propagation. It sets
@@ -1266,8 +1605,7 @@ protected:
     void processNumericalEquationsOfMotionSolution( )
     {
         resetIntegratedMultiArcStatesWithEqualArcDynamics(
-                    equationsOfMotionNumericalSolution_,
-                    singleArcDynamicsSimulators_.at( 0 )->getIntegratedStateProcessors( ), arcStartTimes_ );
+                    equationsOfMotionNumericalSolution_, integratedStateProcessors_, arcStartTimes_ );
 
         if( clearNumericalSolutions_ )
         {
@@ -1303,6 +1641,12 @@ protected:
     //! Propagator settings used by this objec
     boost::shared_ptr< MultiArcPropagatorSettings< StateScalarType > > multiArcPropagatorSettings_;
 
+    //! List of object (per dynamics type) that process the integrated numerical solution by updating the environment
+    std::map< IntegratedStateType, std::vector< boost::shared_ptr<
+    IntegratedStateProcessor< TimeType, StateScalarType > > > > integratedStateProcessors_;
+
+    //! Number of threads used to propagate independent arcs (1 unless arcs are propagated in separate environments).
+    unsigned int numberOfThreads_ = 1;
 
 };
 
@@ -157,7 +157,7 @@ private:
             }
             case rotational_state:
             {
-                std::vector< std::pair< std::string, std::string > > bodiesWithIntegratedStates =
+                const std::vector< std::pair< std::string, std::string > >& bodiesWithIntegratedStates =
                         integratedStates_.at( rotational_state );
                 for( unsigned int i = 0; i < bodiesWithIntegratedStates.size( ); i++ )
                 {
@@ -169,7 +169,7 @@ private:
             case body_mass_state:
             {
                 // Set mass for bodies provided as input.
-                std::vector< std::pair< std::string, std::string > > bodiesWithIntegratedMass =
+                const std::vector< std::pair< std::string, std::string > >& bodiesWithIntegratedMass =
                         integratedStates_.at( body_mass_state );
 
                 for( unsigned int i = 0; i < bodiesWithIntegratedMass.size( ); i++ )
@@ -209,7 +209,7 @@ private:
             case transational_state:
             {
                 // Iterate over all integrated translational states.
-                std::vector< std::pair< std::string, std::string > > bodiesWithIntegratedStates =
+                const std::vector< std::pair< std::string, std::string > >& bodiesWithIntegratedStates =
                         integratedStates_[ transational_state ];
                 for( unsigned int i = 0; i < bodiesWithIntegratedStates.size( ); i++ )
                 {
@@ -221,7 +221,7 @@ private:
             }
             case rotational_state:
             {
-                std::vector< std::pair< std::string, std::string > > bodiesWithIntegratedStates =
+                const std::vector< std::pair< std::string, std::string > >& bodiesWithIntegratedStates =
                         integratedStates_.at( rotational_state );
                 for( unsigned int i = 0; i < bodiesWithIntegratedStates.size( ); i++ )
                 {
@@ -233,7 +233,7 @@ private:
             case body_mass_state:
             {
                 // Iterate over all integrated masses.
-                std::vector< std::pair< std::string, std::string > > bodiesWithIntegratedStates =
+                const std::vector< std::pair< std::string, std::string > >& bodiesWithIntegratedStates =
                         integratedStates_.at( body_mass_state );
                 for( unsigned int i = 0; i < bodiesWithIntegratedStates.size( ); i++ )
                 {
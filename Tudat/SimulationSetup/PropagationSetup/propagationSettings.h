@@ -27,6 +27,7 @@
 #include "Tudat/Astrodynamics/BasicAstrodynamics/massRateModel.h"
 #include "Tudat/Astrodynamics/Propagators/singleStateTypeDerivative.h"
 #include "Tudat/Astrodynamics/Propagators/nBodyStateDerivative.h"
+#include "Tudat/Astrodynamics/Propagators/propagationOutputSink.h"
 #include "Tudat/SimulationSetup/PropagationSetup/propagationOutputSettings.h"
 #include "Tudat/SimulationSetup/PropagationSetup/propagationTerminationSettings.h"
 #include "Tudat/SimulationSetup/PropagationSetup/createAccelerationModels.h"
@@ -157,7 +158,7 @@ public:
         PropagatorSettings< StateScalarType >( initialBodyStates, false ),
         stateType_( stateType ),
         terminationSettings_( terminationSettings ), dependentVariablesToSave_( dependentVariablesToSave ),
-        printInterval_( printInterval){ }
+        printInterval_( printInterval), saveSolutionHistory_( true ){ }
 
     //! Virtual destructor.
     virtual ~SingleArcPropagatorSettings( ){ }
@@ -220,6 +221,43 @@ public:
         return printInterval_;
     }
 
+    //! Function to retrieve the object that processes the output at each saved epoch during the propagation.
+    /*!
+     * Function to retrieve the object that processes the output at each saved epoch during the propagation.
+     * \return Object that processes the output at each saved epoch during the propagation (default none).
+     */
+    boost::shared_ptr< PropagationOutputSink< StateScalarType > > getOutputSink( )
+    {
+        return outputSink_;
+    }
+
+    //! Function to retrieve whether the full state and dependent variable histories are retained during propagation.
+    /*!
+     * Function to retrieve whether the full state and dependent variable histories are retained during propagation.
+     * \return Boolean denoting whether the full histories are retained (default true).
+     */
+    bool getSaveSolutionHistory( )
+    {
+        return saveSolutionHistory_;
+    }
+
+    //! Function to reset the object that processes the output at each saved epoch during the propagation.
+    /*!
+     * Function to reset the object that processes the output at each saved epoch during the propagation. The sink
+     * receives the state (in conventional form) and the dependent variables at each saved epoch, while the propagation
+     * is running. If the full histories are not retained, the state and dependent variable histories of the dynamics
+     * simulator only contain the final epoch, so that the memory use of the propagation is independent of its length.
+     * \param outputSink Object that processes the output at each saved epoch during the propagation (none if NULL).
+     * \param saveSolutionHistory Boolean denoting whether the full state and dependent variable histories are to be
+     * retained in addition to being passed to the sink.
+     */
+    void resetOutputSink( const boost::shared_ptr< PropagationOutputSink< StateScalarType > > outputSink,
+                          const bool saveSolutionHistory = true )
+    {
+        outputSink_ = outputSink;
+        saveSolutionHistory_ = saveSolutionHistory;
+    }
+
 
 protected:
 
@@ -237,6 +275,12 @@ protected:
     //! current state and time are to be printed to console (default never).
     double printInterval_;
 
+    //! Object that processes the output at each saved epoch during the propagation (default none).
+    boost::shared_ptr< PropagationOutputSink< StateScalarType > > outputSink_;
+
+    //! Boolean denoting whether the full state and dependent variable histories are retained (default true).
+    bool saveSolutionHistory_;
+
 };
 
 
@@ -110,6 +110,46 @@ createStateInterpolator( const std::map< Time, Eigen::Matrix< double, 6, 1 > >&
 }
 
 
+//! Function to create an interpolator for the new translational state of a body, from contiguous lists of times and states.
+template< >
+boost::shared_ptr< interpolators::OneDimensionalInterpolator< double, Eigen::Matrix< double, 6, 1 > > >
+createStateInterpolator( const std::vector< double >& times,
+                         const std::vector< Eigen::Matrix< double, 6, 1 > >& states )
+{
+    return boost::make_shared<
+        interpolators::LagrangeInterpolator< double, Eigen::Matrix< double, 6, 1 > > >( times, states, 6 );
+}
+
+//! Function to create an interpolator for the new translational state of a body, from contiguous lists of times and states.
+template< >
+boost::shared_ptr< interpolators::OneDimensionalInterpolator< double, Eigen::Matrix< long double, 6, 1 > > >
+createStateInterpolator( const std::vector< double >& times,
+                         const std::vector< Eigen::Matrix< long double, 6, 1 > >& states )
+{
+    return boost::make_shared<
+        interpolators::LagrangeInterpolator< double, Eigen::Matrix< long double, 6, 1 > > >( times, states, 6 );
+}
+
+//! Function to create an interpolator for the new translational state of a body, from contiguous lists of times and states.
+template< >
+boost::shared_ptr< interpolators::OneDimensionalInterpolator< Time, Eigen::Matrix< long double, 6, 1 > > >
+createStateInterpolator( const std::vector< Time >& times,
+                         const std::vector< Eigen::Matrix< long double, 6, 1 > >& states )
+{
+    return boost::make_shared<
+        interpolators::LagrangeInterpolator< Time, Eigen::Matrix< long double, 6, 1 >, long double > >( times, states, 6 );
+}
+
+//! Function to create an interpolator for the new translational state of a body, from contiguous lists of times and states.
+template< >
+boost::shared_ptr< interpolators::OneDimensionalInterpolator< Time, Eigen::Matrix< double, 6, 1 > > >
+createStateInterpolator( const std::vector< Time >& times,
+                         const std::vector< Eigen::Matrix< double, 6, 1 > >& states )
+{
+    return boost::make_shared<
+        interpolators::LagrangeInterpolator< Time, Eigen::Matrix< double, 6, 1 >, long double > >( times, states, 6 );
+}
+
 template< >
 boost::shared_ptr< interpolators::OneDimensionalInterpolator< double, Eigen::Matrix< double, 7, 1 > > >
 createRotationalStateInterpolator( const std::map< double, Eigen::Matrix< double, 7, 1 > >& stateMap )
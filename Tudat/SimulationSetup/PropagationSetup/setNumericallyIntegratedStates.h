@@ -18,6 +18,7 @@
 #include "Tudat/Astrodynamics/Ephemerides/tabulatedEphemeris.h"
 #include "Tudat/Astrodynamics/Ephemerides/tabulatedRotationalEphemeris.h"
 #include "Tudat/SimulationSetup/PropagationSetup/propagationSettings.h"
+#include "Tudat/Astrodynamics/Propagators/solutionHistory.h"
 
 
 namespace tudat
@@ -38,6 +39,47 @@ boost::shared_ptr< interpolators::OneDimensionalInterpolator< TimeType, Eigen::M
 createStateInterpolator(
         const std::map< TimeType, Eigen::Matrix< StateScalarType, 6, 1 > >& stateMap );
 
+//! Function to create an interpolator for the new translational state of a body, from lists of times and states.
+/*!
+ * Function to create an interpolator for the new translational state of a body, from lists of times and states.
+ * \param times Times at which the states are given (in increasing order).
+ * \param states New state history, w.r.t. the required ephemeris origin.
+ * \return Lagrange interpolator (order 6) that produces the required continuous state.
+ */
+template< typename TimeType, typename StateScalarType >
+boost::shared_ptr< interpolators::OneDimensionalInterpolator< TimeType, Eigen::Matrix< StateScalarType, 6, 1 > > >
+createStateInterpolator(
+        const std::vector< TimeType >& times,
+        const std::vector< Eigen::Matrix< StateScalarType, 6, 1 > >& states );
+
+//! Function to reset the tabulated ephemeris of a body
+/*!
+ * Function to reset the tabulated ephemeris of a body, from lists of times and states
+ * \param ephemerisTimes Times of new state history that is to be set (in increasing order)
+ * \param ephemerisStates New state history that is to be set
+ * \param tabulatedEphemeris Ephemeris in which the ephemerisInput is to be set.
+ */
+template< typename StateTimeType, typename StateScalarType, typename EphemerisTimeType, typename EphemerisScalarType  >
+void resetIntegratedEphemerisOfBody(
+        const std::vector< StateTimeType >& ephemerisTimes,
+        const std::vector< Eigen::Matrix< StateScalarType, 6, 1 > >& ephemerisStates,
+        const boost::shared_ptr< ephemerides::TabulatedCartesianEphemeris< EphemerisScalarType, EphemerisTimeType > > tabulatedEphemeris )
+{
+    std::vector< EphemerisTimeType > castEphemerisTimes;
+    std::vector< Eigen::Matrix< EphemerisScalarType, 6, 1 > > castEphemerisStates;
+    castEphemerisTimes.reserve( ephemerisTimes.size( ) );
+    castEphemerisStates.reserve( ephemerisStates.size( ) );
+    for( unsigned int i = 0; i < ephemerisTimes.size( ); i++ )
+    {
+        castEphemerisTimes.push_back( static_cast< EphemerisTimeType >( ephemerisTimes.at( i ) ) );
+        castEphemerisStates.push_back( ephemerisStates.at( i ).template cast< EphemerisScalarType >( ) );
+    }
+
+    boost::shared_ptr< interpolators::OneDimensionalInterpolator< EphemerisTimeType, Eigen::Matrix< EphemerisScalarType, 6, 1 > > >
+            ephemerisInterpolator = createStateInterpolator( castEphemerisTimes, castEphemerisStates );
+    tabulatedEphemeris->resetInterpolator( ephemerisInterpolator );
+}
+
 //! Function to reset the tabulated ephemeris of a body
 /*!
  * Function to reset the tabulated ephemeris of a body
@@ -49,13 +91,9 @@ void resetIntegratedEphemerisOfBody(
         const std::map< StateTimeType, Eigen::Matrix< StateScalarType, 6, 1 > >& ephemerisInput,
         const boost::shared_ptr< ephemerides::TabulatedCartesianEphemeris< EphemerisScalarType, EphemerisTimeType > > tabulatedEphemeris )
 {
-    std::map< EphemerisTimeType, Eigen::Matrix< EphemerisScalarType, 6, 1 > > castEphemerisInput;
-    utilities::castMatrixMap< StateTimeType, StateScalarType, EphemerisTimeType, EphemerisScalarType, 6, 1 >(
-                ephemerisInput, castEphemerisInput );
-    
-    boost::shared_ptr< interpolators::OneDimensionalInterpolator< EphemerisTimeType, Eigen::Matrix< EphemerisScalarType, 6, 1 > > >
-            ephemerisInterpolator = createStateInterpolator( castEphemerisInput );
-    tabulatedEphemeris->resetInterpolator( ephemerisInterpolator );
+    resetIntegratedEphemerisOfBody(
+                utilities::createVectorFromMapKeys( ephemerisInput ), utilities::createVectorFromMapValues( ephemerisInput ),
+                tabulatedEphemeris );
 }
 
 //! Function to reset the tabulated ephemeris of a body
@@ -63,13 +101,15 @@ void resetIntegratedEphemerisOfBody(
  * Function to reset the tabulated ephemeris of a body, this requires the requested body to possess
  * an ephemeris of type TabulatedCartesianEphemeris< StateScalarType, TimeType >
  * \param bodyMap List of bodies used in simulations.
- * \param ephemerisInput New state history of the body
+ * \param ephemerisTimes Times of new state history of the body (in increasing order)
+ * \param ephemerisStates New state history of the body
  * \param bodyToIntegrate Name of body for which the ephemeris is to be reset.
  */
 template< typename TimeType, typename StateScalarType >
 void resetIntegratedEphemerisOfBody(
         const simulation_setup::NamedBodyMap& bodyMap,
-        const std::map< TimeType, Eigen::Matrix< StateScalarType, 6, 1 > >& ephemerisInput,
+        const std::vector< TimeType >& ephemerisTimes,
+        const std::vector< Eigen::Matrix< StateScalarType, 6, 1 > >& ephemerisStates,
         const std::string& bodyToIntegrate )
 {
     using namespace tudat::interpolators;
@@ -97,7 +137,7 @@ void resetIntegratedEphemerisOfBody(
                     bodyMap.at( bodyToIntegrate )->getEphemeris( ) ) != NULL )
         {
             boost::shared_ptr< OneDimensionalInterpolator< TimeType, Eigen::Matrix< StateScalarType, 6, 1 > > >
-                    ephemerisInterpolator = createStateInterpolator( ephemerisInput );
+                    ephemerisInterpolator = createStateInterpolator( ephemerisTimes, ephemerisStates );
             boost::shared_ptr< TabulatedCartesianEphemeris< StateScalarType, TimeType > > tabulatedEphemeris =
                     boost::dynamic_pointer_cast< TabulatedCartesianEphemeris< StateScalarType, TimeType > >(
                         bodyMap.at( bodyToIntegrate )->getEphemeris( ) );
@@ -109,28 +149,28 @@ void resetIntegratedEphemerisOfBody(
                         bodyMap.at( bodyToIntegrate )->getEphemeris( ) ) != NULL )
             {
                 resetIntegratedEphemerisOfBody(
-                            ephemerisInput, boost::dynamic_pointer_cast< TabulatedCartesianEphemeris< double, double > >(
+                            ephemerisTimes, ephemerisStates, boost::dynamic_pointer_cast< TabulatedCartesianEphemeris< double, double > >(
                                 bodyMap.at( bodyToIntegrate )->getEphemeris( ) ) );
             }
             else if( boost::dynamic_pointer_cast< TabulatedCartesianEphemeris< long double, double > >(
                          bodyMap.at( bodyToIntegrate )->getEphemeris( ) ) != NULL )
             {
                 resetIntegratedEphemerisOfBody(
-                            ephemerisInput, boost::dynamic_pointer_cast< TabulatedCartesianEphemeris< long double, double > >(
+                            ephemerisTimes, ephemerisStates, boost::dynamic_pointer_cast< TabulatedCartesianEphemeris< long double, double > >(
                                 bodyMap.at( bodyToIntegrate )->getEphemeris( ) ) );
             }
             else if( boost::dynamic_pointer_cast< TabulatedCartesianEphemeris< double, Time > >(
                          bodyMap.at( bodyToIntegrate )->getEphemeris( ) ) != NULL )
             {
                 resetIntegratedEphemerisOfBody(
-                            ephemerisInput, boost::dynamic_pointer_cast< TabulatedCartesianEphemeris< double, Time > >(
+                            ephemerisTimes, ephemerisStates, boost::dynamic_pointer_cast< TabulatedCartesianEphemeris< double, Time > >(
                                 bodyMap.at( bodyToIntegrate )->getEphemeris( ) ) );
             }
             else if( boost::dynamic_pointer_cast< TabulatedCartesianEphemeris< long double, Time > >(
                          bodyMap.at( bodyToIntegrate )->getEphemeris( ) ) != NULL )
             {
                 resetIntegratedEphemerisOfBody(
-                            ephemerisInput, boost::dynamic_pointer_cast< TabulatedCartesianEphemeris< long double, Time > >(
+                            ephemerisTimes, ephemerisStates, boost::dynamic_pointer_cast< TabulatedCartesianEphemeris< long double, Time > >(
                                 bodyMap.at( bodyToIntegrate )->getEphemeris( ) ) );
             }
             else
@@ -141,6 +181,25 @@ void resetIntegratedEphemerisOfBody(
     }
 }
 
+//! Function to reset the tabulated ephemeris of a body
+/*!
+ * Function to reset the tabulated ephemeris of a body, this requires the requested body to possess
+ * an ephemeris of type TabulatedCartesianEphemeris (see function with vector input)
+ * \param bodyMap List of bodies used in simulations.
+ * \param ephemerisInput New state history of the body
+ * \param bodyToIntegrate Name of body for which the ephemeris is to be reset.
+ */
+template< typename TimeType, typename StateScalarType >
+void resetIntegratedEphemerisOfBody(
+        const simulation_setup::NamedBodyMap& bodyMap,
+        const std::map< TimeType, Eigen::Matrix< StateScalarType, 6, 1 > >& ephemerisInput,
+        const std::string& bodyToIntegrate )
+{
+    resetIntegratedEphemerisOfBody(
+                bodyMap, utilities::createVectorFromMapKeys( ephemerisInput ),
+                utilities::createVectorFromMapValues( ephemerisInput ), bodyToIntegrate );
+}
+
 //! Function to convert output of translational motion to input for the ephemeris.
 /*!
  * Function to convert output of translational motion from the numerical integrator to the required
@@ -191,6 +250,51 @@ void convertNumericalSolutionToEphemerisInput(
     }
 }
 
+//! Function to convert output of translational motion to input for the ephemeris.
+/*!
+ * Function to convert output of translational motion from the numerical integrator to the required
+ * input for the ephemeris, from a numerical solution stored in contiguous memory (see map-based function for details).
+ * The output is sorted by increasing time.
+ * \param bodyIndex Index of integrated body for which the state is to be retrieved
+ * \param startIndex Index in entries of equationsOfMotionNumericalSolution where the translational states start.
+ * \param equationsOfMotionNumericalSolution Full numerical solution of numerical integrator,
+ * already converted to Cartesian states (w.r.t. the integration origin of the body of bodyIndex)
+ * \param ephemerisTimes Times of state history of body bodyIndex (returned by reference).
+ * \param ephemerisStates State history of body bodyIndex w.r.t. the origin with which its ephemeris is defined
+ * (returned by reference).
+ * \param integrationToEphemerisFrameFunction Function to provide the state of the ephemeris origin
+ * of the current body w.r.t. its integration origin.
+*/
+template< typename TimeType, typename StateScalarType >
+void convertNumericalSolutionToEphemerisInput(
+        const int bodyIndex,
+        const int startIndex,
+        const SolutionHistory< TimeType, StateScalarType >& equationsOfMotionNumericalSolution,
+        std::vector< TimeType >& ephemerisTimes,
+        std::vector< Eigen::Matrix< StateScalarType, 6, 1 > >& ephemerisStates,
+        const boost::function< Eigen::Matrix< StateScalarType, 6, 1 >( const TimeType ) >
+        integrationToEphemerisFrameFunction = NULL )
+{
+    unsigned int numberOfEntries = equationsOfMotionNumericalSolution.getNumberOfEntries( );
+    ephemerisTimes.resize( numberOfEntries );
+    ephemerisStates.resize( numberOfEntries );
+
+    unsigned int currentIndex;
+    for( unsigned int i = 0; i < numberOfEntries; i++ )
+    {
+        currentIndex = equationsOfMotionNumericalSolution.getIndexInIncreasingTimeOrder( i );
+        ephemerisTimes[ i ] = equationsOfMotionNumericalSolution.getTime( currentIndex );
+        ephemerisStates[ i ] = equationsOfMotionNumericalSolution.getEntries( ).block(
+                    startIndex + 6 * bodyIndex, currentIndex, 6, 1 );
+
+        // Add required translation from integrationToEphemerisFrameFunction, if provided
+        if( integrationToEphemerisFrameFunction != 0 )
+        {
+            ephemerisStates[ i ] -= integrationToEphemerisFrameFunction( ephemerisTimes[ i ] );
+        }
+    }
+}
+
 //! Function to extract the numerical solution for the translational dynamics of a single body from full propagation history.
 /*!
  * Function to extract the numerical solution for the translational dynamics of a single body from full propagation history.
@@ -283,10 +387,69 @@ void createAndSetInterpolatorsForEphemerides(
     }
 }
 
+//! Create and reset ephemerides interpolator
+/*!
+ * Creates and resets the interpolator for the ephemerides of the integrated bodies from the
+ * numerical integration results, stored in contiguous memory. The states of each body are extracted directly from
+ * the numerical solution, without intermediate map.
+ * \param bodyMap List of bodies used in simulations.
+ * \param bodiesToIntegrate List of names of bodies which are numericall integrated (in the order in
+ * which they are in the equationsOfMotionNumericalSolution.
+ * \param startIndex Index in entries of equationsOfMotionNumericalSolution where the translational states start.
+ * \param ephemerisUpdateOrder Order in which to update the ephemeris objects.
+ * \param equationsOfMotionNumericalSolution Numerical solution of translational equations of
+ * motion, in Cartesian elements w.r.t. integratation origins.
+ * \param integrationToEphemerisFrameFunctions Function to provide the states of the ephemeris
+ * origins of each body w.r.t. their respective integration origins.
+ */
+template< typename TimeType, typename StateScalarType >
+void createAndSetInterpolatorsForEphemerides(
+        const simulation_setup::NamedBodyMap& bodyMap,
+        const std::vector< std::string >& bodiesToIntegrate,
+        const int startIndex,
+        const std::vector< std::string >& ephemerisUpdateOrder,
+        const SolutionHistory< TimeType, StateScalarType >& equationsOfMotionNumericalSolution,
+        const std::map< std::string, boost::function< Eigen::Matrix< StateScalarType, 6, 1 >( const TimeType ) > >&
+        integrationToEphemerisFrameFunctions =
+        std::map< std::string, boost::function< Eigen::Matrix< StateScalarType, 6, 1 >( const TimeType ) > >( ) )
+{
+    std::vector< TimeType > ephemerisTimes;
+    std::vector< Eigen::Matrix< StateScalarType, 6, 1 > > ephemerisStates;
+
+    // Iterate over all bodies that are integrated numerically and create state interpolator.
+    for( unsigned int i = 0; i < ephemerisUpdateOrder.size( ); i++ )
+    {
+        // Get index of current body to be updated in bodiesToIntegrate.
+        std::vector< std::string >::const_iterator bodyFindIterator = std::find(
+                    bodiesToIntegrate.begin( ), bodiesToIntegrate.end( ), ephemerisUpdateOrder.at( i ) );
+        if( bodyFindIterator == bodiesToIntegrate.end( ) )
+        {
+            throw std::runtime_error( "Error when creating and setting ephemeris after integration, cannot find body " +
+                                      ephemerisUpdateOrder.at( i ) );
+        }
+        int bodyIndex = std::distance( bodiesToIntegrate.begin( ), bodyFindIterator );
+
+        // Get frame origin function if applicable
+        boost::function< Eigen::Matrix< StateScalarType, 6, 1 >( const TimeType ) > integrationToEphemerisFrameFunction = NULL;
+        if( integrationToEphemerisFrameFunctions.count( bodiesToIntegrate.at( bodyIndex ) ) > 0 )
+        {
+            integrationToEphemerisFrameFunction =
+                    integrationToEphemerisFrameFunctions.at( bodiesToIntegrate.at( bodyIndex ) );
+        }
+
+        convertNumericalSolutionToEphemerisInput(
+                    bodyIndex, startIndex, equationsOfMotionNumericalSolution, ephemerisTimes, ephemerisStates,
+                    integrationToEphemerisFrameFunction );
+        resetIntegratedEphemerisOfBody(
+                    bodyMap, ephemerisTimes, ephemerisStates, bodiesToIntegrate.at( bodyIndex ) );
+    }
+}
+
 //! Resets the ephemerides of the integrated bodies from the numerical integration results.
 /*!
  * Resets the ephemerides of the integrated bodies from the numerical integration results, and
- * performs associated computation for ephemeris-dependent environment variables.
+ * performs associated computation for ephemeris-dependent environment variables. The numerical integration results
+ * are stored in contiguous memory.
  * \param bodyMap List of bodies used in simulations.
  * \param bodiesToIntegrate List of names of bodies which are numerically integrated (in the order in
  * which they are in the equationsOfMotionNumericalSolution map.
@@ -301,7 +464,7 @@ void createAndSetInterpolatorsForEphemerides(
 template< typename TimeType, typename StateScalarType >
 void resetIntegratedEphemerides(
         const simulation_setup::NamedBodyMap& bodyMap,
-        const std::map< TimeType, Eigen::Matrix< StateScalarType, Eigen::Dynamic, 1 > >& equationsOfMotionNumericalSolution,
+        const SolutionHistory< TimeType, StateScalarType >& equationsOfMotionNumericalSolution,
         const std::vector< std::string >& bodiesToIntegrate,
         const std::pair< unsigned int, unsigned int > startIndexAndSize,
         std::vector< std::string > ephemerisUpdateOrder = std::vector< std::string >( ),
@@ -320,7 +483,7 @@ void resetIntegratedEphemerides(
         throw std::runtime_error( "Error when resetting ephemerides, input vectors have inconsistent size" );
     }
     
-    if( static_cast< unsigned int >( equationsOfMotionNumericalSolution.begin( )->second.rows( ) )
+    if( static_cast< unsigned int >( equationsOfMotionNumericalSolution.getNumberOfRows( ) )
             < startIndexAndSize.first + startIndexAndSize.second )
     {
         throw std::runtime_error( "Error when resetting ephemerides, input solution inconsistent with start index and size." );
@@ -338,6 +501,37 @@ void resetIntegratedEphemerides(
                 equationsOfMotionNumericalSolution, integrationToEphemerisFrameFunctions );
 }
 
+//! Resets the ephemerides of the integrated bodies from the numerical integration results.
+/*!
+ * Resets the ephemerides of the integrated bodies from the numerical integration results, and
+ * performs associated computation for ephemeris-dependent environment variables.
+ * \param bodyMap List of bodies used in simulations.
+ * \param bodiesToIntegrate List of names of bodies which are numerically integrated (in the order in
+ * which they are in the equationsOfMotionNumericalSolution map.
+ * \param startIndexAndSize Pair with start index and total (contiguous) size of integrated states in entries of
+ * equationsOfMotionNumericalSolution
+ * \param ephemerisUpdateOrder Order in which to update the ephemeris objects (empty if arbitrary).
+ * \param equationsOfMotionNumericalSolution Numerical solution of translational equations of
+ * motion, in Cartesian elements w.r.t. integratation origins.
+ * \param integrationToEphemerisFrameFunctions Function to provide the states of the ephemeris
+ * origins of each body w.r.t. their respective integration origins.
+ */
+template< typename TimeType, typename StateScalarType >
+void resetIntegratedEphemerides(
+        const simulation_setup::NamedBodyMap& bodyMap,
+        const std::map< TimeType, Eigen::Matrix< StateScalarType, Eigen::Dynamic, 1 > >& equationsOfMotionNumericalSolution,
+        const std::vector< std::string >& bodiesToIntegrate,
+        const std::pair< unsigned int, unsigned int > startIndexAndSize,
+        std::vector< std::string > ephemerisUpdateOrder = std::vector< std::string >( ),
+        const std::map< std::string, boost::function< Eigen::Matrix< StateScalarType, 6, 1 >( const TimeType ) > >&
+        integrationToEphemerisFrameFunctions =
+        std::map< std::string, boost::function< Eigen::Matrix< StateScalarType, 6, 1 >( const TimeType ) > >( ) )
+{
+    resetIntegratedEphemerides(
+                bodyMap, SolutionHistory< TimeType, StateScalarType >( equationsOfMotionNumericalSolution ),
+                bodiesToIntegrate, startIndexAndSize, ephemerisUpdateOrder, integrationToEphemerisFrameFunctions );
+}
+
 //! Resets the ephemerides of the integrated bodies from the numerical multi-arc integration results.
 /*!
  * Resets the ephemerides of the integrated bodies from the numerical multi-arc integration results, and
@@ -668,6 +862,21 @@ public:
     virtual void processIntegratedStates(
             const std::map< TimeType, Eigen::Matrix< StateScalarType,
             Eigen::Dynamic, 1 > >& numericalSolution ) = 0;
+
+    //! Function that processes the entries of the stateType_ in the full numericalSolution, stored in contiguous memory
+    /*!
+     * Function that processes the entries of the stateType_ in the full numericalSolution, stored in contiguous memory.
+     * By default, the numerical solution is converted to a map, and processed by the map-based function. Derived classes
+     * may override this function to process the solution directly.
+     * \param numericalSolution Full numerical solution, in global representation (see
+     * convertToOutputSolution function in associated SingleStateTypeDerivative derived class.
+     */
+    virtual void processIntegratedSolutionHistory(
+            const SolutionHistory< TimeType, StateScalarType >& numericalSolution )
+    {
+        processIntegratedStates(
+                    numericalSolution.template convertToMap< Eigen::Matrix< StateScalarType, Eigen::Dynamic, 1 > >( ) );
+    }
     
     virtual void processIntegratedMultiArcStates(
             const std::vector< std::map< TimeType, Eigen::Matrix< StateScalarType, Eigen::Dynamic, 1 > > >& numericalSolution,
@@ -746,6 +955,22 @@ public:
                     bodyMap_, numericalSolution, bodiesToIntegrate_, this->startIndexAndSize_, ephemerisUpdateOrder_,
                     integrationToEphemerisFrameFunctions_ );
     }
+
+    //! Function processing single-arc translational state, resetting bodies' ephemerides with new states
+    /*!
+     * Function processing single-arc translational state, resetting bodies' ephemerides with new states in numericalSolution
+     * variable, stored in contiguous memory. It extracts and converts the states to the required frames, and updates the
+     * associated ephemerides.
+     * \param numericalSolution Full numerical solution, in global representation (see
+     * convertToOutputSolution function in NBodyStateDerivative class.
+     */
+    void processIntegratedSolutionHistory(
+            const SolutionHistory< TimeType, StateScalarType >& numericalSolution )
+    {
+        resetIntegratedEphemerides< TimeType, StateScalarType >(
+                    bodyMap_, numericalSolution, bodiesToIntegrate_, this->startIndexAndSize_, ephemerisUpdateOrder_,
+                    integrationToEphemerisFrameFunctions_ );
+    }
     
     //! Function processing multi-arc translational state, resetting bodies' ephemerides with new states
     /*!
@@ -1118,6 +1343,34 @@ void resetIntegratedStates(
     }
 }
 
+//! Function resetting dynamical properties of environment from numerical dynamics solution
+/*!
+ * Function to reset the dynamical properties of the environment from the numerically integrated
+ * dynamics solution, stored in contiguous memory
+ * \param equationsOfMotionNumericalSolution Solution produced by the numerical integration, in the
+ * 'conventional form'
+ * \sa SingleStateTypeDerivative::convertToOutputSolution
+ * \param integratedStateProcessors List of objects (per dynamics type) used to process integrated
+ * results into environment
+ */
+template< typename TimeType, typename StateScalarType >
+void resetIntegratedStates(
+        const SolutionHistory< TimeType, StateScalarType >& equationsOfMotionNumericalSolution,
+        const std::map< IntegratedStateType, std::vector< boost::shared_ptr<
+        IntegratedStateProcessor< TimeType, StateScalarType > > > >  integratedStateProcessors )
+{
+    for( typename std::map< IntegratedStateType, std::vector< boost::shared_ptr< IntegratedStateProcessor<
+         TimeType, StateScalarType > > > >::const_iterator updateIterator = integratedStateProcessors.begin( );
+         updateIterator != integratedStateProcessors.end( ); updateIterator++ )
+    {
+        for( unsigned int i = 0; i < updateIterator->second.size( ); i++ )
+        {
+            updateIterator->second.at( i )->processIntegratedSolutionHistory(
+                        equationsOfMotionNumericalSolution );
+        }
+    }
+}
+
 //! Function resetting dynamical properties of environment from numerical multi-arc dynamics solution
 /*!
  * Function to reset the dynamical properties of the environment from the numerically integrated multi-arc
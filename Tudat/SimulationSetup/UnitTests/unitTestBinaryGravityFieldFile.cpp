@@ -0,0 +1,109 @@
+/*    Copyright (c) 2010-2017, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ */
+
+#define BOOST_TEST_MAIN
+
+#include <boost/filesystem.hpp>
+#include <boost/test/unit_test.hpp>
+
+#include "Tudat/InputOutput/basicInputOutput.h"
+#include "Tudat/SimulationSetup/EnvironmentSetup/createGravityField.h"
+
+namespace tudat
+{
+namespace unit_tests
+{
+
+using namespace tudat::simulation_setup;
+
+BOOST_AUTO_TEST_SUITE( test_binary_gravity_field_file )
+
+//! Test whether coefficients read from a binary gravity field file are identical to those read from the text file from
+//! which it was converted, for full and truncated fields.
+BOOST_AUTO_TEST_CASE( testBinaryGravityFieldFile )
+{
+    const std::string textFileName = input_output::getGravityModelsPath( ) + "Earth/egm96.txt";
+    const std::string binaryFileName = ( boost::filesystem::temp_directory_path( ) /
+                                         boost::filesystem::unique_path( "egm96%%%%%%%%.bin" ) ).string( );
+
+    // Convert full EGM96 field to binary file.
+    convertGravityFieldFileToBinary( textFileName, binaryFileName, 360, 360, 0, 1 );
+    BOOST_CHECK( isBinaryGravityFieldFile( binaryFileName ) );
+    BOOST_CHECK( !isBinaryGravityFieldFile( textFileName ) );
+
+    // Compare text and binary files, for full field, truncated fields, and field exceeding file contents.
+    std::vector< std::pair< int, int > > degreesAndOrders;
+    degreesAndOrders.push_back( std::make_pair( 360, 360 ) );
+    degreesAndOrders.push_back( std::make_pair( 50, 50 ) );
+    degreesAndOrders.push_back( std::make_pair( 100, 30 ) );
+    degreesAndOrders.push_back( std::make_pair( 0, 0 ) );
+    degreesAndOrders.push_back( std::make_pair( 370, 365 ) );
+    for( unsigned int i = 0; i < degreesAndOrders.size( ); i++ )
+    {
+        const int maximumDegree = degreesAndOrders.at( i ).first;
+        const int maximumOrder = degreesAndOrders.at( i ).second;
+
+        std::pair< Eigen::MatrixXd, Eigen::MatrixXd > textCoefficients, binaryCoefficients;
+        std::pair< double, double > textReferenceData = readGravityFieldFile(
+                    textFileName, maximumDegree, maximumOrder, textCoefficients, 0, 1 );
+        std::pair< double, double > binaryReferenceData = readGravityFieldFile(
+                    binaryFileName, maximumDegree, maximumOrder, binaryCoefficients, 0, 1 );
+
+        BOOST_CHECK_EQUAL( textReferenceData.first, binaryReferenceData.first );
+        BOOST_CHECK_EQUAL( textReferenceData.second, binaryReferenceData.second );
+        BOOST_CHECK_EQUAL( binaryCoefficients.first.rows( ), maximumDegree + 1 );
+        BOOST_CHECK_EQUAL( binaryCoefficients.first.cols( ), maximumOrder + 1 );
+        BOOST_CHECK( textCoefficients.first == binaryCoefficients.first );
+        BOOST_CHECK( textCoefficients.second == binaryCoefficients.second );
+    }
+
+    // Check that binary file can be used for gravity field settings.
+    FromFileSphericalHarmonicsGravityFieldSettings textSettings( textFileName, "IAU_Earth", 20, 20, 0, 1 );
+    FromFileSphericalHarmonicsGravityFieldSettings binarySettings( binaryFileName, "IAU_Earth", 20, 20, 0, 1 );
+    BOOST_CHECK_EQUAL( textSettings.getGravitationalParameter( ), binarySettings.getGravitationalParameter( ) );
+    BOOST_CHECK_EQUAL( textSettings.getReferenceRadius( ), binarySettings.getReferenceRadius( ) );
+    BOOST_CHECK( textSettings.getCosineCoefficients( ) == binarySettings.getCosineCoefficients( ) );
+    BOOST_CHECK( textSettings.getSineCoefficients( ) == binarySettings.getSineCoefficients( ) );
+
+    boost::filesystem::remove( binaryFileName );
+}
+
+//! Test whether binary gravity field files without reference data, or with inconsistent contents, are handled correctly.
+BOOST_AUTO_TEST_CASE( testBinaryGravityFieldFileErrors )
+{
+    const std::string binaryFileName = ( boost::filesystem::temp_directory_path( ) /
+                                         boost::filesystem::unique_path( "gravityField%%%%%%%%.bin" ) ).string( );
+
+    // Write file without gravitational parameter and reference radius (only coefficients with order <= degree are
+    // stored).
+    Eigen::MatrixXd cosineCoefficients = Eigen::MatrixXd::Random( 5, 3 ).triangularView< Eigen::Lower >( );
+    Eigen::MatrixXd sineCoefficients = Eigen::MatrixXd::Random( 5, 3 ).triangularView< Eigen::Lower >( );
+    cosineCoefficients( 0, 0 ) = 1.0;
+    writeBinaryGravityFieldFile( binaryFileName, cosineCoefficients, sineCoefficients );
+
+    std::pair< Eigen::MatrixXd, Eigen::MatrixXd > coefficients;
+    std::pair< double, double > referenceData = readGravityFieldFile( binaryFileName, 4, 2, coefficients );
+    BOOST_CHECK( referenceData.first != referenceData.first );
+    BOOST_CHECK( referenceData.second != referenceData.second );
+    BOOST_CHECK( coefficients.first == cosineCoefficients );
+    BOOST_CHECK( coefficients.second == sineCoefficients );
+    BOOST_CHECK_THROW( readGravityFieldFile( binaryFileName, 4, 2, coefficients, 0, 1 ), std::runtime_error );
+
+    // Check that truncated file is rejected.
+    boost::filesystem::resize_file( binaryFileName, boost::filesystem::file_size( binaryFileName ) - 8 );
+    BOOST_CHECK_THROW( readGravityFieldFile( binaryFileName, 4, 2, coefficients ), std::runtime_error );
+
+    boost::filesystem::remove( binaryFileName );
+}
+
+BOOST_AUTO_TEST_SUITE_END( )
+
+} // namespace unit_tests
+} // namespace tudat
@@ -12,12 +12,15 @@
 
 #include <limits>
 
+#include <boost/bind.hpp>
+#include <boost/filesystem.hpp>
 #include <boost/test/unit_test.hpp>
 #include <boost/make_shared.hpp>
 
 #include <Eigen/Core>
 
 #include "Tudat/Astrodynamics/Aerodynamics/exponentialAtmosphere.h"
+#include "Tudat/Astrodynamics/Aerodynamics/griddedAtmosphere.h"
 
 #if USE_NRLMSISE00
 #include "Tudat/Astrodynamics/Aerodynamics/nrlmsise00Atmosphere.h"
@@ -114,6 +117,19 @@ BOOST_AUTO_TEST_CASE( test_atmosphereModelSetup )
     BOOST_CHECK_EQUAL( manualExponentialAtmosphere.getTemperature( 32.0, 0.0, 0.0, 0.0 ),
                        exponentialAtmosphere->getTemperature( 32.0, 0.0, 0.0, 0.0 ) );
 
+    // Create gridded atmosphere by sampling exponential atmosphere, and verify that its (logarithmic) interpolation
+    // reproduces the exponential atmosphere.
+    boost::shared_ptr< aerodynamics::AtmosphereModel > griddedAtmosphere =
+            createAtmosphereModel( boost::make_shared< GriddedAtmosphereSettings >(
+                                       exponentialAtmosphereSettings, 0.0, 100.0E3, 101, 3, 2, 0.0 ), "Earth" );
+    BOOST_CHECK( boost::dynamic_pointer_cast< aerodynamics::GriddedAtmosphere >( griddedAtmosphere ) != NULL );
+    BOOST_CHECK_CLOSE_FRACTION( manualExponentialAtmosphere.getDensity( 32.0, 0.0, 0.0, 0.0 ),
+                                griddedAtmosphere->getDensity( 32.0, 0.0, 0.0, 0.0 ), 1.0E-12 );
+    BOOST_CHECK_CLOSE_FRACTION( manualExponentialAtmosphere.getPressure( 32.0, 0.0, 0.0, 0.0 ),
+                                griddedAtmosphere->getPressure( 32.0, 0.0, 0.0, 0.0 ), 1.0E-12 );
+    BOOST_CHECK_CLOSE_FRACTION( manualExponentialAtmosphere.getTemperature( 32.0, 0.0, 0.0, 0.0 ),
+                                griddedAtmosphere->getTemperature( 32.0, 0.0, 0.0, 0.0 ), 1.0E-12 );
+
 #if USE_NRLMSISE00
     boost::shared_ptr< AtmosphereSettings > nrlmsise00AtmosphereSettings;
     for( int atmosphereTest = 0; atmosphereTest < 2; atmosphereTest++ )
@@ -820,6 +836,57 @@ BOOST_AUTO_TEST_CASE( test_earthRotationModelSetup )
         }
     }
 }
+
+//! Test whether a cached ITRS to GCRS rotation table is only reused if it was generated from the same source data.
+BOOST_AUTO_TEST_CASE( test_earthRotationTableCacheSetup )
+{
+    const double startTime = 3.0E8;
+    const double endTime = startTime + 86400.0;
+    std::string cacheFile = ( boost::filesystem::temp_directory_path( ) /
+                              boost::filesystem::unique_path( "itrsToGcrsRotationTable%%%%%%%%.bin" ) ).string( );
+
+    boost::shared_ptr< GcrsToItrsRotationModelSettings > rotationSettings =
+            boost::make_shared< GcrsToItrsRotationModelSettings >( );
+    rotationSettings->setRotationTableSettings( boost::make_shared< ItrsToGcrsRotationTableSettings >(
+                                                    startTime, endTime, 1.0E-11, cacheFile, 2 ) );
+    boost::shared_ptr< GcrsToItrsRotationModelSettings > rotationSettings2000b =
+            boost::make_shared< GcrsToItrsRotationModelSettings >( basic_astrodynamics::iau_2000_b );
+
+    std::size_t sourceDataHash = computeItrsToGcrsRotationTableSourceDataHash( rotationSettings );
+    std::size_t sourceDataHash2000b = computeItrsToGcrsRotationTableSourceDataHash( rotationSettings2000b );
+    BOOST_CHECK( sourceDataHash != sourceDataHash2000b );
+
+    // Create table from IAU 2000B settings.
+    earth_orientation::ItrsToGcrsRotationTable rotationTable2000b(
+                boost::bind( &createEarthOrientationAnglesCalculator, rotationSettings2000b ), startTime, endTime,
+                1.0E-11, basic_astrodynamics::tdb_scale, 2, sourceDataHash2000b );
+    const double testTime = startTime + 12345.6;
+
+    // Check that cached table is not used if it was generated from different source data.
+    rotationTable2000b.saveToFile( cacheFile );
+    boost::shared_ptr< earth_orientation::ItrsToGcrsRotationTable > rotationTable =
+            createItrsToGcrsRotationTable( rotationSettings );
+    BOOST_CHECK_EQUAL( rotationTable->getSourceDataHash( ), sourceDataHash );
+    BOOST_CHECK( rotationTable->getRotationFromItrsToGcrs( testTime ).coeffs( ) !=
+                 rotationTable2000b.getRotationFromItrsToGcrs( testTime ).coeffs( ) );
+
+    // Check that regenerated table was saved to cache file.
+    rotationTable.reset( );
+    BOOST_CHECK_EQUAL( earth_orientation::ItrsToGcrsRotationTable( cacheFile ).getSourceDataHash( ), sourceDataHash );
+
+    // Check that cached table is used if it was generated from the same source data (IAU 2000B table is stored with
+    // hash of current settings, so that reuse can be detected).
+    earth_orientation::ItrsToGcrsRotationTable(
+                boost::bind( &createEarthOrientationAnglesCalculator, rotationSettings2000b ), startTime, endTime,
+                1.0E-11, basic_astrodynamics::tdb_scale, 2, sourceDataHash ).saveToFile( cacheFile );
+    rotationTable = createItrsToGcrsRotationTable( rotationSettings );
+    BOOST_CHECK_EQUAL( rotationTable->getSourceDataHash( ), sourceDataHash );
+    BOOST_CHECK( rotationTable->getRotationFromItrsToGcrs( testTime ).coeffs( ) ==
+                 rotationTable2000b.getRotationFromItrsToGcrs( testTime ).coeffs( ) );
+
+    rotationTable.reset( );
+    boost::filesystem::remove( cacheFile );
+}
 #endif
 
 #if USE_CSPICE